@@ -391,6 +391,57 @@ void PNSLR_ResetEvent(
     PNSLR_Event* event
 );
 
+// Atomics ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * Atomically loads a 64-bit integer, with sequentially-consistent ordering.
+ */
+i64 PNSLR_AtomicLoadI64(
+    i64* target
+);
+
+/**
+ * Atomically stores a 64-bit integer, with sequentially-consistent ordering.
+ */
+void PNSLR_AtomicStoreI64(
+    i64* target,
+    i64 value
+);
+
+/**
+ * Atomically adds 'value' to a 64-bit integer.
+ * Returns the value it held before the addition.
+ */
+i64 PNSLR_AtomicFetchAddI64(
+    i64* target,
+    i64 value
+);
+
+/**
+ * Atomically replaces a 64-bit integer with 'desired' if it still holds '*expected'.
+ * Returns true on success; on failure, '*expected' is updated to the current value.
+ */
+b8 PNSLR_AtomicCompareExchangeI64(
+    i64* target,
+    i64* expected,
+    i64 desired
+);
+
+/**
+ * Atomically loads a pointer, with sequentially-consistent ordering.
+ */
+rawptr PNSLR_AtomicLoadPtr(
+    rawptr* target
+);
+
+/**
+ * Atomically stores a pointer, with sequentially-consistent ordering.
+ */
+void PNSLR_AtomicStorePtr(
+    rawptr* target,
+    rawptr value
+);
+
 // #######################################################################################
 // Memory
 // #######################################################################################
@@ -401,7 +452,7 @@ void PNSLR_ResetEvent(
 void PNSLR_MemSet(
     rawptr memory,
     i32 value,
-    i32 size
+    i64 size
 );
 
 /**
@@ -410,7 +461,7 @@ void PNSLR_MemSet(
 void PNSLR_MemCopy(
     rawptr destination,
     rawptr source,
-    i32 size
+    i64 size
 );
 
 /**
@@ -419,7 +470,48 @@ void PNSLR_MemCopy(
 void PNSLR_MemMove(
     rawptr destination,
     rawptr source,
-    i32 size
+    i64 size
+);
+
+// Virtual Memory ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * Get the size of a virtual memory page, the granularity at which memory is committed/decommitted.
+ */
+i32 PNSLR_GetVirtualMemoryPageSize(void);
+
+/**
+ * Reserve a range of address space without backing it with physical memory.
+ * Returns nil on failure.
+ */
+rawptr PNSLR_ReserveVirtualMemory(
+    i64 size
+);
+
+/**
+ * Back a (page-aligned) part of a reserved range with read-write memory.
+ * Freshly committed pages are always zeroed.
+ */
+b8 PNSLR_CommitVirtualMemory(
+    rawptr memory,
+    i64 size
+);
+
+/**
+ * Return the physical memory behind a (page-aligned) part of a reserved range to the OS.
+ * The range stays reserved, and reads back as zeroes once committed again.
+ */
+b8 PNSLR_DecommitVirtualMemory(
+    rawptr memory,
+    i64 size
+);
+
+/**
+ * Release an entire range obtained from `PNSLR_ReserveVirtualMemory`.
+ */
+b8 PNSLR_ReleaseVirtualMemory(
+    rawptr memory,
+    i64 size
 );
 
 // #######################################################################################
@@ -475,10 +567,10 @@ typedef u8 PNSLR_AllocatorError /* use as value */;
 typedef rawptr (*PNSLR_AllocatorProcedure)(
     rawptr allocatorData,
     PNSLR_AllocatorMode mode,
-    i32 size,
+    i64 size,
     i32 alignment,
     rawptr oldMemory,
-    i32 oldSize,
+    i64 oldSize,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError* error
 );
@@ -502,7 +594,7 @@ PNSLR_DECLARE_ARRAY_SLICE(PNSLR_Allocator);
 rawptr PNSLR_Allocate(
     PNSLR_Allocator allocator,
     b8 zeroed,
-    i32 size,
+    i64 size,
     i32 alignment,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError* error
@@ -515,8 +607,8 @@ rawptr PNSLR_Resize(
     PNSLR_Allocator allocator,
     b8 zeroed,
     rawptr oldMemory,
-    i32 oldSize,
-    i32 newSize,
+    i64 oldSize,
+    i64 newSize,
     i32 alignment,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError* error
@@ -529,8 +621,8 @@ rawptr PNSLR_DefaultResize(
     PNSLR_Allocator allocator,
     b8 zeroed,
     rawptr oldMemory,
-    i32 oldSize,
-    i32 newSize,
+    i64 oldSize,
+    i64 newSize,
     i32 alignment,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError* error
@@ -585,14 +677,44 @@ PNSLR_Allocator PNSLR_GetAllocator_DefaultHeap(void);
 rawptr PNSLR_AllocatorFn_DefaultHeap(
     rawptr allocatorData,
     PNSLR_AllocatorMode mode,
-    i32 size,
+    i64 size,
+    i32 alignment,
+    rawptr oldMemory,
+    i64 oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+// Thread-Caching Heap Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * Get the thread-caching heap allocator.
+ * Small allocations are served from per-size-class caches local to each thread, refilled in
+ * batches from a shared central free list; large ones go straight to the OS.
+ * Memory fresh from the OS is already zeroed, so zeroed allocations only clear recycled blocks.
+ */
+PNSLR_Allocator PNSLR_GetAllocator_ThreadCachingHeap(void);
+
+/**
+ * Main allocator function for the thread-caching heap allocator.
+ */
+rawptr PNSLR_AllocatorFn_ThreadCachingHeap(
+    rawptr allocatorData,
+    PNSLR_AllocatorMode mode,
+    i64 size,
     i32 alignment,
     rawptr oldMemory,
-    i32 oldSize,
+    i64 oldSize,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError* error
 );
 
+/**
+ * Hand all the blocks cached by the calling thread back to the central free list.
+ * Threads started with `PNSLR_StartThread` do this automatically before exiting.
+ */
+void PNSLR_FlushThreadCachingHeapCache(void);
+
 // Arena Alloator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
 /**
@@ -603,8 +725,8 @@ typedef struct PNSLR_ArenaAllocatorBlock
     struct PNSLR_ArenaAllocatorBlock* previous;
     PNSLR_Allocator allocator;
     rawptr memory;
-    u32 capacity;
-    u32 used;
+    u64 capacity;
+    u64 used;
 } PNSLR_ArenaAllocatorBlock;
 
 /**
@@ -614,9 +736,9 @@ typedef struct PNSLR_ArenaAllocatorPayload
 {
     PNSLR_Allocator backingAllocator;
     PNSLR_ArenaAllocatorBlock* currentBlock;
-    u32 totalUsed;
-    u32 totalCapacity;
-    u32 minimumBlockSize;
+    u64 totalUsed;
+    u64 totalCapacity;
+    u64 minimumBlockSize;
     u32 numSnapshots;
 } PNSLR_ArenaAllocatorPayload;
 
@@ -628,7 +750,7 @@ typedef struct PNSLR_ArenaAllocatorPayload
  */
 PNSLR_Allocator PNSLR_NewAllocator_Arena(
     PNSLR_Allocator backingAllocator,
-    u32 pageSize,
+    u64 pageSize,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError* error
 );
@@ -644,142 +766,860 @@ void PNSLR_DestroyAllocator_Arena(
 );
 
 /**
- * Main allocator function for the arena allocator.
+ * Main allocator function for the arena allocator.
+ */
+rawptr PNSLR_AllocatorFn_Arena(
+    rawptr allocatorData,
+    PNSLR_AllocatorMode mode,
+    i64 size,
+    i32 alignment,
+    rawptr oldMemory,
+    i64 oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+typedef u8 PNSLR_ArenaSnapshotError /* use as value */;
+#define PNSLR_ArenaSnapshotError_None ((PNSLR_ArenaSnapshotError) 0)
+#define PNSLR_ArenaSnapshotError_InvalidData ((PNSLR_ArenaSnapshotError) 1)
+#define PNSLR_ArenaSnapshotError_MemoryBlockNotOwned ((PNSLR_ArenaSnapshotError) 2)
+#define PNSLR_ArenaSnapshotError_OutOfOrderRestoreUsage ((PNSLR_ArenaSnapshotError) 3)
+#define PNSLR_ArenaSnapshotError_DoubleRestoreOrDiscardUsage ((PNSLR_ArenaSnapshotError) 4)
+
+/**
+ * A snapshot of the arena allocator, recording its state at a specific point in time.
+ * Can be saved/loaded/discarded as needed.
+ */
+typedef struct PNSLR_ArenaAllocatorSnapshot
+{
+    b8 valid;
+    PNSLR_ArenaAllocatorPayload* payload;
+    PNSLR_ArenaAllocatorBlock* block;
+    u64 used;
+} PNSLR_ArenaAllocatorSnapshot;
+
+/**
+ * Ensures that the arena allocator has either restored/discarded all the
+ * snapshots that were taken.
+ */
+b8 PNSLR_ValidateArenaAllocatorSnapshotState(
+    PNSLR_Allocator allocator
+);
+
+/**
+ * Captures a snapshot of the arena allocator.
+ * The returned value can be used to load back the existing state at this point.
+ */
+PNSLR_ArenaAllocatorSnapshot PNSLR_CaptureArenaAllocatorSnapshot(
+    PNSLR_Allocator allocator
+);
+
+/**
+ * Restores the state of the arena allocator from a snapshot.
+ * Upon success, the snapshot is marked as invalid.
+ */
+PNSLR_ArenaSnapshotError PNSLR_RestoreArenaAllocatorSnapshot(
+    PNSLR_ArenaAllocatorSnapshot* snapshot,
+    PNSLR_SourceCodeLocation loc
+);
+
+/**
+ * Discards a snapshot of the arena allocator.
+ */
+PNSLR_ArenaSnapshotError PNSLR_DiscardArenaAllocatorSnapshot(
+    PNSLR_ArenaAllocatorSnapshot* snapshot
+);
+
+// Virtual Arena Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * The payload used by the virtual arena allocator.
+ * Lives at the very start of its own reserved range, followed by the allocations.
+ */
+typedef struct PNSLR_VirtualArenaAllocatorPayload
+{
+    u8* memory;
+    i64 reserved;
+    i64 committed;
+    i64 used;
+    i32 pageSize;
+    u32 numSnapshots;
+} PNSLR_VirtualArenaAllocatorPayload;
+
+/**
+ * Create an arena allocator that reserves 'reserveSize' bytes of address space up-front and
+ * commits pages on demand, so all allocations live in one contiguous span. The last allocation
+ * can always be resized in place, and restoring a snapshot returns the tail pages to the OS.
+ */
+PNSLR_Allocator PNSLR_NewAllocator_VirtualArena(
+    i64 reserveSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+/**
+ * Destroy a virtual arena allocator and release its entire reserved range.
+ */
+void PNSLR_DestroyAllocator_VirtualArena(
+    PNSLR_Allocator allocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+/**
+ * Main allocator function for the virtual arena allocator.
+ */
+rawptr PNSLR_AllocatorFn_VirtualArena(
+    rawptr allocatorData,
+    PNSLR_AllocatorMode mode,
+    i64 size,
+    i32 alignment,
+    rawptr oldMemory,
+    i64 oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+/**
+ * A snapshot of the virtual arena allocator, recording its state at a specific point in time.
+ */
+typedef struct PNSLR_VirtualArenaAllocatorSnapshot
+{
+    b8 valid;
+    PNSLR_VirtualArenaAllocatorPayload* payload;
+    i64 used;
+} PNSLR_VirtualArenaAllocatorSnapshot;
+
+/**
+ * Ensures that the virtual arena allocator has either restored/discarded all the
+ * snapshots that were taken.
+ */
+b8 PNSLR_ValidateVirtualArenaAllocatorSnapshotState(
+    PNSLR_Allocator allocator
+);
+
+/**
+ * Captures a snapshot of the virtual arena allocator.
+ */
+PNSLR_VirtualArenaAllocatorSnapshot PNSLR_CaptureVirtualArenaAllocatorSnapshot(
+    PNSLR_Allocator allocator
+);
+
+/**
+ * Restores the state of the virtual arena allocator from a snapshot, decommitting the pages past it.
+ * Upon success, the snapshot is marked as invalid.
+ */
+PNSLR_ArenaSnapshotError PNSLR_RestoreVirtualArenaAllocatorSnapshot(
+    PNSLR_VirtualArenaAllocatorSnapshot* snapshot,
+    PNSLR_SourceCodeLocation loc
+);
+
+/**
+ * Discards a snapshot of the virtual arena allocator.
+ */
+PNSLR_ArenaSnapshotError PNSLR_DiscardVirtualArenaAllocatorSnapshot(
+    PNSLR_VirtualArenaAllocatorSnapshot* snapshot
+);
+
+// Concurrent Arena Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * A block of memory used by the concurrent arena allocator.
+ * 'used' is bumped atomically and can overshoot 'capacity' once the block is full.
+ */
+typedef struct PNSLR_ConcurrentArenaAllocatorBlock
+{
+    struct PNSLR_ConcurrentArenaAllocatorBlock* previous;
+    u8* memory;
+    i64 capacity;
+    i64 used;
+} PNSLR_ConcurrentArenaAllocatorBlock;
+
+/**
+ * The payload used by the concurrent arena allocator.
+ * Threads lease 'leaseSize' bytes at a time from the current block and bump-allocate
+ * from their lease without touching shared state; only new blocks take the lock.
+ */
+typedef struct PNSLR_ConcurrentArenaAllocatorPayload
+{
+    PNSLR_Allocator backingAllocator;
+    PNSLR_Mutex growthMutex;
+    PNSLR_ConcurrentArenaAllocatorBlock* currentBlock;
+    i64 minimumBlockSize;
+    i64 leaseSize;
+    i64 totalCapacity;
+    i64 id;
+    i64 generation;
+} PNSLR_ConcurrentArenaAllocatorPayload;
+
+/**
+ * Create an arena allocator that many threads can allocate from at the same time.
+ * Blocks are at least 'blockSize' bytes, and each thread leases 'leaseSize' bytes
+ * (rounded up to a cache line) at a time; allocations bigger than half a lease go
+ * straight to the block. Individual frees are not supported, use a single FreeAll
+ * once no thread is allocating anymore (e.g. at the end of a frame).
+ * The backing allocator is only ever called under a lock.
+ */
+PNSLR_Allocator PNSLR_NewAllocator_ConcurrentArena(
+    PNSLR_Allocator backingAllocator,
+    i64 blockSize,
+    i32 leaseSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+/**
+ * Destroy a concurrent arena allocator and free all its resources.
+ * This does not free the backing allocator, only the arena allocator's own resources.
+ */
+void PNSLR_DestroyAllocator_ConcurrentArena(
+    PNSLR_Allocator allocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+/**
+ * Main allocator function for the concurrent arena allocator.
+ */
+rawptr PNSLR_AllocatorFn_ConcurrentArena(
+    rawptr allocatorData,
+    PNSLR_AllocatorMode mode,
+    i64 size,
+    i32 alignment,
+    rawptr oldMemory,
+    i64 oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+// Frame Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * A block of memory used by the frame allocator. Blocks are kept around and reused
+ * once their frame comes around again.
+ */
+typedef struct PNSLR_FrameAllocatorBlock
+{
+    struct PNSLR_FrameAllocatorBlock* next;
+    u8* memory;
+    i64 capacity;
+    i64 used;
+} PNSLR_FrameAllocatorBlock;
+
+/**
+ * One frame's worth of blocks in the frame allocator.
+ */
+typedef struct PNSLR_FrameAllocatorFrame
+{
+    PNSLR_FrameAllocatorBlock* firstBlock;
+    PNSLR_FrameAllocatorBlock* currentBlock;
+    i64 used;
+    i64 capacity;
+    i64 highWaterMark;
+} PNSLR_FrameAllocatorFrame;
+
+/**
+ * The payload used by the frame allocator, a ring of up to 8 per-frame arenas.
+ */
+typedef struct PNSLR_FrameAllocatorPayload
+{
+    PNSLR_Allocator backingAllocator;
+    PNSLR_FrameAllocatorFrame frames[8];
+    i64 minimumBlockSize;
+    i64 peakHighWaterMark;
+    u64 frameIndex;
+    i32 numFrames;
+    i32 currentFrame;
+} PNSLR_FrameAllocatorPayload;
+
+/**
+ * Usage statistics for a frame allocator.
+ */
+typedef struct PNSLR_FrameAllocatorStats
+{
+    u64 frameIndex;
+    i64 usedBytes;
+    i64 lastHighWaterMark;
+    i64 peakHighWaterMark;
+    i64 totalCapacity;
+    i32 numFrames;
+} PNSLR_FrameAllocatorStats;
+
+/**
+ * Create a frame allocator: a ring of 'numFrames' (1 to 8) arenas, where memory allocated
+ * during a frame survives the next 'numFrames - 1' calls to `PNSLR_AdvanceFrameAllocator`,
+ * and is reclaimed by the 'numFrames'-th one.
+ * Blocks are at least 'blockSize' bytes, and are never handed back to the backing allocator
+ * until the frame allocator is destroyed.
+ * Individual frees are not supported.
+ */
+PNSLR_Allocator PNSLR_NewAllocator_Frame(
+    PNSLR_Allocator backingAllocator,
+    i32 numFrames,
+    i64 blockSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+/**
+ * Destroy a frame allocator and free all its resources.
+ * This does not free the backing allocator, only the frame allocator's own resources.
+ */
+void PNSLR_DestroyAllocator_Frame(
+    PNSLR_Allocator allocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+/**
+ * Main allocator function for the frame allocator.
+ * FreeAll resets every frame (keeping their blocks).
+ */
+rawptr PNSLR_AllocatorFn_Frame(
+    rawptr allocatorData,
+    PNSLR_AllocatorMode mode,
+    i64 size,
+    i32 alignment,
+    rawptr oldMemory,
+    i64 oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+/**
+ * Moves a frame allocator on to the next frame, resetting the oldest frame's arena
+ * (and so invalidating everything allocated 'numFrames' frames ago) for reuse.
+ * Returns the high-water mark of the frame that just ended.
+ */
+i64 PNSLR_AdvanceFrameAllocator(
+    PNSLR_Allocator allocator
+);
+
+/**
+ * Get the current usage statistics of a frame allocator.
+ * Returns zeroed stats if the allocator is not a frame allocator.
+ */
+PNSLR_FrameAllocatorStats PNSLR_GetFrameAllocatorStats(
+    PNSLR_Allocator allocator
+);
+
+// Stack Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * A page of a stack allocator.
+ */
+typedef struct PNSLR_ALIGNAS(8) PNSLR_StackAllocatorPage
+{
+    struct PNSLR_StackAllocatorPage* previousPage;
+    u64 usedBytes;
+    u8 buffer[8192];
+} PNSLR_StackAllocatorPage;
+
+/**
+ * The header used for every separate stack allocation.
+ * This is used to store metadata about the allocation and deallocate appropriately.
+ */
+typedef struct PNSLR_StackAllocationHeader
+{
+    PNSLR_StackAllocatorPage* page;
+    i64 size;
+    i32 alignment;
+    rawptr lastAllocation;
+    rawptr lastAllocationHeader;
+} PNSLR_StackAllocationHeader;
+
+/**
+ * The payload used by the stack allocator.
+ */
+typedef struct PNSLR_StackAllocatorPayload
+{
+    PNSLR_Allocator backingAllocator;
+    PNSLR_StackAllocatorPage* currentPage;
+    rawptr lastAllocation;
+    PNSLR_StackAllocationHeader* lastAllocationHeader;
+} PNSLR_StackAllocatorPayload;
+
+/**
+ * Create a stack allocator with the specified backing allocator.
+ * The stack allocator will use the backing allocator to allocate its pages.
+ * The stack allocator will not free the backing allocator, so it is the caller's responsibility to
+ * free the backing allocator when it is no longer needed.
+ */
+PNSLR_Allocator PNSLR_NewAllocator_Stack(
+    PNSLR_Allocator backingAllocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+/**
+ * Destroy a stack allocator and free all its resources.
+ * This does not free the backing allocator, only the stack allocator's own resources.
+ */
+void PNSLR_DestroyAllocator_Stack(
+    PNSLR_Allocator allocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+/**
+ * Main allocator function for the stack allocator.
+ */
+rawptr PNSLR_AllocatorFn_Stack(
+    rawptr allocatorData,
+    PNSLR_AllocatorMode mode,
+    i64 size,
+    i32 alignment,
+    rawptr oldMemory,
+    i64 oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+// Pool Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * A chunk of fixed-size slots owned by the pool allocator.
+ * Slots are handed out from the chunk in order before they're ever recycled via the free list.
+ */
+typedef struct PNSLR_PoolAllocatorChunk
+{
+    struct PNSLR_PoolAllocatorChunk* previous;
+    rawptr slots;
+    i32 slotsCount;
+    i32 slotsTouched;
+} PNSLR_PoolAllocatorChunk;
+
+/**
+ * The payload used by the pool allocator.
+ * Freed slots are threaded into an intrusive singly-linked list, so both allocation and free are O(1).
+ */
+typedef struct PNSLR_PoolAllocatorPayload
+{
+    PNSLR_Allocator backingAllocator;
+    PNSLR_PoolAllocatorChunk* currentChunk;
+    rawptr freeList;
+    i32 slotSize;
+    i32 slotAlignment;
+    i32 slotStride;
+    i32 slotsPerChunk;
+    i64 numSlotsUsed;
+    i64 numSlotsTotal;
+} PNSLR_PoolAllocatorPayload;
+
+/**
+ * Create a pool allocator that hands out slots of up to 'slotSize' bytes, aligned to
+ * 'slotAlignment', growing 'slotsPerChunk' slots at a time from the backing allocator.
+ * The pool allocator will not free the backing allocator, so it is the caller's responsibility to
+ * free the backing allocator when it is no longer needed.
+ */
+PNSLR_Allocator PNSLR_NewAllocator_Pool(
+    PNSLR_Allocator backingAllocator,
+    i32 slotSize,
+    i32 slotAlignment,
+    i32 slotsPerChunk,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+/**
+ * Destroy a pool allocator and free all its resources.
+ * This does not free the backing allocator, only the pool allocator's own resources.
+ */
+void PNSLR_DestroyAllocator_Pool(
+    PNSLR_Allocator allocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+/**
+ * Main allocator function for the pool allocator.
+ */
+rawptr PNSLR_AllocatorFn_Pool(
+    rawptr allocatorData,
+    PNSLR_AllocatorMode mode,
+    i64 size,
+    i32 alignment,
+    rawptr oldMemory,
+    i64 oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+// Slab Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * The header at the start of every slab of the slab allocator.
+ * Slabs are aligned to their own size, so any object can find its slab by masking its address.
+ * Allocations too big for any cache get a dedicated slab of their own, with a 'cacheIndex' of -1.
+ */
+typedef struct PNSLR_SlabAllocatorSlab
+{
+    struct PNSLR_SlabAllocatorSlab* next;
+    struct PNSLR_SlabAllocatorSlab* previous;
+    rawptr freeList;
+    i64 capacity;
+    i32 cacheIndex;
+    i32 objectsCount;
+    i32 objectsUsed;
+    i32 objectsTouched;
+} PNSLR_SlabAllocatorSlab;
+
+/**
+ * A cache of slabs for one object size (a multiple of the cache line size),
+ * split into partially filled, full and completely empty slabs.
+ */
+typedef struct PNSLR_SlabAllocatorCache
+{
+    PNSLR_Mutex mutex;
+    PNSLR_SlabAllocatorSlab* partialSlabs;
+    PNSLR_SlabAllocatorSlab* fullSlabs;
+    PNSLR_SlabAllocatorSlab* emptySlabs;
+    i64 numObjectsUsed;
+    i32 objectStride;
+    i32 objectsPerSlab;
+    i32 numSlabs;
+    i32 numEmptySlabs;
+} PNSLR_SlabAllocatorCache;
+
+/**
+ * The payload used by the slab allocator, with one cache per 64-byte size step up to 2 KiB.
+ */
+typedef struct PNSLR_SlabAllocatorPayload
+{
+    PNSLR_Allocator backingAllocator;
+    PNSLR_SlabAllocatorCache caches[32];
+    PNSLR_Mutex largeSlabsMutex;
+    PNSLR_SlabAllocatorSlab* largeSlabs;
+    i64 numLargeSlabs;
+    i32 maxEmptySlabsPerCache;
+} PNSLR_SlabAllocatorPayload;
+
+/**
+ * Usage statistics for a slab allocator.
+ */
+typedef struct PNSLR_SlabAllocatorStats
+{
+    i64 numObjectsUsed;
+    i64 numSlabs;
+    i64 numEmptySlabs;
+    i64 numLargeSlabs;
+    i64 reservedBytes;
+} PNSLR_SlabAllocatorStats;
+
+/**
+ * Create a thread-safe slab allocator, meant for small, frequently allocated structs.
+ * Objects up to 2 KiB are served from 64 KiB slabs, one cache per 64-byte size step, and are
+ * always aligned to (and padded out to) the cache line, so neighbouring objects handed out to
+ * different threads never share one. Each cache keeps up to 'maxEmptySlabsPerCache' completely
+ * empty slabs around for reuse before handing any back to the backing allocator.
+ * The backing allocator must honour 64 KiB alignment.
+ */
+PNSLR_Allocator PNSLR_NewAllocator_Slab(
+    PNSLR_Allocator backingAllocator,
+    i32 maxEmptySlabsPerCache,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+/**
+ * Destroy a slab allocator and free all its resources.
+ * This does not free the backing allocator, only the slab allocator's own resources.
+ */
+void PNSLR_DestroyAllocator_Slab(
+    PNSLR_Allocator allocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+/**
+ * Main allocator function for the slab allocator.
  */
-rawptr PNSLR_AllocatorFn_Arena(
+rawptr PNSLR_AllocatorFn_Slab(
     rawptr allocatorData,
     PNSLR_AllocatorMode mode,
-    i32 size,
+    i64 size,
     i32 alignment,
     rawptr oldMemory,
-    i32 oldSize,
+    i64 oldSize,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError* error
 );
 
-typedef u8 PNSLR_ArenaSnapshotError /* use as value */;
-#define PNSLR_ArenaSnapshotError_None ((PNSLR_ArenaSnapshotError) 0)
-#define PNSLR_ArenaSnapshotError_InvalidData ((PNSLR_ArenaSnapshotError) 1)
-#define PNSLR_ArenaSnapshotError_MemoryBlockNotOwned ((PNSLR_ArenaSnapshotError) 2)
-#define PNSLR_ArenaSnapshotError_OutOfOrderRestoreUsage ((PNSLR_ArenaSnapshotError) 3)
-#define PNSLR_ArenaSnapshotError_DoubleRestoreOrDiscardUsage ((PNSLR_ArenaSnapshotError) 4)
-
 /**
- * A snapshot of the arena allocator, recording its state at a specific point in time.
- * Can be saved/loaded/discarded as needed.
+ * Hand every completely empty slab of a slab allocator back to its backing allocator.
  */
-typedef struct PNSLR_ArenaAllocatorSnapshot
-{
-    b8 valid;
-    PNSLR_ArenaAllocatorPayload* payload;
-    PNSLR_ArenaAllocatorBlock* block;
-    u32 used;
-} PNSLR_ArenaAllocatorSnapshot;
+void PNSLR_TrimSlabAllocator(
+    PNSLR_Allocator allocator,
+    PNSLR_SourceCodeLocation location
+);
 
 /**
- * Ensures that the arena allocator has either restored/discarded all the
- * snapshots that were taken.
+ * Get the current usage statistics of a slab allocator.
+ * Returns zeroed stats if the allocator is not a slab allocator.
  */
-b8 PNSLR_ValidateArenaAllocatorSnapshotState(
+PNSLR_SlabAllocatorStats PNSLR_GetSlabAllocatorStats(
     PNSLR_Allocator allocator
 );
 
+// Buddy Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
 /**
- * Captures a snapshot of the arena allocator.
- * The returned value can be used to load back the existing state at this point.
+ * The header written into every free block of the buddy allocator,
+ * linking it into the free list for its order.
  */
-PNSLR_ArenaAllocatorSnapshot PNSLR_CaptureArenaAllocatorSnapshot(
-    PNSLR_Allocator allocator
-);
+typedef struct PNSLR_BuddyAllocatorFreeBlock
+{
+    struct PNSLR_BuddyAllocatorFreeBlock* previous;
+    struct PNSLR_BuddyAllocatorFreeBlock* next;
+} PNSLR_BuddyAllocatorFreeBlock;
 
 /**
- * Restores the state of the arena allocator from a snapshot.
- * Upon success, the snapshot is marked as invalid.
+ * The payload used by the buddy allocator.
+ * Block 'order' N is 'minBlockSize << N' bytes; the whole region is a single block of the highest order.
  */
-PNSLR_ArenaSnapshotError PNSLR_RestoreArenaAllocatorSnapshot(
-    PNSLR_ArenaAllocatorSnapshot* snapshot,
-    PNSLR_SourceCodeLocation loc
+typedef struct PNSLR_BuddyAllocatorPayload
+{
+    PNSLR_Allocator backingAllocator;
+    rawptr memory;
+    u8* blockStates;
+    i64* requestedSizes;
+    i64 regionSize;
+    i32 minBlockSize;
+    i32 minBlockShift;
+    i32 numOrders;
+    i32 numAllocations;
+    i32 numFreeBlocks;
+    i64 usedBytes;
+    i64 requestedBytes;
+    PNSLR_BuddyAllocatorFreeBlock* freeLists[32];
+} PNSLR_BuddyAllocatorPayload;
+
+/**
+ * Usage/fragmentation statistics for a buddy allocator.
+ * 'usedBytes - requestedBytes' is the internal fragmentation (rounding up to power-of-two blocks),
+ * and 'freeBytes - largestFreeBlock' is the free memory that can't be handed out in one piece.
+ */
+typedef struct PNSLR_BuddyAllocatorStats
+{
+    i64 totalBytes;
+    i64 usedBytes;
+    i64 requestedBytes;
+    i64 freeBytes;
+    i64 largestFreeBlock;
+    i32 numAllocations;
+    i32 numFreeBlocks;
+} PNSLR_BuddyAllocatorStats;
+
+/**
+ * Create a buddy allocator over a single region of 'regionSize' bytes (rounded up to a power of two)
+ * reserved from the backing allocator up-front. Blocks are never smaller than 'minBlockSize'
+ * (also a power of two), and allocations can't be aligned beyond it.
+ * The buddy allocator will not free the backing allocator, so it is the caller's responsibility to
+ * free the backing allocator when it is no longer needed.
+ */
+PNSLR_Allocator PNSLR_NewAllocator_Buddy(
+    PNSLR_Allocator backingAllocator,
+    i64 regionSize,
+    i32 minBlockSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
 );
 
 /**
- * Discards a snapshot of the arena allocator.
+ * Destroy a buddy allocator and free all its resources.
+ * This does not free the backing allocator, only the buddy allocator's own resources.
  */
-PNSLR_ArenaSnapshotError PNSLR_DiscardArenaAllocatorSnapshot(
-    PNSLR_ArenaAllocatorSnapshot* snapshot
+void PNSLR_DestroyAllocator_Buddy(
+    PNSLR_Allocator allocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
 );
 
-// Stack Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+/**
+ * Main allocator function for the buddy allocator.
+ */
+rawptr PNSLR_AllocatorFn_Buddy(
+    rawptr allocatorData,
+    PNSLR_AllocatorMode mode,
+    i64 size,
+    i32 alignment,
+    rawptr oldMemory,
+    i64 oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
 
 /**
- * A page of a stack allocator.
+ * Get the current usage/fragmentation statistics of a buddy allocator.
+ * Returns zeroed stats if the allocator is not a buddy allocator.
  */
-typedef struct PNSLR_ALIGNAS(8) PNSLR_StackAllocatorPage
-{
-    struct PNSLR_StackAllocatorPage* previousPage;
-    u64 usedBytes;
-    u8 buffer[8192];
-} PNSLR_StackAllocatorPage;
+PNSLR_BuddyAllocatorStats PNSLR_GetBuddyAllocatorStats(
+    PNSLR_Allocator allocator
+);
+
+// Tracking Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
 /**
- * The header used for every separate stack allocation.
- * This is used to store metadata about the allocation and deallocate appropriately.
+ * Allocation statistics for a single call site (file:line) of a tracking allocator.
+ * 'liveBytes' can go negative in a per-thread record if the memory was freed on a
+ * different thread than the one that allocated it; the merged totals are exact.
  */
-typedef struct PNSLR_StackAllocationHeader
+typedef struct PNSLR_TrackingAllocatorCallSite
 {
-    PNSLR_StackAllocatorPage* page;
-    i32 size;
-    i32 alignment;
-    rawptr lastAllocation;
-    rawptr lastAllocationHeader;
-} PNSLR_StackAllocationHeader;
+    PNSLR_SourceCodeLocation location;
+    i64 numAllocations;
+    i64 numFrees;
+    i64 numResizes;
+    i64 totalBytes;
+    i64 liveBytes;
+} PNSLR_TrackingAllocatorCallSite;
+
+PNSLR_DECLARE_ARRAY_SLICE(PNSLR_TrackingAllocatorCallSite);
 
 /**
- * The payload used by the stack allocator.
+ * The per-thread record of a tracking allocator. Only the owning thread ever writes
+ * to it, so recording an allocation doesn't need a lock.
+ * Call sites past the capacity of the table are accumulated into 'overflow'.
  */
-typedef struct PNSLR_StackAllocatorPayload
+typedef struct PNSLR_TrackingAllocatorThreadRecord
+{
+    struct PNSLR_TrackingAllocatorThreadRecord* next;
+    rawptr owner;
+    i64 numAllocations;
+    i64 numFrees;
+    i64 numResizes;
+    i64 totalBytes;
+    i32 numCallSites;
+    PNSLR_TrackingAllocatorCallSite overflow;
+    PNSLR_TrackingAllocatorCallSite callSites[256];
+} PNSLR_TrackingAllocatorThreadRecord;
+
+/**
+ * The payload used by the tracking allocator.
+ * Live/peak bytes are kept up to date atomically, everything else lives in the per-thread records.
+ */
+typedef struct PNSLR_TrackingAllocatorPayload
 {
     PNSLR_Allocator backingAllocator;
-    PNSLR_StackAllocatorPage* currentPage;
-    rawptr lastAllocation;
-    PNSLR_StackAllocationHeader* lastAllocationHeader;
-} PNSLR_StackAllocatorPayload;
+    PNSLR_Mutex recordsMutex;
+    PNSLR_TrackingAllocatorThreadRecord* records;
+    i64 id;
+    i64 liveBytes;
+    i64 peakBytes;
+} PNSLR_TrackingAllocatorPayload;
 
 /**
- * Create a stack allocator with the specified backing allocator.
- * The stack allocator will use the backing allocator to allocate its pages.
- * The stack allocator will not free the backing allocator, so it is the caller's responsibility to
- * free the backing allocator when it is no longer needed.
+ * Overall statistics of a tracking allocator, merged across all threads.
  */
-PNSLR_Allocator PNSLR_NewAllocator_Stack(
+typedef struct PNSLR_TrackingAllocatorStats
+{
+    i64 liveBytes;
+    i64 peakBytes;
+    i64 liveAllocations;
+    i64 numAllocations;
+    i64 numFrees;
+    i64 numResizes;
+    i64 totalBytes;
+    i32 numThreads;
+} PNSLR_TrackingAllocatorStats;
+
+/**
+ * Create a tracking allocator that forwards to 'backingAllocator', recording live/peak
+ * bytes, allocation counts and per call site histograms from the source code locations
+ * passed to every allocator call.
+ * Every allocation carries a small header, so memory must be freed through the tracking
+ * allocator, and resizes only stay in-place if the backing allocator supports it.
+ */
+PNSLR_Allocator PNSLR_NewAllocator_Tracking(
     PNSLR_Allocator backingAllocator,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError* error
 );
 
 /**
- * Destroy a stack allocator and free all its resources.
- * This does not free the backing allocator, only the stack allocator's own resources.
+ * Destroy a tracking allocator and its records.
+ * This does not free any allocations still live in the backing allocator.
  */
-void PNSLR_DestroyAllocator_Stack(
+void PNSLR_DestroyAllocator_Tracking(
     PNSLR_Allocator allocator,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError* error
 );
 
 /**
- * Main allocator function for the stack allocator.
+ * Main allocator function for the tracking allocator.
  */
-rawptr PNSLR_AllocatorFn_Stack(
+rawptr PNSLR_AllocatorFn_Tracking(
     rawptr allocatorData,
     PNSLR_AllocatorMode mode,
-    i32 size,
+    i64 size,
     i32 alignment,
     rawptr oldMemory,
-    i32 oldSize,
+    i64 oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error
+);
+
+/**
+ * Get the current statistics of a tracking allocator.
+ * Returns zeroed stats if the allocator is not a tracking allocator.
+ */
+PNSLR_TrackingAllocatorStats PNSLR_GetTrackingAllocatorStats(
+    PNSLR_Allocator allocator
+);
+
+/**
+ * Get the call sites recorded by a tracking allocator, merged across threads and
+ * sorted by live bytes (then total bytes), largest first.
+ * The slice is allocated from 'outputAllocator'.
+ */
+PNSLR_ArraySlice(PNSLR_TrackingAllocatorCallSite) PNSLR_GetTrackingAllocatorCallSites(
+    PNSLR_Allocator allocator,
+    PNSLR_Allocator outputAllocator,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError* error
 );
 
+/**
+ * Reset the peak bytes of a tracking allocator to its current live bytes.
+ * Useful for measuring the peak within a single frame.
+ */
+void PNSLR_ResetTrackingAllocatorPeak(
+    PNSLR_Allocator allocator
+);
+
+// Internal Allocators ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * Usage statistics of one of the library's internal scratch arenas (strings, paths, etc.).
+ * Each thread gets a fixed static buffer of 'staticCapacity' bytes, and overflows into
+ * blocks from the default heap once that runs out; those are released again as soon as
+ * the operation that needed them is done. Counters are summed across threads.
+ */
+typedef struct PNSLR_InternalAllocatorStats
+{
+    utf8str name;
+    i64 staticCapacity;
+    i64 numOverflows;
+    i64 overflowBytes;
+    i64 peakOverflowBytes;
+} PNSLR_InternalAllocatorStats;
+
+PNSLR_DECLARE_ARRAY_SLICE(PNSLR_InternalAllocatorStats);
+
+/**
+ * Fill 'output' with the statistics of the internal arenas used so far (by any thread),
+ * and return how many there are; which may be more than 'output' could hold.
+ */
+i32 PNSLR_GetInternalAllocatorStats(
+    PNSLR_ArraySlice(PNSLR_InternalAllocatorStats) output
+);
+
+/**
+ * Reset the peak overflow bytes of all internal arenas to their current overflow bytes.
+ */
+void PNSLR_ResetInternalAllocatorPeaks(void);
+
 // Collections make/free functions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
 /**
@@ -1101,6 +1941,194 @@ utf8str PNSLR_ReplaceInString(
     PNSLR_StringComparisonType comparisonType
 );
 
+// Hashing ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * Hashes the bytes of a string to 64 bits (wyhash, final version 4).
+ * Not suitable for anything cryptographic. The result is the same on every platform,
+ * so it's fine to store it.
+ */
+u64 PNSLR_HashString(
+    utf8str str,
+    u64 seed
+);
+
+/**
+ * Returns a view of the string without any leading ASCII whitespace.
+ */
+utf8str PNSLR_TrimStringFromStart(
+    utf8str str
+);
+
+/**
+ * Returns a view of the string without any trailing ASCII whitespace.
+ */
+utf8str PNSLR_TrimStringFromEnd(
+    utf8str str
+);
+
+/**
+ * Returns a view of the string without any leading or trailing ASCII whitespace.
+ */
+utf8str PNSLR_TrimString(
+    utf8str str
+);
+
+/**
+ * What a split iterator splits on.
+ */
+typedef u8 PNSLR_StringSplitType /* use as value */;
+#define PNSLR_StringSplitType_Byte ((PNSLR_StringSplitType) 0)
+#define PNSLR_StringSplitType_String ((PNSLR_StringSplitType) 1)
+#define PNSLR_StringSplitType_AnyOf ((PNSLR_StringSplitType) 2)
+#define PNSLR_StringSplitType_Lines ((PNSLR_StringSplitType) 3)
+#define PNSLR_StringSplitType_Whitespace ((PNSLR_StringSplitType) 4)
+
+/**
+ * Splits a string into parts without allocating; every part is a view into the
+ * original string. Create with one of the `PNSLR_SplitStringBy*` functions, then
+ * take parts from either end with `PNSLR_NextSplitFromStart`/`PNSLR_NextSplitFromEnd`.
+ */
+typedef struct PNSLR_StringSplitIterator
+{
+    utf8str remaining;
+    utf8str separator;
+    u8 separatorByte;
+    PNSLR_StringSplitType type;
+    PNSLR_StringComparisonType comparisonType;
+    b8 finished;
+} PNSLR_StringSplitIterator;
+
+/**
+ * Split on every occurrence of a byte. Empty parts are kept, so "a,,b" gives
+ * "a", "" and "b".
+ */
+PNSLR_StringSplitIterator PNSLR_SplitStringByByte(
+    utf8str str,
+    u8 separator
+);
+
+/**
+ * Split on every occurrence of a string. Empty parts are kept. An empty
+ * separator never matches.
+ */
+PNSLR_StringSplitIterator PNSLR_SplitStringByString(
+    utf8str str,
+    utf8str separator,
+    PNSLR_StringComparisonType comparisonType
+);
+
+/**
+ * Split on every occurrence of any of the bytes in 'separators'. Empty parts are kept.
+ */
+PNSLR_StringSplitIterator PNSLR_SplitStringByAnyOf(
+    utf8str str,
+    utf8str separators
+);
+
+/**
+ * Split into lines, on "\n" or "\r\n". A newline at the very end does not start
+ * another (empty) line.
+ */
+PNSLR_StringSplitIterator PNSLR_SplitStringByLines(
+    utf8str str
+);
+
+/**
+ * Split on runs of ASCII whitespace. Empty parts are skipped, so only the words
+ * come out.
+ */
+PNSLR_StringSplitIterator PNSLR_SplitStringByWhitespace(
+    utf8str str
+);
+
+/**
+ * Takes the next part from the start of what's left.
+ * Returns false once there are no more parts.
+ */
+b8 PNSLR_NextSplitFromStart(
+    PNSLR_StringSplitIterator* iterator,
+    utf8str* part
+);
+
+/**
+ * Takes the next part from the end of what's left.
+ * Returns false once there are no more parts.
+ */
+b8 PNSLR_NextSplitFromEnd(
+    PNSLR_StringSplitIterator* iterator,
+    utf8str* part
+);
+
+// Tokenizer ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * The kinds of tokens the tokenizer produces.
+ */
+typedef u8 PNSLR_TokenType /* use as value */;
+#define PNSLR_TokenType_EndOfInput ((PNSLR_TokenType) 0)
+#define PNSLR_TokenType_Identifier ((PNSLR_TokenType) 1)
+#define PNSLR_TokenType_Number ((PNSLR_TokenType) 2)
+#define PNSLR_TokenType_String ((PNSLR_TokenType) 3)
+#define PNSLR_TokenType_Symbol ((PNSLR_TokenType) 4)
+#define PNSLR_TokenType_Invalid ((PNSLR_TokenType) 5)
+
+/**
+ * A single token.
+ * Identifiers are letters, digits, underscores and non-ASCII bytes, not starting
+ * with a digit.
+ * Numbers start with a digit (or a '.' followed by one) and are left for the
+ * number parsers to validate; a leading sign is a separate symbol.
+ * Strings are quoted with '"' or '\'', can contain backslash escapes, and have
+ * to end on the line they start on (otherwise they're invalid). Their text keeps
+ * the quotes.
+ * Symbols are any other single byte.
+ */
+typedef struct PNSLR_Token
+{
+    PNSLR_TokenType type;
+    utf8str text;
+    i32 line;
+    i32 column;
+} PNSLR_Token;
+
+/**
+ * Splits source text into tokens, without allocating.
+ * Create with `PNSLR_MakeTokenizer`; can be copied to save/restore its position.
+ */
+typedef struct PNSLR_Tokenizer
+{
+    utf8str source;
+    i64 position;
+    i32 line;
+    i64 lineStart;
+    utf8str lineCommentStart;
+} PNSLR_Tokenizer;
+
+/**
+ * Creates a tokenizer over the source text. Anything from 'lineCommentStart' to
+ * the end of its line is skipped, like whitespace.
+ */
+PNSLR_Tokenizer PNSLR_MakeTokenizer(
+    utf8str source,
+    utf8str lineCommentStart
+);
+
+/**
+ * Returns the next token and moves past it. At the end of the source, returns
+ * `PNSLR_TokenType_EndOfInput` tokens.
+ */
+PNSLR_Token PNSLR_NextToken(
+    PNSLR_Tokenizer* tokenizer
+);
+
+/**
+ * Returns the next token without moving past it.
+ */
+PNSLR_Token PNSLR_PeekToken(
+    PNSLR_Tokenizer* tokenizer
+);
+
 // UTF-8 functionalities ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
 /**
@@ -1139,11 +2167,68 @@ PNSLR_EncodedRune PNSLR_EncodeRune(
 );
 
 /**
- * Decodes a UTF-8 byte sequence into a rune and returns the structure containing the rune/length.
- * Returns error rune (U+FFFD) for invalid sequences.
+ * Decodes a UTF-8 byte sequence into a rune and returns the structure containing the rune/length.
+ * Returns error rune (U+FFFD) for invalid sequences.
+ */
+PNSLR_DecodedRune PNSLR_DecodeRune(
+    PNSLR_ArraySlice(u8) s
+);
+
+/**
+ * Checks whether a string is entirely well-formed UTF-8, i.e. without overlong encodings,
+ * surrogates, runes past U+10FFFF or truncated sequences. Runs of ASCII are skipped in bulk.
+ */
+b8 PNSLR_ValidateUTF8(
+    utf8str str
+);
+
+/**
+ * Counts the runes in a UTF-8 string; as many as decoding it rune by rune would produce,
+ * with every byte of an invalid sequence counting as one error rune (U+FFFD).
+ */
+i64 PNSLR_CountRunesInString(
+    utf8str str
+);
+
+// UTF-16 conversions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * Returns the number of UTF-16 code units needed to hold a UTF-8 string. Invalid
+ * sequences count as one error rune (U+FFFD) per byte, as with `PNSLR_DecodeRune`.
+ */
+i64 PNSLR_GetUTF16LengthOfUTF8(
+    utf8str str
+);
+
+/**
+ * Returns the number of bytes needed to hold a UTF-16 string as UTF-8.
+ * Unpaired surrogates count as the error rune (U+FFFD).
+ */
+i64 PNSLR_GetUTF8LengthOfUTF16(
+    PNSLR_ArraySlice(u16) str
+);
+
+/**
+ * Converts a UTF-8 string to a UTF-16 string, on every platform.
+ * The output is measured first, then written in one go into a slice allocated
+ * using the specified allocator. Invalid sequences are replaced with U+FFFD.
+ *
+ * Warning! - The output string will contain a null terminator and the slice count
+ * will not include that null terminator.
+ */
+PNSLR_ArraySlice(u16) PNSLR_UTF16FromUTF8(
+    utf8str str,
+    PNSLR_Allocator allocator
+);
+
+/**
+ * Converts a UTF-16 string to a UTF-8 string, on every platform.
+ * The output is measured first, then written in one go into a string allocated
+ * using the specified allocator. Unpaired surrogates are replaced with U+FFFD.
  */
-PNSLR_DecodedRune PNSLR_DecodeRune(
-    PNSLR_ArraySlice(u8) s
+utf8str PNSLR_UTF8FromUTF16(
+    PNSLR_ArraySlice(u16) str,
+    PNSLR_Allocator allocator
 );
 
 // Windows-specific bs for UTF-16 conversions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -1151,7 +2236,8 @@ PNSLR_DecodedRune PNSLR_DecodeRune(
 /**
  * Converts a UTF-8 string to a UTF-16 string.
  * The returned string is allocated using the specified allocator.
- * Only available on Windows. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+ * Meant for Windows APIs. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+ * Elsewhere, this falls back to `PNSLR_UTF16FromUTF8`.
  *
  * Warning! - The output string will contain a null terminator and the slice count
  * will not include that null terminator.
@@ -1164,7 +2250,8 @@ PNSLR_ArraySlice(u16) PNSLR_UTF16FromUTF8WindowsOnly(
 /**
  * Converts a UTF-16 string to a UTF-8 string.
  * The returned string is allocated using the specified allocator.
- * Only available on Windows. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+ * Meant for Windows APIs. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+ * Elsewhere, this falls back to `PNSLR_UTF8FromUTF16`.
  *
  * Warning! - All the trailing null terminator characters will be ignored.
  */
@@ -1240,6 +2327,8 @@ b8 PNSLR_AppendB8ToStringBuilder(
 
 /**
  * Append a 32-bit floating-point number to the string builder.
+ * A negative `decimalPlaces` writes the shortest form that parses back to the same f32
+ * (scientific notation below 1e-6 and from 1e21 up).
  */
 b8 PNSLR_AppendF32ToStringBuilder(
     PNSLR_StringBuilder* builder,
@@ -1249,6 +2338,9 @@ b8 PNSLR_AppendF32ToStringBuilder(
 
 /**
  * Append a 64-bit floating point number to the string builder.
+ * A negative `decimalPlaces` writes the shortest form that parses back to the same f64
+ * (scientific notation below 1e-6 and from 1e21 up). Infinities, and magnitudes from
+ * 2^64 up, are always written that way.
  */
 b8 PNSLR_AppendF64ToStringBuilder(
     PNSLR_StringBuilder* builder,
@@ -1383,7 +2475,7 @@ typedef u8 PNSLR_PrimitiveFmtType /* use as value */;
  * The internal encoding of a type-unspecific format specifier.
  * For booleans, valueBufferA is 0 or 1.
  * For floats, valueBufferA is the float value (reinterpret as relevant),
- *     and valueBufferB is the number of decimal places (cast to i32).
+ *     and valueBufferB is the number of decimal places (cast to i32, negative for shortest).
  * For integers, valueBufferA is the integer value (reinterpret as relevant),
  *     and the first half of valueBufferB is the base (cast to PNSLR_IntegerBase).
  * For runes, valueBufferA is the rune value (reinterpret as u32).
@@ -1409,6 +2501,7 @@ PNSLR_PrimitiveFmtOptions PNSLR_FmtB8(
 
 /**
  * Use when formatting a string. Pass as one of the varargs.
+ * Pass a negative `decimalPlaces` for the shortest round-trip form.
  */
 PNSLR_PrimitiveFmtOptions PNSLR_FmtF32(
     f32 value,
@@ -1417,6 +2510,7 @@ PNSLR_PrimitiveFmtOptions PNSLR_FmtF32(
 
 /**
  * Use when formatting a string. Pass as one of the varargs.
+ * Pass a negative `decimalPlaces` for the shortest round-trip form.
  */
 PNSLR_PrimitiveFmtOptions PNSLR_FmtF64(
     f64 value,
@@ -1564,6 +2658,7 @@ utf8str PNSLR_StringFromBoolean(
 
 /**
  * Convert a 32-bit floating-point number to a string with specified decimal places.
+ * Negative decimal places give the shortest string that round-trips.
  */
 utf8str PNSLR_StringFromF32(
     f32 value,
@@ -1573,6 +2668,7 @@ utf8str PNSLR_StringFromF32(
 
 /**
  * Convert a 64-bit floating-point number to a string with specified decimal places.
+ * Negative decimal places give the shortest string that round-trips.
  */
 utf8str PNSLR_StringFromF64(
     f64 value,
@@ -1664,7 +2760,9 @@ b8 PNSLR_BooleanFromString(
 
 /**
  * Convert a valid string (numbers-only, with zero or one decimal points,
- * optional -/+ sign at the start) to a 32-bit floating-point number.
+ * optional -/+ sign at the start, optional e/E exponent at the end) to a
+ * 32-bit floating-point number, rounded to the nearest one. Also accepts
+ * "inf", "infinity" and "nan" (case-insensitive, optionally signed).
  */
 b8 PNSLR_F32FromString(
     utf8str str,
@@ -1673,7 +2771,9 @@ b8 PNSLR_F32FromString(
 
 /**
  * Convert a valid string (numbers-only, with zero or one decimal points,
- * optional -/+ sign at the start) to a 64-bit floating-point number.
+ * optional -/+ sign at the start, optional e/E exponent at the end) to a
+ * 64-bit floating-point number, rounded to the nearest one. Also accepts
+ * "inf", "infinity" and "nan" (case-insensitive, optionally signed).
  */
 b8 PNSLR_F64FromString(
     utf8str str,
@@ -1768,6 +2868,52 @@ b8 PNSLR_I64FromString(
     i64* value
 );
 
+/**
+ * Parse a list of numbers separated by `delimiter` (e.g. a CSV row) into `output`,
+ * each one as per PNSLR_F32FromString, ignoring whitespace around them. `count` is
+ * set to the number of values written. Fails on an invalid number, or when there
+ * are more numbers than `output` can hold.
+ */
+b8 PNSLR_F32ArrayFromString(
+    utf8str str,
+    u8 delimiter,
+    PNSLR_ArraySlice(f32) output,
+    i64* count
+);
+
+/**
+ * Parse a list of numbers separated by `delimiter` into `output`, each one as per
+ * PNSLR_F64FromString. See PNSLR_F32ArrayFromString for details.
+ */
+b8 PNSLR_F64ArrayFromString(
+    utf8str str,
+    u8 delimiter,
+    PNSLR_ArraySlice(f64) output,
+    i64* count
+);
+
+/**
+ * Parse a list of numbers separated by `delimiter` into `output`, each one as per
+ * PNSLR_U64FromString. See PNSLR_F32ArrayFromString for details.
+ */
+b8 PNSLR_U64ArrayFromString(
+    utf8str str,
+    u8 delimiter,
+    PNSLR_ArraySlice(u64) output,
+    i64* count
+);
+
+/**
+ * Parse a list of numbers separated by `delimiter` into `output`, each one as per
+ * PNSLR_I64FromString. See PNSLR_F32ArrayFromString for details.
+ */
+b8 PNSLR_I64ArrayFromString(
+    utf8str str,
+    u8 delimiter,
+    PNSLR_ArraySlice(i64) output,
+    i64* count
+);
+
 // #######################################################################################
 // IO
 // #######################################################################################
@@ -1850,6 +2996,48 @@ void PNSLR_IterateDirectory(
     PNSLR_DirectoryIterationVisitorDelegate visitorFunc
 );
 
+/**
+ * Represents something found while walking a directory tree.
+ * Symbolic links are never followed, and are reported as files.
+ */
+typedef struct PNSLR_DirectoryWalkEntry
+{
+    PNSLR_Path path;
+    utf8str name;
+    b8 isDirectory;
+    i32 depth;
+    i64 size;
+    i64 timestamp;
+} PNSLR_DirectoryWalkEntry;
+
+/**
+ * The signature of the delegate that's called for everything found while walking a directory tree.
+ * Return false to stop the whole walk. Set `exploreCurrentDirectory` to false to skip going into a directory.
+ */
+typedef b8 (*PNSLR_DirectoryWalkVisitorDelegate)(
+    rawptr payload,
+    PNSLR_DirectoryWalkEntry entry,
+    b8* exploreCurrentDirectory
+);
+
+/**
+ * Walks through a whole directory tree, calling the visitor for everything in it.
+ * A faster alternative to recursive `PNSLR_IterateDirectory` for big trees: it opens each directory
+ * relative to its parent, only asks the filesystem about an entry when the directory listing doesn't
+ * already say what it is, and never allocates per entry.
+ * Sizes and timestamps cost an extra query per entry, so they're only filled in if asked for.
+ * With more than one worker thread (the calling thread being one of them), subdirectories are spread
+ * across them, and the visitor is called from all of them at once, in no particular order.
+ * Returns true if the walk went through to the end, false if it couldn't start or was stopped.
+ */
+b8 PNSLR_WalkDirectoryTree(
+    PNSLR_Path path,
+    rawptr visitorPayload,
+    PNSLR_DirectoryWalkVisitorDelegate visitorFunc,
+    b8 querySizeAndTimestamp,
+    i32 numWorkerThreads
+);
+
 /**
  * Represents the type of path check to perform when checking if a path exists.
  */
@@ -1952,8 +3140,9 @@ b8 PNSLR_SeekPositionInFile(
 
 /**
  * Reads data from an opened file at the current position.
+ * Keeps reading until the buffer is full, and is only short at the end of the file.
  * Optionally stores the number of bytes read.
- * Returns true on success, false on failure.
+ * Returns true if the whole buffer was filled, false otherwise.
  */
 b8 PNSLR_ReadFromFile(
     PNSLR_File handle,
@@ -1963,6 +3152,7 @@ b8 PNSLR_ReadFromFile(
 
 /**
  * Writes data to an opened file at the current position.
+ * Keeps writing until all of it is written.
  * Returns true on success, false on failure.
  */
 b8 PNSLR_WriteToFile(
@@ -1970,6 +3160,54 @@ b8 PNSLR_WriteToFile(
     PNSLR_ArraySlice(u8) src
 );
 
+/**
+ * Reads data from an opened file at the given offset, without going through the current position,
+ * so multiple threads can read from the same file at once.
+ * Keeps reading until the buffer is full, and is only short at the end of the file.
+ * Optionally stores the number of bytes read.
+ * Returns true if the whole buffer was filled, false otherwise.
+ */
+b8 PNSLR_ReadFromFileAt(
+    PNSLR_File handle,
+    i64 offset,
+    PNSLR_ArraySlice(u8) dst,
+    i64* readSize
+);
+
+/**
+ * Writes data to an opened file at the given offset, without going through the current position.
+ * Keeps writing until all of it is written.
+ * Returns true on success, false on failure.
+ */
+b8 PNSLR_WriteToFileAt(
+    PNSLR_File handle,
+    i64 offset,
+    PNSLR_ArraySlice(u8) src
+);
+
+/**
+ * Reads consecutive data from an opened file at the given offset into multiple buffers
+ * (each one filled before moving onto the next), in as few calls to the OS as possible.
+ * Works the same way as `PNSLR_ReadFromFileAt` otherwise.
+ */
+b8 PNSLR_ScatterReadFromFileAt(
+    PNSLR_File handle,
+    i64 offset,
+    PNSLR_ArraySlice(utf8str) dsts,
+    i64* readSize
+);
+
+/**
+ * Writes multiple buffers one after the other to an opened file at the given offset,
+ * in as few calls to the OS as possible.
+ * Works the same way as `PNSLR_WriteToFileAt` otherwise.
+ */
+b8 PNSLR_GatherWriteToFileAt(
+    PNSLR_File handle,
+    i64 offset,
+    PNSLR_ArraySlice(utf8str) srcs
+);
+
 /**
  * Formats a string with the given format and arguments, writing the
  * result to the file.
@@ -2028,6 +3266,9 @@ b8 PNSLR_WriteAllContentsToFile(
 
 /**
  * Copies a file from src to dst. If dst exists, it will be overwritten.
+ * Where possible, the data never goes through userspace: on linux this tries a reflink
+ * (so the copy shares its blocks with the original), then copy_file_range, then sendfile,
+ * before falling back to copying through a buffer.
  * Returns true on success, false on failure.
  */
 b8 PNSLR_CopyFile(
@@ -2035,6 +3276,19 @@ b8 PNSLR_CopyFile(
     PNSLR_Path dst
 );
 
+/**
+ * Copies everything inside the src directory into the dst directory (which is created if it
+ * doesn't exist), overwriting any files that are already there.
+ * The files are copied by 'numWorkerThreads' threads at once (defaults to 4), one of which is
+ * the calling thread; this returns once all of them are done.
+ * Returns true if everything was copied, false otherwise.
+ */
+b8 PNSLR_CopyDirectoryTree(
+    PNSLR_Path src,
+    PNSLR_Path dst,
+    i32 numWorkerThreads
+);
+
 /**
  * Moves a file from src to dst. If dst exists, it will be overwritten.
  * Returns true on success, false on failure.
@@ -2044,6 +3298,70 @@ b8 PNSLR_MoveFile(
     PNSLR_Path dst
 );
 
+/**
+ * Represents how a memory-mapped file can be accessed.
+ * Copy-on-write mappings can be written to, but the changes are never written back to the file.
+ * Read-write mappings need a file that was opened for both reading and writing.
+ */
+typedef u8 PNSLR_FileMappingAccess /* use as value */;
+#define PNSLR_FileMappingAccess_ReadOnly ((PNSLR_FileMappingAccess) 0)
+#define PNSLR_FileMappingAccess_CopyOnWrite ((PNSLR_FileMappingAccess) 1)
+#define PNSLR_FileMappingAccess_ReadWrite ((PNSLR_FileMappingAccess) 2)
+
+/**
+ * Represents how a range of a memory-mapped file is going to be used, so the OS can
+ * read ahead (or not) accordingly.
+ */
+typedef u8 PNSLR_FileMappingHint /* use as value */;
+#define PNSLR_FileMappingHint_Normal ((PNSLR_FileMappingHint) 0)
+#define PNSLR_FileMappingHint_Sequential ((PNSLR_FileMappingHint) 1)
+#define PNSLR_FileMappingHint_Random ((PNSLR_FileMappingHint) 2)
+#define PNSLR_FileMappingHint_WillNeed ((PNSLR_FileMappingHint) 3)
+#define PNSLR_FileMappingHint_DontNeed ((PNSLR_FileMappingHint) 4)
+
+/**
+ * Maps 'size' bytes of an opened file, starting at 'offset', into memory; if size is 0,
+ * everything from the offset to the end of the file is mapped. The range has to be within the file,
+ * but the offset doesn't need to be aligned to anything.
+ * The file handle can be closed while the mapping is still in use.
+ * Returns an empty slice on failure.
+ */
+PNSLR_ArraySlice(u8) PNSLR_MapFile(
+    PNSLR_File handle,
+    PNSLR_FileMappingAccess access,
+    i64 offset,
+    i64 size
+);
+
+/**
+ * Tells the OS how a range of a memory-mapped file is going to be used.
+ * The range can be any part of a mapping returned by `PNSLR_MapFile`.
+ * Returns true on success, false on failure.
+ */
+b8 PNSLR_AdviseFileMapping(
+    PNSLR_ArraySlice(u8) range,
+    PNSLR_FileMappingHint hint
+);
+
+/**
+ * Writes any changes in a range of a read-write memory-mapped file back to the file.
+ * The range can be any part of a mapping returned by `PNSLR_MapFile`.
+ * On Unix this waits for the data to reach the disk. On Windows it only starts the write-back,
+ * since the mapping doesn't keep the file handle around; use `PNSLR_FlushFile` on an open handle
+ * to the same file when the data has to be on disk.
+ * Returns true on success, false on failure.
+ */
+b8 PNSLR_FlushFileMapping(
+    PNSLR_ArraySlice(u8) range
+);
+
+/**
+ * Unmaps a memory-mapped file. Has to be given exactly what `PNSLR_MapFile` returned.
+ */
+void PNSLR_UnmapFile(
+    PNSLR_ArraySlice(u8) mapping
+);
+
 // #######################################################################################
 // DynaLib
 // #######################################################################################
@@ -2402,6 +3720,49 @@ void PNSLR_CloseStream(
     PNSLR_Stream stream
 );
 
+// Compiled formats ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * A format string that has been split up ahead of time, for formats that get used
+ * over and over (log lines, etc.). The same rules as `PNSLR_FormatAndWriteToStream`
+ * apply. Create with `PNSLR_CompileFormat`, free with `PNSLR_FreeCompiledFormat`.
+ */
+typedef struct PNSLR_CompiledFormat
+{
+    PNSLR_ArraySlice(utf8str) literals;
+    i64 literalsLength;
+    PNSLR_Allocator allocator;
+} PNSLR_CompiledFormat;
+
+/**
+ * Splits a format string into the literal runs between its placeholders.
+ * The compiled format does not refer back to 'fmtStr'.
+ * Returns a zeroed compiled format on failure.
+ */
+PNSLR_CompiledFormat PNSLR_CompileFormat(
+    utf8str fmtStr,
+    PNSLR_Allocator allocator
+);
+
+/**
+ * Frees a compiled format, and zeroes it.
+ */
+void PNSLR_FreeCompiledFormat(
+    PNSLR_CompiledFormat* format
+);
+
+/**
+ * Formats with a compiled format and writes the result to the stream, in a single
+ * write. The space needed is worked out up front, so nothing gets resized midway.
+ * A string builder stream is formatted into directly.
+ * Returns true on success, false on failure.
+ */
+b8 PNSLR_FormatCompiledAndWriteToStream(
+    PNSLR_Stream stream,
+    PNSLR_CompiledFormat* format,
+    PNSLR_ArraySlice(PNSLR_PrimitiveFmtOptions) args
+);
+
 // Stream casts ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
 /**
@@ -2418,6 +3779,25 @@ PNSLR_Stream PNSLR_StreamFromStringBuilder(
     PNSLR_StringBuilder* builder
 );
 
+/**
+ * The state of a stream over a memory-mapped file; 'access' has to match what the
+ * mapping was created with. See `PNSLR_StreamFromFileMapping`.
+ */
+typedef struct PNSLR_FileMappingStream
+{
+    PNSLR_ArraySlice(u8) mapping;
+    PNSLR_FileMappingAccess access;
+    i64 cursorPos;
+} PNSLR_FileMappingStream;
+
+/**
+ * Creates a stream over a memory-mapped file. Reads and writes go straight to the
+ * mapped memory, and can't go past its end. Closing the stream unmaps the file.
+ */
+PNSLR_Stream PNSLR_StreamFromFileMapping(
+    PNSLR_FileMappingStream* mappingStream
+);
+
 /**
  * Creates a stream from the standard output pipe.
  */
@@ -2432,6 +3812,22 @@ PNSLR_Stream PNSLR_StreamFromStdErr(
     b8 disableBuffering
 );
 
+// Allocator reports ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * Writes a report of a tracking allocator to the stream: the overall stats, then one
+ * line per call site (file:line), largest live bytes first.
+ * At most 'maxCallSites' call sites are written, or all of them if it's zero or less.
+ * 'tempAllocator' is used to merge the call sites across threads.
+ * Returns true on success, false on failure.
+ */
+b8 PNSLR_WriteTrackingAllocatorReportToStream(
+    PNSLR_Stream stream,
+    PNSLR_Allocator trackingAllocator,
+    PNSLR_Allocator tempAllocator,
+    i32 maxCallSites
+);
+
 // #######################################################################################
 // Logger
 // #######################################################################################
@@ -2947,6 +4343,242 @@ b8 PNSLR_DisconnectSharedMemoryChannelWriter(
     PNSLR_SharedMemoryChannelWriter* writer
 );
 
+// #######################################################################################
+// StringInterner
+// #######################################################################################
+
+// String Interner ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * A table of unique strings, each one given a small handle that never changes.
+ * Two interned strings are equal exactly when their handles are, so comparing or
+ * hashing them afterwards is a single integer operation.
+ * Interning and lookups are safe to do from multiple threads at once.
+ * The handle 0 never refers to a string.
+ */
+typedef struct PNSLR_StringInterner
+{
+    rawptr data;
+} PNSLR_StringInterner;
+
+/**
+ * Creates an empty string interner. All of its memory, including the copies of the
+ * interned strings, comes from the provided allocator, which has to be thread-safe
+ * if strings are going to be interned from more than one thread.
+ */
+PNSLR_StringInterner PNSLR_CreateStringInterner(
+    PNSLR_Allocator allocator
+);
+
+/**
+ * Destroys a string interner. Every string obtained from it is invalid afterwards.
+ */
+void PNSLR_DestroyStringInterner(
+    PNSLR_StringInterner* interner
+);
+
+/**
+ * Returns the handle for a string, copying it into the interner if it wasn't there already.
+ * Returns 0 if the string could not be added.
+ */
+u32 PNSLR_InternString(
+    PNSLR_StringInterner interner,
+    utf8str str
+);
+
+/**
+ * Returns the handle for a string if it has already been interned, or 0 if it hasn't.
+ * Never adds anything to the interner.
+ */
+u32 PNSLR_FindInternedString(
+    PNSLR_StringInterner interner,
+    utf8str str
+);
+
+/**
+ * Returns the string for a handle, or an empty string if the handle is not valid.
+ * The returned string is null-terminated, and lives as long as the interner does.
+ */
+utf8str PNSLR_GetInternedString(
+    PNSLR_StringInterner interner,
+    u32 handle
+);
+
+/**
+ * Returns the number of strings in the interner.
+ */
+i64 PNSLR_GetInternedStringsCount(
+    PNSLR_StringInterner interner
+);
+
+/**
+ * Writes all the strings in the interner to a file, such that loading it back
+ * gives every string the same handle it has now.
+ */
+b8 PNSLR_SaveStringInternerToFile(
+    PNSLR_StringInterner interner,
+    PNSLR_Path path
+);
+
+/**
+ * Creates a string interner from a file written by `PNSLR_SaveStringInternerToFile`.
+ * Returns an interner with no data if the file could not be read or is not valid.
+ */
+PNSLR_StringInterner PNSLR_LoadStringInternerFromFile(
+    PNSLR_Path path,
+    PNSLR_Allocator allocator
+);
+
+// #######################################################################################
+// AsyncIO
+// #######################################################################################
+
+// Requests and completions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * Represents what an asynchronous I/O request does.
+ */
+typedef u8 PNSLR_AsyncIOOperation /* use as value */;
+#define PNSLR_AsyncIOOperation_Read ((PNSLR_AsyncIOOperation) 0)
+#define PNSLR_AsyncIOOperation_Write ((PNSLR_AsyncIOOperation) 1)
+#define PNSLR_AsyncIOOperation_Flush ((PNSLR_AsyncIOOperation) 2)
+
+/**
+ * A single asynchronous read, write or flush against an opened file.
+ * Reads and writes happen at 'offset', whatever the file's cursor is at.
+ * The buffer (unused for flushes) has to stay valid until the request completes.
+ * Zero-length reads and writes succeed straight away, without touching the file.
+ * 'userData' is handed back unchanged in the request's completion.
+ */
+typedef struct PNSLR_AsyncIORequest
+{
+    PNSLR_File file;
+    PNSLR_AsyncIOOperation operation;
+    i64 offset;
+    PNSLR_ArraySlice(u8) buffer;
+    u64 userData;
+} PNSLR_AsyncIORequest;
+
+PNSLR_DECLARE_ARRAY_SLICE(PNSLR_AsyncIORequest);
+
+/**
+ * Represents how an asynchronous I/O request ended.
+ */
+typedef u8 PNSLR_AsyncIOStatus /* use as value */;
+#define PNSLR_AsyncIOStatus_Succeeded ((PNSLR_AsyncIOStatus) 0)
+#define PNSLR_AsyncIOStatus_Failed ((PNSLR_AsyncIOStatus) 1)
+#define PNSLR_AsyncIOStatus_Cancelled ((PNSLR_AsyncIOStatus) 2)
+
+/**
+ * The result of an asynchronous I/O request.
+ * Reads and writes are carried on until the whole buffer is done, so the
+ * number of bytes transferred is only ever short for a read that hit the end of the file.
+ */
+typedef struct PNSLR_AsyncIOCompletion
+{
+    u64 userData;
+    i64 bytesTransferred;
+    PNSLR_AsyncIOStatus status;
+} PNSLR_AsyncIOCompletion;
+
+PNSLR_DECLARE_ARRAY_SLICE(PNSLR_AsyncIOCompletion);
+
+// Queues ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * Represents what carries out the requests of an asynchronous I/O queue.
+ * The default is io_uring where the kernel supports it, and a pool of worker threads
+ * doing blocking positional reads and writes everywhere else.
+ */
+typedef u8 PNSLR_AsyncIOBackend /* use as value */;
+#define PNSLR_AsyncIOBackend_Default ((PNSLR_AsyncIOBackend) 0)
+#define PNSLR_AsyncIOBackend_ThreadPool ((PNSLR_AsyncIOBackend) 1)
+#define PNSLR_AsyncIOBackend_IoUring ((PNSLR_AsyncIOBackend) 2)
+
+/**
+ * A queue of asynchronous I/O requests. A queue is meant to be used from one thread;
+ * use one queue per thread that issues requests.
+ */
+typedef struct PNSLR_AsyncIOQueue
+{
+    rawptr data;
+} PNSLR_AsyncIOQueue;
+
+/**
+ * Creates an asynchronous I/O queue that can have up to 'capacity' requests in flight.
+ * 'numWorkerThreads' only applies to the thread pool backend (defaults to 4).
+ * Returns a queue with no data if the backend asked for isn't available.
+ */
+PNSLR_AsyncIOQueue PNSLR_CreateAsyncIOQueue(
+    PNSLR_Allocator allocator,
+    i32 capacity,
+    PNSLR_AsyncIOBackend backend,
+    i32 numWorkerThreads
+);
+
+/**
+ * Destroys an asynchronous I/O queue, after waiting for every request in flight to finish.
+ * Completions that haven't been collected are dropped.
+ */
+void PNSLR_DestroyAsyncIOQueue(
+    PNSLR_AsyncIOQueue* queue
+);
+
+/**
+ * Gets the backend an asynchronous I/O queue ended up with.
+ */
+PNSLR_AsyncIOBackend PNSLR_GetAsyncIOQueueBackend(
+    PNSLR_AsyncIOQueue queue
+);
+
+/**
+ * Submits a batch of requests in one go.
+ * Returns how many of them (from the start of the batch) were accepted; fewer than
+ * all of them means the queue is full, and completions need to be collected first.
+ */
+i32 PNSLR_SubmitAsyncIORequests(
+    PNSLR_AsyncIOQueue queue,
+    PNSLR_ArraySlice(PNSLR_AsyncIORequest) requests
+);
+
+/**
+ * Collects finished requests without waiting.
+ * Returns how many completions were written to the output.
+ */
+i32 PNSLR_PollAsyncIOCompletions(
+    PNSLR_AsyncIOQueue queue,
+    PNSLR_ArraySlice(PNSLR_AsyncIOCompletion) output
+);
+
+/**
+ * Collects finished requests, waiting until there are at least 'minCompletions' of them
+ * (or until nothing is in flight any more).
+ * Returns how many completions were written to the output.
+ */
+i32 PNSLR_WaitForAsyncIOCompletions(
+    PNSLR_AsyncIOQueue queue,
+    PNSLR_ArraySlice(PNSLR_AsyncIOCompletion) output,
+    i32 minCompletions
+);
+
+/**
+ * Gets the number of requests that have been submitted, but whose completions haven't been collected.
+ */
+i32 PNSLR_GetNumAsyncIORequestsInFlight(
+    PNSLR_AsyncIOQueue queue
+);
+
+/**
+ * Asks for the in-flight requests with the given user data to be cancelled.
+ * Requests that were already being carried out may still finish normally;
+ * either way, each one still produces exactly one completion.
+ * Returns true if any matching request hadn't finished yet.
+ */
+b8 PNSLR_CancelAsyncIORequests(
+    PNSLR_AsyncIOQueue queue,
+    u64 userData
+);
+
 #undef PNSLR_ALIGNAS
 
 #ifdef __cplusplus
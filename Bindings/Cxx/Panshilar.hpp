@@ -389,6 +389,57 @@ namespace Panshilar
         Event* event
     );
 
+    // Atomics ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * Atomically loads a 64-bit integer, with sequentially-consistent ordering.
+     */
+    i64 AtomicLoadI64(
+        i64* target
+    );
+
+    /**
+     * Atomically stores a 64-bit integer, with sequentially-consistent ordering.
+     */
+    void AtomicStoreI64(
+        i64* target,
+        i64 value
+    );
+
+    /**
+     * Atomically adds 'value' to a 64-bit integer.
+     * Returns the value it held before the addition.
+     */
+    i64 AtomicFetchAddI64(
+        i64* target,
+        i64 value
+    );
+
+    /**
+     * Atomically replaces a 64-bit integer with 'desired' if it still holds '*expected'.
+     * Returns true on success; on failure, '*expected' is updated to the current value.
+     */
+    b8 AtomicCompareExchangeI64(
+        i64* target,
+        i64* expected,
+        i64 desired
+    );
+
+    /**
+     * Atomically loads a pointer, with sequentially-consistent ordering.
+     */
+    rawptr AtomicLoadPtr(
+        rawptr* target
+    );
+
+    /**
+     * Atomically stores a pointer, with sequentially-consistent ordering.
+     */
+    void AtomicStorePtr(
+        rawptr* target,
+        rawptr value
+    );
+
     // #######################################################################################
     // Memory
     // #######################################################################################
@@ -399,7 +450,7 @@ namespace Panshilar
     void MemSet(
         rawptr memory,
         i32 value,
-        i32 size
+        i64 size
     );
 
     /**
@@ -408,7 +459,7 @@ namespace Panshilar
     void MemCopy(
         rawptr destination,
         rawptr source,
-        i32 size
+        i64 size
     );
 
     /**
@@ -417,7 +468,48 @@ namespace Panshilar
     void MemMove(
         rawptr destination,
         rawptr source,
-        i32 size
+        i64 size
+    );
+
+    // Virtual Memory ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * Get the size of a virtual memory page, the granularity at which memory is committed/decommitted.
+     */
+    i32 GetVirtualMemoryPageSize();
+
+    /**
+     * Reserve a range of address space without backing it with physical memory.
+     * Returns nil on failure.
+     */
+    rawptr ReserveVirtualMemory(
+        i64 size
+    );
+
+    /**
+     * Back a (page-aligned) part of a reserved range with read-write memory.
+     * Freshly committed pages are always zeroed.
+     */
+    b8 CommitVirtualMemory(
+        rawptr memory,
+        i64 size
+    );
+
+    /**
+     * Return the physical memory behind a (page-aligned) part of a reserved range to the OS.
+     * The range stays reserved, and reads back as zeroes once committed again.
+     */
+    b8 DecommitVirtualMemory(
+        rawptr memory,
+        i64 size
+    );
+
+    /**
+     * Release an entire range obtained from `PNSLR_ReserveVirtualMemory`.
+     */
+    b8 ReleaseVirtualMemory(
+        rawptr memory,
+        i64 size
     );
 
     // #######################################################################################
@@ -479,10 +571,10 @@ namespace Panshilar
     typedef rawptr (*AllocatorProcedure)(
         rawptr allocatorData,
         AllocatorMode mode,
-        i32 size,
+        i64 size,
         i32 alignment,
         rawptr oldMemory,
-        i32 oldSize,
+        i64 oldSize,
         SourceCodeLocation location,
         AllocatorError* error
     );
@@ -504,7 +596,7 @@ namespace Panshilar
     rawptr Allocate(
         Allocator allocator,
         b8 zeroed,
-        i32 size,
+        i64 size,
         i32 alignment,
         SourceCodeLocation location,
         AllocatorError* error = { }
@@ -517,8 +609,8 @@ namespace Panshilar
         Allocator allocator,
         b8 zeroed,
         rawptr oldMemory,
-        i32 oldSize,
-        i32 newSize,
+        i64 oldSize,
+        i64 newSize,
         i32 alignment,
         SourceCodeLocation location,
         AllocatorError* error = { }
@@ -531,8 +623,8 @@ namespace Panshilar
         Allocator allocator,
         b8 zeroed,
         rawptr oldMemory,
-        i32 oldSize,
-        i32 newSize,
+        i64 oldSize,
+        i64 newSize,
         i32 alignment,
         SourceCodeLocation location,
         AllocatorError* error = { }
@@ -587,14 +679,44 @@ namespace Panshilar
     rawptr AllocatorFn_DefaultHeap(
         rawptr allocatorData,
         AllocatorMode mode,
-        i32 size,
+        i64 size,
         i32 alignment,
         rawptr oldMemory,
-        i32 oldSize,
+        i64 oldSize,
         SourceCodeLocation location,
         AllocatorError* error
     );
 
+    // Thread-Caching Heap Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * Get the thread-caching heap allocator.
+     * Small allocations are served from per-size-class caches local to each thread, refilled in
+     * batches from a shared central free list; large ones go straight to the OS.
+     * Memory fresh from the OS is already zeroed, so zeroed allocations only clear recycled blocks.
+     */
+    Allocator GetAllocator_ThreadCachingHeap();
+
+    /**
+     * Main allocator function for the thread-caching heap allocator.
+     */
+    rawptr AllocatorFn_ThreadCachingHeap(
+        rawptr allocatorData,
+        AllocatorMode mode,
+        i64 size,
+        i32 alignment,
+        rawptr oldMemory,
+        i64 oldSize,
+        SourceCodeLocation location,
+        AllocatorError* error
+    );
+
+    /**
+     * Hand all the blocks cached by the calling thread back to the central free list.
+     * Threads started with `PNSLR_StartThread` do this automatically before exiting.
+     */
+    void FlushThreadCachingHeapCache();
+
     // Arena Alloator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
     /**
@@ -605,8 +727,8 @@ namespace Panshilar
        ArenaAllocatorBlock* previous;
        Allocator allocator;
        rawptr memory;
-       u32 capacity;
-       u32 used;
+       u64 capacity;
+       u64 used;
     };
 
     /**
@@ -616,9 +738,9 @@ namespace Panshilar
     {
        Allocator backingAllocator;
        ArenaAllocatorBlock* currentBlock;
-       u32 totalUsed;
-       u32 totalCapacity;
-       u32 minimumBlockSize;
+       u64 totalUsed;
+       u64 totalCapacity;
+       u64 minimumBlockSize;
        u32 numSnapshots;
     };
 
@@ -630,7 +752,7 @@ namespace Panshilar
      */
     Allocator NewAllocator_Arena(
         Allocator backingAllocator,
-        u32 pageSize,
+        u64 pageSize,
         SourceCodeLocation location,
         AllocatorError* error = { }
     );
@@ -651,10 +773,10 @@ namespace Panshilar
     rawptr AllocatorFn_Arena(
         rawptr allocatorData,
         AllocatorMode mode,
-        i32 size,
+        i64 size,
         i32 alignment,
         rawptr oldMemory,
-        i32 oldSize,
+        i64 oldSize,
         SourceCodeLocation location,
         AllocatorError* error
     );
@@ -677,7 +799,7 @@ namespace Panshilar
        b8 valid;
        ArenaAllocatorPayload* payload;
        ArenaAllocatorBlock* block;
-       u32 used;
+       u64 used;
     };
 
     /**
@@ -712,6 +834,279 @@ namespace Panshilar
         ArenaAllocatorSnapshot* snapshot
     );
 
+    // Virtual Arena Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * The payload used by the virtual arena allocator.
+     * Lives at the very start of its own reserved range, followed by the allocations.
+     */
+    struct VirtualArenaAllocatorPayload
+    {
+       u8* memory;
+       i64 reserved;
+       i64 committed;
+       i64 used;
+       i32 pageSize;
+       u32 numSnapshots;
+    };
+
+    /**
+     * Create an arena allocator that reserves 'reserveSize' bytes of address space up-front and
+     * commits pages on demand, so all allocations live in one contiguous span. The last allocation
+     * can always be resized in place, and restoring a snapshot returns the tail pages to the OS.
+     */
+    Allocator NewAllocator_VirtualArena(
+        i64 reserveSize,
+        SourceCodeLocation location,
+        AllocatorError* error = { }
+    );
+
+    /**
+     * Destroy a virtual arena allocator and release its entire reserved range.
+     */
+    void DestroyAllocator_VirtualArena(
+        Allocator allocator,
+        SourceCodeLocation location,
+        AllocatorError* error = { }
+    );
+
+    /**
+     * Main allocator function for the virtual arena allocator.
+     */
+    rawptr AllocatorFn_VirtualArena(
+        rawptr allocatorData,
+        AllocatorMode mode,
+        i64 size,
+        i32 alignment,
+        rawptr oldMemory,
+        i64 oldSize,
+        SourceCodeLocation location,
+        AllocatorError* error
+    );
+
+    /**
+     * A snapshot of the virtual arena allocator, recording its state at a specific point in time.
+     */
+    struct VirtualArenaAllocatorSnapshot
+    {
+       b8 valid;
+       VirtualArenaAllocatorPayload* payload;
+       i64 used;
+    };
+
+    /**
+     * Ensures that the virtual arena allocator has either restored/discarded all the
+     * snapshots that were taken.
+     */
+    b8 ValidateVirtualArenaAllocatorSnapshotState(
+        Allocator allocator
+    );
+
+    /**
+     * Captures a snapshot of the virtual arena allocator.
+     */
+    VirtualArenaAllocatorSnapshot CaptureVirtualArenaAllocatorSnapshot(
+        Allocator allocator
+    );
+
+    /**
+     * Restores the state of the virtual arena allocator from a snapshot, decommitting the pages past it.
+     * Upon success, the snapshot is marked as invalid.
+     */
+    ArenaSnapshotError RestoreVirtualArenaAllocatorSnapshot(
+        VirtualArenaAllocatorSnapshot* snapshot,
+        SourceCodeLocation loc
+    );
+
+    /**
+     * Discards a snapshot of the virtual arena allocator.
+     */
+    ArenaSnapshotError DiscardVirtualArenaAllocatorSnapshot(
+        VirtualArenaAllocatorSnapshot* snapshot
+    );
+
+    // Concurrent Arena Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * A block of memory used by the concurrent arena allocator.
+     * 'used' is bumped atomically and can overshoot 'capacity' once the block is full.
+     */
+    struct ConcurrentArenaAllocatorBlock
+    {
+       ConcurrentArenaAllocatorBlock* previous;
+       u8* memory;
+       i64 capacity;
+       i64 used;
+    };
+
+    /**
+     * The payload used by the concurrent arena allocator.
+     * Threads lease 'leaseSize' bytes at a time from the current block and bump-allocate
+     * from their lease without touching shared state; only new blocks take the lock.
+     */
+    struct ConcurrentArenaAllocatorPayload
+    {
+       Allocator backingAllocator;
+       Mutex growthMutex;
+       ConcurrentArenaAllocatorBlock* currentBlock;
+       i64 minimumBlockSize;
+       i64 leaseSize;
+       i64 totalCapacity;
+       i64 id;
+       i64 generation;
+    };
+
+    /**
+     * Create an arena allocator that many threads can allocate from at the same time.
+     * Blocks are at least 'blockSize' bytes, and each thread leases 'leaseSize' bytes
+     * (rounded up to a cache line) at a time; allocations bigger than half a lease go
+     * straight to the block. Individual frees are not supported, use a single FreeAll
+     * once no thread is allocating anymore (e.g. at the end of a frame).
+     * The backing allocator is only ever called under a lock.
+     */
+    Allocator NewAllocator_ConcurrentArena(
+        Allocator backingAllocator,
+        i64 blockSize,
+        i32 leaseSize,
+        SourceCodeLocation location,
+        AllocatorError* error = { }
+    );
+
+    /**
+     * Destroy a concurrent arena allocator and free all its resources.
+     * This does not free the backing allocator, only the arena allocator's own resources.
+     */
+    void DestroyAllocator_ConcurrentArena(
+        Allocator allocator,
+        SourceCodeLocation location,
+        AllocatorError* error = { }
+    );
+
+    /**
+     * Main allocator function for the concurrent arena allocator.
+     */
+    rawptr AllocatorFn_ConcurrentArena(
+        rawptr allocatorData,
+        AllocatorMode mode,
+        i64 size,
+        i32 alignment,
+        rawptr oldMemory,
+        i64 oldSize,
+        SourceCodeLocation location,
+        AllocatorError* error
+    );
+
+    // Frame Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * A block of memory used by the frame allocator. Blocks are kept around and reused
+     * once their frame comes around again.
+     */
+    struct FrameAllocatorBlock
+    {
+       FrameAllocatorBlock* next;
+       u8* memory;
+       i64 capacity;
+       i64 used;
+    };
+
+    /**
+     * One frame's worth of blocks in the frame allocator.
+     */
+    struct FrameAllocatorFrame
+    {
+       FrameAllocatorBlock* firstBlock;
+       FrameAllocatorBlock* currentBlock;
+       i64 used;
+       i64 capacity;
+       i64 highWaterMark;
+    };
+
+    /**
+     * The payload used by the frame allocator, a ring of up to 8 per-frame arenas.
+     */
+    struct FrameAllocatorPayload
+    {
+       Allocator backingAllocator;
+       FrameAllocatorFrame frames[8];
+       i64 minimumBlockSize;
+       i64 peakHighWaterMark;
+       u64 frameIndex;
+       i32 numFrames;
+       i32 currentFrame;
+    };
+
+    /**
+     * Usage statistics for a frame allocator.
+     */
+    struct FrameAllocatorStats
+    {
+       u64 frameIndex;
+       i64 usedBytes;
+       i64 lastHighWaterMark;
+       i64 peakHighWaterMark;
+       i64 totalCapacity;
+       i32 numFrames;
+    };
+
+    /**
+     * Create a frame allocator: a ring of 'numFrames' (1 to 8) arenas, where memory allocated
+     * during a frame survives the next 'numFrames - 1' calls to `PNSLR_AdvanceFrameAllocator`,
+     * and is reclaimed by the 'numFrames'-th one.
+     * Blocks are at least 'blockSize' bytes, and are never handed back to the backing allocator
+     * until the frame allocator is destroyed.
+     * Individual frees are not supported.
+     */
+    Allocator NewAllocator_Frame(
+        Allocator backingAllocator,
+        i32 numFrames,
+        i64 blockSize,
+        SourceCodeLocation location,
+        AllocatorError* error = { }
+    );
+
+    /**
+     * Destroy a frame allocator and free all its resources.
+     * This does not free the backing allocator, only the frame allocator's own resources.
+     */
+    void DestroyAllocator_Frame(
+        Allocator allocator,
+        SourceCodeLocation location,
+        AllocatorError* error = { }
+    );
+
+    /**
+     * Main allocator function for the frame allocator.
+     * FreeAll resets every frame (keeping their blocks).
+     */
+    rawptr AllocatorFn_Frame(
+        rawptr allocatorData,
+        AllocatorMode mode,
+        i64 size,
+        i32 alignment,
+        rawptr oldMemory,
+        i64 oldSize,
+        SourceCodeLocation location,
+        AllocatorError* error
+    );
+
+    /**
+     * Moves a frame allocator on to the next frame, resetting the oldest frame's arena
+     * (and so invalidating everything allocated 'numFrames' frames ago) for reuse.
+     * Returns the high-water mark of the frame that just ended.
+     */
+    i64 AdvanceFrameAllocator(
+        Allocator allocator
+    );
+
+    /**
+     * Get the current usage statistics of a frame allocator.
+     * Returns zeroed stats if the allocator is not a frame allocator.
+     */
+    FrameAllocatorStats GetFrameAllocatorStats(
+        Allocator allocator
+    );
+
     // Stack Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
     /**
@@ -728,62 +1123,503 @@ namespace Panshilar
      * The header used for every separate stack allocation.
      * This is used to store metadata about the allocation and deallocate appropriately.
      */
-    struct StackAllocationHeader
+    struct StackAllocationHeader
+    {
+       StackAllocatorPage* page;
+       i64 size;
+       i32 alignment;
+       rawptr lastAllocation;
+       rawptr lastAllocationHeader;
+    };
+
+    /**
+     * The payload used by the stack allocator.
+     */
+    struct StackAllocatorPayload
+    {
+       Allocator backingAllocator;
+       StackAllocatorPage* currentPage;
+       rawptr lastAllocation;
+       StackAllocationHeader* lastAllocationHeader;
+    };
+
+    /**
+     * Create a stack allocator with the specified backing allocator.
+     * The stack allocator will use the backing allocator to allocate its pages.
+     * The stack allocator will not free the backing allocator, so it is the caller's responsibility to
+     * free the backing allocator when it is no longer needed.
+     */
+    Allocator NewAllocator_Stack(
+        Allocator backingAllocator,
+        SourceCodeLocation location,
+        AllocatorError* error = { }
+    );
+
+    /**
+     * Destroy a stack allocator and free all its resources.
+     * This does not free the backing allocator, only the stack allocator's own resources.
+     */
+    void DestroyAllocator_Stack(
+        Allocator allocator,
+        SourceCodeLocation location,
+        AllocatorError* error = { }
+    );
+
+    /**
+     * Main allocator function for the stack allocator.
+     */
+    rawptr AllocatorFn_Stack(
+        rawptr allocatorData,
+        AllocatorMode mode,
+        i64 size,
+        i32 alignment,
+        rawptr oldMemory,
+        i64 oldSize,
+        SourceCodeLocation location,
+        AllocatorError* error
+    );
+
+    // Pool Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * A chunk of fixed-size slots owned by the pool allocator.
+     * Slots are handed out from the chunk in order before they're ever recycled via the free list.
+     */
+    struct PoolAllocatorChunk
+    {
+       PoolAllocatorChunk* previous;
+       rawptr slots;
+       i32 slotsCount;
+       i32 slotsTouched;
+    };
+
+    /**
+     * The payload used by the pool allocator.
+     * Freed slots are threaded into an intrusive singly-linked list, so both allocation and free are O(1).
+     */
+    struct PoolAllocatorPayload
+    {
+       Allocator backingAllocator;
+       PoolAllocatorChunk* currentChunk;
+       rawptr freeList;
+       i32 slotSize;
+       i32 slotAlignment;
+       i32 slotStride;
+       i32 slotsPerChunk;
+       i64 numSlotsUsed;
+       i64 numSlotsTotal;
+    };
+
+    /**
+     * Create a pool allocator that hands out slots of up to 'slotSize' bytes, aligned to
+     * 'slotAlignment', growing 'slotsPerChunk' slots at a time from the backing allocator.
+     * The pool allocator will not free the backing allocator, so it is the caller's responsibility to
+     * free the backing allocator when it is no longer needed.
+     */
+    Allocator NewAllocator_Pool(
+        Allocator backingAllocator,
+        i32 slotSize,
+        i32 slotAlignment,
+        i32 slotsPerChunk,
+        SourceCodeLocation location,
+        AllocatorError* error = { }
+    );
+
+    /**
+     * Destroy a pool allocator and free all its resources.
+     * This does not free the backing allocator, only the pool allocator's own resources.
+     */
+    void DestroyAllocator_Pool(
+        Allocator allocator,
+        SourceCodeLocation location,
+        AllocatorError* error = { }
+    );
+
+    /**
+     * Main allocator function for the pool allocator.
+     */
+    rawptr AllocatorFn_Pool(
+        rawptr allocatorData,
+        AllocatorMode mode,
+        i64 size,
+        i32 alignment,
+        rawptr oldMemory,
+        i64 oldSize,
+        SourceCodeLocation location,
+        AllocatorError* error
+    );
+
+    // Slab Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * The header at the start of every slab of the slab allocator.
+     * Slabs are aligned to their own size, so any object can find its slab by masking its address.
+     * Allocations too big for any cache get a dedicated slab of their own, with a 'cacheIndex' of -1.
+     */
+    struct SlabAllocatorSlab
+    {
+       SlabAllocatorSlab* next;
+       SlabAllocatorSlab* previous;
+       rawptr freeList;
+       i64 capacity;
+       i32 cacheIndex;
+       i32 objectsCount;
+       i32 objectsUsed;
+       i32 objectsTouched;
+    };
+
+    /**
+     * A cache of slabs for one object size (a multiple of the cache line size),
+     * split into partially filled, full and completely empty slabs.
+     */
+    struct SlabAllocatorCache
+    {
+       Mutex mutex;
+       SlabAllocatorSlab* partialSlabs;
+       SlabAllocatorSlab* fullSlabs;
+       SlabAllocatorSlab* emptySlabs;
+       i64 numObjectsUsed;
+       i32 objectStride;
+       i32 objectsPerSlab;
+       i32 numSlabs;
+       i32 numEmptySlabs;
+    };
+
+    /**
+     * The payload used by the slab allocator, with one cache per 64-byte size step up to 2 KiB.
+     */
+    struct SlabAllocatorPayload
+    {
+       Allocator backingAllocator;
+       SlabAllocatorCache caches[32];
+       Mutex largeSlabsMutex;
+       SlabAllocatorSlab* largeSlabs;
+       i64 numLargeSlabs;
+       i32 maxEmptySlabsPerCache;
+    };
+
+    /**
+     * Usage statistics for a slab allocator.
+     */
+    struct SlabAllocatorStats
+    {
+       i64 numObjectsUsed;
+       i64 numSlabs;
+       i64 numEmptySlabs;
+       i64 numLargeSlabs;
+       i64 reservedBytes;
+    };
+
+    /**
+     * Create a thread-safe slab allocator, meant for small, frequently allocated structs.
+     * Objects up to 2 KiB are served from 64 KiB slabs, one cache per 64-byte size step, and are
+     * always aligned to (and padded out to) the cache line, so neighbouring objects handed out to
+     * different threads never share one. Each cache keeps up to 'maxEmptySlabsPerCache' completely
+     * empty slabs around for reuse before handing any back to the backing allocator.
+     * The backing allocator must honour 64 KiB alignment.
+     */
+    Allocator NewAllocator_Slab(
+        Allocator backingAllocator,
+        i32 maxEmptySlabsPerCache,
+        SourceCodeLocation location,
+        AllocatorError* error = { }
+    );
+
+    /**
+     * Destroy a slab allocator and free all its resources.
+     * This does not free the backing allocator, only the slab allocator's own resources.
+     */
+    void DestroyAllocator_Slab(
+        Allocator allocator,
+        SourceCodeLocation location,
+        AllocatorError* error = { }
+    );
+
+    /**
+     * Main allocator function for the slab allocator.
+     */
+    rawptr AllocatorFn_Slab(
+        rawptr allocatorData,
+        AllocatorMode mode,
+        i64 size,
+        i32 alignment,
+        rawptr oldMemory,
+        i64 oldSize,
+        SourceCodeLocation location,
+        AllocatorError* error
+    );
+
+    /**
+     * Hand every completely empty slab of a slab allocator back to its backing allocator.
+     */
+    void TrimSlabAllocator(
+        Allocator allocator,
+        SourceCodeLocation location
+    );
+
+    /**
+     * Get the current usage statistics of a slab allocator.
+     * Returns zeroed stats if the allocator is not a slab allocator.
+     */
+    SlabAllocatorStats GetSlabAllocatorStats(
+        Allocator allocator
+    );
+
+    // Buddy Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * The header written into every free block of the buddy allocator,
+     * linking it into the free list for its order.
+     */
+    struct BuddyAllocatorFreeBlock
+    {
+       BuddyAllocatorFreeBlock* previous;
+       BuddyAllocatorFreeBlock* next;
+    };
+
+    /**
+     * The payload used by the buddy allocator.
+     * Block 'order' N is 'minBlockSize << N' bytes; the whole region is a single block of the highest order.
+     */
+    struct BuddyAllocatorPayload
+    {
+       Allocator backingAllocator;
+       rawptr memory;
+       u8* blockStates;
+       i64* requestedSizes;
+       i64 regionSize;
+       i32 minBlockSize;
+       i32 minBlockShift;
+       i32 numOrders;
+       i32 numAllocations;
+       i32 numFreeBlocks;
+       i64 usedBytes;
+       i64 requestedBytes;
+       BuddyAllocatorFreeBlock* freeLists[32];
+    };
+
+    /**
+     * Usage/fragmentation statistics for a buddy allocator.
+     * 'usedBytes - requestedBytes' is the internal fragmentation (rounding up to power-of-two blocks),
+     * and 'freeBytes - largestFreeBlock' is the free memory that can't be handed out in one piece.
+     */
+    struct BuddyAllocatorStats
+    {
+       i64 totalBytes;
+       i64 usedBytes;
+       i64 requestedBytes;
+       i64 freeBytes;
+       i64 largestFreeBlock;
+       i32 numAllocations;
+       i32 numFreeBlocks;
+    };
+
+    /**
+     * Create a buddy allocator over a single region of 'regionSize' bytes (rounded up to a power of two)
+     * reserved from the backing allocator up-front. Blocks are never smaller than 'minBlockSize'
+     * (also a power of two), and allocations can't be aligned beyond it.
+     * The buddy allocator will not free the backing allocator, so it is the caller's responsibility to
+     * free the backing allocator when it is no longer needed.
+     */
+    Allocator NewAllocator_Buddy(
+        Allocator backingAllocator,
+        i64 regionSize,
+        i32 minBlockSize,
+        SourceCodeLocation location,
+        AllocatorError* error = { }
+    );
+
+    /**
+     * Destroy a buddy allocator and free all its resources.
+     * This does not free the backing allocator, only the buddy allocator's own resources.
+     */
+    void DestroyAllocator_Buddy(
+        Allocator allocator,
+        SourceCodeLocation location,
+        AllocatorError* error = { }
+    );
+
+    /**
+     * Main allocator function for the buddy allocator.
+     */
+    rawptr AllocatorFn_Buddy(
+        rawptr allocatorData,
+        AllocatorMode mode,
+        i64 size,
+        i32 alignment,
+        rawptr oldMemory,
+        i64 oldSize,
+        SourceCodeLocation location,
+        AllocatorError* error
+    );
+
+    /**
+     * Get the current usage/fragmentation statistics of a buddy allocator.
+     * Returns zeroed stats if the allocator is not a buddy allocator.
+     */
+    BuddyAllocatorStats GetBuddyAllocatorStats(
+        Allocator allocator
+    );
+
+    // Tracking Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * Allocation statistics for a single call site (file:line) of a tracking allocator.
+     * 'liveBytes' can go negative in a per-thread record if the memory was freed on a
+     * different thread than the one that allocated it; the merged totals are exact.
+     */
+    struct TrackingAllocatorCallSite
+    {
+       SourceCodeLocation location;
+       i64 numAllocations;
+       i64 numFrees;
+       i64 numResizes;
+       i64 totalBytes;
+       i64 liveBytes;
+    };
+
+    /**
+     * The per-thread record of a tracking allocator. Only the owning thread ever writes
+     * to it, so recording an allocation doesn't need a lock.
+     * Call sites past the capacity of the table are accumulated into 'overflow'.
+     */
+    struct TrackingAllocatorThreadRecord
+    {
+       TrackingAllocatorThreadRecord* next;
+       rawptr owner;
+       i64 numAllocations;
+       i64 numFrees;
+       i64 numResizes;
+       i64 totalBytes;
+       i32 numCallSites;
+       TrackingAllocatorCallSite overflow;
+       TrackingAllocatorCallSite callSites[256];
+    };
+
+    /**
+     * The payload used by the tracking allocator.
+     * Live/peak bytes are kept up to date atomically, everything else lives in the per-thread records.
+     */
+    struct TrackingAllocatorPayload
     {
-       StackAllocatorPage* page;
-       i32 size;
-       i32 alignment;
-       rawptr lastAllocation;
-       rawptr lastAllocationHeader;
+       Allocator backingAllocator;
+       Mutex recordsMutex;
+       TrackingAllocatorThreadRecord* records;
+       i64 id;
+       i64 liveBytes;
+       i64 peakBytes;
     };
 
     /**
-     * The payload used by the stack allocator.
+     * Overall statistics of a tracking allocator, merged across all threads.
      */
-    struct StackAllocatorPayload
+    struct TrackingAllocatorStats
     {
-       Allocator backingAllocator;
-       StackAllocatorPage* currentPage;
-       rawptr lastAllocation;
-       StackAllocationHeader* lastAllocationHeader;
+       i64 liveBytes;
+       i64 peakBytes;
+       i64 liveAllocations;
+       i64 numAllocations;
+       i64 numFrees;
+       i64 numResizes;
+       i64 totalBytes;
+       i32 numThreads;
     };
 
     /**
-     * Create a stack allocator with the specified backing allocator.
-     * The stack allocator will use the backing allocator to allocate its pages.
-     * The stack allocator will not free the backing allocator, so it is the caller's responsibility to
-     * free the backing allocator when it is no longer needed.
+     * Create a tracking allocator that forwards to 'backingAllocator', recording live/peak
+     * bytes, allocation counts and per call site histograms from the source code locations
+     * passed to every allocator call.
+     * Every allocation carries a small header, so memory must be freed through the tracking
+     * allocator, and resizes only stay in-place if the backing allocator supports it.
      */
-    Allocator NewAllocator_Stack(
+    Allocator NewAllocator_Tracking(
         Allocator backingAllocator,
         SourceCodeLocation location,
         AllocatorError* error = { }
     );
 
     /**
-     * Destroy a stack allocator and free all its resources.
-     * This does not free the backing allocator, only the stack allocator's own resources.
+     * Destroy a tracking allocator and its records.
+     * This does not free any allocations still live in the backing allocator.
      */
-    void DestroyAllocator_Stack(
+    void DestroyAllocator_Tracking(
         Allocator allocator,
         SourceCodeLocation location,
         AllocatorError* error = { }
     );
 
     /**
-     * Main allocator function for the stack allocator.
+     * Main allocator function for the tracking allocator.
      */
-    rawptr AllocatorFn_Stack(
+    rawptr AllocatorFn_Tracking(
         rawptr allocatorData,
         AllocatorMode mode,
-        i32 size,
+        i64 size,
         i32 alignment,
         rawptr oldMemory,
-        i32 oldSize,
+        i64 oldSize,
         SourceCodeLocation location,
         AllocatorError* error
     );
 
+    /**
+     * Get the current statistics of a tracking allocator.
+     * Returns zeroed stats if the allocator is not a tracking allocator.
+     */
+    TrackingAllocatorStats GetTrackingAllocatorStats(
+        Allocator allocator
+    );
+
+    /**
+     * Get the call sites recorded by a tracking allocator, merged across threads and
+     * sorted by live bytes (then total bytes), largest first.
+     * The slice is allocated from 'outputAllocator'.
+     */
+    ArraySlice<TrackingAllocatorCallSite> GetTrackingAllocatorCallSites(
+        Allocator allocator,
+        Allocator outputAllocator,
+        SourceCodeLocation location,
+        AllocatorError* error = { }
+    );
+
+    /**
+     * Reset the peak bytes of a tracking allocator to its current live bytes.
+     * Useful for measuring the peak within a single frame.
+     */
+    void ResetTrackingAllocatorPeak(
+        Allocator allocator
+    );
+
+    // Internal Allocators ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * Usage statistics of one of the library's internal scratch arenas (strings, paths, etc.).
+     * Each thread gets a fixed static buffer of 'staticCapacity' bytes, and overflows into
+     * blocks from the default heap once that runs out; those are released again as soon as
+     * the operation that needed them is done. Counters are summed across threads.
+     */
+    struct InternalAllocatorStats
+    {
+       utf8str name;
+       i64 staticCapacity;
+       i64 numOverflows;
+       i64 overflowBytes;
+       i64 peakOverflowBytes;
+    };
+
+    /**
+     * Fill 'output' with the statistics of the internal arenas used so far (by any thread),
+     * and return how many there are; which may be more than 'output' could hold.
+     */
+    i32 GetInternalAllocatorStats(
+        ArraySlice<InternalAllocatorStats> output
+    );
+
+    /**
+     * Reset the peak overflow bytes of all internal arenas to their current overflow bytes.
+     */
+    void ResetInternalAllocatorPeaks();
+
     // Collections make/free functions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
     /**
@@ -1107,6 +1943,198 @@ namespace Panshilar
         StringComparisonType comparisonType = { }
     );
 
+    // Hashing ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * Hashes the bytes of a string to 64 bits (wyhash, final version 4).
+     * Not suitable for anything cryptographic. The result is the same on every platform,
+     * so it's fine to store it.
+     */
+    u64 HashString(
+        utf8str str,
+        u64 seed = { }
+    );
+
+    /**
+     * Returns a view of the string without any leading ASCII whitespace.
+     */
+    utf8str TrimStringFromStart(
+        utf8str str
+    );
+
+    /**
+     * Returns a view of the string without any trailing ASCII whitespace.
+     */
+    utf8str TrimStringFromEnd(
+        utf8str str
+    );
+
+    /**
+     * Returns a view of the string without any leading or trailing ASCII whitespace.
+     */
+    utf8str TrimString(
+        utf8str str
+    );
+
+    /**
+     * What a split iterator splits on.
+     */
+    enum class StringSplitType : u8 /* use as value */
+    {
+        Byte = 0,
+        String = 1,
+        AnyOf = 2,
+        Lines = 3,
+        Whitespace = 4,
+    };
+
+    /**
+     * Splits a string into parts without allocating; every part is a view into the
+     * original string. Create with one of the `PNSLR_SplitStringBy*` functions, then
+     * take parts from either end with `PNSLR_NextSplitFromStart`/`PNSLR_NextSplitFromEnd`.
+     */
+    struct StringSplitIterator
+    {
+       utf8str remaining;
+       utf8str separator;
+       u8 separatorByte;
+       StringSplitType type;
+       StringComparisonType comparisonType;
+       b8 finished;
+    };
+
+    /**
+     * Split on every occurrence of a byte. Empty parts are kept, so "a,,b" gives
+     * "a", "" and "b".
+     */
+    StringSplitIterator SplitStringByByte(
+        utf8str str,
+        u8 separator
+    );
+
+    /**
+     * Split on every occurrence of a string. Empty parts are kept. An empty
+     * separator never matches.
+     */
+    StringSplitIterator SplitStringByString(
+        utf8str str,
+        utf8str separator,
+        StringComparisonType comparisonType = { }
+    );
+
+    /**
+     * Split on every occurrence of any of the bytes in 'separators'. Empty parts are kept.
+     */
+    StringSplitIterator SplitStringByAnyOf(
+        utf8str str,
+        utf8str separators
+    );
+
+    /**
+     * Split into lines, on "\n" or "\r\n". A newline at the very end does not start
+     * another (empty) line.
+     */
+    StringSplitIterator SplitStringByLines(
+        utf8str str
+    );
+
+    /**
+     * Split on runs of ASCII whitespace. Empty parts are skipped, so only the words
+     * come out.
+     */
+    StringSplitIterator SplitStringByWhitespace(
+        utf8str str
+    );
+
+    /**
+     * Takes the next part from the start of what's left.
+     * Returns false once there are no more parts.
+     */
+    b8 NextSplitFromStart(
+        StringSplitIterator* iterator,
+        utf8str* part
+    );
+
+    /**
+     * Takes the next part from the end of what's left.
+     * Returns false once there are no more parts.
+     */
+    b8 NextSplitFromEnd(
+        StringSplitIterator* iterator,
+        utf8str* part
+    );
+
+    // Tokenizer ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * The kinds of tokens the tokenizer produces.
+     */
+    enum class TokenType : u8 /* use as value */
+    {
+        EndOfInput = 0,
+        Identifier = 1,
+        Number = 2,
+        String = 3,
+        Symbol = 4,
+        Invalid = 5,
+    };
+
+    /**
+     * A single token.
+     * Identifiers are letters, digits, underscores and non-ASCII bytes, not starting
+     * with a digit.
+     * Numbers start with a digit (or a '.' followed by one) and are left for the
+     * number parsers to validate; a leading sign is a separate symbol.
+     * Strings are quoted with '"' or '\'', can contain backslash escapes, and have
+     * to end on the line they start on (otherwise they're invalid). Their text keeps
+     * the quotes.
+     * Symbols are any other single byte.
+     */
+    struct Token
+    {
+       TokenType type;
+       utf8str text;
+       i32 line;
+       i32 column;
+    };
+
+    /**
+     * Splits source text into tokens, without allocating.
+     * Create with `PNSLR_MakeTokenizer`; can be copied to save/restore its position.
+     */
+    struct Tokenizer
+    {
+       utf8str source;
+       i64 position;
+       i32 line;
+       i64 lineStart;
+       utf8str lineCommentStart;
+    };
+
+    /**
+     * Creates a tokenizer over the source text. Anything from 'lineCommentStart' to
+     * the end of its line is skipped, like whitespace.
+     */
+    Tokenizer MakeTokenizer(
+        utf8str source,
+        utf8str lineCommentStart = { }
+    );
+
+    /**
+     * Returns the next token and moves past it. At the end of the source, returns
+     * `PNSLR_TokenType_EndOfInput` tokens.
+     */
+    Token NextToken(
+        Tokenizer* tokenizer
+    );
+
+    /**
+     * Returns the next token without moving past it.
+     */
+    Token PeekToken(
+        Tokenizer* tokenizer
+    );
+
     // UTF-8 functionalities ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
     /**
@@ -1152,12 +2180,70 @@ namespace Panshilar
         ArraySlice<u8> s
     );
 
+    /**
+     * Checks whether a string is entirely well-formed UTF-8, i.e. without overlong encodings,
+     * surrogates, runes past U+10FFFF or truncated sequences. Runs of ASCII are skipped in bulk.
+     */
+    b8 ValidateUTF8(
+        utf8str str
+    );
+
+    /**
+     * Counts the runes in a UTF-8 string; as many as decoding it rune by rune would produce,
+     * with every byte of an invalid sequence counting as one error rune (U+FFFD).
+     */
+    i64 CountRunesInString(
+        utf8str str
+    );
+
+    // UTF-16 conversions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * Returns the number of UTF-16 code units needed to hold a UTF-8 string. Invalid
+     * sequences count as one error rune (U+FFFD) per byte, as with `PNSLR_DecodeRune`.
+     */
+    i64 GetUTF16LengthOfUTF8(
+        utf8str str
+    );
+
+    /**
+     * Returns the number of bytes needed to hold a UTF-16 string as UTF-8.
+     * Unpaired surrogates count as the error rune (U+FFFD).
+     */
+    i64 GetUTF8LengthOfUTF16(
+        ArraySlice<u16> str
+    );
+
+    /**
+     * Converts a UTF-8 string to a UTF-16 string, on every platform.
+     * The output is measured first, then written in one go into a slice allocated
+     * using the specified allocator. Invalid sequences are replaced with U+FFFD.
+     *
+     * Warning! - The output string will contain a null terminator and the slice count
+     * will not include that null terminator.
+     */
+    ArraySlice<u16> UTF16FromUTF8(
+        utf8str str,
+        Allocator allocator
+    );
+
+    /**
+     * Converts a UTF-16 string to a UTF-8 string, on every platform.
+     * The output is measured first, then written in one go into a string allocated
+     * using the specified allocator. Unpaired surrogates are replaced with U+FFFD.
+     */
+    utf8str UTF8FromUTF16(
+        ArraySlice<u16> str,
+        Allocator allocator
+    );
+
     // Windows-specific bs for UTF-16 conversions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
     /**
      * Converts a UTF-8 string to a UTF-16 string.
      * The returned string is allocated using the specified allocator.
-     * Only available on Windows. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+     * Meant for Windows APIs. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+     * Elsewhere, this falls back to `PNSLR_UTF16FromUTF8`.
      *
      * Warning! - The output string will contain a null terminator and the slice count
      * will not include that null terminator.
@@ -1170,7 +2256,8 @@ namespace Panshilar
     /**
      * Converts a UTF-16 string to a UTF-8 string.
      * The returned string is allocated using the specified allocator.
-     * Only available on Windows. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+     * Meant for Windows APIs. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+     * Elsewhere, this falls back to `PNSLR_UTF8FromUTF16`.
      *
      * Warning! - All the trailing null terminator characters will be ignored.
      */
@@ -1246,6 +2333,8 @@ namespace Panshilar
 
     /**
      * Append a 32-bit floating-point number to the string builder.
+     * A negative `decimalPlaces` writes the shortest form that parses back to the same f32
+     * (scientific notation below 1e-6 and from 1e21 up).
      */
     b8 AppendF32ToStringBuilder(
         StringBuilder* builder,
@@ -1255,6 +2344,9 @@ namespace Panshilar
 
     /**
      * Append a 64-bit floating point number to the string builder.
+     * A negative `decimalPlaces` writes the shortest form that parses back to the same f64
+     * (scientific notation below 1e-6 and from 1e21 up). Infinities, and magnitudes from
+     * 2^64 up, are always written that way.
      */
     b8 AppendF64ToStringBuilder(
         StringBuilder* builder,
@@ -1393,7 +2485,7 @@ namespace Panshilar
      * The internal encoding of a type-unspecific format specifier.
      * For booleans, valueBufferA is 0 or 1.
      * For floats, valueBufferA is the float value (reinterpret as relevant),
-     *     and valueBufferB is the number of decimal places (cast to i32).
+     *     and valueBufferB is the number of decimal places (cast to i32, negative for shortest).
      * For integers, valueBufferA is the integer value (reinterpret as relevant),
      *     and the first half of valueBufferB is the base (cast to PNSLR_IntegerBase).
      * For runes, valueBufferA is the rune value (reinterpret as u32).
@@ -1417,6 +2509,7 @@ namespace Panshilar
 
     /**
      * Use when formatting a string. Pass as one of the varargs.
+     * Pass a negative `decimalPlaces` for the shortest round-trip form.
      */
     PrimitiveFmtOptions FmtF32(
         f32 value,
@@ -1425,6 +2518,7 @@ namespace Panshilar
 
     /**
      * Use when formatting a string. Pass as one of the varargs.
+     * Pass a negative `decimalPlaces` for the shortest round-trip form.
      */
     PrimitiveFmtOptions FmtF64(
         f64 value,
@@ -1572,6 +2666,7 @@ namespace Panshilar
 
     /**
      * Convert a 32-bit floating-point number to a string with specified decimal places.
+     * Negative decimal places give the shortest string that round-trips.
      */
     utf8str StringFromF32(
         f32 value,
@@ -1581,6 +2676,7 @@ namespace Panshilar
 
     /**
      * Convert a 64-bit floating-point number to a string with specified decimal places.
+     * Negative decimal places give the shortest string that round-trips.
      */
     utf8str StringFromF64(
         f64 value,
@@ -1672,7 +2768,9 @@ namespace Panshilar
 
     /**
      * Convert a valid string (numbers-only, with zero or one decimal points,
-     * optional -/+ sign at the start) to a 32-bit floating-point number.
+     * optional -/+ sign at the start, optional e/E exponent at the end) to a
+     * 32-bit floating-point number, rounded to the nearest one. Also accepts
+     * "inf", "infinity" and "nan" (case-insensitive, optionally signed).
      */
     b8 F32FromString(
         utf8str str,
@@ -1681,7 +2779,9 @@ namespace Panshilar
 
     /**
      * Convert a valid string (numbers-only, with zero or one decimal points,
-     * optional -/+ sign at the start) to a 64-bit floating-point number.
+     * optional -/+ sign at the start, optional e/E exponent at the end) to a
+     * 64-bit floating-point number, rounded to the nearest one. Also accepts
+     * "inf", "infinity" and "nan" (case-insensitive, optionally signed).
      */
     b8 F64FromString(
         utf8str str,
@@ -1776,6 +2876,52 @@ namespace Panshilar
         i64* value
     );
 
+    /**
+     * Parse a list of numbers separated by `delimiter` (e.g. a CSV row) into `output`,
+     * each one as per PNSLR_F32FromString, ignoring whitespace around them. `count` is
+     * set to the number of values written. Fails on an invalid number, or when there
+     * are more numbers than `output` can hold.
+     */
+    b8 F32ArrayFromString(
+        utf8str str,
+        u8 delimiter,
+        ArraySlice<f32> output,
+        i64* count
+    );
+
+    /**
+     * Parse a list of numbers separated by `delimiter` into `output`, each one as per
+     * PNSLR_F64FromString. See PNSLR_F32ArrayFromString for details.
+     */
+    b8 F64ArrayFromString(
+        utf8str str,
+        u8 delimiter,
+        ArraySlice<f64> output,
+        i64* count
+    );
+
+    /**
+     * Parse a list of numbers separated by `delimiter` into `output`, each one as per
+     * PNSLR_U64FromString. See PNSLR_F32ArrayFromString for details.
+     */
+    b8 U64ArrayFromString(
+        utf8str str,
+        u8 delimiter,
+        ArraySlice<u64> output,
+        i64* count
+    );
+
+    /**
+     * Parse a list of numbers separated by `delimiter` into `output`, each one as per
+     * PNSLR_I64FromString. See PNSLR_F32ArrayFromString for details.
+     */
+    b8 I64ArrayFromString(
+        utf8str str,
+        u8 delimiter,
+        ArraySlice<i64> output,
+        i64* count
+    );
+
     // #######################################################################################
     // IO
     // #######################################################################################
@@ -1860,6 +3006,48 @@ namespace Panshilar
         DirectoryIterationVisitorDelegate visitorFunc
     );
 
+    /**
+     * Represents something found while walking a directory tree.
+     * Symbolic links are never followed, and are reported as files.
+     */
+    struct DirectoryWalkEntry
+    {
+       Path path;
+       utf8str name;
+       b8 isDirectory;
+       i32 depth;
+       i64 size;
+       i64 timestamp;
+    };
+
+    /**
+     * The signature of the delegate that's called for everything found while walking a directory tree.
+     * Return false to stop the whole walk. Set `exploreCurrentDirectory` to false to skip going into a directory.
+     */
+    typedef b8 (*DirectoryWalkVisitorDelegate)(
+        rawptr payload,
+        DirectoryWalkEntry entry,
+        b8* exploreCurrentDirectory
+    );
+
+    /**
+     * Walks through a whole directory tree, calling the visitor for everything in it.
+     * A faster alternative to recursive `PNSLR_IterateDirectory` for big trees: it opens each directory
+     * relative to its parent, only asks the filesystem about an entry when the directory listing doesn't
+     * already say what it is, and never allocates per entry.
+     * Sizes and timestamps cost an extra query per entry, so they're only filled in if asked for.
+     * With more than one worker thread (the calling thread being one of them), subdirectories are spread
+     * across them, and the visitor is called from all of them at once, in no particular order.
+     * Returns true if the walk went through to the end, false if it couldn't start or was stopped.
+     */
+    b8 WalkDirectoryTree(
+        Path path,
+        rawptr visitorPayload,
+        DirectoryWalkVisitorDelegate visitorFunc,
+        b8 querySizeAndTimestamp = { },
+        i32 numWorkerThreads = { }
+    );
+
     /**
      * Represents the type of path check to perform when checking if a path exists.
      */
@@ -1964,22 +3152,72 @@ namespace Panshilar
 
     /**
      * Reads data from an opened file at the current position.
+     * Keeps reading until the buffer is full, and is only short at the end of the file.
+     * Optionally stores the number of bytes read.
+     * Returns true if the whole buffer was filled, false otherwise.
+     */
+    b8 ReadFromFile(
+        File handle,
+        ArraySlice<u8> dst,
+        i64* readSize = { }
+    );
+
+    /**
+     * Writes data to an opened file at the current position.
+     * Keeps writing until all of it is written.
+     * Returns true on success, false on failure.
+     */
+    b8 WriteToFile(
+        File handle,
+        ArraySlice<u8> src
+    );
+
+    /**
+     * Reads data from an opened file at the given offset, without going through the current position,
+     * so multiple threads can read from the same file at once.
+     * Keeps reading until the buffer is full, and is only short at the end of the file.
      * Optionally stores the number of bytes read.
+     * Returns true if the whole buffer was filled, false otherwise.
+     */
+    b8 ReadFromFileAt(
+        File handle,
+        i64 offset,
+        ArraySlice<u8> dst,
+        i64* readSize = { }
+    );
+
+    /**
+     * Writes data to an opened file at the given offset, without going through the current position.
+     * Keeps writing until all of it is written.
      * Returns true on success, false on failure.
      */
-    b8 ReadFromFile(
+    b8 WriteToFileAt(
+        File handle,
+        i64 offset,
+        ArraySlice<u8> src
+    );
+
+    /**
+     * Reads consecutive data from an opened file at the given offset into multiple buffers
+     * (each one filled before moving onto the next), in as few calls to the OS as possible.
+     * Works the same way as `PNSLR_ReadFromFileAt` otherwise.
+     */
+    b8 ScatterReadFromFileAt(
         File handle,
-        ArraySlice<u8> dst,
+        i64 offset,
+        ArraySlice<utf8str> dsts,
         i64* readSize = { }
     );
 
     /**
-     * Writes data to an opened file at the current position.
-     * Returns true on success, false on failure.
+     * Writes multiple buffers one after the other to an opened file at the given offset,
+     * in as few calls to the OS as possible.
+     * Works the same way as `PNSLR_WriteToFileAt` otherwise.
      */
-    b8 WriteToFile(
+    b8 GatherWriteToFileAt(
         File handle,
-        ArraySlice<u8> src
+        i64 offset,
+        ArraySlice<utf8str> srcs
     );
 
     /**
@@ -2040,6 +3278,9 @@ namespace Panshilar
 
     /**
      * Copies a file from src to dst. If dst exists, it will be overwritten.
+     * Where possible, the data never goes through userspace: on linux this tries a reflink
+     * (so the copy shares its blocks with the original), then copy_file_range, then sendfile,
+     * before falling back to copying through a buffer.
      * Returns true on success, false on failure.
      */
     b8 CopyFile(
@@ -2047,6 +3288,19 @@ namespace Panshilar
         Path dst
     );
 
+    /**
+     * Copies everything inside the src directory into the dst directory (which is created if it
+     * doesn't exist), overwriting any files that are already there.
+     * The files are copied by 'numWorkerThreads' threads at once (defaults to 4), one of which is
+     * the calling thread; this returns once all of them are done.
+     * Returns true if everything was copied, false otherwise.
+     */
+    b8 CopyDirectoryTree(
+        Path src,
+        Path dst,
+        i32 numWorkerThreads = { }
+    );
+
     /**
      * Moves a file from src to dst. If dst exists, it will be overwritten.
      * Returns true on success, false on failure.
@@ -2056,6 +3310,74 @@ namespace Panshilar
         Path dst
     );
 
+    /**
+     * Represents how a memory-mapped file can be accessed.
+     * Copy-on-write mappings can be written to, but the changes are never written back to the file.
+     * Read-write mappings need a file that was opened for both reading and writing.
+     */
+    enum class FileMappingAccess : u8 /* use as value */
+    {
+        ReadOnly = 0,
+        CopyOnWrite = 1,
+        ReadWrite = 2,
+    };
+
+    /**
+     * Represents how a range of a memory-mapped file is going to be used, so the OS can
+     * read ahead (or not) accordingly.
+     */
+    enum class FileMappingHint : u8 /* use as value */
+    {
+        Normal = 0,
+        Sequential = 1,
+        Random = 2,
+        WillNeed = 3,
+        DontNeed = 4,
+    };
+
+    /**
+     * Maps 'size' bytes of an opened file, starting at 'offset', into memory; if size is 0,
+     * everything from the offset to the end of the file is mapped. The range has to be within the file,
+     * but the offset doesn't need to be aligned to anything.
+     * The file handle can be closed while the mapping is still in use.
+     * Returns an empty slice on failure.
+     */
+    ArraySlice<u8> MapFile(
+        File handle,
+        FileMappingAccess access,
+        i64 offset = { },
+        i64 size = { }
+    );
+
+    /**
+     * Tells the OS how a range of a memory-mapped file is going to be used.
+     * The range can be any part of a mapping returned by `PNSLR_MapFile`.
+     * Returns true on success, false on failure.
+     */
+    b8 AdviseFileMapping(
+        ArraySlice<u8> range,
+        FileMappingHint hint
+    );
+
+    /**
+     * Writes any changes in a range of a read-write memory-mapped file back to the file.
+     * The range can be any part of a mapping returned by `PNSLR_MapFile`.
+     * On Unix this waits for the data to reach the disk. On Windows it only starts the write-back,
+     * since the mapping doesn't keep the file handle around; use `PNSLR_FlushFile` on an open handle
+     * to the same file when the data has to be on disk.
+     * Returns true on success, false on failure.
+     */
+    b8 FlushFileMapping(
+        ArraySlice<u8> range
+    );
+
+    /**
+     * Unmaps a memory-mapped file. Has to be given exactly what `PNSLR_MapFile` returned.
+     */
+    void UnmapFile(
+        ArraySlice<u8> mapping
+    );
+
     // #######################################################################################
     // DynaLib
     // #######################################################################################
@@ -2410,6 +3732,49 @@ namespace Panshilar
         Stream stream
     );
 
+    // Compiled formats ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * A format string that has been split up ahead of time, for formats that get used
+     * over and over (log lines, etc.). The same rules as `PNSLR_FormatAndWriteToStream`
+     * apply. Create with `PNSLR_CompileFormat`, free with `PNSLR_FreeCompiledFormat`.
+     */
+    struct CompiledFormat
+    {
+       ArraySlice<utf8str> literals;
+       i64 literalsLength;
+       Allocator allocator;
+    };
+
+    /**
+     * Splits a format string into the literal runs between its placeholders.
+     * The compiled format does not refer back to 'fmtStr'.
+     * Returns a zeroed compiled format on failure.
+     */
+    CompiledFormat CompileFormat(
+        utf8str fmtStr,
+        Allocator allocator
+    );
+
+    /**
+     * Frees a compiled format, and zeroes it.
+     */
+    void FreeCompiledFormat(
+        CompiledFormat* format
+    );
+
+    /**
+     * Formats with a compiled format and writes the result to the stream, in a single
+     * write. The space needed is worked out up front, so nothing gets resized midway.
+     * A string builder stream is formatted into directly.
+     * Returns true on success, false on failure.
+     */
+    b8 FormatCompiledAndWriteToStream(
+        Stream stream,
+        CompiledFormat* format,
+        ArraySlice<PrimitiveFmtOptions> args
+    );
+
     // Stream casts ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
     /**
@@ -2426,6 +3791,25 @@ namespace Panshilar
         StringBuilder* builder
     );
 
+    /**
+     * The state of a stream over a memory-mapped file; 'access' has to match what the
+     * mapping was created with. See `PNSLR_StreamFromFileMapping`.
+     */
+    struct FileMappingStream
+    {
+       ArraySlice<u8> mapping;
+       FileMappingAccess access;
+       i64 cursorPos;
+    };
+
+    /**
+     * Creates a stream over a memory-mapped file. Reads and writes go straight to the
+     * mapped memory, and can't go past its end. Closing the stream unmaps the file.
+     */
+    Stream StreamFromFileMapping(
+        FileMappingStream* mappingStream
+    );
+
     /**
      * Creates a stream from the standard output pipe.
      */
@@ -2440,6 +3824,22 @@ namespace Panshilar
         b8 disableBuffering = { }
     );
 
+    // Allocator reports ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * Writes a report of a tracking allocator to the stream: the overall stats, then one
+     * line per call site (file:line), largest live bytes first.
+     * At most 'maxCallSites' call sites are written, or all of them if it's zero or less.
+     * 'tempAllocator' is used to merge the call sites across threads.
+     * Returns true on success, false on failure.
+     */
+    b8 WriteTrackingAllocatorReportToStream(
+        Stream stream,
+        Allocator trackingAllocator,
+        Allocator tempAllocator,
+        i32 maxCallSites = { }
+    );
+
     // #######################################################################################
     // Logger
     // #######################################################################################
@@ -2857,108 +4257,346 @@ namespace Panshilar
     };
 
     /**
-     * Represents a writer endpoint for a shared memory channel.
+     * Represents a writer endpoint for a shared memory channel.
+     */
+    struct SharedMemoryChannelWriter
+    {
+       SharedMemoryChannelHeader* header;
+       SharedMemoryChannelHandle handle;
+    };
+
+    /**
+     * Represents a reserved message slot for writing to a shared memory channel.
+     */
+    struct SharedMemoryChannelReservedMessage
+    {
+       SharedMemoryChannelWriter* channel;
+       i64 offset;
+       i64 size;
+       u8* writePtr;
+    };
+
+    /**
+     * Represents a message that has been read from a shared memory channel.
+     */
+    struct SharedMemoryChannelMessage
+    {
+       SharedMemoryChannelReader* channel;
+       i64 offset;
+       i64 size;
+       u8* readPtr;
+       i64 readSize;
+    };
+
+    // Reader Interface ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * Creates a shared memory channel reader with the specified name and size.
+     * The reader owns the shared memory segment and other processes can connect as writers.
+     */
+    b8 CreateSharedMemoryChannelReader(
+        utf8str name,
+        i64 size,
+        SharedMemoryChannelReader* reader
+    );
+
+    /**
+     * Polls for a message from the shared memory channel.
+     * Returns true if a message was found, false otherwise.
+     * Sets fatalError to true if an unrecoverable error occurred.
+     */
+    b8 ReadSharedMemoryChannelMessage(
+        SharedMemoryChannelReader* reader,
+        SharedMemoryChannelMessage* message,
+        b8* fatalError = { }
+    );
+
+    /**
+     * Acknowledges that a message has been processed and advances the read cursor.
+     */
+    b8 AcknowledgeSharedMemoryChannelMessage(
+        SharedMemoryChannelMessage* message
+    );
+
+    /**
+     * Destroys a shared memory channel reader and releases all associated resources.
+     */
+    b8 DestroySharedMemoryChannelReader(
+        SharedMemoryChannelReader* reader
+    );
+
+    // Writer Interface ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * Attempts to connect to an existing shared memory channel as a writer.
+     * Returns true if successful, false if the channel doesn't exist or connection failed.
+     */
+    b8 TryConnectSharedMemoryChannelWriter(
+        utf8str name,
+        SharedMemoryChannelWriter* writer
+    );
+
+    /**
+     * Reserves space for a message in the shared memory channel.
+     * Returns true if space was available, false otherwise.
+     */
+    b8 PrepareSharedMemoryChannelMessage(
+        SharedMemoryChannelWriter* writer,
+        i64 size,
+        SharedMemoryChannelReservedMessage* reservedMessage
+    );
+
+    /**
+     * Commits a previously reserved message to the shared memory channel.
+     */
+    b8 CommitSharedMemoryChannelMessage(
+        SharedMemoryChannelWriter* writer,
+        SharedMemoryChannelReservedMessage reservedMessage
+    );
+
+    /**
+     * Disconnects from a shared memory channel and releases writer resources.
+     */
+    b8 DisconnectSharedMemoryChannelWriter(
+        SharedMemoryChannelWriter* writer
+    );
+
+    // #######################################################################################
+    // StringInterner
+    // #######################################################################################
+
+    // String Interner ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * A table of unique strings, each one given a small handle that never changes.
+     * Two interned strings are equal exactly when their handles are, so comparing or
+     * hashing them afterwards is a single integer operation.
+     * Interning and lookups are safe to do from multiple threads at once.
+     * The handle 0 never refers to a string.
+     */
+    struct StringInterner
+    {
+       rawptr data;
+    };
+
+    /**
+     * Creates an empty string interner. All of its memory, including the copies of the
+     * interned strings, comes from the provided allocator, which has to be thread-safe
+     * if strings are going to be interned from more than one thread.
+     */
+    StringInterner CreateStringInterner(
+        Allocator allocator
+    );
+
+    /**
+     * Destroys a string interner. Every string obtained from it is invalid afterwards.
+     */
+    void DestroyStringInterner(
+        StringInterner* interner
+    );
+
+    /**
+     * Returns the handle for a string, copying it into the interner if it wasn't there already.
+     * Returns 0 if the string could not be added.
+     */
+    u32 InternString(
+        StringInterner interner,
+        utf8str str
+    );
+
+    /**
+     * Returns the handle for a string if it has already been interned, or 0 if it hasn't.
+     * Never adds anything to the interner.
+     */
+    u32 FindInternedString(
+        StringInterner interner,
+        utf8str str
+    );
+
+    /**
+     * Returns the string for a handle, or an empty string if the handle is not valid.
+     * The returned string is null-terminated, and lives as long as the interner does.
+     */
+    utf8str GetInternedString(
+        StringInterner interner,
+        u32 handle
+    );
+
+    /**
+     * Returns the number of strings in the interner.
+     */
+    i64 GetInternedStringsCount(
+        StringInterner interner
+    );
+
+    /**
+     * Writes all the strings in the interner to a file, such that loading it back
+     * gives every string the same handle it has now.
+     */
+    b8 SaveStringInternerToFile(
+        StringInterner interner,
+        Path path
+    );
+
+    /**
+     * Creates a string interner from a file written by `PNSLR_SaveStringInternerToFile`.
+     * Returns an interner with no data if the file could not be read or is not valid.
+     */
+    StringInterner LoadStringInternerFromFile(
+        Path path,
+        Allocator allocator
+    );
+
+    // #######################################################################################
+    // AsyncIO
+    // #######################################################################################
+
+    // Requests and completions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+    /**
+     * Represents what an asynchronous I/O request does.
+     */
+    enum class AsyncIOOperation : u8 /* use as value */
+    {
+        Read = 0,
+        Write = 1,
+        Flush = 2,
+    };
+
+    /**
+     * A single asynchronous read, write or flush against an opened file.
+     * Reads and writes happen at 'offset', whatever the file's cursor is at.
+     * The buffer (unused for flushes) has to stay valid until the request completes.
+     * Zero-length reads and writes succeed straight away, without touching the file.
+     * 'userData' is handed back unchanged in the request's completion.
+     */
+    struct AsyncIORequest
+    {
+       File file;
+       AsyncIOOperation operation;
+       i64 offset;
+       ArraySlice<u8> buffer;
+       u64 userData;
+    };
+
+    /**
+     * Represents how an asynchronous I/O request ended.
+     */
+    enum class AsyncIOStatus : u8 /* use as value */
+    {
+        Succeeded = 0,
+        Failed = 1,
+        Cancelled = 2,
+    };
+
+    /**
+     * The result of an asynchronous I/O request.
+     * Reads and writes are carried on until the whole buffer is done, so the
+     * number of bytes transferred is only ever short for a read that hit the end of the file.
      */
-    struct SharedMemoryChannelWriter
+    struct AsyncIOCompletion
     {
-       SharedMemoryChannelHeader* header;
-       SharedMemoryChannelHandle handle;
+       u64 userData;
+       i64 bytesTransferred;
+       AsyncIOStatus status;
     };
 
+    // Queues ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
     /**
-     * Represents a reserved message slot for writing to a shared memory channel.
+     * Represents what carries out the requests of an asynchronous I/O queue.
+     * The default is io_uring where the kernel supports it, and a pool of worker threads
+     * doing blocking positional reads and writes everywhere else.
      */
-    struct SharedMemoryChannelReservedMessage
+    enum class AsyncIOBackend : u8 /* use as value */
     {
-       SharedMemoryChannelWriter* channel;
-       i64 offset;
-       i64 size;
-       u8* writePtr;
+        Default = 0,
+        ThreadPool = 1,
+        IoUring = 2,
     };
 
     /**
-     * Represents a message that has been read from a shared memory channel.
+     * A queue of asynchronous I/O requests. A queue is meant to be used from one thread;
+     * use one queue per thread that issues requests.
      */
-    struct SharedMemoryChannelMessage
+    struct AsyncIOQueue
     {
-       SharedMemoryChannelReader* channel;
-       i64 offset;
-       i64 size;
-       u8* readPtr;
-       i64 readSize;
+       rawptr data;
     };
 
-    // Reader Interface ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-
     /**
-     * Creates a shared memory channel reader with the specified name and size.
-     * The reader owns the shared memory segment and other processes can connect as writers.
+     * Creates an asynchronous I/O queue that can have up to 'capacity' requests in flight.
+     * 'numWorkerThreads' only applies to the thread pool backend (defaults to 4).
+     * Returns a queue with no data if the backend asked for isn't available.
      */
-    b8 CreateSharedMemoryChannelReader(
-        utf8str name,
-        i64 size,
-        SharedMemoryChannelReader* reader
+    AsyncIOQueue CreateAsyncIOQueue(
+        Allocator allocator,
+        i32 capacity,
+        AsyncIOBackend backend = { },
+        i32 numWorkerThreads = { }
     );
 
     /**
-     * Polls for a message from the shared memory channel.
-     * Returns true if a message was found, false otherwise.
-     * Sets fatalError to true if an unrecoverable error occurred.
+     * Destroys an asynchronous I/O queue, after waiting for every request in flight to finish.
+     * Completions that haven't been collected are dropped.
      */
-    b8 ReadSharedMemoryChannelMessage(
-        SharedMemoryChannelReader* reader,
-        SharedMemoryChannelMessage* message,
-        b8* fatalError = { }
+    void DestroyAsyncIOQueue(
+        AsyncIOQueue* queue
     );
 
     /**
-     * Acknowledges that a message has been processed and advances the read cursor.
+     * Gets the backend an asynchronous I/O queue ended up with.
      */
-    b8 AcknowledgeSharedMemoryChannelMessage(
-        SharedMemoryChannelMessage* message
+    AsyncIOBackend GetAsyncIOQueueBackend(
+        AsyncIOQueue queue
     );
 
     /**
-     * Destroys a shared memory channel reader and releases all associated resources.
+     * Submits a batch of requests in one go.
+     * Returns how many of them (from the start of the batch) were accepted; fewer than
+     * all of them means the queue is full, and completions need to be collected first.
      */
-    b8 DestroySharedMemoryChannelReader(
-        SharedMemoryChannelReader* reader
+    i32 SubmitAsyncIORequests(
+        AsyncIOQueue queue,
+        ArraySlice<AsyncIORequest> requests
     );
 
-    // Writer Interface ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-
     /**
-     * Attempts to connect to an existing shared memory channel as a writer.
-     * Returns true if successful, false if the channel doesn't exist or connection failed.
+     * Collects finished requests without waiting.
+     * Returns how many completions were written to the output.
      */
-    b8 TryConnectSharedMemoryChannelWriter(
-        utf8str name,
-        SharedMemoryChannelWriter* writer
+    i32 PollAsyncIOCompletions(
+        AsyncIOQueue queue,
+        ArraySlice<AsyncIOCompletion> output
     );
 
     /**
-     * Reserves space for a message in the shared memory channel.
-     * Returns true if space was available, false otherwise.
+     * Collects finished requests, waiting until there are at least 'minCompletions' of them
+     * (or until nothing is in flight any more).
+     * Returns how many completions were written to the output.
      */
-    b8 PrepareSharedMemoryChannelMessage(
-        SharedMemoryChannelWriter* writer,
-        i64 size,
-        SharedMemoryChannelReservedMessage* reservedMessage
+    i32 WaitForAsyncIOCompletions(
+        AsyncIOQueue queue,
+        ArraySlice<AsyncIOCompletion> output,
+        i32 minCompletions = { }
     );
 
     /**
-     * Commits a previously reserved message to the shared memory channel.
+     * Gets the number of requests that have been submitted, but whose completions haven't been collected.
      */
-    b8 CommitSharedMemoryChannelMessage(
-        SharedMemoryChannelWriter* writer,
-        SharedMemoryChannelReservedMessage reservedMessage
+    i32 GetNumAsyncIORequestsInFlight(
+        AsyncIOQueue queue
     );
 
     /**
-     * Disconnects from a shared memory channel and releases writer resources.
+     * Asks for the in-flight requests with the given user data to be cancelled.
+     * Requests that were already being carried out may still finish normally;
+     * either way, each one still produces exactly one completion.
+     * Returns true if any matching request hadn't finished yet.
      */
-    b8 DisconnectSharedMemoryChannelWriter(
-        SharedMemoryChannelWriter* writer
+    b8 CancelAsyncIORequests(
+        AsyncIOQueue queue,
+        u64 userData
     );
 
 } // namespace end
@@ -3338,24 +4976,90 @@ void Panshilar::ResetEvent(Panshilar::Event* event)
     PNSLR_ResetEvent(PNSLR_Bindings_Convert(event));
 }
 
-extern "C" void PNSLR_MemSet(rawptr memory, i32 value, i32 size);
-void Panshilar::MemSet(rawptr memory, i32 value, i32 size)
+extern "C" i64 PNSLR_AtomicLoadI64(i64* target);
+i64 Panshilar::AtomicLoadI64(i64* target)
+{
+    i64 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AtomicLoadI64(PNSLR_Bindings_Convert(target)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_AtomicStoreI64(i64* target, i64 value);
+void Panshilar::AtomicStoreI64(i64* target, i64 value)
+{
+    PNSLR_AtomicStoreI64(PNSLR_Bindings_Convert(target), PNSLR_Bindings_Convert(value));
+}
+
+extern "C" i64 PNSLR_AtomicFetchAddI64(i64* target, i64 value);
+i64 Panshilar::AtomicFetchAddI64(i64* target, i64 value)
+{
+    i64 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AtomicFetchAddI64(PNSLR_Bindings_Convert(target), PNSLR_Bindings_Convert(value)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_AtomicCompareExchangeI64(i64* target, i64* expected, i64 desired);
+b8 Panshilar::AtomicCompareExchangeI64(i64* target, i64* expected, i64 desired)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AtomicCompareExchangeI64(PNSLR_Bindings_Convert(target), PNSLR_Bindings_Convert(expected), PNSLR_Bindings_Convert(desired)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" rawptr PNSLR_AtomicLoadPtr(rawptr* target);
+rawptr Panshilar::AtomicLoadPtr(rawptr* target)
+{
+    rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AtomicLoadPtr(PNSLR_Bindings_Convert(target)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_AtomicStorePtr(rawptr* target, rawptr value);
+void Panshilar::AtomicStorePtr(rawptr* target, rawptr value)
+{
+    PNSLR_AtomicStorePtr(PNSLR_Bindings_Convert(target), PNSLR_Bindings_Convert(value));
+}
+
+extern "C" void PNSLR_MemSet(rawptr memory, i32 value, i64 size);
+void Panshilar::MemSet(rawptr memory, i32 value, i64 size)
 {
     PNSLR_MemSet(PNSLR_Bindings_Convert(memory), PNSLR_Bindings_Convert(value), PNSLR_Bindings_Convert(size));
 }
 
-extern "C" void PNSLR_MemCopy(rawptr destination, rawptr source, i32 size);
-void Panshilar::MemCopy(rawptr destination, rawptr source, i32 size)
+extern "C" void PNSLR_MemCopy(rawptr destination, rawptr source, i64 size);
+void Panshilar::MemCopy(rawptr destination, rawptr source, i64 size)
 {
     PNSLR_MemCopy(PNSLR_Bindings_Convert(destination), PNSLR_Bindings_Convert(source), PNSLR_Bindings_Convert(size));
 }
 
-extern "C" void PNSLR_MemMove(rawptr destination, rawptr source, i32 size);
-void Panshilar::MemMove(rawptr destination, rawptr source, i32 size)
+extern "C" void PNSLR_MemMove(rawptr destination, rawptr source, i64 size);
+void Panshilar::MemMove(rawptr destination, rawptr source, i64 size)
 {
     PNSLR_MemMove(PNSLR_Bindings_Convert(destination), PNSLR_Bindings_Convert(source), PNSLR_Bindings_Convert(size));
 }
 
+extern "C" i32 PNSLR_GetVirtualMemoryPageSize();
+i32 Panshilar::GetVirtualMemoryPageSize()
+{
+    i32 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GetVirtualMemoryPageSize(); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" rawptr PNSLR_ReserveVirtualMemory(i64 size);
+rawptr Panshilar::ReserveVirtualMemory(i64 size)
+{
+    rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_ReserveVirtualMemory(PNSLR_Bindings_Convert(size)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_CommitVirtualMemory(rawptr memory, i64 size);
+b8 Panshilar::CommitVirtualMemory(rawptr memory, i64 size)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_CommitVirtualMemory(PNSLR_Bindings_Convert(memory), PNSLR_Bindings_Convert(size)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_DecommitVirtualMemory(rawptr memory, i64 size);
+b8 Panshilar::DecommitVirtualMemory(rawptr memory, i64 size)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_DecommitVirtualMemory(PNSLR_Bindings_Convert(memory), PNSLR_Bindings_Convert(size)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_ReleaseVirtualMemory(rawptr memory, i64 size);
+b8 Panshilar::ReleaseVirtualMemory(rawptr memory, i64 size)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_ReleaseVirtualMemory(PNSLR_Bindings_Convert(memory), PNSLR_Bindings_Convert(size)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
 enum class PNSLR_AllocatorMode : u8 { };
 static_assert(sizeof(PNSLR_AllocatorMode) == sizeof(Panshilar::AllocatorMode), "size mismatch");
 static_assert(alignof(PNSLR_AllocatorMode) == alignof(Panshilar::AllocatorMode), "align mismatch");
@@ -3380,7 +5084,7 @@ Panshilar::AllocatorError* PNSLR_Bindings_Convert(PNSLR_AllocatorError* x) { ret
 PNSLR_AllocatorError& PNSLR_Bindings_Convert(Panshilar::AllocatorError& x) { return *PNSLR_Bindings_Convert(&x); }
 Panshilar::AllocatorError& PNSLR_Bindings_Convert(PNSLR_AllocatorError& x) { return *PNSLR_Bindings_Convert(&x); }
 
-extern "C" typedef rawptr (*PNSLR_AllocatorProcedure)(rawptr allocatorData, PNSLR_AllocatorMode mode, i32 size, i32 alignment, rawptr oldMemory, i32 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+extern "C" typedef rawptr (*PNSLR_AllocatorProcedure)(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
 static_assert(sizeof(PNSLR_AllocatorProcedure) == sizeof(Panshilar::AllocatorProcedure), "size mismatch");
 static_assert(alignof(PNSLR_AllocatorProcedure) == alignof(Panshilar::AllocatorProcedure), "align mismatch");
 PNSLR_AllocatorProcedure* PNSLR_Bindings_Convert(Panshilar::AllocatorProcedure* x) { return reinterpret_cast<PNSLR_AllocatorProcedure*>(x); }
@@ -3412,20 +5116,20 @@ ArraySlice<Panshilar::Allocator>& PNSLR_Bindings_Convert(PNSLR_ArraySlice_PNSLR_
 static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ArraySlice_PNSLR_Allocator, count) == PNSLR_STRUCT_OFFSET(ArraySlice<Panshilar::Allocator>, count), "count offset mismatch");
 static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ArraySlice_PNSLR_Allocator, data) == PNSLR_STRUCT_OFFSET(ArraySlice<Panshilar::Allocator>, data), "data offset mismatch");
 
-extern "C" rawptr PNSLR_Allocate(PNSLR_Allocator allocator, b8 zeroed, i32 size, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
-rawptr Panshilar::Allocate(Panshilar::Allocator allocator, b8 zeroed, i32 size, i32 alignment, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+extern "C" rawptr PNSLR_Allocate(PNSLR_Allocator allocator, b8 zeroed, i64 size, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+rawptr Panshilar::Allocate(Panshilar::Allocator allocator, b8 zeroed, i64 size, i32 alignment, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
 {
     rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_Allocate(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(zeroed), PNSLR_Bindings_Convert(size), PNSLR_Bindings_Convert(alignment), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
 
-extern "C" rawptr PNSLR_Resize(PNSLR_Allocator allocator, b8 zeroed, rawptr oldMemory, i32 oldSize, i32 newSize, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
-rawptr Panshilar::Resize(Panshilar::Allocator allocator, b8 zeroed, rawptr oldMemory, i32 oldSize, i32 newSize, i32 alignment, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+extern "C" rawptr PNSLR_Resize(PNSLR_Allocator allocator, b8 zeroed, rawptr oldMemory, i64 oldSize, i64 newSize, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+rawptr Panshilar::Resize(Panshilar::Allocator allocator, b8 zeroed, rawptr oldMemory, i64 oldSize, i64 newSize, i32 alignment, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
 {
     rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_Resize(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(zeroed), PNSLR_Bindings_Convert(oldMemory), PNSLR_Bindings_Convert(oldSize), PNSLR_Bindings_Convert(newSize), PNSLR_Bindings_Convert(alignment), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
 
-extern "C" rawptr PNSLR_DefaultResize(PNSLR_Allocator allocator, b8 zeroed, rawptr oldMemory, i32 oldSize, i32 newSize, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
-rawptr Panshilar::DefaultResize(Panshilar::Allocator allocator, b8 zeroed, rawptr oldMemory, i32 oldSize, i32 newSize, i32 alignment, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+extern "C" rawptr PNSLR_DefaultResize(PNSLR_Allocator allocator, b8 zeroed, rawptr oldMemory, i64 oldSize, i64 newSize, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+rawptr Panshilar::DefaultResize(Panshilar::Allocator allocator, b8 zeroed, rawptr oldMemory, i64 oldSize, i64 newSize, i32 alignment, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
 {
     rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_DefaultResize(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(zeroed), PNSLR_Bindings_Convert(oldMemory), PNSLR_Bindings_Convert(oldSize), PNSLR_Bindings_Convert(newSize), PNSLR_Bindings_Convert(alignment), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
@@ -3460,19 +5164,37 @@ Panshilar::Allocator Panshilar::GetAllocator_DefaultHeap()
     PNSLR_Allocator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GetAllocator_DefaultHeap(); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
 
-extern "C" rawptr PNSLR_AllocatorFn_DefaultHeap(rawptr allocatorData, PNSLR_AllocatorMode mode, i32 size, i32 alignment, rawptr oldMemory, i32 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
-rawptr Panshilar::AllocatorFn_DefaultHeap(rawptr allocatorData, Panshilar::AllocatorMode mode, i32 size, i32 alignment, rawptr oldMemory, i32 oldSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+extern "C" rawptr PNSLR_AllocatorFn_DefaultHeap(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+rawptr Panshilar::AllocatorFn_DefaultHeap(rawptr allocatorData, Panshilar::AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
 {
     rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AllocatorFn_DefaultHeap(PNSLR_Bindings_Convert(allocatorData), PNSLR_Bindings_Convert(mode), PNSLR_Bindings_Convert(size), PNSLR_Bindings_Convert(alignment), PNSLR_Bindings_Convert(oldMemory), PNSLR_Bindings_Convert(oldSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
 
+extern "C" PNSLR_Allocator PNSLR_GetAllocator_ThreadCachingHeap();
+Panshilar::Allocator Panshilar::GetAllocator_ThreadCachingHeap()
+{
+    PNSLR_Allocator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GetAllocator_ThreadCachingHeap(); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" rawptr PNSLR_AllocatorFn_ThreadCachingHeap(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+rawptr Panshilar::AllocatorFn_ThreadCachingHeap(rawptr allocatorData, Panshilar::AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AllocatorFn_ThreadCachingHeap(PNSLR_Bindings_Convert(allocatorData), PNSLR_Bindings_Convert(mode), PNSLR_Bindings_Convert(size), PNSLR_Bindings_Convert(alignment), PNSLR_Bindings_Convert(oldMemory), PNSLR_Bindings_Convert(oldSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_FlushThreadCachingHeapCache();
+void Panshilar::FlushThreadCachingHeapCache()
+{
+    PNSLR_FlushThreadCachingHeapCache();
+}
+
 struct PNSLR_ArenaAllocatorBlock
 {
    PNSLR_ArenaAllocatorBlock* previous;
    PNSLR_Allocator allocator;
    rawptr memory;
-   u32 capacity;
-   u32 used;
+   u64 capacity;
+   u64 used;
 };
 static_assert(sizeof(PNSLR_ArenaAllocatorBlock) == sizeof(Panshilar::ArenaAllocatorBlock), "size mismatch");
 static_assert(alignof(PNSLR_ArenaAllocatorBlock) == alignof(Panshilar::ArenaAllocatorBlock), "align mismatch");
@@ -3490,9 +5212,9 @@ struct PNSLR_ArenaAllocatorPayload
 {
    PNSLR_Allocator backingAllocator;
    PNSLR_ArenaAllocatorBlock* currentBlock;
-   u32 totalUsed;
-   u32 totalCapacity;
-   u32 minimumBlockSize;
+   u64 totalUsed;
+   u64 totalCapacity;
+   u64 minimumBlockSize;
    u32 numSnapshots;
 };
 static_assert(sizeof(PNSLR_ArenaAllocatorPayload) == sizeof(Panshilar::ArenaAllocatorPayload), "size mismatch");
@@ -3508,8 +5230,8 @@ static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ArenaAllocatorPayload, totalCapacity) ==
 static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ArenaAllocatorPayload, minimumBlockSize) == PNSLR_STRUCT_OFFSET(Panshilar::ArenaAllocatorPayload, minimumBlockSize), "minimumBlockSize offset mismatch");
 static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ArenaAllocatorPayload, numSnapshots) == PNSLR_STRUCT_OFFSET(Panshilar::ArenaAllocatorPayload, numSnapshots), "numSnapshots offset mismatch");
 
-extern "C" PNSLR_Allocator PNSLR_NewAllocator_Arena(PNSLR_Allocator backingAllocator, u32 pageSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
-Panshilar::Allocator Panshilar::NewAllocator_Arena(Panshilar::Allocator backingAllocator, u32 pageSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+extern "C" PNSLR_Allocator PNSLR_NewAllocator_Arena(PNSLR_Allocator backingAllocator, u64 pageSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+Panshilar::Allocator Panshilar::NewAllocator_Arena(Panshilar::Allocator backingAllocator, u64 pageSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
 {
     PNSLR_Allocator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_NewAllocator_Arena(PNSLR_Bindings_Convert(backingAllocator), PNSLR_Bindings_Convert(pageSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
@@ -3520,8 +5242,8 @@ void Panshilar::DestroyAllocator_Arena(Panshilar::Allocator allocator, Panshilar
     PNSLR_DestroyAllocator_Arena(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error));
 }
 
-extern "C" rawptr PNSLR_AllocatorFn_Arena(rawptr allocatorData, PNSLR_AllocatorMode mode, i32 size, i32 alignment, rawptr oldMemory, i32 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
-rawptr Panshilar::AllocatorFn_Arena(rawptr allocatorData, Panshilar::AllocatorMode mode, i32 size, i32 alignment, rawptr oldMemory, i32 oldSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+extern "C" rawptr PNSLR_AllocatorFn_Arena(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+rawptr Panshilar::AllocatorFn_Arena(rawptr allocatorData, Panshilar::AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
 {
     rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AllocatorFn_Arena(PNSLR_Bindings_Convert(allocatorData), PNSLR_Bindings_Convert(mode), PNSLR_Bindings_Convert(size), PNSLR_Bindings_Convert(alignment), PNSLR_Bindings_Convert(oldMemory), PNSLR_Bindings_Convert(oldSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
@@ -3539,7 +5261,7 @@ struct PNSLR_ArenaAllocatorSnapshot
    b8 valid;
    PNSLR_ArenaAllocatorPayload* payload;
    PNSLR_ArenaAllocatorBlock* block;
-   u32 used;
+   u64 used;
 };
 static_assert(sizeof(PNSLR_ArenaAllocatorSnapshot) == sizeof(Panshilar::ArenaAllocatorSnapshot), "size mismatch");
 static_assert(alignof(PNSLR_ArenaAllocatorSnapshot) == alignof(Panshilar::ArenaAllocatorSnapshot), "align mismatch");
@@ -3576,6 +5298,262 @@ Panshilar::ArenaSnapshotError Panshilar::DiscardArenaAllocatorSnapshot(Panshilar
     PNSLR_ArenaSnapshotError zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_DiscardArenaAllocatorSnapshot(PNSLR_Bindings_Convert(snapshot)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
 
+struct PNSLR_VirtualArenaAllocatorPayload
+{
+   u8* memory;
+   i64 reserved;
+   i64 committed;
+   i64 used;
+   i32 pageSize;
+   u32 numSnapshots;
+};
+static_assert(sizeof(PNSLR_VirtualArenaAllocatorPayload) == sizeof(Panshilar::VirtualArenaAllocatorPayload), "size mismatch");
+static_assert(alignof(PNSLR_VirtualArenaAllocatorPayload) == alignof(Panshilar::VirtualArenaAllocatorPayload), "align mismatch");
+PNSLR_VirtualArenaAllocatorPayload* PNSLR_Bindings_Convert(Panshilar::VirtualArenaAllocatorPayload* x) { return reinterpret_cast<PNSLR_VirtualArenaAllocatorPayload*>(x); }
+Panshilar::VirtualArenaAllocatorPayload* PNSLR_Bindings_Convert(PNSLR_VirtualArenaAllocatorPayload* x) { return reinterpret_cast<Panshilar::VirtualArenaAllocatorPayload*>(x); }
+PNSLR_VirtualArenaAllocatorPayload& PNSLR_Bindings_Convert(Panshilar::VirtualArenaAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::VirtualArenaAllocatorPayload& PNSLR_Bindings_Convert(PNSLR_VirtualArenaAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_VirtualArenaAllocatorPayload, memory) == PNSLR_STRUCT_OFFSET(Panshilar::VirtualArenaAllocatorPayload, memory), "memory offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_VirtualArenaAllocatorPayload, reserved) == PNSLR_STRUCT_OFFSET(Panshilar::VirtualArenaAllocatorPayload, reserved), "reserved offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_VirtualArenaAllocatorPayload, committed) == PNSLR_STRUCT_OFFSET(Panshilar::VirtualArenaAllocatorPayload, committed), "committed offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_VirtualArenaAllocatorPayload, used) == PNSLR_STRUCT_OFFSET(Panshilar::VirtualArenaAllocatorPayload, used), "used offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_VirtualArenaAllocatorPayload, pageSize) == PNSLR_STRUCT_OFFSET(Panshilar::VirtualArenaAllocatorPayload, pageSize), "pageSize offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_VirtualArenaAllocatorPayload, numSnapshots) == PNSLR_STRUCT_OFFSET(Panshilar::VirtualArenaAllocatorPayload, numSnapshots), "numSnapshots offset mismatch");
+
+extern "C" PNSLR_Allocator PNSLR_NewAllocator_VirtualArena(i64 reserveSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+Panshilar::Allocator Panshilar::NewAllocator_VirtualArena(i64 reserveSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    PNSLR_Allocator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_NewAllocator_VirtualArena(PNSLR_Bindings_Convert(reserveSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_DestroyAllocator_VirtualArena(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+void Panshilar::DestroyAllocator_VirtualArena(Panshilar::Allocator allocator, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    PNSLR_DestroyAllocator_VirtualArena(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error));
+}
+
+extern "C" rawptr PNSLR_AllocatorFn_VirtualArena(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+rawptr Panshilar::AllocatorFn_VirtualArena(rawptr allocatorData, Panshilar::AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AllocatorFn_VirtualArena(PNSLR_Bindings_Convert(allocatorData), PNSLR_Bindings_Convert(mode), PNSLR_Bindings_Convert(size), PNSLR_Bindings_Convert(alignment), PNSLR_Bindings_Convert(oldMemory), PNSLR_Bindings_Convert(oldSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+struct PNSLR_VirtualArenaAllocatorSnapshot
+{
+   b8 valid;
+   PNSLR_VirtualArenaAllocatorPayload* payload;
+   i64 used;
+};
+static_assert(sizeof(PNSLR_VirtualArenaAllocatorSnapshot) == sizeof(Panshilar::VirtualArenaAllocatorSnapshot), "size mismatch");
+static_assert(alignof(PNSLR_VirtualArenaAllocatorSnapshot) == alignof(Panshilar::VirtualArenaAllocatorSnapshot), "align mismatch");
+PNSLR_VirtualArenaAllocatorSnapshot* PNSLR_Bindings_Convert(Panshilar::VirtualArenaAllocatorSnapshot* x) { return reinterpret_cast<PNSLR_VirtualArenaAllocatorSnapshot*>(x); }
+Panshilar::VirtualArenaAllocatorSnapshot* PNSLR_Bindings_Convert(PNSLR_VirtualArenaAllocatorSnapshot* x) { return reinterpret_cast<Panshilar::VirtualArenaAllocatorSnapshot*>(x); }
+PNSLR_VirtualArenaAllocatorSnapshot& PNSLR_Bindings_Convert(Panshilar::VirtualArenaAllocatorSnapshot& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::VirtualArenaAllocatorSnapshot& PNSLR_Bindings_Convert(PNSLR_VirtualArenaAllocatorSnapshot& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_VirtualArenaAllocatorSnapshot, valid) == PNSLR_STRUCT_OFFSET(Panshilar::VirtualArenaAllocatorSnapshot, valid), "valid offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_VirtualArenaAllocatorSnapshot, payload) == PNSLR_STRUCT_OFFSET(Panshilar::VirtualArenaAllocatorSnapshot, payload), "payload offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_VirtualArenaAllocatorSnapshot, used) == PNSLR_STRUCT_OFFSET(Panshilar::VirtualArenaAllocatorSnapshot, used), "used offset mismatch");
+
+extern "C" b8 PNSLR_ValidateVirtualArenaAllocatorSnapshotState(PNSLR_Allocator allocator);
+b8 Panshilar::ValidateVirtualArenaAllocatorSnapshotState(Panshilar::Allocator allocator)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_ValidateVirtualArenaAllocatorSnapshotState(PNSLR_Bindings_Convert(allocator)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_VirtualArenaAllocatorSnapshot PNSLR_CaptureVirtualArenaAllocatorSnapshot(PNSLR_Allocator allocator);
+Panshilar::VirtualArenaAllocatorSnapshot Panshilar::CaptureVirtualArenaAllocatorSnapshot(Panshilar::Allocator allocator)
+{
+    PNSLR_VirtualArenaAllocatorSnapshot zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_CaptureVirtualArenaAllocatorSnapshot(PNSLR_Bindings_Convert(allocator)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_ArenaSnapshotError PNSLR_RestoreVirtualArenaAllocatorSnapshot(PNSLR_VirtualArenaAllocatorSnapshot* snapshot, PNSLR_SourceCodeLocation loc);
+Panshilar::ArenaSnapshotError Panshilar::RestoreVirtualArenaAllocatorSnapshot(Panshilar::VirtualArenaAllocatorSnapshot* snapshot, Panshilar::SourceCodeLocation loc)
+{
+    PNSLR_ArenaSnapshotError zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_RestoreVirtualArenaAllocatorSnapshot(PNSLR_Bindings_Convert(snapshot), PNSLR_Bindings_Convert(loc)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_ArenaSnapshotError PNSLR_DiscardVirtualArenaAllocatorSnapshot(PNSLR_VirtualArenaAllocatorSnapshot* snapshot);
+Panshilar::ArenaSnapshotError Panshilar::DiscardVirtualArenaAllocatorSnapshot(Panshilar::VirtualArenaAllocatorSnapshot* snapshot)
+{
+    PNSLR_ArenaSnapshotError zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_DiscardVirtualArenaAllocatorSnapshot(PNSLR_Bindings_Convert(snapshot)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+struct PNSLR_ConcurrentArenaAllocatorBlock
+{
+   PNSLR_ConcurrentArenaAllocatorBlock* previous;
+   u8* memory;
+   i64 capacity;
+   i64 used;
+};
+static_assert(sizeof(PNSLR_ConcurrentArenaAllocatorBlock) == sizeof(Panshilar::ConcurrentArenaAllocatorBlock), "size mismatch");
+static_assert(alignof(PNSLR_ConcurrentArenaAllocatorBlock) == alignof(Panshilar::ConcurrentArenaAllocatorBlock), "align mismatch");
+PNSLR_ConcurrentArenaAllocatorBlock* PNSLR_Bindings_Convert(Panshilar::ConcurrentArenaAllocatorBlock* x) { return reinterpret_cast<PNSLR_ConcurrentArenaAllocatorBlock*>(x); }
+Panshilar::ConcurrentArenaAllocatorBlock* PNSLR_Bindings_Convert(PNSLR_ConcurrentArenaAllocatorBlock* x) { return reinterpret_cast<Panshilar::ConcurrentArenaAllocatorBlock*>(x); }
+PNSLR_ConcurrentArenaAllocatorBlock& PNSLR_Bindings_Convert(Panshilar::ConcurrentArenaAllocatorBlock& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::ConcurrentArenaAllocatorBlock& PNSLR_Bindings_Convert(PNSLR_ConcurrentArenaAllocatorBlock& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ConcurrentArenaAllocatorBlock, previous) == PNSLR_STRUCT_OFFSET(Panshilar::ConcurrentArenaAllocatorBlock, previous), "previous offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ConcurrentArenaAllocatorBlock, memory) == PNSLR_STRUCT_OFFSET(Panshilar::ConcurrentArenaAllocatorBlock, memory), "memory offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ConcurrentArenaAllocatorBlock, capacity) == PNSLR_STRUCT_OFFSET(Panshilar::ConcurrentArenaAllocatorBlock, capacity), "capacity offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ConcurrentArenaAllocatorBlock, used) == PNSLR_STRUCT_OFFSET(Panshilar::ConcurrentArenaAllocatorBlock, used), "used offset mismatch");
+
+struct PNSLR_ConcurrentArenaAllocatorPayload
+{
+   PNSLR_Allocator backingAllocator;
+   PNSLR_Mutex growthMutex;
+   PNSLR_ConcurrentArenaAllocatorBlock* currentBlock;
+   i64 minimumBlockSize;
+   i64 leaseSize;
+   i64 totalCapacity;
+   i64 id;
+   i64 generation;
+};
+static_assert(sizeof(PNSLR_ConcurrentArenaAllocatorPayload) == sizeof(Panshilar::ConcurrentArenaAllocatorPayload), "size mismatch");
+static_assert(alignof(PNSLR_ConcurrentArenaAllocatorPayload) == alignof(Panshilar::ConcurrentArenaAllocatorPayload), "align mismatch");
+PNSLR_ConcurrentArenaAllocatorPayload* PNSLR_Bindings_Convert(Panshilar::ConcurrentArenaAllocatorPayload* x) { return reinterpret_cast<PNSLR_ConcurrentArenaAllocatorPayload*>(x); }
+Panshilar::ConcurrentArenaAllocatorPayload* PNSLR_Bindings_Convert(PNSLR_ConcurrentArenaAllocatorPayload* x) { return reinterpret_cast<Panshilar::ConcurrentArenaAllocatorPayload*>(x); }
+PNSLR_ConcurrentArenaAllocatorPayload& PNSLR_Bindings_Convert(Panshilar::ConcurrentArenaAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::ConcurrentArenaAllocatorPayload& PNSLR_Bindings_Convert(PNSLR_ConcurrentArenaAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ConcurrentArenaAllocatorPayload, backingAllocator) == PNSLR_STRUCT_OFFSET(Panshilar::ConcurrentArenaAllocatorPayload, backingAllocator), "backingAllocator offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ConcurrentArenaAllocatorPayload, growthMutex) == PNSLR_STRUCT_OFFSET(Panshilar::ConcurrentArenaAllocatorPayload, growthMutex), "growthMutex offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ConcurrentArenaAllocatorPayload, currentBlock) == PNSLR_STRUCT_OFFSET(Panshilar::ConcurrentArenaAllocatorPayload, currentBlock), "currentBlock offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ConcurrentArenaAllocatorPayload, minimumBlockSize) == PNSLR_STRUCT_OFFSET(Panshilar::ConcurrentArenaAllocatorPayload, minimumBlockSize), "minimumBlockSize offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ConcurrentArenaAllocatorPayload, leaseSize) == PNSLR_STRUCT_OFFSET(Panshilar::ConcurrentArenaAllocatorPayload, leaseSize), "leaseSize offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ConcurrentArenaAllocatorPayload, totalCapacity) == PNSLR_STRUCT_OFFSET(Panshilar::ConcurrentArenaAllocatorPayload, totalCapacity), "totalCapacity offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ConcurrentArenaAllocatorPayload, id) == PNSLR_STRUCT_OFFSET(Panshilar::ConcurrentArenaAllocatorPayload, id), "id offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ConcurrentArenaAllocatorPayload, generation) == PNSLR_STRUCT_OFFSET(Panshilar::ConcurrentArenaAllocatorPayload, generation), "generation offset mismatch");
+
+extern "C" PNSLR_Allocator PNSLR_NewAllocator_ConcurrentArena(PNSLR_Allocator backingAllocator, i64 blockSize, i32 leaseSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+Panshilar::Allocator Panshilar::NewAllocator_ConcurrentArena(Panshilar::Allocator backingAllocator, i64 blockSize, i32 leaseSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    PNSLR_Allocator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_NewAllocator_ConcurrentArena(PNSLR_Bindings_Convert(backingAllocator), PNSLR_Bindings_Convert(blockSize), PNSLR_Bindings_Convert(leaseSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_DestroyAllocator_ConcurrentArena(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+void Panshilar::DestroyAllocator_ConcurrentArena(Panshilar::Allocator allocator, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    PNSLR_DestroyAllocator_ConcurrentArena(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error));
+}
+
+extern "C" rawptr PNSLR_AllocatorFn_ConcurrentArena(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+rawptr Panshilar::AllocatorFn_ConcurrentArena(rawptr allocatorData, Panshilar::AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AllocatorFn_ConcurrentArena(PNSLR_Bindings_Convert(allocatorData), PNSLR_Bindings_Convert(mode), PNSLR_Bindings_Convert(size), PNSLR_Bindings_Convert(alignment), PNSLR_Bindings_Convert(oldMemory), PNSLR_Bindings_Convert(oldSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+struct PNSLR_FrameAllocatorBlock
+{
+   PNSLR_FrameAllocatorBlock* next;
+   u8* memory;
+   i64 capacity;
+   i64 used;
+};
+static_assert(sizeof(PNSLR_FrameAllocatorBlock) == sizeof(Panshilar::FrameAllocatorBlock), "size mismatch");
+static_assert(alignof(PNSLR_FrameAllocatorBlock) == alignof(Panshilar::FrameAllocatorBlock), "align mismatch");
+PNSLR_FrameAllocatorBlock* PNSLR_Bindings_Convert(Panshilar::FrameAllocatorBlock* x) { return reinterpret_cast<PNSLR_FrameAllocatorBlock*>(x); }
+Panshilar::FrameAllocatorBlock* PNSLR_Bindings_Convert(PNSLR_FrameAllocatorBlock* x) { return reinterpret_cast<Panshilar::FrameAllocatorBlock*>(x); }
+PNSLR_FrameAllocatorBlock& PNSLR_Bindings_Convert(Panshilar::FrameAllocatorBlock& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::FrameAllocatorBlock& PNSLR_Bindings_Convert(PNSLR_FrameAllocatorBlock& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorBlock, next) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorBlock, next), "next offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorBlock, memory) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorBlock, memory), "memory offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorBlock, capacity) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorBlock, capacity), "capacity offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorBlock, used) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorBlock, used), "used offset mismatch");
+
+struct PNSLR_FrameAllocatorFrame
+{
+   PNSLR_FrameAllocatorBlock* firstBlock;
+   PNSLR_FrameAllocatorBlock* currentBlock;
+   i64 used;
+   i64 capacity;
+   i64 highWaterMark;
+};
+static_assert(sizeof(PNSLR_FrameAllocatorFrame) == sizeof(Panshilar::FrameAllocatorFrame), "size mismatch");
+static_assert(alignof(PNSLR_FrameAllocatorFrame) == alignof(Panshilar::FrameAllocatorFrame), "align mismatch");
+PNSLR_FrameAllocatorFrame* PNSLR_Bindings_Convert(Panshilar::FrameAllocatorFrame* x) { return reinterpret_cast<PNSLR_FrameAllocatorFrame*>(x); }
+Panshilar::FrameAllocatorFrame* PNSLR_Bindings_Convert(PNSLR_FrameAllocatorFrame* x) { return reinterpret_cast<Panshilar::FrameAllocatorFrame*>(x); }
+PNSLR_FrameAllocatorFrame& PNSLR_Bindings_Convert(Panshilar::FrameAllocatorFrame& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::FrameAllocatorFrame& PNSLR_Bindings_Convert(PNSLR_FrameAllocatorFrame& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorFrame, firstBlock) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorFrame, firstBlock), "firstBlock offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorFrame, currentBlock) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorFrame, currentBlock), "currentBlock offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorFrame, used) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorFrame, used), "used offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorFrame, capacity) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorFrame, capacity), "capacity offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorFrame, highWaterMark) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorFrame, highWaterMark), "highWaterMark offset mismatch");
+
+struct PNSLR_FrameAllocatorPayload
+{
+   PNSLR_Allocator backingAllocator;
+   PNSLR_FrameAllocatorFrame frames[8];
+   i64 minimumBlockSize;
+   i64 peakHighWaterMark;
+   u64 frameIndex;
+   i32 numFrames;
+   i32 currentFrame;
+};
+static_assert(sizeof(PNSLR_FrameAllocatorPayload) == sizeof(Panshilar::FrameAllocatorPayload), "size mismatch");
+static_assert(alignof(PNSLR_FrameAllocatorPayload) == alignof(Panshilar::FrameAllocatorPayload), "align mismatch");
+PNSLR_FrameAllocatorPayload* PNSLR_Bindings_Convert(Panshilar::FrameAllocatorPayload* x) { return reinterpret_cast<PNSLR_FrameAllocatorPayload*>(x); }
+Panshilar::FrameAllocatorPayload* PNSLR_Bindings_Convert(PNSLR_FrameAllocatorPayload* x) { return reinterpret_cast<Panshilar::FrameAllocatorPayload*>(x); }
+PNSLR_FrameAllocatorPayload& PNSLR_Bindings_Convert(Panshilar::FrameAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::FrameAllocatorPayload& PNSLR_Bindings_Convert(PNSLR_FrameAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorPayload, backingAllocator) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorPayload, backingAllocator), "backingAllocator offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorPayload, frames) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorPayload, frames), "frames offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorPayload, minimumBlockSize) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorPayload, minimumBlockSize), "minimumBlockSize offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorPayload, peakHighWaterMark) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorPayload, peakHighWaterMark), "peakHighWaterMark offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorPayload, frameIndex) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorPayload, frameIndex), "frameIndex offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorPayload, numFrames) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorPayload, numFrames), "numFrames offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorPayload, currentFrame) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorPayload, currentFrame), "currentFrame offset mismatch");
+
+struct PNSLR_FrameAllocatorStats
+{
+   u64 frameIndex;
+   i64 usedBytes;
+   i64 lastHighWaterMark;
+   i64 peakHighWaterMark;
+   i64 totalCapacity;
+   i32 numFrames;
+};
+static_assert(sizeof(PNSLR_FrameAllocatorStats) == sizeof(Panshilar::FrameAllocatorStats), "size mismatch");
+static_assert(alignof(PNSLR_FrameAllocatorStats) == alignof(Panshilar::FrameAllocatorStats), "align mismatch");
+PNSLR_FrameAllocatorStats* PNSLR_Bindings_Convert(Panshilar::FrameAllocatorStats* x) { return reinterpret_cast<PNSLR_FrameAllocatorStats*>(x); }
+Panshilar::FrameAllocatorStats* PNSLR_Bindings_Convert(PNSLR_FrameAllocatorStats* x) { return reinterpret_cast<Panshilar::FrameAllocatorStats*>(x); }
+PNSLR_FrameAllocatorStats& PNSLR_Bindings_Convert(Panshilar::FrameAllocatorStats& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::FrameAllocatorStats& PNSLR_Bindings_Convert(PNSLR_FrameAllocatorStats& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorStats, frameIndex) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorStats, frameIndex), "frameIndex offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorStats, usedBytes) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorStats, usedBytes), "usedBytes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorStats, lastHighWaterMark) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorStats, lastHighWaterMark), "lastHighWaterMark offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorStats, peakHighWaterMark) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorStats, peakHighWaterMark), "peakHighWaterMark offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorStats, totalCapacity) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorStats, totalCapacity), "totalCapacity offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FrameAllocatorStats, numFrames) == PNSLR_STRUCT_OFFSET(Panshilar::FrameAllocatorStats, numFrames), "numFrames offset mismatch");
+
+extern "C" PNSLR_Allocator PNSLR_NewAllocator_Frame(PNSLR_Allocator backingAllocator, i32 numFrames, i64 blockSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+Panshilar::Allocator Panshilar::NewAllocator_Frame(Panshilar::Allocator backingAllocator, i32 numFrames, i64 blockSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    PNSLR_Allocator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_NewAllocator_Frame(PNSLR_Bindings_Convert(backingAllocator), PNSLR_Bindings_Convert(numFrames), PNSLR_Bindings_Convert(blockSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_DestroyAllocator_Frame(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+void Panshilar::DestroyAllocator_Frame(Panshilar::Allocator allocator, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    PNSLR_DestroyAllocator_Frame(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error));
+}
+
+extern "C" rawptr PNSLR_AllocatorFn_Frame(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+rawptr Panshilar::AllocatorFn_Frame(rawptr allocatorData, Panshilar::AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AllocatorFn_Frame(PNSLR_Bindings_Convert(allocatorData), PNSLR_Bindings_Convert(mode), PNSLR_Bindings_Convert(size), PNSLR_Bindings_Convert(alignment), PNSLR_Bindings_Convert(oldMemory), PNSLR_Bindings_Convert(oldSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" i64 PNSLR_AdvanceFrameAllocator(PNSLR_Allocator allocator);
+i64 Panshilar::AdvanceFrameAllocator(Panshilar::Allocator allocator)
+{
+    i64 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AdvanceFrameAllocator(PNSLR_Bindings_Convert(allocator)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_FrameAllocatorStats PNSLR_GetFrameAllocatorStats(PNSLR_Allocator allocator);
+Panshilar::FrameAllocatorStats Panshilar::GetFrameAllocatorStats(Panshilar::Allocator allocator)
+{
+    PNSLR_FrameAllocatorStats zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GetFrameAllocatorStats(PNSLR_Bindings_Convert(allocator)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
 struct alignas(8) PNSLR_StackAllocatorPage
 {
    PNSLR_StackAllocatorPage* previousPage;
@@ -3595,7 +5573,7 @@ static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StackAllocatorPage, buffer) == PNSLR_STR
 struct PNSLR_StackAllocationHeader
 {
    PNSLR_StackAllocatorPage* page;
-   i32 size;
+   i64 size;
    i32 alignment;
    rawptr lastAllocation;
    rawptr lastAllocationHeader;
@@ -3612,40 +5590,514 @@ static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StackAllocationHeader, alignment) == PNS
 static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StackAllocationHeader, lastAllocation) == PNSLR_STRUCT_OFFSET(Panshilar::StackAllocationHeader, lastAllocation), "lastAllocation offset mismatch");
 static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StackAllocationHeader, lastAllocationHeader) == PNSLR_STRUCT_OFFSET(Panshilar::StackAllocationHeader, lastAllocationHeader), "lastAllocationHeader offset mismatch");
 
-struct PNSLR_StackAllocatorPayload
+struct PNSLR_StackAllocatorPayload
+{
+   PNSLR_Allocator backingAllocator;
+   PNSLR_StackAllocatorPage* currentPage;
+   rawptr lastAllocation;
+   PNSLR_StackAllocationHeader* lastAllocationHeader;
+};
+static_assert(sizeof(PNSLR_StackAllocatorPayload) == sizeof(Panshilar::StackAllocatorPayload), "size mismatch");
+static_assert(alignof(PNSLR_StackAllocatorPayload) == alignof(Panshilar::StackAllocatorPayload), "align mismatch");
+PNSLR_StackAllocatorPayload* PNSLR_Bindings_Convert(Panshilar::StackAllocatorPayload* x) { return reinterpret_cast<PNSLR_StackAllocatorPayload*>(x); }
+Panshilar::StackAllocatorPayload* PNSLR_Bindings_Convert(PNSLR_StackAllocatorPayload* x) { return reinterpret_cast<Panshilar::StackAllocatorPayload*>(x); }
+PNSLR_StackAllocatorPayload& PNSLR_Bindings_Convert(Panshilar::StackAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::StackAllocatorPayload& PNSLR_Bindings_Convert(PNSLR_StackAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StackAllocatorPayload, backingAllocator) == PNSLR_STRUCT_OFFSET(Panshilar::StackAllocatorPayload, backingAllocator), "backingAllocator offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StackAllocatorPayload, currentPage) == PNSLR_STRUCT_OFFSET(Panshilar::StackAllocatorPayload, currentPage), "currentPage offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StackAllocatorPayload, lastAllocation) == PNSLR_STRUCT_OFFSET(Panshilar::StackAllocatorPayload, lastAllocation), "lastAllocation offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StackAllocatorPayload, lastAllocationHeader) == PNSLR_STRUCT_OFFSET(Panshilar::StackAllocatorPayload, lastAllocationHeader), "lastAllocationHeader offset mismatch");
+
+extern "C" PNSLR_Allocator PNSLR_NewAllocator_Stack(PNSLR_Allocator backingAllocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+Panshilar::Allocator Panshilar::NewAllocator_Stack(Panshilar::Allocator backingAllocator, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    PNSLR_Allocator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_NewAllocator_Stack(PNSLR_Bindings_Convert(backingAllocator), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_DestroyAllocator_Stack(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+void Panshilar::DestroyAllocator_Stack(Panshilar::Allocator allocator, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    PNSLR_DestroyAllocator_Stack(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error));
+}
+
+extern "C" rawptr PNSLR_AllocatorFn_Stack(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+rawptr Panshilar::AllocatorFn_Stack(rawptr allocatorData, Panshilar::AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AllocatorFn_Stack(PNSLR_Bindings_Convert(allocatorData), PNSLR_Bindings_Convert(mode), PNSLR_Bindings_Convert(size), PNSLR_Bindings_Convert(alignment), PNSLR_Bindings_Convert(oldMemory), PNSLR_Bindings_Convert(oldSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+struct PNSLR_PoolAllocatorChunk
+{
+   PNSLR_PoolAllocatorChunk* previous;
+   rawptr slots;
+   i32 slotsCount;
+   i32 slotsTouched;
+};
+static_assert(sizeof(PNSLR_PoolAllocatorChunk) == sizeof(Panshilar::PoolAllocatorChunk), "size mismatch");
+static_assert(alignof(PNSLR_PoolAllocatorChunk) == alignof(Panshilar::PoolAllocatorChunk), "align mismatch");
+PNSLR_PoolAllocatorChunk* PNSLR_Bindings_Convert(Panshilar::PoolAllocatorChunk* x) { return reinterpret_cast<PNSLR_PoolAllocatorChunk*>(x); }
+Panshilar::PoolAllocatorChunk* PNSLR_Bindings_Convert(PNSLR_PoolAllocatorChunk* x) { return reinterpret_cast<Panshilar::PoolAllocatorChunk*>(x); }
+PNSLR_PoolAllocatorChunk& PNSLR_Bindings_Convert(Panshilar::PoolAllocatorChunk& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::PoolAllocatorChunk& PNSLR_Bindings_Convert(PNSLR_PoolAllocatorChunk& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_PoolAllocatorChunk, previous) == PNSLR_STRUCT_OFFSET(Panshilar::PoolAllocatorChunk, previous), "previous offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_PoolAllocatorChunk, slots) == PNSLR_STRUCT_OFFSET(Panshilar::PoolAllocatorChunk, slots), "slots offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_PoolAllocatorChunk, slotsCount) == PNSLR_STRUCT_OFFSET(Panshilar::PoolAllocatorChunk, slotsCount), "slotsCount offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_PoolAllocatorChunk, slotsTouched) == PNSLR_STRUCT_OFFSET(Panshilar::PoolAllocatorChunk, slotsTouched), "slotsTouched offset mismatch");
+
+struct PNSLR_PoolAllocatorPayload
+{
+   PNSLR_Allocator backingAllocator;
+   PNSLR_PoolAllocatorChunk* currentChunk;
+   rawptr freeList;
+   i32 slotSize;
+   i32 slotAlignment;
+   i32 slotStride;
+   i32 slotsPerChunk;
+   i64 numSlotsUsed;
+   i64 numSlotsTotal;
+};
+static_assert(sizeof(PNSLR_PoolAllocatorPayload) == sizeof(Panshilar::PoolAllocatorPayload), "size mismatch");
+static_assert(alignof(PNSLR_PoolAllocatorPayload) == alignof(Panshilar::PoolAllocatorPayload), "align mismatch");
+PNSLR_PoolAllocatorPayload* PNSLR_Bindings_Convert(Panshilar::PoolAllocatorPayload* x) { return reinterpret_cast<PNSLR_PoolAllocatorPayload*>(x); }
+Panshilar::PoolAllocatorPayload* PNSLR_Bindings_Convert(PNSLR_PoolAllocatorPayload* x) { return reinterpret_cast<Panshilar::PoolAllocatorPayload*>(x); }
+PNSLR_PoolAllocatorPayload& PNSLR_Bindings_Convert(Panshilar::PoolAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::PoolAllocatorPayload& PNSLR_Bindings_Convert(PNSLR_PoolAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_PoolAllocatorPayload, backingAllocator) == PNSLR_STRUCT_OFFSET(Panshilar::PoolAllocatorPayload, backingAllocator), "backingAllocator offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_PoolAllocatorPayload, currentChunk) == PNSLR_STRUCT_OFFSET(Panshilar::PoolAllocatorPayload, currentChunk), "currentChunk offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_PoolAllocatorPayload, freeList) == PNSLR_STRUCT_OFFSET(Panshilar::PoolAllocatorPayload, freeList), "freeList offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_PoolAllocatorPayload, slotSize) == PNSLR_STRUCT_OFFSET(Panshilar::PoolAllocatorPayload, slotSize), "slotSize offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_PoolAllocatorPayload, slotAlignment) == PNSLR_STRUCT_OFFSET(Panshilar::PoolAllocatorPayload, slotAlignment), "slotAlignment offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_PoolAllocatorPayload, slotStride) == PNSLR_STRUCT_OFFSET(Panshilar::PoolAllocatorPayload, slotStride), "slotStride offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_PoolAllocatorPayload, slotsPerChunk) == PNSLR_STRUCT_OFFSET(Panshilar::PoolAllocatorPayload, slotsPerChunk), "slotsPerChunk offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_PoolAllocatorPayload, numSlotsUsed) == PNSLR_STRUCT_OFFSET(Panshilar::PoolAllocatorPayload, numSlotsUsed), "numSlotsUsed offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_PoolAllocatorPayload, numSlotsTotal) == PNSLR_STRUCT_OFFSET(Panshilar::PoolAllocatorPayload, numSlotsTotal), "numSlotsTotal offset mismatch");
+
+extern "C" PNSLR_Allocator PNSLR_NewAllocator_Pool(PNSLR_Allocator backingAllocator, i32 slotSize, i32 slotAlignment, i32 slotsPerChunk, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+Panshilar::Allocator Panshilar::NewAllocator_Pool(Panshilar::Allocator backingAllocator, i32 slotSize, i32 slotAlignment, i32 slotsPerChunk, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    PNSLR_Allocator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_NewAllocator_Pool(PNSLR_Bindings_Convert(backingAllocator), PNSLR_Bindings_Convert(slotSize), PNSLR_Bindings_Convert(slotAlignment), PNSLR_Bindings_Convert(slotsPerChunk), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_DestroyAllocator_Pool(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+void Panshilar::DestroyAllocator_Pool(Panshilar::Allocator allocator, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    PNSLR_DestroyAllocator_Pool(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error));
+}
+
+extern "C" rawptr PNSLR_AllocatorFn_Pool(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+rawptr Panshilar::AllocatorFn_Pool(rawptr allocatorData, Panshilar::AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AllocatorFn_Pool(PNSLR_Bindings_Convert(allocatorData), PNSLR_Bindings_Convert(mode), PNSLR_Bindings_Convert(size), PNSLR_Bindings_Convert(alignment), PNSLR_Bindings_Convert(oldMemory), PNSLR_Bindings_Convert(oldSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+struct PNSLR_SlabAllocatorSlab
+{
+   PNSLR_SlabAllocatorSlab* next;
+   PNSLR_SlabAllocatorSlab* previous;
+   rawptr freeList;
+   i64 capacity;
+   i32 cacheIndex;
+   i32 objectsCount;
+   i32 objectsUsed;
+   i32 objectsTouched;
+};
+static_assert(sizeof(PNSLR_SlabAllocatorSlab) == sizeof(Panshilar::SlabAllocatorSlab), "size mismatch");
+static_assert(alignof(PNSLR_SlabAllocatorSlab) == alignof(Panshilar::SlabAllocatorSlab), "align mismatch");
+PNSLR_SlabAllocatorSlab* PNSLR_Bindings_Convert(Panshilar::SlabAllocatorSlab* x) { return reinterpret_cast<PNSLR_SlabAllocatorSlab*>(x); }
+Panshilar::SlabAllocatorSlab* PNSLR_Bindings_Convert(PNSLR_SlabAllocatorSlab* x) { return reinterpret_cast<Panshilar::SlabAllocatorSlab*>(x); }
+PNSLR_SlabAllocatorSlab& PNSLR_Bindings_Convert(Panshilar::SlabAllocatorSlab& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::SlabAllocatorSlab& PNSLR_Bindings_Convert(PNSLR_SlabAllocatorSlab& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorSlab, next) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorSlab, next), "next offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorSlab, previous) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorSlab, previous), "previous offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorSlab, freeList) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorSlab, freeList), "freeList offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorSlab, capacity) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorSlab, capacity), "capacity offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorSlab, cacheIndex) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorSlab, cacheIndex), "cacheIndex offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorSlab, objectsCount) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorSlab, objectsCount), "objectsCount offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorSlab, objectsUsed) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorSlab, objectsUsed), "objectsUsed offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorSlab, objectsTouched) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorSlab, objectsTouched), "objectsTouched offset mismatch");
+
+struct PNSLR_SlabAllocatorCache
+{
+   PNSLR_Mutex mutex;
+   PNSLR_SlabAllocatorSlab* partialSlabs;
+   PNSLR_SlabAllocatorSlab* fullSlabs;
+   PNSLR_SlabAllocatorSlab* emptySlabs;
+   i64 numObjectsUsed;
+   i32 objectStride;
+   i32 objectsPerSlab;
+   i32 numSlabs;
+   i32 numEmptySlabs;
+};
+static_assert(sizeof(PNSLR_SlabAllocatorCache) == sizeof(Panshilar::SlabAllocatorCache), "size mismatch");
+static_assert(alignof(PNSLR_SlabAllocatorCache) == alignof(Panshilar::SlabAllocatorCache), "align mismatch");
+PNSLR_SlabAllocatorCache* PNSLR_Bindings_Convert(Panshilar::SlabAllocatorCache* x) { return reinterpret_cast<PNSLR_SlabAllocatorCache*>(x); }
+Panshilar::SlabAllocatorCache* PNSLR_Bindings_Convert(PNSLR_SlabAllocatorCache* x) { return reinterpret_cast<Panshilar::SlabAllocatorCache*>(x); }
+PNSLR_SlabAllocatorCache& PNSLR_Bindings_Convert(Panshilar::SlabAllocatorCache& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::SlabAllocatorCache& PNSLR_Bindings_Convert(PNSLR_SlabAllocatorCache& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorCache, mutex) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorCache, mutex), "mutex offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorCache, partialSlabs) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorCache, partialSlabs), "partialSlabs offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorCache, fullSlabs) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorCache, fullSlabs), "fullSlabs offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorCache, emptySlabs) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorCache, emptySlabs), "emptySlabs offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorCache, numObjectsUsed) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorCache, numObjectsUsed), "numObjectsUsed offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorCache, objectStride) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorCache, objectStride), "objectStride offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorCache, objectsPerSlab) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorCache, objectsPerSlab), "objectsPerSlab offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorCache, numSlabs) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorCache, numSlabs), "numSlabs offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorCache, numEmptySlabs) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorCache, numEmptySlabs), "numEmptySlabs offset mismatch");
+
+struct PNSLR_SlabAllocatorPayload
+{
+   PNSLR_Allocator backingAllocator;
+   PNSLR_SlabAllocatorCache caches[32];
+   PNSLR_Mutex largeSlabsMutex;
+   PNSLR_SlabAllocatorSlab* largeSlabs;
+   i64 numLargeSlabs;
+   i32 maxEmptySlabsPerCache;
+};
+static_assert(sizeof(PNSLR_SlabAllocatorPayload) == sizeof(Panshilar::SlabAllocatorPayload), "size mismatch");
+static_assert(alignof(PNSLR_SlabAllocatorPayload) == alignof(Panshilar::SlabAllocatorPayload), "align mismatch");
+PNSLR_SlabAllocatorPayload* PNSLR_Bindings_Convert(Panshilar::SlabAllocatorPayload* x) { return reinterpret_cast<PNSLR_SlabAllocatorPayload*>(x); }
+Panshilar::SlabAllocatorPayload* PNSLR_Bindings_Convert(PNSLR_SlabAllocatorPayload* x) { return reinterpret_cast<Panshilar::SlabAllocatorPayload*>(x); }
+PNSLR_SlabAllocatorPayload& PNSLR_Bindings_Convert(Panshilar::SlabAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::SlabAllocatorPayload& PNSLR_Bindings_Convert(PNSLR_SlabAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorPayload, backingAllocator) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorPayload, backingAllocator), "backingAllocator offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorPayload, caches) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorPayload, caches), "caches offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorPayload, largeSlabsMutex) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorPayload, largeSlabsMutex), "largeSlabsMutex offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorPayload, largeSlabs) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorPayload, largeSlabs), "largeSlabs offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorPayload, numLargeSlabs) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorPayload, numLargeSlabs), "numLargeSlabs offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorPayload, maxEmptySlabsPerCache) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorPayload, maxEmptySlabsPerCache), "maxEmptySlabsPerCache offset mismatch");
+
+struct PNSLR_SlabAllocatorStats
+{
+   i64 numObjectsUsed;
+   i64 numSlabs;
+   i64 numEmptySlabs;
+   i64 numLargeSlabs;
+   i64 reservedBytes;
+};
+static_assert(sizeof(PNSLR_SlabAllocatorStats) == sizeof(Panshilar::SlabAllocatorStats), "size mismatch");
+static_assert(alignof(PNSLR_SlabAllocatorStats) == alignof(Panshilar::SlabAllocatorStats), "align mismatch");
+PNSLR_SlabAllocatorStats* PNSLR_Bindings_Convert(Panshilar::SlabAllocatorStats* x) { return reinterpret_cast<PNSLR_SlabAllocatorStats*>(x); }
+Panshilar::SlabAllocatorStats* PNSLR_Bindings_Convert(PNSLR_SlabAllocatorStats* x) { return reinterpret_cast<Panshilar::SlabAllocatorStats*>(x); }
+PNSLR_SlabAllocatorStats& PNSLR_Bindings_Convert(Panshilar::SlabAllocatorStats& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::SlabAllocatorStats& PNSLR_Bindings_Convert(PNSLR_SlabAllocatorStats& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorStats, numObjectsUsed) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorStats, numObjectsUsed), "numObjectsUsed offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorStats, numSlabs) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorStats, numSlabs), "numSlabs offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorStats, numEmptySlabs) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorStats, numEmptySlabs), "numEmptySlabs offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorStats, numLargeSlabs) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorStats, numLargeSlabs), "numLargeSlabs offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_SlabAllocatorStats, reservedBytes) == PNSLR_STRUCT_OFFSET(Panshilar::SlabAllocatorStats, reservedBytes), "reservedBytes offset mismatch");
+
+extern "C" PNSLR_Allocator PNSLR_NewAllocator_Slab(PNSLR_Allocator backingAllocator, i32 maxEmptySlabsPerCache, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+Panshilar::Allocator Panshilar::NewAllocator_Slab(Panshilar::Allocator backingAllocator, i32 maxEmptySlabsPerCache, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    PNSLR_Allocator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_NewAllocator_Slab(PNSLR_Bindings_Convert(backingAllocator), PNSLR_Bindings_Convert(maxEmptySlabsPerCache), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_DestroyAllocator_Slab(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+void Panshilar::DestroyAllocator_Slab(Panshilar::Allocator allocator, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    PNSLR_DestroyAllocator_Slab(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error));
+}
+
+extern "C" rawptr PNSLR_AllocatorFn_Slab(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+rawptr Panshilar::AllocatorFn_Slab(rawptr allocatorData, Panshilar::AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AllocatorFn_Slab(PNSLR_Bindings_Convert(allocatorData), PNSLR_Bindings_Convert(mode), PNSLR_Bindings_Convert(size), PNSLR_Bindings_Convert(alignment), PNSLR_Bindings_Convert(oldMemory), PNSLR_Bindings_Convert(oldSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_TrimSlabAllocator(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location);
+void Panshilar::TrimSlabAllocator(Panshilar::Allocator allocator, Panshilar::SourceCodeLocation location)
+{
+    PNSLR_TrimSlabAllocator(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(location));
+}
+
+extern "C" PNSLR_SlabAllocatorStats PNSLR_GetSlabAllocatorStats(PNSLR_Allocator allocator);
+Panshilar::SlabAllocatorStats Panshilar::GetSlabAllocatorStats(Panshilar::Allocator allocator)
+{
+    PNSLR_SlabAllocatorStats zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GetSlabAllocatorStats(PNSLR_Bindings_Convert(allocator)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+struct PNSLR_BuddyAllocatorFreeBlock
+{
+   PNSLR_BuddyAllocatorFreeBlock* previous;
+   PNSLR_BuddyAllocatorFreeBlock* next;
+};
+static_assert(sizeof(PNSLR_BuddyAllocatorFreeBlock) == sizeof(Panshilar::BuddyAllocatorFreeBlock), "size mismatch");
+static_assert(alignof(PNSLR_BuddyAllocatorFreeBlock) == alignof(Panshilar::BuddyAllocatorFreeBlock), "align mismatch");
+PNSLR_BuddyAllocatorFreeBlock* PNSLR_Bindings_Convert(Panshilar::BuddyAllocatorFreeBlock* x) { return reinterpret_cast<PNSLR_BuddyAllocatorFreeBlock*>(x); }
+Panshilar::BuddyAllocatorFreeBlock* PNSLR_Bindings_Convert(PNSLR_BuddyAllocatorFreeBlock* x) { return reinterpret_cast<Panshilar::BuddyAllocatorFreeBlock*>(x); }
+PNSLR_BuddyAllocatorFreeBlock& PNSLR_Bindings_Convert(Panshilar::BuddyAllocatorFreeBlock& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::BuddyAllocatorFreeBlock& PNSLR_Bindings_Convert(PNSLR_BuddyAllocatorFreeBlock& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorFreeBlock, previous) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorFreeBlock, previous), "previous offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorFreeBlock, next) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorFreeBlock, next), "next offset mismatch");
+
+struct PNSLR_BuddyAllocatorPayload
+{
+   PNSLR_Allocator backingAllocator;
+   rawptr memory;
+   u8* blockStates;
+   i64* requestedSizes;
+   i64 regionSize;
+   i32 minBlockSize;
+   i32 minBlockShift;
+   i32 numOrders;
+   i32 numAllocations;
+   i32 numFreeBlocks;
+   i64 usedBytes;
+   i64 requestedBytes;
+   PNSLR_BuddyAllocatorFreeBlock* freeLists[32];
+};
+static_assert(sizeof(PNSLR_BuddyAllocatorPayload) == sizeof(Panshilar::BuddyAllocatorPayload), "size mismatch");
+static_assert(alignof(PNSLR_BuddyAllocatorPayload) == alignof(Panshilar::BuddyAllocatorPayload), "align mismatch");
+PNSLR_BuddyAllocatorPayload* PNSLR_Bindings_Convert(Panshilar::BuddyAllocatorPayload* x) { return reinterpret_cast<PNSLR_BuddyAllocatorPayload*>(x); }
+Panshilar::BuddyAllocatorPayload* PNSLR_Bindings_Convert(PNSLR_BuddyAllocatorPayload* x) { return reinterpret_cast<Panshilar::BuddyAllocatorPayload*>(x); }
+PNSLR_BuddyAllocatorPayload& PNSLR_Bindings_Convert(Panshilar::BuddyAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::BuddyAllocatorPayload& PNSLR_Bindings_Convert(PNSLR_BuddyAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorPayload, backingAllocator) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorPayload, backingAllocator), "backingAllocator offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorPayload, memory) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorPayload, memory), "memory offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorPayload, blockStates) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorPayload, blockStates), "blockStates offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorPayload, requestedSizes) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorPayload, requestedSizes), "requestedSizes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorPayload, regionSize) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorPayload, regionSize), "regionSize offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorPayload, minBlockSize) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorPayload, minBlockSize), "minBlockSize offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorPayload, minBlockShift) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorPayload, minBlockShift), "minBlockShift offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorPayload, numOrders) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorPayload, numOrders), "numOrders offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorPayload, numAllocations) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorPayload, numAllocations), "numAllocations offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorPayload, numFreeBlocks) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorPayload, numFreeBlocks), "numFreeBlocks offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorPayload, usedBytes) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorPayload, usedBytes), "usedBytes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorPayload, requestedBytes) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorPayload, requestedBytes), "requestedBytes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorPayload, freeLists) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorPayload, freeLists), "freeLists offset mismatch");
+
+struct PNSLR_BuddyAllocatorStats
+{
+   i64 totalBytes;
+   i64 usedBytes;
+   i64 requestedBytes;
+   i64 freeBytes;
+   i64 largestFreeBlock;
+   i32 numAllocations;
+   i32 numFreeBlocks;
+};
+static_assert(sizeof(PNSLR_BuddyAllocatorStats) == sizeof(Panshilar::BuddyAllocatorStats), "size mismatch");
+static_assert(alignof(PNSLR_BuddyAllocatorStats) == alignof(Panshilar::BuddyAllocatorStats), "align mismatch");
+PNSLR_BuddyAllocatorStats* PNSLR_Bindings_Convert(Panshilar::BuddyAllocatorStats* x) { return reinterpret_cast<PNSLR_BuddyAllocatorStats*>(x); }
+Panshilar::BuddyAllocatorStats* PNSLR_Bindings_Convert(PNSLR_BuddyAllocatorStats* x) { return reinterpret_cast<Panshilar::BuddyAllocatorStats*>(x); }
+PNSLR_BuddyAllocatorStats& PNSLR_Bindings_Convert(Panshilar::BuddyAllocatorStats& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::BuddyAllocatorStats& PNSLR_Bindings_Convert(PNSLR_BuddyAllocatorStats& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorStats, totalBytes) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorStats, totalBytes), "totalBytes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorStats, usedBytes) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorStats, usedBytes), "usedBytes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorStats, requestedBytes) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorStats, requestedBytes), "requestedBytes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorStats, freeBytes) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorStats, freeBytes), "freeBytes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorStats, largestFreeBlock) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorStats, largestFreeBlock), "largestFreeBlock offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorStats, numAllocations) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorStats, numAllocations), "numAllocations offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_BuddyAllocatorStats, numFreeBlocks) == PNSLR_STRUCT_OFFSET(Panshilar::BuddyAllocatorStats, numFreeBlocks), "numFreeBlocks offset mismatch");
+
+extern "C" PNSLR_Allocator PNSLR_NewAllocator_Buddy(PNSLR_Allocator backingAllocator, i64 regionSize, i32 minBlockSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+Panshilar::Allocator Panshilar::NewAllocator_Buddy(Panshilar::Allocator backingAllocator, i64 regionSize, i32 minBlockSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    PNSLR_Allocator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_NewAllocator_Buddy(PNSLR_Bindings_Convert(backingAllocator), PNSLR_Bindings_Convert(regionSize), PNSLR_Bindings_Convert(minBlockSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_DestroyAllocator_Buddy(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+void Panshilar::DestroyAllocator_Buddy(Panshilar::Allocator allocator, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    PNSLR_DestroyAllocator_Buddy(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error));
+}
+
+extern "C" rawptr PNSLR_AllocatorFn_Buddy(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+rawptr Panshilar::AllocatorFn_Buddy(rawptr allocatorData, Panshilar::AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AllocatorFn_Buddy(PNSLR_Bindings_Convert(allocatorData), PNSLR_Bindings_Convert(mode), PNSLR_Bindings_Convert(size), PNSLR_Bindings_Convert(alignment), PNSLR_Bindings_Convert(oldMemory), PNSLR_Bindings_Convert(oldSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_BuddyAllocatorStats PNSLR_GetBuddyAllocatorStats(PNSLR_Allocator allocator);
+Panshilar::BuddyAllocatorStats Panshilar::GetBuddyAllocatorStats(Panshilar::Allocator allocator)
+{
+    PNSLR_BuddyAllocatorStats zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GetBuddyAllocatorStats(PNSLR_Bindings_Convert(allocator)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+struct PNSLR_TrackingAllocatorCallSite
+{
+   PNSLR_SourceCodeLocation location;
+   i64 numAllocations;
+   i64 numFrees;
+   i64 numResizes;
+   i64 totalBytes;
+   i64 liveBytes;
+};
+static_assert(sizeof(PNSLR_TrackingAllocatorCallSite) == sizeof(Panshilar::TrackingAllocatorCallSite), "size mismatch");
+static_assert(alignof(PNSLR_TrackingAllocatorCallSite) == alignof(Panshilar::TrackingAllocatorCallSite), "align mismatch");
+PNSLR_TrackingAllocatorCallSite* PNSLR_Bindings_Convert(Panshilar::TrackingAllocatorCallSite* x) { return reinterpret_cast<PNSLR_TrackingAllocatorCallSite*>(x); }
+Panshilar::TrackingAllocatorCallSite* PNSLR_Bindings_Convert(PNSLR_TrackingAllocatorCallSite* x) { return reinterpret_cast<Panshilar::TrackingAllocatorCallSite*>(x); }
+PNSLR_TrackingAllocatorCallSite& PNSLR_Bindings_Convert(Panshilar::TrackingAllocatorCallSite& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::TrackingAllocatorCallSite& PNSLR_Bindings_Convert(PNSLR_TrackingAllocatorCallSite& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorCallSite, location) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorCallSite, location), "location offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorCallSite, numAllocations) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorCallSite, numAllocations), "numAllocations offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorCallSite, numFrees) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorCallSite, numFrees), "numFrees offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorCallSite, numResizes) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorCallSite, numResizes), "numResizes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorCallSite, totalBytes) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorCallSite, totalBytes), "totalBytes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorCallSite, liveBytes) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorCallSite, liveBytes), "liveBytes offset mismatch");
+
+typedef struct { PNSLR_TrackingAllocatorCallSite* data; i64 count; } PNSLR_ArraySlice_PNSLR_TrackingAllocatorCallSite;
+static_assert(sizeof(PNSLR_ArraySlice_PNSLR_TrackingAllocatorCallSite) == sizeof(ArraySlice<Panshilar::TrackingAllocatorCallSite>), "size mismatch");
+static_assert(alignof(PNSLR_ArraySlice_PNSLR_TrackingAllocatorCallSite) == alignof(ArraySlice<Panshilar::TrackingAllocatorCallSite>), "align mismatch");
+PNSLR_ArraySlice_PNSLR_TrackingAllocatorCallSite* PNSLR_Bindings_Convert(ArraySlice<Panshilar::TrackingAllocatorCallSite>* x) { return reinterpret_cast<PNSLR_ArraySlice_PNSLR_TrackingAllocatorCallSite*>(x); }
+ArraySlice<Panshilar::TrackingAllocatorCallSite>* PNSLR_Bindings_Convert(PNSLR_ArraySlice_PNSLR_TrackingAllocatorCallSite* x) { return reinterpret_cast<ArraySlice<Panshilar::TrackingAllocatorCallSite>*>(x); }
+PNSLR_ArraySlice_PNSLR_TrackingAllocatorCallSite& PNSLR_Bindings_Convert(ArraySlice<Panshilar::TrackingAllocatorCallSite>& x) { return *PNSLR_Bindings_Convert(&x); }
+ArraySlice<Panshilar::TrackingAllocatorCallSite>& PNSLR_Bindings_Convert(PNSLR_ArraySlice_PNSLR_TrackingAllocatorCallSite& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ArraySlice_PNSLR_TrackingAllocatorCallSite, count) == PNSLR_STRUCT_OFFSET(ArraySlice<Panshilar::TrackingAllocatorCallSite>, count), "count offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ArraySlice_PNSLR_TrackingAllocatorCallSite, data) == PNSLR_STRUCT_OFFSET(ArraySlice<Panshilar::TrackingAllocatorCallSite>, data), "data offset mismatch");
+
+struct PNSLR_TrackingAllocatorThreadRecord
+{
+   PNSLR_TrackingAllocatorThreadRecord* next;
+   rawptr owner;
+   i64 numAllocations;
+   i64 numFrees;
+   i64 numResizes;
+   i64 totalBytes;
+   i32 numCallSites;
+   PNSLR_TrackingAllocatorCallSite overflow;
+   PNSLR_TrackingAllocatorCallSite callSites[256];
+};
+static_assert(sizeof(PNSLR_TrackingAllocatorThreadRecord) == sizeof(Panshilar::TrackingAllocatorThreadRecord), "size mismatch");
+static_assert(alignof(PNSLR_TrackingAllocatorThreadRecord) == alignof(Panshilar::TrackingAllocatorThreadRecord), "align mismatch");
+PNSLR_TrackingAllocatorThreadRecord* PNSLR_Bindings_Convert(Panshilar::TrackingAllocatorThreadRecord* x) { return reinterpret_cast<PNSLR_TrackingAllocatorThreadRecord*>(x); }
+Panshilar::TrackingAllocatorThreadRecord* PNSLR_Bindings_Convert(PNSLR_TrackingAllocatorThreadRecord* x) { return reinterpret_cast<Panshilar::TrackingAllocatorThreadRecord*>(x); }
+PNSLR_TrackingAllocatorThreadRecord& PNSLR_Bindings_Convert(Panshilar::TrackingAllocatorThreadRecord& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::TrackingAllocatorThreadRecord& PNSLR_Bindings_Convert(PNSLR_TrackingAllocatorThreadRecord& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorThreadRecord, next) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorThreadRecord, next), "next offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorThreadRecord, owner) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorThreadRecord, owner), "owner offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorThreadRecord, numAllocations) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorThreadRecord, numAllocations), "numAllocations offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorThreadRecord, numFrees) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorThreadRecord, numFrees), "numFrees offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorThreadRecord, numResizes) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorThreadRecord, numResizes), "numResizes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorThreadRecord, totalBytes) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorThreadRecord, totalBytes), "totalBytes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorThreadRecord, numCallSites) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorThreadRecord, numCallSites), "numCallSites offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorThreadRecord, overflow) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorThreadRecord, overflow), "overflow offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorThreadRecord, callSites) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorThreadRecord, callSites), "callSites offset mismatch");
+
+struct PNSLR_TrackingAllocatorPayload
 {
    PNSLR_Allocator backingAllocator;
-   PNSLR_StackAllocatorPage* currentPage;
-   rawptr lastAllocation;
-   PNSLR_StackAllocationHeader* lastAllocationHeader;
+   PNSLR_Mutex recordsMutex;
+   PNSLR_TrackingAllocatorThreadRecord* records;
+   i64 id;
+   i64 liveBytes;
+   i64 peakBytes;
 };
-static_assert(sizeof(PNSLR_StackAllocatorPayload) == sizeof(Panshilar::StackAllocatorPayload), "size mismatch");
-static_assert(alignof(PNSLR_StackAllocatorPayload) == alignof(Panshilar::StackAllocatorPayload), "align mismatch");
-PNSLR_StackAllocatorPayload* PNSLR_Bindings_Convert(Panshilar::StackAllocatorPayload* x) { return reinterpret_cast<PNSLR_StackAllocatorPayload*>(x); }
-Panshilar::StackAllocatorPayload* PNSLR_Bindings_Convert(PNSLR_StackAllocatorPayload* x) { return reinterpret_cast<Panshilar::StackAllocatorPayload*>(x); }
-PNSLR_StackAllocatorPayload& PNSLR_Bindings_Convert(Panshilar::StackAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
-Panshilar::StackAllocatorPayload& PNSLR_Bindings_Convert(PNSLR_StackAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
-static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StackAllocatorPayload, backingAllocator) == PNSLR_STRUCT_OFFSET(Panshilar::StackAllocatorPayload, backingAllocator), "backingAllocator offset mismatch");
-static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StackAllocatorPayload, currentPage) == PNSLR_STRUCT_OFFSET(Panshilar::StackAllocatorPayload, currentPage), "currentPage offset mismatch");
-static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StackAllocatorPayload, lastAllocation) == PNSLR_STRUCT_OFFSET(Panshilar::StackAllocatorPayload, lastAllocation), "lastAllocation offset mismatch");
-static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StackAllocatorPayload, lastAllocationHeader) == PNSLR_STRUCT_OFFSET(Panshilar::StackAllocatorPayload, lastAllocationHeader), "lastAllocationHeader offset mismatch");
+static_assert(sizeof(PNSLR_TrackingAllocatorPayload) == sizeof(Panshilar::TrackingAllocatorPayload), "size mismatch");
+static_assert(alignof(PNSLR_TrackingAllocatorPayload) == alignof(Panshilar::TrackingAllocatorPayload), "align mismatch");
+PNSLR_TrackingAllocatorPayload* PNSLR_Bindings_Convert(Panshilar::TrackingAllocatorPayload* x) { return reinterpret_cast<PNSLR_TrackingAllocatorPayload*>(x); }
+Panshilar::TrackingAllocatorPayload* PNSLR_Bindings_Convert(PNSLR_TrackingAllocatorPayload* x) { return reinterpret_cast<Panshilar::TrackingAllocatorPayload*>(x); }
+PNSLR_TrackingAllocatorPayload& PNSLR_Bindings_Convert(Panshilar::TrackingAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::TrackingAllocatorPayload& PNSLR_Bindings_Convert(PNSLR_TrackingAllocatorPayload& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorPayload, backingAllocator) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorPayload, backingAllocator), "backingAllocator offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorPayload, recordsMutex) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorPayload, recordsMutex), "recordsMutex offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorPayload, records) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorPayload, records), "records offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorPayload, id) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorPayload, id), "id offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorPayload, liveBytes) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorPayload, liveBytes), "liveBytes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorPayload, peakBytes) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorPayload, peakBytes), "peakBytes offset mismatch");
+
+struct PNSLR_TrackingAllocatorStats
+{
+   i64 liveBytes;
+   i64 peakBytes;
+   i64 liveAllocations;
+   i64 numAllocations;
+   i64 numFrees;
+   i64 numResizes;
+   i64 totalBytes;
+   i32 numThreads;
+};
+static_assert(sizeof(PNSLR_TrackingAllocatorStats) == sizeof(Panshilar::TrackingAllocatorStats), "size mismatch");
+static_assert(alignof(PNSLR_TrackingAllocatorStats) == alignof(Panshilar::TrackingAllocatorStats), "align mismatch");
+PNSLR_TrackingAllocatorStats* PNSLR_Bindings_Convert(Panshilar::TrackingAllocatorStats* x) { return reinterpret_cast<PNSLR_TrackingAllocatorStats*>(x); }
+Panshilar::TrackingAllocatorStats* PNSLR_Bindings_Convert(PNSLR_TrackingAllocatorStats* x) { return reinterpret_cast<Panshilar::TrackingAllocatorStats*>(x); }
+PNSLR_TrackingAllocatorStats& PNSLR_Bindings_Convert(Panshilar::TrackingAllocatorStats& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::TrackingAllocatorStats& PNSLR_Bindings_Convert(PNSLR_TrackingAllocatorStats& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorStats, liveBytes) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorStats, liveBytes), "liveBytes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorStats, peakBytes) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorStats, peakBytes), "peakBytes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorStats, liveAllocations) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorStats, liveAllocations), "liveAllocations offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorStats, numAllocations) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorStats, numAllocations), "numAllocations offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorStats, numFrees) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorStats, numFrees), "numFrees offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorStats, numResizes) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorStats, numResizes), "numResizes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorStats, totalBytes) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorStats, totalBytes), "totalBytes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_TrackingAllocatorStats, numThreads) == PNSLR_STRUCT_OFFSET(Panshilar::TrackingAllocatorStats, numThreads), "numThreads offset mismatch");
 
-extern "C" PNSLR_Allocator PNSLR_NewAllocator_Stack(PNSLR_Allocator backingAllocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
-Panshilar::Allocator Panshilar::NewAllocator_Stack(Panshilar::Allocator backingAllocator, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+extern "C" PNSLR_Allocator PNSLR_NewAllocator_Tracking(PNSLR_Allocator backingAllocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+Panshilar::Allocator Panshilar::NewAllocator_Tracking(Panshilar::Allocator backingAllocator, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
 {
-    PNSLR_Allocator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_NewAllocator_Stack(PNSLR_Bindings_Convert(backingAllocator), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+    PNSLR_Allocator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_NewAllocator_Tracking(PNSLR_Bindings_Convert(backingAllocator), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
 
-extern "C" void PNSLR_DestroyAllocator_Stack(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
-void Panshilar::DestroyAllocator_Stack(Panshilar::Allocator allocator, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+extern "C" void PNSLR_DestroyAllocator_Tracking(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+void Panshilar::DestroyAllocator_Tracking(Panshilar::Allocator allocator, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
 {
-    PNSLR_DestroyAllocator_Stack(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error));
+    PNSLR_DestroyAllocator_Tracking(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error));
 }
 
-extern "C" rawptr PNSLR_AllocatorFn_Stack(rawptr allocatorData, PNSLR_AllocatorMode mode, i32 size, i32 alignment, rawptr oldMemory, i32 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
-rawptr Panshilar::AllocatorFn_Stack(rawptr allocatorData, Panshilar::AllocatorMode mode, i32 size, i32 alignment, rawptr oldMemory, i32 oldSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+extern "C" rawptr PNSLR_AllocatorFn_Tracking(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+rawptr Panshilar::AllocatorFn_Tracking(rawptr allocatorData, Panshilar::AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
 {
-    rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AllocatorFn_Stack(PNSLR_Bindings_Convert(allocatorData), PNSLR_Bindings_Convert(mode), PNSLR_Bindings_Convert(size), PNSLR_Bindings_Convert(alignment), PNSLR_Bindings_Convert(oldMemory), PNSLR_Bindings_Convert(oldSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+    rawptr zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AllocatorFn_Tracking(PNSLR_Bindings_Convert(allocatorData), PNSLR_Bindings_Convert(mode), PNSLR_Bindings_Convert(size), PNSLR_Bindings_Convert(alignment), PNSLR_Bindings_Convert(oldMemory), PNSLR_Bindings_Convert(oldSize), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_TrackingAllocatorStats PNSLR_GetTrackingAllocatorStats(PNSLR_Allocator allocator);
+Panshilar::TrackingAllocatorStats Panshilar::GetTrackingAllocatorStats(Panshilar::Allocator allocator)
+{
+    PNSLR_TrackingAllocatorStats zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GetTrackingAllocatorStats(PNSLR_Bindings_Convert(allocator)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_ArraySlice_PNSLR_TrackingAllocatorCallSite PNSLR_GetTrackingAllocatorCallSites(PNSLR_Allocator allocator, PNSLR_Allocator outputAllocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
+ArraySlice<Panshilar::TrackingAllocatorCallSite> Panshilar::GetTrackingAllocatorCallSites(Panshilar::Allocator allocator, Panshilar::Allocator outputAllocator, Panshilar::SourceCodeLocation location, Panshilar::AllocatorError* error)
+{
+    PNSLR_ArraySlice_PNSLR_TrackingAllocatorCallSite zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GetTrackingAllocatorCallSites(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(outputAllocator), PNSLR_Bindings_Convert(location), PNSLR_Bindings_Convert(error)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_ResetTrackingAllocatorPeak(PNSLR_Allocator allocator);
+void Panshilar::ResetTrackingAllocatorPeak(Panshilar::Allocator allocator)
+{
+    PNSLR_ResetTrackingAllocatorPeak(PNSLR_Bindings_Convert(allocator));
+}
+
+struct PNSLR_InternalAllocatorStats
+{
+   PNSLR_UTF8STR name;
+   i64 staticCapacity;
+   i64 numOverflows;
+   i64 overflowBytes;
+   i64 peakOverflowBytes;
+};
+static_assert(sizeof(PNSLR_InternalAllocatorStats) == sizeof(Panshilar::InternalAllocatorStats), "size mismatch");
+static_assert(alignof(PNSLR_InternalAllocatorStats) == alignof(Panshilar::InternalAllocatorStats), "align mismatch");
+PNSLR_InternalAllocatorStats* PNSLR_Bindings_Convert(Panshilar::InternalAllocatorStats* x) { return reinterpret_cast<PNSLR_InternalAllocatorStats*>(x); }
+Panshilar::InternalAllocatorStats* PNSLR_Bindings_Convert(PNSLR_InternalAllocatorStats* x) { return reinterpret_cast<Panshilar::InternalAllocatorStats*>(x); }
+PNSLR_InternalAllocatorStats& PNSLR_Bindings_Convert(Panshilar::InternalAllocatorStats& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::InternalAllocatorStats& PNSLR_Bindings_Convert(PNSLR_InternalAllocatorStats& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_InternalAllocatorStats, name) == PNSLR_STRUCT_OFFSET(Panshilar::InternalAllocatorStats, name), "name offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_InternalAllocatorStats, staticCapacity) == PNSLR_STRUCT_OFFSET(Panshilar::InternalAllocatorStats, staticCapacity), "staticCapacity offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_InternalAllocatorStats, numOverflows) == PNSLR_STRUCT_OFFSET(Panshilar::InternalAllocatorStats, numOverflows), "numOverflows offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_InternalAllocatorStats, overflowBytes) == PNSLR_STRUCT_OFFSET(Panshilar::InternalAllocatorStats, overflowBytes), "overflowBytes offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_InternalAllocatorStats, peakOverflowBytes) == PNSLR_STRUCT_OFFSET(Panshilar::InternalAllocatorStats, peakOverflowBytes), "peakOverflowBytes offset mismatch");
+
+typedef struct { PNSLR_InternalAllocatorStats* data; i64 count; } PNSLR_ArraySlice_PNSLR_InternalAllocatorStats;
+static_assert(sizeof(PNSLR_ArraySlice_PNSLR_InternalAllocatorStats) == sizeof(ArraySlice<Panshilar::InternalAllocatorStats>), "size mismatch");
+static_assert(alignof(PNSLR_ArraySlice_PNSLR_InternalAllocatorStats) == alignof(ArraySlice<Panshilar::InternalAllocatorStats>), "align mismatch");
+PNSLR_ArraySlice_PNSLR_InternalAllocatorStats* PNSLR_Bindings_Convert(ArraySlice<Panshilar::InternalAllocatorStats>* x) { return reinterpret_cast<PNSLR_ArraySlice_PNSLR_InternalAllocatorStats*>(x); }
+ArraySlice<Panshilar::InternalAllocatorStats>* PNSLR_Bindings_Convert(PNSLR_ArraySlice_PNSLR_InternalAllocatorStats* x) { return reinterpret_cast<ArraySlice<Panshilar::InternalAllocatorStats>*>(x); }
+PNSLR_ArraySlice_PNSLR_InternalAllocatorStats& PNSLR_Bindings_Convert(ArraySlice<Panshilar::InternalAllocatorStats>& x) { return *PNSLR_Bindings_Convert(&x); }
+ArraySlice<Panshilar::InternalAllocatorStats>& PNSLR_Bindings_Convert(PNSLR_ArraySlice_PNSLR_InternalAllocatorStats& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ArraySlice_PNSLR_InternalAllocatorStats, count) == PNSLR_STRUCT_OFFSET(ArraySlice<Panshilar::InternalAllocatorStats>, count), "count offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ArraySlice_PNSLR_InternalAllocatorStats, data) == PNSLR_STRUCT_OFFSET(ArraySlice<Panshilar::InternalAllocatorStats>, data), "data offset mismatch");
+
+extern "C" i32 PNSLR_GetInternalAllocatorStats(PNSLR_ArraySlice_PNSLR_InternalAllocatorStats output);
+i32 Panshilar::GetInternalAllocatorStats(ArraySlice<Panshilar::InternalAllocatorStats> output)
+{
+    i32 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GetInternalAllocatorStats(PNSLR_Bindings_Convert(output)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_ResetInternalAllocatorPeaks();
+void Panshilar::ResetInternalAllocatorPeaks()
+{
+    PNSLR_ResetInternalAllocatorPeaks();
 }
 
 extern "C" PNSLR_RawArraySlice PNSLR_MakeRawSlice(i32 tySize, i32 tyAlign, i64 count, b8 zeroed, PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error);
@@ -3836,6 +6288,166 @@ utf8str Panshilar::ReplaceInString(utf8str str, utf8str oldValue, utf8str newVal
     PNSLR_UTF8STR zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_ReplaceInString(PNSLR_Bindings_Convert(str), PNSLR_Bindings_Convert(oldValue), PNSLR_Bindings_Convert(newValue), PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(comparisonType)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
 
+extern "C" u64 PNSLR_HashString(PNSLR_UTF8STR str, u64 seed);
+u64 Panshilar::HashString(utf8str str, u64 seed)
+{
+    u64 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_HashString(PNSLR_Bindings_Convert(str), PNSLR_Bindings_Convert(seed)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_UTF8STR PNSLR_TrimStringFromStart(PNSLR_UTF8STR str);
+utf8str Panshilar::TrimStringFromStart(utf8str str)
+{
+    PNSLR_UTF8STR zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_TrimStringFromStart(PNSLR_Bindings_Convert(str)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_UTF8STR PNSLR_TrimStringFromEnd(PNSLR_UTF8STR str);
+utf8str Panshilar::TrimStringFromEnd(utf8str str)
+{
+    PNSLR_UTF8STR zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_TrimStringFromEnd(PNSLR_Bindings_Convert(str)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_UTF8STR PNSLR_TrimString(PNSLR_UTF8STR str);
+utf8str Panshilar::TrimString(utf8str str)
+{
+    PNSLR_UTF8STR zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_TrimString(PNSLR_Bindings_Convert(str)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+enum class PNSLR_StringSplitType : u8 { };
+static_assert(sizeof(PNSLR_StringSplitType) == sizeof(Panshilar::StringSplitType), "size mismatch");
+static_assert(alignof(PNSLR_StringSplitType) == alignof(Panshilar::StringSplitType), "align mismatch");
+PNSLR_StringSplitType* PNSLR_Bindings_Convert(Panshilar::StringSplitType* x) { return reinterpret_cast<PNSLR_StringSplitType*>(x); }
+Panshilar::StringSplitType* PNSLR_Bindings_Convert(PNSLR_StringSplitType* x) { return reinterpret_cast<Panshilar::StringSplitType*>(x); }
+PNSLR_StringSplitType& PNSLR_Bindings_Convert(Panshilar::StringSplitType& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::StringSplitType& PNSLR_Bindings_Convert(PNSLR_StringSplitType& x) { return *PNSLR_Bindings_Convert(&x); }
+
+struct PNSLR_StringSplitIterator
+{
+   PNSLR_UTF8STR remaining;
+   PNSLR_UTF8STR separator;
+   u8 separatorByte;
+   PNSLR_StringSplitType type;
+   PNSLR_StringComparisonType comparisonType;
+   b8 finished;
+};
+static_assert(sizeof(PNSLR_StringSplitIterator) == sizeof(Panshilar::StringSplitIterator), "size mismatch");
+static_assert(alignof(PNSLR_StringSplitIterator) == alignof(Panshilar::StringSplitIterator), "align mismatch");
+PNSLR_StringSplitIterator* PNSLR_Bindings_Convert(Panshilar::StringSplitIterator* x) { return reinterpret_cast<PNSLR_StringSplitIterator*>(x); }
+Panshilar::StringSplitIterator* PNSLR_Bindings_Convert(PNSLR_StringSplitIterator* x) { return reinterpret_cast<Panshilar::StringSplitIterator*>(x); }
+PNSLR_StringSplitIterator& PNSLR_Bindings_Convert(Panshilar::StringSplitIterator& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::StringSplitIterator& PNSLR_Bindings_Convert(PNSLR_StringSplitIterator& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StringSplitIterator, remaining) == PNSLR_STRUCT_OFFSET(Panshilar::StringSplitIterator, remaining), "remaining offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StringSplitIterator, separator) == PNSLR_STRUCT_OFFSET(Panshilar::StringSplitIterator, separator), "separator offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StringSplitIterator, separatorByte) == PNSLR_STRUCT_OFFSET(Panshilar::StringSplitIterator, separatorByte), "separatorByte offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StringSplitIterator, type) == PNSLR_STRUCT_OFFSET(Panshilar::StringSplitIterator, type), "type offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StringSplitIterator, comparisonType) == PNSLR_STRUCT_OFFSET(Panshilar::StringSplitIterator, comparisonType), "comparisonType offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StringSplitIterator, finished) == PNSLR_STRUCT_OFFSET(Panshilar::StringSplitIterator, finished), "finished offset mismatch");
+
+extern "C" PNSLR_StringSplitIterator PNSLR_SplitStringByByte(PNSLR_UTF8STR str, u8 separator);
+Panshilar::StringSplitIterator Panshilar::SplitStringByByte(utf8str str, u8 separator)
+{
+    PNSLR_StringSplitIterator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_SplitStringByByte(PNSLR_Bindings_Convert(str), PNSLR_Bindings_Convert(separator)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_StringSplitIterator PNSLR_SplitStringByString(PNSLR_UTF8STR str, PNSLR_UTF8STR separator, PNSLR_StringComparisonType comparisonType);
+Panshilar::StringSplitIterator Panshilar::SplitStringByString(utf8str str, utf8str separator, Panshilar::StringComparisonType comparisonType)
+{
+    PNSLR_StringSplitIterator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_SplitStringByString(PNSLR_Bindings_Convert(str), PNSLR_Bindings_Convert(separator), PNSLR_Bindings_Convert(comparisonType)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_StringSplitIterator PNSLR_SplitStringByAnyOf(PNSLR_UTF8STR str, PNSLR_UTF8STR separators);
+Panshilar::StringSplitIterator Panshilar::SplitStringByAnyOf(utf8str str, utf8str separators)
+{
+    PNSLR_StringSplitIterator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_SplitStringByAnyOf(PNSLR_Bindings_Convert(str), PNSLR_Bindings_Convert(separators)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_StringSplitIterator PNSLR_SplitStringByLines(PNSLR_UTF8STR str);
+Panshilar::StringSplitIterator Panshilar::SplitStringByLines(utf8str str)
+{
+    PNSLR_StringSplitIterator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_SplitStringByLines(PNSLR_Bindings_Convert(str)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_StringSplitIterator PNSLR_SplitStringByWhitespace(PNSLR_UTF8STR str);
+Panshilar::StringSplitIterator Panshilar::SplitStringByWhitespace(utf8str str)
+{
+    PNSLR_StringSplitIterator zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_SplitStringByWhitespace(PNSLR_Bindings_Convert(str)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_NextSplitFromStart(PNSLR_StringSplitIterator* iterator, PNSLR_UTF8STR* part);
+b8 Panshilar::NextSplitFromStart(Panshilar::StringSplitIterator* iterator, utf8str* part)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_NextSplitFromStart(PNSLR_Bindings_Convert(iterator), PNSLR_Bindings_Convert(part)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_NextSplitFromEnd(PNSLR_StringSplitIterator* iterator, PNSLR_UTF8STR* part);
+b8 Panshilar::NextSplitFromEnd(Panshilar::StringSplitIterator* iterator, utf8str* part)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_NextSplitFromEnd(PNSLR_Bindings_Convert(iterator), PNSLR_Bindings_Convert(part)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+enum class PNSLR_TokenType : u8 { };
+static_assert(sizeof(PNSLR_TokenType) == sizeof(Panshilar::TokenType), "size mismatch");
+static_assert(alignof(PNSLR_TokenType) == alignof(Panshilar::TokenType), "align mismatch");
+PNSLR_TokenType* PNSLR_Bindings_Convert(Panshilar::TokenType* x) { return reinterpret_cast<PNSLR_TokenType*>(x); }
+Panshilar::TokenType* PNSLR_Bindings_Convert(PNSLR_TokenType* x) { return reinterpret_cast<Panshilar::TokenType*>(x); }
+PNSLR_TokenType& PNSLR_Bindings_Convert(Panshilar::TokenType& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::TokenType& PNSLR_Bindings_Convert(PNSLR_TokenType& x) { return *PNSLR_Bindings_Convert(&x); }
+
+struct PNSLR_Token
+{
+   PNSLR_TokenType type;
+   PNSLR_UTF8STR text;
+   i32 line;
+   i32 column;
+};
+static_assert(sizeof(PNSLR_Token) == sizeof(Panshilar::Token), "size mismatch");
+static_assert(alignof(PNSLR_Token) == alignof(Panshilar::Token), "align mismatch");
+PNSLR_Token* PNSLR_Bindings_Convert(Panshilar::Token* x) { return reinterpret_cast<PNSLR_Token*>(x); }
+Panshilar::Token* PNSLR_Bindings_Convert(PNSLR_Token* x) { return reinterpret_cast<Panshilar::Token*>(x); }
+PNSLR_Token& PNSLR_Bindings_Convert(Panshilar::Token& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::Token& PNSLR_Bindings_Convert(PNSLR_Token& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_Token, type) == PNSLR_STRUCT_OFFSET(Panshilar::Token, type), "type offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_Token, text) == PNSLR_STRUCT_OFFSET(Panshilar::Token, text), "text offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_Token, line) == PNSLR_STRUCT_OFFSET(Panshilar::Token, line), "line offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_Token, column) == PNSLR_STRUCT_OFFSET(Panshilar::Token, column), "column offset mismatch");
+
+struct PNSLR_Tokenizer
+{
+   PNSLR_UTF8STR source;
+   i64 position;
+   i32 line;
+   i64 lineStart;
+   PNSLR_UTF8STR lineCommentStart;
+};
+static_assert(sizeof(PNSLR_Tokenizer) == sizeof(Panshilar::Tokenizer), "size mismatch");
+static_assert(alignof(PNSLR_Tokenizer) == alignof(Panshilar::Tokenizer), "align mismatch");
+PNSLR_Tokenizer* PNSLR_Bindings_Convert(Panshilar::Tokenizer* x) { return reinterpret_cast<PNSLR_Tokenizer*>(x); }
+Panshilar::Tokenizer* PNSLR_Bindings_Convert(PNSLR_Tokenizer* x) { return reinterpret_cast<Panshilar::Tokenizer*>(x); }
+PNSLR_Tokenizer& PNSLR_Bindings_Convert(Panshilar::Tokenizer& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::Tokenizer& PNSLR_Bindings_Convert(PNSLR_Tokenizer& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_Tokenizer, source) == PNSLR_STRUCT_OFFSET(Panshilar::Tokenizer, source), "source offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_Tokenizer, position) == PNSLR_STRUCT_OFFSET(Panshilar::Tokenizer, position), "position offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_Tokenizer, line) == PNSLR_STRUCT_OFFSET(Panshilar::Tokenizer, line), "line offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_Tokenizer, lineStart) == PNSLR_STRUCT_OFFSET(Panshilar::Tokenizer, lineStart), "lineStart offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_Tokenizer, lineCommentStart) == PNSLR_STRUCT_OFFSET(Panshilar::Tokenizer, lineCommentStart), "lineCommentStart offset mismatch");
+
+extern "C" PNSLR_Tokenizer PNSLR_MakeTokenizer(PNSLR_UTF8STR source, PNSLR_UTF8STR lineCommentStart);
+Panshilar::Tokenizer Panshilar::MakeTokenizer(utf8str source, utf8str lineCommentStart)
+{
+    PNSLR_Tokenizer zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_MakeTokenizer(PNSLR_Bindings_Convert(source), PNSLR_Bindings_Convert(lineCommentStart)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_Token PNSLR_NextToken(PNSLR_Tokenizer* tokenizer);
+Panshilar::Token Panshilar::NextToken(Panshilar::Tokenizer* tokenizer)
+{
+    PNSLR_Token zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_NextToken(PNSLR_Bindings_Convert(tokenizer)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_Token PNSLR_PeekToken(PNSLR_Tokenizer* tokenizer);
+Panshilar::Token Panshilar::PeekToken(Panshilar::Tokenizer* tokenizer)
+{
+    PNSLR_Token zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_PeekToken(PNSLR_Bindings_Convert(tokenizer)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
 struct PNSLR_EncodedRune
 {
    u8 data[4];
@@ -3882,6 +6494,42 @@ Panshilar::DecodedRune Panshilar::DecodeRune(ArraySlice<u8> s)
     PNSLR_DecodedRune zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_DecodeRune(PNSLR_Bindings_Convert(s)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
 
+extern "C" b8 PNSLR_ValidateUTF8(PNSLR_UTF8STR str);
+b8 Panshilar::ValidateUTF8(utf8str str)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_ValidateUTF8(PNSLR_Bindings_Convert(str)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" i64 PNSLR_CountRunesInString(PNSLR_UTF8STR str);
+i64 Panshilar::CountRunesInString(utf8str str)
+{
+    i64 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_CountRunesInString(PNSLR_Bindings_Convert(str)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" i64 PNSLR_GetUTF16LengthOfUTF8(PNSLR_UTF8STR str);
+i64 Panshilar::GetUTF16LengthOfUTF8(utf8str str)
+{
+    i64 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GetUTF16LengthOfUTF8(PNSLR_Bindings_Convert(str)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" i64 PNSLR_GetUTF8LengthOfUTF16(PNSLR_ArraySlice_u16 str);
+i64 Panshilar::GetUTF8LengthOfUTF16(ArraySlice<u16> str)
+{
+    i64 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GetUTF8LengthOfUTF16(PNSLR_Bindings_Convert(str)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_ArraySlice_u16 PNSLR_UTF16FromUTF8(PNSLR_UTF8STR str, PNSLR_Allocator allocator);
+ArraySlice<u16> Panshilar::UTF16FromUTF8(utf8str str, Panshilar::Allocator allocator)
+{
+    PNSLR_ArraySlice_u16 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_UTF16FromUTF8(PNSLR_Bindings_Convert(str), PNSLR_Bindings_Convert(allocator)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_UTF8STR PNSLR_UTF8FromUTF16(PNSLR_ArraySlice_u16 str, PNSLR_Allocator allocator);
+utf8str Panshilar::UTF8FromUTF16(ArraySlice<u16> str, Panshilar::Allocator allocator)
+{
+    PNSLR_UTF8STR zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_UTF8FromUTF16(PNSLR_Bindings_Convert(str), PNSLR_Bindings_Convert(allocator)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
 extern "C" PNSLR_ArraySlice_u16 PNSLR_UTF16FromUTF8WindowsOnly(PNSLR_UTF8STR str, PNSLR_Allocator allocator);
 ArraySlice<u16> Panshilar::UTF16FromUTF8WindowsOnly(utf8str str, Panshilar::Allocator allocator)
 {
@@ -4308,6 +6956,30 @@ b8 Panshilar::I64FromString(utf8str str, i64* value)
     b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_I64FromString(PNSLR_Bindings_Convert(str), PNSLR_Bindings_Convert(value)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
 
+extern "C" b8 PNSLR_F32ArrayFromString(PNSLR_UTF8STR str, u8 delimiter, PNSLR_ArraySlice_f32 output, i64* count);
+b8 Panshilar::F32ArrayFromString(utf8str str, u8 delimiter, ArraySlice<f32> output, i64* count)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_F32ArrayFromString(PNSLR_Bindings_Convert(str), PNSLR_Bindings_Convert(delimiter), PNSLR_Bindings_Convert(output), PNSLR_Bindings_Convert(count)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_F64ArrayFromString(PNSLR_UTF8STR str, u8 delimiter, PNSLR_ArraySlice_f64 output, i64* count);
+b8 Panshilar::F64ArrayFromString(utf8str str, u8 delimiter, ArraySlice<f64> output, i64* count)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_F64ArrayFromString(PNSLR_Bindings_Convert(str), PNSLR_Bindings_Convert(delimiter), PNSLR_Bindings_Convert(output), PNSLR_Bindings_Convert(count)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_U64ArrayFromString(PNSLR_UTF8STR str, u8 delimiter, PNSLR_ArraySlice_u64 output, i64* count);
+b8 Panshilar::U64ArrayFromString(utf8str str, u8 delimiter, ArraySlice<u64> output, i64* count)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_U64ArrayFromString(PNSLR_Bindings_Convert(str), PNSLR_Bindings_Convert(delimiter), PNSLR_Bindings_Convert(output), PNSLR_Bindings_Convert(count)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_I64ArrayFromString(PNSLR_UTF8STR str, u8 delimiter, PNSLR_ArraySlice_i64 output, i64* count);
+b8 Panshilar::I64ArrayFromString(utf8str str, u8 delimiter, ArraySlice<i64> output, i64* count)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_I64ArrayFromString(PNSLR_Bindings_Convert(str), PNSLR_Bindings_Convert(delimiter), PNSLR_Bindings_Convert(output), PNSLR_Bindings_Convert(count)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
 struct PNSLR_Path
 {
    PNSLR_UTF8STR path;
@@ -4366,6 +7038,42 @@ void Panshilar::IterateDirectory(Panshilar::Path path, b8 recursive, rawptr visi
     PNSLR_IterateDirectory(PNSLR_Bindings_Convert(path), PNSLR_Bindings_Convert(recursive), PNSLR_Bindings_Convert(visitorPayload), PNSLR_Bindings_Convert(visitorFunc));
 }
 
+struct PNSLR_DirectoryWalkEntry
+{
+   PNSLR_Path path;
+   PNSLR_UTF8STR name;
+   b8 isDirectory;
+   i32 depth;
+   i64 size;
+   i64 timestamp;
+};
+static_assert(sizeof(PNSLR_DirectoryWalkEntry) == sizeof(Panshilar::DirectoryWalkEntry), "size mismatch");
+static_assert(alignof(PNSLR_DirectoryWalkEntry) == alignof(Panshilar::DirectoryWalkEntry), "align mismatch");
+PNSLR_DirectoryWalkEntry* PNSLR_Bindings_Convert(Panshilar::DirectoryWalkEntry* x) { return reinterpret_cast<PNSLR_DirectoryWalkEntry*>(x); }
+Panshilar::DirectoryWalkEntry* PNSLR_Bindings_Convert(PNSLR_DirectoryWalkEntry* x) { return reinterpret_cast<Panshilar::DirectoryWalkEntry*>(x); }
+PNSLR_DirectoryWalkEntry& PNSLR_Bindings_Convert(Panshilar::DirectoryWalkEntry& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::DirectoryWalkEntry& PNSLR_Bindings_Convert(PNSLR_DirectoryWalkEntry& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_DirectoryWalkEntry, path) == PNSLR_STRUCT_OFFSET(Panshilar::DirectoryWalkEntry, path), "path offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_DirectoryWalkEntry, name) == PNSLR_STRUCT_OFFSET(Panshilar::DirectoryWalkEntry, name), "name offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_DirectoryWalkEntry, isDirectory) == PNSLR_STRUCT_OFFSET(Panshilar::DirectoryWalkEntry, isDirectory), "isDirectory offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_DirectoryWalkEntry, depth) == PNSLR_STRUCT_OFFSET(Panshilar::DirectoryWalkEntry, depth), "depth offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_DirectoryWalkEntry, size) == PNSLR_STRUCT_OFFSET(Panshilar::DirectoryWalkEntry, size), "size offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_DirectoryWalkEntry, timestamp) == PNSLR_STRUCT_OFFSET(Panshilar::DirectoryWalkEntry, timestamp), "timestamp offset mismatch");
+
+extern "C" typedef b8 (*PNSLR_DirectoryWalkVisitorDelegate)(rawptr payload, PNSLR_DirectoryWalkEntry entry, b8* exploreCurrentDirectory);
+static_assert(sizeof(PNSLR_DirectoryWalkVisitorDelegate) == sizeof(Panshilar::DirectoryWalkVisitorDelegate), "size mismatch");
+static_assert(alignof(PNSLR_DirectoryWalkVisitorDelegate) == alignof(Panshilar::DirectoryWalkVisitorDelegate), "align mismatch");
+PNSLR_DirectoryWalkVisitorDelegate* PNSLR_Bindings_Convert(Panshilar::DirectoryWalkVisitorDelegate* x) { return reinterpret_cast<PNSLR_DirectoryWalkVisitorDelegate*>(x); }
+Panshilar::DirectoryWalkVisitorDelegate* PNSLR_Bindings_Convert(PNSLR_DirectoryWalkVisitorDelegate* x) { return reinterpret_cast<Panshilar::DirectoryWalkVisitorDelegate*>(x); }
+PNSLR_DirectoryWalkVisitorDelegate& PNSLR_Bindings_Convert(Panshilar::DirectoryWalkVisitorDelegate& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::DirectoryWalkVisitorDelegate& PNSLR_Bindings_Convert(PNSLR_DirectoryWalkVisitorDelegate& x) { return *PNSLR_Bindings_Convert(&x); }
+
+extern "C" b8 PNSLR_WalkDirectoryTree(PNSLR_Path path, rawptr visitorPayload, PNSLR_DirectoryWalkVisitorDelegate visitorFunc, b8 querySizeAndTimestamp, i32 numWorkerThreads);
+b8 Panshilar::WalkDirectoryTree(Panshilar::Path path, rawptr visitorPayload, Panshilar::DirectoryWalkVisitorDelegate visitorFunc, b8 querySizeAndTimestamp, i32 numWorkerThreads)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_WalkDirectoryTree(PNSLR_Bindings_Convert(path), PNSLR_Bindings_Convert(visitorPayload), PNSLR_Bindings_Convert(visitorFunc), PNSLR_Bindings_Convert(querySizeAndTimestamp), PNSLR_Bindings_Convert(numWorkerThreads)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
 enum class PNSLR_PathExistsCheckType : u8 { };
 static_assert(sizeof(PNSLR_PathExistsCheckType) == sizeof(Panshilar::PathExistsCheckType), "size mismatch");
 static_assert(alignof(PNSLR_PathExistsCheckType) == alignof(Panshilar::PathExistsCheckType), "align mismatch");
@@ -4458,6 +7166,30 @@ b8 Panshilar::WriteToFile(Panshilar::File handle, ArraySlice<u8> src)
     b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_WriteToFile(PNSLR_Bindings_Convert(handle), PNSLR_Bindings_Convert(src)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
 
+extern "C" b8 PNSLR_ReadFromFileAt(PNSLR_File handle, i64 offset, PNSLR_ArraySlice_u8 dst, i64* readSize);
+b8 Panshilar::ReadFromFileAt(Panshilar::File handle, i64 offset, ArraySlice<u8> dst, i64* readSize)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_ReadFromFileAt(PNSLR_Bindings_Convert(handle), PNSLR_Bindings_Convert(offset), PNSLR_Bindings_Convert(dst), PNSLR_Bindings_Convert(readSize)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_WriteToFileAt(PNSLR_File handle, i64 offset, PNSLR_ArraySlice_u8 src);
+b8 Panshilar::WriteToFileAt(Panshilar::File handle, i64 offset, ArraySlice<u8> src)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_WriteToFileAt(PNSLR_Bindings_Convert(handle), PNSLR_Bindings_Convert(offset), PNSLR_Bindings_Convert(src)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_ScatterReadFromFileAt(PNSLR_File handle, i64 offset, PNSLR_ArraySlice_PNSLR_UTF8STR dsts, i64* readSize);
+b8 Panshilar::ScatterReadFromFileAt(Panshilar::File handle, i64 offset, ArraySlice<utf8str> dsts, i64* readSize)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_ScatterReadFromFileAt(PNSLR_Bindings_Convert(handle), PNSLR_Bindings_Convert(offset), PNSLR_Bindings_Convert(dsts), PNSLR_Bindings_Convert(readSize)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_GatherWriteToFileAt(PNSLR_File handle, i64 offset, PNSLR_ArraySlice_PNSLR_UTF8STR srcs);
+b8 Panshilar::GatherWriteToFileAt(Panshilar::File handle, i64 offset, ArraySlice<utf8str> srcs)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GatherWriteToFileAt(PNSLR_Bindings_Convert(handle), PNSLR_Bindings_Convert(offset), PNSLR_Bindings_Convert(srcs)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
 extern "C" b8 PNSLR_FormatAndWriteToFile(PNSLR_File handle, PNSLR_UTF8STR fmtStr, PNSLR_ArraySlice_PNSLR_PrimitiveFmtOptions args);
 b8 Panshilar::FormatAndWriteToFile(Panshilar::File handle, utf8str fmtStr, ArraySlice<Panshilar::PrimitiveFmtOptions> args)
 {
@@ -4500,12 +7232,58 @@ b8 Panshilar::CopyFile(Panshilar::Path src, Panshilar::Path dst)
     b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_CopyFile(PNSLR_Bindings_Convert(src), PNSLR_Bindings_Convert(dst)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
 
+extern "C" b8 PNSLR_CopyDirectoryTree(PNSLR_Path src, PNSLR_Path dst, i32 numWorkerThreads);
+b8 Panshilar::CopyDirectoryTree(Panshilar::Path src, Panshilar::Path dst, i32 numWorkerThreads)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_CopyDirectoryTree(PNSLR_Bindings_Convert(src), PNSLR_Bindings_Convert(dst), PNSLR_Bindings_Convert(numWorkerThreads)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
 extern "C" b8 PNSLR_MoveFile(PNSLR_Path src, PNSLR_Path dst);
 b8 Panshilar::MoveFile(Panshilar::Path src, Panshilar::Path dst)
 {
     b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_MoveFile(PNSLR_Bindings_Convert(src), PNSLR_Bindings_Convert(dst)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
 
+enum class PNSLR_FileMappingAccess : u8 { };
+static_assert(sizeof(PNSLR_FileMappingAccess) == sizeof(Panshilar::FileMappingAccess), "size mismatch");
+static_assert(alignof(PNSLR_FileMappingAccess) == alignof(Panshilar::FileMappingAccess), "align mismatch");
+PNSLR_FileMappingAccess* PNSLR_Bindings_Convert(Panshilar::FileMappingAccess* x) { return reinterpret_cast<PNSLR_FileMappingAccess*>(x); }
+Panshilar::FileMappingAccess* PNSLR_Bindings_Convert(PNSLR_FileMappingAccess* x) { return reinterpret_cast<Panshilar::FileMappingAccess*>(x); }
+PNSLR_FileMappingAccess& PNSLR_Bindings_Convert(Panshilar::FileMappingAccess& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::FileMappingAccess& PNSLR_Bindings_Convert(PNSLR_FileMappingAccess& x) { return *PNSLR_Bindings_Convert(&x); }
+
+enum class PNSLR_FileMappingHint : u8 { };
+static_assert(sizeof(PNSLR_FileMappingHint) == sizeof(Panshilar::FileMappingHint), "size mismatch");
+static_assert(alignof(PNSLR_FileMappingHint) == alignof(Panshilar::FileMappingHint), "align mismatch");
+PNSLR_FileMappingHint* PNSLR_Bindings_Convert(Panshilar::FileMappingHint* x) { return reinterpret_cast<PNSLR_FileMappingHint*>(x); }
+Panshilar::FileMappingHint* PNSLR_Bindings_Convert(PNSLR_FileMappingHint* x) { return reinterpret_cast<Panshilar::FileMappingHint*>(x); }
+PNSLR_FileMappingHint& PNSLR_Bindings_Convert(Panshilar::FileMappingHint& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::FileMappingHint& PNSLR_Bindings_Convert(PNSLR_FileMappingHint& x) { return *PNSLR_Bindings_Convert(&x); }
+
+extern "C" PNSLR_ArraySlice_u8 PNSLR_MapFile(PNSLR_File handle, PNSLR_FileMappingAccess access, i64 offset, i64 size);
+ArraySlice<u8> Panshilar::MapFile(Panshilar::File handle, Panshilar::FileMappingAccess access, i64 offset, i64 size)
+{
+    PNSLR_ArraySlice_u8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_MapFile(PNSLR_Bindings_Convert(handle), PNSLR_Bindings_Convert(access), PNSLR_Bindings_Convert(offset), PNSLR_Bindings_Convert(size)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_AdviseFileMapping(PNSLR_ArraySlice_u8 range, PNSLR_FileMappingHint hint);
+b8 Panshilar::AdviseFileMapping(ArraySlice<u8> range, Panshilar::FileMappingHint hint)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_AdviseFileMapping(PNSLR_Bindings_Convert(range), PNSLR_Bindings_Convert(hint)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_FlushFileMapping(PNSLR_ArraySlice_u8 range);
+b8 Panshilar::FlushFileMapping(ArraySlice<u8> range)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_FlushFileMapping(PNSLR_Bindings_Convert(range)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_UnmapFile(PNSLR_ArraySlice_u8 mapping);
+void Panshilar::UnmapFile(ArraySlice<u8> mapping)
+{
+    PNSLR_UnmapFile(PNSLR_Bindings_Convert(mapping));
+}
+
 struct PNSLR_DynamicLibrary
 {
    rawptr handle;
@@ -4782,6 +7560,40 @@ void Panshilar::CloseStream(Panshilar::Stream stream)
     PNSLR_CloseStream(PNSLR_Bindings_Convert(stream));
 }
 
+struct PNSLR_CompiledFormat
+{
+   PNSLR_ArraySlice_PNSLR_UTF8STR literals;
+   i64 literalsLength;
+   PNSLR_Allocator allocator;
+};
+static_assert(sizeof(PNSLR_CompiledFormat) == sizeof(Panshilar::CompiledFormat), "size mismatch");
+static_assert(alignof(PNSLR_CompiledFormat) == alignof(Panshilar::CompiledFormat), "align mismatch");
+PNSLR_CompiledFormat* PNSLR_Bindings_Convert(Panshilar::CompiledFormat* x) { return reinterpret_cast<PNSLR_CompiledFormat*>(x); }
+Panshilar::CompiledFormat* PNSLR_Bindings_Convert(PNSLR_CompiledFormat* x) { return reinterpret_cast<Panshilar::CompiledFormat*>(x); }
+PNSLR_CompiledFormat& PNSLR_Bindings_Convert(Panshilar::CompiledFormat& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::CompiledFormat& PNSLR_Bindings_Convert(PNSLR_CompiledFormat& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_CompiledFormat, literals) == PNSLR_STRUCT_OFFSET(Panshilar::CompiledFormat, literals), "literals offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_CompiledFormat, literalsLength) == PNSLR_STRUCT_OFFSET(Panshilar::CompiledFormat, literalsLength), "literalsLength offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_CompiledFormat, allocator) == PNSLR_STRUCT_OFFSET(Panshilar::CompiledFormat, allocator), "allocator offset mismatch");
+
+extern "C" PNSLR_CompiledFormat PNSLR_CompileFormat(PNSLR_UTF8STR fmtStr, PNSLR_Allocator allocator);
+Panshilar::CompiledFormat Panshilar::CompileFormat(utf8str fmtStr, Panshilar::Allocator allocator)
+{
+    PNSLR_CompiledFormat zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_CompileFormat(PNSLR_Bindings_Convert(fmtStr), PNSLR_Bindings_Convert(allocator)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_FreeCompiledFormat(PNSLR_CompiledFormat* format);
+void Panshilar::FreeCompiledFormat(Panshilar::CompiledFormat* format)
+{
+    PNSLR_FreeCompiledFormat(PNSLR_Bindings_Convert(format));
+}
+
+extern "C" b8 PNSLR_FormatCompiledAndWriteToStream(PNSLR_Stream stream, PNSLR_CompiledFormat* format, PNSLR_ArraySlice_PNSLR_PrimitiveFmtOptions args);
+b8 Panshilar::FormatCompiledAndWriteToStream(Panshilar::Stream stream, Panshilar::CompiledFormat* format, ArraySlice<Panshilar::PrimitiveFmtOptions> args)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_FormatCompiledAndWriteToStream(PNSLR_Bindings_Convert(stream), PNSLR_Bindings_Convert(format), PNSLR_Bindings_Convert(args)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
 extern "C" PNSLR_Stream PNSLR_StreamFromFile(PNSLR_File file);
 Panshilar::Stream Panshilar::StreamFromFile(Panshilar::File file)
 {
@@ -4794,6 +7606,28 @@ Panshilar::Stream Panshilar::StreamFromStringBuilder(Panshilar::StringBuilder* b
     PNSLR_Stream zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_StreamFromStringBuilder(PNSLR_Bindings_Convert(builder)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
 
+struct PNSLR_FileMappingStream
+{
+   PNSLR_ArraySlice_u8 mapping;
+   PNSLR_FileMappingAccess access;
+   i64 cursorPos;
+};
+static_assert(sizeof(PNSLR_FileMappingStream) == sizeof(Panshilar::FileMappingStream), "size mismatch");
+static_assert(alignof(PNSLR_FileMappingStream) == alignof(Panshilar::FileMappingStream), "align mismatch");
+PNSLR_FileMappingStream* PNSLR_Bindings_Convert(Panshilar::FileMappingStream* x) { return reinterpret_cast<PNSLR_FileMappingStream*>(x); }
+Panshilar::FileMappingStream* PNSLR_Bindings_Convert(PNSLR_FileMappingStream* x) { return reinterpret_cast<Panshilar::FileMappingStream*>(x); }
+PNSLR_FileMappingStream& PNSLR_Bindings_Convert(Panshilar::FileMappingStream& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::FileMappingStream& PNSLR_Bindings_Convert(PNSLR_FileMappingStream& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FileMappingStream, mapping) == PNSLR_STRUCT_OFFSET(Panshilar::FileMappingStream, mapping), "mapping offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FileMappingStream, access) == PNSLR_STRUCT_OFFSET(Panshilar::FileMappingStream, access), "access offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_FileMappingStream, cursorPos) == PNSLR_STRUCT_OFFSET(Panshilar::FileMappingStream, cursorPos), "cursorPos offset mismatch");
+
+extern "C" PNSLR_Stream PNSLR_StreamFromFileMapping(PNSLR_FileMappingStream* mappingStream);
+Panshilar::Stream Panshilar::StreamFromFileMapping(Panshilar::FileMappingStream* mappingStream)
+{
+    PNSLR_Stream zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_StreamFromFileMapping(PNSLR_Bindings_Convert(mappingStream)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
 extern "C" PNSLR_Stream PNSLR_StreamFromStdOut(b8 disableBuffering);
 Panshilar::Stream Panshilar::StreamFromStdOut(b8 disableBuffering)
 {
@@ -4806,6 +7640,12 @@ Panshilar::Stream Panshilar::StreamFromStdErr(b8 disableBuffering)
     PNSLR_Stream zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_StreamFromStdErr(PNSLR_Bindings_Convert(disableBuffering)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
 
+extern "C" b8 PNSLR_WriteTrackingAllocatorReportToStream(PNSLR_Stream stream, PNSLR_Allocator trackingAllocator, PNSLR_Allocator tempAllocator, i32 maxCallSites);
+b8 Panshilar::WriteTrackingAllocatorReportToStream(Panshilar::Stream stream, Panshilar::Allocator trackingAllocator, Panshilar::Allocator tempAllocator, i32 maxCallSites)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_WriteTrackingAllocatorReportToStream(PNSLR_Bindings_Convert(stream), PNSLR_Bindings_Convert(trackingAllocator), PNSLR_Bindings_Convert(tempAllocator), PNSLR_Bindings_Convert(maxCallSites)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
 enum class PNSLR_LoggerLevel : u8 { };
 static_assert(sizeof(PNSLR_LoggerLevel) == sizeof(Panshilar::LoggerLevel), "size mismatch");
 static_assert(alignof(PNSLR_LoggerLevel) == alignof(Panshilar::LoggerLevel), "align mismatch");
@@ -5286,6 +8126,206 @@ b8 Panshilar::DisconnectSharedMemoryChannelWriter(Panshilar::SharedMemoryChannel
     b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_DisconnectSharedMemoryChannelWriter(PNSLR_Bindings_Convert(writer)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
 }
 
+struct PNSLR_StringInterner
+{
+   rawptr data;
+};
+static_assert(sizeof(PNSLR_StringInterner) == sizeof(Panshilar::StringInterner), "size mismatch");
+static_assert(alignof(PNSLR_StringInterner) == alignof(Panshilar::StringInterner), "align mismatch");
+PNSLR_StringInterner* PNSLR_Bindings_Convert(Panshilar::StringInterner* x) { return reinterpret_cast<PNSLR_StringInterner*>(x); }
+Panshilar::StringInterner* PNSLR_Bindings_Convert(PNSLR_StringInterner* x) { return reinterpret_cast<Panshilar::StringInterner*>(x); }
+PNSLR_StringInterner& PNSLR_Bindings_Convert(Panshilar::StringInterner& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::StringInterner& PNSLR_Bindings_Convert(PNSLR_StringInterner& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_StringInterner, data) == PNSLR_STRUCT_OFFSET(Panshilar::StringInterner, data), "data offset mismatch");
+
+extern "C" PNSLR_StringInterner PNSLR_CreateStringInterner(PNSLR_Allocator allocator);
+Panshilar::StringInterner Panshilar::CreateStringInterner(Panshilar::Allocator allocator)
+{
+    PNSLR_StringInterner zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_CreateStringInterner(PNSLR_Bindings_Convert(allocator)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_DestroyStringInterner(PNSLR_StringInterner* interner);
+void Panshilar::DestroyStringInterner(Panshilar::StringInterner* interner)
+{
+    PNSLR_DestroyStringInterner(PNSLR_Bindings_Convert(interner));
+}
+
+extern "C" u32 PNSLR_InternString(PNSLR_StringInterner interner, PNSLR_UTF8STR str);
+u32 Panshilar::InternString(Panshilar::StringInterner interner, utf8str str)
+{
+    u32 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_InternString(PNSLR_Bindings_Convert(interner), PNSLR_Bindings_Convert(str)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" u32 PNSLR_FindInternedString(PNSLR_StringInterner interner, PNSLR_UTF8STR str);
+u32 Panshilar::FindInternedString(Panshilar::StringInterner interner, utf8str str)
+{
+    u32 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_FindInternedString(PNSLR_Bindings_Convert(interner), PNSLR_Bindings_Convert(str)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_UTF8STR PNSLR_GetInternedString(PNSLR_StringInterner interner, u32 handle);
+utf8str Panshilar::GetInternedString(Panshilar::StringInterner interner, u32 handle)
+{
+    PNSLR_UTF8STR zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GetInternedString(PNSLR_Bindings_Convert(interner), PNSLR_Bindings_Convert(handle)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" i64 PNSLR_GetInternedStringsCount(PNSLR_StringInterner interner);
+i64 Panshilar::GetInternedStringsCount(Panshilar::StringInterner interner)
+{
+    i64 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GetInternedStringsCount(PNSLR_Bindings_Convert(interner)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_SaveStringInternerToFile(PNSLR_StringInterner interner, PNSLR_Path path);
+b8 Panshilar::SaveStringInternerToFile(Panshilar::StringInterner interner, Panshilar::Path path)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_SaveStringInternerToFile(PNSLR_Bindings_Convert(interner), PNSLR_Bindings_Convert(path)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" PNSLR_StringInterner PNSLR_LoadStringInternerFromFile(PNSLR_Path path, PNSLR_Allocator allocator);
+Panshilar::StringInterner Panshilar::LoadStringInternerFromFile(Panshilar::Path path, Panshilar::Allocator allocator)
+{
+    PNSLR_StringInterner zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_LoadStringInternerFromFile(PNSLR_Bindings_Convert(path), PNSLR_Bindings_Convert(allocator)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+enum class PNSLR_AsyncIOOperation : u8 { };
+static_assert(sizeof(PNSLR_AsyncIOOperation) == sizeof(Panshilar::AsyncIOOperation), "size mismatch");
+static_assert(alignof(PNSLR_AsyncIOOperation) == alignof(Panshilar::AsyncIOOperation), "align mismatch");
+PNSLR_AsyncIOOperation* PNSLR_Bindings_Convert(Panshilar::AsyncIOOperation* x) { return reinterpret_cast<PNSLR_AsyncIOOperation*>(x); }
+Panshilar::AsyncIOOperation* PNSLR_Bindings_Convert(PNSLR_AsyncIOOperation* x) { return reinterpret_cast<Panshilar::AsyncIOOperation*>(x); }
+PNSLR_AsyncIOOperation& PNSLR_Bindings_Convert(Panshilar::AsyncIOOperation& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::AsyncIOOperation& PNSLR_Bindings_Convert(PNSLR_AsyncIOOperation& x) { return *PNSLR_Bindings_Convert(&x); }
+
+struct PNSLR_AsyncIORequest
+{
+   PNSLR_File file;
+   PNSLR_AsyncIOOperation operation;
+   i64 offset;
+   PNSLR_ArraySlice_u8 buffer;
+   u64 userData;
+};
+static_assert(sizeof(PNSLR_AsyncIORequest) == sizeof(Panshilar::AsyncIORequest), "size mismatch");
+static_assert(alignof(PNSLR_AsyncIORequest) == alignof(Panshilar::AsyncIORequest), "align mismatch");
+PNSLR_AsyncIORequest* PNSLR_Bindings_Convert(Panshilar::AsyncIORequest* x) { return reinterpret_cast<PNSLR_AsyncIORequest*>(x); }
+Panshilar::AsyncIORequest* PNSLR_Bindings_Convert(PNSLR_AsyncIORequest* x) { return reinterpret_cast<Panshilar::AsyncIORequest*>(x); }
+PNSLR_AsyncIORequest& PNSLR_Bindings_Convert(Panshilar::AsyncIORequest& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::AsyncIORequest& PNSLR_Bindings_Convert(PNSLR_AsyncIORequest& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_AsyncIORequest, file) == PNSLR_STRUCT_OFFSET(Panshilar::AsyncIORequest, file), "file offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_AsyncIORequest, operation) == PNSLR_STRUCT_OFFSET(Panshilar::AsyncIORequest, operation), "operation offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_AsyncIORequest, offset) == PNSLR_STRUCT_OFFSET(Panshilar::AsyncIORequest, offset), "offset offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_AsyncIORequest, buffer) == PNSLR_STRUCT_OFFSET(Panshilar::AsyncIORequest, buffer), "buffer offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_AsyncIORequest, userData) == PNSLR_STRUCT_OFFSET(Panshilar::AsyncIORequest, userData), "userData offset mismatch");
+
+typedef struct { PNSLR_AsyncIORequest* data; i64 count; } PNSLR_ArraySlice_PNSLR_AsyncIORequest;
+static_assert(sizeof(PNSLR_ArraySlice_PNSLR_AsyncIORequest) == sizeof(ArraySlice<Panshilar::AsyncIORequest>), "size mismatch");
+static_assert(alignof(PNSLR_ArraySlice_PNSLR_AsyncIORequest) == alignof(ArraySlice<Panshilar::AsyncIORequest>), "align mismatch");
+PNSLR_ArraySlice_PNSLR_AsyncIORequest* PNSLR_Bindings_Convert(ArraySlice<Panshilar::AsyncIORequest>* x) { return reinterpret_cast<PNSLR_ArraySlice_PNSLR_AsyncIORequest*>(x); }
+ArraySlice<Panshilar::AsyncIORequest>* PNSLR_Bindings_Convert(PNSLR_ArraySlice_PNSLR_AsyncIORequest* x) { return reinterpret_cast<ArraySlice<Panshilar::AsyncIORequest>*>(x); }
+PNSLR_ArraySlice_PNSLR_AsyncIORequest& PNSLR_Bindings_Convert(ArraySlice<Panshilar::AsyncIORequest>& x) { return *PNSLR_Bindings_Convert(&x); }
+ArraySlice<Panshilar::AsyncIORequest>& PNSLR_Bindings_Convert(PNSLR_ArraySlice_PNSLR_AsyncIORequest& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ArraySlice_PNSLR_AsyncIORequest, count) == PNSLR_STRUCT_OFFSET(ArraySlice<Panshilar::AsyncIORequest>, count), "count offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ArraySlice_PNSLR_AsyncIORequest, data) == PNSLR_STRUCT_OFFSET(ArraySlice<Panshilar::AsyncIORequest>, data), "data offset mismatch");
+
+enum class PNSLR_AsyncIOStatus : u8 { };
+static_assert(sizeof(PNSLR_AsyncIOStatus) == sizeof(Panshilar::AsyncIOStatus), "size mismatch");
+static_assert(alignof(PNSLR_AsyncIOStatus) == alignof(Panshilar::AsyncIOStatus), "align mismatch");
+PNSLR_AsyncIOStatus* PNSLR_Bindings_Convert(Panshilar::AsyncIOStatus* x) { return reinterpret_cast<PNSLR_AsyncIOStatus*>(x); }
+Panshilar::AsyncIOStatus* PNSLR_Bindings_Convert(PNSLR_AsyncIOStatus* x) { return reinterpret_cast<Panshilar::AsyncIOStatus*>(x); }
+PNSLR_AsyncIOStatus& PNSLR_Bindings_Convert(Panshilar::AsyncIOStatus& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::AsyncIOStatus& PNSLR_Bindings_Convert(PNSLR_AsyncIOStatus& x) { return *PNSLR_Bindings_Convert(&x); }
+
+struct PNSLR_AsyncIOCompletion
+{
+   u64 userData;
+   i64 bytesTransferred;
+   PNSLR_AsyncIOStatus status;
+};
+static_assert(sizeof(PNSLR_AsyncIOCompletion) == sizeof(Panshilar::AsyncIOCompletion), "size mismatch");
+static_assert(alignof(PNSLR_AsyncIOCompletion) == alignof(Panshilar::AsyncIOCompletion), "align mismatch");
+PNSLR_AsyncIOCompletion* PNSLR_Bindings_Convert(Panshilar::AsyncIOCompletion* x) { return reinterpret_cast<PNSLR_AsyncIOCompletion*>(x); }
+Panshilar::AsyncIOCompletion* PNSLR_Bindings_Convert(PNSLR_AsyncIOCompletion* x) { return reinterpret_cast<Panshilar::AsyncIOCompletion*>(x); }
+PNSLR_AsyncIOCompletion& PNSLR_Bindings_Convert(Panshilar::AsyncIOCompletion& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::AsyncIOCompletion& PNSLR_Bindings_Convert(PNSLR_AsyncIOCompletion& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_AsyncIOCompletion, userData) == PNSLR_STRUCT_OFFSET(Panshilar::AsyncIOCompletion, userData), "userData offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_AsyncIOCompletion, bytesTransferred) == PNSLR_STRUCT_OFFSET(Panshilar::AsyncIOCompletion, bytesTransferred), "bytesTransferred offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_AsyncIOCompletion, status) == PNSLR_STRUCT_OFFSET(Panshilar::AsyncIOCompletion, status), "status offset mismatch");
+
+typedef struct { PNSLR_AsyncIOCompletion* data; i64 count; } PNSLR_ArraySlice_PNSLR_AsyncIOCompletion;
+static_assert(sizeof(PNSLR_ArraySlice_PNSLR_AsyncIOCompletion) == sizeof(ArraySlice<Panshilar::AsyncIOCompletion>), "size mismatch");
+static_assert(alignof(PNSLR_ArraySlice_PNSLR_AsyncIOCompletion) == alignof(ArraySlice<Panshilar::AsyncIOCompletion>), "align mismatch");
+PNSLR_ArraySlice_PNSLR_AsyncIOCompletion* PNSLR_Bindings_Convert(ArraySlice<Panshilar::AsyncIOCompletion>* x) { return reinterpret_cast<PNSLR_ArraySlice_PNSLR_AsyncIOCompletion*>(x); }
+ArraySlice<Panshilar::AsyncIOCompletion>* PNSLR_Bindings_Convert(PNSLR_ArraySlice_PNSLR_AsyncIOCompletion* x) { return reinterpret_cast<ArraySlice<Panshilar::AsyncIOCompletion>*>(x); }
+PNSLR_ArraySlice_PNSLR_AsyncIOCompletion& PNSLR_Bindings_Convert(ArraySlice<Panshilar::AsyncIOCompletion>& x) { return *PNSLR_Bindings_Convert(&x); }
+ArraySlice<Panshilar::AsyncIOCompletion>& PNSLR_Bindings_Convert(PNSLR_ArraySlice_PNSLR_AsyncIOCompletion& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ArraySlice_PNSLR_AsyncIOCompletion, count) == PNSLR_STRUCT_OFFSET(ArraySlice<Panshilar::AsyncIOCompletion>, count), "count offset mismatch");
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_ArraySlice_PNSLR_AsyncIOCompletion, data) == PNSLR_STRUCT_OFFSET(ArraySlice<Panshilar::AsyncIOCompletion>, data), "data offset mismatch");
+
+enum class PNSLR_AsyncIOBackend : u8 { };
+static_assert(sizeof(PNSLR_AsyncIOBackend) == sizeof(Panshilar::AsyncIOBackend), "size mismatch");
+static_assert(alignof(PNSLR_AsyncIOBackend) == alignof(Panshilar::AsyncIOBackend), "align mismatch");
+PNSLR_AsyncIOBackend* PNSLR_Bindings_Convert(Panshilar::AsyncIOBackend* x) { return reinterpret_cast<PNSLR_AsyncIOBackend*>(x); }
+Panshilar::AsyncIOBackend* PNSLR_Bindings_Convert(PNSLR_AsyncIOBackend* x) { return reinterpret_cast<Panshilar::AsyncIOBackend*>(x); }
+PNSLR_AsyncIOBackend& PNSLR_Bindings_Convert(Panshilar::AsyncIOBackend& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::AsyncIOBackend& PNSLR_Bindings_Convert(PNSLR_AsyncIOBackend& x) { return *PNSLR_Bindings_Convert(&x); }
+
+struct PNSLR_AsyncIOQueue
+{
+   rawptr data;
+};
+static_assert(sizeof(PNSLR_AsyncIOQueue) == sizeof(Panshilar::AsyncIOQueue), "size mismatch");
+static_assert(alignof(PNSLR_AsyncIOQueue) == alignof(Panshilar::AsyncIOQueue), "align mismatch");
+PNSLR_AsyncIOQueue* PNSLR_Bindings_Convert(Panshilar::AsyncIOQueue* x) { return reinterpret_cast<PNSLR_AsyncIOQueue*>(x); }
+Panshilar::AsyncIOQueue* PNSLR_Bindings_Convert(PNSLR_AsyncIOQueue* x) { return reinterpret_cast<Panshilar::AsyncIOQueue*>(x); }
+PNSLR_AsyncIOQueue& PNSLR_Bindings_Convert(Panshilar::AsyncIOQueue& x) { return *PNSLR_Bindings_Convert(&x); }
+Panshilar::AsyncIOQueue& PNSLR_Bindings_Convert(PNSLR_AsyncIOQueue& x) { return *PNSLR_Bindings_Convert(&x); }
+static_assert(PNSLR_STRUCT_OFFSET(PNSLR_AsyncIOQueue, data) == PNSLR_STRUCT_OFFSET(Panshilar::AsyncIOQueue, data), "data offset mismatch");
+
+extern "C" PNSLR_AsyncIOQueue PNSLR_CreateAsyncIOQueue(PNSLR_Allocator allocator, i32 capacity, PNSLR_AsyncIOBackend backend, i32 numWorkerThreads);
+Panshilar::AsyncIOQueue Panshilar::CreateAsyncIOQueue(Panshilar::Allocator allocator, i32 capacity, Panshilar::AsyncIOBackend backend, i32 numWorkerThreads)
+{
+    PNSLR_AsyncIOQueue zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_CreateAsyncIOQueue(PNSLR_Bindings_Convert(allocator), PNSLR_Bindings_Convert(capacity), PNSLR_Bindings_Convert(backend), PNSLR_Bindings_Convert(numWorkerThreads)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" void PNSLR_DestroyAsyncIOQueue(PNSLR_AsyncIOQueue* queue);
+void Panshilar::DestroyAsyncIOQueue(Panshilar::AsyncIOQueue* queue)
+{
+    PNSLR_DestroyAsyncIOQueue(PNSLR_Bindings_Convert(queue));
+}
+
+extern "C" PNSLR_AsyncIOBackend PNSLR_GetAsyncIOQueueBackend(PNSLR_AsyncIOQueue queue);
+Panshilar::AsyncIOBackend Panshilar::GetAsyncIOQueueBackend(Panshilar::AsyncIOQueue queue)
+{
+    PNSLR_AsyncIOBackend zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GetAsyncIOQueueBackend(PNSLR_Bindings_Convert(queue)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" i32 PNSLR_SubmitAsyncIORequests(PNSLR_AsyncIOQueue queue, PNSLR_ArraySlice_PNSLR_AsyncIORequest requests);
+i32 Panshilar::SubmitAsyncIORequests(Panshilar::AsyncIOQueue queue, ArraySlice<Panshilar::AsyncIORequest> requests)
+{
+    i32 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_SubmitAsyncIORequests(PNSLR_Bindings_Convert(queue), PNSLR_Bindings_Convert(requests)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" i32 PNSLR_PollAsyncIOCompletions(PNSLR_AsyncIOQueue queue, PNSLR_ArraySlice_PNSLR_AsyncIOCompletion output);
+i32 Panshilar::PollAsyncIOCompletions(Panshilar::AsyncIOQueue queue, ArraySlice<Panshilar::AsyncIOCompletion> output)
+{
+    i32 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_PollAsyncIOCompletions(PNSLR_Bindings_Convert(queue), PNSLR_Bindings_Convert(output)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" i32 PNSLR_WaitForAsyncIOCompletions(PNSLR_AsyncIOQueue queue, PNSLR_ArraySlice_PNSLR_AsyncIOCompletion output, i32 minCompletions);
+i32 Panshilar::WaitForAsyncIOCompletions(Panshilar::AsyncIOQueue queue, ArraySlice<Panshilar::AsyncIOCompletion> output, i32 minCompletions)
+{
+    i32 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_WaitForAsyncIOCompletions(PNSLR_Bindings_Convert(queue), PNSLR_Bindings_Convert(output), PNSLR_Bindings_Convert(minCompletions)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" i32 PNSLR_GetNumAsyncIORequestsInFlight(PNSLR_AsyncIOQueue queue);
+i32 Panshilar::GetNumAsyncIORequestsInFlight(Panshilar::AsyncIOQueue queue)
+{
+    i32 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_GetNumAsyncIORequestsInFlight(PNSLR_Bindings_Convert(queue)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
+extern "C" b8 PNSLR_CancelAsyncIORequests(PNSLR_AsyncIOQueue queue, u64 userData);
+b8 Panshilar::CancelAsyncIORequests(Panshilar::AsyncIOQueue queue, u64 userData)
+{
+    b8 zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW = PNSLR_CancelAsyncIORequests(PNSLR_Bindings_Convert(queue), PNSLR_Bindings_Convert(userData)); return PNSLR_Bindings_Convert(zzzz_RetValXYZABCDEFGHIJKLMNOPQRSTUVW);
+}
+
 #undef PNSLR_STRUCT_OFFSET
 
 #endif//PNSLR_CXX_IMPL
@@ -470,6 +470,75 @@ foreign {
 	) ---
 }
 
+// Atomics ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Atomically loads a 64-bit integer, with sequentially-consistent ordering.
+	*/
+	AtomicLoadI64 :: proc "c" (
+		target: ^i64,
+	) -> i64 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Atomically stores a 64-bit integer, with sequentially-consistent ordering.
+	*/
+	AtomicStoreI64 :: proc "c" (
+		target: ^i64,
+		value: i64,
+	) ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Atomically adds 'value' to a 64-bit integer.
+	Returns the value it held before the addition.
+	*/
+	AtomicFetchAddI64 :: proc "c" (
+		target: ^i64,
+		value: i64,
+	) -> i64 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Atomically replaces a 64-bit integer with 'desired' if it still holds '*expected'.
+	Returns true on success; on failure, '*expected' is updated to the current value.
+	*/
+	AtomicCompareExchangeI64 :: proc "c" (
+		target: ^i64,
+		expected: ^i64,
+		desired: i64,
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Atomically loads a pointer, with sequentially-consistent ordering.
+	*/
+	AtomicLoadPtr :: proc "c" (
+		target: ^rawptr,
+	) -> rawptr ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Atomically stores a pointer, with sequentially-consistent ordering.
+	*/
+	AtomicStorePtr :: proc "c" (
+		target: ^rawptr,
+		value: rawptr,
+	) ---
+}
+
 // #######################################################################################
 // Memory
 // #######################################################################################
@@ -482,7 +551,7 @@ foreign {
 	MemSet :: proc "c" (
 		memory: rawptr,
 		value: i32,
-		size: i32,
+		size: i64,
 	) ---
 }
 
@@ -494,7 +563,7 @@ foreign {
 	MemCopy :: proc "c" (
 		destination: rawptr,
 		source: rawptr,
-		size: i32,
+		size: i64,
 	) ---
 }
 
@@ -506,10 +575,66 @@ foreign {
 	MemMove :: proc "c" (
 		destination: rawptr,
 		source: rawptr,
-		size: i32,
+		size: i64,
 	) ---
 }
 
+// Virtual Memory ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Get the size of a virtual memory page, the granularity at which memory is committed/decommitted.
+	*/
+	GetVirtualMemoryPageSize :: proc "c" () -> i32 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Reserve a range of address space without backing it with physical memory.
+	Returns nil on failure.
+	*/
+	ReserveVirtualMemory :: proc "c" (
+		size: i64,
+	) -> rawptr ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Back a (page-aligned) part of a reserved range with read-write memory.
+	Freshly committed pages are always zeroed.
+	*/
+	CommitVirtualMemory :: proc "c" (
+		memory: rawptr,
+		size: i64,
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Return the physical memory behind a (page-aligned) part of a reserved range to the OS.
+	The range stays reserved, and reads back as zeroes once committed again.
+	*/
+	DecommitVirtualMemory :: proc "c" (
+		memory: rawptr,
+		size: i64,
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Release an entire range obtained from `PNSLR_ReserveVirtualMemory`.
+	*/
+	ReleaseVirtualMemory :: proc "c" (
+		memory: rawptr,
+		size: i64,
+	) -> b8 ---
+}
+
 // #######################################################################################
 // Allocators
 // #######################################################################################
@@ -567,10 +692,10 @@ Defines the delegate type for the allocator function.
 AllocatorProcedure :: #type proc "c" (
 	allocatorData: rawptr,
 	mode: AllocatorMode,
-	size: i32,
+	size: i64,
 	alignment: i32,
 	oldMemory: rawptr,
-	oldSize: i32,
+	oldSize: i64,
 	location: SourceCodeLocation,
 	error: ^AllocatorError,
 ) -> rawptr
@@ -595,7 +720,7 @@ foreign {
 	Allocate :: proc "c" (
 		allocator: Allocator,
 		zeroed: b8,
-		size: i32,
+		size: i64,
 		alignment: i32,
 		location: SourceCodeLocation,
 		error: ^AllocatorError = { },
@@ -611,8 +736,8 @@ foreign {
 		allocator: Allocator,
 		zeroed: b8,
 		oldMemory: rawptr,
-		oldSize: i32,
-		newSize: i32,
+		oldSize: i64,
+		newSize: i64,
 		alignment: i32,
 		location: SourceCodeLocation,
 		error: ^AllocatorError = { },
@@ -628,8 +753,8 @@ foreign {
 		allocator: Allocator,
 		zeroed: b8,
 		oldMemory: rawptr,
-		oldSize: i32,
-		newSize: i32,
+		oldSize: i64,
+		newSize: i64,
 		alignment: i32,
 		location: SourceCodeLocation,
 		error: ^AllocatorError = { },
@@ -702,15 +827,54 @@ foreign {
 	AllocatorFn_DefaultHeap :: proc "c" (
 		allocatorData: rawptr,
 		mode: AllocatorMode,
-		size: i32,
+		size: i64,
+		alignment: i32,
+		oldMemory: rawptr,
+		oldSize: i64,
+		location: SourceCodeLocation,
+		error: ^AllocatorError,
+	) -> rawptr ---
+}
+
+// Thread-Caching Heap Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Get the thread-caching heap allocator.
+	Small allocations are served from per-size-class caches local to each thread, refilled in
+	batches from a shared central free list; large ones go straight to the OS.
+	Memory fresh from the OS is already zeroed, so zeroed allocations only clear recycled blocks.
+	*/
+	GetAllocator_ThreadCachingHeap :: proc "c" () -> Allocator ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Main allocator function for the thread-caching heap allocator.
+	*/
+	AllocatorFn_ThreadCachingHeap :: proc "c" (
+		allocatorData: rawptr,
+		mode: AllocatorMode,
+		size: i64,
 		alignment: i32,
 		oldMemory: rawptr,
-		oldSize: i32,
+		oldSize: i64,
 		location: SourceCodeLocation,
 		error: ^AllocatorError,
 	) -> rawptr ---
 }
 
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Hand all the blocks cached by the calling thread back to the central free list.
+	Threads started with `PNSLR_StartThread` do this automatically before exiting.
+	*/
+	FlushThreadCachingHeapCache :: proc "c" () ---
+}
+
 // Arena Alloator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
 /*
@@ -720,8 +884,8 @@ ArenaAllocatorBlock :: struct  {
 	previous: ^ArenaAllocatorBlock,
 	allocator: Allocator,
 	memory: rawptr,
-	capacity: u32,
-	used: u32,
+	capacity: u64,
+	used: u64,
 }
 
 /*
@@ -730,9 +894,9 @@ The payload used by the arena allocator.
 ArenaAllocatorPayload :: struct  {
 	backingAllocator: Allocator,
 	currentBlock: ^ArenaAllocatorBlock,
-	totalUsed: u32,
-	totalCapacity: u32,
-	minimumBlockSize: u32,
+	totalUsed: u64,
+	totalCapacity: u64,
+	minimumBlockSize: u64,
 	numSnapshots: u32,
 }
 
@@ -746,7 +910,7 @@ foreign {
 	*/
 	NewAllocator_Arena :: proc "c" (
 		backingAllocator: Allocator,
-		pageSize: u32,
+		pageSize: u64,
 		location: SourceCodeLocation,
 		error: ^AllocatorError = { },
 	) -> Allocator ---
@@ -773,10 +937,10 @@ foreign {
 	AllocatorFn_Arena :: proc "c" (
 		allocatorData: rawptr,
 		mode: AllocatorMode,
-		size: i32,
+		size: i64,
 		alignment: i32,
 		oldMemory: rawptr,
-		oldSize: i32,
+		oldSize: i64,
 		location: SourceCodeLocation,
 		error: ^AllocatorError,
 	) -> rawptr ---
@@ -798,7 +962,7 @@ ArenaAllocatorSnapshot :: struct  {
 	valid: b8,
 	payload: ^ArenaAllocatorPayload,
 	block: ^ArenaAllocatorBlock,
-	used: u32,
+	used: u64,
 }
 
 @(link_prefix="PNSLR_")
@@ -845,49 +1009,30 @@ foreign {
 	) -> ArenaSnapshotError ---
 }
 
-// Stack Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-
-/*
-A page of a stack allocator.
-*/
-StackAllocatorPage :: struct #align(8)  {
-	previousPage: ^StackAllocatorPage,
-	usedBytes: u64,
-	buffer: [8192]u8,
-}
-
-/*
-The header used for every separate stack allocation.
-This is used to store metadata about the allocation and deallocate appropriately.
-*/
-StackAllocationHeader :: struct  {
-	page: ^StackAllocatorPage,
-	size: i32,
-	alignment: i32,
-	lastAllocation: rawptr,
-	lastAllocationHeader: rawptr,
-}
+// Virtual Arena Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
 /*
-The payload used by the stack allocator.
+The payload used by the virtual arena allocator.
+Lives at the very start of its own reserved range, followed by the allocations.
 */
-StackAllocatorPayload :: struct  {
-	backingAllocator: Allocator,
-	currentPage: ^StackAllocatorPage,
-	lastAllocation: rawptr,
-	lastAllocationHeader: ^StackAllocationHeader,
+VirtualArenaAllocatorPayload :: struct  {
+	memory: ^u8,
+	reserved: i64,
+	committed: i64,
+	used: i64,
+	pageSize: i32,
+	numSnapshots: u32,
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Create a stack allocator with the specified backing allocator.
-	The stack allocator will use the backing allocator to allocate its pages.
-	The stack allocator will not free the backing allocator, so it is the caller's responsibility to
-	free the backing allocator when it is no longer needed.
+	Create an arena allocator that reserves 'reserveSize' bytes of address space up-front and
+	commits pages on demand, so all allocations live in one contiguous span. The last allocation
+	can always be resized in place, and restoring a snapshot returns the tail pages to the OS.
 	*/
-	NewAllocator_Stack :: proc "c" (
-		backingAllocator: Allocator,
+	NewAllocator_VirtualArena :: proc "c" (
+		reserveSize: i64,
 		location: SourceCodeLocation,
 		error: ^AllocatorError = { },
 	) -> Allocator ---
@@ -896,10 +1041,9 @@ foreign {
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Destroy a stack allocator and free all its resources.
-	This does not free the backing allocator, only the stack allocator's own resources.
+	Destroy a virtual arena allocator and release its entire reserved range.
 	*/
-	DestroyAllocator_Stack :: proc "c" (
+	DestroyAllocator_VirtualArena :: proc "c" (
 		allocator: Allocator,
 		location: SourceCodeLocation,
 		error: ^AllocatorError = { },
@@ -909,132 +1053,953 @@ foreign {
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Main allocator function for the stack allocator.
+	Main allocator function for the virtual arena allocator.
 	*/
-	AllocatorFn_Stack :: proc "c" (
+	AllocatorFn_VirtualArena :: proc "c" (
 		allocatorData: rawptr,
 		mode: AllocatorMode,
-		size: i32,
+		size: i64,
 		alignment: i32,
 		oldMemory: rawptr,
-		oldSize: i32,
+		oldSize: i64,
 		location: SourceCodeLocation,
 		error: ^AllocatorError,
 	) -> rawptr ---
 }
 
-// Collections make/free functions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+/*
+A snapshot of the virtual arena allocator, recording its state at a specific point in time.
+*/
+VirtualArenaAllocatorSnapshot :: struct  {
+	valid: b8,
+	payload: ^VirtualArenaAllocatorPayload,
+	used: i64,
+}
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Allocate a raw array slice of 'count' elements, each of size 'tySize' and alignment 'tyAlign', using the provided allocator. Optionally zeroed.
+	Ensures that the virtual arena allocator has either restored/discarded all the
+	snapshots that were taken.
 	*/
-	MakeRawSlice :: proc "c" (
-		tySize: i32,
-		tyAlign: i32,
-		count: i64,
-		zeroed: b8,
+	ValidateVirtualArenaAllocatorSnapshotState :: proc "c" (
 		allocator: Allocator,
-		location: SourceCodeLocation,
-		error: ^AllocatorError = { },
-	) -> Intrinsics.RawArraySlice ---
+	) -> b8 ---
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Free a raw array slice allocated with `PNSLR_MakeRawSlice`, using the provided allocator.
+	Captures a snapshot of the virtual arena allocator.
 	*/
-	FreeRawSlice :: proc "c" (
-		slice: ^Intrinsics.RawArraySlice,
+	CaptureVirtualArenaAllocatorSnapshot :: proc "c" (
 		allocator: Allocator,
-		location: SourceCodeLocation,
-		error: ^AllocatorError = { },
-	) ---
+	) -> VirtualArenaAllocatorSnapshot ---
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Resize a raw array slice to one with 'newCount' elements, each of size 'tySize' and alignment 'tyAlign', using the provided allocator. Optionally zeroed.
+	Restores the state of the virtual arena allocator from a snapshot, decommitting the pages past it.
+	Upon success, the snapshot is marked as invalid.
 	*/
-	ResizeRawSlice :: proc "c" (
-		slice: ^Intrinsics.RawArraySlice,
-		tySize: i32,
-		tyAlign: i32,
-		newCount: i64,
-		zeroed: b8,
-		allocator: Allocator,
-		location: SourceCodeLocation,
-		error: ^AllocatorError = { },
-	) ---
+	RestoreVirtualArenaAllocatorSnapshot :: proc "c" (
+		snapshot: ^VirtualArenaAllocatorSnapshot,
+		loc: SourceCodeLocation,
+	) -> ArenaSnapshotError ---
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Allocate a UTF-8 string of 'count__' characters using the provided allocator. Optionally zeroed.
+	Discards a snapshot of the virtual arena allocator.
 	*/
-	MakeString :: proc "c" (
-		count: i64,
-		zeroed: b8,
-		allocator: Allocator,
-		location: SourceCodeLocation,
-		error: ^AllocatorError = { },
-	) -> string ---
+	DiscardVirtualArenaAllocatorSnapshot :: proc "c" (
+		snapshot: ^VirtualArenaAllocatorSnapshot,
+	) -> ArenaSnapshotError ---
+}
+
+// Concurrent Arena Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/*
+A block of memory used by the concurrent arena allocator.
+'used' is bumped atomically and can overshoot 'capacity' once the block is full.
+*/
+ConcurrentArenaAllocatorBlock :: struct  {
+	previous: ^ConcurrentArenaAllocatorBlock,
+	memory: ^u8,
+	capacity: i64,
+	used: i64,
+}
+
+/*
+The payload used by the concurrent arena allocator.
+Threads lease 'leaseSize' bytes at a time from the current block and bump-allocate
+from their lease without touching shared state; only new blocks take the lock.
+*/
+ConcurrentArenaAllocatorPayload :: struct  {
+	backingAllocator: Allocator,
+	growthMutex: Mutex,
+	currentBlock: ^ConcurrentArenaAllocatorBlock,
+	minimumBlockSize: i64,
+	leaseSize: i64,
+	totalCapacity: i64,
+	id: i64,
+	generation: i64,
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Free a UTF-8 string allocated with `PNSLR_MakeString`, using the provided allocator.
+	Create an arena allocator that many threads can allocate from at the same time.
+	Blocks are at least 'blockSize' bytes, and each thread leases 'leaseSize' bytes
+	(rounded up to a cache line) at a time; allocations bigger than half a lease go
+	straight to the block. Individual frees are not supported, use a single FreeAll
+	once no thread is allocating anymore (e.g. at the end of a frame).
+	The backing allocator is only ever called under a lock.
 	*/
-	FreeString :: proc "c" (
-		str: string,
-		allocator: Allocator,
+	NewAllocator_ConcurrentArena :: proc "c" (
+		backingAllocator: Allocator,
+		blockSize: i64,
+		leaseSize: i32,
 		location: SourceCodeLocation,
 		error: ^AllocatorError = { },
-	) ---
+	) -> Allocator ---
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Allocate a C-style null-terminated string of 'count__' characters (excluding the null terminator) using the provided allocator. Optionally zeroed.
+	Destroy a concurrent arena allocator and free all its resources.
+	This does not free the backing allocator, only the arena allocator's own resources.
 	*/
-	MakeCString :: proc "c" (
-		count: i64,
-		zeroed: b8,
+	DestroyAllocator_ConcurrentArena :: proc "c" (
 		allocator: Allocator,
 		location: SourceCodeLocation,
 		error: ^AllocatorError = { },
-	) -> cstring ---
+	) ---
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Free a C-style null-terminated string allocated with `PNSLR_MakeCString`, using the provided allocator.
+	Main allocator function for the concurrent arena allocator.
 	*/
-	FreeCString :: proc "c" (
-		str: cstring,
-		allocator: Allocator,
+	AllocatorFn_ConcurrentArena :: proc "c" (
+		allocatorData: rawptr,
+		mode: AllocatorMode,
+		size: i64,
+		alignment: i32,
+		oldMemory: rawptr,
+		oldSize: i64,
 		location: SourceCodeLocation,
-		error: ^AllocatorError = { },
-	) ---
+		error: ^AllocatorError,
+	) -> rawptr ---
 }
 
-// #######################################################################################
-// Chrono
-// #######################################################################################
+// Frame Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
-@(link_prefix="PNSLR_")
-foreign {
-	/*
-	Returns the current time in nanoseconds since the Unix epoch (January 1, 1970).
-	*/
-	NanosecondsSinceUnixEpoch :: proc "c" () -> i64 ---
+/*
+A block of memory used by the frame allocator. Blocks are kept around and reused
+once their frame comes around again.
+*/
+FrameAllocatorBlock :: struct  {
+	next: ^FrameAllocatorBlock,
+	memory: ^u8,
+	capacity: i64,
+	used: i64,
+}
+
+/*
+One frame's worth of blocks in the frame allocator.
+*/
+FrameAllocatorFrame :: struct  {
+	firstBlock: ^FrameAllocatorBlock,
+	currentBlock: ^FrameAllocatorBlock,
+	used: i64,
+	capacity: i64,
+	highWaterMark: i64,
+}
+
+/*
+The payload used by the frame allocator, a ring of up to 8 per-frame arenas.
+*/
+FrameAllocatorPayload :: struct  {
+	backingAllocator: Allocator,
+	frames: [8]FrameAllocatorFrame,
+	minimumBlockSize: i64,
+	peakHighWaterMark: i64,
+	frameIndex: u64,
+	numFrames: i32,
+	currentFrame: i32,
+}
+
+/*
+Usage statistics for a frame allocator.
+*/
+FrameAllocatorStats :: struct  {
+	frameIndex: u64,
+	usedBytes: i64,
+	lastHighWaterMark: i64,
+	peakHighWaterMark: i64,
+	totalCapacity: i64,
+	numFrames: i32,
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Create a frame allocator: a ring of 'numFrames' (1 to 8) arenas, where memory allocated
+	during a frame survives the next 'numFrames - 1' calls to `PNSLR_AdvanceFrameAllocator`,
+	and is reclaimed by the 'numFrames'-th one.
+	Blocks are at least 'blockSize' bytes, and are never handed back to the backing allocator
+	until the frame allocator is destroyed.
+	Individual frees are not supported.
+	*/
+	NewAllocator_Frame :: proc "c" (
+		backingAllocator: Allocator,
+		numFrames: i32,
+		blockSize: i64,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) -> Allocator ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Destroy a frame allocator and free all its resources.
+	This does not free the backing allocator, only the frame allocator's own resources.
+	*/
+	DestroyAllocator_Frame :: proc "c" (
+		allocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Main allocator function for the frame allocator.
+	FreeAll resets every frame (keeping their blocks).
+	*/
+	AllocatorFn_Frame :: proc "c" (
+		allocatorData: rawptr,
+		mode: AllocatorMode,
+		size: i64,
+		alignment: i32,
+		oldMemory: rawptr,
+		oldSize: i64,
+		location: SourceCodeLocation,
+		error: ^AllocatorError,
+	) -> rawptr ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Moves a frame allocator on to the next frame, resetting the oldest frame's arena
+	(and so invalidating everything allocated 'numFrames' frames ago) for reuse.
+	Returns the high-water mark of the frame that just ended.
+	*/
+	AdvanceFrameAllocator :: proc "c" (
+		allocator: Allocator,
+	) -> i64 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Get the current usage statistics of a frame allocator.
+	Returns zeroed stats if the allocator is not a frame allocator.
+	*/
+	GetFrameAllocatorStats :: proc "c" (
+		allocator: Allocator,
+	) -> FrameAllocatorStats ---
+}
+
+// Stack Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/*
+A page of a stack allocator.
+*/
+StackAllocatorPage :: struct #align(8)  {
+	previousPage: ^StackAllocatorPage,
+	usedBytes: u64,
+	buffer: [8192]u8,
+}
+
+/*
+The header used for every separate stack allocation.
+This is used to store metadata about the allocation and deallocate appropriately.
+*/
+StackAllocationHeader :: struct  {
+	page: ^StackAllocatorPage,
+	size: i64,
+	alignment: i32,
+	lastAllocation: rawptr,
+	lastAllocationHeader: rawptr,
+}
+
+/*
+The payload used by the stack allocator.
+*/
+StackAllocatorPayload :: struct  {
+	backingAllocator: Allocator,
+	currentPage: ^StackAllocatorPage,
+	lastAllocation: rawptr,
+	lastAllocationHeader: ^StackAllocationHeader,
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Create a stack allocator with the specified backing allocator.
+	The stack allocator will use the backing allocator to allocate its pages.
+	The stack allocator will not free the backing allocator, so it is the caller's responsibility to
+	free the backing allocator when it is no longer needed.
+	*/
+	NewAllocator_Stack :: proc "c" (
+		backingAllocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) -> Allocator ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Destroy a stack allocator and free all its resources.
+	This does not free the backing allocator, only the stack allocator's own resources.
+	*/
+	DestroyAllocator_Stack :: proc "c" (
+		allocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Main allocator function for the stack allocator.
+	*/
+	AllocatorFn_Stack :: proc "c" (
+		allocatorData: rawptr,
+		mode: AllocatorMode,
+		size: i64,
+		alignment: i32,
+		oldMemory: rawptr,
+		oldSize: i64,
+		location: SourceCodeLocation,
+		error: ^AllocatorError,
+	) -> rawptr ---
+}
+
+// Pool Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/*
+A chunk of fixed-size slots owned by the pool allocator.
+Slots are handed out from the chunk in order before they're ever recycled via the free list.
+*/
+PoolAllocatorChunk :: struct  {
+	previous: ^PoolAllocatorChunk,
+	slots: rawptr,
+	slotsCount: i32,
+	slotsTouched: i32,
+}
+
+/*
+The payload used by the pool allocator.
+Freed slots are threaded into an intrusive singly-linked list, so both allocation and free are O(1).
+*/
+PoolAllocatorPayload :: struct  {
+	backingAllocator: Allocator,
+	currentChunk: ^PoolAllocatorChunk,
+	freeList: rawptr,
+	slotSize: i32,
+	slotAlignment: i32,
+	slotStride: i32,
+	slotsPerChunk: i32,
+	numSlotsUsed: i64,
+	numSlotsTotal: i64,
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Create a pool allocator that hands out slots of up to 'slotSize' bytes, aligned to
+	'slotAlignment', growing 'slotsPerChunk' slots at a time from the backing allocator.
+	The pool allocator will not free the backing allocator, so it is the caller's responsibility to
+	free the backing allocator when it is no longer needed.
+	*/
+	NewAllocator_Pool :: proc "c" (
+		backingAllocator: Allocator,
+		slotSize: i32,
+		slotAlignment: i32,
+		slotsPerChunk: i32,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) -> Allocator ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Destroy a pool allocator and free all its resources.
+	This does not free the backing allocator, only the pool allocator's own resources.
+	*/
+	DestroyAllocator_Pool :: proc "c" (
+		allocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Main allocator function for the pool allocator.
+	*/
+	AllocatorFn_Pool :: proc "c" (
+		allocatorData: rawptr,
+		mode: AllocatorMode,
+		size: i64,
+		alignment: i32,
+		oldMemory: rawptr,
+		oldSize: i64,
+		location: SourceCodeLocation,
+		error: ^AllocatorError,
+	) -> rawptr ---
+}
+
+// Slab Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/*
+The header at the start of every slab of the slab allocator.
+Slabs are aligned to their own size, so any object can find its slab by masking its address.
+Allocations too big for any cache get a dedicated slab of their own, with a 'cacheIndex' of -1.
+*/
+SlabAllocatorSlab :: struct  {
+	next: ^SlabAllocatorSlab,
+	previous: ^SlabAllocatorSlab,
+	freeList: rawptr,
+	capacity: i64,
+	cacheIndex: i32,
+	objectsCount: i32,
+	objectsUsed: i32,
+	objectsTouched: i32,
+}
+
+/*
+A cache of slabs for one object size (a multiple of the cache line size),
+split into partially filled, full and completely empty slabs.
+*/
+SlabAllocatorCache :: struct  {
+	mutex: Mutex,
+	partialSlabs: ^SlabAllocatorSlab,
+	fullSlabs: ^SlabAllocatorSlab,
+	emptySlabs: ^SlabAllocatorSlab,
+	numObjectsUsed: i64,
+	objectStride: i32,
+	objectsPerSlab: i32,
+	numSlabs: i32,
+	numEmptySlabs: i32,
+}
+
+/*
+The payload used by the slab allocator, with one cache per 64-byte size step up to 2 KiB.
+*/
+SlabAllocatorPayload :: struct  {
+	backingAllocator: Allocator,
+	caches: [32]SlabAllocatorCache,
+	largeSlabsMutex: Mutex,
+	largeSlabs: ^SlabAllocatorSlab,
+	numLargeSlabs: i64,
+	maxEmptySlabsPerCache: i32,
+}
+
+/*
+Usage statistics for a slab allocator.
+*/
+SlabAllocatorStats :: struct  {
+	numObjectsUsed: i64,
+	numSlabs: i64,
+	numEmptySlabs: i64,
+	numLargeSlabs: i64,
+	reservedBytes: i64,
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Create a thread-safe slab allocator, meant for small, frequently allocated structs.
+	Objects up to 2 KiB are served from 64 KiB slabs, one cache per 64-byte size step, and are
+	always aligned to (and padded out to) the cache line, so neighbouring objects handed out to
+	different threads never share one. Each cache keeps up to 'maxEmptySlabsPerCache' completely
+	empty slabs around for reuse before handing any back to the backing allocator.
+	The backing allocator must honour 64 KiB alignment.
+	*/
+	NewAllocator_Slab :: proc "c" (
+		backingAllocator: Allocator,
+		maxEmptySlabsPerCache: i32,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) -> Allocator ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Destroy a slab allocator and free all its resources.
+	This does not free the backing allocator, only the slab allocator's own resources.
+	*/
+	DestroyAllocator_Slab :: proc "c" (
+		allocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Main allocator function for the slab allocator.
+	*/
+	AllocatorFn_Slab :: proc "c" (
+		allocatorData: rawptr,
+		mode: AllocatorMode,
+		size: i64,
+		alignment: i32,
+		oldMemory: rawptr,
+		oldSize: i64,
+		location: SourceCodeLocation,
+		error: ^AllocatorError,
+	) -> rawptr ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Hand every completely empty slab of a slab allocator back to its backing allocator.
+	*/
+	TrimSlabAllocator :: proc "c" (
+		allocator: Allocator,
+		location: SourceCodeLocation,
+	) ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Get the current usage statistics of a slab allocator.
+	Returns zeroed stats if the allocator is not a slab allocator.
+	*/
+	GetSlabAllocatorStats :: proc "c" (
+		allocator: Allocator,
+	) -> SlabAllocatorStats ---
+}
+
+// Buddy Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/*
+The header written into every free block of the buddy allocator,
+linking it into the free list for its order.
+*/
+BuddyAllocatorFreeBlock :: struct  {
+	previous: ^BuddyAllocatorFreeBlock,
+	next: ^BuddyAllocatorFreeBlock,
+}
+
+/*
+The payload used by the buddy allocator.
+Block 'order' N is 'minBlockSize << N' bytes; the whole region is a single block of the highest order.
+*/
+BuddyAllocatorPayload :: struct  {
+	backingAllocator: Allocator,
+	memory: rawptr,
+	blockStates: ^u8,
+	requestedSizes: ^i64,
+	regionSize: i64,
+	minBlockSize: i32,
+	minBlockShift: i32,
+	numOrders: i32,
+	numAllocations: i32,
+	numFreeBlocks: i32,
+	usedBytes: i64,
+	requestedBytes: i64,
+	freeLists: [32]^BuddyAllocatorFreeBlock,
+}
+
+/*
+Usage/fragmentation statistics for a buddy allocator.
+'usedBytes - requestedBytes' is the internal fragmentation (rounding up to power-of-two blocks),
+and 'freeBytes - largestFreeBlock' is the free memory that can't be handed out in one piece.
+*/
+BuddyAllocatorStats :: struct  {
+	totalBytes: i64,
+	usedBytes: i64,
+	requestedBytes: i64,
+	freeBytes: i64,
+	largestFreeBlock: i64,
+	numAllocations: i32,
+	numFreeBlocks: i32,
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Create a buddy allocator over a single region of 'regionSize' bytes (rounded up to a power of two)
+	reserved from the backing allocator up-front. Blocks are never smaller than 'minBlockSize'
+	(also a power of two), and allocations can't be aligned beyond it.
+	The buddy allocator will not free the backing allocator, so it is the caller's responsibility to
+	free the backing allocator when it is no longer needed.
+	*/
+	NewAllocator_Buddy :: proc "c" (
+		backingAllocator: Allocator,
+		regionSize: i64,
+		minBlockSize: i32,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) -> Allocator ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Destroy a buddy allocator and free all its resources.
+	This does not free the backing allocator, only the buddy allocator's own resources.
+	*/
+	DestroyAllocator_Buddy :: proc "c" (
+		allocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Main allocator function for the buddy allocator.
+	*/
+	AllocatorFn_Buddy :: proc "c" (
+		allocatorData: rawptr,
+		mode: AllocatorMode,
+		size: i64,
+		alignment: i32,
+		oldMemory: rawptr,
+		oldSize: i64,
+		location: SourceCodeLocation,
+		error: ^AllocatorError,
+	) -> rawptr ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Get the current usage/fragmentation statistics of a buddy allocator.
+	Returns zeroed stats if the allocator is not a buddy allocator.
+	*/
+	GetBuddyAllocatorStats :: proc "c" (
+		allocator: Allocator,
+	) -> BuddyAllocatorStats ---
+}
+
+// Tracking Allocator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/*
+Allocation statistics for a single call site (file:line) of a tracking allocator.
+'liveBytes' can go negative in a per-thread record if the memory was freed on a
+different thread than the one that allocated it; the merged totals are exact.
+*/
+TrackingAllocatorCallSite :: struct  {
+	location: SourceCodeLocation,
+	numAllocations: i64,
+	numFrees: i64,
+	numResizes: i64,
+	totalBytes: i64,
+	liveBytes: i64,
+}
+
+// declare []TrackingAllocatorCallSite
+
+/*
+The per-thread record of a tracking allocator. Only the owning thread ever writes
+to it, so recording an allocation doesn't need a lock.
+Call sites past the capacity of the table are accumulated into 'overflow'.
+*/
+TrackingAllocatorThreadRecord :: struct  {
+	next: ^TrackingAllocatorThreadRecord,
+	owner: rawptr,
+	numAllocations: i64,
+	numFrees: i64,
+	numResizes: i64,
+	totalBytes: i64,
+	numCallSites: i32,
+	overflow: TrackingAllocatorCallSite,
+	callSites: [256]TrackingAllocatorCallSite,
+}
+
+/*
+The payload used by the tracking allocator.
+Live/peak bytes are kept up to date atomically, everything else lives in the per-thread records.
+*/
+TrackingAllocatorPayload :: struct  {
+	backingAllocator: Allocator,
+	recordsMutex: Mutex,
+	records: ^TrackingAllocatorThreadRecord,
+	id: i64,
+	liveBytes: i64,
+	peakBytes: i64,
+}
+
+/*
+Overall statistics of a tracking allocator, merged across all threads.
+*/
+TrackingAllocatorStats :: struct  {
+	liveBytes: i64,
+	peakBytes: i64,
+	liveAllocations: i64,
+	numAllocations: i64,
+	numFrees: i64,
+	numResizes: i64,
+	totalBytes: i64,
+	numThreads: i32,
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Create a tracking allocator that forwards to 'backingAllocator', recording live/peak
+	bytes, allocation counts and per call site histograms from the source code locations
+	passed to every allocator call.
+	Every allocation carries a small header, so memory must be freed through the tracking
+	allocator, and resizes only stay in-place if the backing allocator supports it.
+	*/
+	NewAllocator_Tracking :: proc "c" (
+		backingAllocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) -> Allocator ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Destroy a tracking allocator and its records.
+	This does not free any allocations still live in the backing allocator.
+	*/
+	DestroyAllocator_Tracking :: proc "c" (
+		allocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Main allocator function for the tracking allocator.
+	*/
+	AllocatorFn_Tracking :: proc "c" (
+		allocatorData: rawptr,
+		mode: AllocatorMode,
+		size: i64,
+		alignment: i32,
+		oldMemory: rawptr,
+		oldSize: i64,
+		location: SourceCodeLocation,
+		error: ^AllocatorError,
+	) -> rawptr ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Get the current statistics of a tracking allocator.
+	Returns zeroed stats if the allocator is not a tracking allocator.
+	*/
+	GetTrackingAllocatorStats :: proc "c" (
+		allocator: Allocator,
+	) -> TrackingAllocatorStats ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Get the call sites recorded by a tracking allocator, merged across threads and
+	sorted by live bytes (then total bytes), largest first.
+	The slice is allocated from 'outputAllocator'.
+	*/
+	GetTrackingAllocatorCallSites :: proc "c" (
+		allocator: Allocator,
+		outputAllocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) -> []TrackingAllocatorCallSite ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Reset the peak bytes of a tracking allocator to its current live bytes.
+	Useful for measuring the peak within a single frame.
+	*/
+	ResetTrackingAllocatorPeak :: proc "c" (
+		allocator: Allocator,
+	) ---
+}
+
+// Internal Allocators ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/*
+Usage statistics of one of the library's internal scratch arenas (strings, paths, etc.).
+Each thread gets a fixed static buffer of 'staticCapacity' bytes, and overflows into
+blocks from the default heap once that runs out; those are released again as soon as
+the operation that needed them is done. Counters are summed across threads.
+*/
+InternalAllocatorStats :: struct  {
+	name: string,
+	staticCapacity: i64,
+	numOverflows: i64,
+	overflowBytes: i64,
+	peakOverflowBytes: i64,
+}
+
+// declare []InternalAllocatorStats
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Fill 'output' with the statistics of the internal arenas used so far (by any thread),
+	and return how many there are; which may be more than 'output' could hold.
+	*/
+	GetInternalAllocatorStats :: proc "c" (
+		output: []InternalAllocatorStats,
+	) -> i32 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Reset the peak overflow bytes of all internal arenas to their current overflow bytes.
+	*/
+	ResetInternalAllocatorPeaks :: proc "c" () ---
+}
+
+// Collections make/free functions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Allocate a raw array slice of 'count' elements, each of size 'tySize' and alignment 'tyAlign', using the provided allocator. Optionally zeroed.
+	*/
+	MakeRawSlice :: proc "c" (
+		tySize: i32,
+		tyAlign: i32,
+		count: i64,
+		zeroed: b8,
+		allocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) -> Intrinsics.RawArraySlice ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Free a raw array slice allocated with `PNSLR_MakeRawSlice`, using the provided allocator.
+	*/
+	FreeRawSlice :: proc "c" (
+		slice: ^Intrinsics.RawArraySlice,
+		allocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Resize a raw array slice to one with 'newCount' elements, each of size 'tySize' and alignment 'tyAlign', using the provided allocator. Optionally zeroed.
+	*/
+	ResizeRawSlice :: proc "c" (
+		slice: ^Intrinsics.RawArraySlice,
+		tySize: i32,
+		tyAlign: i32,
+		newCount: i64,
+		zeroed: b8,
+		allocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Allocate a UTF-8 string of 'count__' characters using the provided allocator. Optionally zeroed.
+	*/
+	MakeString :: proc "c" (
+		count: i64,
+		zeroed: b8,
+		allocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) -> string ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Free a UTF-8 string allocated with `PNSLR_MakeString`, using the provided allocator.
+	*/
+	FreeString :: proc "c" (
+		str: string,
+		allocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Allocate a C-style null-terminated string of 'count__' characters (excluding the null terminator) using the provided allocator. Optionally zeroed.
+	*/
+	MakeCString :: proc "c" (
+		count: i64,
+		zeroed: b8,
+		allocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) -> cstring ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Free a C-style null-terminated string allocated with `PNSLR_MakeCString`, using the provided allocator.
+	*/
+	FreeCString :: proc "c" (
+		str: cstring,
+		allocator: Allocator,
+		location: SourceCodeLocation,
+		error: ^AllocatorError = { },
+	) ---
+}
+
+// #######################################################################################
+// Chrono
+// #######################################################################################
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Returns the current time in nanoseconds since the Unix epoch (January 1, 1970).
+	*/
+	NanosecondsSinceUnixEpoch :: proc "c" () -> i64 ---
 }
 
 @(link_prefix="PNSLR_")
@@ -1184,155 +2149,384 @@ foreign {
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Checks if two C-style null-terminated strings are equal.
-	Returns true if they are equal, false otherwise.
+	Checks if two C-style null-terminated strings are equal.
+	Returns true if they are equal, false otherwise.
+	*/
+	AreCStringsEqual :: proc "c" (
+		str1: cstring,
+		str2: cstring,
+		comparisonType: StringComparisonType = { },
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Checks if a UTF-8 string starts with the specified prefix.
+	Returns true if it does, false otherwise.
+	*/
+	StringStartsWith :: proc "c" (
+		str: string,
+		prefix: string,
+		comparisonType: StringComparisonType = { },
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Checks if a UTF-8 string ends with the specified suffix.
+	Returns true if it does, false otherwise.
+	*/
+	StringEndsWith :: proc "c" (
+		str: string,
+		suffix: string,
+		comparisonType: StringComparisonType = { },
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Checks if a C-style null-terminated string starts with the specified prefix.
+	*/
+	StringStartsWithCString :: proc "c" (
+		str: string,
+		prefix: cstring,
+		comparisonType: StringComparisonType = { },
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Checks if a C-style null-terminated string ends with the specified suffix.
+	*/
+	StringEndsWithCString :: proc "c" (
+		str: string,
+		suffix: cstring,
+		comparisonType: StringComparisonType = { },
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Returns the length of the given C-style null-terminated string, excluding the null terminator.
+	*/
+	CStringStartsWith :: proc "c" (
+		str: cstring,
+		prefix: string,
+		comparisonType: StringComparisonType = { },
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Checks if a C-style null-terminated string ends with the specified UTF-8 suffix.
+	*/
+	CStringEndsWith :: proc "c" (
+		str: cstring,
+		suffix: string,
+		comparisonType: StringComparisonType = { },
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Checks if a C-style null-terminated string starts with the specified UTF-8 prefix.
+	*/
+	CStringStartsWithCString :: proc "c" (
+		str: string,
+		prefix: cstring,
+		comparisonType: StringComparisonType = { },
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Checks if a C-style null-terminated string ends with the specified UTF-8 suffix.
+	*/
+	CStringEndsWithCString :: proc "c" (
+		str: string,
+		suffix: cstring,
+		comparisonType: StringComparisonType = { },
+	) -> b8 ---
+}
+
+// Advanced comparisons ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Searches for the first occurrence of a substring within a string.
+	Returns the index of the first occurrence, or -1 if not found.
+	*/
+	SearchFirstIndexInString :: proc "c" (
+		str: string,
+		substring: string,
+		comparisonType: StringComparisonType = { },
+	) -> i32 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Searches for the last occurrence of a substring within a string.
+	Returns the index of the last occurrence, or -1 if not found.
+	*/
+	SearchLastIndexInString :: proc "c" (
+		str: string,
+		substring: string,
+		comparisonType: StringComparisonType = { },
+	) -> i32 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Replaces all occurrences of a substring within a string with a new value.
+	The returned string is allocated using the specified allocator.
+	*/
+	ReplaceInString :: proc "c" (
+		str: string,
+		oldValue: string,
+		newValue: string,
+		allocator: Allocator,
+		comparisonType: StringComparisonType = { },
+	) -> string ---
+}
+
+// Hashing ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Hashes the bytes of a string to 64 bits (wyhash, final version 4).
+	Not suitable for anything cryptographic. The result is the same on every platform,
+	so it's fine to store it.
+	*/
+	HashString :: proc "c" (
+		str: string,
+		seed: u64 = { },
+	) -> u64 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Returns a view of the string without any leading ASCII whitespace.
 	*/
-	AreCStringsEqual :: proc "c" (
-		str1: cstring,
-		str2: cstring,
-		comparisonType: StringComparisonType = { },
-	) -> b8 ---
+	TrimStringFromStart :: proc "c" (
+		str: string,
+	) -> string ---
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Checks if a UTF-8 string starts with the specified prefix.
-	Returns true if it does, false otherwise.
+	Returns a view of the string without any trailing ASCII whitespace.
 	*/
-	StringStartsWith :: proc "c" (
+	TrimStringFromEnd :: proc "c" (
 		str: string,
-		prefix: string,
-		comparisonType: StringComparisonType = { },
-	) -> b8 ---
+	) -> string ---
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Checks if a UTF-8 string ends with the specified suffix.
-	Returns true if it does, false otherwise.
+	Returns a view of the string without any leading or trailing ASCII whitespace.
 	*/
-	StringEndsWith :: proc "c" (
+	TrimString :: proc "c" (
 		str: string,
-		suffix: string,
-		comparisonType: StringComparisonType = { },
-	) -> b8 ---
+	) -> string ---
+}
+
+/*
+What a split iterator splits on.
+*/
+StringSplitType :: enum u8 {
+	Byte = 0,
+	String = 1,
+	AnyOf = 2,
+	Lines = 3,
+	Whitespace = 4,
+}
+
+/*
+Splits a string into parts without allocating; every part is a view into the
+original string. Create with one of the `PNSLR_SplitStringBy*` functions, then
+take parts from either end with `PNSLR_NextSplitFromStart`/`PNSLR_NextSplitFromEnd`.
+*/
+StringSplitIterator :: struct  {
+	remaining: string,
+	separator: string,
+	separatorByte: u8,
+	type: StringSplitType,
+	comparisonType: StringComparisonType,
+	finished: b8,
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Checks if a C-style null-terminated string starts with the specified prefix.
+	Split on every occurrence of a byte. Empty parts are kept, so "a,,b" gives
+	"a", "" and "b".
 	*/
-	StringStartsWithCString :: proc "c" (
+	SplitStringByByte :: proc "c" (
 		str: string,
-		prefix: cstring,
-		comparisonType: StringComparisonType = { },
-	) -> b8 ---
+		separator: u8,
+	) -> StringSplitIterator ---
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Checks if a C-style null-terminated string ends with the specified suffix.
+	Split on every occurrence of a string. Empty parts are kept. An empty
+	separator never matches.
 	*/
-	StringEndsWithCString :: proc "c" (
+	SplitStringByString :: proc "c" (
 		str: string,
-		suffix: cstring,
+		separator: string,
 		comparisonType: StringComparisonType = { },
-	) -> b8 ---
+	) -> StringSplitIterator ---
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Returns the length of the given C-style null-terminated string, excluding the null terminator.
+	Split on every occurrence of any of the bytes in 'separators'. Empty parts are kept.
 	*/
-	CStringStartsWith :: proc "c" (
-		str: cstring,
-		prefix: string,
-		comparisonType: StringComparisonType = { },
-	) -> b8 ---
+	SplitStringByAnyOf :: proc "c" (
+		str: string,
+		separators: string,
+	) -> StringSplitIterator ---
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Checks if a C-style null-terminated string ends with the specified UTF-8 suffix.
+	Split into lines, on "\n" or "\r\n". A newline at the very end does not start
+	another (empty) line.
 	*/
-	CStringEndsWith :: proc "c" (
-		str: cstring,
-		suffix: string,
-		comparisonType: StringComparisonType = { },
-	) -> b8 ---
+	SplitStringByLines :: proc "c" (
+		str: string,
+	) -> StringSplitIterator ---
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Checks if a C-style null-terminated string starts with the specified UTF-8 prefix.
+	Split on runs of ASCII whitespace. Empty parts are skipped, so only the words
+	come out.
 	*/
-	CStringStartsWithCString :: proc "c" (
+	SplitStringByWhitespace :: proc "c" (
 		str: string,
-		prefix: cstring,
-		comparisonType: StringComparisonType = { },
+	) -> StringSplitIterator ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Takes the next part from the start of what's left.
+	Returns false once there are no more parts.
+	*/
+	NextSplitFromStart :: proc "c" (
+		iterator: ^StringSplitIterator,
+		part: ^string,
 	) -> b8 ---
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Checks if a C-style null-terminated string ends with the specified UTF-8 suffix.
+	Takes the next part from the end of what's left.
+	Returns false once there are no more parts.
 	*/
-	CStringEndsWithCString :: proc "c" (
-		str: string,
-		suffix: cstring,
-		comparisonType: StringComparisonType = { },
+	NextSplitFromEnd :: proc "c" (
+		iterator: ^StringSplitIterator,
+		part: ^string,
 	) -> b8 ---
 }
 
-// Advanced comparisons ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Tokenizer ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/*
+The kinds of tokens the tokenizer produces.
+*/
+TokenType :: enum u8 {
+	EndOfInput = 0,
+	Identifier = 1,
+	Number = 2,
+	String = 3,
+	Symbol = 4,
+	Invalid = 5,
+}
+
+/*
+A single token.
+Identifiers are letters, digits, underscores and non-ASCII bytes, not starting
+with a digit.
+Numbers start with a digit (or a '.' followed by one) and are left for the
+number parsers to validate; a leading sign is a separate symbol.
+Strings are quoted with '"' or '\'', can contain backslash escapes, and have
+to end on the line they start on (otherwise they're invalid). Their text keeps
+the quotes.
+Symbols are any other single byte.
+*/
+Token :: struct  {
+	type: TokenType,
+	text: string,
+	line: i32,
+	column: i32,
+}
+
+/*
+Splits source text into tokens, without allocating.
+Create with `PNSLR_MakeTokenizer`; can be copied to save/restore its position.
+*/
+Tokenizer :: struct  {
+	source: string,
+	position: i64,
+	line: i32,
+	lineStart: i64,
+	lineCommentStart: string,
+}
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Searches for the first occurrence of a substring within a string.
-	Returns the index of the first occurrence, or -1 if not found.
+	Creates a tokenizer over the source text. Anything from 'lineCommentStart' to
+	the end of its line is skipped, like whitespace.
 	*/
-	SearchFirstIndexInString :: proc "c" (
-		str: string,
-		substring: string,
-		comparisonType: StringComparisonType = { },
-	) -> i32 ---
+	MakeTokenizer :: proc "c" (
+		source: string,
+		lineCommentStart: string = { },
+	) -> Tokenizer ---
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Searches for the last occurrence of a substring within a string.
-	Returns the index of the last occurrence, or -1 if not found.
+	Returns the next token and moves past it. At the end of the source, returns
+	`PNSLR_TokenType_EndOfInput` tokens.
 	*/
-	SearchLastIndexInString :: proc "c" (
-		str: string,
-		substring: string,
-		comparisonType: StringComparisonType = { },
-	) -> i32 ---
+	NextToken :: proc "c" (
+		tokenizer: ^Tokenizer,
+	) -> Token ---
 }
 
 @(link_prefix="PNSLR_")
 foreign {
 	/*
-	Replaces all occurrences of a substring within a string with a new value.
-	The returned string is allocated using the specified allocator.
+	Returns the next token without moving past it.
 	*/
-	ReplaceInString :: proc "c" (
-		str: string,
-		oldValue: string,
-		newValue: string,
-		allocator: Allocator,
-		comparisonType: StringComparisonType = { },
-	) -> string ---
+	PeekToken :: proc "c" (
+		tokenizer: ^Tokenizer,
+	) -> Token ---
 }
 
 // UTF-8 functionalities ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -1387,6 +2581,81 @@ foreign {
 	) -> DecodedRune ---
 }
 
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Checks whether a string is entirely well-formed UTF-8, i.e. without overlong encodings,
+	surrogates, runes past U+10FFFF or truncated sequences. Runs of ASCII are skipped in bulk.
+	*/
+	ValidateUTF8 :: proc "c" (
+		str: string,
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Counts the runes in a UTF-8 string; as many as decoding it rune by rune would produce,
+	with every byte of an invalid sequence counting as one error rune (U+FFFD).
+	*/
+	CountRunesInString :: proc "c" (
+		str: string,
+	) -> i64 ---
+}
+
+// UTF-16 conversions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Returns the number of UTF-16 code units needed to hold a UTF-8 string. Invalid
+	sequences count as one error rune (U+FFFD) per byte, as with `PNSLR_DecodeRune`.
+	*/
+	GetUTF16LengthOfUTF8 :: proc "c" (
+		str: string,
+	) -> i64 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Returns the number of bytes needed to hold a UTF-16 string as UTF-8.
+	Unpaired surrogates count as the error rune (U+FFFD).
+	*/
+	GetUTF8LengthOfUTF16 :: proc "c" (
+		str: []u16,
+	) -> i64 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Converts a UTF-8 string to a UTF-16 string, on every platform.
+	The output is measured first, then written in one go into a slice allocated
+	using the specified allocator. Invalid sequences are replaced with U+FFFD.
+	 *
+	Warning! - The output string will contain a null terminator and the slice count
+	will not include that null terminator.
+	*/
+	UTF16FromUTF8 :: proc "c" (
+		str: string,
+		allocator: Allocator,
+	) -> []u16 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Converts a UTF-16 string to a UTF-8 string, on every platform.
+	The output is measured first, then written in one go into a string allocated
+	using the specified allocator. Unpaired surrogates are replaced with U+FFFD.
+	*/
+	UTF8FromUTF16 :: proc "c" (
+		str: []u16,
+		allocator: Allocator,
+	) -> string ---
+}
+
 // Windows-specific bs for UTF-16 conversions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
 @(link_prefix="PNSLR_")
@@ -1394,7 +2663,8 @@ foreign {
 	/*
 	Converts a UTF-8 string to a UTF-16 string.
 	The returned string is allocated using the specified allocator.
-	Only available on Windows. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+	Meant for Windows APIs. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+	Elsewhere, this falls back to `PNSLR_UTF16FromUTF8`.
 	 *
 	Warning! - The output string will contain a null terminator and the slice count
 	will not include that null terminator.
@@ -1410,7 +2680,8 @@ foreign {
 	/*
 	Converts a UTF-16 string to a UTF-8 string.
 	The returned string is allocated using the specified allocator.
-	Only available on Windows. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+	Meant for Windows APIs. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+	Elsewhere, this falls back to `PNSLR_UTF8FromUTF16`.
 	 *
 	Warning! - All the trailing null terminator characters will be ignored.
 	*/
@@ -1506,6 +2777,8 @@ foreign {
 foreign {
 	/*
 	Append a 32-bit floating-point number to the string builder.
+	A negative `decimalPlaces` writes the shortest form that parses back to the same f32
+	(scientific notation below 1e-6 and from 1e21 up).
 	*/
 	AppendF32ToStringBuilder :: proc "c" (
 		builder: ^StringBuilder,
@@ -1518,6 +2791,9 @@ foreign {
 foreign {
 	/*
 	Append a 64-bit floating point number to the string builder.
+	A negative `decimalPlaces` writes the shortest form that parses back to the same f64
+	(scientific notation below 1e-6 and from 1e21 up). Infinities, and magnitudes from
+	2^64 up, are always written that way.
 	*/
 	AppendF64ToStringBuilder :: proc "c" (
 		builder: ^StringBuilder,
@@ -1688,7 +2964,7 @@ PrimitiveFmtType :: enum u8 {
 The internal encoding of a type-unspecific format specifier.
 For booleans, valueBufferA is 0 or 1.
 For floats, valueBufferA is the float value (reinterpret as relevant),
-    and valueBufferB is the number of decimal places (cast to i32).
+    and valueBufferB is the number of decimal places (cast to i32, negative for shortest).
 For integers, valueBufferA is the integer value (reinterpret as relevant),
     and the first half of valueBufferB is the base (cast to PNSLR_IntegerBase).
 For runes, valueBufferA is the rune value (reinterpret as u32).
@@ -1718,6 +2994,7 @@ foreign {
 foreign {
 	/*
 	Use when formatting a string. Pass as one of the varargs.
+	Pass a negative `decimalPlaces` for the shortest round-trip form.
 	*/
 	FmtF32 :: proc "c" (
 		value: f32,
@@ -1729,6 +3006,7 @@ foreign {
 foreign {
 	/*
 	Use when formatting a string. Pass as one of the varargs.
+	Pass a negative `decimalPlaces` for the shortest round-trip form.
 	*/
 	FmtF64 :: proc "c" (
 		value: f64,
@@ -1927,6 +3205,7 @@ foreign {
 foreign {
 	/*
 	Convert a 32-bit floating-point number to a string with specified decimal places.
+	Negative decimal places give the shortest string that round-trips.
 	*/
 	StringFromF32 :: proc "c" (
 		value: f32,
@@ -1939,6 +3218,7 @@ foreign {
 foreign {
 	/*
 	Convert a 64-bit floating-point number to a string with specified decimal places.
+	Negative decimal places give the shortest string that round-trips.
 	*/
 	StringFromF64 :: proc "c" (
 		value: f64,
@@ -2060,7 +3340,9 @@ foreign {
 foreign {
 	/*
 	Convert a valid string (numbers-only, with zero or one decimal points,
-	optional -/+ sign at the start) to a 32-bit floating-point number.
+	optional -/+ sign at the start, optional e/E exponent at the end) to a
+	32-bit floating-point number, rounded to the nearest one. Also accepts
+	"inf", "infinity" and "nan" (case-insensitive, optionally signed).
 	*/
 	F32FromString :: proc "c" (
 		str: string,
@@ -2072,7 +3354,9 @@ foreign {
 foreign {
 	/*
 	Convert a valid string (numbers-only, with zero or one decimal points,
-	optional -/+ sign at the start) to a 64-bit floating-point number.
+	optional -/+ sign at the start, optional e/E exponent at the end) to a
+	64-bit floating-point number, rounded to the nearest one. Also accepts
+	"inf", "infinity" and "nan" (case-insensitive, optionally signed).
 	*/
 	F64FromString :: proc "c" (
 		str: string,
@@ -2192,6 +3476,64 @@ foreign {
 	) -> b8 ---
 }
 
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Parse a list of numbers separated by `delimiter` (e.g. a CSV row) into `output`,
+	each one as per PNSLR_F32FromString, ignoring whitespace around them. `count` is
+	set to the number of values written. Fails on an invalid number, or when there
+	are more numbers than `output` can hold.
+	*/
+	F32ArrayFromString :: proc "c" (
+		str: string,
+		delimiter: u8,
+		output: []f32,
+		count: ^i64,
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Parse a list of numbers separated by `delimiter` into `output`, each one as per
+	PNSLR_F64FromString. See PNSLR_F32ArrayFromString for details.
+	*/
+	F64ArrayFromString :: proc "c" (
+		str: string,
+		delimiter: u8,
+		output: []f64,
+		count: ^i64,
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Parse a list of numbers separated by `delimiter` into `output`, each one as per
+	PNSLR_U64FromString. See PNSLR_F32ArrayFromString for details.
+	*/
+	U64ArrayFromString :: proc "c" (
+		str: string,
+		delimiter: u8,
+		output: []u64,
+		count: ^i64,
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Parse a list of numbers separated by `delimiter` into `output`, each one as per
+	PNSLR_I64FromString. See PNSLR_F32ArrayFromString for details.
+	*/
+	I64ArrayFromString :: proc "c" (
+		str: string,
+		delimiter: u8,
+		output: []i64,
+		count: ^i64,
+	) -> b8 ---
+}
+
 // #######################################################################################
 // IO
 // #######################################################################################
@@ -2289,6 +3631,50 @@ foreign {
 	) ---
 }
 
+/*
+Represents something found while walking a directory tree.
+Symbolic links are never followed, and are reported as files.
+*/
+DirectoryWalkEntry :: struct  {
+	path: Path,
+	name: string,
+	isDirectory: b8,
+	depth: i32,
+	size: i64,
+	timestamp: i64,
+}
+
+/*
+The signature of the delegate that's called for everything found while walking a directory tree.
+Return false to stop the whole walk. Set `exploreCurrentDirectory` to false to skip going into a directory.
+*/
+DirectoryWalkVisitorDelegate :: #type proc "c" (
+	payload: rawptr,
+	entry: DirectoryWalkEntry,
+	exploreCurrentDirectory: ^b8,
+) -> b8
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Walks through a whole directory tree, calling the visitor for everything in it.
+	A faster alternative to recursive `PNSLR_IterateDirectory` for big trees: it opens each directory
+	relative to its parent, only asks the filesystem about an entry when the directory listing doesn't
+	already say what it is, and never allocates per entry.
+	Sizes and timestamps cost an extra query per entry, so they're only filled in if asked for.
+	With more than one worker thread (the calling thread being one of them), subdirectories are spread
+	across them, and the visitor is called from all of them at once, in no particular order.
+	Returns true if the walk went through to the end, false if it couldn't start or was stopped.
+	*/
+	WalkDirectoryTree :: proc "c" (
+		path: Path,
+		visitorPayload: rawptr,
+		visitorFunc: DirectoryWalkVisitorDelegate,
+		querySizeAndTimestamp: b8 = { },
+		numWorkerThreads: i32 = { },
+	) -> b8 ---
+}
+
 /*
 Represents the type of path check to perform when checking if a path exists.
 */
@@ -2423,8 +3809,9 @@ foreign {
 foreign {
 	/*
 	Reads data from an opened file at the current position.
+	Keeps reading until the buffer is full, and is only short at the end of the file.
 	Optionally stores the number of bytes read.
-	Returns true on success, false on failure.
+	Returns true if the whole buffer was filled, false otherwise.
 	*/
 	ReadFromFile :: proc "c" (
 		handle: File,
@@ -2437,6 +3824,7 @@ foreign {
 foreign {
 	/*
 	Writes data to an opened file at the current position.
+	Keeps writing until all of it is written.
 	Returns true on success, false on failure.
 	*/
 	WriteToFile :: proc "c" (
@@ -2445,6 +3833,66 @@ foreign {
 	) -> b8 ---
 }
 
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Reads data from an opened file at the given offset, without going through the current position,
+	so multiple threads can read from the same file at once.
+	Keeps reading until the buffer is full, and is only short at the end of the file.
+	Optionally stores the number of bytes read.
+	Returns true if the whole buffer was filled, false otherwise.
+	*/
+	ReadFromFileAt :: proc "c" (
+		handle: File,
+		offset: i64,
+		dst: []u8,
+		readSize: ^i64 = { },
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Writes data to an opened file at the given offset, without going through the current position.
+	Keeps writing until all of it is written.
+	Returns true on success, false on failure.
+	*/
+	WriteToFileAt :: proc "c" (
+		handle: File,
+		offset: i64,
+		src: []u8,
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Reads consecutive data from an opened file at the given offset into multiple buffers
+	(each one filled before moving onto the next), in as few calls to the OS as possible.
+	Works the same way as `PNSLR_ReadFromFileAt` otherwise.
+	*/
+	ScatterReadFromFileAt :: proc "c" (
+		handle: File,
+		offset: i64,
+		dsts: []string,
+		readSize: ^i64 = { },
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Writes multiple buffers one after the other to an opened file at the given offset,
+	in as few calls to the OS as possible.
+	Works the same way as `PNSLR_WriteToFileAt` otherwise.
+	*/
+	GatherWriteToFileAt :: proc "c" (
+		handle: File,
+		offset: i64,
+		srcs: []string,
+	) -> b8 ---
+}
+
 @(link_prefix="PNSLR_")
 foreign {
 	/*
@@ -2523,6 +3971,9 @@ foreign {
 foreign {
 	/*
 	Copies a file from src to dst. If dst exists, it will be overwritten.
+	Where possible, the data never goes through userspace: on linux this tries a reflink
+	(so the copy shares its blocks with the original), then copy_file_range, then sendfile,
+	before falling back to copying through a buffer.
 	Returns true on success, false on failure.
 	*/
 	CopyFile :: proc "c" (
@@ -2531,6 +3982,22 @@ foreign {
 	) -> b8 ---
 }
 
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Copies everything inside the src directory into the dst directory (which is created if it
+	doesn't exist), overwriting any files that are already there.
+	The files are copied by 'numWorkerThreads' threads at once (defaults to 4), one of which is
+	the calling thread; this returns once all of them are done.
+	Returns true if everything was copied, false otherwise.
+	*/
+	CopyDirectoryTree :: proc "c" (
+		src: Path,
+		dst: Path,
+		numWorkerThreads: i32 = { },
+	) -> b8 ---
+}
+
 @(link_prefix="PNSLR_")
 foreign {
 	/*
@@ -2543,6 +4010,84 @@ foreign {
 	) -> b8 ---
 }
 
+/*
+Represents how a memory-mapped file can be accessed.
+Copy-on-write mappings can be written to, but the changes are never written back to the file.
+Read-write mappings need a file that was opened for both reading and writing.
+*/
+FileMappingAccess :: enum u8 {
+	ReadOnly = 0,
+	CopyOnWrite = 1,
+	ReadWrite = 2,
+}
+
+/*
+Represents how a range of a memory-mapped file is going to be used, so the OS can
+read ahead (or not) accordingly.
+*/
+FileMappingHint :: enum u8 {
+	Normal = 0,
+	Sequential = 1,
+	Random = 2,
+	WillNeed = 3,
+	DontNeed = 4,
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Maps 'size' bytes of an opened file, starting at 'offset', into memory; if size is 0,
+	everything from the offset to the end of the file is mapped. The range has to be within the file,
+	but the offset doesn't need to be aligned to anything.
+	The file handle can be closed while the mapping is still in use.
+	Returns an empty slice on failure.
+	*/
+	MapFile :: proc "c" (
+		handle: File,
+		access: FileMappingAccess,
+		offset: i64 = { },
+		size: i64 = { },
+	) -> []u8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Tells the OS how a range of a memory-mapped file is going to be used.
+	The range can be any part of a mapping returned by `PNSLR_MapFile`.
+	Returns true on success, false on failure.
+	*/
+	AdviseFileMapping :: proc "c" (
+		range: []u8,
+		hint: FileMappingHint,
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Writes any changes in a range of a read-write memory-mapped file back to the file.
+	The range can be any part of a mapping returned by `PNSLR_MapFile`.
+	On Unix this waits for the data to reach the disk. On Windows it only starts the write-back,
+	since the mapping doesn't keep the file handle around; use `PNSLR_FlushFile` on an open handle
+	to the same file when the data has to be on disk.
+	Returns true on success, false on failure.
+	*/
+	FlushFileMapping :: proc "c" (
+		range: []u8,
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Unmaps a memory-mapped file. Has to be given exactly what `PNSLR_MapFile` returned.
+	*/
+	UnmapFile :: proc "c" (
+		mapping: []u8,
+	) ---
+}
+
 // #######################################################################################
 // DynaLib
 // #######################################################################################
@@ -2968,6 +4513,57 @@ foreign {
 	) ---
 }
 
+// Compiled formats ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/*
+A format string that has been split up ahead of time, for formats that get used
+over and over (log lines, etc.). The same rules as `PNSLR_FormatAndWriteToStream`
+apply. Create with `PNSLR_CompileFormat`, free with `PNSLR_FreeCompiledFormat`.
+*/
+CompiledFormat :: struct  {
+	literals: []string,
+	literalsLength: i64,
+	allocator: Allocator,
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Splits a format string into the literal runs between its placeholders.
+	The compiled format does not refer back to 'fmtStr'.
+	Returns a zeroed compiled format on failure.
+	*/
+	CompileFormat :: proc "c" (
+		fmtStr: string,
+		allocator: Allocator,
+	) -> CompiledFormat ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Frees a compiled format, and zeroes it.
+	*/
+	FreeCompiledFormat :: proc "c" (
+		format: ^CompiledFormat,
+	) ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Formats with a compiled format and writes the result to the stream, in a single
+	write. The space needed is worked out up front, so nothing gets resized midway.
+	A string builder stream is formatted into directly.
+	Returns true on success, false on failure.
+	*/
+	FormatCompiledAndWriteToStream :: proc "c" (
+		stream: Stream,
+		format: ^CompiledFormat,
+		args: []PrimitiveFmtOptions,
+	) -> b8 ---
+}
+
 // Stream casts ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
 @(link_prefix="PNSLR_")
@@ -2990,6 +4586,27 @@ foreign {
 	) -> Stream ---
 }
 
+/*
+The state of a stream over a memory-mapped file; 'access' has to match what the
+mapping was created with. See `PNSLR_StreamFromFileMapping`.
+*/
+FileMappingStream :: struct  {
+	mapping: []u8,
+	access: FileMappingAccess,
+	cursorPos: i64,
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Creates a stream over a memory-mapped file. Reads and writes go straight to the
+	mapped memory, and can't go past its end. Closing the stream unmaps the file.
+	*/
+	StreamFromFileMapping :: proc "c" (
+		mappingStream: ^FileMappingStream,
+	) -> Stream ---
+}
+
 @(link_prefix="PNSLR_")
 foreign {
 	/*
@@ -3010,6 +4627,25 @@ foreign {
 	) -> Stream ---
 }
 
+// Allocator reports ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Writes a report of a tracking allocator to the stream: the overall stats, then one
+	line per call site (file:line), largest live bytes first.
+	At most 'maxCallSites' call sites are written, or all of them if it's zero or less.
+	'tempAllocator' is used to merge the call sites across threads.
+	Returns true on success, false on failure.
+	*/
+	WriteTrackingAllocatorReportToStream :: proc "c" (
+		stream: Stream,
+		trackingAllocator: Allocator,
+		tempAllocator: Allocator,
+		maxCallSites: i32 = { },
+	) -> b8 ---
+}
+
 // #######################################################################################
 // Logger
 // #######################################################################################
@@ -3657,6 +5293,289 @@ foreign {
 	) -> b8 ---
 }
 
+// #######################################################################################
+// StringInterner
+// #######################################################################################
+
+// String Interner ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/*
+A table of unique strings, each one given a small handle that never changes.
+Two interned strings are equal exactly when their handles are, so comparing or
+hashing them afterwards is a single integer operation.
+Interning and lookups are safe to do from multiple threads at once.
+The handle 0 never refers to a string.
+*/
+StringInterner :: struct  {
+	data: rawptr,
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Creates an empty string interner. All of its memory, including the copies of the
+	interned strings, comes from the provided allocator, which has to be thread-safe
+	if strings are going to be interned from more than one thread.
+	*/
+	CreateStringInterner :: proc "c" (
+		allocator: Allocator,
+	) -> StringInterner ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Destroys a string interner. Every string obtained from it is invalid afterwards.
+	*/
+	DestroyStringInterner :: proc "c" (
+		interner: ^StringInterner,
+	) ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Returns the handle for a string, copying it into the interner if it wasn't there already.
+	Returns 0 if the string could not be added.
+	*/
+	InternString :: proc "c" (
+		interner: StringInterner,
+		str: string,
+	) -> u32 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Returns the handle for a string if it has already been interned, or 0 if it hasn't.
+	Never adds anything to the interner.
+	*/
+	FindInternedString :: proc "c" (
+		interner: StringInterner,
+		str: string,
+	) -> u32 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Returns the string for a handle, or an empty string if the handle is not valid.
+	The returned string is null-terminated, and lives as long as the interner does.
+	*/
+	GetInternedString :: proc "c" (
+		interner: StringInterner,
+		handle: u32,
+	) -> string ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Returns the number of strings in the interner.
+	*/
+	GetInternedStringsCount :: proc "c" (
+		interner: StringInterner,
+	) -> i64 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Writes all the strings in the interner to a file, such that loading it back
+	gives every string the same handle it has now.
+	*/
+	SaveStringInternerToFile :: proc "c" (
+		interner: StringInterner,
+		path: Path,
+	) -> b8 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Creates a string interner from a file written by `PNSLR_SaveStringInternerToFile`.
+	Returns an interner with no data if the file could not be read or is not valid.
+	*/
+	LoadStringInternerFromFile :: proc "c" (
+		path: Path,
+		allocator: Allocator,
+	) -> StringInterner ---
+}
+
+// #######################################################################################
+// AsyncIO
+// #######################################################################################
+
+// Requests and completions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/*
+Represents what an asynchronous I/O request does.
+*/
+AsyncIOOperation :: enum u8 {
+	Read = 0,
+	Write = 1,
+	Flush = 2,
+}
+
+/*
+A single asynchronous read, write or flush against an opened file.
+Reads and writes happen at 'offset', whatever the file's cursor is at.
+The buffer (unused for flushes) has to stay valid until the request completes.
+Zero-length reads and writes succeed straight away, without touching the file.
+'userData' is handed back unchanged in the request's completion.
+*/
+AsyncIORequest :: struct  {
+	file: File,
+	operation: AsyncIOOperation,
+	offset: i64,
+	buffer: []u8,
+	userData: u64,
+}
+
+// declare []AsyncIORequest
+
+/*
+Represents how an asynchronous I/O request ended.
+*/
+AsyncIOStatus :: enum u8 {
+	Succeeded = 0,
+	Failed = 1,
+	Cancelled = 2,
+}
+
+/*
+The result of an asynchronous I/O request.
+Reads and writes are carried on until the whole buffer is done, so the
+number of bytes transferred is only ever short for a read that hit the end of the file.
+*/
+AsyncIOCompletion :: struct  {
+	userData: u64,
+	bytesTransferred: i64,
+	status: AsyncIOStatus,
+}
+
+// declare []AsyncIOCompletion
+
+// Queues ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/*
+Represents what carries out the requests of an asynchronous I/O queue.
+The default is io_uring where the kernel supports it, and a pool of worker threads
+doing blocking positional reads and writes everywhere else.
+*/
+AsyncIOBackend :: enum u8 {
+	Default = 0,
+	ThreadPool = 1,
+	IoUring = 2,
+}
+
+/*
+A queue of asynchronous I/O requests. A queue is meant to be used from one thread;
+use one queue per thread that issues requests.
+*/
+AsyncIOQueue :: struct  {
+	data: rawptr,
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Creates an asynchronous I/O queue that can have up to 'capacity' requests in flight.
+	'numWorkerThreads' only applies to the thread pool backend (defaults to 4).
+	Returns a queue with no data if the backend asked for isn't available.
+	*/
+	CreateAsyncIOQueue :: proc "c" (
+		allocator: Allocator,
+		capacity: i32,
+		backend: AsyncIOBackend = { },
+		numWorkerThreads: i32 = { },
+	) -> AsyncIOQueue ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Destroys an asynchronous I/O queue, after waiting for every request in flight to finish.
+	Completions that haven't been collected are dropped.
+	*/
+	DestroyAsyncIOQueue :: proc "c" (
+		queue: ^AsyncIOQueue,
+	) ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Gets the backend an asynchronous I/O queue ended up with.
+	*/
+	GetAsyncIOQueueBackend :: proc "c" (
+		queue: AsyncIOQueue,
+	) -> AsyncIOBackend ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Submits a batch of requests in one go.
+	Returns how many of them (from the start of the batch) were accepted; fewer than
+	all of them means the queue is full, and completions need to be collected first.
+	*/
+	SubmitAsyncIORequests :: proc "c" (
+		queue: AsyncIOQueue,
+		requests: []AsyncIORequest,
+	) -> i32 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Collects finished requests without waiting.
+	Returns how many completions were written to the output.
+	*/
+	PollAsyncIOCompletions :: proc "c" (
+		queue: AsyncIOQueue,
+		output: []AsyncIOCompletion,
+	) -> i32 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Collects finished requests, waiting until there are at least 'minCompletions' of them
+	(or until nothing is in flight any more).
+	Returns how many completions were written to the output.
+	*/
+	WaitForAsyncIOCompletions :: proc "c" (
+		queue: AsyncIOQueue,
+		output: []AsyncIOCompletion,
+		minCompletions: i32 = { },
+	) -> i32 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Gets the number of requests that have been submitted, but whose completions haven't been collected.
+	*/
+	GetNumAsyncIORequestsInFlight :: proc "c" (
+		queue: AsyncIOQueue,
+	) -> i32 ---
+}
+
+@(link_prefix="PNSLR_")
+foreign {
+	/*
+	Asks for the in-flight requests with the given user data to be cancelled.
+	Requests that were already being carried out may still finish normally;
+	either way, each one still produces exactly one completion.
+	Returns true if any matching request hadn't finished yet.
+	*/
+	CancelAsyncIORequests :: proc "c" (
+		queue: AsyncIOQueue,
+		userData: u64,
+	) -> b8 ---
+}
+
 #assert(size_of(int)  == 8, " int must be 8 bytes")
 #assert(size_of(uint) == 8, "uint must be 8 bytes")
 
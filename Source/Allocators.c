@@ -1,5 +1,7 @@
 #define PNSLR_IMPLEMENTATION
 #include "Allocators.h"
+#include "Memory.h"
+#include "Sync.h"
 
 static inline u64 PNSLR_Internal_AlignU64Forward(u64 value, u64 alignment)
 {
@@ -13,7 +15,7 @@ static inline rawptr PNSLR_Internal_AlignRawptrForward(rawptr ptr, u64 alignment
     return (rawptr) PNSLR_Internal_AlignU64Forward((u64) ptr, alignment);
 }
 
-rawptr PNSLR_Allocate(PNSLR_Allocator allocator, b8 zeroed, i32 size, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+rawptr PNSLR_Allocate(PNSLR_Allocator allocator, b8 zeroed, i64 size, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
 {
     if (!allocator.procedure)
     {
@@ -33,7 +35,7 @@ rawptr PNSLR_Allocate(PNSLR_Allocator allocator, b8 zeroed, i32 size, i32 alignm
     );
 }
 
-rawptr PNSLR_Resize(PNSLR_Allocator allocator, b8 zeroed, rawptr oldMemory, i32 oldSize, i32 newSize, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+rawptr PNSLR_Resize(PNSLR_Allocator allocator, b8 zeroed, rawptr oldMemory, i64 oldSize, i64 newSize, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
 {
     if (!allocator.procedure)
     {
@@ -53,7 +55,7 @@ rawptr PNSLR_Resize(PNSLR_Allocator allocator, b8 zeroed, rawptr oldMemory, i32
     );
 }
 
-rawptr PNSLR_DefaultResize(PNSLR_Allocator allocator, b8 zeroed, rawptr oldMemory, i32 oldSize, i32 newSize, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+rawptr PNSLR_DefaultResize(PNSLR_Allocator allocator, b8 zeroed, rawptr oldMemory, i64 oldSize, i64 newSize, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
 {
     if (!allocator.procedure) { return nil; }
 
@@ -142,7 +144,7 @@ PNSLR_Allocator PNSLR_GetAllocator_DefaultHeap(void)
     return (PNSLR_Allocator) {.procedure = PNSLR_AllocatorFn_DefaultHeap, .data = nil};
 }
 
-rawptr PNSLR_AllocatorFn_DefaultHeap(rawptr allocatorData, PNSLR_AllocatorMode mode, i32 size, i32 alignment, rawptr oldMemory, i32 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+rawptr PNSLR_AllocatorFn_DefaultHeap(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
 {
     // clear error by default
     if (error) { *error = PNSLR_AllocatorError_None; }
@@ -253,21 +255,441 @@ rawptr PNSLR_AllocatorFn_DefaultHeap(rawptr allocatorData, PNSLR_AllocatorMode m
     }
 }
 
-static PNSLR_ArenaAllocatorBlock* PNSLR_Internal_NewArenaAllocatorBlock(PNSLR_Allocator backingAllocator, u32 capacity, u32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+#define PNSLR_INTERNAL_TCHEAP_SPAN_SIZE          (256 * 1024)
+#define PNSLR_INTERNAL_TCHEAP_MAX_RESERVE_SIZE   (64LL * 1024 * 1024 * 1024)
+#define PNSLR_INTERNAL_TCHEAP_MAX_SPANS          (PNSLR_INTERNAL_TCHEAP_MAX_RESERVE_SIZE / PNSLR_INTERNAL_TCHEAP_SPAN_SIZE)
+#define PNSLR_INTERNAL_TCHEAP_NUM_SIZE_CLASSES   40 // 16-byte steps up to 128, then 4 steps per power of two up to 32K
+#define PNSLR_INTERNAL_TCHEAP_MAX_SMALL_SIZE     (32 * 1024)
+#define PNSLR_INTERNAL_TCHEAP_CACHE_BYTES        (64 * 1024) // per size class, per thread
+
+typedef struct PNSLR_Internal_TCHeapCacheBin
+{
+    rawptr freeList;    // recycled blocks, contents are garbage
+    i32    count;
+    u8*    freshCursor; // never-touched blocks straight from the OS, contents are zero
+    u8*    freshEnd;
+} PNSLR_Internal_TCHeapCacheBin;
+
+typedef struct PNSLR_Internal_TCHeapLargeHeader
+{
+    rawptr base;
+    i64    reserved;
+    i64    capacity;
+} PNSLR_Internal_TCHeapLargeHeader;
+
+typedef struct PNSLR_Internal_TCHeapState
+{
+    PNSLR_Mutex mutex;
+    u8*         region;
+    i64         regionSize;
+    i64         regionUsed;
+    rawptr      centralFreeLists[PNSLR_INTERNAL_TCHEAP_NUM_SIZE_CLASSES];
+    i64         centralCounts[PNSLR_INTERNAL_TCHEAP_NUM_SIZE_CLASSES];
+    u8          spanSizeClasses[PNSLR_INTERNAL_TCHEAP_MAX_SPANS];
+} PNSLR_Internal_TCHeapState;
+
+static PNSLR_Internal_TCHeapState    G_PNSLR_Internal_TCHeap     = {0};
+static PNSLR_DoOnce                  G_PNSLR_Internal_TCHeapInit = {0};
+static thread_local b8               G_PNSLR_Internal_TCHeapThreadInitialised = false;
+static thread_local PNSLR_Internal_TCHeapCacheBin G_PNSLR_Internal_TCHeapCache[PNSLR_INTERNAL_TCHEAP_NUM_SIZE_CLASSES] = {0};
+
+static void PNSLR_Internal_InitialiseTCHeap(void)
+{
+    G_PNSLR_Internal_TCHeap.mutex = PNSLR_CreateMutex();
+
+    // reserve as much address space as we can get, aligned to the span size so that spans are naturally aligned
+    for (i64 size = PNSLR_INTERNAL_TCHEAP_MAX_RESERVE_SIZE; size >= 64LL * 1024 * 1024; size /= 4)
+    {
+        u8* reserved = (u8*) PNSLR_ReserveVirtualMemory(size + PNSLR_INTERNAL_TCHEAP_SPAN_SIZE);
+        if (!reserved) { continue; }
+
+        G_PNSLR_Internal_TCHeap.region     = (u8*) PNSLR_Internal_AlignRawptrForward(reserved, PNSLR_INTERNAL_TCHEAP_SPAN_SIZE);
+        G_PNSLR_Internal_TCHeap.regionSize = size;
+        break;
+    }
+}
+
+static inline i32 PNSLR_Internal_GetTCHeapSizeClassSize(i32 sizeClass)
+{
+    if (sizeClass < 8) { return (sizeClass + 1) * 16; }
+
+    i32 step  = sizeClass - 8;
+    i32 log2  = 7 + (step / 4);
+    return (1 << log2) + ((step % 4) + 1) * (1 << (log2 - 2));
+}
+
+static inline i32 PNSLR_Internal_GetTCHeapSizeClass(i32 size)
+{
+    if (size <= 128) { return (size <= 16) ? 0 : ((size + 15) / 16) - 1; }
+
+    u32 value = (u32) (size - 1);
+    i32 log2  = 7;
+    while ((value >> (log2 + 1)) != 0) { log2++; }
+
+    return 8 + ((log2 - 7) * 4) + (i32) ((value - (1U << log2)) >> (log2 - 2));
+}
+
+static inline i32 PNSLR_Internal_GetTCHeapMaxCachedCount(i32 sizeClass)
+{
+    i32 count = PNSLR_INTERNAL_TCHEAP_CACHE_BYTES / PNSLR_Internal_GetTCHeapSizeClassSize(sizeClass);
+    return (count < 4) ? 4 : ((count > 256) ? 256 : count);
+}
+
+static inline b8 PNSLR_Internal_IsTCHeapSmallAllocation(rawptr memory)
+{
+    return (u64) memory >= (u64) G_PNSLR_Internal_TCHeap.region &&
+           (u64) memory <  (u64) G_PNSLR_Internal_TCHeap.region + (u64) G_PNSLR_Internal_TCHeap.regionSize;
+}
+
+static b8 PNSLR_Internal_RefillTCHeapCacheBin(i32 sizeClass)
+{
+    PNSLR_Internal_TCHeapCacheBin* bin = &G_PNSLR_Internal_TCHeapCache[sizeClass];
+    i32 batchSize = PNSLR_Internal_GetTCHeapMaxCachedCount(sizeClass) / 2;
+    b8  output    = true;
+
+    PNSLR_LockMutex(&G_PNSLR_Internal_TCHeap.mutex);
+
+    if (G_PNSLR_Internal_TCHeap.centralFreeLists[sizeClass])
+    {
+        // move a batch over from the central free list
+        while (batchSize-- > 0 && G_PNSLR_Internal_TCHeap.centralFreeLists[sizeClass])
+        {
+            rawptr block = G_PNSLR_Internal_TCHeap.centralFreeLists[sizeClass];
+            G_PNSLR_Internal_TCHeap.centralFreeLists[sizeClass] = *(rawptr*) block;
+            G_PNSLR_Internal_TCHeap.centralCounts[sizeClass]--;
+
+            *(rawptr*) block = bin->freeList;
+            bin->freeList    = block;
+            bin->count++;
+        }
+    }
+    else if (G_PNSLR_Internal_TCHeap.regionUsed + PNSLR_INTERNAL_TCHEAP_SPAN_SIZE <= G_PNSLR_Internal_TCHeap.regionSize)
+    {
+        // carve out a brand new span, the whole thing goes to this thread
+        u8* span = G_PNSLR_Internal_TCHeap.region + G_PNSLR_Internal_TCHeap.regionUsed;
+        if (PNSLR_CommitVirtualMemory(span, PNSLR_INTERNAL_TCHEAP_SPAN_SIZE))
+        {
+            i32 blockSize = PNSLR_Internal_GetTCHeapSizeClassSize(sizeClass);
+            G_PNSLR_Internal_TCHeap.spanSizeClasses[G_PNSLR_Internal_TCHeap.regionUsed / PNSLR_INTERNAL_TCHEAP_SPAN_SIZE] = (u8) sizeClass;
+            G_PNSLR_Internal_TCHeap.regionUsed += PNSLR_INTERNAL_TCHEAP_SPAN_SIZE;
+
+            bin->freshCursor = span;
+            bin->freshEnd    = span + ((PNSLR_INTERNAL_TCHEAP_SPAN_SIZE / blockSize) * blockSize);
+        }
+        else
+        {
+            output = false;
+        }
+    }
+    else
+    {
+        output = false; // out of address space, caller falls back to a large allocation
+    }
+
+    PNSLR_UnlockMutex(&G_PNSLR_Internal_TCHeap.mutex);
+    return output;
+}
+
+static void PNSLR_Internal_ReleaseTCHeapCacheBin(i32 sizeClass, i32 countToRelease)
+{
+    PNSLR_Internal_TCHeapCacheBin* bin = &G_PNSLR_Internal_TCHeapCache[sizeClass];
+    if (!bin->freeList || countToRelease <= 0) { return; }
+
+    // detach the chain locally, only splice it in under the lock
+    rawptr first = bin->freeList;
+    rawptr last  = first;
+    i32    count = 1;
+    while (count < countToRelease && *(rawptr*) last) { last = *(rawptr*) last; count++; }
+
+    bin->freeList = *(rawptr*) last;
+    bin->count   -= count;
+
+    PNSLR_LockMutex(&G_PNSLR_Internal_TCHeap.mutex);
+    *(rawptr*) last = G_PNSLR_Internal_TCHeap.centralFreeLists[sizeClass];
+    G_PNSLR_Internal_TCHeap.centralFreeLists[sizeClass] = first;
+    G_PNSLR_Internal_TCHeap.centralCounts[sizeClass]   += count;
+    PNSLR_UnlockMutex(&G_PNSLR_Internal_TCHeap.mutex);
+}
+
+static rawptr PNSLR_Internal_AllocateSmallFromTCHeap(i32 sizeClass, i64 size, b8 zeroed)
+{
+    PNSLR_Internal_TCHeapCacheBin* bin = &G_PNSLR_Internal_TCHeapCache[sizeClass];
+
+    for (i32 attempt = 0; attempt < 2; ++attempt)
+    {
+        if (bin->freeList)
+        {
+            rawptr output = bin->freeList;
+            bin->freeList = *(rawptr*) output;
+            bin->count--;
+
+            if (zeroed) { PNSLR_MemSet(output, 0, size); }
+            return output;
+        }
+
+        if (bin->freshCursor < bin->freshEnd)
+        {
+            rawptr output = bin->freshCursor; // already zeroed
+            bin->freshCursor += PNSLR_Internal_GetTCHeapSizeClassSize(sizeClass);
+            return output;
+        }
+
+        if (!PNSLR_Internal_RefillTCHeapCacheBin(sizeClass)) { break; }
+    }
+
+    return nil;
+}
+
+static void PNSLR_Internal_FreeSmallFromTCHeap(rawptr memory)
+{
+    u64 spanIndex = ((u64) memory - (u64) G_PNSLR_Internal_TCHeap.region) / PNSLR_INTERNAL_TCHEAP_SPAN_SIZE;
+    i32 sizeClass = (i32) G_PNSLR_Internal_TCHeap.spanSizeClasses[spanIndex];
+
+    PNSLR_Internal_TCHeapCacheBin* bin = &G_PNSLR_Internal_TCHeapCache[sizeClass];
+    *(rawptr*) memory = bin->freeList;
+    bin->freeList     = memory;
+    bin->count++;
+
+    i32 maxCount = PNSLR_Internal_GetTCHeapMaxCachedCount(sizeClass);
+    if (bin->count > maxCount) { PNSLR_Internal_ReleaseTCHeapCacheBin(sizeClass, maxCount / 2); }
+}
+
+static rawptr PNSLR_Internal_AllocateLargeFromTCHeap(i64 size, i32 alignment, PNSLR_AllocatorError* error)
+{
+    i64 pageSize   = PNSLR_GetVirtualMemoryPageSize();
+    i64 headerSize = (i64) PNSLR_Internal_AlignU64Forward(sizeof(PNSLR_Internal_TCHeapLargeHeader), (u64) alignment);
+    i64 slack      = (alignment > pageSize) ? alignment : 0; // mappings are only page-aligned
+    i64 reserved   = (i64) PNSLR_Internal_AlignU64Forward((u64) (headerSize + slack + size), (u64) pageSize);
+
+    u8* base = (u8*) PNSLR_ReserveVirtualMemory(reserved);
+    if (!base || !PNSLR_CommitVirtualMemory(base, reserved))
+    {
+        if (base) { PNSLR_ReleaseVirtualMemory(base, reserved); }
+        if (error) { *error = PNSLR_AllocatorError_OutOfMemory; }
+        return nil;
+    }
+
+    // fresh pages are already zeroed
+    u8* output = (u8*) PNSLR_Internal_AlignRawptrForward(base + headerSize, (u64) alignment);
+    PNSLR_Internal_TCHeapLargeHeader* header = (PNSLR_Internal_TCHeapLargeHeader*) output - 1;
+    header->base     = base;
+    header->reserved = reserved;
+    header->capacity = reserved - (output - base);
+    return output;
+}
+
+static void PNSLR_Internal_FreeLargeFromTCHeap(rawptr memory)
+{
+    PNSLR_Internal_TCHeapLargeHeader* header = (PNSLR_Internal_TCHeapLargeHeader*) memory - 1;
+    PNSLR_ReleaseVirtualMemory(header->base, header->reserved);
+}
+
+static i32 PNSLR_Internal_GetTCHeapSizeClassForRequest(i64 size, i32 alignment)
+{
+    if (size > PNSLR_INTERNAL_TCHEAP_MAX_SMALL_SIZE || !G_PNSLR_Internal_TCHeap.region) { return -1; }
+
+    i32 sizeClass = PNSLR_Internal_GetTCHeapSizeClass((i32) size);
+    if (alignment <= 16) { return sizeClass; }
+
+    // spans are aligned to their size, so a block is aligned if its size is a multiple of the alignment
+    for (; sizeClass < PNSLR_INTERNAL_TCHEAP_NUM_SIZE_CLASSES; ++sizeClass)
+    {
+        if ((PNSLR_Internal_GetTCHeapSizeClassSize(sizeClass) & (alignment - 1)) == 0) { return sizeClass; }
+    }
+
+    return -1;
+}
+
+PNSLR_Allocator PNSLR_GetAllocator_ThreadCachingHeap(void)
+{
+    return (PNSLR_Allocator) {.procedure = PNSLR_AllocatorFn_ThreadCachingHeap, .data = nil};
+}
+
+rawptr PNSLR_AllocatorFn_ThreadCachingHeap(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    // clear error by default
+    if (error) { *error = PNSLR_AllocatorError_None; }
+
+    if (size < 0 )
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return nil; // Invalid size or alignment
+    }
+
+    // check alignment
+    if ((alignment < 1) || (alignment & (alignment - 1))) // if alignment is not a power of two
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+        return nil;
+    }
+
+    if (!G_PNSLR_Internal_TCHeapThreadInitialised)
+    {
+        PNSLR_ExecuteDoOnce(&G_PNSLR_Internal_TCHeapInit, PNSLR_Internal_InitialiseTCHeap);
+        G_PNSLR_Internal_TCHeapThreadInitialised = true;
+    }
+
+    switch (mode)
+    {
+        case PNSLR_AllocatorMode_Allocate:
+        case PNSLR_AllocatorMode_AllocateNoZero:
+        {
+            i32 sizeClass = PNSLR_Internal_GetTCHeapSizeClassForRequest(size, alignment);
+            if (sizeClass >= 0)
+            {
+                rawptr memory = PNSLR_Internal_AllocateSmallFromTCHeap(sizeClass, size, mode == PNSLR_AllocatorMode_Allocate);
+                if (memory) { return memory; }
+            }
+
+            return PNSLR_Internal_AllocateLargeFromTCHeap(size, alignment, error);
+        }
+        case PNSLR_AllocatorMode_Resize:
+        case PNSLR_AllocatorMode_ResizeNoZero:
+        {
+            if (!oldMemory)
+            {
+                return PNSLR_AllocatorFn_ThreadCachingHeap(
+                    allocatorData,
+                    mode == PNSLR_AllocatorMode_Resize ? PNSLR_AllocatorMode_Allocate : PNSLR_AllocatorMode_AllocateNoZero,
+                    size,
+                    alignment,
+                    nil,
+                    0,
+                    location,
+                    error
+                );
+            }
+
+            b8 aligned = ((((u64) oldMemory) & ((u64) (alignment - 1))) == 0);
+            if (aligned && PNSLR_Internal_IsTCHeapSmallAllocation(oldMemory))
+            {
+                u64 spanIndex = ((u64) oldMemory - (u64) G_PNSLR_Internal_TCHeap.region) / PNSLR_INTERNAL_TCHEAP_SPAN_SIZE;
+                i32 blockSize = PNSLR_Internal_GetTCHeapSizeClassSize((i32) G_PNSLR_Internal_TCHeap.spanSizeClasses[spanIndex]);
+
+                // still fits in the same block, and not so small that it should move down a few size classes
+                if (size <= blockSize && (size > blockSize / 4 || blockSize <= 64))
+                {
+                    if (size > oldSize && mode == PNSLR_AllocatorMode_Resize) { PNSLR_MemSet((u8*) oldMemory + oldSize, 0, size - oldSize); }
+                    return oldMemory;
+                }
+            }
+            else if (aligned)
+            {
+                PNSLR_Internal_TCHeapLargeHeader* header = (PNSLR_Internal_TCHeapLargeHeader*) oldMemory - 1;
+                if (size <= header->capacity && size > PNSLR_INTERNAL_TCHEAP_MAX_SMALL_SIZE)
+                {
+                    if (size > oldSize && mode == PNSLR_AllocatorMode_Resize) { PNSLR_MemSet((u8*) oldMemory + oldSize, 0, size - oldSize); }
+                    return oldMemory;
+                }
+
+                #if PNSLR_LINUX || PNSLR_ANDROID
+                    // the kernel only keeps the new mapping page-aligned, so anything stricter has to be copied
+                    i64 pageSize = PNSLR_GetVirtualMemoryPageSize();
+                    if (size > header->capacity && alignment <= pageSize)
+                    {
+                        // let the kernel move the page mappings around instead of copying
+                        i64 offset      = (u8*) oldMemory - (u8*) header->base;
+                        i64 newReserved = (i64) PNSLR_Internal_AlignU64Forward((u64) (offset + size), (u64) pageSize);
+
+                        u8* newBase = (u8*) mremap(header->base, (size_t) header->reserved, (size_t) newReserved, MREMAP_MAYMOVE);
+                        if (newBase != (u8*) MAP_FAILED)
+                        {
+                            // make sure the grown tail is accessible
+                            i64 oldReserved = ((PNSLR_Internal_TCHeapLargeHeader*) (newBase + offset) - 1)->reserved;
+                            PNSLR_CommitVirtualMemory(newBase + oldReserved, newReserved - oldReserved);
+
+                            header           = (PNSLR_Internal_TCHeapLargeHeader*) (newBase + offset) - 1;
+                            header->base     = newBase;
+                            header->reserved = newReserved;
+                            header->capacity = newReserved - offset;
+
+                            // new pages come zeroed, only the slack in the last old page might be dirty
+                            if (mode == PNSLR_AllocatorMode_Resize) { PNSLR_MemSet(newBase + offset + oldSize, 0, oldReserved - offset - oldSize); }
+                            return newBase + offset;
+                        }
+                    }
+                #endif
+            }
+
+            rawptr newMemory = PNSLR_AllocatorFn_ThreadCachingHeap(allocatorData, PNSLR_AllocatorMode_AllocateNoZero, size, alignment, nil, 0, location, error);
+            if (!newMemory) { return nil; }
+
+            PNSLR_MemCopy(newMemory, oldMemory, oldSize < size ? oldSize : size);
+            if (size > oldSize && mode == PNSLR_AllocatorMode_Resize) { PNSLR_MemSet((u8*) newMemory + oldSize, 0, size - oldSize); }
+
+            PNSLR_AllocatorFn_ThreadCachingHeap(allocatorData, PNSLR_AllocatorMode_Free, 0, 1, oldMemory, 0, location, nil);
+            return newMemory;
+        }
+        case PNSLR_AllocatorMode_Free:
+        {
+            if (oldMemory == nil)
+            {
+                if (error) { *error = PNSLR_AllocatorError_None; } // No memory to free
+                return nil;
+            }
+
+            if (PNSLR_Internal_IsTCHeapSmallAllocation(oldMemory)) { PNSLR_Internal_FreeSmallFromTCHeap(oldMemory); }
+            else                                                   { PNSLR_Internal_FreeLargeFromTCHeap(oldMemory); }
+
+            return nil;
+        }
+        case PNSLR_AllocatorMode_FreeAll:
+        {
+            if (error) { *error = PNSLR_AllocatorError_CantFreeAll; }
+            return nil;
+        }
+        case PNSLR_AllocatorMode_QueryCapabilities:
+        {
+            return (rawptr)(
+                PNSLR_AllocatorCapability_ThreadSafe |
+                PNSLR_AllocatorCapability_Free |
+                PNSLR_AllocatorCapability_Resize |
+                PNSLR_AllocatorCapability_HintHeap
+            );
+        }
+        default:
+            if (error) { *error = PNSLR_AllocatorError_InvalidMode; }
+            return nil; // Unsupported mode.
+    }
+}
+
+void PNSLR_FlushThreadCachingHeapCache(void)
+{
+    if (!G_PNSLR_Internal_TCHeapThreadInitialised) { return; }
+
+    for (i32 sizeClass = 0; sizeClass < PNSLR_INTERNAL_TCHEAP_NUM_SIZE_CLASSES; ++sizeClass)
+    {
+        PNSLR_Internal_TCHeapCacheBin* bin = &G_PNSLR_Internal_TCHeapCache[sizeClass];
+
+        // untouched blocks are still perfectly usable, they just lose their 'already zeroed' status
+        i32 blockSize = PNSLR_Internal_GetTCHeapSizeClassSize(sizeClass);
+        for (; bin->freshCursor < bin->freshEnd; bin->freshCursor += blockSize)
+        {
+            *(rawptr*) bin->freshCursor = bin->freeList;
+            bin->freeList = bin->freshCursor;
+            bin->count++;
+        }
+
+        PNSLR_Internal_ReleaseTCHeapCacheBin(sizeClass, bin->count);
+        *bin = (PNSLR_Internal_TCHeapCacheBin) {0};
+    }
+}
+
+static PNSLR_ArenaAllocatorBlock* PNSLR_Internal_NewArenaAllocatorBlock(PNSLR_Allocator backingAllocator, u64 capacity, u32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
 {
-    u32 baseOffset = (alignment > sizeof(PNSLR_ArenaAllocatorBlock) ? alignment : sizeof(PNSLR_ArenaAllocatorBlock));
-    u32 totalSize  = capacity + baseOffset;
+    u64 baseOffset = (alignment > sizeof(PNSLR_ArenaAllocatorBlock) ? alignment : sizeof(PNSLR_ArenaAllocatorBlock));
+    u64 totalSize  = capacity + baseOffset;
 
     i32 minAlignment = (alignof(PNSLR_ArenaAllocatorBlock) > alignment ? alignof(PNSLR_ArenaAllocatorBlock) : (i32) alignment);
     minAlignment     = (16 > minAlignment ? 16 : minAlignment);
 
-    rawptr output = PNSLR_Allocate(backingAllocator, true, (i32) totalSize, minAlignment, location, error);
+    rawptr output = PNSLR_Allocate(backingAllocator, true, (i64) totalSize, minAlignment, location, error);
     if (output == nil) { return nil; }
 
     PNSLR_ArenaAllocatorBlock* block    = (PNSLR_ArenaAllocatorBlock*) output;
     u64                        end      = (u64) block + totalSize;
     rawptr                     memory   = (rawptr)((u8*) block + baseOffset);
-    u32                        realCap  = (u32) (end - (u64) memory);
+    u64                        realCap  = (end - (u64) memory);
 
     *block = (PNSLR_ArenaAllocatorBlock)
     {
@@ -289,7 +711,7 @@ static void PNSLR_Internal_DestroyArenaAllocatorBlock(PNSLR_ArenaAllocatorBlock*
     }
 }
 
-static PNSLR_ArraySlice(u8) PNSLR_Internal_AllocateFromArenaAllocatorBlock(PNSLR_ArenaAllocatorBlock* block, u32 minSize, u32 alignment, PNSLR_AllocatorError* error)
+static PNSLR_ArraySlice(u8) PNSLR_Internal_AllocateFromArenaAllocatorBlock(PNSLR_ArenaAllocatorBlock* block, u64 minSize, u32 alignment, PNSLR_AllocatorError* error)
 {
     if (!block)
     {
@@ -320,11 +742,11 @@ static PNSLR_ArraySlice(u8) PNSLR_Internal_AllocateFromArenaAllocatorBlock(PNSLR
     }
 
     PNSLR_ArraySlice(u8) output = (PNSLR_ArraySlice(u8)) { .data = ((u8*) block->memory) + block->used + alignmentOffset, .count = (i64) minSize };
-    block->used += (u32) size;
+    block->used += size;
     return output;
 }
 
-static PNSLR_ArraySlice(u8) PNSLR_Internal_AllocateFromArenaAllocator(PNSLR_ArenaAllocatorPayload* data, u32 size, u32 alignment, PNSLR_SourceCodeLocation loc, PNSLR_AllocatorError* error)
+static PNSLR_ArraySlice(u8) PNSLR_Internal_AllocateFromArenaAllocator(PNSLR_ArenaAllocatorPayload* data, u64 size, u32 alignment, PNSLR_SourceCodeLocation loc, PNSLR_AllocatorError* error)
 {
     u64 needed = PNSLR_Internal_AlignU64Forward((u64) size, (u64) alignment);
     b8 createNewBlock = false;
@@ -345,7 +767,7 @@ static PNSLR_ArraySlice(u8) PNSLR_Internal_AllocateFromArenaAllocator(PNSLR_Aren
     if (createNewBlock)
     {
         if (data->minimumBlockSize == 0) { data->minimumBlockSize = 8 * 1024 * 1024; } // 8 MiB
-        u32 blockSize = (data->minimumBlockSize < (u32) needed) ? (u32) needed : data->minimumBlockSize; // pick larger
+        u64 blockSize = (data->minimumBlockSize < needed) ? needed : data->minimumBlockSize; // pick larger
 
         PNSLR_AllocatorError err2 = PNSLR_AllocatorError_None;
         PNSLR_ArenaAllocatorBlock* newBlock = PNSLR_Internal_NewArenaAllocatorBlock(data->backingAllocator, blockSize, alignment, loc, &err2);
@@ -360,8 +782,8 @@ static PNSLR_ArraySlice(u8) PNSLR_Internal_AllocateFromArenaAllocator(PNSLR_Aren
         data->totalCapacity += newBlock->capacity;
     }
 
-    u32 previousUsed = data->currentBlock->used;
-    PNSLR_ArraySlice(u8) output = PNSLR_Internal_AllocateFromArenaAllocatorBlock(data->currentBlock, (u32) size, (u32) alignment, error);
+    u64 previousUsed = data->currentBlock->used;
+    PNSLR_ArraySlice(u8) output = PNSLR_Internal_AllocateFromArenaAllocatorBlock(data->currentBlock, size, (u32) alignment, error);
     data->totalUsed += data->currentBlock->used - previousUsed;
     return output;
 }
@@ -379,14 +801,14 @@ static void PNSLR_Internal_FreeAllFromArenaAllocator(PNSLR_ArenaAllocatorPayload
 
     if (data->currentBlock != nil)
     {
-        PNSLR_MemSet(data->currentBlock->memory, 0, (i32) data->currentBlock->used);
+        PNSLR_MemSet(data->currentBlock->memory, 0, (i64) data->currentBlock->used);
         data->currentBlock->used = 0;
     }
 
     data->totalUsed = 0;
 }
 
-PNSLR_Allocator PNSLR_NewAllocator_Arena(PNSLR_Allocator backingAllocator, u32 pageSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+PNSLR_Allocator PNSLR_NewAllocator_Arena(PNSLR_Allocator backingAllocator, u64 pageSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
 {
     PNSLR_ArenaAllocatorPayload* payload = PNSLR_Allocate(
         backingAllocator,
@@ -441,7 +863,7 @@ void PNSLR_DestroyAllocator_Arena(PNSLR_Allocator allocator, PNSLR_SourceCodeLoc
     PNSLR_Free(payload->backingAllocator, payload, location, error);
 }
 
-rawptr PNSLR_AllocatorFn_Arena(rawptr allocatorData, PNSLR_AllocatorMode mode, i32 size, i32 alignment, rawptr oldMemory, i32 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+rawptr PNSLR_AllocatorFn_Arena(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
 {
     // clear error by default
     if (error) { *error = PNSLR_AllocatorError_None; }
@@ -466,7 +888,7 @@ rawptr PNSLR_AllocatorFn_Arena(rawptr allocatorData, PNSLR_AllocatorMode mode, i
         case PNSLR_AllocatorMode_Allocate:
         case PNSLR_AllocatorMode_AllocateNoZero:
         {
-            return PNSLR_Internal_AllocateFromArenaAllocator(payload, (u32) size, (u32) alignment, location, error).data;
+            return PNSLR_Internal_AllocateFromArenaAllocator(payload, (u64) size, (u32) alignment, location, error).data;
         }
         case PNSLR_AllocatorMode_Free:
         {
@@ -485,7 +907,7 @@ rawptr PNSLR_AllocatorFn_Arena(rawptr allocatorData, PNSLR_AllocatorMode mode, i
 
             if (!oldData)
             {
-                return PNSLR_Internal_AllocateFromArenaAllocator(payload, (u32) size, (u32) alignment, location, error).data;
+                return PNSLR_Internal_AllocateFromArenaAllocator(payload, (u64) size, (u32) alignment, location, error).data;
             }
             else if (size == oldSize)
             {
@@ -507,13 +929,13 @@ rawptr PNSLR_AllocatorFn_Arena(rawptr allocatorData, PNSLR_AllocatorMode mode, i
                     if (start < oldEnd && oldEnd == block->used && newEnd <= block->capacity)
                     {
                         // grow output in-place, adjust for next allocation
-                        block->used = (u32) newEnd;
+                        block->used = newEnd;
                         return (rawptr) (((u8*) block->memory) + start);
                     }
                 }
             }
 
-            rawptr newMemory = PNSLR_Internal_AllocateFromArenaAllocator(payload, (u32) size, (u32) alignment, location, error).data;
+            rawptr newMemory = PNSLR_Internal_AllocateFromArenaAllocator(payload, (u64) size, (u32) alignment, location, error).data;
             if (!newMemory) { return nil; }
             PNSLR_MemCopy(newMemory, oldMemory, oldSize < size ? oldSize : size);
             return newMemory;
@@ -600,8 +1022,8 @@ PNSLR_ArenaSnapshotError PNSLR_RestoreArenaAllocatorSnapshot(PNSLR_ArenaAllocato
                 goto exitFunction;
             }
 
-            u32 amountToZero = block->used - snapshot->used;
-            PNSLR_MemSet(((u8*) block->memory) + snapshot->used, 0, (i32) amountToZero);
+            u64 amountToZero = block->used - snapshot->used;
+            PNSLR_MemSet(((u8*) block->memory) + snapshot->used, 0, (i64) amountToZero);
             block->used = snapshot->used;
             snapshot->payload->totalUsed -= amountToZero;
         }
@@ -631,162 +1053,2480 @@ PNSLR_ArenaSnapshotError PNSLR_DiscardArenaAllocatorSnapshot(PNSLR_ArenaAllocato
 }
 
 
-PNSLR_Allocator PNSLR_NewAllocator_Stack(PNSLR_Allocator backingAllocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+#define PNSLR_INTERNAL_VIRTUAL_ARENA_COMMIT_CHUNK_SIZE (64 * 1024) // commit in bigger chunks to cut down on syscalls
+
+static b8 PNSLR_Internal_EnsureVirtualArenaAllocatorCommitted(PNSLR_VirtualArenaAllocatorPayload* payload, i64 required, PNSLR_AllocatorError* error)
 {
-    PNSLR_StackAllocatorPayload* payload = PNSLR_Allocate(
-        backingAllocator,
-        true,
-        sizeof(PNSLR_StackAllocatorPayload),
-        alignof(PNSLR_StackAllocatorPayload),
-        location,
-        error
-    );
+    if (required <= payload->committed) { return true; }
 
-    if (!payload) { return PNSLR_GetAllocator_Nil(); }
+    if (required > payload->reserved)
+    {
+        if (error) { *error = PNSLR_AllocatorError_OutOfMemory; }
+        return false; // ran out of address space
+    }
 
-    payload->lastAllocation       = nil;
-    payload->lastAllocationHeader = nil;
-    payload->backingAllocator     = backingAllocator;
-    payload->currentPage          = PNSLR_Allocate(
-        backingAllocator,
-        true,
-        sizeof(PNSLR_StackAllocatorPage),
-        alignof(PNSLR_StackAllocatorPage),
-        location,
-        error
-    );
+    i64 chunkSize    = (payload->pageSize > PNSLR_INTERNAL_VIRTUAL_ARENA_COMMIT_CHUNK_SIZE) ? payload->pageSize : PNSLR_INTERNAL_VIRTUAL_ARENA_COMMIT_CHUNK_SIZE;
+    i64 newCommitted = (i64) PNSLR_Internal_AlignU64Forward((u64) required, (u64) chunkSize);
+    if (newCommitted > payload->reserved) { newCommitted = payload->reserved; }
 
-    payload->currentPage->previousPage = nil;
-    payload->currentPage->usedBytes    = 0;
+    if (!PNSLR_CommitVirtualMemory(payload->memory + payload->committed, newCommitted - payload->committed))
+    {
+        if (error) { *error = PNSLR_AllocatorError_OutOfMemory; }
+        return false;
+    }
 
-    return (PNSLR_Allocator) {
-        .procedure = PNSLR_AllocatorFn_Stack,
-        .data = payload
-    };
+    payload->committed = newCommitted;
+    return true;
 }
 
-void PNSLR_DestroyAllocator_Stack(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+static void PNSLR_Internal_RewindVirtualArenaAllocator(PNSLR_VirtualArenaAllocatorPayload* payload, i64 used)
 {
-    if (!allocator.procedure || !allocator.data) { return; }
-    if (error) { *error = PNSLR_AllocatorError_None; } // No error by default
+    // unused memory is kept zeroed, so allocations never need to clear it;
+    // whole chunks past the new cursor go back to the OS (and come back zeroed), the rest is cleared by hand
+    i64 chunkSize     = (payload->pageSize > PNSLR_INTERNAL_VIRTUAL_ARENA_COMMIT_CHUNK_SIZE) ? payload->pageSize : PNSLR_INTERNAL_VIRTUAL_ARENA_COMMIT_CHUNK_SIZE;
+    i64 keepCommitted = (i64) PNSLR_Internal_AlignU64Forward((u64) used, (u64) chunkSize);
+    if (keepCommitted > payload->committed) { keepCommitted = payload->committed; }
 
-    PNSLR_StackAllocatorPayload* payload = (PNSLR_StackAllocatorPayload*) allocator.data;
+    i64 zeroEnd = (payload->used < keepCommitted) ? payload->used : keepCommitted;
+    if (zeroEnd > used) { PNSLR_MemSet(payload->memory + used, 0, zeroEnd - used); }
 
-    // Free all pages in the stack allocator
-    for (PNSLR_StackAllocatorPage* page = payload->currentPage; page;)
+    if (keepCommitted < payload->committed && PNSLR_DecommitVirtualMemory(payload->memory + keepCommitted, payload->committed - keepCommitted))
     {
-        // Free the current page
-        PNSLR_StackAllocatorPage* nextPageToFree = page->previousPage;
-        PNSLR_Free(payload->backingAllocator, page, location, error);
-        if (error && *error != PNSLR_AllocatorError_None) { return; } // Stop on error
-        page = nextPageToFree;
+        payload->committed = keepCommitted;
+    }
+    else if (payload->used > zeroEnd)
+    {
+        PNSLR_MemSet(payload->memory + zeroEnd, 0, payload->used - zeroEnd); // couldn't decommit, so clear it instead
     }
 
-    // Free the payload itself
-    PNSLR_Free(payload->backingAllocator, payload, location, error);
-    if (error && *error != PNSLR_AllocatorError_None) { return; } // Stop on error
+    payload->used = used;
 }
 
-rawptr PNSLR_AllocatorFn_Stack(rawptr allocatorData, PNSLR_AllocatorMode mode, i32 size, i32 alignment, rawptr oldMemory, i32 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+static rawptr PNSLR_Internal_AllocateFromVirtualArenaAllocator(PNSLR_VirtualArenaAllocatorPayload* payload, i64 size, i32 alignment, PNSLR_AllocatorError* error)
+{
+    u64 start = PNSLR_Internal_AlignU64Forward((u64) payload->memory + (u64) payload->used, (u64) alignment) - (u64) payload->memory;
+    if (start > (u64) payload->reserved || size > payload->reserved - (i64) start)
+    {
+        if (error) { *error = PNSLR_AllocatorError_OutOfMemory; }
+        return nil; // checked up front, so the end can't overflow
+    }
+
+    i64 end   = (i64) start + size;
+    if (!PNSLR_Internal_EnsureVirtualArenaAllocatorCommitted(payload, end, error)) { return nil; }
+
+    payload->used = end;
+    return payload->memory + start;
+}
+
+PNSLR_Allocator PNSLR_NewAllocator_VirtualArena(i64 reserveSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
 {
-    // clear error by default
     if (error) { *error = PNSLR_AllocatorError_None; }
 
-    if (size < 0 )
+    i32 pageSize = PNSLR_GetVirtualMemoryPageSize();
+    reserveSize  = (i64) PNSLR_Internal_AlignU64Forward((u64) (reserveSize > 0 ? reserveSize : 0), (u64) pageSize);
+    if (reserveSize < (i64) sizeof(PNSLR_VirtualArenaAllocatorPayload))
     {
         if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
-        return nil; // Invalid size or alignment
+        return PNSLR_GetAllocator_Nil();
     }
 
-    // check alignment
-    if ((alignment < 1) || (alignment & (alignment - 1))) // if alignment is not a power of two
+    u8* memory = (u8*) PNSLR_ReserveVirtualMemory(reserveSize);
+    if (!memory)
+    {
+        if (error) { *error = PNSLR_AllocatorError_OutOfMemory; }
+        return PNSLR_GetAllocator_Nil();
+    }
+
+    // the payload lives at the start of the range, so a header-sized allocation has to be committed right away
+    PNSLR_VirtualArenaAllocatorPayload temp = {.memory = memory, .reserved = reserveSize, .committed = 0, .used = 0, .pageSize = pageSize};
+    PNSLR_VirtualArenaAllocatorPayload* payload = PNSLR_Internal_AllocateFromVirtualArenaAllocator(&temp, sizeof(PNSLR_VirtualArenaAllocatorPayload), alignof(PNSLR_VirtualArenaAllocatorPayload), error);
+    if (!payload)
+    {
+        PNSLR_ReleaseVirtualMemory(memory, reserveSize);
+        return PNSLR_GetAllocator_Nil();
+    }
+
+    *payload = temp;
+
+    return (PNSLR_Allocator) {
+        .procedure = PNSLR_AllocatorFn_VirtualArena,
+        .data = payload
+    };
+}
+
+void PNSLR_DestroyAllocator_VirtualArena(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (!allocator.procedure || !allocator.data) { return; }
+    if (error) { *error = PNSLR_AllocatorError_None; } // No error by default
+
+    PNSLR_VirtualArenaAllocatorPayload* payload = (PNSLR_VirtualArenaAllocatorPayload*) allocator.data;
+
+    // the payload goes away with the range, don't touch it after this
+    if (!PNSLR_ReleaseVirtualMemory(payload->memory, payload->reserved))
+    {
+        if (error) { *error = PNSLR_AllocatorError_Internal; }
+    }
+}
+
+rawptr PNSLR_AllocatorFn_VirtualArena(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    // clear error by default
+    if (error) { *error = PNSLR_AllocatorError_None; }
+
+    if (size < 0 )
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return nil; // Invalid size or alignment
+    }
+
+    // check alignment
+    if ((alignment < 1) || (alignment & (alignment - 1))) // if alignment is not a power of two
     {
         if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
         return nil;
     }
 
-    PNSLR_StackAllocatorPayload* payload = (PNSLR_StackAllocatorPayload*)allocatorData;
-    if (!payload || !payload->currentPage) { return nil; }
+    PNSLR_VirtualArenaAllocatorPayload* payload = (PNSLR_VirtualArenaAllocatorPayload*) allocatorData;
+    if (!payload) { return nil; }
+
+    // the header at the start of the range is never handed back
+    i64 headerSize = (i64) sizeof(PNSLR_VirtualArenaAllocatorPayload);
 
     switch (mode)
     {
         case PNSLR_AllocatorMode_Allocate:
         case PNSLR_AllocatorMode_AllocateNoZero:
         {
-            const i32 headerSize       = sizeof(PNSLR_StackAllocationHeader);
-            const i32 headerAlignment  = alignof(PNSLR_StackAllocationHeader);
+            // memory past the cursor is always zeroed, no need to clear
+            return PNSLR_Internal_AllocateFromVirtualArenaAllocator(payload, size, alignment, error);
+        }
+        case PNSLR_AllocatorMode_Free:
+        {
+            if (error) { *error = PNSLR_AllocatorError_InvalidMode; }
+            return nil;
+        }
+        case PNSLR_AllocatorMode_FreeAll:
+        {
+            PNSLR_Internal_RewindVirtualArenaAllocator(payload, headerSize);
+            return nil;
+        }
+        case PNSLR_AllocatorMode_Resize:
+        case PNSLR_AllocatorMode_ResizeNoZero:
+        {
+            u8* oldData = (u8*) oldMemory;
 
-            // this is a very rough calculation and doesn't actually account for offsets or the alignment of the allocation itself
-            // but it should be enough for most cases, and the cases where it will throw an out-of-memory error are rare
-            // and are actually off by a few bytes
-            if ((headerAlignment + headerSize + alignment + size) > (i32) sizeof(payload->currentPage->buffer))
+            if (!oldData)
+            {
+                return PNSLR_Internal_AllocateFromVirtualArenaAllocator(payload, size, alignment, error);
+            }
+
+            if ((((u64) oldData) & ((u64) (alignment - 1))) == 0)
+            {
+                i64 start = (i64) (oldData - payload->memory);
+                if (start >= headerSize && start + oldSize == payload->used)
+                {
+                    // last allocation, so grow/shrink in place
+                    if (size > oldSize)
+                    {
+                        if (size > payload->reserved - start)
+                        {
+                            if (error) { *error = PNSLR_AllocatorError_OutOfMemory; }
+                            return nil;
+                        }
+
+                        if (!PNSLR_Internal_EnsureVirtualArenaAllocatorCommitted(payload, start + size, error)) { return nil; }
+                        payload->used = start + size;
+                    }
+                    else
+                    {
+                        PNSLR_Internal_RewindVirtualArenaAllocator(payload, start + size);
+                    }
+
+                    return oldMemory;
+                }
+
+                // shrink in place
+                if (size <= oldSize) { return oldMemory; }
+            }
+
+            rawptr newMemory = PNSLR_Internal_AllocateFromVirtualArenaAllocator(payload, size, alignment, error);
+            if (!newMemory) { return nil; }
+            PNSLR_MemCopy(newMemory, oldMemory, oldSize < size ? oldSize : size);
+            return newMemory;
+        }
+        case PNSLR_AllocatorMode_QueryCapabilities:
+        {
+            return (rawptr)(
+                PNSLR_AllocatorCapability_Resize |
+                PNSLR_AllocatorCapability_FreeAll |
+                PNSLR_AllocatorCapability_HintBump |
+                PNSLR_AllocatorCapability_HintTemp
+            );
+        }
+        default:
+            if (error) { *error = PNSLR_AllocatorError_InvalidMode; }
+            return nil; // Unsupported mode.
+    }
+}
+
+b8 PNSLR_ValidateVirtualArenaAllocatorSnapshotState(PNSLR_Allocator allocator)
+{
+    if (allocator.procedure != PNSLR_AllocatorFn_VirtualArena || !allocator.data) { return true; }
+
+    return (((PNSLR_VirtualArenaAllocatorPayload*) allocator.data)->numSnapshots == 0);
+}
+
+PNSLR_VirtualArenaAllocatorSnapshot PNSLR_CaptureVirtualArenaAllocatorSnapshot(PNSLR_Allocator allocator)
+{
+    if (allocator.procedure != PNSLR_AllocatorFn_VirtualArena || !allocator.data) { return (PNSLR_VirtualArenaAllocatorSnapshot) {0}; }
+
+    PNSLR_VirtualArenaAllocatorSnapshot snapshot = {0};
+    snapshot.valid   = true;
+    snapshot.payload = ((PNSLR_VirtualArenaAllocatorPayload*) allocator.data);
+    snapshot.used    = snapshot.payload->used;
+
+    snapshot.payload->numSnapshots++;
+
+    return snapshot;
+}
+
+PNSLR_ArenaSnapshotError PNSLR_RestoreVirtualArenaAllocatorSnapshot(PNSLR_VirtualArenaAllocatorSnapshot* snapshot, PNSLR_SourceCodeLocation loc)
+{
+    if (!snapshot) { return PNSLR_ArenaSnapshotError_InvalidData; }
+
+    PNSLR_ArenaSnapshotError output = PNSLR_ArenaSnapshotError_None;
+    if (!snapshot->valid) { return output; }
+
+    if (snapshot->payload->used < snapshot->used)
+    {
+        output = PNSLR_ArenaSnapshotError_OutOfOrderRestoreUsage;
+        goto exitFunction;
+    }
+
+    PNSLR_Internal_RewindVirtualArenaAllocator(snapshot->payload, snapshot->used);
+
+    if (!snapshot->payload->numSnapshots) { output = PNSLR_ArenaSnapshotError_DoubleRestoreOrDiscardUsage; }
+    snapshot->payload->numSnapshots--;
+
+    exitFunction:
+    ;
+    *snapshot = (PNSLR_VirtualArenaAllocatorSnapshot) {0};
+    return output;
+}
+
+PNSLR_ArenaSnapshotError PNSLR_DiscardVirtualArenaAllocatorSnapshot(PNSLR_VirtualArenaAllocatorSnapshot* snapshot)
+{
+    if (!snapshot) { return PNSLR_ArenaSnapshotError_InvalidData; }
+
+    PNSLR_ArenaSnapshotError output = PNSLR_ArenaSnapshotError_None;
+    if (!snapshot->valid) { return output; }
+
+    if (!snapshot->payload->numSnapshots) { output = PNSLR_ArenaSnapshotError_DoubleRestoreOrDiscardUsage; }
+    snapshot->payload->numSnapshots--;
+
+    *snapshot = (PNSLR_VirtualArenaAllocatorSnapshot) {0};
+    return output;
+}
+
+#define PNSLR_INTERNAL_CONCURRENT_ARENA_CACHE_LINE_SIZE 64
+#define PNSLR_INTERNAL_CONCURRENT_ARENA_LEASE_CACHE_SIZE 8
+
+typedef struct PNSLR_Internal_ConcurrentArenaLease
+{
+    i64 id;
+    i64 generation;
+    u8* cursor;
+    u8* end;
+} PNSLR_Internal_ConcurrentArenaLease;
+
+static i64                                             G_PNSLR_Internal_ConcurrentArenaNextId     = 0;
+static thread_local u32                                G_PNSLR_Internal_ConcurrentArenaLeasesNext = 0;
+static thread_local PNSLR_Internal_ConcurrentArenaLease G_PNSLR_Internal_ConcurrentArenaLeases[PNSLR_INTERNAL_CONCURRENT_ARENA_LEASE_CACHE_SIZE] = {0};
+
+static PNSLR_Internal_ConcurrentArenaLease* PNSLR_Internal_GetConcurrentArenaLease(PNSLR_ConcurrentArenaAllocatorPayload* payload)
+{
+    i64 generation = PNSLR_AtomicLoadI64(&payload->generation);
+
+    PNSLR_Internal_ConcurrentArenaLease* lease = nil;
+    for (i32 i = 0; i < PNSLR_INTERNAL_CONCURRENT_ARENA_LEASE_CACHE_SIZE && !lease; ++i)
+    {
+        if (G_PNSLR_Internal_ConcurrentArenaLeases[i].id == payload->id) { lease = &G_PNSLR_Internal_ConcurrentArenaLeases[i]; }
+    }
+
+    if (!lease)
+    {
+        // evicting a lease only wastes whatever was left in it
+        lease = &G_PNSLR_Internal_ConcurrentArenaLeases[(G_PNSLR_Internal_ConcurrentArenaLeasesNext++) % PNSLR_INTERNAL_CONCURRENT_ARENA_LEASE_CACHE_SIZE];
+        *lease = (PNSLR_Internal_ConcurrentArenaLease) {.id = payload->id, .generation = generation};
+    }
+
+    if (lease->generation != generation)
+    {
+        // the arena was reset since, the leased memory isn't ours anymore
+        *lease = (PNSLR_Internal_ConcurrentArenaLease) {.id = payload->id, .generation = generation};
+    }
+
+    return lease;
+}
+
+static PNSLR_ConcurrentArenaAllocatorBlock* PNSLR_Internal_NewConcurrentArenaAllocatorBlock(PNSLR_Allocator backingAllocator, i64 capacity, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    i64 baseOffset = (i64) PNSLR_Internal_AlignU64Forward(sizeof(PNSLR_ConcurrentArenaAllocatorBlock), PNSLR_INTERNAL_CONCURRENT_ARENA_CACHE_LINE_SIZE);
+
+    u8* output = PNSLR_Allocate(backingAllocator, true, baseOffset + capacity, PNSLR_INTERNAL_CONCURRENT_ARENA_CACHE_LINE_SIZE, location, error);
+    if (!output) { return nil; }
+
+    PNSLR_ConcurrentArenaAllocatorBlock* block = (PNSLR_ConcurrentArenaAllocatorBlock*) output;
+    block->previous = nil;
+    block->memory   = output + baseOffset;
+    block->capacity = capacity;
+    block->used     = 0;
+    return block;
+}
+
+// claims a range straight from the shared block, the only place threads actually contend
+static u8* PNSLR_Internal_ClaimFromConcurrentArenaAllocator(PNSLR_ConcurrentArenaAllocatorPayload* payload, i64 size, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    i64 needed = size + ((alignment > PNSLR_INTERNAL_CONCURRENT_ARENA_CACHE_LINE_SIZE) ? alignment - PNSLR_INTERNAL_CONCURRENT_ARENA_CACHE_LINE_SIZE : 0);
+    needed = (i64) PNSLR_Internal_AlignU64Forward((u64) needed, PNSLR_INTERNAL_CONCURRENT_ARENA_CACHE_LINE_SIZE); // keeps every claim on its own cache lines
+
+    while (true)
+    {
+        PNSLR_ConcurrentArenaAllocatorBlock* block = PNSLR_AtomicLoadPtr((rawptr*) &payload->currentBlock);
+        if (block)
+        {
+            i64 start = PNSLR_AtomicFetchAddI64(&block->used, needed);
+            if (start + needed <= block->capacity)
+            {
+                return (u8*) PNSLR_Internal_AlignRawptrForward(block->memory + start, (u64) alignment);
+            }
+        }
+
+        // the block is full (or there's none yet), only one thread gets to add the next one
+        PNSLR_LockMutex(&payload->growthMutex);
+
+        if (PNSLR_AtomicLoadPtr((rawptr*) &payload->currentBlock) == block)
+        {
+            i64 blockSize = (payload->minimumBlockSize < needed) ? needed : payload->minimumBlockSize;
+            PNSLR_ConcurrentArenaAllocatorBlock* newBlock = PNSLR_Internal_NewConcurrentArenaAllocatorBlock(payload->backingAllocator, blockSize, location, error);
+            if (!newBlock)
             {
+                PNSLR_UnlockMutex(&payload->growthMutex);
                 if (error) { *error = PNSLR_AllocatorError_OutOfMemory; }
-                return nil; // Not enough space in the current page
+                return nil;
             }
 
-            u64 usedBytesEndPtr              = (u64)(rawptr)(((u8*)(payload->currentPage->buffer)) + payload->currentPage->usedBytes);
-            u64 usedBytesEndPtrHeaderAligned = (usedBytesEndPtr + headerAlignment - 1) & ~(u64)(headerAlignment - 1);
-            u64 headerEndPtr                 = usedBytesEndPtrHeaderAligned + headerSize;
-            u64 headerEndPtrAllocAligned     = (headerEndPtr + (u64) alignment - 1) & ~(u64)(alignment - 1);
-            u64 allocEndPtr                  = headerEndPtrAllocAligned + (u64) size;
-            u64 effectiveUsedBytes           = allocEndPtr - (u64)(rawptr)(payload->currentPage->buffer);
+            newBlock->previous      = block;
+            payload->totalCapacity += blockSize;
+            PNSLR_AtomicStorePtr((rawptr*) &payload->currentBlock, newBlock);
+        }
 
-            if (effectiveUsedBytes > sizeof(payload->currentPage->buffer))
+        PNSLR_UnlockMutex(&payload->growthMutex);
+    }
+}
+
+static u8* PNSLR_Internal_AllocateFromConcurrentArenaAllocator(PNSLR_ConcurrentArenaAllocatorPayload* payload, i64 size, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (size < 0 || size > I64_MAX - alignment - PNSLR_INTERNAL_CONCURRENT_ARENA_CACHE_LINE_SIZE)
+    {
+        if (error) { *error = PNSLR_AllocatorError_OutOfMemory; }
+        return nil; // the claim pads by the alignment, so keep that from overflowing
+    }
+
+    if (size > payload->leaseSize / 2 - alignment)
+    {
+        return PNSLR_Internal_ClaimFromConcurrentArenaAllocator(payload, size, alignment, location, error);
+    }
+
+    PNSLR_Internal_ConcurrentArenaLease* lease = PNSLR_Internal_GetConcurrentArenaLease(payload);
+
+    u8* output = (u8*) PNSLR_Internal_AlignRawptrForward(lease->cursor, (u64) alignment);
+    if (!lease->cursor || output + size > lease->end)
+    {
+        u8* leased = PNSLR_Internal_ClaimFromConcurrentArenaAllocator(payload, payload->leaseSize, PNSLR_INTERNAL_CONCURRENT_ARENA_CACHE_LINE_SIZE, location, error);
+        if (!leased) { return nil; }
+
+        lease->cursor = leased;
+        lease->end    = leased + payload->leaseSize;
+        output        = (u8*) PNSLR_Internal_AlignRawptrForward(lease->cursor, (u64) alignment);
+    }
+
+    lease->cursor = output + size;
+    return output;
+}
+
+PNSLR_Allocator PNSLR_NewAllocator_ConcurrentArena(PNSLR_Allocator backingAllocator, i64 blockSize, i32 leaseSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (blockSize < 0 || leaseSize < 0)
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return PNSLR_GetAllocator_Nil();
+    }
+
+    PNSLR_ConcurrentArenaAllocatorPayload* payload = PNSLR_Allocate(
+        backingAllocator,
+        true,
+        sizeof(PNSLR_ConcurrentArenaAllocatorPayload),
+        alignof(PNSLR_ConcurrentArenaAllocatorPayload),
+        location,
+        error
+    );
+
+    if (!payload) { return PNSLR_GetAllocator_Nil(); }
+
+    if (blockSize == 0) { blockSize = 8 * 1024 * 1024; } // 8 MiB
+    if (leaseSize == 0) { leaseSize = 16 * 1024; }      // 16 KiB
+
+    payload->backingAllocator = backingAllocator;
+    payload->growthMutex      = PNSLR_CreateMutex();
+    payload->leaseSize        = (i64) PNSLR_Internal_AlignU64Forward((u64) leaseSize, PNSLR_INTERNAL_CONCURRENT_ARENA_CACHE_LINE_SIZE);
+    payload->minimumBlockSize = (blockSize > payload->leaseSize) ? blockSize : payload->leaseSize;
+    payload->id               = PNSLR_AtomicFetchAddI64(&G_PNSLR_Internal_ConcurrentArenaNextId, 1) + 1; // never reused, so stale leases can't match
+
+    return (PNSLR_Allocator) {
+        .procedure = PNSLR_AllocatorFn_ConcurrentArena,
+        .data = payload
+    };
+}
+
+void PNSLR_DestroyAllocator_ConcurrentArena(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (!allocator.procedure || !allocator.data) { return; }
+    if (error) { *error = PNSLR_AllocatorError_None; } // No error by default
+
+    PNSLR_ConcurrentArenaAllocatorPayload* payload = (PNSLR_ConcurrentArenaAllocatorPayload*) allocator.data;
+
+    PNSLR_ConcurrentArenaAllocatorBlock* block = payload->currentBlock;
+    while (block)
+    {
+        PNSLR_ConcurrentArenaAllocatorBlock* previous = block->previous;
+        PNSLR_Free(payload->backingAllocator, block, location, nil);
+        block = previous;
+    }
+
+    PNSLR_DestroyMutex(&payload->growthMutex);
+    PNSLR_Free(payload->backingAllocator, payload, location, error);
+}
+
+rawptr PNSLR_AllocatorFn_ConcurrentArena(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    // clear error by default
+    if (error) { *error = PNSLR_AllocatorError_None; }
+
+    if (size < 0 )
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return nil; // Invalid size or alignment
+    }
+
+    // check alignment
+    if ((alignment < 1) || (alignment & (alignment - 1))) // if alignment is not a power of two
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+        return nil;
+    }
+
+    PNSLR_ConcurrentArenaAllocatorPayload* payload = (PNSLR_ConcurrentArenaAllocatorPayload*) allocatorData;
+    if (!payload) { return nil; }
+
+    switch (mode)
+    {
+        case PNSLR_AllocatorMode_Allocate:
+        case PNSLR_AllocatorMode_AllocateNoZero:
+        {
+            // blocks come zeroed and are zeroed again on FreeAll
+            return PNSLR_Internal_AllocateFromConcurrentArenaAllocator(payload, size, alignment, location, error);
+        }
+        case PNSLR_AllocatorMode_Free:
+        {
+            if (error) { *error = PNSLR_AllocatorError_InvalidMode; }
+            return nil;
+        }
+        case PNSLR_AllocatorMode_FreeAll:
+        {
+            // not thread-safe against allocations still going on, by design
+            PNSLR_LockMutex(&payload->growthMutex);
+
+            PNSLR_ConcurrentArenaAllocatorBlock* block = payload->currentBlock;
+            while (block && block->previous)
+            {
+                PNSLR_ConcurrentArenaAllocatorBlock* previous = block->previous;
+                block->previous = previous->previous;
+
+                payload->totalCapacity -= previous->capacity;
+                PNSLR_Free(payload->backingAllocator, previous, location, nil);
+            }
+
+            if (block)
+            {
+                PNSLR_MemSet(block->memory, 0, (block->used < block->capacity) ? block->used : block->capacity);
+                PNSLR_AtomicStoreI64(&block->used, 0);
+            }
+
+            PNSLR_AtomicFetchAddI64(&payload->generation, 1);
+            PNSLR_UnlockMutex(&payload->growthMutex);
+            return nil;
+        }
+        case PNSLR_AllocatorMode_Resize:
+        case PNSLR_AllocatorMode_ResizeNoZero:
+        {
+            u8* oldData = (u8*) oldMemory;
+            if (!oldData)
+            {
+                return PNSLR_Internal_AllocateFromConcurrentArenaAllocator(payload, size, alignment, location, error);
+            }
+
+            if ((((u64) oldData) & ((u64) (alignment - 1))) == 0)
+            {
+                // shrink in place
+                if (size <= oldSize) { return oldMemory; }
+
+                // grow in place if it was the last thing allocated from this thread's lease
+                PNSLR_Internal_ConcurrentArenaLease* lease = PNSLR_Internal_GetConcurrentArenaLease(payload);
+                if (lease->cursor && oldData + oldSize == lease->cursor && oldData + size <= lease->end)
+                {
+                    lease->cursor = oldData + size;
+                    return oldMemory;
+                }
+            }
+
+            u8* newMemory = PNSLR_Internal_AllocateFromConcurrentArenaAllocator(payload, size, alignment, location, error);
+            if (!newMemory) { return nil; }
+            PNSLR_MemCopy(newMemory, oldMemory, oldSize < size ? oldSize : size);
+            return newMemory;
+        }
+        case PNSLR_AllocatorMode_QueryCapabilities:
+        {
+            return (rawptr)(
+                PNSLR_AllocatorCapability_ThreadSafe |
+                PNSLR_AllocatorCapability_Resize |
+                PNSLR_AllocatorCapability_FreeAll |
+                PNSLR_AllocatorCapability_HintBump |
+                PNSLR_AllocatorCapability_HintTemp
+            );
+        }
+        default:
+            if (error) { *error = PNSLR_AllocatorError_InvalidMode; }
+            return nil; // Unsupported mode.
+    }
+}
+
+#define PNSLR_INTERNAL_FRAME_BLOCK_ALIGNMENT 16
+
+static void PNSLR_Internal_ResetFrameAllocatorFrame(PNSLR_FrameAllocatorFrame* frame)
+{
+    // keep memory past the cursor zeroed, so zeroed allocations are free
+    for (PNSLR_FrameAllocatorBlock* block = frame->firstBlock; block; block = block->next)
+    {
+        PNSLR_MemSet(block->memory, 0, block->used);
+        block->used = 0;
+    }
+
+    frame->currentBlock = frame->firstBlock;
+    frame->used         = 0;
+}
+
+static rawptr PNSLR_Internal_AllocateFromFrameAllocator(PNSLR_FrameAllocatorPayload* payload, i64 size, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    PNSLR_FrameAllocatorFrame* frame = &payload->frames[payload->currentFrame];
+
+    // move along the chain, reusing the blocks from the last time this frame was used
+    for (PNSLR_FrameAllocatorBlock* block = frame->currentBlock; block; block = block->next)
+    {
+        u8* start = (u8*) PNSLR_Internal_AlignRawptrForward(block->memory + block->used, (u64) alignment);
+        if (start + size <= block->memory + block->capacity)
+        {
+            frame->used        += (start + size) - (block->memory + block->used);
+            block->used         = (start + size) - block->memory;
+            frame->currentBlock = block;
+            return start;
+        }
+    }
+
+    i64 capacity   = (payload->minimumBlockSize < size + alignment) ? size + alignment : payload->minimumBlockSize;
+    i64 baseOffset = (i64) PNSLR_Internal_AlignU64Forward(sizeof(PNSLR_FrameAllocatorBlock), PNSLR_INTERNAL_FRAME_BLOCK_ALIGNMENT);
+
+    u8* output = PNSLR_Allocate(payload->backingAllocator, true, baseOffset + capacity, PNSLR_INTERNAL_FRAME_BLOCK_ALIGNMENT, location, error);
+    if (!output) { return nil; }
+
+    PNSLR_FrameAllocatorBlock* newBlock = (PNSLR_FrameAllocatorBlock*) output;
+    newBlock->memory   = output + baseOffset;
+    newBlock->capacity = capacity;
+
+    // append at the end of the chain, so it's there to be reused next time around
+    PNSLR_FrameAllocatorBlock** link = &frame->firstBlock;
+    while (*link) { link = &(*link)->next; }
+    *link = newBlock;
+
+    frame->capacity    += capacity;
+    frame->currentBlock = newBlock;
+
+    u8* start = (u8*) PNSLR_Internal_AlignRawptrForward(newBlock->memory, (u64) alignment);
+    newBlock->used = (start + size) - newBlock->memory;
+    frame->used   += newBlock->used;
+    return start;
+}
+
+PNSLR_Allocator PNSLR_NewAllocator_Frame(PNSLR_Allocator backingAllocator, i32 numFrames, i64 blockSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (numFrames < 1 || numFrames > (i32) (sizeof(((PNSLR_FrameAllocatorPayload*) 0)->frames) / sizeof(PNSLR_FrameAllocatorFrame)) || blockSize < 0)
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return PNSLR_GetAllocator_Nil();
+    }
+
+    PNSLR_FrameAllocatorPayload* payload = PNSLR_Allocate(
+        backingAllocator,
+        true,
+        sizeof(PNSLR_FrameAllocatorPayload),
+        alignof(PNSLR_FrameAllocatorPayload),
+        location,
+        error
+    );
+
+    if (!payload) { return PNSLR_GetAllocator_Nil(); }
+
+    payload->backingAllocator = backingAllocator;
+    payload->numFrames        = numFrames;
+    payload->minimumBlockSize = blockSize ? blockSize : 1024 * 1024; // 1 MiB
+
+    return (PNSLR_Allocator) {
+        .procedure = PNSLR_AllocatorFn_Frame,
+        .data = payload
+    };
+}
+
+void PNSLR_DestroyAllocator_Frame(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (!allocator.procedure || !allocator.data) { return; }
+    if (error) { *error = PNSLR_AllocatorError_None; } // No error by default
+
+    PNSLR_FrameAllocatorPayload* payload = (PNSLR_FrameAllocatorPayload*) allocator.data;
+
+    for (i32 i = 0; i < payload->numFrames; ++i)
+    {
+        PNSLR_FrameAllocatorBlock* block = payload->frames[i].firstBlock;
+        while (block)
+        {
+            PNSLR_FrameAllocatorBlock* next = block->next;
+            PNSLR_Free(payload->backingAllocator, block, location, nil);
+            block = next;
+        }
+    }
+
+    PNSLR_Free(payload->backingAllocator, payload, location, error);
+}
+
+rawptr PNSLR_AllocatorFn_Frame(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    // clear error by default
+    if (error) { *error = PNSLR_AllocatorError_None; }
+
+    if (size < 0 )
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return nil; // Invalid size or alignment
+    }
+
+    // check alignment
+    if ((alignment < 1) || (alignment & (alignment - 1))) // if alignment is not a power of two
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+        return nil;
+    }
+
+    PNSLR_FrameAllocatorPayload* payload = (PNSLR_FrameAllocatorPayload*) allocatorData;
+    if (!payload) { return nil; }
+
+    switch (mode)
+    {
+        case PNSLR_AllocatorMode_Allocate:
+        case PNSLR_AllocatorMode_AllocateNoZero:
+        {
+            return PNSLR_Internal_AllocateFromFrameAllocator(payload, size, alignment, location, error);
+        }
+        case PNSLR_AllocatorMode_Free:
+        {
+            if (error) { *error = PNSLR_AllocatorError_InvalidMode; }
+            return nil;
+        }
+        case PNSLR_AllocatorMode_FreeAll:
+        {
+            for (i32 i = 0; i < payload->numFrames; ++i) { PNSLR_Internal_ResetFrameAllocatorFrame(&payload->frames[i]); }
+            return nil;
+        }
+        case PNSLR_AllocatorMode_Resize:
+        case PNSLR_AllocatorMode_ResizeNoZero:
+        {
+            u8* oldData = (u8*) oldMemory;
+            if (!oldData)
+            {
+                return PNSLR_Internal_AllocateFromFrameAllocator(payload, size, alignment, location, error);
+            }
+
+            if ((((u64) oldData) & ((u64) (alignment - 1))) == 0)
+            {
+                // shrink in place
+                if (size <= oldSize) { return oldMemory; }
+
+                // grow in place if it was the last allocation of this frame
+                PNSLR_FrameAllocatorFrame* frame = &payload->frames[payload->currentFrame];
+                PNSLR_FrameAllocatorBlock* block = frame->currentBlock;
+                if (block && oldData + oldSize == block->memory + block->used && oldData + size <= block->memory + block->capacity)
+                {
+                    frame->used += size - oldSize;
+                    block->used += size - oldSize;
+                    return oldMemory;
+                }
+            }
+
+            rawptr newMemory = PNSLR_Internal_AllocateFromFrameAllocator(payload, size, alignment, location, error);
+            if (!newMemory) { return nil; }
+            PNSLR_MemCopy(newMemory, oldMemory, oldSize < size ? oldSize : size);
+            return newMemory;
+        }
+        case PNSLR_AllocatorMode_QueryCapabilities:
+        {
+            return (rawptr)(
+                PNSLR_AllocatorCapability_Resize |
+                PNSLR_AllocatorCapability_FreeAll |
+                PNSLR_AllocatorCapability_HintBump |
+                PNSLR_AllocatorCapability_HintTemp
+            );
+        }
+        default:
+            if (error) { *error = PNSLR_AllocatorError_InvalidMode; }
+            return nil; // Unsupported mode.
+    }
+}
+
+i64 PNSLR_AdvanceFrameAllocator(PNSLR_Allocator allocator)
+{
+    if (allocator.procedure != PNSLR_AllocatorFn_Frame || !allocator.data) { return 0; }
+
+    PNSLR_FrameAllocatorPayload* payload = (PNSLR_FrameAllocatorPayload*) allocator.data;
+
+    PNSLR_FrameAllocatorFrame* ended = &payload->frames[payload->currentFrame];
+    ended->highWaterMark = ended->used;
+    if (ended->used > payload->peakHighWaterMark) { payload->peakHighWaterMark = ended->used; }
+
+    payload->frameIndex++;
+    payload->currentFrame = (payload->currentFrame + 1) % payload->numFrames;
+
+    // the next frame in the ring is also the oldest one
+    PNSLR_Internal_ResetFrameAllocatorFrame(&payload->frames[payload->currentFrame]);
+
+    return ended->highWaterMark;
+}
+
+PNSLR_FrameAllocatorStats PNSLR_GetFrameAllocatorStats(PNSLR_Allocator allocator)
+{
+    if (allocator.procedure != PNSLR_AllocatorFn_Frame || !allocator.data) { return (PNSLR_FrameAllocatorStats) {0}; }
+
+    PNSLR_FrameAllocatorPayload* payload = (PNSLR_FrameAllocatorPayload*) allocator.data;
+
+    PNSLR_FrameAllocatorStats output = {0};
+    output.frameIndex        = payload->frameIndex;
+    output.usedBytes         = payload->frames[payload->currentFrame].used;
+    output.lastHighWaterMark = payload->frameIndex ? payload->frames[(payload->currentFrame + payload->numFrames - 1) % payload->numFrames].highWaterMark : 0;
+    output.peakHighWaterMark = payload->peakHighWaterMark;
+    output.numFrames         = payload->numFrames;
+
+    for (i32 i = 0; i < payload->numFrames; ++i) { output.totalCapacity += payload->frames[i].capacity; }
+
+    return output;
+}
+
+PNSLR_Allocator PNSLR_NewAllocator_Stack(PNSLR_Allocator backingAllocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    PNSLR_StackAllocatorPayload* payload = PNSLR_Allocate(
+        backingAllocator,
+        true,
+        sizeof(PNSLR_StackAllocatorPayload),
+        alignof(PNSLR_StackAllocatorPayload),
+        location,
+        error
+    );
+
+    if (!payload) { return PNSLR_GetAllocator_Nil(); }
+
+    payload->lastAllocation       = nil;
+    payload->lastAllocationHeader = nil;
+    payload->backingAllocator     = backingAllocator;
+    payload->currentPage          = PNSLR_Allocate(
+        backingAllocator,
+        true,
+        sizeof(PNSLR_StackAllocatorPage),
+        alignof(PNSLR_StackAllocatorPage),
+        location,
+        error
+    );
+
+    payload->currentPage->previousPage = nil;
+    payload->currentPage->usedBytes    = 0;
+
+    return (PNSLR_Allocator) {
+        .procedure = PNSLR_AllocatorFn_Stack,
+        .data = payload
+    };
+}
+
+void PNSLR_DestroyAllocator_Stack(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (!allocator.procedure || !allocator.data) { return; }
+    if (error) { *error = PNSLR_AllocatorError_None; } // No error by default
+
+    PNSLR_StackAllocatorPayload* payload = (PNSLR_StackAllocatorPayload*) allocator.data;
+
+    // Free all pages in the stack allocator
+    for (PNSLR_StackAllocatorPage* page = payload->currentPage; page;)
+    {
+        // Free the current page
+        PNSLR_StackAllocatorPage* nextPageToFree = page->previousPage;
+        PNSLR_Free(payload->backingAllocator, page, location, error);
+        if (error && *error != PNSLR_AllocatorError_None) { return; } // Stop on error
+        page = nextPageToFree;
+    }
+
+    // Free the payload itself
+    PNSLR_Free(payload->backingAllocator, payload, location, error);
+    if (error && *error != PNSLR_AllocatorError_None) { return; } // Stop on error
+}
+
+rawptr PNSLR_AllocatorFn_Stack(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    // clear error by default
+    if (error) { *error = PNSLR_AllocatorError_None; }
+
+    if (size < 0 )
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return nil; // Invalid size or alignment
+    }
+
+    // check alignment
+    if ((alignment < 1) || (alignment & (alignment - 1))) // if alignment is not a power of two
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+        return nil;
+    }
+
+    PNSLR_StackAllocatorPayload* payload = (PNSLR_StackAllocatorPayload*)allocatorData;
+    if (!payload || !payload->currentPage) { return nil; }
+
+    switch (mode)
+    {
+        case PNSLR_AllocatorMode_Allocate:
+        case PNSLR_AllocatorMode_AllocateNoZero:
+        {
+            const i32 headerSize       = sizeof(PNSLR_StackAllocationHeader);
+            const i32 headerAlignment  = alignof(PNSLR_StackAllocationHeader);
+
+            // this is a very rough calculation and doesn't actually account for offsets or the alignment of the allocation itself
+            // but it should be enough for most cases, and the cases where it will throw an out-of-memory error are rare
+            // and are actually off by a few bytes
+            if ((headerAlignment + headerSize + alignment + size) > (i32) sizeof(payload->currentPage->buffer))
+            {
+                if (error) { *error = PNSLR_AllocatorError_OutOfMemory; }
+                return nil; // Not enough space in the current page
+            }
+
+            u64 usedBytesEndPtr              = (u64)(rawptr)(((u8*)(payload->currentPage->buffer)) + payload->currentPage->usedBytes);
+            u64 usedBytesEndPtrHeaderAligned = (usedBytesEndPtr + headerAlignment - 1) & ~(u64)(headerAlignment - 1);
+            u64 headerEndPtr                 = usedBytesEndPtrHeaderAligned + headerSize;
+            u64 headerEndPtrAllocAligned     = (headerEndPtr + (u64) alignment - 1) & ~(u64)(alignment - 1);
+            u64 allocEndPtr                  = headerEndPtrAllocAligned + (u64) size;
+            u64 effectiveUsedBytes           = allocEndPtr - (u64)(rawptr)(payload->currentPage->buffer);
+
+            if (effectiveUsedBytes > sizeof(payload->currentPage->buffer))
+            {
+                // allocate a new page
+                PNSLR_StackAllocatorPage* newPage = PNSLR_Allocate(
+                    payload->backingAllocator,
+                    true,
+                    sizeof(PNSLR_StackAllocatorPage),
+                    alignof(PNSLR_StackAllocatorPage),
+                    location,
+                    error
+                );
+
+                if (!newPage)
+                {
+                    if (error) { *error = PNSLR_AllocatorError_OutOfMemory; }
+                    return nil; // Not enough space in the backing allocator
+                }
+
+                newPage->previousPage = payload->currentPage;
+                newPage->usedBytes    = 0;
+                payload->currentPage  = newPage;
+
+                usedBytesEndPtr              = (u64)(rawptr)(newPage->buffer);
+                usedBytesEndPtrHeaderAligned = (usedBytesEndPtr + headerAlignment - 1) & ~(u64)(headerAlignment - 1);
+                headerEndPtr                 = usedBytesEndPtrHeaderAligned + headerSize;
+                headerEndPtrAllocAligned     = (headerEndPtr + (u64) alignment - 1) & ~(u64)(alignment - 1);
+                allocEndPtr                  = headerEndPtrAllocAligned + (u64) size;
+                effectiveUsedBytes           = allocEndPtr - (u64)(rawptr)(payload->currentPage->buffer);
+            }
+
+            PNSLR_StackAllocatorPage* pageToUse        = payload->currentPage;
+            pageToUse->usedBytes                       = effectiveUsedBytes;
+            PNSLR_StackAllocationHeader* header        = (PNSLR_StackAllocationHeader*) usedBytesEndPtrHeaderAligned;
+            rawptr                       tgtAllocation = (rawptr) headerEndPtrAllocAligned;
+
+            header->page                  = pageToUse;
+            header->size                  = size;
+            header->alignment             = alignment;
+            header->lastAllocation        = payload->lastAllocation;
+            header->lastAllocationHeader  = payload->lastAllocationHeader;
+            payload->lastAllocation       = tgtAllocation;
+            payload->lastAllocationHeader = (rawptr)header;
+
+            if (mode == PNSLR_AllocatorMode_Allocate)
+            {
+                PNSLR_MemSet(tgtAllocation, 0, size); // Zero the memory if requested
+            }
+
+            return tgtAllocation;
+        }
+        case PNSLR_AllocatorMode_Resize:
+        case PNSLR_AllocatorMode_ResizeNoZero:
+        {
+            if (error) { *error = PNSLR_AllocatorError_InvalidMode; }
+            return nil; // Resizing breaks stack semantics
+        }
+        case PNSLR_AllocatorMode_Free:
+        {
+            if (oldMemory == nil)
+            {
+                if (error) { *error = PNSLR_AllocatorError_None; } // No memory to free
+                return nil;
+            }
+
+            if (oldMemory != payload->lastAllocation)
+            {
+                if (error) { *error = PNSLR_AllocatorError_OutOfOrderFree; }
+                return nil; // Invalid free, not the last allocated memory
+            }
+
+            PNSLR_StackAllocationHeader* header = payload->lastAllocationHeader;
+            if (!header)
+            {
+                if (error) { *error = PNSLR_AllocatorError_DoubleFree; }
+                return nil; // Double free detected
+            }
+
+            if (!header->page)
+            {
+                if (error) { *error = PNSLR_AllocatorError_Internal; }
+                return nil; // Internal error, page should not be nil
+            }
+
+            // find whether the header's page is even in the current page chain
+            {
+                b8 found = false;
+                for (PNSLR_StackAllocatorPage* page = payload->currentPage; page; page = page->previousPage)
+                {
+                    if (page == header->page)
+                    {
+                        found = true;
+                        break;
+                    }
+                }
+
+                if (!found)
+                {
+                    if (error) { *error = PNSLR_AllocatorError_Internal; }
+                    return nil;
+                    // we've already confirmed that the allocation belongs to the current allocator
+                    // but if the allocation's page is not in the current page chain, it means that the allocator is in an invalid state
+                }
+            }
+
+            // free all the pages till the current allocation's page is reached
+            {
+                PNSLR_StackAllocatorPage* page = nil;
+                for (page = payload->currentPage; page != header->page; page = page->previousPage)
+                {
+                    if (!page)
+                    {
+                        if (error) { *error = PNSLR_AllocatorError_Internal; }
+                        return nil; // Internal error, page should not be nil
+                    }
+
+                    PNSLR_Free(payload->backingAllocator, page, location, error);
+                    if (error && *error != PNSLR_AllocatorError_None) { return nil; } // Stop on error
+                }
+
+                payload->currentPage = page; // set the current page to the page of the allocation being freed
+            }
+
+            payload->lastAllocation       = header->lastAllocation;
+            payload->lastAllocationHeader = header->lastAllocationHeader;
+
+            u64 usedBytesTemp               = ((u64)(header)) - ((u64)(rawptr)((u8*)(payload->currentPage->buffer)));
+            if (usedBytesTemp > I32_MAX)
+            {
+                if (error) { *error = PNSLR_AllocatorError_Internal; }
+                return nil; // Internal error, used bytes cannot be negative
+            }
+            payload->currentPage->usedBytes = usedBytesTemp;
+
+            // clear the header to avoid double frees
+            header->page                  = nil;
+            header->size                  = 0;
+            header->alignment             = 0;
+            header->lastAllocation        = nil;
+            header->lastAllocationHeader  = nil;
+
+            break;
+        }
+        case PNSLR_AllocatorMode_FreeAll:
+        {
+            PNSLR_StackAllocatorPage* page = payload->currentPage;
+            while (page && page->previousPage)
+            {
+                PNSLR_StackAllocatorPage* prev = page->previousPage;
+                PNSLR_Free(payload->backingAllocator, page, location, error);
+                if (error && *error != PNSLR_AllocatorError_None) { return nil; }
+                page = prev;
+            }
+
+            payload->lastAllocation       = nil;
+            payload->lastAllocationHeader = nil;
+            payload->currentPage          = page;
+            if (page)
+            {
+                page->previousPage = nil;
+                page->usedBytes    = 0;
+            }
+
+            if (error) { *error = PNSLR_AllocatorError_None; }
+            return nil;
+        }
+        case PNSLR_AllocatorMode_QueryCapabilities:
+        {
+            return (rawptr)(
+                PNSLR_AllocatorCapability_Free |
+                PNSLR_AllocatorCapability_FreeAll |
+                PNSLR_AllocatorCapability_HintBump
+            );
+        }
+        default:
+            if (error) { *error = PNSLR_AllocatorError_InvalidMode; }
+            return nil; // Unsupported mode.
+    }
+
+    return nil; // Should not reach here.
+}
+
+static PNSLR_PoolAllocatorChunk* PNSLR_Internal_NewPoolAllocatorChunk(PNSLR_PoolAllocatorPayload* payload, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    u64 baseOffset = PNSLR_Internal_AlignU64Forward(sizeof(PNSLR_PoolAllocatorChunk), (u64) payload->slotAlignment);
+    u64 totalSize  = baseOffset + ((u64) payload->slotStride * (u64) payload->slotsPerChunk);
+
+    i32 minAlignment = ((i32) alignof(PNSLR_PoolAllocatorChunk) > payload->slotAlignment ? (i32) alignof(PNSLR_PoolAllocatorChunk) : payload->slotAlignment);
+
+    // no need to zero, slots are zeroed on allocation if requested
+    rawptr output = PNSLR_Allocate(payload->backingAllocator, false, (i64) totalSize, minAlignment, location, error);
+    if (output == nil) { return nil; }
+
+    PNSLR_PoolAllocatorChunk* chunk = (PNSLR_PoolAllocatorChunk*) output;
+    *chunk = (PNSLR_PoolAllocatorChunk)
+    {
+        .previous     = payload->currentChunk,
+        .slots        = (rawptr) ((u8*) chunk + baseOffset),
+        .slotsCount   = payload->slotsPerChunk,
+        .slotsTouched = 0,
+    };
+
+    payload->currentChunk   = chunk;
+    payload->numSlotsTotal += chunk->slotsCount;
+    return chunk;
+}
+
+static rawptr PNSLR_Internal_AllocateFromPoolAllocator(PNSLR_PoolAllocatorPayload* payload, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    rawptr output = payload->freeList;
+    if (output)
+    {
+        // pop from the free list, the link is stored in the slot itself
+        payload->freeList = *(rawptr*) output;
+    }
+    else
+    {
+        PNSLR_PoolAllocatorChunk* chunk = payload->currentChunk;
+        if (!chunk || chunk->slotsTouched >= chunk->slotsCount)
+        {
+            chunk = PNSLR_Internal_NewPoolAllocatorChunk(payload, location, error);
+            if (!chunk) { return nil; }
+        }
+
+        // carve the next untouched slot, so a new chunk never needs to be threaded up-front
+        output = (rawptr) ((u8*) chunk->slots + ((i64) chunk->slotsTouched * (i64) payload->slotStride));
+        chunk->slotsTouched++;
+    }
+
+    payload->numSlotsUsed++;
+    return output;
+}
+
+PNSLR_Allocator PNSLR_NewAllocator_Pool(PNSLR_Allocator backingAllocator, i32 slotSize, i32 slotAlignment, i32 slotsPerChunk, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (error) { *error = PNSLR_AllocatorError_None; }
+
+    if (slotSize < 1 || slotsPerChunk < 1)
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return PNSLR_GetAllocator_Nil();
+    }
+
+    // check alignment
+    if ((slotAlignment < 1) || (slotAlignment & (slotAlignment - 1))) // if alignment is not a power of two
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+        return PNSLR_GetAllocator_Nil();
+    }
+
+    // every slot must be able to hold the free list link
+    if (slotAlignment < (i32) alignof(rawptr)) { slotAlignment = (i32) alignof(rawptr); }
+    u64 slotStride = PNSLR_Internal_AlignU64Forward((u64) (slotSize > (i32) sizeof(rawptr) ? slotSize : (i32) sizeof(rawptr)), (u64) slotAlignment);
+    if (slotStride > (u64) I32_MAX)
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return PNSLR_GetAllocator_Nil();
+    }
+
+    PNSLR_PoolAllocatorPayload* payload = PNSLR_Allocate(
+        backingAllocator,
+        true,
+        sizeof(PNSLR_PoolAllocatorPayload),
+        alignof(PNSLR_PoolAllocatorPayload),
+        location,
+        error
+    );
+
+    if (!payload) { return PNSLR_GetAllocator_Nil(); }
+
+    *payload = (PNSLR_PoolAllocatorPayload)
+    {
+        .backingAllocator = backingAllocator,
+        .currentChunk     = nil,
+        .freeList         = nil,
+        .slotSize         = slotSize,
+        .slotAlignment    = slotAlignment,
+        .slotStride       = (i32) slotStride,
+        .slotsPerChunk    = slotsPerChunk,
+        .numSlotsUsed     = 0,
+        .numSlotsTotal    = 0,
+    };
+
+    if (!PNSLR_Internal_NewPoolAllocatorChunk(payload, location, error))
+    {
+        PNSLR_Free(backingAllocator, payload, location, nil);
+        return PNSLR_GetAllocator_Nil();
+    }
+
+    return (PNSLR_Allocator) {
+        .procedure = PNSLR_AllocatorFn_Pool,
+        .data = payload
+    };
+}
+
+void PNSLR_DestroyAllocator_Pool(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (!allocator.procedure || !allocator.data) { return; }
+    if (error) { *error = PNSLR_AllocatorError_None; } // No error by default
+
+    PNSLR_PoolAllocatorPayload* payload = (PNSLR_PoolAllocatorPayload*) allocator.data;
+
+    while (payload->currentChunk)
+    {
+        PNSLR_PoolAllocatorChunk* freeChunk = payload->currentChunk;
+        payload->currentChunk = freeChunk->previous;
+        PNSLR_Free(payload->backingAllocator, freeChunk, location, nil);
+    }
+
+    payload->freeList      = nil;
+    payload->numSlotsUsed  = 0;
+    payload->numSlotsTotal = 0;
+
+    PNSLR_Free(payload->backingAllocator, payload, location, error);
+}
+
+rawptr PNSLR_AllocatorFn_Pool(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    // clear error by default
+    if (error) { *error = PNSLR_AllocatorError_None; }
+
+    if (size < 0 )
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return nil; // Invalid size or alignment
+    }
+
+    // check alignment
+    if ((alignment < 1) || (alignment & (alignment - 1))) // if alignment is not a power of two
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+        return nil;
+    }
+
+    PNSLR_PoolAllocatorPayload* payload = (PNSLR_PoolAllocatorPayload*) allocatorData;
+    if (!payload) { return nil; }
+
+    switch (mode)
+    {
+        case PNSLR_AllocatorMode_Allocate:
+        case PNSLR_AllocatorMode_AllocateNoZero:
+        {
+            if (size > payload->slotSize)
+            {
+                if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+                return nil; // doesn't fit in a slot
+            }
+
+            if (alignment > payload->slotAlignment)
+            {
+                if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+                return nil; // slots can't guarantee this alignment
+            }
+
+            rawptr memory = PNSLR_Internal_AllocateFromPoolAllocator(payload, location, error);
+            if (memory && mode == PNSLR_AllocatorMode_Allocate) { PNSLR_MemSet(memory, 0, size); }
+            return memory;
+        }
+        case PNSLR_AllocatorMode_Resize:
+        case PNSLR_AllocatorMode_ResizeNoZero:
+        {
+            if (!oldMemory)
+            {
+                return PNSLR_AllocatorFn_Pool(
+                    allocatorData,
+                    mode == PNSLR_AllocatorMode_Resize ? PNSLR_AllocatorMode_Allocate : PNSLR_AllocatorMode_AllocateNoZero,
+                    size,
+                    alignment,
+                    nil,
+                    0,
+                    location,
+                    error
+                );
+            }
+
+            if (size > payload->slotSize)
+            {
+                if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+                return nil; // can never grow past a slot
+            }
+
+            if ((((u64) oldMemory) & ((u64) (alignment - 1))) != 0)
+            {
+                if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+                return nil;
+            }
+
+            // every allocation owns a full slot, so resizing is always in-place
+            if (size > oldSize && mode == PNSLR_AllocatorMode_Resize) { PNSLR_MemSet((u8*) oldMemory + oldSize, 0, size - oldSize); }
+            return oldMemory;
+        }
+        case PNSLR_AllocatorMode_Free:
+        {
+            if (oldMemory == nil)
+            {
+                if (error) { *error = PNSLR_AllocatorError_None; } // No memory to free
+                return nil;
+            }
+
+            if (payload->numSlotsUsed <= 0)
+            {
+                if (error) { *error = PNSLR_AllocatorError_DoubleFree; }
+                return nil; // nothing is outstanding, so this must be a double free
+            }
+
+            *(rawptr*) oldMemory = payload->freeList;
+            payload->freeList    = oldMemory;
+            payload->numSlotsUsed--;
+            return nil;
+        }
+        case PNSLR_AllocatorMode_FreeAll:
+        {
+            // keep the first chunk around so that reuse after a reset doesn't hit the backing allocator
+            while (payload->currentChunk && payload->currentChunk->previous)
+            {
+                PNSLR_PoolAllocatorChunk* freeChunk = payload->currentChunk;
+                payload->currentChunk = freeChunk->previous;
+
+                payload->numSlotsTotal -= freeChunk->slotsCount;
+                PNSLR_Free(payload->backingAllocator, freeChunk, location, nil);
+            }
+
+            if (payload->currentChunk) { payload->currentChunk->slotsTouched = 0; }
+
+            payload->freeList     = nil;
+            payload->numSlotsUsed = 0;
+            return nil;
+        }
+        case PNSLR_AllocatorMode_QueryCapabilities:
+        {
+            return (rawptr)(
+                PNSLR_AllocatorCapability_Resize |
+                PNSLR_AllocatorCapability_Free |
+                PNSLR_AllocatorCapability_FreeAll
+            );
+        }
+        default:
+            if (error) { *error = PNSLR_AllocatorError_InvalidMode; }
+            return nil; // Unsupported mode.
+    }
+}
+
+#define PNSLR_INTERNAL_SLAB_SIZE            (64 * 1024)
+#define PNSLR_INTERNAL_SLAB_HEADER_SIZE     64 // also the cache line size every object is aligned to
+#define PNSLR_INTERNAL_SLAB_NUM_CACHES      32
+#define PNSLR_INTERNAL_SLAB_MAX_OBJECT_SIZE (PNSLR_INTERNAL_SLAB_NUM_CACHES * PNSLR_INTERNAL_SLAB_HEADER_SIZE)
+
+static inline PNSLR_SlabAllocatorSlab* PNSLR_Internal_GetSlabAllocatorSlab(rawptr memory)
+{
+    return (PNSLR_SlabAllocatorSlab*) (((u64) memory) & ~((u64) PNSLR_INTERNAL_SLAB_SIZE - 1));
+}
+
+static void PNSLR_Internal_PushSlabAllocatorSlab(PNSLR_SlabAllocatorSlab** list, PNSLR_SlabAllocatorSlab* slab)
+{
+    slab->previous = nil;
+    slab->next     = *list;
+    if (*list) { (*list)->previous = slab; }
+    *list = slab;
+}
+
+static void PNSLR_Internal_RemoveSlabAllocatorSlab(PNSLR_SlabAllocatorSlab** list, PNSLR_SlabAllocatorSlab* slab)
+{
+    if (slab->previous) { slab->previous->next = slab->next; } else { *list = slab->next; }
+    if (slab->next)     { slab->next->previous = slab->previous; }
+
+    slab->next     = nil;
+    slab->previous = nil;
+}
+
+// expects the cache to be locked
+static void PNSLR_Internal_ReleaseEmptySlabAllocatorSlabs(PNSLR_SlabAllocatorPayload* payload, PNSLR_SlabAllocatorCache* cache, i32 numToKeep, PNSLR_SourceCodeLocation location)
+{
+    while (cache->numEmptySlabs > numToKeep && cache->emptySlabs)
+    {
+        PNSLR_SlabAllocatorSlab* slab = cache->emptySlabs;
+        PNSLR_Internal_RemoveSlabAllocatorSlab(&cache->emptySlabs, slab);
+        cache->numEmptySlabs--;
+        cache->numSlabs--;
+
+        PNSLR_Free(payload->backingAllocator, slab, location, nil);
+    }
+}
+
+static rawptr PNSLR_Internal_AllocateFromSlabAllocatorCache(PNSLR_SlabAllocatorPayload* payload, i32 cacheIndex, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    PNSLR_SlabAllocatorCache* cache = &payload->caches[cacheIndex];
+    PNSLR_LockMutex(&cache->mutex);
+
+    PNSLR_SlabAllocatorSlab* slab = cache->partialSlabs;
+    if (!slab && cache->emptySlabs)
+    {
+        // reuse an empty slab before going back to the backing allocator
+        slab = cache->emptySlabs;
+        PNSLR_Internal_RemoveSlabAllocatorSlab(&cache->emptySlabs, slab);
+        PNSLR_Internal_PushSlabAllocatorSlab(&cache->partialSlabs, slab);
+        cache->numEmptySlabs--;
+    }
+
+    if (!slab)
+    {
+        // no need to zero, objects are zeroed on allocation if requested
+        rawptr block = PNSLR_Allocate(payload->backingAllocator, false, PNSLR_INTERNAL_SLAB_SIZE, PNSLR_INTERNAL_SLAB_SIZE, location, error);
+        if (!block) { PNSLR_UnlockMutex(&cache->mutex); return nil; }
+
+        if (((u64) block & ((u64) PNSLR_INTERNAL_SLAB_SIZE - 1)) != 0)
+        {
+            // objects could never find their slab again
+            PNSLR_Free(payload->backingAllocator, block, location, nil);
+            if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+            PNSLR_UnlockMutex(&cache->mutex);
+            return nil;
+        }
+
+        slab  = (PNSLR_SlabAllocatorSlab*) block;
+        *slab = (PNSLR_SlabAllocatorSlab)
+        {
+            .next           = nil,
+            .previous       = nil,
+            .freeList       = nil,
+            .capacity       = PNSLR_INTERNAL_SLAB_SIZE - PNSLR_INTERNAL_SLAB_HEADER_SIZE,
+            .cacheIndex     = cacheIndex,
+            .objectsCount   = cache->objectsPerSlab,
+            .objectsUsed    = 0,
+            .objectsTouched = 0,
+        };
+
+        PNSLR_Internal_PushSlabAllocatorSlab(&cache->partialSlabs, slab);
+        cache->numSlabs++;
+    }
+
+    rawptr output = slab->freeList;
+    if (output)
+    {
+        // pop from the free list, the link is stored in the object itself
+        slab->freeList = *(rawptr*) output;
+    }
+    else
+    {
+        // carve the next untouched object, so a new slab never needs to be threaded up-front
+        output = (rawptr) ((u8*) slab + PNSLR_INTERNAL_SLAB_HEADER_SIZE + ((i64) slab->objectsTouched * (i64) cache->objectStride));
+        slab->objectsTouched++;
+    }
+
+    slab->objectsUsed++;
+    cache->numObjectsUsed++;
+
+    if (slab->objectsUsed == slab->objectsCount)
+    {
+        PNSLR_Internal_RemoveSlabAllocatorSlab(&cache->partialSlabs, slab);
+        PNSLR_Internal_PushSlabAllocatorSlab(&cache->fullSlabs, slab);
+    }
+
+    PNSLR_UnlockMutex(&cache->mutex);
+    return output;
+}
+
+static void PNSLR_Internal_FreeToSlabAllocatorCache(PNSLR_SlabAllocatorPayload* payload, PNSLR_SlabAllocatorSlab* slab, rawptr memory, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    PNSLR_SlabAllocatorCache* cache = &payload->caches[slab->cacheIndex];
+    PNSLR_LockMutex(&cache->mutex);
+
+    if (slab->objectsUsed <= 0)
+    {
+        if (error) { *error = PNSLR_AllocatorError_DoubleFree; }
+        PNSLR_UnlockMutex(&cache->mutex);
+        return; // nothing is outstanding in this slab, so this must be a double free
+    }
+
+    b8 wasFull = (slab->objectsUsed == slab->objectsCount);
+
+    *(rawptr*) memory = slab->freeList;
+    slab->freeList    = memory;
+    slab->objectsUsed--;
+    cache->numObjectsUsed--;
+
+    if (wasFull)
+    {
+        PNSLR_Internal_RemoveSlabAllocatorSlab(&cache->fullSlabs, slab);
+        PNSLR_Internal_PushSlabAllocatorSlab(&cache->partialSlabs, slab);
+    }
+
+    if (slab->objectsUsed == 0)
+    {
+        PNSLR_Internal_RemoveSlabAllocatorSlab(&cache->partialSlabs, slab);
+        PNSLR_Internal_PushSlabAllocatorSlab(&cache->emptySlabs, slab);
+        cache->numEmptySlabs++;
+
+        // only hand slabs back once there's more than a few lying around
+        PNSLR_Internal_ReleaseEmptySlabAllocatorSlabs(payload, cache, payload->maxEmptySlabsPerCache, location);
+    }
+
+    PNSLR_UnlockMutex(&cache->mutex);
+}
+
+static rawptr PNSLR_Internal_AllocateLargeSlabAllocatorSlab(PNSLR_SlabAllocatorPayload* payload, b8 zeroed, i64 size, i32 alignment, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (alignment >= PNSLR_INTERNAL_SLAB_SIZE)
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+        return nil; // the object must stay within the first slab-sized stretch to find its header
+    }
+
+    i64 offset    = (alignment > PNSLR_INTERNAL_SLAB_HEADER_SIZE) ? alignment : PNSLR_INTERNAL_SLAB_HEADER_SIZE;
+    i64 totalSize = offset + size;
+
+    rawptr block = PNSLR_Allocate(payload->backingAllocator, zeroed, totalSize, PNSLR_INTERNAL_SLAB_SIZE, location, error);
+    if (!block) { return nil; }
+
+    if (((u64) block & ((u64) PNSLR_INTERNAL_SLAB_SIZE - 1)) != 0)
+    {
+        PNSLR_Free(payload->backingAllocator, block, location, nil);
+        if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+        return nil;
+    }
+
+    PNSLR_SlabAllocatorSlab* slab = (PNSLR_SlabAllocatorSlab*) block;
+    *slab = (PNSLR_SlabAllocatorSlab)
+    {
+        .next           = nil,
+        .previous       = nil,
+        .freeList       = nil,
+        .capacity       = totalSize, // including the header, so the offset of the object doesn't need storing
+        .cacheIndex     = -1,
+        .objectsCount   = 1,
+        .objectsUsed    = 1,
+        .objectsTouched = 1,
+    };
+
+    PNSLR_LockMutex(&payload->largeSlabsMutex);
+    PNSLR_Internal_PushSlabAllocatorSlab(&payload->largeSlabs, slab);
+    payload->numLargeSlabs++;
+    PNSLR_UnlockMutex(&payload->largeSlabsMutex);
+
+    return (rawptr) ((u8*) block + offset);
+}
+
+static void PNSLR_Internal_FreeLargeSlabAllocatorSlab(PNSLR_SlabAllocatorPayload* payload, PNSLR_SlabAllocatorSlab* slab, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    PNSLR_LockMutex(&payload->largeSlabsMutex);
+
+    if (slab->objectsUsed <= 0)
+    {
+        if (error) { *error = PNSLR_AllocatorError_DoubleFree; }
+        PNSLR_UnlockMutex(&payload->largeSlabsMutex);
+        return;
+    }
+
+    slab->objectsUsed = 0;
+    PNSLR_Internal_RemoveSlabAllocatorSlab(&payload->largeSlabs, slab);
+    payload->numLargeSlabs--;
+
+    PNSLR_UnlockMutex(&payload->largeSlabsMutex);
+
+    PNSLR_Free(payload->backingAllocator, slab, location, error);
+}
+
+PNSLR_Allocator PNSLR_NewAllocator_Slab(PNSLR_Allocator backingAllocator, i32 maxEmptySlabsPerCache, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (error) { *error = PNSLR_AllocatorError_None; }
+
+    if (maxEmptySlabsPerCache < 0)
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return PNSLR_GetAllocator_Nil();
+    }
+
+    PNSLR_SlabAllocatorPayload* payload = PNSLR_Allocate(
+        backingAllocator,
+        true,
+        sizeof(PNSLR_SlabAllocatorPayload),
+        alignof(PNSLR_SlabAllocatorPayload),
+        location,
+        error
+    );
+
+    if (!payload) { return PNSLR_GetAllocator_Nil(); }
+
+    payload->backingAllocator      = backingAllocator;
+    payload->largeSlabsMutex       = PNSLR_CreateMutex();
+    payload->largeSlabs            = nil;
+    payload->numLargeSlabs         = 0;
+    payload->maxEmptySlabsPerCache = maxEmptySlabsPerCache;
+
+    for (i32 i = 0; i < PNSLR_INTERNAL_SLAB_NUM_CACHES; i++)
+    {
+        i32 stride = (i + 1) * PNSLR_INTERNAL_SLAB_HEADER_SIZE;
+        payload->caches[i] = (PNSLR_SlabAllocatorCache)
+        {
+            .mutex          = PNSLR_CreateMutex(),
+            .partialSlabs   = nil,
+            .fullSlabs      = nil,
+            .emptySlabs     = nil,
+            .numObjectsUsed = 0,
+            .objectStride   = stride,
+            .objectsPerSlab = (PNSLR_INTERNAL_SLAB_SIZE - PNSLR_INTERNAL_SLAB_HEADER_SIZE) / stride,
+            .numSlabs       = 0,
+            .numEmptySlabs  = 0,
+        };
+    }
+
+    return (PNSLR_Allocator) {
+        .procedure = PNSLR_AllocatorFn_Slab,
+        .data = payload
+    };
+}
+
+void PNSLR_DestroyAllocator_Slab(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (!allocator.procedure || !allocator.data) { return; }
+    if (error) { *error = PNSLR_AllocatorError_None; } // No error by default
+
+    PNSLR_SlabAllocatorPayload* payload = (PNSLR_SlabAllocatorPayload*) allocator.data;
+
+    for (i32 i = 0; i < PNSLR_INTERNAL_SLAB_NUM_CACHES; i++)
+    {
+        PNSLR_SlabAllocatorCache* cache = &payload->caches[i];
+
+        PNSLR_SlabAllocatorSlab* lists[3] = {cache->partialSlabs, cache->fullSlabs, cache->emptySlabs};
+        for (i32 j = 0; j < 3; j++)
+        {
+            PNSLR_SlabAllocatorSlab* slab = lists[j];
+            while (slab)
+            {
+                PNSLR_SlabAllocatorSlab* next = slab->next;
+                PNSLR_Free(payload->backingAllocator, slab, location, nil);
+                slab = next;
+            }
+        }
+
+        PNSLR_DestroyMutex(&cache->mutex);
+    }
+
+    PNSLR_SlabAllocatorSlab* largeSlab = payload->largeSlabs;
+    while (largeSlab)
+    {
+        PNSLR_SlabAllocatorSlab* next = largeSlab->next;
+        PNSLR_Free(payload->backingAllocator, largeSlab, location, nil);
+        largeSlab = next;
+    }
+
+    PNSLR_DestroyMutex(&payload->largeSlabsMutex);
+
+    PNSLR_Free(payload->backingAllocator, payload, location, error);
+}
+
+rawptr PNSLR_AllocatorFn_Slab(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    // clear error by default
+    if (error) { *error = PNSLR_AllocatorError_None; }
+
+    if (size < 0 )
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return nil; // Invalid size or alignment
+    }
+
+    // check alignment
+    if ((alignment < 1) || (alignment & (alignment - 1))) // if alignment is not a power of two
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+        return nil;
+    }
+
+    PNSLR_SlabAllocatorPayload* payload = (PNSLR_SlabAllocatorPayload*) allocatorData;
+    if (!payload) { return nil; }
+
+    switch (mode)
+    {
+        case PNSLR_AllocatorMode_Allocate:
+        case PNSLR_AllocatorMode_AllocateNoZero:
+        {
+            b8 zeroed = (mode == PNSLR_AllocatorMode_Allocate);
+
+            if (size > PNSLR_INTERNAL_SLAB_MAX_OBJECT_SIZE || alignment > PNSLR_INTERNAL_SLAB_HEADER_SIZE)
+            {
+                return PNSLR_Internal_AllocateLargeSlabAllocatorSlab(payload, zeroed, size, alignment, location, error);
+            }
+
+            i32 cacheIndex = (size > 0) ? (i32) ((size - 1) / PNSLR_INTERNAL_SLAB_HEADER_SIZE) : 0;
+            rawptr memory = PNSLR_Internal_AllocateFromSlabAllocatorCache(payload, cacheIndex, location, error);
+            if (memory && zeroed) { PNSLR_MemSet(memory, 0, size); }
+            return memory;
+        }
+        case PNSLR_AllocatorMode_Resize:
+        case PNSLR_AllocatorMode_ResizeNoZero:
+        {
+            PNSLR_AllocatorMode allocMode = (mode == PNSLR_AllocatorMode_Resize) ? PNSLR_AllocatorMode_Allocate : PNSLR_AllocatorMode_AllocateNoZero;
+            if (!oldMemory)
+            {
+                return PNSLR_AllocatorFn_Slab(allocatorData, allocMode, size, alignment, nil, 0, location, error);
+            }
+
+            PNSLR_SlabAllocatorSlab* slab     = PNSLR_Internal_GetSlabAllocatorSlab(oldMemory);
+            i64                      capacity = (slab->cacheIndex >= 0) ? payload->caches[slab->cacheIndex].objectStride : (slab->capacity - ((i64) ((u8*) oldMemory - (u8*) slab)));
+
+            // stay in place as long as the object still fits
+            if (size <= capacity && (((u64) oldMemory) & ((u64) (alignment - 1))) == 0)
+            {
+                if (size > oldSize && mode == PNSLR_AllocatorMode_Resize) { PNSLR_MemSet((u8*) oldMemory + oldSize, 0, size - oldSize); }
+                return oldMemory;
+            }
+
+            rawptr newMemory = PNSLR_AllocatorFn_Slab(allocatorData, allocMode, size, alignment, nil, 0, location, error);
+            if (!newMemory) { return nil; }
+
+            PNSLR_MemCopy(newMemory, oldMemory, (oldSize < size) ? oldSize : size);
+            PNSLR_AllocatorFn_Slab(allocatorData, PNSLR_AllocatorMode_Free, 0, 1, oldMemory, 0, location, nil);
+            return newMemory;
+        }
+        case PNSLR_AllocatorMode_Free:
+        {
+            if (oldMemory == nil)
+            {
+                if (error) { *error = PNSLR_AllocatorError_None; } // No memory to free
+                return nil;
+            }
+
+            PNSLR_SlabAllocatorSlab* slab = PNSLR_Internal_GetSlabAllocatorSlab(oldMemory);
+            if (slab->cacheIndex >= 0) { PNSLR_Internal_FreeToSlabAllocatorCache(payload, slab, oldMemory, location, error); }
+            else                       { PNSLR_Internal_FreeLargeSlabAllocatorSlab(payload, slab, location, error); }
+            return nil;
+        }
+        case PNSLR_AllocatorMode_FreeAll:
+        {
+            for (i32 i = 0; i < PNSLR_INTERNAL_SLAB_NUM_CACHES; i++)
+            {
+                PNSLR_SlabAllocatorCache* cache = &payload->caches[i];
+                PNSLR_LockMutex(&cache->mutex);
+
+                // every slab becomes empty, and only the ones that would've been kept around stay
+                PNSLR_SlabAllocatorSlab** lists[2] = {&cache->partialSlabs, &cache->fullSlabs};
+                for (i32 j = 0; j < 2; j++)
+                {
+                    while (*lists[j])
+                    {
+                        PNSLR_SlabAllocatorSlab* slab = *lists[j];
+                        PNSLR_Internal_RemoveSlabAllocatorSlab(lists[j], slab);
+                        PNSLR_Internal_PushSlabAllocatorSlab(&cache->emptySlabs, slab);
+                        cache->numEmptySlabs++;
+                    }
+                }
+
+                for (PNSLR_SlabAllocatorSlab* slab = cache->emptySlabs; slab; slab = slab->next)
+                {
+                    slab->freeList       = nil;
+                    slab->objectsUsed    = 0;
+                    slab->objectsTouched = 0;
+                }
+
+                cache->numObjectsUsed = 0;
+                PNSLR_Internal_ReleaseEmptySlabAllocatorSlabs(payload, cache, payload->maxEmptySlabsPerCache, location);
+
+                PNSLR_UnlockMutex(&cache->mutex);
+            }
+
+            PNSLR_LockMutex(&payload->largeSlabsMutex);
+            while (payload->largeSlabs)
+            {
+                PNSLR_SlabAllocatorSlab* slab = payload->largeSlabs;
+                PNSLR_Internal_RemoveSlabAllocatorSlab(&payload->largeSlabs, slab);
+                PNSLR_Free(payload->backingAllocator, slab, location, nil);
+            }
+            payload->numLargeSlabs = 0;
+            PNSLR_UnlockMutex(&payload->largeSlabsMutex);
+
+            return nil;
+        }
+        case PNSLR_AllocatorMode_QueryCapabilities:
+        {
+            return (rawptr)(
+                PNSLR_AllocatorCapability_ThreadSafe |
+                PNSLR_AllocatorCapability_Resize |
+                PNSLR_AllocatorCapability_Free |
+                PNSLR_AllocatorCapability_FreeAll |
+                PNSLR_AllocatorCapability_HintHeap
+            );
+        }
+        default:
+            if (error) { *error = PNSLR_AllocatorError_InvalidMode; }
+            return nil; // Unsupported mode.
+    }
+}
+
+void PNSLR_TrimSlabAllocator(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location)
+{
+    if (allocator.procedure != PNSLR_AllocatorFn_Slab || !allocator.data) { return; }
+
+    PNSLR_SlabAllocatorPayload* payload = (PNSLR_SlabAllocatorPayload*) allocator.data;
+    for (i32 i = 0; i < PNSLR_INTERNAL_SLAB_NUM_CACHES; i++)
+    {
+        PNSLR_SlabAllocatorCache* cache = &payload->caches[i];
+        PNSLR_LockMutex(&cache->mutex);
+        PNSLR_Internal_ReleaseEmptySlabAllocatorSlabs(payload, cache, 0, location);
+        PNSLR_UnlockMutex(&cache->mutex);
+    }
+}
+
+PNSLR_SlabAllocatorStats PNSLR_GetSlabAllocatorStats(PNSLR_Allocator allocator)
+{
+    PNSLR_SlabAllocatorStats output = {0};
+    if (allocator.procedure != PNSLR_AllocatorFn_Slab || !allocator.data) { return output; }
+
+    PNSLR_SlabAllocatorPayload* payload = (PNSLR_SlabAllocatorPayload*) allocator.data;
+    for (i32 i = 0; i < PNSLR_INTERNAL_SLAB_NUM_CACHES; i++)
+    {
+        PNSLR_SlabAllocatorCache* cache = &payload->caches[i];
+        PNSLR_LockMutex(&cache->mutex);
+        output.numObjectsUsed += cache->numObjectsUsed;
+        output.numSlabs       += cache->numSlabs;
+        output.numEmptySlabs  += cache->numEmptySlabs;
+        PNSLR_UnlockMutex(&cache->mutex);
+    }
+
+    output.reservedBytes = output.numSlabs * PNSLR_INTERNAL_SLAB_SIZE;
+
+    PNSLR_LockMutex(&payload->largeSlabsMutex);
+    output.numLargeSlabs = payload->numLargeSlabs;
+    for (PNSLR_SlabAllocatorSlab* slab = payload->largeSlabs; slab; slab = slab->next) { output.reservedBytes += slab->capacity; }
+    PNSLR_UnlockMutex(&payload->largeSlabsMutex);
+
+    return output;
+}
+
+#define PNSLR_INTERNAL_BUDDY_BLOCK_ALLOCATED ((u8) 0x80)
+
+static inline i32 PNSLR_Internal_GetBuddyAllocatorBlockIndex(PNSLR_BuddyAllocatorPayload* payload, rawptr block)
+{
+    return (i32) (((u64) block - (u64) payload->memory) >> payload->minBlockShift);
+}
+
+static inline rawptr PNSLR_Internal_GetBuddyAllocatorBlock(PNSLR_BuddyAllocatorPayload* payload, i32 index)
+{
+    return (rawptr) ((u8*) payload->memory + ((u64) index << payload->minBlockShift));
+}
+
+static void PNSLR_Internal_PushBuddyAllocatorFreeBlock(PNSLR_BuddyAllocatorPayload* payload, rawptr memory, i32 order)
+{
+    PNSLR_BuddyAllocatorFreeBlock* block = (PNSLR_BuddyAllocatorFreeBlock*) memory;
+    block->previous = nil;
+    block->next     = payload->freeLists[order];
+    if (block->next) { block->next->previous = block; }
+    payload->freeLists[order] = block;
+
+    payload->blockStates[PNSLR_Internal_GetBuddyAllocatorBlockIndex(payload, memory)] = (u8) (order + 1);
+    payload->numFreeBlocks++;
+}
+
+static void PNSLR_Internal_RemoveBuddyAllocatorFreeBlock(PNSLR_BuddyAllocatorPayload* payload, rawptr memory, i32 order)
+{
+    PNSLR_BuddyAllocatorFreeBlock* block = (PNSLR_BuddyAllocatorFreeBlock*) memory;
+    if (block->previous) { block->previous->next = block->next;     }
+    else                 { payload->freeLists[order] = block->next; }
+    if (block->next)     { block->next->previous = block->previous; }
+
+    payload->blockStates[PNSLR_Internal_GetBuddyAllocatorBlockIndex(payload, memory)] = 0;
+    payload->numFreeBlocks--;
+}
+
+static i32 PNSLR_Internal_GetBuddyAllocatorOrder(PNSLR_BuddyAllocatorPayload* payload, i64 size)
+{
+    i32 order     = 0;
+    i64 blockSize = payload->minBlockSize;
+    while (blockSize < size && order < payload->numOrders) { blockSize <<= 1; order++; } // past the largest order means it can't fit
+    return order;
+}
+
+static void PNSLR_Internal_ResetBuddyAllocator(PNSLR_BuddyAllocatorPayload* payload)
+{
+    i64 numBlocks = payload->regionSize >> payload->minBlockShift;
+    PNSLR_MemSet(payload->blockStates,    0, numBlocks * (i64) sizeof(u8));
+    PNSLR_MemSet(payload->requestedSizes, 0, numBlocks * (i64) sizeof(i64));
+    PNSLR_MemSet(payload->freeLists,      0, (i64) sizeof(payload->freeLists));
+
+    payload->numAllocations = 0;
+    payload->numFreeBlocks  = 0;
+    payload->usedBytes      = 0;
+    payload->requestedBytes = 0;
+
+    PNSLR_Internal_PushBuddyAllocatorFreeBlock(payload, payload->memory, payload->numOrders - 1);
+}
+
+static rawptr PNSLR_Internal_AllocateFromBuddyAllocator(PNSLR_BuddyAllocatorPayload* payload, i32 order, i64 size, PNSLR_AllocatorError* error)
+{
+    i32 available = order;
+    while (available < payload->numOrders && !payload->freeLists[available]) { available++; }
+
+    if (available >= payload->numOrders)
+    {
+        if (error) { *error = PNSLR_AllocatorError_OutOfMemory; }
+        return nil;
+    }
+
+    rawptr output = (rawptr) payload->freeLists[available];
+    PNSLR_Internal_RemoveBuddyAllocatorFreeBlock(payload, output, available);
+
+    // split down to the requested order, handing the upper halves back to the free lists
+    while (available > order)
+    {
+        available--;
+        PNSLR_Internal_PushBuddyAllocatorFreeBlock(payload, (u8*) output + ((i64) payload->minBlockSize << available), available);
+    }
+
+    i32 index = PNSLR_Internal_GetBuddyAllocatorBlockIndex(payload, output);
+    payload->blockStates[index]    = (u8) (order + 1) | PNSLR_INTERNAL_BUDDY_BLOCK_ALLOCATED;
+    payload->requestedSizes[index] = size;
+    payload->usedBytes            += (i64) payload->minBlockSize << order;
+    payload->requestedBytes       += size;
+    payload->numAllocations++;
+    return output;
+}
+
+static b8 PNSLR_Internal_GetBuddyAllocatorAllocatedBlock(PNSLR_BuddyAllocatorPayload* payload, rawptr memory, i32* outIndex, i32* outOrder, PNSLR_AllocatorError* error)
+{
+    u64 offset = (u64) memory - (u64) payload->memory;
+    if ((u64) memory < (u64) payload->memory || offset >= (u64) payload->regionSize || (offset & (u64) (payload->minBlockSize - 1)))
+    {
+        if (error) { *error = PNSLR_AllocatorError_Internal; }
+        return false; // not a block from this allocator
+    }
+
+    i32 index = (i32) (offset >> payload->minBlockShift);
+    u8  state = payload->blockStates[index];
+    if (!state)
+    {
+        // not a block start, but it might've been one before getting merged into a larger free block
+        for (i32 order = 1; order < payload->numOrders; order++)
+        {
+            u8 ancestorState = payload->blockStates[index & ~((1 << order) - 1)];
+            if (ancestorState == (u8) (order + 1)) { state = ancestorState; break; }
+        }
+    }
+
+    if (!(state & PNSLR_INTERNAL_BUDDY_BLOCK_ALLOCATED))
+    {
+        if (error) { *error = state ? PNSLR_AllocatorError_DoubleFree : PNSLR_AllocatorError_Internal; }
+        return false;
+    }
+
+    *outIndex = index;
+    *outOrder = (i32) (state & ~PNSLR_INTERNAL_BUDDY_BLOCK_ALLOCATED) - 1;
+    return true;
+}
+
+static void PNSLR_Internal_FreeFromBuddyAllocator(PNSLR_BuddyAllocatorPayload* payload, i32 index, i32 order)
+{
+    payload->usedBytes      -= (i64) payload->minBlockSize << order;
+    payload->requestedBytes -= payload->requestedSizes[index];
+    payload->requestedSizes[index] = 0;
+    payload->blockStates[index]    = 0;
+    payload->numAllocations--;
+
+    // coalesce with the buddy for as long as it's free and of the same order
+    while (order < payload->numOrders - 1)
+    {
+        i32 buddyIndex = index ^ (1 << order);
+        if (payload->blockStates[buddyIndex] != (u8) (order + 1)) { break; }
+
+        PNSLR_Internal_RemoveBuddyAllocatorFreeBlock(payload, PNSLR_Internal_GetBuddyAllocatorBlock(payload, buddyIndex), order);
+        index = index < buddyIndex ? index : buddyIndex;
+        order++;
+    }
+
+    PNSLR_Internal_PushBuddyAllocatorFreeBlock(payload, PNSLR_Internal_GetBuddyAllocatorBlock(payload, index), order);
+}
+
+PNSLR_Allocator PNSLR_NewAllocator_Buddy(PNSLR_Allocator backingAllocator, i64 regionSize, i32 minBlockSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (error) { *error = PNSLR_AllocatorError_None; }
+
+    if (regionSize < 1 || minBlockSize < 1 || (minBlockSize & (minBlockSize - 1)))
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return PNSLR_GetAllocator_Nil();
+    }
+
+    // every free block must be able to hold its free list links
+    if (minBlockSize < (i32) sizeof(PNSLR_BuddyAllocatorFreeBlock)) { minBlockSize = (i32) sizeof(PNSLR_BuddyAllocatorFreeBlock); }
+
+    i32 minBlockShift = 0;
+    while ((1 << minBlockShift) < minBlockSize) { minBlockShift++; }
+
+    i32 numOrders   = 1;
+    i64 roundedSize = minBlockSize;
+    while (roundedSize < regionSize) { roundedSize <<= 1; numOrders++; }
+
+    // block orders have to fit in the free lists, and block indices in an i32
+    if (numOrders > 32 || (roundedSize >> minBlockShift) > I32_MAX)
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return PNSLR_GetAllocator_Nil();
+    }
+
+    PNSLR_BuddyAllocatorPayload* payload = PNSLR_Allocate(
+        backingAllocator,
+        true,
+        sizeof(PNSLR_BuddyAllocatorPayload),
+        alignof(PNSLR_BuddyAllocatorPayload),
+        location,
+        error
+    );
+
+    if (!payload) { return PNSLR_GetAllocator_Nil(); }
+
+    i64 numBlocks = roundedSize >> minBlockShift;
+    *payload = (PNSLR_BuddyAllocatorPayload)
+    {
+        .backingAllocator = backingAllocator,
+        .memory           = PNSLR_Allocate(backingAllocator, false, roundedSize, minBlockSize, location, error),
+        .blockStates      = PNSLR_Allocate(backingAllocator, false, numBlocks * (i64) sizeof(u8), alignof(u8), location, nil),
+        .requestedSizes   = PNSLR_Allocate(backingAllocator, false, numBlocks * (i64) sizeof(i64), alignof(i64), location, nil),
+        .regionSize       = roundedSize,
+        .minBlockSize     = minBlockSize,
+        .minBlockShift    = minBlockShift,
+        .numOrders        = numOrders,
+    };
+
+    if (!payload->memory || !payload->blockStates || !payload->requestedSizes)
+    {
+        if (error) { *error = PNSLR_AllocatorError_OutOfMemory; }
+        PNSLR_DestroyAllocator_Buddy((PNSLR_Allocator) {.procedure = PNSLR_AllocatorFn_Buddy, .data = payload}, location, nil);
+        return PNSLR_GetAllocator_Nil();
+    }
+
+    PNSLR_Internal_ResetBuddyAllocator(payload);
+
+    return (PNSLR_Allocator) {
+        .procedure = PNSLR_AllocatorFn_Buddy,
+        .data = payload
+    };
+}
+
+void PNSLR_DestroyAllocator_Buddy(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (!allocator.procedure || !allocator.data) { return; }
+    if (error) { *error = PNSLR_AllocatorError_None; } // No error by default
+
+    PNSLR_BuddyAllocatorPayload* payload = (PNSLR_BuddyAllocatorPayload*) allocator.data;
+
+    PNSLR_Free(payload->backingAllocator, payload->requestedSizes, location, nil);
+    PNSLR_Free(payload->backingAllocator, payload->blockStates,    location, nil);
+    PNSLR_Free(payload->backingAllocator, payload->memory,         location, nil);
+
+    PNSLR_Free(payload->backingAllocator, payload, location, error);
+}
+
+rawptr PNSLR_AllocatorFn_Buddy(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    // clear error by default
+    if (error) { *error = PNSLR_AllocatorError_None; }
+
+    if (size < 0 )
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return nil; // Invalid size or alignment
+    }
+
+    // check alignment
+    if ((alignment < 1) || (alignment & (alignment - 1))) // if alignment is not a power of two
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+        return nil;
+    }
+
+    PNSLR_BuddyAllocatorPayload* payload = (PNSLR_BuddyAllocatorPayload*) allocatorData;
+    if (!payload || !payload->memory) { return nil; }
+
+    if (alignment > payload->minBlockSize && mode != PNSLR_AllocatorMode_QueryCapabilities)
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+        return nil; // the region itself is only aligned to the min block size
+    }
+
+    switch (mode)
+    {
+        case PNSLR_AllocatorMode_Allocate:
+        case PNSLR_AllocatorMode_AllocateNoZero:
+        {
+            rawptr memory = PNSLR_Internal_AllocateFromBuddyAllocator(payload, PNSLR_Internal_GetBuddyAllocatorOrder(payload, size), size, error);
+            if (memory && mode == PNSLR_AllocatorMode_Allocate) { PNSLR_MemSet(memory, 0, size); }
+            return memory;
+        }
+        case PNSLR_AllocatorMode_Resize:
+        case PNSLR_AllocatorMode_ResizeNoZero:
+        {
+            if (!oldMemory)
+            {
+                return PNSLR_AllocatorFn_Buddy(
+                    allocatorData,
+                    mode == PNSLR_AllocatorMode_Resize ? PNSLR_AllocatorMode_Allocate : PNSLR_AllocatorMode_AllocateNoZero,
+                    size,
+                    alignment,
+                    nil,
+                    0,
+                    location,
+                    error
+                );
+            }
+
+            i32 index = 0, order = 0;
+            if (!PNSLR_Internal_GetBuddyAllocatorAllocatedBlock(payload, oldMemory, &index, &order, error)) { return nil; }
+
+            i32 newOrder = PNSLR_Internal_GetBuddyAllocatorOrder(payload, size);
+            b8  inPlace  = (newOrder <= order);
+
+            if (!inPlace && newOrder < payload->numOrders)
+            {
+                // can only grow in-place if this block is the lower half at every level and all the buddies are free
+                inPlace = true;
+                for (i32 i = order; i < newOrder && inPlace; ++i)
+                {
+                    inPlace = !(index & (1 << i)) && payload->blockStates[index ^ (1 << i)] == (u8) (i + 1);
+                }
+
+                for (i32 i = order; i < newOrder && inPlace; ++i)
+                {
+                    PNSLR_Internal_RemoveBuddyAllocatorFreeBlock(payload, PNSLR_Internal_GetBuddyAllocatorBlock(payload, index ^ (1 << i)), i);
+                }
+            }
+
+            if (inPlace)
+            {
+                // shrinking hands the upper halves back to the free lists
+                for (i32 i = order - 1; i >= newOrder; --i)
+                {
+                    PNSLR_Internal_PushBuddyAllocatorFreeBlock(payload, (u8*) oldMemory + ((i64) payload->minBlockSize << i), i);
+                }
+
+                payload->usedBytes            += ((i64) payload->minBlockSize << newOrder) - ((i64) payload->minBlockSize << order);
+                payload->requestedBytes       += size - payload->requestedSizes[index];
+                payload->requestedSizes[index] = size;
+                payload->blockStates[index]    = (u8) (newOrder + 1) | PNSLR_INTERNAL_BUDDY_BLOCK_ALLOCATED;
+
+                if (size > oldSize && mode == PNSLR_AllocatorMode_Resize) { PNSLR_MemSet((u8*) oldMemory + oldSize, 0, size - oldSize); }
+                return oldMemory;
+            }
+
+            rawptr newMemory = PNSLR_Internal_AllocateFromBuddyAllocator(payload, newOrder, size, error);
+            if (!newMemory) { return nil; }
+
+            PNSLR_MemCopy(newMemory, oldMemory, oldSize < size ? oldSize : size);
+            if (size > oldSize && mode == PNSLR_AllocatorMode_Resize) { PNSLR_MemSet((u8*) newMemory + oldSize, 0, size - oldSize); }
+
+            PNSLR_Internal_FreeFromBuddyAllocator(payload, index, order);
+            return newMemory;
+        }
+        case PNSLR_AllocatorMode_Free:
+        {
+            if (oldMemory == nil)
+            {
+                if (error) { *error = PNSLR_AllocatorError_None; } // No memory to free
+                return nil;
+            }
+
+            i32 index = 0, order = 0;
+            if (!PNSLR_Internal_GetBuddyAllocatorAllocatedBlock(payload, oldMemory, &index, &order, error)) { return nil; }
+
+            PNSLR_Internal_FreeFromBuddyAllocator(payload, index, order);
+            return nil;
+        }
+        case PNSLR_AllocatorMode_FreeAll:
+        {
+            PNSLR_Internal_ResetBuddyAllocator(payload);
+            return nil;
+        }
+        case PNSLR_AllocatorMode_QueryCapabilities:
+        {
+            return (rawptr)(
+                PNSLR_AllocatorCapability_Resize |
+                PNSLR_AllocatorCapability_Free |
+                PNSLR_AllocatorCapability_FreeAll
+            );
+        }
+        default:
+            if (error) { *error = PNSLR_AllocatorError_InvalidMode; }
+            return nil; // Unsupported mode.
+    }
+}
+
+PNSLR_BuddyAllocatorStats PNSLR_GetBuddyAllocatorStats(PNSLR_Allocator allocator)
+{
+    if (allocator.procedure != PNSLR_AllocatorFn_Buddy || !allocator.data) { return (PNSLR_BuddyAllocatorStats) {0}; }
+
+    PNSLR_BuddyAllocatorPayload* payload = (PNSLR_BuddyAllocatorPayload*) allocator.data;
+
+    PNSLR_BuddyAllocatorStats output = {0};
+    output.totalBytes     = payload->regionSize;
+    output.usedBytes      = payload->usedBytes;
+    output.requestedBytes = payload->requestedBytes;
+    output.freeBytes      = payload->regionSize - payload->usedBytes;
+    output.numAllocations = payload->numAllocations;
+    output.numFreeBlocks  = payload->numFreeBlocks;
+
+    for (i32 order = payload->numOrders - 1; order >= 0; --order)
+    {
+        if (payload->freeLists[order])
+        {
+            output.largestFreeBlock = (i64) payload->minBlockSize << order;
+            break;
+        }
+    }
+
+    return output;
+}
+
+/**
+ * Written right before every pointer handed out by the tracking allocator.
+ */
+typedef struct PNSLR_Internal_TrackingAllocationHeader
+{
+    PNSLR_SourceCodeLocation location; // where it was originally allocated
+    i64                      size;
+    i64                      offset;   // from the start of the backing allocation
+} PNSLR_Internal_TrackingAllocationHeader;
+
+typedef struct PNSLR_Internal_TrackingRecordCacheEntry
+{
+    i64                                  id;
+    PNSLR_TrackingAllocatorThreadRecord* record;
+} PNSLR_Internal_TrackingRecordCacheEntry;
+
+#define PNSLR_INTERNAL_TRACKING_RECORD_CACHE_SIZE 8
+#define PNSLR_INTERNAL_TRACKING_MAX_CALL_SITES    ((i32) (sizeof(((PNSLR_TrackingAllocatorThreadRecord*) 0)->callSites) / sizeof(PNSLR_TrackingAllocatorCallSite)))
+
+static i64                                                  G_PNSLR_Internal_TrackingAllocatorNextId = 0;
+static thread_local u8                                      G_PNSLR_Internal_TrackingThreadMarker    = 0; // only the address matters, it identifies the thread
+static thread_local u32                                     G_PNSLR_Internal_TrackingRecordCacheNext = 0;
+static thread_local PNSLR_Internal_TrackingRecordCacheEntry G_PNSLR_Internal_TrackingRecordCache[PNSLR_INTERNAL_TRACKING_RECORD_CACHE_SIZE] = {0};
+
+static inline i64 PNSLR_Internal_GetTrackingAllocationOffset(i32 alignment)
+{
+    return (i64) PNSLR_Internal_AlignU64Forward(sizeof(PNSLR_Internal_TrackingAllocationHeader), (u64) alignment);
+}
+
+static inline i32 PNSLR_Internal_GetTrackingBlockAlignment(i32 alignment)
+{
+    return (alignment > (i32) alignof(PNSLR_Internal_TrackingAllocationHeader)) ? alignment : (i32) alignof(PNSLR_Internal_TrackingAllocationHeader);
+}
+
+static b8 PNSLR_Internal_AreTrackingCallSitesSame(PNSLR_SourceCodeLocation a, PNSLR_SourceCodeLocation b)
+{
+    if (a.line != b.line || a.file.count != b.file.count) { return false; }
+    if (a.file.data == b.file.data)                       { return true;  }
+    if (!a.file.data || !b.file.data)                     { return false; }
+
+    for (i64 i = 0; i < a.file.count; ++i) { if (a.file.data[i] != b.file.data[i]) { return false; } }
+    return true;
+}
+
+static PNSLR_TrackingAllocatorThreadRecord* PNSLR_Internal_GetTrackingAllocatorThreadRecord(PNSLR_TrackingAllocatorPayload* payload, PNSLR_SourceCodeLocation location)
+{
+    for (i32 i = 0; i < PNSLR_INTERNAL_TRACKING_RECORD_CACHE_SIZE; ++i)
+    {
+        if (G_PNSLR_Internal_TrackingRecordCache[i].id == payload->id) { return G_PNSLR_Internal_TrackingRecordCache[i].record; }
+    }
+
+    // slow path, once per thread per allocator (unless it gets evicted from the cache)
+    rawptr owner = &G_PNSLR_Internal_TrackingThreadMarker;
+
+    PNSLR_LockMutex(&payload->recordsMutex);
+
+    PNSLR_TrackingAllocatorThreadRecord* record = payload->records;
+    while (record && record->owner != owner) { record = record->next; }
+
+    if (!record)
+    {
+        record = PNSLR_Allocate(
+            payload->backingAllocator,
+            true,
+            sizeof(PNSLR_TrackingAllocatorThreadRecord),
+            alignof(PNSLR_TrackingAllocatorThreadRecord),
+            location,
+            nil
+        );
+
+        if (record)
+        {
+            record->owner    = owner;
+            record->next     = payload->records;
+            payload->records = record;
+        }
+    }
+
+    PNSLR_UnlockMutex(&payload->recordsMutex);
+
+    if (record)
+    {
+        u32 slot = (G_PNSLR_Internal_TrackingRecordCacheNext++) % PNSLR_INTERNAL_TRACKING_RECORD_CACHE_SIZE;
+        G_PNSLR_Internal_TrackingRecordCache[slot] = (PNSLR_Internal_TrackingRecordCacheEntry) {.id = payload->id, .record = record};
+    }
+
+    return record;
+}
+
+static PNSLR_TrackingAllocatorCallSite* PNSLR_Internal_GetTrackingAllocatorCallSite(PNSLR_TrackingAllocatorThreadRecord* record, PNSLR_SourceCodeLocation location)
+{
+    u64 hash = (((u64) location.file.data) * 0x9E3779B97F4A7C15ULL) ^ (((u64) (u32) location.line) * 0xC2B2AE3D27D4EB4FULL);
+    hash ^= hash >> 29;
+
+    for (i32 probe = 0; probe < PNSLR_INTERNAL_TRACKING_MAX_CALL_SITES; ++probe)
+    {
+        PNSLR_TrackingAllocatorCallSite* site = &record->callSites[(hash + (u64) probe) % PNSLR_INTERNAL_TRACKING_MAX_CALL_SITES];
+
+        // a site is only ever added right before it's counted, so an empty one is never in use
+        if (!site->numAllocations && !site->numFrees && !site->numResizes)
+        {
+            // keep the table at most 3/4 full so probes stay short
+            if (record->numCallSites >= (PNSLR_INTERNAL_TRACKING_MAX_CALL_SITES / 4) * 3) { break; }
+
+            site->location = location;
+            record->numCallSites++;
+            return site;
+        }
+
+        if (PNSLR_Internal_AreTrackingCallSitesSame(site->location, location)) { return site; }
+    }
+
+    return &record->overflow;
+}
+
+static void PNSLR_Internal_UpdateTrackingAllocatorLiveBytes(PNSLR_TrackingAllocatorPayload* payload, i64 delta)
+{
+    i64 live = PNSLR_AtomicFetchAddI64(&payload->liveBytes, delta) + delta;
+    i64 peak = PNSLR_AtomicLoadI64(&payload->peakBytes);
+    while (live > peak && !PNSLR_AtomicCompareExchangeI64(&payload->peakBytes, &peak, live)) { }
+}
+
+static void PNSLR_Internal_TrackAllocation(PNSLR_TrackingAllocatorPayload* payload, PNSLR_SourceCodeLocation location, i64 size)
+{
+    PNSLR_Internal_UpdateTrackingAllocatorLiveBytes(payload, size);
+
+    PNSLR_TrackingAllocatorThreadRecord* record = PNSLR_Internal_GetTrackingAllocatorThreadRecord(payload, location);
+    if (!record) { return; }
+
+    PNSLR_TrackingAllocatorCallSite* site = PNSLR_Internal_GetTrackingAllocatorCallSite(record, location);
+    site->numAllocations++;
+    site->totalBytes += size;
+    site->liveBytes  += size;
+
+    record->numAllocations++;
+    record->totalBytes += size;
+}
+
+static void PNSLR_Internal_TrackResize(PNSLR_TrackingAllocatorPayload* payload, PNSLR_SourceCodeLocation location, i64 oldSize, i64 newSize)
+{
+    PNSLR_Internal_UpdateTrackingAllocatorLiveBytes(payload, newSize - oldSize);
+
+    PNSLR_TrackingAllocatorThreadRecord* record = PNSLR_Internal_GetTrackingAllocatorThreadRecord(payload, location);
+    if (!record) { return; }
+
+    PNSLR_TrackingAllocatorCallSite* site = PNSLR_Internal_GetTrackingAllocatorCallSite(record, location);
+    if (newSize > oldSize) { site->totalBytes += newSize - oldSize; record->totalBytes += newSize - oldSize; }
+    site->liveBytes += newSize - oldSize;
+    site->numResizes++;
+
+    record->numResizes++;
+}
+
+static void PNSLR_Internal_TrackFree(PNSLR_TrackingAllocatorPayload* payload, PNSLR_SourceCodeLocation location, i64 size)
+{
+    PNSLR_Internal_UpdateTrackingAllocatorLiveBytes(payload, -size);
+
+    PNSLR_TrackingAllocatorThreadRecord* record = PNSLR_Internal_GetTrackingAllocatorThreadRecord(payload, location);
+    if (!record) { return; }
+
+    PNSLR_TrackingAllocatorCallSite* site = PNSLR_Internal_GetTrackingAllocatorCallSite(record, location);
+    site->numFrees++;
+    site->liveBytes -= size;
+
+    record->numFrees++;
+}
+
+PNSLR_Allocator PNSLR_NewAllocator_Tracking(PNSLR_Allocator backingAllocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    PNSLR_TrackingAllocatorPayload* payload = PNSLR_Allocate(
+        backingAllocator,
+        true,
+        sizeof(PNSLR_TrackingAllocatorPayload),
+        alignof(PNSLR_TrackingAllocatorPayload),
+        location,
+        error
+    );
+
+    if (!payload) { return PNSLR_GetAllocator_Nil(); }
+
+    payload->backingAllocator = backingAllocator;
+    payload->recordsMutex     = PNSLR_CreateMutex();
+    payload->id               = PNSLR_AtomicFetchAddI64(&G_PNSLR_Internal_TrackingAllocatorNextId, 1) + 1; // never reused, so stale cache entries can't match
+
+    return (PNSLR_Allocator) {
+        .procedure = PNSLR_AllocatorFn_Tracking,
+        .data = payload
+    };
+}
+
+void PNSLR_DestroyAllocator_Tracking(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (!allocator.procedure || !allocator.data) { return; }
+    if (error) { *error = PNSLR_AllocatorError_None; } // No error by default
+
+    PNSLR_TrackingAllocatorPayload* payload = (PNSLR_TrackingAllocatorPayload*) allocator.data;
+
+    PNSLR_TrackingAllocatorThreadRecord* record = payload->records;
+    while (record)
+    {
+        PNSLR_TrackingAllocatorThreadRecord* next = record->next;
+        PNSLR_Free(payload->backingAllocator, record, location, nil);
+        record = next;
+    }
+
+    PNSLR_DestroyMutex(&payload->recordsMutex);
+    PNSLR_Free(payload->backingAllocator, payload, location, error);
+}
+
+rawptr PNSLR_AllocatorFn_Tracking(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    // clear error by default
+    if (error) { *error = PNSLR_AllocatorError_None; }
+
+    if (size < 0 )
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return nil; // Invalid size or alignment
+    }
+
+    // check alignment
+    if ((alignment < 1) || (alignment & (alignment - 1))) // if alignment is not a power of two
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+        return nil;
+    }
+
+    PNSLR_TrackingAllocatorPayload* payload = (PNSLR_TrackingAllocatorPayload*) allocatorData;
+    if (!payload) { return nil; }
+
+    switch (mode)
+    {
+        case PNSLR_AllocatorMode_Allocate:
+        case PNSLR_AllocatorMode_AllocateNoZero:
+        {
+            i64 offset = PNSLR_Internal_GetTrackingAllocationOffset(alignment);
+            u8* block  = PNSLR_Allocate(payload->backingAllocator, mode == PNSLR_AllocatorMode_Allocate, offset + size, PNSLR_Internal_GetTrackingBlockAlignment(alignment), location, error);
+            if (!block) { return nil; }
+
+            PNSLR_Internal_TrackingAllocationHeader* header = ((PNSLR_Internal_TrackingAllocationHeader*) (block + offset)) - 1;
+            *header = (PNSLR_Internal_TrackingAllocationHeader) {.location = location, .size = size, .offset = offset};
+
+            PNSLR_Internal_TrackAllocation(payload, location, size);
+            return block + offset;
+        }
+        case PNSLR_AllocatorMode_Resize:
+        case PNSLR_AllocatorMode_ResizeNoZero:
+        {
+            if (!oldMemory)
             {
-                // allocate a new page
-                PNSLR_StackAllocatorPage* newPage = PNSLR_Allocate(
-                    payload->backingAllocator,
-                    true,
-                    sizeof(PNSLR_StackAllocatorPage),
-                    alignof(PNSLR_StackAllocatorPage),
+                return PNSLR_AllocatorFn_Tracking(
+                    allocatorData,
+                    mode == PNSLR_AllocatorMode_Resize ? PNSLR_AllocatorMode_Allocate : PNSLR_AllocatorMode_AllocateNoZero,
+                    size,
+                    alignment,
+                    nil,
+                    0,
                     location,
                     error
                 );
-
-                if (!newPage)
-                {
-                    if (error) { *error = PNSLR_AllocatorError_OutOfMemory; }
-                    return nil; // Not enough space in the backing allocator
-                }
-
-                newPage->previousPage = payload->currentPage;
-                newPage->usedBytes    = 0;
-                payload->currentPage  = newPage;
-
-                usedBytesEndPtr              = (u64)(rawptr)(newPage->buffer);
-                usedBytesEndPtrHeaderAligned = (usedBytesEndPtr + headerAlignment - 1) & ~(u64)(headerAlignment - 1);
-                headerEndPtr                 = usedBytesEndPtrHeaderAligned + headerSize;
-                headerEndPtrAllocAligned     = (headerEndPtr + (u64) alignment - 1) & ~(u64)(alignment - 1);
-                allocEndPtr                  = headerEndPtrAllocAligned + (u64) size;
-                effectiveUsedBytes           = allocEndPtr - (u64)(rawptr)(payload->currentPage->buffer);
             }
 
-            PNSLR_StackAllocatorPage* pageToUse        = payload->currentPage;
-            pageToUse->usedBytes                       = effectiveUsedBytes;
-            PNSLR_StackAllocationHeader* header        = (PNSLR_StackAllocationHeader*) usedBytesEndPtrHeaderAligned;
-            rawptr                       tgtAllocation = (rawptr) headerEndPtrAllocAligned;
-
-            header->page                  = pageToUse;
-            header->size                  = size;
-            header->alignment             = alignment;
-            header->lastAllocation        = payload->lastAllocation;
-            header->lastAllocationHeader  = payload->lastAllocationHeader;
-            payload->lastAllocation       = tgtAllocation;
-            payload->lastAllocationHeader = (rawptr)header;
+            PNSLR_Internal_TrackingAllocationHeader old = *(((PNSLR_Internal_TrackingAllocationHeader*) oldMemory) - 1);
 
-            if (mode == PNSLR_AllocatorMode_Allocate)
+            i64 offset = PNSLR_Internal_GetTrackingAllocationOffset(alignment);
+            u8* block  = nil;
+            if (offset == old.offset)
             {
-                PNSLR_MemSet(tgtAllocation, 0, size); // Zero the memory if requested
+                // same layout, let the backing allocator resize in-place if it can
+                block = PNSLR_Resize(payload->backingAllocator, mode == PNSLR_AllocatorMode_Resize, (u8*) oldMemory - old.offset, old.offset + old.size, offset + size, PNSLR_Internal_GetTrackingBlockAlignment(alignment), location, error);
+                if (!block) { return nil; }
             }
+            else
+            {
+                block = PNSLR_Allocate(payload->backingAllocator, mode == PNSLR_AllocatorMode_Resize, offset + size, PNSLR_Internal_GetTrackingBlockAlignment(alignment), location, error);
+                if (!block) { return nil; }
 
-            return tgtAllocation;
-        }
-        case PNSLR_AllocatorMode_Resize:
-        case PNSLR_AllocatorMode_ResizeNoZero:
-        {
-            if (error) { *error = PNSLR_AllocatorError_InvalidMode; }
-            return nil; // Resizing breaks stack semantics
+                PNSLR_MemCopy(block + offset, oldMemory, old.size < size ? old.size : size);
+                PNSLR_Free(payload->backingAllocator, (u8*) oldMemory - old.offset, location, nil);
+            }
+
+            PNSLR_Internal_TrackingAllocationHeader* header = ((PNSLR_Internal_TrackingAllocationHeader*) (block + offset)) - 1;
+            *header = (PNSLR_Internal_TrackingAllocationHeader) {.location = old.location, .size = size, .offset = offset};
+
+            PNSLR_Internal_TrackResize(payload, old.location, old.size, size);
+            return block + offset;
         }
         case PNSLR_AllocatorMode_Free:
         {
@@ -796,127 +3536,306 @@ rawptr PNSLR_AllocatorFn_Stack(rawptr allocatorData, PNSLR_AllocatorMode mode, i
                 return nil;
             }
 
-            if (oldMemory != payload->lastAllocation)
-            {
-                if (error) { *error = PNSLR_AllocatorError_OutOfOrderFree; }
-                return nil; // Invalid free, not the last allocated memory
-            }
-
-            PNSLR_StackAllocationHeader* header = payload->lastAllocationHeader;
-            if (!header)
-            {
-                if (error) { *error = PNSLR_AllocatorError_DoubleFree; }
-                return nil; // Double free detected
-            }
+            PNSLR_Internal_TrackingAllocationHeader header = *(((PNSLR_Internal_TrackingAllocationHeader*) oldMemory) - 1);
+            PNSLR_Internal_TrackFree(payload, header.location, header.size);
 
-            if (!header->page)
-            {
-                if (error) { *error = PNSLR_AllocatorError_Internal; }
-                return nil; // Internal error, page should not be nil
-            }
+            PNSLR_Free(payload->backingAllocator, (u8*) oldMemory - header.offset, location, error);
+            return nil;
+        }
+        case PNSLR_AllocatorMode_FreeAll:
+        {
+            PNSLR_FreeAll(payload->backingAllocator, location, error);
+            if (error && *error != PNSLR_AllocatorError_None) { return nil; }
 
-            // find whether the header's page is even in the current page chain
+            // everything counts as freed, the allocator is expected not to be in use on other threads right now
+            PNSLR_LockMutex(&payload->recordsMutex);
+            for (PNSLR_TrackingAllocatorThreadRecord* record = payload->records; record; record = record->next)
             {
-                b8 found = false;
-                for (PNSLR_StackAllocatorPage* page = payload->currentPage; page; page = page->previousPage)
-                {
-                    if (page == header->page)
-                    {
-                        found = true;
-                        break;
-                    }
-                }
+                record->numFrees           = record->numAllocations;
+                record->overflow.numFrees  = record->overflow.numAllocations;
+                record->overflow.liveBytes = 0;
 
-                if (!found)
+                for (i32 i = 0; i < PNSLR_INTERNAL_TRACKING_MAX_CALL_SITES; ++i)
                 {
-                    if (error) { *error = PNSLR_AllocatorError_Internal; }
-                    return nil;
-                    // we've already confirmed that the allocation belongs to the current allocator
-                    // but if the allocation's page is not in the current page chain, it means that the allocator is in an invalid state
+                    record->callSites[i].numFrees  = record->callSites[i].numAllocations;
+                    record->callSites[i].liveBytes = 0;
                 }
             }
+            PNSLR_AtomicStoreI64(&payload->liveBytes, 0);
+            PNSLR_UnlockMutex(&payload->recordsMutex);
 
-            // free all the pages till the current allocation's page is reached
-            {
-                PNSLR_StackAllocatorPage* page = nil;
-                for (page = payload->currentPage; page != header->page; page = page->previousPage)
-                {
-                    if (!page)
-                    {
-                        if (error) { *error = PNSLR_AllocatorError_Internal; }
-                        return nil; // Internal error, page should not be nil
-                    }
+            return nil;
+        }
+        case PNSLR_AllocatorMode_QueryCapabilities:
+        {
+            u64 backingCapabilities = PNSLR_QueryAllocatorCapabilities(payload->backingAllocator, location, error);
+            return (rawptr)(
+                (backingCapabilities & (
+                    PNSLR_AllocatorCapability_ThreadSafe |
+                    PNSLR_AllocatorCapability_Resize |
+                    PNSLR_AllocatorCapability_Free |
+                    PNSLR_AllocatorCapability_FreeAll
+                )) |
+                PNSLR_AllocatorCapability_HintDebug
+            );
+        }
+        default:
+            if (error) { *error = PNSLR_AllocatorError_InvalidMode; }
+            return nil; // Unsupported mode.
+    }
+}
 
-                    PNSLR_Free(payload->backingAllocator, page, location, error);
-                    if (error && *error != PNSLR_AllocatorError_None) { return nil; } // Stop on error
-                }
+PNSLR_TrackingAllocatorStats PNSLR_GetTrackingAllocatorStats(PNSLR_Allocator allocator)
+{
+    if (allocator.procedure != PNSLR_AllocatorFn_Tracking || !allocator.data) { return (PNSLR_TrackingAllocatorStats) {0}; }
 
-                payload->currentPage = page; // set the current page to the page of the allocation being freed
-            }
+    PNSLR_TrackingAllocatorPayload* payload = (PNSLR_TrackingAllocatorPayload*) allocator.data;
 
-            payload->lastAllocation       = header->lastAllocation;
-            payload->lastAllocationHeader = header->lastAllocationHeader;
+    PNSLR_TrackingAllocatorStats output = {0};
+    output.liveBytes = PNSLR_AtomicLoadI64(&payload->liveBytes);
+    output.peakBytes = PNSLR_AtomicLoadI64(&payload->peakBytes);
 
-            u64 usedBytesTemp               = ((u64)(header)) - ((u64)(rawptr)((u8*)(payload->currentPage->buffer)));
-            if (usedBytesTemp > I32_MAX)
+    // records of threads still allocating may be mid-update, so this is only exact when things are quiet
+    PNSLR_LockMutex(&payload->recordsMutex);
+    for (PNSLR_TrackingAllocatorThreadRecord* record = payload->records; record; record = record->next)
+    {
+        output.numAllocations += record->numAllocations;
+        output.numFrees       += record->numFrees;
+        output.numResizes     += record->numResizes;
+        output.totalBytes     += record->totalBytes;
+        output.numThreads     += 1;
+    }
+    PNSLR_UnlockMutex(&payload->recordsMutex);
+
+    output.liveAllocations = output.numAllocations - output.numFrees;
+    return output;
+}
+
+static void PNSLR_Internal_MergeTrackingAllocatorCallSite(PNSLR_ArraySlice(PNSLR_TrackingAllocatorCallSite)* output, i64 capacity, const PNSLR_TrackingAllocatorCallSite* site)
+{
+    if (!site->numAllocations && !site->numFrees && !site->numResizes) { return; }
+
+    for (i64 i = 0; i < output->count; ++i)
+    {
+        PNSLR_TrackingAllocatorCallSite* existing = &output->data[i];
+        if (!PNSLR_Internal_AreTrackingCallSitesSame(existing->location, site->location)) { continue; }
+
+        existing->numAllocations += site->numAllocations;
+        existing->numFrees       += site->numFrees;
+        existing->numResizes     += site->numResizes;
+        existing->totalBytes     += site->totalBytes;
+        existing->liveBytes      += site->liveBytes;
+        return;
+    }
+
+    if (output->count < capacity) { output->data[output->count++] = *site; }
+}
+
+PNSLR_ArraySlice(PNSLR_TrackingAllocatorCallSite) PNSLR_GetTrackingAllocatorCallSites(PNSLR_Allocator allocator, PNSLR_Allocator outputAllocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    if (error) { *error = PNSLR_AllocatorError_None; }
+
+    PNSLR_ArraySlice(PNSLR_TrackingAllocatorCallSite) output = {0};
+    if (allocator.procedure != PNSLR_AllocatorFn_Tracking || !allocator.data) { return output; }
+
+    PNSLR_TrackingAllocatorPayload* payload = (PNSLR_TrackingAllocatorPayload*) allocator.data;
+
+    PNSLR_LockMutex(&payload->recordsMutex);
+
+    i64 capacity = 0;
+    for (PNSLR_TrackingAllocatorThreadRecord* record = payload->records; record; record = record->next)
+    {
+        capacity += record->numCallSites + 1;
+    }
+
+    if (capacity > 0)
+    {
+        output = PNSLR_MakeSlice(PNSLR_TrackingAllocatorCallSite, capacity, false, outputAllocator, location, error);
+        i64 allocatedCount = output.count; // threads still allocating can add call sites after it's computed
+        output.count = 0;
+
+        for (PNSLR_TrackingAllocatorThreadRecord* record = payload->records; record && output.data; record = record->next)
+        {
+            for (i32 i = 0; i < PNSLR_INTERNAL_TRACKING_MAX_CALL_SITES; ++i)
             {
-                if (error) { *error = PNSLR_AllocatorError_Internal; }
-                return nil; // Internal error, used bytes cannot be negative
+                PNSLR_Internal_MergeTrackingAllocatorCallSite(&output, allocatedCount, &record->callSites[i]);
             }
-            payload->currentPage->usedBytes = usedBytesTemp;
 
-            // clear the header to avoid double frees
-            header->page                  = nil;
-            header->size                  = 0;
-            header->alignment             = 0;
-            header->lastAllocation        = nil;
-            header->lastAllocationHeader  = nil;
+            PNSLR_Internal_MergeTrackingAllocatorCallSite(&output, allocatedCount, &record->overflow);
+        }
+    }
 
-            break;
+    PNSLR_UnlockMutex(&payload->recordsMutex);
+
+    // insertion sort, biggest live bytes first, then biggest total bytes
+    for (i64 i = 1; i < output.count; ++i)
+    {
+        PNSLR_TrackingAllocatorCallSite site = output.data[i];
+
+        i64 j = i - 1;
+        while (j >= 0 && (output.data[j].liveBytes < site.liveBytes || (output.data[j].liveBytes == site.liveBytes && output.data[j].totalBytes < site.totalBytes)))
+        {
+            output.data[j + 1] = output.data[j];
+            j--;
         }
-        case PNSLR_AllocatorMode_FreeAll:
+
+        output.data[j + 1] = site;
+    }
+
+    return output;
+}
+
+void PNSLR_ResetTrackingAllocatorPeak(PNSLR_Allocator allocator)
+{
+    if (allocator.procedure != PNSLR_AllocatorFn_Tracking || !allocator.data) { return; }
+
+    PNSLR_TrackingAllocatorPayload* payload = (PNSLR_TrackingAllocatorPayload*) allocator.data;
+    PNSLR_AtomicStoreI64(&payload->peakBytes, PNSLR_AtomicLoadI64(&payload->liveBytes));
+}
+
+#define PNSLR_INTERNAL_MAX_INTERNAL_ALLOCATORS 32
+
+static PNSLR_Internal_InternalAllocatorCounters* G_PNSLR_Internal_InternalAllocatorRegistry[PNSLR_INTERNAL_MAX_INTERNAL_ALLOCATORS] = {0};
+static i64                                       G_PNSLR_Internal_InternalAllocatorRegistryCount                                  = 0;
+
+void PNSLR_Internal_RegisterInternalAllocator(PNSLR_Internal_InternalAllocatorCounters* counters)
+{
+    if (!counters) { return; }
+
+    i64 expected = 0;
+    if (!PNSLR_AtomicCompareExchangeI64(&counters->registered, &expected, 1)) { return; } // already registered
+
+    i64 slot = PNSLR_AtomicFetchAddI64(&G_PNSLR_Internal_InternalAllocatorRegistryCount, 1);
+    if (slot >= PNSLR_INTERNAL_MAX_INTERNAL_ALLOCATORS) { FORCE_DBG_TRAP; return; }
+
+    PNSLR_AtomicStorePtr((rawptr*) &G_PNSLR_Internal_InternalAllocatorRegistry[slot], counters);
+}
+
+// each overflow block is prefixed by a header recording its size, so frees can be counted too
+typedef struct PNSLR_Internal_InternalOverflowHeader
+{
+    i64 size;
+    i64 offset; // from the start of the underlying allocation
+} PNSLR_Internal_InternalOverflowHeader;
+
+rawptr PNSLR_Internal_AllocatorFn_InternalOverflow(rawptr allocatorData, PNSLR_AllocatorMode mode, i64 size, i32 alignment, rawptr oldMemory, i64 oldSize, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
+{
+    // clear error by default
+    if (error) { *error = PNSLR_AllocatorError_None; }
+
+    if (size < 0)
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidSize; }
+        return nil;
+    }
+
+    // check alignment
+    if ((alignment < 1) || (alignment & (alignment - 1))) // if alignment is not a power of two
+    {
+        if (error) { *error = PNSLR_AllocatorError_InvalidAlignment; }
+        return nil;
+    }
+
+    PNSLR_Internal_InternalAllocatorCounters* counters = (PNSLR_Internal_InternalAllocatorCounters*) allocatorData;
+    if (!counters)
+    {
+        if (error) { *error = PNSLR_AllocatorError_Internal; }
+        return nil;
+    }
+
+    PNSLR_Allocator heap = PNSLR_GetAllocator_DefaultHeap();
+
+    switch (mode)
+    {
+        case PNSLR_AllocatorMode_Allocate:
+        case PNSLR_AllocatorMode_AllocateNoZero:
         {
-            PNSLR_StackAllocatorPage* page = payload->currentPage;
-            while (page && page->previousPage)
-            {
-                PNSLR_StackAllocatorPage* prev = page->previousPage;
-                PNSLR_Free(payload->backingAllocator, page, location, error);
-                if (error && *error != PNSLR_AllocatorError_None) { return nil; }
-                page = prev;
-            }
+            i32 headerAlignment = (alignment > (i32) sizeof(PNSLR_Internal_InternalOverflowHeader)) ? alignment : (i32) sizeof(PNSLR_Internal_InternalOverflowHeader);
+            u8* base            = (u8*) PNSLR_Allocate(heap, mode == PNSLR_AllocatorMode_Allocate, size + headerAlignment, headerAlignment, location, error);
+            if (!base) { return nil; }
 
-            payload->lastAllocation       = nil;
-            payload->lastAllocationHeader = nil;
-            payload->currentPage          = page;
-            if (page)
-            {
-                page->previousPage = nil;
-                page->usedBytes    = 0;
-            }
+            u8* memory = base + headerAlignment;
+            PNSLR_Internal_InternalOverflowHeader* header = ((PNSLR_Internal_InternalOverflowHeader*) memory) - 1;
+            header->size   = size;
+            header->offset = headerAlignment;
 
-            if (error) { *error = PNSLR_AllocatorError_None; }
+            PNSLR_AtomicFetchAddI64(&counters->stats.numOverflows, 1);
+            i64 overflowBytes = PNSLR_AtomicFetchAddI64(&counters->stats.overflowBytes, size) + size;
+
+            i64 peak = PNSLR_AtomicLoadI64(&counters->stats.peakOverflowBytes);
+            while (overflowBytes > peak && !PNSLR_AtomicCompareExchangeI64(&counters->stats.peakOverflowBytes, &peak, overflowBytes)) { }
+
+            return memory;
+        }
+        case PNSLR_AllocatorMode_Free:
+        {
+            if (!oldMemory) { return nil; }
+
+            PNSLR_Internal_InternalOverflowHeader* header = ((PNSLR_Internal_InternalOverflowHeader*) oldMemory) - 1;
+            PNSLR_AtomicFetchAddI64(&counters->stats.overflowBytes, -header->size);
+            PNSLR_Free(heap, ((u8*) oldMemory) - header->offset, location, error);
             return nil;
         }
         case PNSLR_AllocatorMode_QueryCapabilities:
         {
-            return (rawptr)(
-                PNSLR_AllocatorCapability_Free |
-                PNSLR_AllocatorCapability_FreeAll |
-                PNSLR_AllocatorCapability_HintBump
-            );
+            u64 capabilities = PNSLR_AllocatorCapability_ThreadSafe | PNSLR_AllocatorCapability_Free | PNSLR_AllocatorCapability_HintHeap;
+            return (rawptr) capabilities;
         }
         default:
+        {
             if (error) { *error = PNSLR_AllocatorError_InvalidMode; }
-            return nil; // Unsupported mode.
+            return nil;
+        }
     }
+}
 
-    return nil; // Should not reach here.
+i32 PNSLR_GetInternalAllocatorStats(PNSLR_ArraySlice(PNSLR_InternalAllocatorStats) output)
+{
+    i64 count = PNSLR_AtomicLoadI64(&G_PNSLR_Internal_InternalAllocatorRegistryCount);
+    count     = (count > PNSLR_INTERNAL_MAX_INTERNAL_ALLOCATORS) ? PNSLR_INTERNAL_MAX_INTERNAL_ALLOCATORS : count;
+
+    i32 numFound = 0;
+    for (i64 i = 0; i < count; i++)
+    {
+        PNSLR_Internal_InternalAllocatorCounters* counters = (PNSLR_Internal_InternalAllocatorCounters*) PNSLR_AtomicLoadPtr((rawptr*) &G_PNSLR_Internal_InternalAllocatorRegistry[i]);
+        if (!counters) { continue; } // slot claimed but not published yet
+
+        if (numFound < output.count && output.data)
+        {
+            output.data[numFound] = (PNSLR_InternalAllocatorStats)
+            {
+                .name              = counters->stats.name,
+                .staticCapacity    = counters->stats.staticCapacity,
+                .numOverflows      = PNSLR_AtomicLoadI64(&counters->stats.numOverflows),
+                .overflowBytes     = PNSLR_AtomicLoadI64(&counters->stats.overflowBytes),
+                .peakOverflowBytes = PNSLR_AtomicLoadI64(&counters->stats.peakOverflowBytes),
+            };
+        }
+
+        numFound++;
+    }
+
+    return numFound;
+}
+
+void PNSLR_ResetInternalAllocatorPeaks(void)
+{
+    i64 count = PNSLR_AtomicLoadI64(&G_PNSLR_Internal_InternalAllocatorRegistryCount);
+    count     = (count > PNSLR_INTERNAL_MAX_INTERNAL_ALLOCATORS) ? PNSLR_INTERNAL_MAX_INTERNAL_ALLOCATORS : count;
+
+    for (i64 i = 0; i < count; i++)
+    {
+        PNSLR_Internal_InternalAllocatorCounters* counters = (PNSLR_Internal_InternalAllocatorCounters*) PNSLR_AtomicLoadPtr((rawptr*) &G_PNSLR_Internal_InternalAllocatorRegistry[i]);
+        if (!counters) { continue; }
+
+        PNSLR_AtomicStoreI64(&counters->stats.peakOverflowBytes, PNSLR_AtomicLoadI64(&counters->stats.overflowBytes));
+    }
 }
 
 PNSLR_RawArraySlice PNSLR_MakeRawSlice(i32 tySize, i32 tyAlign, i64 count, b8 zeroed, PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
 {
     PNSLR_RawArraySlice output = {0};
-    output.data = PNSLR_Allocate(allocator, zeroed, tySize * (i32) count, tyAlign, location, error);
+    output.data = PNSLR_Allocate(allocator, zeroed, (i64) tySize * count, tyAlign, location, error);
     output.count = output.data ? count : 0;
     return output;
 }
@@ -931,7 +3850,7 @@ void PNSLR_FreeRawSlice(PNSLR_RawArraySlice* slice, PNSLR_Allocator allocator, P
 void PNSLR_ResizeRawSlice(PNSLR_RawArraySlice* slice, i32 tySize, i32 tyAlign, i64 newCount, b8 zeroed, PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
 {
     if (!slice) { return; }
-    slice->data = PNSLR_Resize(allocator, zeroed, slice->data, tySize * (i32) slice->count, tySize * (i32) newCount, tyAlign, location, error);
+    slice->data = PNSLR_Resize(allocator, zeroed, slice->data, (i64) tySize * slice->count, (i64) tySize * newCount, tyAlign, location, error);
     slice->count = slice->data ? newCount : 0;
 }
 
@@ -950,7 +3869,7 @@ void PNSLR_FreeString(utf8str str, PNSLR_Allocator allocator, PNSLR_SourceCodeLo
 
 cstring PNSLR_MakeCString(i64 count, b8 zeroed, PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
 {
-    return (cstring) PNSLR_Allocate(allocator, zeroed, (i32) (count + 1 /*for null term*/) * (i32) (sizeof(char)), (i32) (alignof(char)), location, error);
+    return (cstring) PNSLR_Allocate(allocator, zeroed, (count + 1 /*for null term*/) * (i64) (sizeof(char)), (i32) (alignof(char)), location, error);
 }
 
 void PNSLR_FreeCString(cstring str, PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location, PNSLR_AllocatorError* error)
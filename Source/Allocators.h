@@ -2,6 +2,7 @@
 #define PNSLR_ALLOCATORS_H
 #include "__Prelude.h"
 #include "Runtime.h"
+#include "Sync.h"
 EXTERN_C_BEGIN
 
 // Allocator Declaration ===========================================================
@@ -56,10 +57,10 @@ ENUM_END
 typedef rawptr (*PNSLR_AllocatorProcedure)(
     rawptr                   allocatorData,
     PNSLR_AllocatorMode      mode,
-    i32                      size,
+    i64                      size,
     i32                      alignment,
     rawptr                   oldMemory,
-    i32                      oldSize,
+    i64                      oldSize,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError*    error
 );
@@ -83,7 +84,7 @@ PNSLR_DECLARE_ARRAY_SLICE(PNSLR_Allocator);
 rawptr PNSLR_Allocate(
     PNSLR_Allocator allocator,
     b8  zeroed,
-    i32 size,
+    i64 size,
     i32 alignment,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError*    error OPT_ARG
@@ -96,8 +97,8 @@ rawptr PNSLR_Resize(
     PNSLR_Allocator allocator,
     b8     zeroed,
     rawptr oldMemory,
-    i32    oldSize,
-    i32    newSize,
+    i64    oldSize,
+    i64    newSize,
     i32    alignment,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError*    error OPT_ARG
@@ -110,8 +111,8 @@ rawptr PNSLR_DefaultResize(
     PNSLR_Allocator allocator,
     b8     zeroed,
     rawptr oldMemory,
-    i32    oldSize,
-    i32    newSize,
+    i64    oldSize,
+    i64    newSize,
     i32    alignment,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError*    error OPT_ARG
@@ -166,14 +167,44 @@ PNSLR_Allocator PNSLR_GetAllocator_DefaultHeap(void);
 rawptr PNSLR_AllocatorFn_DefaultHeap(
     rawptr                   allocatorData,
     PNSLR_AllocatorMode      mode,
-    i32                      size,
+    i64                      size,
     i32                      alignment,
     rawptr                   oldMemory,
-    i32                      oldSize,
+    i64                      oldSize,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError*    error
 );
 
+// Thread-Caching Heap Allocator ===================================================
+
+/**
+ * Get the thread-caching heap allocator.
+ * Small allocations are served from per-size-class caches local to each thread, refilled in
+ * batches from a shared central free list; large ones go straight to the OS.
+ * Memory fresh from the OS is already zeroed, so zeroed allocations only clear recycled blocks.
+ */
+PNSLR_Allocator PNSLR_GetAllocator_ThreadCachingHeap(void);
+
+/**
+ * Main allocator function for the thread-caching heap allocator.
+ */
+rawptr PNSLR_AllocatorFn_ThreadCachingHeap(
+    rawptr                   allocatorData,
+    PNSLR_AllocatorMode      mode,
+    i64                      size,
+    i32                      alignment,
+    rawptr                   oldMemory,
+    i64                      oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError*    error
+);
+
+/**
+ * Hand all the blocks cached by the calling thread back to the central free list.
+ * Threads started with `PNSLR_StartThread` do this automatically before exiting.
+ */
+void PNSLR_FlushThreadCachingHeapCache(void);
+
 // Arena Alloator ==================================================================
 
 /**
@@ -184,8 +215,8 @@ typedef struct PNSLR_ArenaAllocatorBlock
     struct PNSLR_ArenaAllocatorBlock* previous;
     PNSLR_Allocator                   allocator;
     rawptr                            memory;
-    u32                               capacity;
-    u32                               used;
+    u64                               capacity;
+    u64                               used;
 } PNSLR_ArenaAllocatorBlock;
 
 /**
@@ -195,9 +226,9 @@ typedef struct PNSLR_ArenaAllocatorPayload
 {
     PNSLR_Allocator            backingAllocator;
     PNSLR_ArenaAllocatorBlock* currentBlock;
-    u32                        totalUsed;
-    u32                        totalCapacity;
-    u32                        minimumBlockSize;
+    u64                        totalUsed;
+    u64                        totalCapacity;
+    u64                        minimumBlockSize;
     u32                        numSnapshots;
 } PNSLR_ArenaAllocatorPayload;
 
@@ -209,7 +240,7 @@ typedef struct PNSLR_ArenaAllocatorPayload
  */
 PNSLR_Allocator PNSLR_NewAllocator_Arena(
     PNSLR_Allocator backingAllocator,
-    u32 pageSize,
+    u64 pageSize,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError* error OPT_ARG
 );
@@ -230,10 +261,10 @@ void PNSLR_DestroyAllocator_Arena(
 rawptr PNSLR_AllocatorFn_Arena(
     rawptr                   allocatorData,
     PNSLR_AllocatorMode      mode,
-    i32                      size,
+    i64                      size,
     i32                      alignment,
     rawptr                   oldMemory,
-    i32                      oldSize,
+    i64                      oldSize,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError*    error
 );
@@ -255,7 +286,7 @@ typedef struct PNSLR_ArenaAllocatorSnapshot
     b8                           valid;
     PNSLR_ArenaAllocatorPayload* payload;
     PNSLR_ArenaAllocatorBlock*   block;
-    u32                          used;
+    u64                          used;
 } PNSLR_ArenaAllocatorSnapshot;
 
 /**
@@ -281,6 +312,266 @@ PNSLR_ArenaSnapshotError PNSLR_RestoreArenaAllocatorSnapshot(PNSLR_ArenaAllocato
  */
 PNSLR_ArenaSnapshotError PNSLR_DiscardArenaAllocatorSnapshot(PNSLR_ArenaAllocatorSnapshot* snapshot);
 
+// Virtual Arena Allocator =========================================================
+
+/**
+ * The payload used by the virtual arena allocator.
+ * Lives at the very start of its own reserved range, followed by the allocations.
+ */
+typedef struct PNSLR_VirtualArenaAllocatorPayload
+{
+    u8* memory;
+    i64 reserved;
+    i64 committed;
+    i64 used;
+    i32 pageSize;
+    u32 numSnapshots;
+} PNSLR_VirtualArenaAllocatorPayload;
+
+/**
+ * Create an arena allocator that reserves 'reserveSize' bytes of address space up-front and
+ * commits pages on demand, so all allocations live in one contiguous span. The last allocation
+ * can always be resized in place, and restoring a snapshot returns the tail pages to the OS.
+ */
+PNSLR_Allocator PNSLR_NewAllocator_VirtualArena(
+    i64 reserveSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error OPT_ARG
+);
+
+/**
+ * Destroy a virtual arena allocator and release its entire reserved range.
+ */
+void PNSLR_DestroyAllocator_VirtualArena(
+    PNSLR_Allocator allocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error OPT_ARG
+);
+
+/**
+ * Main allocator function for the virtual arena allocator.
+ */
+rawptr PNSLR_AllocatorFn_VirtualArena(
+    rawptr                   allocatorData,
+    PNSLR_AllocatorMode      mode,
+    i64                      size,
+    i32                      alignment,
+    rawptr                   oldMemory,
+    i64                      oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError*    error
+);
+
+/**
+ * A snapshot of the virtual arena allocator, recording its state at a specific point in time.
+ */
+typedef struct PNSLR_VirtualArenaAllocatorSnapshot
+{
+    b8                                  valid;
+    PNSLR_VirtualArenaAllocatorPayload* payload;
+    i64                                 used;
+} PNSLR_VirtualArenaAllocatorSnapshot;
+
+/**
+ * Ensures that the virtual arena allocator has either restored/discarded all the
+ * snapshots that were taken.
+ */
+b8 PNSLR_ValidateVirtualArenaAllocatorSnapshotState(PNSLR_Allocator allocator);
+
+/**
+ * Captures a snapshot of the virtual arena allocator.
+ */
+PNSLR_VirtualArenaAllocatorSnapshot PNSLR_CaptureVirtualArenaAllocatorSnapshot(PNSLR_Allocator allocator);
+
+/**
+ * Restores the state of the virtual arena allocator from a snapshot, decommitting the pages past it.
+ * Upon success, the snapshot is marked as invalid.
+ */
+PNSLR_ArenaSnapshotError PNSLR_RestoreVirtualArenaAllocatorSnapshot(PNSLR_VirtualArenaAllocatorSnapshot* snapshot, PNSLR_SourceCodeLocation loc);
+
+/**
+ * Discards a snapshot of the virtual arena allocator.
+ */
+PNSLR_ArenaSnapshotError PNSLR_DiscardVirtualArenaAllocatorSnapshot(PNSLR_VirtualArenaAllocatorSnapshot* snapshot);
+
+// Concurrent Arena Allocator ======================================================
+
+/**
+ * A block of memory used by the concurrent arena allocator.
+ * 'used' is bumped atomically and can overshoot 'capacity' once the block is full.
+ */
+typedef struct PNSLR_ConcurrentArenaAllocatorBlock
+{
+    struct PNSLR_ConcurrentArenaAllocatorBlock* previous;
+    u8*                                         memory;
+    i64                                         capacity;
+    i64                                         used;
+} PNSLR_ConcurrentArenaAllocatorBlock;
+
+/**
+ * The payload used by the concurrent arena allocator.
+ * Threads lease 'leaseSize' bytes at a time from the current block and bump-allocate
+ * from their lease without touching shared state; only new blocks take the lock.
+ */
+typedef struct PNSLR_ConcurrentArenaAllocatorPayload
+{
+    PNSLR_Allocator                      backingAllocator;
+    PNSLR_Mutex                          growthMutex;
+    PNSLR_ConcurrentArenaAllocatorBlock* currentBlock;
+    i64                                  minimumBlockSize;
+    i64                                  leaseSize;
+    i64                                  totalCapacity;
+    i64                                  id;
+    i64                                  generation; // bumped on FreeAll, invalidates all the leases
+} PNSLR_ConcurrentArenaAllocatorPayload;
+
+/**
+ * Create an arena allocator that many threads can allocate from at the same time.
+ * Blocks are at least 'blockSize' bytes, and each thread leases 'leaseSize' bytes
+ * (rounded up to a cache line) at a time; allocations bigger than half a lease go
+ * straight to the block. Individual frees are not supported, use a single FreeAll
+ * once no thread is allocating anymore (e.g. at the end of a frame).
+ * The backing allocator is only ever called under a lock.
+ */
+PNSLR_Allocator PNSLR_NewAllocator_ConcurrentArena(
+    PNSLR_Allocator backingAllocator,
+    i64 blockSize,
+    i32 leaseSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error OPT_ARG
+);
+
+/**
+ * Destroy a concurrent arena allocator and free all its resources.
+ * This does not free the backing allocator, only the arena allocator's own resources.
+ */
+void PNSLR_DestroyAllocator_ConcurrentArena(
+    PNSLR_Allocator allocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error OPT_ARG
+);
+
+/**
+ * Main allocator function for the concurrent arena allocator.
+ */
+rawptr PNSLR_AllocatorFn_ConcurrentArena(
+    rawptr                   allocatorData,
+    PNSLR_AllocatorMode      mode,
+    i64                      size,
+    i32                      alignment,
+    rawptr                   oldMemory,
+    i64                      oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError*    error
+);
+
+// Frame Allocator =================================================================
+
+/**
+ * A block of memory used by the frame allocator. Blocks are kept around and reused
+ * once their frame comes around again.
+ */
+typedef struct PNSLR_FrameAllocatorBlock
+{
+    struct PNSLR_FrameAllocatorBlock* next;
+    u8*                               memory;
+    i64                               capacity;
+    i64                               used;
+} PNSLR_FrameAllocatorBlock;
+
+/**
+ * One frame's worth of blocks in the frame allocator.
+ */
+typedef struct PNSLR_FrameAllocatorFrame
+{
+    PNSLR_FrameAllocatorBlock* firstBlock;
+    PNSLR_FrameAllocatorBlock* currentBlock;
+    i64                        used;
+    i64                        capacity;
+    i64                        highWaterMark; // of the last time this frame was used
+} PNSLR_FrameAllocatorFrame;
+
+/**
+ * The payload used by the frame allocator, a ring of up to 8 per-frame arenas.
+ */
+typedef struct PNSLR_FrameAllocatorPayload
+{
+    PNSLR_Allocator           backingAllocator;
+    PNSLR_FrameAllocatorFrame frames[8];
+    i64                       minimumBlockSize;
+    i64                       peakHighWaterMark;
+    u64                       frameIndex;
+    i32                       numFrames;
+    i32                       currentFrame;
+} PNSLR_FrameAllocatorPayload;
+
+/**
+ * Usage statistics for a frame allocator.
+ */
+typedef struct PNSLR_FrameAllocatorStats
+{
+    u64 frameIndex;
+    i64 usedBytes;         // in the current frame so far
+    i64 lastHighWaterMark; // of the previous frame
+    i64 peakHighWaterMark; // of any finished frame
+    i64 totalCapacity;     // across all the frames
+    i32 numFrames;
+} PNSLR_FrameAllocatorStats;
+
+/**
+ * Create a frame allocator: a ring of 'numFrames' (1 to 8) arenas, where memory allocated
+ * during a frame survives the next 'numFrames - 1' calls to `PNSLR_AdvanceFrameAllocator`,
+ * and is reclaimed by the 'numFrames'-th one.
+ * Blocks are at least 'blockSize' bytes, and are never handed back to the backing allocator
+ * until the frame allocator is destroyed.
+ * Individual frees are not supported.
+ */
+PNSLR_Allocator PNSLR_NewAllocator_Frame(
+    PNSLR_Allocator backingAllocator,
+    i32 numFrames,
+    i64 blockSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error OPT_ARG
+);
+
+/**
+ * Destroy a frame allocator and free all its resources.
+ * This does not free the backing allocator, only the frame allocator's own resources.
+ */
+void PNSLR_DestroyAllocator_Frame(
+    PNSLR_Allocator allocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error OPT_ARG
+);
+
+/**
+ * Main allocator function for the frame allocator.
+ * FreeAll resets every frame (keeping their blocks).
+ */
+rawptr PNSLR_AllocatorFn_Frame(
+    rawptr                   allocatorData,
+    PNSLR_AllocatorMode      mode,
+    i64                      size,
+    i32                      alignment,
+    rawptr                   oldMemory,
+    i64                      oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError*    error
+);
+
+/**
+ * Moves a frame allocator on to the next frame, resetting the oldest frame's arena
+ * (and so invalidating everything allocated 'numFrames' frames ago) for reuse.
+ * Returns the high-water mark of the frame that just ended.
+ */
+i64 PNSLR_AdvanceFrameAllocator(PNSLR_Allocator allocator);
+
+/**
+ * Get the current usage statistics of a frame allocator.
+ * Returns zeroed stats if the allocator is not a frame allocator.
+ */
+PNSLR_FrameAllocatorStats PNSLR_GetFrameAllocatorStats(PNSLR_Allocator allocator);
+
 // Stack Allocator =================================================================
 
 /**
@@ -300,7 +591,7 @@ typedef struct alignas(PNSLR_PTR_SIZE) PNSLR_StackAllocatorPage
 typedef struct PNSLR_StackAllocationHeader
 {
     PNSLR_StackAllocatorPage* page;
-    i32                       size;
+    i64                       size;
     i32                       alignment;
     rawptr                    lastAllocation;
     rawptr                    lastAllocationHeader;
@@ -345,14 +636,446 @@ void PNSLR_DestroyAllocator_Stack(
 rawptr PNSLR_AllocatorFn_Stack(
     rawptr                   allocatorData,
     PNSLR_AllocatorMode      mode,
-    i32                      size,
+    i64                      size,
+    i32                      alignment,
+    rawptr                   oldMemory,
+    i64                      oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError*    error
+);
+
+// Pool Allocator ==================================================================
+
+/**
+ * A chunk of fixed-size slots owned by the pool allocator.
+ * Slots are handed out from the chunk in order before they're ever recycled via the free list.
+ */
+typedef struct PNSLR_PoolAllocatorChunk
+{
+    struct PNSLR_PoolAllocatorChunk* previous;
+    rawptr                           slots;
+    i32                              slotsCount;
+    i32                              slotsTouched;
+} PNSLR_PoolAllocatorChunk;
+
+/**
+ * The payload used by the pool allocator.
+ * Freed slots are threaded into an intrusive singly-linked list, so both allocation and free are O(1).
+ */
+typedef struct PNSLR_PoolAllocatorPayload
+{
+    PNSLR_Allocator           backingAllocator;
+    PNSLR_PoolAllocatorChunk* currentChunk;
+    rawptr                    freeList;
+    i32                       slotSize;
+    i32                       slotAlignment;
+    i32                       slotStride;
+    i32                       slotsPerChunk;
+    i64                       numSlotsUsed;
+    i64                       numSlotsTotal;
+} PNSLR_PoolAllocatorPayload;
+
+/**
+ * Create a pool allocator that hands out slots of up to 'slotSize' bytes, aligned to
+ * 'slotAlignment', growing 'slotsPerChunk' slots at a time from the backing allocator.
+ * The pool allocator will not free the backing allocator, so it is the caller's responsibility to
+ * free the backing allocator when it is no longer needed.
+ */
+PNSLR_Allocator PNSLR_NewAllocator_Pool(
+    PNSLR_Allocator backingAllocator,
+    i32 slotSize,
+    i32 slotAlignment,
+    i32 slotsPerChunk,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error OPT_ARG
+);
+
+/**
+ * Destroy a pool allocator and free all its resources.
+ * This does not free the backing allocator, only the pool allocator's own resources.
+ */
+void PNSLR_DestroyAllocator_Pool(
+    PNSLR_Allocator allocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error OPT_ARG
+);
+
+/**
+ * Main allocator function for the pool allocator.
+ */
+rawptr PNSLR_AllocatorFn_Pool(
+    rawptr                   allocatorData,
+    PNSLR_AllocatorMode      mode,
+    i64                      size,
+    i32                      alignment,
+    rawptr                   oldMemory,
+    i64                      oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError*    error
+);
+
+// Slab Allocator ==================================================================
+
+/**
+ * The header at the start of every slab of the slab allocator.
+ * Slabs are aligned to their own size, so any object can find its slab by masking its address.
+ * Allocations too big for any cache get a dedicated slab of their own, with a 'cacheIndex' of -1.
+ */
+typedef struct PNSLR_SlabAllocatorSlab
+{
+    struct PNSLR_SlabAllocatorSlab* next;
+    struct PNSLR_SlabAllocatorSlab* previous;
+    rawptr                          freeList;
+    i64                             capacity; // bytes available for objects
+    i32                             cacheIndex;
+    i32                             objectsCount;
+    i32                             objectsUsed;
+    i32                             objectsTouched;
+} PNSLR_SlabAllocatorSlab;
+
+/**
+ * A cache of slabs for one object size (a multiple of the cache line size),
+ * split into partially filled, full and completely empty slabs.
+ */
+typedef struct PNSLR_SlabAllocatorCache
+{
+    PNSLR_Mutex              mutex;
+    PNSLR_SlabAllocatorSlab* partialSlabs;
+    PNSLR_SlabAllocatorSlab* fullSlabs;
+    PNSLR_SlabAllocatorSlab* emptySlabs;
+    i64                      numObjectsUsed;
+    i32                      objectStride;
+    i32                      objectsPerSlab;
+    i32                      numSlabs;
+    i32                      numEmptySlabs;
+} PNSLR_SlabAllocatorCache;
+
+/**
+ * The payload used by the slab allocator, with one cache per 64-byte size step up to 2 KiB.
+ */
+typedef struct PNSLR_SlabAllocatorPayload
+{
+    PNSLR_Allocator          backingAllocator;
+    PNSLR_SlabAllocatorCache caches[32];
+    PNSLR_Mutex              largeSlabsMutex;
+    PNSLR_SlabAllocatorSlab* largeSlabs;
+    i64                      numLargeSlabs;
+    i32                      maxEmptySlabsPerCache;
+} PNSLR_SlabAllocatorPayload;
+
+/**
+ * Usage statistics for a slab allocator.
+ */
+typedef struct PNSLR_SlabAllocatorStats
+{
+    i64 numObjectsUsed; // across all the caches
+    i64 numSlabs;       // including empty ones, excluding large allocations
+    i64 numEmptySlabs;
+    i64 numLargeSlabs;
+    i64 reservedBytes;  // from the backing allocator, including large allocations
+} PNSLR_SlabAllocatorStats;
+
+/**
+ * Create a thread-safe slab allocator, meant for small, frequently allocated structs.
+ * Objects up to 2 KiB are served from 64 KiB slabs, one cache per 64-byte size step, and are
+ * always aligned to (and padded out to) the cache line, so neighbouring objects handed out to
+ * different threads never share one. Each cache keeps up to 'maxEmptySlabsPerCache' completely
+ * empty slabs around for reuse before handing any back to the backing allocator.
+ * The backing allocator must honour 64 KiB alignment.
+ */
+PNSLR_Allocator PNSLR_NewAllocator_Slab(
+    PNSLR_Allocator backingAllocator,
+    i32 maxEmptySlabsPerCache,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error OPT_ARG
+);
+
+/**
+ * Destroy a slab allocator and free all its resources.
+ * This does not free the backing allocator, only the slab allocator's own resources.
+ */
+void PNSLR_DestroyAllocator_Slab(
+    PNSLR_Allocator allocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error OPT_ARG
+);
+
+/**
+ * Main allocator function for the slab allocator.
+ */
+rawptr PNSLR_AllocatorFn_Slab(
+    rawptr                   allocatorData,
+    PNSLR_AllocatorMode      mode,
+    i64                      size,
+    i32                      alignment,
+    rawptr                   oldMemory,
+    i64                      oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError*    error
+);
+
+/**
+ * Hand every completely empty slab of a slab allocator back to its backing allocator.
+ */
+void PNSLR_TrimSlabAllocator(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation location);
+
+/**
+ * Get the current usage statistics of a slab allocator.
+ * Returns zeroed stats if the allocator is not a slab allocator.
+ */
+PNSLR_SlabAllocatorStats PNSLR_GetSlabAllocatorStats(PNSLR_Allocator allocator);
+
+// Buddy Allocator =================================================================
+
+/**
+ * The header written into every free block of the buddy allocator,
+ * linking it into the free list for its order.
+ */
+typedef struct PNSLR_BuddyAllocatorFreeBlock
+{
+    struct PNSLR_BuddyAllocatorFreeBlock* previous;
+    struct PNSLR_BuddyAllocatorFreeBlock* next;
+} PNSLR_BuddyAllocatorFreeBlock;
+
+/**
+ * The payload used by the buddy allocator.
+ * Block 'order' N is 'minBlockSize << N' bytes; the whole region is a single block of the highest order.
+ */
+typedef struct PNSLR_BuddyAllocatorPayload
+{
+    PNSLR_Allocator                backingAllocator;
+    rawptr                         memory;
+    u8*                            blockStates;    // one per min-sized block, only meaningful at block starts
+    i64*                           requestedSizes; // one per min-sized block, only meaningful at allocated block starts
+    i64                            regionSize;
+    i32                            minBlockSize;
+    i32                            minBlockShift;
+    i32                            numOrders;
+    i32                            numAllocations;
+    i32                            numFreeBlocks;
+    i64                            usedBytes;
+    i64                            requestedBytes;
+    PNSLR_BuddyAllocatorFreeBlock* freeLists[32];
+} PNSLR_BuddyAllocatorPayload;
+
+/**
+ * Usage/fragmentation statistics for a buddy allocator.
+ * 'usedBytes - requestedBytes' is the internal fragmentation (rounding up to power-of-two blocks),
+ * and 'freeBytes - largestFreeBlock' is the free memory that can't be handed out in one piece.
+ */
+typedef struct PNSLR_BuddyAllocatorStats
+{
+    i64 totalBytes;
+    i64 usedBytes;
+    i64 requestedBytes;
+    i64 freeBytes;
+    i64 largestFreeBlock;
+    i32 numAllocations;
+    i32 numFreeBlocks;
+} PNSLR_BuddyAllocatorStats;
+
+/**
+ * Create a buddy allocator over a single region of 'regionSize' bytes (rounded up to a power of two)
+ * reserved from the backing allocator up-front. Blocks are never smaller than 'minBlockSize'
+ * (also a power of two), and allocations can't be aligned beyond it.
+ * The buddy allocator will not free the backing allocator, so it is the caller's responsibility to
+ * free the backing allocator when it is no longer needed.
+ */
+PNSLR_Allocator PNSLR_NewAllocator_Buddy(
+    PNSLR_Allocator backingAllocator,
+    i64 regionSize,
+    i32 minBlockSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error OPT_ARG
+);
+
+/**
+ * Destroy a buddy allocator and free all its resources.
+ * This does not free the backing allocator, only the buddy allocator's own resources.
+ */
+void PNSLR_DestroyAllocator_Buddy(
+    PNSLR_Allocator allocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error OPT_ARG
+);
+
+/**
+ * Main allocator function for the buddy allocator.
+ */
+rawptr PNSLR_AllocatorFn_Buddy(
+    rawptr                   allocatorData,
+    PNSLR_AllocatorMode      mode,
+    i64                      size,
+    i32                      alignment,
+    rawptr                   oldMemory,
+    i64                      oldSize,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError*    error
+);
+
+/**
+ * Get the current usage/fragmentation statistics of a buddy allocator.
+ * Returns zeroed stats if the allocator is not a buddy allocator.
+ */
+PNSLR_BuddyAllocatorStats PNSLR_GetBuddyAllocatorStats(PNSLR_Allocator allocator);
+
+// Tracking Allocator ==============================================================
+
+/**
+ * Allocation statistics for a single call site (file:line) of a tracking allocator.
+ * 'liveBytes' can go negative in a per-thread record if the memory was freed on a
+ * different thread than the one that allocated it; the merged totals are exact.
+ */
+typedef struct PNSLR_TrackingAllocatorCallSite
+{
+    PNSLR_SourceCodeLocation location;
+    i64                      numAllocations;
+    i64                      numFrees;
+    i64                      numResizes;
+    i64                      totalBytes;
+    i64                      liveBytes;
+} PNSLR_TrackingAllocatorCallSite;
+
+PNSLR_DECLARE_ARRAY_SLICE(PNSLR_TrackingAllocatorCallSite);
+
+/**
+ * The per-thread record of a tracking allocator. Only the owning thread ever writes
+ * to it, so recording an allocation doesn't need a lock.
+ * Call sites past the capacity of the table are accumulated into 'overflow'.
+ */
+typedef struct PNSLR_TrackingAllocatorThreadRecord
+{
+    struct PNSLR_TrackingAllocatorThreadRecord* next;
+    rawptr                                      owner;
+    i64                                         numAllocations;
+    i64                                         numFrees;
+    i64                                         numResizes;
+    i64                                         totalBytes;
+    i32                                         numCallSites;
+    PNSLR_TrackingAllocatorCallSite             overflow;
+    PNSLR_TrackingAllocatorCallSite             callSites[256];
+} PNSLR_TrackingAllocatorThreadRecord;
+
+/**
+ * The payload used by the tracking allocator.
+ * Live/peak bytes are kept up to date atomically, everything else lives in the per-thread records.
+ */
+typedef struct PNSLR_TrackingAllocatorPayload
+{
+    PNSLR_Allocator                      backingAllocator;
+    PNSLR_Mutex                          recordsMutex;
+    PNSLR_TrackingAllocatorThreadRecord* records;
+    i64                                  id;
+    i64                                  liveBytes;
+    i64                                  peakBytes;
+} PNSLR_TrackingAllocatorPayload;
+
+/**
+ * Overall statistics of a tracking allocator, merged across all threads.
+ */
+typedef struct PNSLR_TrackingAllocatorStats
+{
+    i64 liveBytes;
+    i64 peakBytes;
+    i64 liveAllocations;
+    i64 numAllocations;
+    i64 numFrees;
+    i64 numResizes;
+    i64 totalBytes;
+    i32 numThreads;
+} PNSLR_TrackingAllocatorStats;
+
+/**
+ * Create a tracking allocator that forwards to 'backingAllocator', recording live/peak
+ * bytes, allocation counts and per call site histograms from the source code locations
+ * passed to every allocator call.
+ * Every allocation carries a small header, so memory must be freed through the tracking
+ * allocator, and resizes only stay in-place if the backing allocator supports it.
+ */
+PNSLR_Allocator PNSLR_NewAllocator_Tracking(
+    PNSLR_Allocator backingAllocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error OPT_ARG
+);
+
+/**
+ * Destroy a tracking allocator and its records.
+ * This does not free any allocations still live in the backing allocator.
+ */
+void PNSLR_DestroyAllocator_Tracking(
+    PNSLR_Allocator allocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error OPT_ARG
+);
+
+/**
+ * Main allocator function for the tracking allocator.
+ */
+rawptr PNSLR_AllocatorFn_Tracking(
+    rawptr                   allocatorData,
+    PNSLR_AllocatorMode      mode,
+    i64                      size,
     i32                      alignment,
     rawptr                   oldMemory,
-    i32                      oldSize,
+    i64                      oldSize,
     PNSLR_SourceCodeLocation location,
     PNSLR_AllocatorError*    error
 );
 
+/**
+ * Get the current statistics of a tracking allocator.
+ * Returns zeroed stats if the allocator is not a tracking allocator.
+ */
+PNSLR_TrackingAllocatorStats PNSLR_GetTrackingAllocatorStats(PNSLR_Allocator allocator);
+
+/**
+ * Get the call sites recorded by a tracking allocator, merged across threads and
+ * sorted by live bytes (then total bytes), largest first.
+ * The slice is allocated from 'outputAllocator'.
+ */
+PNSLR_ArraySlice(PNSLR_TrackingAllocatorCallSite) PNSLR_GetTrackingAllocatorCallSites(
+    PNSLR_Allocator allocator,
+    PNSLR_Allocator outputAllocator,
+    PNSLR_SourceCodeLocation location,
+    PNSLR_AllocatorError* error OPT_ARG
+);
+
+/**
+ * Reset the peak bytes of a tracking allocator to its current live bytes.
+ * Useful for measuring the peak within a single frame.
+ */
+void PNSLR_ResetTrackingAllocatorPeak(PNSLR_Allocator allocator);
+
+// Internal Allocators =============================================================
+
+/**
+ * Usage statistics of one of the library's internal scratch arenas (strings, paths, etc.).
+ * Each thread gets a fixed static buffer of 'staticCapacity' bytes, and overflows into
+ * blocks from the default heap once that runs out; those are released again as soon as
+ * the operation that needed them is done. Counters are summed across threads.
+ */
+typedef struct PNSLR_InternalAllocatorStats
+{
+    utf8str name;
+    i64     staticCapacity;    // per thread
+    i64     numOverflows;      // number of heap blocks allocated because the static buffer ran out
+    i64     overflowBytes;     // bytes currently held in heap blocks
+    i64     peakOverflowBytes; // largest value 'overflowBytes' has reached
+} PNSLR_InternalAllocatorStats;
+
+PNSLR_DECLARE_ARRAY_SLICE(PNSLR_InternalAllocatorStats);
+
+/**
+ * Fill 'output' with the statistics of the internal arenas used so far (by any thread),
+ * and return how many there are; which may be more than 'output' could hold.
+ */
+i32 PNSLR_GetInternalAllocatorStats(PNSLR_ArraySlice(PNSLR_InternalAllocatorStats) output);
+
+/**
+ * Reset the peak overflow bytes of all internal arenas to their current overflow bytes.
+ */
+void PNSLR_ResetInternalAllocatorPeaks(void);
+
 // Collections make/free functions =================================================
 
 /**
@@ -446,7 +1169,7 @@ EXTERN_C_END
     {
         template <typename T> T* NewT(PNSLR_Allocator allocator, PNSLR_SourceCodeLocation loc, PNSLR_AllocatorError* err = nil)
         {
-            return (T*) PNSLR_Allocate(allocator, true, (i32) sizeof(T), (i32) alignof(T), loc, err);
+            return (T*) PNSLR_Allocate(allocator, true, (i64) sizeof(T), (i32) alignof(T), loc, err);
         }
 
         template <typename T> void DeleteT(T* obj, PNSLR_Allocator allocator, PNSLR_SourceCodeLocation loc, PNSLR_AllocatorError* err = nil)
@@ -554,6 +1277,33 @@ EXTERN_C_BEGIN
 
 #ifdef PNSLR_IMPLEMENTATION
 
+    typedef struct PNSLR_Internal_InternalAllocatorCounters
+    {
+        PNSLR_InternalAllocatorStats stats;
+        i64                          registered;
+    } PNSLR_Internal_InternalAllocatorCounters;
+
+    /**
+     * Backing allocator for the overflow blocks of internal arenas.
+     * Forwards to the default heap, and updates the counters passed as 'allocatorData'.
+     */
+    rawptr PNSLR_Internal_AllocatorFn_InternalOverflow(
+        rawptr                   allocatorData,
+        PNSLR_AllocatorMode      mode,
+        i64                      size,
+        i32                      alignment,
+        rawptr                   oldMemory,
+        i64                      oldSize,
+        PNSLR_SourceCodeLocation location,
+        PNSLR_AllocatorError*    error
+    );
+
+    /**
+     * Make the counters of an internal arena visible to `PNSLR_GetInternalAllocatorStats`.
+     * Only the first call for a given set of counters does anything.
+     */
+    void PNSLR_Internal_RegisterInternalAllocator(PNSLR_Internal_InternalAllocatorCounters* counters);
+
     #define PNSLR_CREATE_INTERNAL_ARENA_ALLOCATOR(name, pageSizeInKilobytes) \
         typedef struct alignas(16) PNSLR_Internal_##name##InternalAllocatorBuffer \
         { \
@@ -570,11 +1320,21 @@ EXTERN_C_BEGIN
         \
         static thread_local PNSLR_Internal_##name##InternalAllocatorInfo G_PNSLR_Internal_##name##InternalAllocatorInfo = {0}; \
         \
+        static PNSLR_Internal_InternalAllocatorCounters G_PNSLR_Internal_##name##InternalAllocatorCounters = \
+        { \
+            .stats = \
+            { \
+                {.count = sizeof(#name) - 1, .data = (u8*) #name}, /* name */ \
+                pageSizeInKilobytes * 1024,                        /* staticCapacity */ \
+            }, \
+        }; \
+        \
         static PNSLR_Allocator PNSLR_Internal_Acquire##name##InternalAllocator(void) \
         { \
             if (!G_PNSLR_Internal_##name##InternalAllocatorInfo.initialised) \
             { \
                 G_PNSLR_Internal_##name##InternalAllocatorInfo.initialised = true; \
+                PNSLR_Internal_RegisterInternalAllocator(&G_PNSLR_Internal_##name##InternalAllocatorCounters); \
                 \
                 G_PNSLR_Internal_##name##InternalAllocatorInfo.buffer = (PNSLR_Internal_##name##InternalAllocatorBuffer) {0}; \
                 \
@@ -589,11 +1349,11 @@ EXTERN_C_BEGIN
                 \
                 G_PNSLR_Internal_##name##InternalAllocatorInfo.arenaPayload = (PNSLR_ArenaAllocatorPayload) \
                 { \
-                    .backingAllocator    = PNSLR_GetAllocator_Nil(), \
+                    .backingAllocator    = (PNSLR_Allocator) {.procedure = PNSLR_Internal_AllocatorFn_InternalOverflow, .data = &G_PNSLR_Internal_##name##InternalAllocatorCounters}, \
                     .currentBlock        = &G_PNSLR_Internal_##name##InternalAllocatorInfo.arenaBlock, \
                     .totalUsed           = 0, \
                     .totalCapacity       = sizeof(G_PNSLR_Internal_##name##InternalAllocatorInfo.buffer.data), \
-                    .minimumBlockSize    = 0, \
+                    .minimumBlockSize    = sizeof(G_PNSLR_Internal_##name##InternalAllocatorInfo.buffer.data), /* overflow blocks are at least as big as the static one */ \
                     .numSnapshots        = 0, \
                 }; \
             } \
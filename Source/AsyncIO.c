@@ -0,0 +1,631 @@
+#define PNSLR_IMPLEMENTATION
+#include "AsyncIO.h"
+#include "Sync.h"
+#include "Threads.h"
+#include "Memory.h"
+
+// io_uring needs IORING_OP_READ/WRITE, which came with the same kernel (5.6) as this feature flag
+#if PNSLR_LINUX && defined(IORING_FEAT_RW_CUR_POS)
+    #define PNSLR_INTERNAL_ASYNC_IO_URING 1
+#else
+    #define PNSLR_INTERNAL_ASYNC_IO_URING 0
+#endif
+
+#define PNSLR_INTERNAL_ASYNC_IO_DEFAULT_WORKERS (4)
+#define PNSLR_INTERNAL_ASYNC_IO_MAX_CHUNK       (1 << 30) // per syscall, so lengths always fit in 32 bits
+#define PNSLR_INTERNAL_ASYNC_IO_CANCEL_TAG      (~0ULL)   // user data of io_uring's own cancel requests
+
+// one per request in flight; the tag (generation in the high half, index in the low half) is what
+// io_uring gets as user data, so a stale cancel can never hit a slot that has since been reused
+typedef struct PNSLR_Internal_AsyncIOSlot
+{
+    PNSLR_AsyncIORequest request;
+    i64                  transferred;
+    u32                  generation;
+    b8                   inUse;
+    b8                   cancelled;
+} PNSLR_Internal_AsyncIOSlot;
+
+#if PNSLR_INTERNAL_ASYNC_IO_URING
+
+    typedef struct PNSLR_Internal_IoUring
+    {
+        i32                  fd;
+        u32*                 sqHead;
+        u32*                 sqTail;
+        u32*                 sqArray;
+        u32                  sqMask;
+        u32                  sqEntries;
+        struct io_uring_sqe* sqes;
+        u32*                 cqHead;
+        u32*                 cqTail;
+        u32                  cqMask;
+        struct io_uring_cqe* cqes;
+        rawptr               ringMemory;
+        i64                  ringSize;
+        i64                  sqesSize;
+    } PNSLR_Internal_IoUring;
+
+#endif
+
+typedef struct PNSLR_Internal_AsyncIOQueue
+{
+    PNSLR_Allocator             allocator;
+    PNSLR_AsyncIOBackend        backend;
+    i32                         capacity;
+    i32                         inFlight;     // only touched by the owning thread
+    PNSLR_Internal_AsyncIOSlot* slots;
+    i32*                        freeSlots;
+    i32                         numFreeSlots; // behind the mutex for the thread pool
+
+    // thread pool
+    PNSLR_Mutex                 mutex;
+    PNSLR_ConditionVariable     workAvailable;
+    PNSLR_ConditionVariable     completionAvailable;
+    i32*                        pending;      // ring of slot indices
+    i32                         pendingHead;
+    i32                         pendingCount;
+    PNSLR_AsyncIOCompletion*    completions;  // ring
+    i32                         completionsHead;
+    i32                         completionsCount;
+    PNSLR_ThreadHandle*         workers;
+    i32                         numWorkers;
+    b8                          shuttingDown;
+
+    #if PNSLR_INTERNAL_ASYNC_IO_URING
+        PNSLR_Internal_IoUring  ring;
+        i32                     numCancels;   // cancel entries whose completions haven't been reaped yet
+    #endif
+} PNSLR_Internal_AsyncIOQueue;
+
+// carries out a request with the blocking positional calls, which carry on through partial transfers themselves
+static b8 PNSLR_Internal_PerformAsyncIORequest(PNSLR_AsyncIORequest* request, i64* transferred)
+{
+    *transferred = 0;
+    if (request->operation == PNSLR_AsyncIOOperation_Flush) { return PNSLR_FlushFile(request->file); }
+    if (!request->buffer.count)                               { return true; } // nothing to transfer, same as with io_uring
+    if (!request->file.handle || request->offset < 0 || request->buffer.count < 0 || !request->buffer.data) { return false; }
+
+    if (request->operation == PNSLR_AsyncIOOperation_Write)
+    {
+        if (!PNSLR_WriteToFileAt(request->file, request->offset, request->buffer)) { return false; }
+        *transferred = request->buffer.count;
+        return true;
+    }
+
+    // a short read only counts as a failure if the OS reported an error, otherwise it just hit the end of the file
+    #if PNSLR_WINDOWS
+        SetLastError(ERROR_SUCCESS);
+    #elif PNSLR_UNIX
+        errno = 0;
+    #endif
+
+    if (PNSLR_ReadFromFileAt(request->file, request->offset, request->buffer, transferred)) { return true; }
+
+    #if PNSLR_WINDOWS
+        return GetLastError() == ERROR_HANDLE_EOF;
+    #elif PNSLR_UNIX
+        return errno == 0 || errno == EINTR; // interrupted calls get retried, so that's not what stopped it
+    #endif
+}
+
+static void PNSLR_Internal_AsyncIOWorker(rawptr data)
+{
+    PNSLR_Internal_AsyncIOQueue* q = (PNSLR_Internal_AsyncIOQueue*) data;
+
+    PNSLR_LockMutex(&q->mutex);
+    for (;;)
+    {
+        while (!q->pendingCount && !q->shuttingDown) { PNSLR_WaitConditionVariable(&q->workAvailable, &q->mutex); }
+        if (!q->pendingCount) { break; } // shutting down, and nothing left to do
+
+        i32 slotIdx     = q->pending[q->pendingHead];
+        q->pendingHead  = (q->pendingHead + 1) % q->capacity;
+        q->pendingCount--;
+
+        PNSLR_Internal_AsyncIOSlot* slot       = &q->slots[slotIdx];
+        PNSLR_AsyncIOCompletion     completion = {.userData = slot->request.userData, .status = PNSLR_AsyncIOStatus_Cancelled};
+        if (!slot->cancelled)
+        {
+            PNSLR_AsyncIORequest request = slot->request;
+
+            PNSLR_UnlockMutex(&q->mutex);
+            b8 success = PNSLR_Internal_PerformAsyncIORequest(&request, &completion.bytesTransferred);
+            PNSLR_LockMutex(&q->mutex);
+
+            completion.status = success ? PNSLR_AsyncIOStatus_Succeeded : PNSLR_AsyncIOStatus_Failed;
+        }
+
+        // completions never outnumber the requests in flight, so this never overflows
+        q->completions[(q->completionsHead + q->completionsCount) % q->capacity] = completion;
+        q->completionsCount++;
+
+        slot->inUse = false;
+        q->freeSlots[q->numFreeSlots++] = slotIdx;
+
+        PNSLR_SignalConditionVariable(&q->completionAvailable);
+    }
+    PNSLR_UnlockMutex(&q->mutex);
+}
+
+// caller has the mutex for the thread pool
+static i32 PNSLR_Internal_TakeAsyncIOSlot(PNSLR_Internal_AsyncIOQueue* q, PNSLR_AsyncIORequest request)
+{
+    if (!q->numFreeSlots) { return -1; }
+
+    i32                         slotIdx = q->freeSlots[--q->numFreeSlots];
+    PNSLR_Internal_AsyncIOSlot* slot    = &q->slots[slotIdx];
+    slot->request     = request;
+    slot->transferred = 0;
+    slot->generation++;
+    slot->inUse       = true;
+    slot->cancelled   = false;
+    return slotIdx;
+}
+
+static i32 PNSLR_Internal_PopAsyncIOCompletions(PNSLR_Internal_AsyncIOQueue* q, PNSLR_ArraySlice(PNSLR_AsyncIOCompletion) output)
+{
+    i32 numOutput = 0;
+    while (q->completionsCount && numOutput < output.count)
+    {
+        output.data[numOutput++] = q->completions[q->completionsHead];
+        q->completionsHead       = (q->completionsHead + 1) % q->capacity;
+        q->completionsCount--;
+    }
+
+    return numOutput;
+}
+
+#if PNSLR_INTERNAL_ASYNC_IO_URING
+
+    static i32 PNSLR_Internal_IoUringEnter(PNSLR_Internal_IoUring* ring, u32 toSubmit, u32 minComplete, u32 flags)
+    {
+        for (;;)
+        {
+            i64 res = syscall(__NR_io_uring_enter, ring->fd, toSubmit, minComplete, flags, nil, 0);
+            if (res >= 0 || errno != EINTR) { return (i32) res; }
+        }
+    }
+
+    static b8 PNSLR_Internal_CreateIoUring(PNSLR_Internal_IoUring* ring, u32 entries)
+    {
+        struct io_uring_params params;
+        PNSLR_MemSet(&params, 0, (i64) sizeof(params));
+
+        i32 fd = (i32) syscall(__NR_io_uring_setup, entries, &params);
+        if (fd < 0) { return false; }
+
+        u32 neededFeatures = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_RW_CUR_POS;
+        if ((params.features & neededFeatures) != neededFeatures) { close(fd); return false; }
+
+        i64 sqSize = (i64) params.sq_off.array + (i64) params.sq_entries * (i64) sizeof(u32);
+        i64 cqSize = (i64) params.cq_off.cqes  + (i64) params.cq_entries * (i64) sizeof(struct io_uring_cqe);
+        ring->ringSize = (sqSize > cqSize) ? sqSize : cqSize;
+        ring->sqesSize = (i64) params.sq_entries * (i64) sizeof(struct io_uring_sqe);
+
+        u8* mem = mmap(nil, (size_t) ring->ringSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if (mem == MAP_FAILED) { close(fd); return false; }
+
+        rawptr sqes = mmap(nil, (size_t) ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) { munmap(mem, (size_t) ring->ringSize); close(fd); return false; }
+
+        ring->fd         = fd;
+        ring->ringMemory = mem;
+        ring->sqHead     = (u32*) (mem + params.sq_off.head);
+        ring->sqTail     = (u32*) (mem + params.sq_off.tail);
+        ring->sqArray    = (u32*) (mem + params.sq_off.array);
+        ring->sqMask     = *(u32*) (mem + params.sq_off.ring_mask);
+        ring->sqEntries  = params.sq_entries;
+        ring->sqes       = (struct io_uring_sqe*) sqes;
+        ring->cqHead     = (u32*) (mem + params.cq_off.head);
+        ring->cqTail     = (u32*) (mem + params.cq_off.tail);
+        ring->cqMask     = *(u32*) (mem + params.cq_off.ring_mask);
+        ring->cqes       = (struct io_uring_cqe*) (mem + params.cq_off.cqes);
+        return true;
+    }
+
+    static void PNSLR_Internal_DestroyIoUring(PNSLR_Internal_IoUring* ring)
+    {
+        munmap(ring->sqes, (size_t) ring->sqesSize);
+        munmap(ring->ringMemory, (size_t) ring->ringSize);
+        close(ring->fd);
+    }
+
+    // fills in the next submission entry, or returns nil if the submission ring is full
+    static struct io_uring_sqe* PNSLR_Internal_GetIoUringSqe(PNSLR_Internal_IoUring* ring)
+    {
+        u32 tail = *ring->sqTail; // only ever written by us
+        u32 head = __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+        if (tail - head >= ring->sqEntries) { return nil; }
+
+        u32                  idx = tail & ring->sqMask;
+        struct io_uring_sqe* sqe = &ring->sqes[idx];
+        PNSLR_MemSet(sqe, 0, (i64) sizeof(*sqe));
+        ring->sqArray[idx] = idx;
+        return sqe;
+    }
+
+    static void PNSLR_Internal_CommitIoUringSqe(PNSLR_Internal_IoUring* ring)
+    {
+        __atomic_store_n(ring->sqTail, *ring->sqTail + 1, __ATOMIC_RELEASE);
+    }
+
+    static u32 PNSLR_Internal_NumUnsubmittedIoUringSqes(PNSLR_Internal_IoUring* ring)
+    {
+        return *ring->sqTail - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+    }
+
+    // like getting a submission entry, but hands whatever's queued up to the kernel first if the ring is full
+    static struct io_uring_sqe* PNSLR_Internal_GetIoUringSqeOrFlush(PNSLR_Internal_IoUring* ring)
+    {
+        struct io_uring_sqe* sqe = PNSLR_Internal_GetIoUringSqe(ring);
+        if (sqe) { return sqe; }
+
+        u32 toSubmit = PNSLR_Internal_NumUnsubmittedIoUringSqes(ring);
+        if (!toSubmit || PNSLR_Internal_IoUringEnter(ring, toSubmit, 0, 0) <= 0) { return nil; }
+        return PNSLR_Internal_GetIoUringSqe(ring);
+    }
+
+    // queues up (the rest of) a slot's request; the ring has twice as many entries as there can be
+    // requests in flight, with the other half kept for cancels, so this only fails if the kernel
+    // stops taking submissions altogether
+    static b8 PNSLR_Internal_QueueIoUringSlot(PNSLR_Internal_AsyncIOQueue* q, i32 slotIdx)
+    {
+        PNSLR_Internal_AsyncIOSlot* slot = &q->slots[slotIdx];
+        struct io_uring_sqe*        sqe  = PNSLR_Internal_GetIoUringSqeOrFlush(&q->ring);
+        if (!sqe) { return false; }
+
+        sqe->fd        = (i32) (i64) slot->request.file.handle;
+        sqe->user_data = ((u64) slot->generation << 32) | (u64) slotIdx;
+
+        if (slot->request.operation == PNSLR_AsyncIOOperation_Flush)
+        {
+            sqe->opcode = IORING_OP_FSYNC;
+        }
+        else if (!slot->request.buffer.count)
+        {
+            sqe->opcode = IORING_OP_NOP; // nothing to transfer, it only has to come back as a completion
+        }
+        else
+        {
+            i64 chunk = slot->request.buffer.count - slot->transferred;
+            if (chunk > PNSLR_INTERNAL_ASYNC_IO_MAX_CHUNK) { chunk = PNSLR_INTERNAL_ASYNC_IO_MAX_CHUNK; }
+
+            sqe->opcode = (slot->request.operation == PNSLR_AsyncIOOperation_Read) ? IORING_OP_READ : IORING_OP_WRITE;
+            sqe->off    = (u64) (slot->request.offset + slot->transferred);
+            sqe->addr   = (u64) (slot->request.buffer.data + slot->transferred);
+            sqe->len    = (u32) chunk;
+        }
+
+        PNSLR_Internal_CommitIoUringSqe(&q->ring);
+        return true;
+    }
+
+    // turns completion entries into completions, resubmitting whatever only partially transferred
+    static i32 PNSLR_Internal_ReapIoUring(PNSLR_Internal_AsyncIOQueue* q, PNSLR_ArraySlice(PNSLR_AsyncIOCompletion) output)
+    {
+        PNSLR_Internal_IoUring* ring = &q->ring;
+
+        i32 numOutput = 0;
+        u32 head      = *ring->cqHead;
+        u32 tail      = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+        while (head != tail && numOutput < output.count)
+        {
+            struct io_uring_cqe* cqe      = &ring->cqes[head & ring->cqMask];
+            u64                  userData = cqe->user_data;
+            i32                  res      = cqe->res;
+            head++;
+
+            if (userData == PNSLR_INTERNAL_ASYNC_IO_CANCEL_TAG) { q->numCancels--; continue; }
+
+            i32                         slotIdx = (i32) (u32) userData;
+            PNSLR_Internal_AsyncIOSlot* slot    = &q->slots[slotIdx];
+
+            PNSLR_AsyncIOStatus status = PNSLR_AsyncIOStatus_Succeeded;
+            if (res < 0)
+            {
+                status = (res == -ECANCELED) ? PNSLR_AsyncIOStatus_Cancelled : PNSLR_AsyncIOStatus_Failed;
+            }
+            else if (slot->request.operation != PNSLR_AsyncIOOperation_Flush && slot->request.buffer.count)
+            {
+                slot->transferred += res;
+
+                b8 isRead = (slot->request.operation == PNSLR_AsyncIOOperation_Read);
+                if (!res && !isRead) { status = PNSLR_AsyncIOStatus_Failed; }
+                else if (res && slot->transferred < slot->request.buffer.count)
+                {
+                    if (slot->cancelled)                                { status = PNSLR_AsyncIOStatus_Cancelled; }
+                    else if (PNSLR_Internal_QueueIoUringSlot(q, slotIdx)) { continue; } // not done yet
+                    else                                                { status = PNSLR_AsyncIOStatus_Failed; }
+                }
+            }
+
+            output.data[numOutput++] = (PNSLR_AsyncIOCompletion)
+            {
+                .userData         = slot->request.userData,
+                .bytesTransferred = slot->transferred,
+                .status           = status,
+            };
+
+            slot->inUse = false;
+            q->freeSlots[q->numFreeSlots++] = slotIdx;
+        }
+
+        __atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+
+        u32 toSubmit = PNSLR_Internal_NumUnsubmittedIoUringSqes(ring);
+        if (toSubmit) { PNSLR_Internal_IoUringEnter(ring, toSubmit, 0, 0); }
+
+        return numOutput;
+    }
+
+#endif
+
+PNSLR_AsyncIOQueue PNSLR_CreateAsyncIOQueue(PNSLR_Allocator allocator, i32 capacity, PNSLR_AsyncIOBackend backend, i32 numWorkerThreads)
+{
+    if (capacity <= 0) { return (PNSLR_AsyncIOQueue) {0}; }
+    if (numWorkerThreads <= 0) { numWorkerThreads = PNSLR_INTERNAL_ASYNC_IO_DEFAULT_WORKERS; }
+
+    #if !PNSLR_INTERNAL_ASYNC_IO_URING
+        if (backend == PNSLR_AsyncIOBackend_IoUring) { return (PNSLR_AsyncIOQueue) {0}; }
+    #endif
+
+    PNSLR_Internal_AsyncIOQueue* q = PNSLR_New(PNSLR_Internal_AsyncIOQueue, allocator, PNSLR_GET_LOC(), nil);
+    if (!q) { return (PNSLR_AsyncIOQueue) {0}; }
+
+    q->allocator = allocator;
+    q->capacity  = capacity;
+    q->slots     = PNSLR_Allocate(allocator, true, capacity * (i64) sizeof(PNSLR_Internal_AsyncIOSlot), (i32) alignof(PNSLR_Internal_AsyncIOSlot), PNSLR_GET_LOC(), nil);
+    q->freeSlots = PNSLR_Allocate(allocator, true, capacity * (i64) sizeof(i32), (i32) alignof(i32), PNSLR_GET_LOC(), nil);
+
+    b8 success = q->slots && q->freeSlots;
+    for (i32 i = 0; success && i < capacity; i++) { q->freeSlots[i] = capacity - 1 - i; }
+    q->numFreeSlots = capacity;
+
+    #if PNSLR_INTERNAL_ASYNC_IO_URING
+        if (success && backend != PNSLR_AsyncIOBackend_ThreadPool)
+        {
+            if (PNSLR_Internal_CreateIoUring(&q->ring, (u32) capacity * 2)) { q->backend = PNSLR_AsyncIOBackend_IoUring; }
+            else if (backend == PNSLR_AsyncIOBackend_IoUring)              { success = false; }
+        }
+    #endif
+
+    if (success && q->backend != PNSLR_AsyncIOBackend_IoUring)
+    {
+        q->backend             = PNSLR_AsyncIOBackend_ThreadPool;
+        q->mutex               = PNSLR_CreateMutex();
+        q->workAvailable       = PNSLR_CreateConditionVariable();
+        q->completionAvailable = PNSLR_CreateConditionVariable();
+        q->pending             = PNSLR_Allocate(allocator, false, capacity * (i64) sizeof(i32), (i32) alignof(i32), PNSLR_GET_LOC(), nil);
+        q->completions         = PNSLR_Allocate(allocator, false, capacity * (i64) sizeof(PNSLR_AsyncIOCompletion), (i32) alignof(PNSLR_AsyncIOCompletion), PNSLR_GET_LOC(), nil);
+        q->workers             = PNSLR_Allocate(allocator, true, numWorkerThreads * (i64) sizeof(PNSLR_ThreadHandle), (i32) alignof(PNSLR_ThreadHandle), PNSLR_GET_LOC(), nil);
+
+        success = q->pending && q->completions && q->workers;
+        for (i32 i = 0; success && i < numWorkerThreads; i++)
+        {
+            q->workers[i] = PNSLR_StartThread(PNSLR_Internal_AsyncIOWorker, q, PNSLR_StringLiteral("PNSLR_AsyncIO"));
+            if (PNSLR_IsThreadHandleValid(q->workers[i])) { q->numWorkers++; }
+            else                                          { success = false; }
+        }
+    }
+
+    PNSLR_AsyncIOQueue output = {.data = q};
+    if (!success) { PNSLR_DestroyAsyncIOQueue(&output); }
+    return output;
+}
+
+void PNSLR_DestroyAsyncIOQueue(PNSLR_AsyncIOQueue* queue)
+{
+    if (!queue || !queue->data) { return; }
+
+    PNSLR_Internal_AsyncIOQueue* q = (PNSLR_Internal_AsyncIOQueue*) queue->data;
+
+    if (q->backend == PNSLR_AsyncIOBackend_ThreadPool)
+    {
+        // the workers finish off whatever's pending before they stop
+        PNSLR_LockMutex(&q->mutex);
+        q->shuttingDown = true;
+        PNSLR_BroadcastConditionVariable(&q->workAvailable);
+        PNSLR_UnlockMutex(&q->mutex);
+
+        for (i32 i = 0; i < q->numWorkers; i++) { PNSLR_JoinThread(q->workers[i]); }
+
+        PNSLR_DestroyConditionVariable(&q->completionAvailable);
+        PNSLR_DestroyConditionVariable(&q->workAvailable);
+        PNSLR_DestroyMutex(&q->mutex);
+
+        if (q->workers)     { PNSLR_Free(q->allocator, q->workers,     PNSLR_GET_LOC(), nil); }
+        if (q->completions) { PNSLR_Free(q->allocator, q->completions, PNSLR_GET_LOC(), nil); }
+        if (q->pending)     { PNSLR_Free(q->allocator, q->pending,     PNSLR_GET_LOC(), nil); }
+    }
+
+    #if PNSLR_INTERNAL_ASYNC_IO_URING
+        if (q->backend == PNSLR_AsyncIOBackend_IoUring)
+        {
+            // the kernel may still be writing into the buffers, so everything has to land first;
+            // waiting only comes back empty-handed if the ring itself broke, and then closing it
+            // is what gets the kernel to cancel whatever's left
+            PNSLR_AsyncIOCompletion discarded[64];
+            while (q->inFlight > 0)
+            {
+                if (!PNSLR_WaitForAsyncIOCompletions(*queue, (PNSLR_ArraySlice(PNSLR_AsyncIOCompletion)) {.data = discarded, .count = 64}, 1)) { break; }
+            }
+
+            PNSLR_Internal_DestroyIoUring(&q->ring);
+        }
+    #endif
+
+    if (q->freeSlots) { PNSLR_Free(q->allocator, q->freeSlots, PNSLR_GET_LOC(), nil); }
+    if (q->slots)     { PNSLR_Free(q->allocator, q->slots,     PNSLR_GET_LOC(), nil); }
+    PNSLR_Free(q->allocator, q, PNSLR_GET_LOC(), nil);
+    queue->data = nil;
+}
+
+PNSLR_AsyncIOBackend PNSLR_GetAsyncIOQueueBackend(PNSLR_AsyncIOQueue queue)
+{
+    PNSLR_Internal_AsyncIOQueue* q = (PNSLR_Internal_AsyncIOQueue*) queue.data;
+    return q ? q->backend : PNSLR_AsyncIOBackend_Default;
+}
+
+i32 PNSLR_SubmitAsyncIORequests(PNSLR_AsyncIOQueue queue, PNSLR_ArraySlice(PNSLR_AsyncIORequest) requests)
+{
+    PNSLR_Internal_AsyncIOQueue* q = (PNSLR_Internal_AsyncIOQueue*) queue.data;
+    if (!q || !requests.data || requests.count <= 0) { return 0; }
+
+    // slots free up as soon as the work is done, but the capacity covers uncollected completions too
+    i64 numToSubmit = q->capacity - q->inFlight;
+    if (numToSubmit > requests.count) { numToSubmit = requests.count; }
+
+    i32 numSubmitted = 0;
+
+    #if PNSLR_INTERNAL_ASYNC_IO_URING
+        if (q->backend == PNSLR_AsyncIOBackend_IoUring)
+        {
+            while (numSubmitted < numToSubmit)
+            {
+                i32 slotIdx = PNSLR_Internal_TakeAsyncIOSlot(q, requests.data[numSubmitted]);
+                if (slotIdx < 0) { break; }
+
+                if (!PNSLR_Internal_QueueIoUringSlot(q, slotIdx))
+                {
+                    q->slots[slotIdx].inUse = false; // not taken, the caller can try again later
+                    q->freeSlots[q->numFreeSlots++] = slotIdx;
+                    break;
+                }
+
+                numSubmitted++;
+            }
+
+            // the whole batch goes to the kernel in one call
+            u32 toSubmit = PNSLR_Internal_NumUnsubmittedIoUringSqes(&q->ring);
+            if (toSubmit) { PNSLR_Internal_IoUringEnter(&q->ring, toSubmit, 0, 0); }
+        }
+    #endif
+
+    if (q->backend == PNSLR_AsyncIOBackend_ThreadPool)
+    {
+        PNSLR_LockMutex(&q->mutex);
+        while (numSubmitted < numToSubmit)
+        {
+            i32 slotIdx = PNSLR_Internal_TakeAsyncIOSlot(q, requests.data[numSubmitted]);
+            if (slotIdx < 0) { break; }
+
+            q->pending[(q->pendingHead + q->pendingCount) % q->capacity] = slotIdx;
+            q->pendingCount++;
+            numSubmitted++;
+        }
+
+        if (numSubmitted == 1)     { PNSLR_SignalConditionVariable(&q->workAvailable); }
+        else if (numSubmitted > 1) { PNSLR_BroadcastConditionVariable(&q->workAvailable); }
+        PNSLR_UnlockMutex(&q->mutex);
+    }
+
+    q->inFlight += numSubmitted;
+    return numSubmitted;
+}
+
+i32 PNSLR_PollAsyncIOCompletions(PNSLR_AsyncIOQueue queue, PNSLR_ArraySlice(PNSLR_AsyncIOCompletion) output)
+{
+    return PNSLR_WaitForAsyncIOCompletions(queue, output, 0);
+}
+
+i32 PNSLR_WaitForAsyncIOCompletions(PNSLR_AsyncIOQueue queue, PNSLR_ArraySlice(PNSLR_AsyncIOCompletion) output, i32 minCompletions)
+{
+    PNSLR_Internal_AsyncIOQueue* q = (PNSLR_Internal_AsyncIOQueue*) queue.data;
+    if (!q || !output.data || output.count <= 0) { return 0; }
+
+    // waiting for more than could ever turn up would never return
+    if (minCompletions > q->inFlight)     { minCompletions = q->inFlight; }
+    if (minCompletions > output.count)    { minCompletions = (i32) output.count; }
+
+    i32 numOutput = 0;
+
+    #if PNSLR_INTERNAL_ASYNC_IO_URING
+        if (q->backend == PNSLR_AsyncIOBackend_IoUring)
+        {
+            for (;;)
+            {
+                PNSLR_ArraySlice(PNSLR_AsyncIOCompletion) rest = {.data = output.data + numOutput, .count = output.count - numOutput};
+                numOutput += PNSLR_Internal_ReapIoUring(q, rest);
+                if (numOutput >= minCompletions) { break; }
+
+                if (PNSLR_Internal_IoUringEnter(&q->ring, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EBUSY && errno != EAGAIN) { break; }
+            }
+        }
+    #endif
+
+    if (q->backend == PNSLR_AsyncIOBackend_ThreadPool)
+    {
+        PNSLR_LockMutex(&q->mutex);
+        while (q->completionsCount < minCompletions) { PNSLR_WaitConditionVariable(&q->completionAvailable, &q->mutex); }
+        numOutput = PNSLR_Internal_PopAsyncIOCompletions(q, output);
+        PNSLR_UnlockMutex(&q->mutex);
+    }
+
+    q->inFlight -= numOutput;
+    return numOutput;
+}
+
+i32 PNSLR_GetNumAsyncIORequestsInFlight(PNSLR_AsyncIOQueue queue)
+{
+    PNSLR_Internal_AsyncIOQueue* q = (PNSLR_Internal_AsyncIOQueue*) queue.data;
+    return q ? q->inFlight : 0;
+}
+
+b8 PNSLR_CancelAsyncIORequests(PNSLR_AsyncIOQueue queue, u64 userData)
+{
+    PNSLR_Internal_AsyncIOQueue* q = (PNSLR_Internal_AsyncIOQueue*) queue.data;
+    if (!q) { return false; }
+
+    b8 found = false;
+
+    #if PNSLR_INTERNAL_ASYNC_IO_URING
+        if (q->backend == PNSLR_AsyncIOBackend_IoUring)
+        {
+            for (i32 i = 0; i < q->capacity; i++)
+            {
+                PNSLR_Internal_AsyncIOSlot* slot = &q->slots[i];
+                if (!slot->inUse || slot->request.userData != userData) { continue; }
+
+                found           = true;
+                slot->cancelled = true; // stops any partial transfer from being carried on
+
+                // never more cancels than requests, so they can't crowd the requests out of the ring
+                if (q->numCancels >= q->capacity) { continue; }
+
+                struct io_uring_sqe* sqe = PNSLR_Internal_GetIoUringSqeOrFlush(&q->ring);
+                if (!sqe) { continue; }
+
+                sqe->opcode    = IORING_OP_ASYNC_CANCEL;
+                sqe->fd        = -1;
+                sqe->addr      = ((u64) slot->generation << 32) | (u64) i;
+                sqe->user_data = PNSLR_INTERNAL_ASYNC_IO_CANCEL_TAG;
+                PNSLR_Internal_CommitIoUringSqe(&q->ring);
+                q->numCancels++;
+            }
+
+            // if the kernel won't take them right now, they go out with the next submission or wait
+            u32 toSubmit = PNSLR_Internal_NumUnsubmittedIoUringSqes(&q->ring);
+            if (toSubmit) { PNSLR_Internal_IoUringEnter(&q->ring, toSubmit, 0, 0); }
+        }
+    #endif
+
+    if (q->backend == PNSLR_AsyncIOBackend_ThreadPool)
+    {
+        // only the ones no worker has picked up yet can actually be stopped
+        PNSLR_LockMutex(&q->mutex);
+        for (i32 i = 0; i < q->capacity; i++)
+        {
+            PNSLR_Internal_AsyncIOSlot* slot = &q->slots[i];
+            if (slot->inUse && slot->request.userData == userData) { slot->cancelled = true; found = true; }
+        }
+        PNSLR_UnlockMutex(&q->mutex);
+    }
+
+    return found;
+}
+
+#undef PNSLR_INTERNAL_ASYNC_IO_CANCEL_TAG
+#undef PNSLR_INTERNAL_ASYNC_IO_MAX_CHUNK
+#undef PNSLR_INTERNAL_ASYNC_IO_DEFAULT_WORKERS
+#undef PNSLR_INTERNAL_ASYNC_IO_URING
@@ -0,0 +1,136 @@
+#ifndef PNSLR_ASYNC_IO_H // ========================================================
+#define PNSLR_ASYNC_IO_H
+#include "__Prelude.h"
+#include "Allocators.h"
+#include "IO.h"
+EXTERN_C_BEGIN
+
+// Requests and completions ========================================================
+
+/**
+ * Represents what an asynchronous I/O request does.
+ */
+ENUM_START(PNSLR_AsyncIOOperation, u8)
+    #define PNSLR_AsyncIOOperation_Read  ((PNSLR_AsyncIOOperation) 0)
+    #define PNSLR_AsyncIOOperation_Write ((PNSLR_AsyncIOOperation) 1)
+    #define PNSLR_AsyncIOOperation_Flush ((PNSLR_AsyncIOOperation) 2)
+ENUM_END
+
+/**
+ * A single asynchronous read, write or flush against an opened file.
+ * Reads and writes happen at 'offset', whatever the file's cursor is at.
+ * The buffer (unused for flushes) has to stay valid until the request completes.
+ * Zero-length reads and writes succeed straight away, without touching the file.
+ * 'userData' is handed back unchanged in the request's completion.
+ */
+typedef struct PNSLR_AsyncIORequest
+{
+    PNSLR_File             file;
+    PNSLR_AsyncIOOperation operation;
+    i64                    offset;
+    PNSLR_ArraySlice(u8)   buffer;
+    u64                    userData;
+} PNSLR_AsyncIORequest;
+
+PNSLR_DECLARE_ARRAY_SLICE(PNSLR_AsyncIORequest);
+
+/**
+ * Represents how an asynchronous I/O request ended.
+ */
+ENUM_START(PNSLR_AsyncIOStatus, u8)
+    #define PNSLR_AsyncIOStatus_Succeeded ((PNSLR_AsyncIOStatus) 0)
+    #define PNSLR_AsyncIOStatus_Failed    ((PNSLR_AsyncIOStatus) 1)
+    #define PNSLR_AsyncIOStatus_Cancelled ((PNSLR_AsyncIOStatus) 2)
+ENUM_END
+
+/**
+ * The result of an asynchronous I/O request.
+ * Reads and writes are carried on until the whole buffer is done, so the
+ * number of bytes transferred is only ever short for a read that hit the end of the file.
+ */
+typedef struct PNSLR_AsyncIOCompletion
+{
+    u64                 userData;
+    i64                 bytesTransferred;
+    PNSLR_AsyncIOStatus status;
+} PNSLR_AsyncIOCompletion;
+
+PNSLR_DECLARE_ARRAY_SLICE(PNSLR_AsyncIOCompletion);
+
+// Queues ==========================================================================
+
+/**
+ * Represents what carries out the requests of an asynchronous I/O queue.
+ * The default is io_uring where the kernel supports it, and a pool of worker threads
+ * doing blocking positional reads and writes everywhere else.
+ */
+ENUM_START(PNSLR_AsyncIOBackend, u8)
+    #define PNSLR_AsyncIOBackend_Default    ((PNSLR_AsyncIOBackend) 0)
+    #define PNSLR_AsyncIOBackend_ThreadPool ((PNSLR_AsyncIOBackend) 1)
+    #define PNSLR_AsyncIOBackend_IoUring    ((PNSLR_AsyncIOBackend) 2)
+ENUM_END
+
+/**
+ * A queue of asynchronous I/O requests. A queue is meant to be used from one thread;
+ * use one queue per thread that issues requests.
+ */
+typedef struct PNSLR_AsyncIOQueue { rawptr data; } PNSLR_AsyncIOQueue;
+
+/**
+ * Creates an asynchronous I/O queue that can have up to 'capacity' requests in flight.
+ * 'numWorkerThreads' only applies to the thread pool backend (defaults to 4).
+ * Returns a queue with no data if the backend asked for isn't available.
+ */
+PNSLR_AsyncIOQueue PNSLR_CreateAsyncIOQueue(
+    PNSLR_Allocator      allocator,
+    i32                  capacity,
+    PNSLR_AsyncIOBackend backend          OPT_ARG,
+    i32                  numWorkerThreads OPT_ARG
+);
+
+/**
+ * Destroys an asynchronous I/O queue, after waiting for every request in flight to finish.
+ * Completions that haven't been collected are dropped.
+ */
+void PNSLR_DestroyAsyncIOQueue(PNSLR_AsyncIOQueue* queue);
+
+/**
+ * Gets the backend an asynchronous I/O queue ended up with.
+ */
+PNSLR_AsyncIOBackend PNSLR_GetAsyncIOQueueBackend(PNSLR_AsyncIOQueue queue);
+
+/**
+ * Submits a batch of requests in one go.
+ * Returns how many of them (from the start of the batch) were accepted; fewer than
+ * all of them means the queue is full, and completions need to be collected first.
+ */
+i32 PNSLR_SubmitAsyncIORequests(PNSLR_AsyncIOQueue queue, PNSLR_ArraySlice(PNSLR_AsyncIORequest) requests);
+
+/**
+ * Collects finished requests without waiting.
+ * Returns how many completions were written to the output.
+ */
+i32 PNSLR_PollAsyncIOCompletions(PNSLR_AsyncIOQueue queue, PNSLR_ArraySlice(PNSLR_AsyncIOCompletion) output);
+
+/**
+ * Collects finished requests, waiting until there are at least 'minCompletions' of them
+ * (or until nothing is in flight any more).
+ * Returns how many completions were written to the output.
+ */
+i32 PNSLR_WaitForAsyncIOCompletions(PNSLR_AsyncIOQueue queue, PNSLR_ArraySlice(PNSLR_AsyncIOCompletion) output, i32 minCompletions OPT_ARG);
+
+/**
+ * Gets the number of requests that have been submitted, but whose completions haven't been collected.
+ */
+i32 PNSLR_GetNumAsyncIORequestsInFlight(PNSLR_AsyncIOQueue queue);
+
+/**
+ * Asks for the in-flight requests with the given user data to be cancelled.
+ * Requests that were already being carried out may still finish normally;
+ * either way, each one still produces exactly one completion.
+ * Returns true if any matching request hadn't finished yet.
+ */
+b8 PNSLR_CancelAsyncIORequests(PNSLR_AsyncIOQueue queue, u64 userData);
+
+EXTERN_C_END
+#endif // PNSLR_ASYNC_IO_H =========================================================
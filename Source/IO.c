@@ -3,6 +3,14 @@
 #include "Allocators.h"
 #include "Strings.h"
 #include "Stream.h"
+#include "Memory.h"
+#include "Sync.h"
+#include "Threads.h"
+
+#define PNSLR_INTERNAL_MAX_FILE_IO_CHUNK          (1 << 30)   // per call, so sizes always fit in 32 bits
+#define PNSLR_INTERNAL_MAX_IO_VECS                64          // per vectored call, well under any IOV_MAX
+#define PNSLR_INTERNAL_DIRECTORY_WALK_BUFFER_SIZE (32 * 1024) // of directory listing read per call
+#define PNSLR_INTERNAL_DIRECTORY_WALK_MAX_NAME    (1024)      // comfortably over any filesystem's limit
 
 // internal allocator stuff ========================================================
 
@@ -117,8 +125,8 @@ PNSLR_CREATE_INTERNAL_ARENA_ALLOCATOR(Paths, 60);
         utf8str z = PNSLR_MakeString((x.count + y.count), false, buff-> allocator, PNSLR_GET_LOC(), nil);
         if (z.data != nil)
         {
-            PNSLR_MemCopy(z.data,           x.data, (i32) x.count);
-            PNSLR_MemCopy(z.data + x.count, y.data, (i32) y.count);
+            PNSLR_MemCopy(z.data,           x.data, x.count);
+            PNSLR_MemCopy(z.data + x.count, y.data, y.count);
         }
 
         return z;
@@ -338,7 +346,7 @@ PNSLR_Path PNSLR_NormalisePath(utf8str path, PNSLR_PathNormalisationType type, P
 
            if (output.data != nil)
            {
-               PNSLR_MemCopy(output.data, tempAlias.data, (i32) tempAlias.count);
+               PNSLR_MemCopy(output.data, tempAlias.data, tempAlias.count);
                if (type == PNSLR_PathNormalisationType_Directory) { output.data[tempAlias.count] = '/'; }
                output.count = tgtCount;
            }
@@ -402,8 +410,8 @@ PNSLR_Path PNSLR_GetPathForChildFile(PNSLR_Path dir, utf8str fileNameWithExtensi
     utf8str output = PNSLR_MakeString((dir.path.count + fileNameWithExtension.count), false, allocator, PNSLR_GET_LOC(), nil);
     if (!output.data || !output.count) { return (PNSLR_Path) {0}; }
 
-    PNSLR_MemCopy(output.data, dir.path.data, (i32) dir.path.count);
-    PNSLR_MemCopy(output.data + dir.path.count, fileNameWithExtension.data, (i32) fileNameWithExtension.count);
+    PNSLR_MemCopy(output.data, dir.path.data, dir.path.count);
+    PNSLR_MemCopy(output.data + dir.path.count, fileNameWithExtension.data, fileNameWithExtension.count);
 
     return (PNSLR_Path) { .path = output };
 }
@@ -413,8 +421,8 @@ PNSLR_Path PNSLR_GetPathForSubdirectory(PNSLR_Path dir, utf8str dirName, PNSLR_A
     utf8str output = PNSLR_MakeString((dir.path.count + dirName.count + 1), false, allocator, PNSLR_GET_LOC(), nil); // +1 for trailing slash
     if (!output.data || !output.count) { return (PNSLR_Path) {0}; }
 
-    PNSLR_MemCopy(output.data, dir.path.data, (i32) dir.path.count);
-    PNSLR_MemCopy(output.data + dir.path.count, dirName.data, (i32) dirName.count);
+    PNSLR_MemCopy(output.data, dir.path.data, dir.path.count);
+    PNSLR_MemCopy(output.data + dir.path.count, dirName.data, dirName.count);
     output.data[output.count - 1] = '/';
 
     return (PNSLR_Path) { .path = output };
@@ -427,7 +435,7 @@ void PNSLR_IterateDirectory(PNSLR_Path path, b8 recursive, rawptr visitorPayload
 
     // copy the filename to a temporary buffer
     PNSLR_ArraySlice(char) tempBuffer2 = PNSLR_MakeSlice(char, (path.path.count + 3), false, internalAllocator, PNSLR_GET_LOC(), nil);
-    PNSLR_MemCopy(tempBuffer2.data, path.path.data, (i32) path.path.count);
+    PNSLR_MemCopy(tempBuffer2.data, path.path.data, path.path.count);
     #if PNSLR_WINDOWS
     {
         u32 iterator = (u32) path.path.count - 1;
@@ -483,7 +491,7 @@ void PNSLR_IterateDirectory(PNSLR_Path path, b8 recursive, rawptr visitorPayload
 
                 utf8str foundPath = PNSLR_MakeString((path.path.count + fileNameLen + 3), false, internalAllocator, PNSLR_GET_LOC(), nil);
 
-                PNSLR_MemCopy(foundPath.data, path.path.data, (i32) path.path.count);
+                PNSLR_MemCopy(foundPath.data, path.path.data, path.path.count);
                 u32 iterator = (u32) path.path.count - 1;
                 if (foundPath.data[iterator] == '/' || foundPath.data[iterator] == '\\')
                 {
@@ -570,6 +578,373 @@ void PNSLR_IterateDirectory(PNSLR_Path path, b8 recursive, rawptr visitorPayload
     PNSLR_INTERNAL_ALLOCATOR_RESET(Paths, internalAllocator);
 }
 
+typedef struct PNSLR_Internal_DirectoryWalkJob
+{
+    struct PNSLR_Internal_DirectoryWalkJob* next;
+    i32                                     depth; // of the directory's contents
+    utf8str                                 path;  // ends with a slash, and is null-terminated
+} PNSLR_Internal_DirectoryWalkJob;
+
+typedef struct PNSLR_Internal_DirectoryWalk
+{
+    rawptr                             payload;
+    PNSLR_DirectoryWalkVisitorDelegate visitorFunc;
+    b8                                 querySizeAndTimestamp;
+    i32                                numWorkers;
+    i64                                numIdle;  // atomic, so busy workers can check for idle ones without locking
+    i64                                stopped;  // atomic
+    PNSLR_Mutex                        mutex;
+    PNSLR_ConditionVariable            jobAvailable;
+    PNSLR_Internal_DirectoryWalkJob*   jobs;     // behind the mutex
+    b8                                 finished; // behind the mutex
+} PNSLR_Internal_DirectoryWalk;
+
+#if PNSLR_LINUX || PNSLR_ANDROID
+
+    // what getdents64 fills its buffer with; glibc doesn't declare it
+    typedef struct PNSLR_Internal_LinuxDirent64
+    {
+        u64  ino;
+        i64  off;
+        u16  reclen;
+        u8   type;
+        char name[];
+    } PNSLR_Internal_LinuxDirent64;
+
+#endif
+
+static void PNSLR_Internal_WalkDirectory(PNSLR_Internal_DirectoryWalk* walk, PNSLR_Allocator arena, utf8str dirPath, i32 dirFd, i32 depth);
+
+// goes into a directory found while walking, or hands it over to an idle worker if there is one
+static void PNSLR_Internal_ExploreDirectoryWalkChild(PNSLR_Internal_DirectoryWalk* walk, PNSLR_Allocator arena, utf8str childPath, i32 childFd, i32 depth)
+{
+    if (walk->numWorkers > 1 && PNSLR_AtomicLoadI64(&walk->numIdle) > 0)
+    {
+        i64                              size = (i64) sizeof(PNSLR_Internal_DirectoryWalkJob) + childPath.count + 1;
+        PNSLR_Internal_DirectoryWalkJob* job  = PNSLR_Allocate(PNSLR_GetAllocator_DefaultHeap(), false, size, (i32) alignof(PNSLR_Internal_DirectoryWalkJob), PNSLR_GET_LOC(), nil);
+        if (job)
+        {
+            job->depth      = depth;
+            job->path.data  = (u8*) (job + 1);
+            job->path.count = childPath.count;
+            PNSLR_MemCopy(job->path.data, childPath.data, childPath.count);
+            job->path.data[childPath.count] = '\0';
+
+            #if PNSLR_UNIX
+                if (childFd >= 0) { close(childFd); } // the other worker opens it by its path
+            #endif
+
+            PNSLR_LockMutex(&walk->mutex);
+            job->next  = walk->jobs;
+            walk->jobs = job;
+            PNSLR_SignalConditionVariable(&walk->jobAvailable);
+            PNSLR_UnlockMutex(&walk->mutex);
+            return;
+        }
+    }
+
+    PNSLR_Internal_WalkDirectory(walk, arena, childPath, childFd, depth);
+}
+
+// hands an entry to the visitor, and says whether to go into it
+static b8 PNSLR_Internal_VisitDirectoryWalkEntry(PNSLR_Internal_DirectoryWalk* walk, PNSLR_DirectoryWalkEntry entry)
+{
+    b8 exploreCurrentDirectory = entry.isDirectory;
+    if (!walk->visitorFunc(walk->payload, entry, &exploreCurrentDirectory))
+    {
+        PNSLR_AtomicStoreI64(&walk->stopped, 1);
+        return false;
+    }
+
+    return entry.isDirectory && exploreCurrentDirectory;
+}
+
+#if PNSLR_UNIX
+
+    // everything about an entry that isn't in the directory listing, asked for in one go;
+    // returns false if the entry couldn't be queried (it might've been deleted in the meantime)
+    static b8 PNSLR_Internal_QueryDirectoryWalkEntry(i32 dirFd, cstring name, b8* isDirectory, i64* size, i64* timestamp)
+    {
+        #if (PNSLR_LINUX || PNSLR_ANDROID) && defined(STATX_SIZE) && defined(__NR_statx)
+
+            // only asks for what's needed, which some filesystems (network ones especially) can do cheaper;
+            // raw syscall, since bionic only has a wrapper for it from android 11 onwards
+            struct statx statxBuf;
+            if (syscall(__NR_statx, dirFd, name, AT_SYMLINK_NOFOLLOW, STATX_TYPE | STATX_SIZE | STATX_MTIME, &statxBuf) == 0)
+            {
+                *isDirectory = S_ISDIR(statxBuf.stx_mode);
+                *size        = (i64) statxBuf.stx_size;
+                *timestamp   = (i64) statxBuf.stx_mtime.tv_sec * 1000000000LL + (i64) statxBuf.stx_mtime.tv_nsec;
+                return true;
+            }
+            if (errno != ENOSYS) { return false; }
+
+        #endif
+
+        struct stat statBuf;
+        if (fstatat(dirFd, name, &statBuf, AT_SYMLINK_NOFOLLOW) != 0) { return false; }
+
+        *isDirectory = S_ISDIR(statBuf.st_mode);
+        *size        = (i64) statBuf.st_size;
+        #if PNSLR_OSX || PNSLR_IOS
+            *timestamp = (i64) statBuf.st_mtimespec.tv_sec * 1000000000LL + (i64) statBuf.st_mtimespec.tv_nsec;
+        #else
+            *timestamp = (i64) statBuf.st_mtim.tv_sec * 1000000000LL + (i64) statBuf.st_mtim.tv_nsec;
+        #endif
+        return true;
+    }
+
+    // returns false once the walk should stop
+    static b8 PNSLR_Internal_WalkDirectoryEntry(PNSLR_Internal_DirectoryWalk* walk, PNSLR_Allocator arena, utf8str entryPath, i64 dirPathLen, i32 dirFd, i32 depth, cstring name, u8 type)
+    {
+        i32 nameLen = PNSLR_GetCStringLength(name);
+        if (nameLen == 0 || nameLen >= PNSLR_INTERNAL_DIRECTORY_WALK_MAX_NAME) { return true; } // nothing that can be dealt with
+        if (nameLen == 1 && name[0] == '.'                   ) { return true; } // skip current directory
+        if (nameLen == 2 && name[0] == '.' && name[1] == '.' ) { return true; } // skip parent directory
+
+        PNSLR_DirectoryWalkEntry entry = {.depth = depth, .isDirectory = (type == DT_DIR)};
+
+        // the listing says what most entries are, so they're only asked about if it doesn't, or more is wanted
+        if (type == DT_UNKNOWN || walk->querySizeAndTimestamp)
+        {
+            if (!PNSLR_Internal_QueryDirectoryWalkEntry(dirFd, name, &entry.isDirectory, &entry.size, &entry.timestamp)) { return true; }
+            if (entry.isDirectory) { entry.size = 0; }
+        }
+
+        PNSLR_MemCopy(entryPath.data + dirPathLen, name, nameLen);
+        entryPath.count = dirPathLen + nameLen;
+        if (entry.isDirectory) { entryPath.data[entryPath.count++] = '/'; }
+        entryPath.data[entryPath.count] = '\0';
+
+        entry.path.path = entryPath;
+        entry.name      = (utf8str) {.data = entryPath.data + dirPathLen, .count = nameLen};
+
+        if (PNSLR_Internal_VisitDirectoryWalkEntry(walk, entry))
+        {
+            // the directory was already checked not to be a link, but it may have been swapped for one since
+            i32 childFd = openat(dirFd, name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+            if (childFd >= 0) { PNSLR_Internal_ExploreDirectoryWalkChild(walk, arena, entryPath, childFd, depth + 1); }
+        }
+
+        return !PNSLR_AtomicLoadI64(&walk->stopped);
+    }
+
+#endif
+
+// walks through one directory (taking ownership of its descriptor, if one's passed in), and everything
+// below it that isn't handed over to another worker
+static void PNSLR_Internal_WalkDirectory(PNSLR_Internal_DirectoryWalk* walk, PNSLR_Allocator arena, utf8str dirPath, i32 dirFd, i32 depth)
+{
+    PNSLR_ArenaAllocatorSnapshot snapshot = PNSLR_CaptureArenaAllocatorSnapshot(arena);
+
+    // every entry's path is written over the end of this one, so nothing's allocated per entry
+    utf8str entryPath = PNSLR_MakeString(dirPath.count + PNSLR_INTERNAL_DIRECTORY_WALK_MAX_NAME + 2, false, arena, PNSLR_GET_LOC(), nil);
+
+    #if PNSLR_WINDOWS
+
+        if (entryPath.data)
+        {
+            PNSLR_MemCopy(entryPath.data, dirPath.data, dirPath.count);
+            entryPath.data[dirPath.count    ] = '*';
+            entryPath.data[dirPath.count + 1] = '\0';
+
+            // the basic info level skips the short names, and large fetches get more entries per call
+            WIN32_FIND_DATAA findData;
+            HANDLE findHandle = FindFirstFileExA((cstring) entryPath.data, FindExInfoBasic, &findData, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+            if (findHandle != INVALID_HANDLE_VALUE)
+            {
+                do
+                {
+                    cstring name    = findData.cFileName;
+                    i32     nameLen = PNSLR_GetCStringLength(name);
+                    if (nameLen == 0 || nameLen >= PNSLR_INTERNAL_DIRECTORY_WALK_MAX_NAME) { continue; } // nothing that can be dealt with
+                    if (nameLen == 1 && name[0] == '.'                   ) { continue; } // skip current directory
+                    if (nameLen == 2 && name[0] == '.' && name[1] == '.' ) { continue; } // skip parent directory
+
+                    PNSLR_DirectoryWalkEntry entry = {.depth = depth};
+
+                    // reparse points (symbolic links, junctions) aren't followed
+                    entry.isDirectory = (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) && !(findData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT);
+                    if (walk->querySizeAndTimestamp)
+                    {
+                        // the listing has these anyway, so there's no extra cost on windows
+                        ULARGE_INTEGER ull;
+                        ull.LowPart  = findData.ftLastWriteTime.dwLowDateTime;
+                        ull.HighPart = findData.ftLastWriteTime.dwHighDateTime;
+
+                        entry.size      = entry.isDirectory ? 0 : (i64) (((u64) findData.nFileSizeHigh << 32) | (u64) findData.nFileSizeLow);
+                        entry.timestamp = (i64) (ull.QuadPart - 116444736000000000ULL) * 100;
+                    }
+
+                    PNSLR_MemCopy(entryPath.data + dirPath.count, name, nameLen);
+                    entryPath.count = dirPath.count + nameLen;
+                    if (entry.isDirectory) { entryPath.data[entryPath.count++] = '/'; }
+                    entryPath.data[entryPath.count] = '\0';
+
+                    for (i64 i = dirPath.count; i < entryPath.count; ++i)
+                    {
+                        if (entryPath.data[i] == '\\') { entryPath.data[i] = '/'; } // normalise path separators
+                    }
+
+                    entry.path.path = entryPath;
+                    entry.name      = (utf8str) {.data = entryPath.data + dirPath.count, .count = nameLen};
+
+                    if (PNSLR_Internal_VisitDirectoryWalkEntry(walk, entry))
+                    {
+                        PNSLR_Internal_ExploreDirectoryWalkChild(walk, arena, entryPath, -1, depth + 1);
+                    }
+
+                } while (!PNSLR_AtomicLoadI64(&walk->stopped) && FindNextFileA(findHandle, &findData));
+
+                FindClose(findHandle);
+            }
+        }
+
+    #elif PNSLR_UNIX
+
+        if (dirFd < 0) { dirFd = open((cstring) dirPath.data, O_RDONLY | O_DIRECTORY | O_CLOEXEC); }
+
+        if (dirFd >= 0 && entryPath.data)
+        {
+            PNSLR_MemCopy(entryPath.data, dirPath.data, dirPath.count);
+
+            #if PNSLR_LINUX || PNSLR_ANDROID
+
+                // straight from the kernel, in bigger batches than readdir asks for
+                u8* buffer = PNSLR_Allocate(arena, false, PNSLR_INTERNAL_DIRECTORY_WALK_BUFFER_SIZE, (i32) alignof(PNSLR_Internal_LinuxDirent64), PNSLR_GET_LOC(), nil);
+
+                b8 keepGoing = (buffer != nil);
+                while (keepGoing)
+                {
+                    i64 numRead = (i64) syscall(__NR_getdents64, dirFd, buffer, PNSLR_INTERNAL_DIRECTORY_WALK_BUFFER_SIZE);
+                    if (numRead < 0 && errno == EINTR) { continue; }
+                    if (numRead <= 0) { break; }
+
+                    for (i64 pos = 0; keepGoing && pos < numRead; )
+                    {
+                        PNSLR_Internal_LinuxDirent64* dirent = (PNSLR_Internal_LinuxDirent64*) (buffer + pos);
+                        pos += dirent->reclen;
+
+                        keepGoing = PNSLR_Internal_WalkDirectoryEntry(walk, arena, entryPath, dirPath.count, dirFd, depth, dirent->name, dirent->type);
+                    }
+                }
+
+                close(dirFd);
+
+            #else
+
+                DIR* dir = fdopendir(dirFd);
+                if (dir)
+                {
+                    struct dirent* dirent;
+                    while ((dirent = readdir(dir)) != NULL)
+                    {
+                        if (!PNSLR_Internal_WalkDirectoryEntry(walk, arena, entryPath, dirPath.count, dirFd, depth, dirent->d_name, dirent->d_type)) { break; }
+                    }
+
+                    closedir(dir); // closes the descriptor too
+                }
+                else { close(dirFd); }
+
+            #endif
+        }
+        else if (dirFd >= 0) { close(dirFd); }
+
+    #endif
+
+    PNSLR_ArenaSnapshotError restoreError = PNSLR_RestoreArenaAllocatorSnapshot(&snapshot, PNSLR_GET_LOC());
+    if (PNSLR_ArenaSnapshotError_None != restoreError) { FORCE_TRAP; }
+}
+
+static void PNSLR_Internal_DirectoryWalkWorker(rawptr data)
+{
+    PNSLR_Internal_DirectoryWalk* walk  = (PNSLR_Internal_DirectoryWalk*) data;
+    PNSLR_Allocator               arena = PNSLR_NewAllocator_Arena(PNSLR_GetAllocator_DefaultHeap(), 64 * 1024, PNSLR_GET_LOC(), nil);
+
+    PNSLR_LockMutex(&walk->mutex);
+    for (;;)
+    {
+        while (!walk->jobs && !walk->finished)
+        {
+            // nobody's left walking anything, so nothing more can turn up
+            if (PNSLR_AtomicLoadI64(&walk->numIdle) + 1 == walk->numWorkers)
+            {
+                walk->finished = true;
+                PNSLR_BroadcastConditionVariable(&walk->jobAvailable);
+                break;
+            }
+
+            PNSLR_AtomicFetchAddI64(&walk->numIdle, 1);
+            PNSLR_WaitConditionVariable(&walk->jobAvailable, &walk->mutex);
+            PNSLR_AtomicFetchAddI64(&walk->numIdle, -1);
+        }
+
+        PNSLR_Internal_DirectoryWalkJob* job = walk->jobs;
+        if (!job) { break; }
+        walk->jobs = job->next;
+        PNSLR_UnlockMutex(&walk->mutex);
+
+        if (!PNSLR_AtomicLoadI64(&walk->stopped)) { PNSLR_Internal_WalkDirectory(walk, arena, job->path, -1, job->depth); }
+        PNSLR_Free(PNSLR_GetAllocator_DefaultHeap(), job, PNSLR_GET_LOC(), nil);
+
+        PNSLR_LockMutex(&walk->mutex);
+    }
+    PNSLR_UnlockMutex(&walk->mutex);
+
+    PNSLR_DestroyAllocator_Arena(arena, PNSLR_GET_LOC(), nil);
+}
+
+b8 PNSLR_WalkDirectoryTree(PNSLR_Path path, rawptr visitorPayload, PNSLR_DirectoryWalkVisitorDelegate visitorFunc, b8 querySizeAndTimestamp, i32 numWorkerThreads)
+{
+    if (!path.path.data || !path.path.count || !visitorFunc)         { return false; }
+    if (!PNSLR_PathExists(path, PNSLR_PathExistsCheckType_Directory)) { return false; }
+    if (numWorkerThreads <= 0) { numWorkerThreads = 1; }
+
+    PNSLR_Internal_DirectoryWalk walk = {.payload = visitorPayload, .visitorFunc = visitorFunc, .querySizeAndTimestamp = querySizeAndTimestamp};
+
+    // the root goes in as the first job, with the trailing slash it might've been passed without
+    b8                               hasSlash = (path.path.data[path.path.count - 1] == '/');
+    i64                              rootSize = (i64) sizeof(PNSLR_Internal_DirectoryWalkJob) + path.path.count + 2;
+    PNSLR_Internal_DirectoryWalkJob* root     = PNSLR_Allocate(PNSLR_GetAllocator_DefaultHeap(), true, rootSize, (i32) alignof(PNSLR_Internal_DirectoryWalkJob), PNSLR_GET_LOC(), nil);
+    if (!root) { return false; }
+
+    root->path.data  = (u8*) (root + 1);
+    root->path.count = path.path.count + (hasSlash ? 0 : 1);
+    PNSLR_MemCopy(root->path.data, path.path.data, path.path.count);
+    root->path.data[root->path.count - 1] = '/';
+    walk.jobs = root;
+
+    walk.mutex        = PNSLR_CreateMutex();
+    walk.jobAvailable = PNSLR_CreateConditionVariable();
+
+    // held while the workers start, so they all see the final count
+    PNSLR_LockMutex(&walk.mutex);
+
+    i32                 numThreads = 0;
+    PNSLR_ThreadHandle* threads    = nil;
+    if (numWorkerThreads > 1)
+    {
+        threads = PNSLR_Allocate(PNSLR_GetAllocator_DefaultHeap(), true, (numWorkerThreads - 1) * (i64) sizeof(PNSLR_ThreadHandle), (i32) alignof(PNSLR_ThreadHandle), PNSLR_GET_LOC(), nil);
+        for (i32 i = 0; threads && i < numWorkerThreads - 1; i++)
+        {
+            PNSLR_ThreadHandle thread = PNSLR_StartThread(PNSLR_Internal_DirectoryWalkWorker, &walk, PNSLR_StringLiteral("PNSLR_WalkDirTree"));
+            if (PNSLR_IsThreadHandleValid(thread)) { threads[numThreads++] = thread; }
+        }
+    }
+
+    walk.numWorkers = numThreads + 1; // the calling thread is one of the workers
+    PNSLR_UnlockMutex(&walk.mutex);
+
+    PNSLR_Internal_DirectoryWalkWorker(&walk);
+
+    for (i32 i = 0; i < numThreads; i++) { PNSLR_JoinThread(threads[i]); }
+    if (threads) { PNSLR_Free(PNSLR_GetAllocator_DefaultHeap(), threads, PNSLR_GET_LOC(), nil); }
+
+    PNSLR_DestroyConditionVariable(&walk.jobAvailable);
+    PNSLR_DestroyMutex(&walk.mutex);
+    return !walk.stopped;
+}
+
 b8 PNSLR_PathExists(PNSLR_Path path, PNSLR_PathExistsCheckType type)
 {
     PNSLR_INTERNAL_ALLOCATOR_INIT(Paths, internalAllocator);
@@ -923,19 +1298,32 @@ b8 PNSLR_ReadFromFile(PNSLR_File handle, PNSLR_ArraySlice(u8) dst, i64* readSize
     b8 success = true;
     i64 bytesReadTotal = 0;
 
-    #if PNSLR_WINDOWS
+    // a single call can stop short of what was asked for, so keep going until the end of the file
+    while (success && bytesReadTotal < dst.count)
+    {
+        i64 chunk = dst.count - bytesReadTotal;
+        if (chunk > PNSLR_INTERNAL_MAX_FILE_IO_CHUNK) { chunk = PNSLR_INTERNAL_MAX_FILE_IO_CHUNK; }
 
-        DWORD bytesRead = 0;
-        success = ReadFile((HANDLE) handle.handle, dst.data, (DWORD) dst.count, &bytesRead, NULL);
-        bytesReadTotal = (i64)bytesRead;
+        i64 bytesRead = 0;
 
-    #elif PNSLR_UNIX
+        #if PNSLR_WINDOWS
 
-        ssize_t res = read((i32) (i64) handle.handle, dst.data, (size_t) dst.count);
-        success = (res == (ssize_t) dst.count);
-        bytesReadTotal = res > 0 ? (i64) res : 0;
+            DWORD numBytes = 0;
+            success   = ReadFile((HANDLE) handle.handle, dst.data + bytesReadTotal, (DWORD) chunk, &numBytes, NULL);
+            bytesRead = (i64) numBytes;
 
-    #endif
+        #elif PNSLR_UNIX
+
+            ssize_t res = read((i32) (i64) handle.handle, dst.data + bytesReadTotal, (size_t) chunk);
+            if (res < 0 && errno == EINTR) { continue; }
+            success   = (res >= 0);
+            bytesRead = res > 0 ? (i64) res : 0;
+
+        #endif
+
+        if (!bytesRead) { success = false; }
+        bytesReadTotal += bytesRead;
+    }
 
     if (readSize) *readSize = bytesReadTotal;
 
@@ -946,22 +1334,147 @@ b8 PNSLR_WriteToFile(PNSLR_File handle, PNSLR_ArraySlice(u8) src)
 {
     if (!handle.handle || !src.data || !src.count) { return false; }
 
-    b8 success = true;
-    #if PNSLR_WINDOWS
+    b8  success           = true;
+    i64 bytesWrittenTotal = 0;
+    while (success && bytesWrittenTotal < src.count)
+    {
+        i64 chunk = src.count - bytesWrittenTotal;
+        if (chunk > PNSLR_INTERNAL_MAX_FILE_IO_CHUNK) { chunk = PNSLR_INTERNAL_MAX_FILE_IO_CHUNK; }
 
-        DWORD bytesWritten = 0;
-        success = WriteFile((HANDLE) handle.handle, src.data, (DWORD) src.count, &bytesWritten, NULL);
+        i64 bytesWritten = 0;
 
-    #elif PNSLR_UNIX
+        #if PNSLR_WINDOWS
 
-        ssize_t res = write((i32) (i64) handle.handle, src.data, (size_t) src.count);
-        success = (res == (ssize_t) src.count);
+            DWORD numBytes = 0;
+            success      = WriteFile((HANDLE) handle.handle, src.data + bytesWrittenTotal, (DWORD) chunk, &numBytes, NULL);
+            bytesWritten = (i64) numBytes;
 
-    #endif
+        #elif PNSLR_UNIX
+
+            ssize_t res = write((i32) (i64) handle.handle, src.data + bytesWrittenTotal, (size_t) chunk);
+            if (res < 0 && errno == EINTR) { continue; }
+            success      = (res >= 0);
+            bytesWritten = res > 0 ? (i64) res : 0;
+
+        #endif
+
+        if (!bytesWritten) { success = false; }
+        bytesWrittenTotal += bytesWritten;
+    }
 
     return success;
 }
 
+// reads into (or writes from) the buffers back to back, starting at an offset in the file;
+// carries on through partial transfers, so it's only ever short at the end of the file
+static b8 PNSLR_Internal_TransferFileAt(PNSLR_File handle, i64 offset, PNSLR_ArraySlice(utf8str) buffers, b8 isRead, i64* transferred)
+{
+    *transferred = 0;
+    if (!handle.handle || offset < 0 || !buffers.data || buffers.count <= 0) { return false; }
+
+    i64 totalSize = 0;
+    for (i64 i = 0; i < buffers.count; i++)
+    {
+        if (buffers.data[i].count < 0 || (buffers.data[i].count && !buffers.data[i].data)) { return false; }
+        totalSize += buffers.data[i].count;
+    }
+    if (!totalSize) { return false; }
+
+    i64 bufIdx = 0, bufPos = 0;
+    while (*transferred < totalSize)
+    {
+        while (bufPos >= buffers.data[bufIdx].count) { bufIdx++; bufPos = 0; } // skips empty ones too
+
+        i64 done = 0;
+
+        #if PNSLR_WINDOWS
+
+            // there's no vectored call for regular (buffered, synchronous) handles, so one buffer at a time;
+            // the offset goes through the overlapped struct, though the cursor still ends up after the data
+            i64 chunk = buffers.data[bufIdx].count - bufPos;
+            if (chunk > PNSLR_INTERNAL_MAX_FILE_IO_CHUNK) { chunk = PNSLR_INTERNAL_MAX_FILE_IO_CHUNK; }
+
+            u64        position   = (u64) (offset + *transferred);
+            OVERLAPPED overlapped = {0};
+            overlapped.Offset     = (DWORD) position;
+            overlapped.OffsetHigh = (DWORD) (position >> 32);
+
+            u8*   data     = buffers.data[bufIdx].data + bufPos;
+            DWORD numBytes = 0;
+            BOOL  ok       = isRead ? ReadFile((HANDLE) handle.handle, data, (DWORD) chunk, &numBytes, &overlapped)
+                                    : WriteFile((HANDLE) handle.handle, data, (DWORD) chunk, &numBytes, &overlapped);
+
+            if (!ok) { return false; } // includes ERROR_HANDLE_EOF
+            done = (i64) numBytes;
+
+        #elif PNSLR_UNIX
+
+            struct iovec vecs[PNSLR_INTERNAL_MAX_IO_VECS];
+            i32          numVecs   = 0;
+            i64          vecsTotal = 0;
+            for (i64 i = bufIdx; i < buffers.count && numVecs < PNSLR_INTERNAL_MAX_IO_VECS && vecsTotal < PNSLR_INTERNAL_MAX_FILE_IO_CHUNK; i++)
+            {
+                i64 start = (i == bufIdx) ? bufPos : 0;
+                i64 size  = buffers.data[i].count - start;
+                if (size <= 0) { continue; }
+                if (size > PNSLR_INTERNAL_MAX_FILE_IO_CHUNK - vecsTotal) { size = PNSLR_INTERNAL_MAX_FILE_IO_CHUNK - vecsTotal; }
+
+                vecs[numVecs++] = (struct iovec) {.iov_base = buffers.data[i].data + start, .iov_len = (size_t) size};
+                vecsTotal      += size;
+            }
+
+            i32     fd  = (i32) (i64) handle.handle;
+            off_t   pos = (off_t) (offset + *transferred);
+            ssize_t res = isRead ? preadv(fd, vecs, numVecs, pos) : pwritev(fd, vecs, numVecs, pos);
+
+            if (res < 0 && errno == EINTR) { continue; }
+            if (res < 0)                   { return false; }
+            done = (i64) res;
+
+        #endif
+
+        if (!done) { return false; } // end of the file for reads, something's off for writes
+        *transferred += done;
+
+        while (done > 0)
+        {
+            i64 left = buffers.data[bufIdx].count - bufPos;
+            if (done < left) { bufPos += done; done = 0; }
+            else             { done -= left; bufIdx++; bufPos = 0; }
+        }
+    }
+
+    return true;
+}
+
+b8 PNSLR_ReadFromFileAt(PNSLR_File handle, i64 offset, PNSLR_ArraySlice(u8) dst, i64* readSize)
+{
+    i64 bytesRead = 0;
+    b8  success   = PNSLR_Internal_TransferFileAt(handle, offset, (PNSLR_ArraySlice(utf8str)) {.data = &dst, .count = 1}, true, &bytesRead);
+    if (readSize) *readSize = bytesRead;
+    return success;
+}
+
+b8 PNSLR_WriteToFileAt(PNSLR_File handle, i64 offset, PNSLR_ArraySlice(u8) src)
+{
+    i64 bytesWritten = 0;
+    return PNSLR_Internal_TransferFileAt(handle, offset, (PNSLR_ArraySlice(utf8str)) {.data = &src, .count = 1}, false, &bytesWritten);
+}
+
+b8 PNSLR_ScatterReadFromFileAt(PNSLR_File handle, i64 offset, PNSLR_ArraySlice(utf8str) dsts, i64* readSize)
+{
+    i64 bytesRead = 0;
+    b8  success   = PNSLR_Internal_TransferFileAt(handle, offset, dsts, true, &bytesRead);
+    if (readSize) *readSize = bytesRead;
+    return success;
+}
+
+b8 PNSLR_GatherWriteToFileAt(PNSLR_File handle, i64 offset, PNSLR_ArraySlice(utf8str) srcs)
+{
+    i64 bytesWritten = 0;
+    return PNSLR_Internal_TransferFileAt(handle, offset, srcs, false, &bytesWritten);
+}
+
 b8 PNSLR_FormatAndWriteToFile(PNSLR_File handle, utf8str fmtStr, PNSLR_ArraySlice(PNSLR_PrimitiveFmtOptions) args)
 {
     return PNSLR_FormatAndWriteToStream(PNSLR_StreamFromFile(handle), fmtStr, args);
@@ -1056,6 +1569,52 @@ b8 PNSLR_WriteAllContentsToFile(PNSLR_Path path, PNSLR_ArraySlice(u8) src, b8 ap
     return success;
 }
 
+#if PNSLR_LINUX || PNSLR_ANDROID
+
+    // tries the ways of copying that never bring the data into userspace, best first, and returns how
+    // far into the file they got; each one picks up from where the previous one gave up
+    static i64 PNSLR_Internal_CopyFileWithinKernel(i32 input, i32 output, i64 size)
+    {
+        // a reflink shares the data blocks outright (btrfs, xfs, ...), so there's nothing to copy at all
+        if (ioctl(output, FICLONE, input) == 0) { return size; }
+
+        i64 copied = 0;
+
+        // can still be offloaded by the filesystem (server-side copies on nfs/smb, etc.);
+        // raw syscall, since bionic only has a wrapper for it from android 14 onwards
+        while (copied < size)
+        {
+            i64 chunk = size - copied;
+            if (chunk > PNSLR_INTERNAL_MAX_FILE_IO_CHUNK) { chunk = PNSLR_INTERNAL_MAX_FILE_IO_CHUNK; }
+
+            loff_t inputOffset = (loff_t) copied, outputOffset = (loff_t) copied;
+            i64    res         = (i64) syscall(__NR_copy_file_range, input, &inputOffset, output, &outputOffset, (size_t) chunk, 0u);
+            if (res < 0 && errno == EINTR) { continue; }
+            if (res <= 0) { break; } // not supported here (older kernels, across filesystems before 5.3)
+            copied += res;
+        }
+
+        // sendfile writes at the output's cursor, which the positional copies above never moved
+        if (copied < size && lseek(output, (off_t) copied, SEEK_SET) == (off_t) copied)
+        {
+            while (copied < size)
+            {
+                i64 chunk = size - copied;
+                if (chunk > PNSLR_INTERNAL_MAX_FILE_IO_CHUNK) { chunk = PNSLR_INTERNAL_MAX_FILE_IO_CHUNK; }
+
+                off_t   inputOffset = (off_t) copied;
+                ssize_t res         = sendfile(output, input, &inputOffset, (size_t) chunk);
+                if (res < 0 && errno == EINTR) { continue; }
+                if (res <= 0) { break; }
+                copied += (i64) res;
+            }
+        }
+
+        return copied;
+    }
+
+#endif
+
 b8 PNSLR_CopyFile(PNSLR_Path src, PNSLR_Path dst)
 {
     if (!src.path.data || !src.path.count || !dst.path.data || !dst.path.count) { return false; }
@@ -1078,28 +1637,43 @@ b8 PNSLR_CopyFile(PNSLR_Path src, PNSLR_Path dst)
         int input = open(srcTemp, O_RDONLY);
         if (input >= 0)
         {
-            int output = open(dstTemp, O_WRONLY | O_CREAT | O_TRUNC, 0666);
-            if (output < 0) { close(input); }
-            else
+            struct stat inputStat;
+            int output = (fstat(input, &inputStat) == 0) ? open(dstTemp, O_WRONLY | O_CREAT | O_TRUNC, 0666) : -1;
+            if (output >= 0)
             {
-                b8 fail = false;
-                PNSLR_ArraySlice(u8) buffer = PNSLR_MakeSlice(u8, 8192, false, internalAllocator, PNSLR_GET_LOC(), nil);
-                i64 n;
-                while ((n = read(input, buffer.data, (u64) buffer.count)) > 0)
+                i64 copied = 0;
+
+                #if PNSLR_LINUX || PNSLR_ANDROID
+                    copied = PNSLR_Internal_CopyFileWithinKernel(input, output, (i64) inputStat.st_size);
+                #endif
+
+                // whatever's left goes through a buffer, up to wherever the file actually ends
+                // (which covers files that grew in the meantime, or report no size at all)
+                success = true;
+                PNSLR_ArraySlice(u8) buffer = PNSLR_MakeSlice(u8, 32 * 1024, false, internalAllocator, PNSLR_GET_LOC(), nil);
+                for (;;)
                 {
+                    ssize_t n = pread(input, buffer.data, (size_t) buffer.count, (off_t) copied);
+                    if (n < 0 && errno == EINTR) { continue; }
+                    if (n <= 0) { success = (n == 0); break; }
+
                     i64 off = 0;
-                    while (off < n)
+                    while (success && off < n)
                     {
-                        i64 w = write(output, buffer.data + off, (u64) (n - off));
-                        if (w < 0) { fail = true; break; }
-                        off += w;
+                        ssize_t w = pwrite(output, buffer.data + off, (size_t) (n - off), (off_t) (copied + off));
+                        if (w < 0 && errno == EINTR) { continue; }
+                        if (w <= 0) { success = false; }
+                        else        { off += w; }
                     }
+
+                    if (!success) { break; }
+                    copied += n;
                 }
 
-                close(input);
                 close(output);
-                success = (n >= 0) && !fail;
             }
+
+            close(input);
         }
     #endif
 
@@ -1141,3 +1715,253 @@ b8 PNSLR_MoveFile(PNSLR_Path src, PNSLR_Path dst)
     PNSLR_INTERNAL_ALLOCATOR_RESET(Paths, internalAllocator);
     return success;
 }
+
+typedef struct PNSLR_Internal_FileToCopy
+{
+    struct PNSLR_Internal_FileToCopy* next;
+    PNSLR_Path                        src;
+    PNSLR_Path                        dst;
+} PNSLR_Internal_FileToCopy;
+
+typedef struct PNSLR_Internal_DirectoryTreeCopy
+{
+    utf8str                    srcRoot;   // with a trailing slash
+    utf8str                    dstRoot;   // with a trailing slash
+    PNSLR_Allocator            allocator; // only touched while gathering, before any workers start
+    PNSLR_Internal_FileToCopy* files;     // popped off by the workers, under the mutex
+    PNSLR_Mutex                mutex;
+    b8                         success;
+} PNSLR_Internal_DirectoryTreeCopy;
+
+static b8 PNSLR_Internal_GatherDirectoryTreeToCopy(rawptr payload, PNSLR_Path path, b8 isDirectory, b8* exploreCurrentDirectory)
+{
+    PNSLR_Internal_DirectoryTreeCopy* copy = (PNSLR_Internal_DirectoryTreeCopy*) payload;
+
+    utf8str relative = {.data = path.path.data + copy->srcRoot.count, .count = path.path.count - copy->srcRoot.count};
+    utf8str dstPath  = PNSLR_MakeString(copy->dstRoot.count + relative.count, false, copy->allocator, PNSLR_GET_LOC(), nil);
+    if (!dstPath.data) { copy->success = false; return false; }
+
+    PNSLR_MemCopy(dstPath.data,                       copy->dstRoot.data, copy->dstRoot.count);
+    PNSLR_MemCopy(dstPath.data + copy->dstRoot.count, relative.data,      relative.count);
+
+    // directories are made right away, so they all exist before any of the files go in them
+    if (isDirectory)
+    {
+        if (!PNSLR_CreateDirectoryTree((PNSLR_Path) {.path = dstPath})) { copy->success = false; *exploreCurrentDirectory = false; }
+        return true;
+    }
+
+    // the path passed in only lives as long as the visit
+    PNSLR_Internal_FileToCopy* file = PNSLR_New(PNSLR_Internal_FileToCopy, copy->allocator, PNSLR_GET_LOC(), nil);
+    if (!file) { copy->success = false; return false; }
+
+    file->src.path = PNSLR_CloneString(path.path, copy->allocator);
+    file->dst.path = dstPath;
+    file->next     = copy->files;
+    copy->files    = file;
+    return true;
+}
+
+static void PNSLR_Internal_DirectoryTreeCopyWorker(rawptr data)
+{
+    PNSLR_Internal_DirectoryTreeCopy* copy = (PNSLR_Internal_DirectoryTreeCopy*) data;
+
+    for (;;)
+    {
+        PNSLR_LockMutex(&copy->mutex);
+        PNSLR_Internal_FileToCopy* file = copy->files;
+        if (file) { copy->files = file->next; }
+        PNSLR_UnlockMutex(&copy->mutex);
+
+        if (!file) { break; }
+
+        if (!PNSLR_CopyFile(file->src, file->dst))
+        {
+            PNSLR_LockMutex(&copy->mutex);
+            copy->success = false;
+            PNSLR_UnlockMutex(&copy->mutex);
+        }
+    }
+}
+
+b8 PNSLR_CopyDirectoryTree(PNSLR_Path src, PNSLR_Path dst, i32 numWorkerThreads)
+{
+    if (!src.path.data || !src.path.count || !dst.path.data || !dst.path.count) { return false; }
+    if (!PNSLR_PathExists(src, PNSLR_PathExistsCheckType_Directory))         { return false; }
+    if (numWorkerThreads <= 0) { numWorkerThreads = 4; }
+
+    PNSLR_Allocator arena = PNSLR_NewAllocator_Arena(PNSLR_GetAllocator_DefaultHeap(), 64 * 1024, PNSLR_GET_LOC(), nil);
+
+    PNSLR_Internal_DirectoryTreeCopy copy = {.allocator = arena, .success = true};
+    // already normalised, but the directories might've been passed without their trailing slashes
+    // (and the destination can't go through normalisation, since it needn't exist yet)
+    copy.srcRoot = (src.path.data[src.path.count - 1] == '/') ? src.path : PNSLR_ConcatenateStrings(src.path, PNSLR_StringLiteral("/"), arena);
+    copy.dstRoot = (dst.path.data[dst.path.count - 1] == '/') ? dst.path : PNSLR_ConcatenateStrings(dst.path, PNSLR_StringLiteral("/"), arena);
+
+    // copying into itself would keep finding the directories it just made
+    b8 dstInsideSrc = (copy.dstRoot.count >= copy.srcRoot.count) &&
+        PNSLR_AreStringsEqual((utf8str) {.data = copy.dstRoot.data, .count = copy.srcRoot.count}, copy.srcRoot, PNSLR_StringComparisonType_CaseSensitive);
+
+    copy.success = !dstInsideSrc && PNSLR_CreateDirectoryTree((PNSLR_Path) {.path = copy.dstRoot});
+    if (copy.success) { PNSLR_IterateDirectory((PNSLR_Path) {.path = copy.srcRoot}, true, &copy, PNSLR_Internal_GatherDirectoryTreeToCopy); }
+
+    // the calling thread is one of the workers
+    copy.mutex = PNSLR_CreateMutex();
+
+    i32                 numThreads = 0;
+    PNSLR_ThreadHandle* threads    = PNSLR_Allocate(arena, true, (numWorkerThreads - 1) * (i64) sizeof(PNSLR_ThreadHandle), (i32) alignof(PNSLR_ThreadHandle), PNSLR_GET_LOC(), nil);
+    for (i32 i = 0; threads && copy.files && i < numWorkerThreads - 1; i++)
+    {
+        PNSLR_ThreadHandle thread = PNSLR_StartThread(PNSLR_Internal_DirectoryTreeCopyWorker, &copy, PNSLR_StringLiteral("PNSLR_CopyDirTree"));
+        if (PNSLR_IsThreadHandleValid(thread)) { threads[numThreads++] = thread; }
+    }
+
+    PNSLR_Internal_DirectoryTreeCopyWorker(&copy);
+
+    for (i32 i = 0; i < numThreads; i++) { PNSLR_JoinThread(threads[i]); }
+
+    PNSLR_DestroyMutex(&copy.mutex);
+    PNSLR_DestroyAllocator_Arena(arena, PNSLR_GET_LOC(), nil);
+    return copy.success;
+}
+
+// mappings have to start on a boundary of this size, so offsets are aligned down to it, and the
+// difference is skipped in the returned slice; unmapping aligns the slice back down to get the base
+static i64 PNSLR_Internal_GetFileMappingGranularity(void)
+{
+    #if PNSLR_WINDOWS
+        static i64 granularity = 0;
+        if (!granularity)
+        {
+            SYSTEM_INFO info = {0};
+            GetSystemInfo(&info);
+            granularity = (i64) info.dwAllocationGranularity;
+        }
+
+        return granularity;
+    #elif PNSLR_UNIX
+        return (i64) PNSLR_GetVirtualMemoryPageSize();
+    #endif
+}
+
+PNSLR_ArraySlice(u8) PNSLR_MapFile(PNSLR_File handle, PNSLR_FileMappingAccess access, i64 offset, i64 size)
+{
+    if (!handle.handle || offset < 0 || size < 0) { return (PNSLR_ArraySlice(u8)) {0}; }
+
+    i64 fileSize = PNSLR_GetSizeOfFile(handle);
+    if (!size) { size = fileSize - offset; }
+    if (size <= 0 || offset + size > fileSize) { return (PNSLR_ArraySlice(u8)) {0}; }
+
+    i64 granularity   = PNSLR_Internal_GetFileMappingGranularity();
+    i64 alignedOffset = offset - (offset % granularity);
+    i64 mappedSize    = size + (offset - alignedOffset);
+
+    u8* base = nil;
+    #if PNSLR_WINDOWS
+
+        DWORD protect    = (access == PNSLR_FileMappingAccess_ReadWrite)   ? PAGE_READWRITE :
+                           (access == PNSLR_FileMappingAccess_CopyOnWrite) ? PAGE_WRITECOPY : PAGE_READONLY;
+        DWORD viewAccess = (access == PNSLR_FileMappingAccess_ReadWrite)   ? FILE_MAP_WRITE :
+                           (access == PNSLR_FileMappingAccess_CopyOnWrite) ? FILE_MAP_COPY  : FILE_MAP_READ;
+
+        HANDLE mappingObject = CreateFileMappingW((HANDLE) handle.handle, NULL, protect, 0, 0, NULL);
+        if (mappingObject)
+        {
+            base = (u8*) MapViewOfFile(mappingObject, viewAccess, (DWORD) ((u64) alignedOffset >> 32), (DWORD) alignedOffset, (SIZE_T) mappedSize);
+            CloseHandle(mappingObject); // the view keeps it alive
+        }
+
+    #elif PNSLR_UNIX
+
+        i32 protect = PROT_READ | ((access == PNSLR_FileMappingAccess_ReadOnly) ? 0 : PROT_WRITE);
+        i32 flags   = (access == PNSLR_FileMappingAccess_ReadWrite) ? MAP_SHARED : MAP_PRIVATE;
+
+        rawptr mapped = mmap(nil, (size_t) mappedSize, protect, flags, (i32) (i64) handle.handle, (off_t) alignedOffset);
+        if (mapped != MAP_FAILED) { base = (u8*) mapped; }
+
+    #endif
+
+    if (!base) { return (PNSLR_ArraySlice(u8)) {0}; }
+    return (PNSLR_ArraySlice(u8)) {.data = base + (offset - alignedOffset), .count = size};
+}
+
+b8 PNSLR_AdviseFileMapping(PNSLR_ArraySlice(u8) range, PNSLR_FileMappingHint hint)
+{
+    if (!range.data || range.count <= 0) { return false; }
+
+    b8 success = true;
+    #if PNSLR_WINDOWS
+
+        // windows only has a use for the last two
+        if (hint == PNSLR_FileMappingHint_WillNeed)
+        {
+            WIN32_MEMORY_RANGE_ENTRY entry = {.VirtualAddress = range.data, .NumberOfBytes = (SIZE_T) range.count};
+            success = PrefetchVirtualMemory(GetCurrentProcess(), 1, &entry, 0);
+        }
+        else if (hint == PNSLR_FileMappingHint_DontNeed)
+        {
+            VirtualUnlock(range.data, (SIZE_T) range.count); // drops the pages from the working set, always "fails"
+        }
+
+    #elif PNSLR_UNIX
+
+        i32 advice = MADV_NORMAL;
+        switch (hint)
+        {
+            case PNSLR_FileMappingHint_Sequential: advice = MADV_SEQUENTIAL; break;
+            case PNSLR_FileMappingHint_Random:     advice = MADV_RANDOM;     break;
+            case PNSLR_FileMappingHint_WillNeed:   advice = MADV_WILLNEED;   break;
+            case PNSLR_FileMappingHint_DontNeed:   advice = MADV_DONTNEED;   break;
+            default:                               advice = MADV_NORMAL;     break;
+        }
+
+        i64 pageSize = (i64) PNSLR_GetVirtualMemoryPageSize();
+        i64 skipped  = (i64) ((u64) range.data % (u64) pageSize);
+        success = (madvise(range.data - skipped, (size_t) (range.count + skipped), advice) == 0);
+
+    #endif
+
+    return success;
+}
+
+b8 PNSLR_FlushFileMapping(PNSLR_ArraySlice(u8) range)
+{
+    if (!range.data || range.count <= 0) { return false; }
+
+    b8 success = true;
+    #if PNSLR_WINDOWS
+
+        success = FlushViewOfFile(range.data, (SIZE_T) range.count);
+
+    #elif PNSLR_UNIX
+
+        i64 pageSize = (i64) PNSLR_GetVirtualMemoryPageSize();
+        i64 skipped  = (i64) ((u64) range.data % (u64) pageSize);
+        success = (msync(range.data - skipped, (size_t) (range.count + skipped), MS_SYNC) == 0);
+
+    #endif
+
+    return success;
+}
+
+void PNSLR_UnmapFile(PNSLR_ArraySlice(u8) mapping)
+{
+    if (!mapping.data || mapping.count <= 0) { return; }
+
+    i64 skipped = (i64) ((u64) mapping.data % (u64) PNSLR_Internal_GetFileMappingGranularity());
+
+    #if PNSLR_WINDOWS
+
+        UnmapViewOfFile(mapping.data - skipped);
+
+    #elif PNSLR_UNIX
+
+        munmap(mapping.data - skipped, (size_t) (mapping.count + skipped));
+
+    #endif
+}
+
+#undef PNSLR_INTERNAL_DIRECTORY_WALK_MAX_NAME
+#undef PNSLR_INTERNAL_DIRECTORY_WALK_BUFFER_SIZE
+#undef PNSLR_INTERNAL_MAX_IO_VECS
+#undef PNSLR_INTERNAL_MAX_FILE_IO_CHUNK
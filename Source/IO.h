@@ -58,6 +58,44 @@ typedef b8 (*PNSLR_DirectoryIterationVisitorDelegate)(rawptr payload, PNSLR_Path
  */
 void PNSLR_IterateDirectory(PNSLR_Path path, b8 recursive, rawptr visitorPayload, PNSLR_DirectoryIterationVisitorDelegate visitorFunc);
 
+/**
+ * Represents something found while walking a directory tree.
+ * Symbolic links are never followed, and are reported as files.
+ */
+typedef struct PNSLR_DirectoryWalkEntry
+{
+    PNSLR_Path path;        // only valid until the visitor returns; directories end with a slash
+    utf8str    name;        // the last part of the path, without any slash
+    b8         isDirectory;
+    i32        depth;       // 0 for whatever's directly inside the walked directory
+    i64        size;        // in bytes; only filled in if asked for
+    i64        timestamp;   // last modification, as nanoseconds since unix epoch; only filled in if asked for
+} PNSLR_DirectoryWalkEntry;
+
+/**
+ * The signature of the delegate that's called for everything found while walking a directory tree.
+ * Return false to stop the whole walk. Set `exploreCurrentDirectory` to false to skip going into a directory.
+ */
+typedef b8 (*PNSLR_DirectoryWalkVisitorDelegate)(rawptr payload, PNSLR_DirectoryWalkEntry entry, b8* exploreCurrentDirectory);
+
+/**
+ * Walks through a whole directory tree, calling the visitor for everything in it.
+ * A faster alternative to recursive `PNSLR_IterateDirectory` for big trees: it opens each directory
+ * relative to its parent, only asks the filesystem about an entry when the directory listing doesn't
+ * already say what it is, and never allocates per entry.
+ * Sizes and timestamps cost an extra query per entry, so they're only filled in if asked for.
+ * With more than one worker thread (the calling thread being one of them), subdirectories are spread
+ * across them, and the visitor is called from all of them at once, in no particular order.
+ * Returns true if the walk went through to the end, false if it couldn't start or was stopped.
+ */
+b8 PNSLR_WalkDirectoryTree(
+    PNSLR_Path                         path,
+    rawptr                             visitorPayload,
+    PNSLR_DirectoryWalkVisitorDelegate visitorFunc,
+    b8                                 querySizeAndTimestamp OPT_ARG,
+    i32                                numWorkerThreads      OPT_ARG
+);
+
 /**
  * Represents the type of path check to perform when checking if a path exists.
  */
@@ -132,17 +170,49 @@ b8 PNSLR_SeekPositionInFile(PNSLR_File handle, i64 newPos, b8 relative OPT_ARG);
 
 /**
  * Reads data from an opened file at the current position.
+ * Keeps reading until the buffer is full, and is only short at the end of the file.
  * Optionally stores the number of bytes read.
- * Returns true on success, false on failure.
+ * Returns true if the whole buffer was filled, false otherwise.
  */
 b8 PNSLR_ReadFromFile(PNSLR_File handle, PNSLR_ArraySlice(u8) dst, i64* readSize OPT_ARG);
 
 /**
  * Writes data to an opened file at the current position.
+ * Keeps writing until all of it is written.
  * Returns true on success, false on failure.
  */
 b8 PNSLR_WriteToFile(PNSLR_File handle, PNSLR_ArraySlice(u8) src);
 
+/**
+ * Reads data from an opened file at the given offset, without going through the current position,
+ * so multiple threads can read from the same file at once.
+ * Keeps reading until the buffer is full, and is only short at the end of the file.
+ * Optionally stores the number of bytes read.
+ * Returns true if the whole buffer was filled, false otherwise.
+ */
+b8 PNSLR_ReadFromFileAt(PNSLR_File handle, i64 offset, PNSLR_ArraySlice(u8) dst, i64* readSize OPT_ARG);
+
+/**
+ * Writes data to an opened file at the given offset, without going through the current position.
+ * Keeps writing until all of it is written.
+ * Returns true on success, false on failure.
+ */
+b8 PNSLR_WriteToFileAt(PNSLR_File handle, i64 offset, PNSLR_ArraySlice(u8) src);
+
+/**
+ * Reads consecutive data from an opened file at the given offset into multiple buffers
+ * (each one filled before moving onto the next), in as few calls to the OS as possible.
+ * Works the same way as `PNSLR_ReadFromFileAt` otherwise.
+ */
+b8 PNSLR_ScatterReadFromFileAt(PNSLR_File handle, i64 offset, PNSLR_ArraySlice(utf8str) dsts, i64* readSize OPT_ARG);
+
+/**
+ * Writes multiple buffers one after the other to an opened file at the given offset,
+ * in as few calls to the OS as possible.
+ * Works the same way as `PNSLR_WriteToFileAt` otherwise.
+ */
+b8 PNSLR_GatherWriteToFileAt(PNSLR_File handle, i64 offset, PNSLR_ArraySlice(utf8str) srcs);
+
 /**
  * Formats a string with the given format and arguments, writing the
  * result to the file.
@@ -186,15 +256,81 @@ b8 PNSLR_WriteAllContentsToFile(PNSLR_Path path, PNSLR_ArraySlice(u8) src, b8 ap
 
 /**
  * Copies a file from src to dst. If dst exists, it will be overwritten.
+ * Where possible, the data never goes through userspace: on linux this tries a reflink
+ * (so the copy shares its blocks with the original), then copy_file_range, then sendfile,
+ * before falling back to copying through a buffer.
  * Returns true on success, false on failure.
  */
 b8 PNSLR_CopyFile(PNSLR_Path src, PNSLR_Path dst);
 
+/**
+ * Copies everything inside the src directory into the dst directory (which is created if it
+ * doesn't exist), overwriting any files that are already there.
+ * The files are copied by 'numWorkerThreads' threads at once (defaults to 4), one of which is
+ * the calling thread; this returns once all of them are done.
+ * Returns true if everything was copied, false otherwise.
+ */
+b8 PNSLR_CopyDirectoryTree(PNSLR_Path src, PNSLR_Path dst, i32 numWorkerThreads OPT_ARG);
+
 /**
  * Moves a file from src to dst. If dst exists, it will be overwritten.
  * Returns true on success, false on failure.
  */
 b8 PNSLR_MoveFile(PNSLR_Path src, PNSLR_Path dst);
 
+/**
+ * Represents how a memory-mapped file can be accessed.
+ * Copy-on-write mappings can be written to, but the changes are never written back to the file.
+ * Read-write mappings need a file that was opened for both reading and writing.
+ */
+ENUM_START(PNSLR_FileMappingAccess, u8)
+    #define PNSLR_FileMappingAccess_ReadOnly    ((PNSLR_FileMappingAccess) 0)
+    #define PNSLR_FileMappingAccess_CopyOnWrite ((PNSLR_FileMappingAccess) 1)
+    #define PNSLR_FileMappingAccess_ReadWrite   ((PNSLR_FileMappingAccess) 2)
+ENUM_END
+
+/**
+ * Represents how a range of a memory-mapped file is going to be used, so the OS can
+ * read ahead (or not) accordingly.
+ */
+ENUM_START(PNSLR_FileMappingHint, u8)
+    #define PNSLR_FileMappingHint_Normal     ((PNSLR_FileMappingHint) 0)
+    #define PNSLR_FileMappingHint_Sequential ((PNSLR_FileMappingHint) 1)
+    #define PNSLR_FileMappingHint_Random     ((PNSLR_FileMappingHint) 2)
+    #define PNSLR_FileMappingHint_WillNeed   ((PNSLR_FileMappingHint) 3)
+    #define PNSLR_FileMappingHint_DontNeed   ((PNSLR_FileMappingHint) 4)
+ENUM_END
+
+/**
+ * Maps 'size' bytes of an opened file, starting at 'offset', into memory; if size is 0,
+ * everything from the offset to the end of the file is mapped. The range has to be within the file,
+ * but the offset doesn't need to be aligned to anything.
+ * The file handle can be closed while the mapping is still in use.
+ * Returns an empty slice on failure.
+ */
+PNSLR_ArraySlice(u8) PNSLR_MapFile(PNSLR_File handle, PNSLR_FileMappingAccess access, i64 offset OPT_ARG, i64 size OPT_ARG);
+
+/**
+ * Tells the OS how a range of a memory-mapped file is going to be used.
+ * The range can be any part of a mapping returned by `PNSLR_MapFile`.
+ * Returns true on success, false on failure.
+ */
+b8 PNSLR_AdviseFileMapping(PNSLR_ArraySlice(u8) range, PNSLR_FileMappingHint hint);
+
+/**
+ * Writes any changes in a range of a read-write memory-mapped file back to the file.
+ * The range can be any part of a mapping returned by `PNSLR_MapFile`.
+ * On Unix this waits for the data to reach the disk. On Windows it only starts the write-back,
+ * since the mapping doesn't keep the file handle around; use `PNSLR_FlushFile` on an open handle
+ * to the same file when the data has to be on disk.
+ * Returns true on success, false on failure.
+ */
+b8 PNSLR_FlushFileMapping(PNSLR_ArraySlice(u8) range);
+
+/**
+ * Unmaps a memory-mapped file. Has to be given exactly what `PNSLR_MapFile` returned.
+ */
+void PNSLR_UnmapFile(PNSLR_ArraySlice(u8) mapping);
+
 EXTERN_C_END
 #endif // PNSLR_IO_H ===============================================================
@@ -1,20 +1,93 @@
 #define PNSLR_IMPLEMENTATION
 #include "Memory.h"
 
-void PNSLR_MemSet(rawptr memory, i32 value, i32 size)
+void PNSLR_MemSet(rawptr memory, i32 value, i64 size)
 {
     if (memory == nil || size <= 0) { return; }
     memset(memory, value, (u64) size);
 }
 
-void PNSLR_MemCopy(rawptr destination, rawptr source, i32 size)
+void PNSLR_MemCopy(rawptr destination, rawptr source, i64 size)
 {
     if (destination == nil || source == nil || size <= 0) { return; }
     memcpy(destination, source, (u64) size);
 }
 
-void PNSLR_MemMove(rawptr destination, rawptr source, i32 size)
+void PNSLR_MemMove(rawptr destination, rawptr source, i64 size)
 {
     if (destination == nil || source == nil || size <= 0) { return; }
     memmove(destination, source, (u64) size);
 }
+
+i32 PNSLR_GetVirtualMemoryPageSize(void)
+{
+    static i32 pageSize = 0;
+    if (pageSize) { return pageSize; }
+
+    #if PNSLR_WINDOWS
+        SYSTEM_INFO info = {0};
+        GetSystemInfo(&info);
+        pageSize = (i32) info.dwPageSize;
+    #elif PNSLR_UNIX
+        pageSize = (i32) sysconf(_SC_PAGESIZE);
+    #endif
+
+    if (pageSize <= 0) { pageSize = 4096; }
+    return pageSize;
+}
+
+rawptr PNSLR_ReserveVirtualMemory(i64 size)
+{
+    if (size <= 0) { return nil; }
+
+    #if PNSLR_WINDOWS
+        return VirtualAlloc(nil, (SIZE_T) size, MEM_RESERVE, PAGE_NOACCESS);
+    #elif PNSLR_UNIX
+        i32 flags = MAP_PRIVATE | MAP_ANONYMOUS;
+        #if PNSLR_LINUX || PNSLR_ANDROID
+            flags |= MAP_NORESERVE;
+        #endif
+
+        rawptr output = mmap(nil, (size_t) size, PROT_NONE, flags, -1, 0);
+        return (output == MAP_FAILED) ? nil : output;
+    #endif
+}
+
+b8 PNSLR_CommitVirtualMemory(rawptr memory, i64 size)
+{
+    if (memory == nil || size <= 0) { return false; }
+
+    #if PNSLR_WINDOWS
+        return VirtualAlloc(memory, (SIZE_T) size, MEM_COMMIT, PAGE_READWRITE) != nil;
+    #elif PNSLR_UNIX
+        return mprotect(memory, (size_t) size, PROT_READ | PROT_WRITE) == 0;
+    #endif
+}
+
+b8 PNSLR_DecommitVirtualMemory(rawptr memory, i64 size)
+{
+    if (memory == nil || size <= 0) { return false; }
+
+    #if PNSLR_WINDOWS
+        return VirtualFree(memory, (SIZE_T) size, MEM_DECOMMIT) != 0;
+    #elif PNSLR_LINUX || PNSLR_ANDROID
+        // private anonymous pages are guaranteed to be zero-filled on the next touch
+        if (madvise(memory, (size_t) size, MADV_DONTNEED) != 0) { return false; }
+        return mprotect(memory, (size_t) size, PROT_NONE) == 0;
+    #elif PNSLR_UNIX
+        // madvise doesn't guarantee zeroed pages here, so map fresh ones over the range instead
+        rawptr output = mmap(memory, (size_t) size, PROT_NONE, MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return output != MAP_FAILED;
+    #endif
+}
+
+b8 PNSLR_ReleaseVirtualMemory(rawptr memory, i64 size)
+{
+    if (memory == nil) { return false; }
+
+    #if PNSLR_WINDOWS
+        return VirtualFree(memory, 0, MEM_RELEASE) != 0;
+    #elif PNSLR_UNIX
+        return munmap(memory, (size_t) size) == 0;
+    #endif
+}
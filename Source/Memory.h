@@ -7,17 +7,47 @@ EXTERN_C_BEGIN
 /**
  * Set a block of memory to a specific value.
  */
-void PNSLR_MemSet(rawptr memory, i32 value, i32 size);
+void PNSLR_MemSet(rawptr memory, i32 value, i64 size);
 
 /**
  * Copy a block of memory from source to destination.
  */
-void PNSLR_MemCopy(rawptr destination, rawptr source, i32 size);
+void PNSLR_MemCopy(rawptr destination, rawptr source, i64 size);
 
 /**
  * Copy a block of memory from source to destination, handling overlapping regions.
  */
-void PNSLR_MemMove(rawptr destination, rawptr source, i32 size);
+void PNSLR_MemMove(rawptr destination, rawptr source, i64 size);
+
+// Virtual Memory ==================================================================
+
+/**
+ * Get the size of a virtual memory page, the granularity at which memory is committed/decommitted.
+ */
+i32 PNSLR_GetVirtualMemoryPageSize(void);
+
+/**
+ * Reserve a range of address space without backing it with physical memory.
+ * Returns nil on failure.
+ */
+rawptr PNSLR_ReserveVirtualMemory(i64 size);
+
+/**
+ * Back a (page-aligned) part of a reserved range with read-write memory.
+ * Freshly committed pages are always zeroed.
+ */
+b8 PNSLR_CommitVirtualMemory(rawptr memory, i64 size);
+
+/**
+ * Return the physical memory behind a (page-aligned) part of a reserved range to the OS.
+ * The range stays reserved, and reads back as zeroes once committed again.
+ */
+b8 PNSLR_DecommitVirtualMemory(rawptr memory, i64 size);
+
+/**
+ * Release an entire range obtained from `PNSLR_ReserveVirtualMemory`.
+ */
+b8 PNSLR_ReleaseVirtualMemory(rawptr memory, i64 size);
 
 EXTERN_C_END
 #endif // PNSLR_MEMORY_H ===========================================================
@@ -172,7 +172,7 @@ b8 PNSLR_GetInterfaceIPAddresses(PNSLR_ArraySlice(PNSLR_IPNetwork)* networks, PN
 
                     struct sockaddr_in* netmask4 = (struct sockaddr_in*) ifa->ifa_netmask;
                     ipMask = PNSLR_MakeSlice(u8, ipLen, false, allocator, PNSLR_GET_LOC(), nil);
-                    PNSLR_MemCopy(ipMask.data, &netmask4->sin_addr, (i32) ipLen);
+                    PNSLR_MemCopy(ipMask.data, &netmask4->sin_addr, ipLen);
                     break;
                 }
                 case AF_INET6:
@@ -183,14 +183,14 @@ b8 PNSLR_GetInterfaceIPAddresses(PNSLR_ArraySlice(PNSLR_IPNetwork)* networks, PN
 
                     struct sockaddr_in6* netmask6 = (struct sockaddr_in6*) ifa->ifa_netmask;
                     ipMask = PNSLR_MakeSlice(u8, ipLen, false, allocator, PNSLR_GET_LOC(), nil);
-                    PNSLR_MemCopy(ipMask.data, &netmask6->sin6_addr, (i32) ipLen);
+                    PNSLR_MemCopy(ipMask.data, &netmask6->sin6_addr, ipLen);
                     break;
                 }
                 default: continue;
             }
 
             ipAddr = PNSLR_MakeSlice(u8, ipLen, false, allocator, PNSLR_GET_LOC(), nil);
-            PNSLR_MemCopy(ipAddr.data, (rawptr) ipBytes, (i32) ipLen);
+            PNSLR_MemCopy(ipAddr.data, (rawptr) ipBytes, ipLen);
 
             if (countTrack >= networksTemp.count)
             {
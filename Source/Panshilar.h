@@ -16,4 +16,6 @@
 #include "Logger.h"
 #include "Threads.h"
 #include "SharedMemoryChannel.h"
+#include "StringInterner.h"
+#include "AsyncIO.h"
 #endif // PNSLR_MAIN_HEADER_H ======================================================
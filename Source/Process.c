@@ -666,7 +666,7 @@ b8 PNSLR_RunProcess(PNSLR_ProcessHandle* outProcessHandle, PNSLR_ArraySlice(utf8
             cwd = PNSLR_CStringFromString(workingDirectory.path, tempAllocator);
 
 
-        cstring* cmd = PNSLR_Allocate(tempAllocator, false, (i32) ((i64) sizeof(cstring) * (execAndArgs.count + 1)), (i32) alignof(cstring), PNSLR_GET_LOC(), nil);
+        cstring* cmd = PNSLR_Allocate(tempAllocator, false, (i64) sizeof(cstring) * (execAndArgs.count + 1), (i32) alignof(cstring), PNSLR_GET_LOC(), nil);
         if (!cmd) goto exitFn;
 
         for (i64 i = 0; i < execAndArgs.count; i++)
@@ -681,7 +681,7 @@ b8 PNSLR_RunProcess(PNSLR_ProcessHandle* outProcessHandle, PNSLR_ArraySlice(utf8
         }
         else
         {
-            cenv = PNSLR_Allocate(tempAllocator, false, (i32) ((i64) sizeof(cstring) * (environmentVariables.count + 1)), (i32) alignof(cstring), PNSLR_GET_LOC(), nil);
+            cenv = PNSLR_Allocate(tempAllocator, false, (i64) sizeof(cstring) * (environmentVariables.count + 1), (i32) alignof(cstring), PNSLR_GET_LOC(), nil);
             if (!cenv) goto exitFn;
             for (i64 i = 0; i < environmentVariables.count; i++)
                 cenv[i] = PNSLR_CStringFromString(environmentVariables.data[i], tempAllocator);
@@ -166,7 +166,7 @@ static b8 PNSLR_Internal_CreatePlatformSMC(utf8str name, i64 size, u8** outData,
     #elif PNSLR_LINUX || PNSLR_OSX
     {
         char nameBuf[256];
-        PNSLR_MemCopy(nameBuf, name.data, (i32) name.count);
+        PNSLR_MemCopy(nameBuf, name.data, name.count);
         nameBuf[name.count] = '\0';
         cstring nativeName = nameBuf;
 
@@ -515,7 +515,7 @@ b8 PNSLR_TryConnectSharedMemoryChannelWriter(utf8str name, PNSLR_SharedMemoryCha
     #elif PNSLR_LINUX || PNSLR_OSX
     {
         char nameBuf[256];
-        PNSLR_MemCopy(nameBuf, name.data, (i32) name.count);
+        PNSLR_MemCopy(nameBuf, name.data, name.count);
         nameBuf[name.count] = '\0';
         cstring nativeName = nameBuf;
 
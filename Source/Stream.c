@@ -1,6 +1,8 @@
 #define PNSLR_IMPLEMENTATION
 #include "Stream.h"
 
+PNSLR_CREATE_INTERNAL_ARENA_ALLOCATOR(Stream, 16);
+
 static b8 PNSLR_Internal_FileStreamProcedure(rawptr streamData, PNSLR_StreamMode mode, PNSLR_ArraySlice(u8) data, i64 offset, i64* extraRet)
 {
     if (!streamData) { return false; }
@@ -159,7 +161,7 @@ static b8 PNSLR_Internal_StringBuilderStreamProcedure(rawptr streamData, PNSLR_S
                 }
 
                 *extraRet = toRead;
-                PNSLR_MemCopy(data.data, sb->buffer.data + sb->cursorPos, (i32) toRead);
+                PNSLR_MemCopy(data.data, sb->buffer.data + sb->cursorPos, toRead);
                 sb->cursorPos += toRead;
                 success = true;
             }
@@ -196,6 +198,86 @@ static b8 PNSLR_Internal_StringBuilderStreamProcedure(rawptr streamData, PNSLR_S
     return success;
 }
 
+static b8 PNSLR_Internal_FileMappingStreamProcedure(rawptr streamData, PNSLR_StreamMode mode, PNSLR_ArraySlice(u8) data, i64 offset, i64* extraRet)
+{
+    if (!streamData) { return false; }
+
+    PNSLR_FileMappingStream* ms = (PNSLR_FileMappingStream*) streamData;
+
+    b8 success = true;
+
+    i64 retAlt = 0;
+    if (!extraRet) { extraRet = &retAlt; }
+
+    *extraRet = 0;
+
+    switch (mode)
+    {
+        case PNSLR_StreamMode_GetSize:
+            *extraRet = ms->mapping.count;
+            break;
+
+        case PNSLR_StreamMode_GetCurrentPos:
+            *extraRet = ms->cursorPos;
+            break;
+
+        case PNSLR_StreamMode_SeekAbsolute:
+            if (offset < 0 || offset > ms->mapping.count) { success = false; }
+            else { ms->cursorPos = offset; }
+            break;
+
+        case PNSLR_StreamMode_SeekRelative:
+            if ((ms->cursorPos + offset) < 0 || (ms->cursorPos + offset) > ms->mapping.count) { success = false; }
+            else { ms->cursorPos += offset; }
+            break;
+
+        case PNSLR_StreamMode_Read:
+            if (!data.data || !data.count || !ms->mapping.data) { success = false; }
+            else if (ms->cursorPos >= ms->mapping.count)       { success = false; } // at or past the end
+            else
+            {
+                i64 toRead = data.count;
+                if (ms->cursorPos + toRead > ms->mapping.count)
+                {
+                    toRead = ms->mapping.count - ms->cursorPos; // clamp to available data
+                }
+
+                *extraRet = toRead;
+                PNSLR_MemCopy(data.data, ms->mapping.data + ms->cursorPos, toRead);
+                ms->cursorPos += toRead;
+            }
+            break;
+
+        case PNSLR_StreamMode_Write:
+            // the mapping can't grow, so a write that doesn't fit doesn't happen at all
+            if (!data.data || !data.count || !ms->mapping.data)     { success = false; }
+            else if (ms->access == PNSLR_FileMappingAccess_ReadOnly) { success = false; }
+            else if (data.count > ms->mapping.count - ms->cursorPos) { success = false; }
+            else
+            {
+                PNSLR_MemCopy(ms->mapping.data + ms->cursorPos, data.data, data.count);
+                ms->cursorPos += data.count;
+            }
+            break;
+
+        case PNSLR_StreamMode_Flush:
+            if (ms->access == PNSLR_FileMappingAccess_ReadWrite) { success = PNSLR_FlushFileMapping(ms->mapping); }
+            break;
+
+        case PNSLR_StreamMode_Close:
+            PNSLR_UnmapFile(ms->mapping);
+            *ms = (PNSLR_FileMappingStream) {0};
+            break;
+
+        case PNSLR_StreamMode_Truncate:
+        default:
+            success = false; // unsupported
+            break;
+    }
+
+    return success;
+}
+
 i64 PNSLR_GetSizeOfStream(PNSLR_Stream stream)
 {
     if (!stream.procedure) { return 0; }
@@ -259,122 +341,71 @@ b8 PNSLR_WriteToStream(PNSLR_Stream stream, PNSLR_ArraySlice(u8) src)
     );
 }
 
-static b8 PNSLR_Internal_WriteFmtOptionsToStream(PNSLR_Stream stream, PNSLR_PrimitiveFmtOptions fmtOpt)
+static PNSLR_IntegerBase PNSLR_Internal_IntegerBaseFromFmtOptions(PNSLR_PrimitiveFmtOptions fmtOpt)
+{
+    PNSLR_IntegerBase ib = (PNSLR_IntegerBase) fmtOpt.valueBufferB;
+    if (ib != PNSLR_IntegerBase_Binary &&
+        ib != PNSLR_IntegerBase_Octal  &&
+        ib != PNSLR_IntegerBase_Decimal &&
+        ib != PNSLR_IntegerBase_HexaDecimal)
+    {
+        ib = PNSLR_IntegerBase_Decimal; // default
+    }
+
+    return ib;
+}
+
+static b8 PNSLR_Internal_AppendFmtOptionsToStringBuilder(PNSLR_StringBuilder* builder, PNSLR_PrimitiveFmtOptions fmtOpt)
 {
     switch (fmtOpt.type)
     {
         case PNSLR_PrimitiveFmtType_CString:
         {
-            utf8str data = PNSLR_StringFromCString(*(cstring*) &fmtOpt.valueBufferA);
-            return PNSLR_WriteToStream(stream, data);
+            return PNSLR_AppendStringToStringBuilder(builder, PNSLR_StringFromCString(*(cstring*) &fmtOpt.valueBufferA));
         }
         case PNSLR_PrimitiveFmtType_String:
         {
             utf8str data = {.data = *(u8**) &fmtOpt.valueBufferA, .count = *(i64*) &fmtOpt.valueBufferB};
-            return PNSLR_WriteToStream(stream, data);
+            return PNSLR_AppendStringToStringBuilder(builder, data);
         }
         case PNSLR_PrimitiveFmtType_Rune:
         {
-            u32 rune = (u32) fmtOpt.valueBufferA;
-            PNSLR_EncodedRune encoded = PNSLR_EncodeRune(rune);
-            utf8str rStr = {.count = (i64) encoded.length, .data = &(encoded.data[0])};
-            return PNSLR_WriteToStream(stream, rStr);
+            return PNSLR_AppendRuneToStringBuilder(builder, (u32) fmtOpt.valueBufferA);
         }
         case PNSLR_PrimitiveFmtType_B8:
         {
-            b8 value = (b8) (!!fmtOpt.valueBufferA);
-            if (value) return PNSLR_WriteToStream(stream, PNSLR_StringLiteral("true" ));
-            else       return PNSLR_WriteToStream(stream, PNSLR_StringLiteral("false"));
-        }
-        case PNSLR_PrimitiveFmtType_F32:
-        case PNSLR_PrimitiveFmtType_F64:
-        case PNSLR_PrimitiveFmtType_U8:
-        case PNSLR_PrimitiveFmtType_U16:
-        case PNSLR_PrimitiveFmtType_U32:
-        case PNSLR_PrimitiveFmtType_U64:
-        case PNSLR_PrimitiveFmtType_I8:
-        case PNSLR_PrimitiveFmtType_I16:
-        case PNSLR_PrimitiveFmtType_I32:
-        case PNSLR_PrimitiveFmtType_I64:
-        {
-            // all of these require formatting to a temporary buffer
-            break;
-        }
-        default:
-        {
-            FORCE_DBG_TRAP;
-            return false;
+            return PNSLR_AppendB8ToStringBuilder(builder, (b8) (!!fmtOpt.valueBufferA));
         }
-    }
-
-    u8 tempBuffer[128] = {0};
-    PNSLR_StringBuilder tempBuilder = {
-        .allocator   = {0},
-        .buffer      = {.data = &(tempBuffer[0]), .count = sizeof(tempBuffer)},
-    };
-
-    switch (fmtOpt.type)
-    {
         case PNSLR_PrimitiveFmtType_F32:
         {
             u32 tmpVal = (u32) fmtOpt.valueBufferA;
             f32 value = *(f32*) &tmpVal;
             i32 decimalPlaces = (i32) fmtOpt.valueBufferB;
-            if (decimalPlaces <  0) decimalPlaces =  0;
+            if (decimalPlaces <  0) decimalPlaces = -1; // shortest round-trip
             if (decimalPlaces > 30) decimalPlaces = 30; // clamp
-            PNSLR_AppendF32ToStringBuilder(&tempBuilder, value, decimalPlaces);
-            break;
+            return PNSLR_AppendF32ToStringBuilder(builder, value, decimalPlaces);
         }
         case PNSLR_PrimitiveFmtType_F64:
         {
             f64 value = *(f64*) &fmtOpt.valueBufferA;
             i32 decimalPlaces = (i32) fmtOpt.valueBufferB;
-            if (decimalPlaces <  0) decimalPlaces =  0;
+            if (decimalPlaces <  0) decimalPlaces = -1; // shortest round-trip
             if (decimalPlaces > 30) decimalPlaces = 30; // clamp
-            PNSLR_AppendF64ToStringBuilder(&tempBuilder, value, decimalPlaces);
-            break;
+            return PNSLR_AppendF64ToStringBuilder(builder, value, decimalPlaces);
         }
         case PNSLR_PrimitiveFmtType_U8:
         case PNSLR_PrimitiveFmtType_U16:
         case PNSLR_PrimitiveFmtType_U32:
         case PNSLR_PrimitiveFmtType_U64:
         {
-            PNSLR_IntegerBase ib = (PNSLR_IntegerBase) fmtOpt.valueBufferB;
-            if (ib != PNSLR_IntegerBase_Binary &&
-                ib != PNSLR_IntegerBase_Octal  &&
-                ib != PNSLR_IntegerBase_Decimal &&
-                ib != PNSLR_IntegerBase_HexaDecimal)
-            {
-                ib = PNSLR_IntegerBase_Decimal; // default
-            }
-
-            PNSLR_AppendU64ToStringBuilder(
-                &tempBuilder,
-                fmtOpt.valueBufferA,
-                ib
-            );
-            break;
+            return PNSLR_AppendU64ToStringBuilder(builder, fmtOpt.valueBufferA, PNSLR_Internal_IntegerBaseFromFmtOptions(fmtOpt));
         }
         case PNSLR_PrimitiveFmtType_I8:
         case PNSLR_PrimitiveFmtType_I16:
         case PNSLR_PrimitiveFmtType_I32:
         case PNSLR_PrimitiveFmtType_I64:
         {
-            PNSLR_IntegerBase ib = (PNSLR_IntegerBase) fmtOpt.valueBufferB;
-            if (ib != PNSLR_IntegerBase_Binary &&
-                ib != PNSLR_IntegerBase_Octal  &&
-                ib != PNSLR_IntegerBase_Decimal &&
-                ib != PNSLR_IntegerBase_HexaDecimal)
-            {
-                ib = PNSLR_IntegerBase_Decimal; // default
-            }
-
-            PNSLR_AppendI64ToStringBuilder(
-                &tempBuilder,
-                *(i64*) &fmtOpt.valueBufferA,
-                ib
-            );
-            break;
+            return PNSLR_AppendI64ToStringBuilder(builder, *(i64*) &fmtOpt.valueBufferA, PNSLR_Internal_IntegerBaseFromFmtOptions(fmtOpt));
         }
         default:
         {
@@ -382,6 +413,51 @@ static b8 PNSLR_Internal_WriteFmtOptionsToStream(PNSLR_Stream stream, PNSLR_Prim
             return false;
         }
     }
+}
+
+// an upper bound on what `PNSLR_Internal_AppendFmtOptionsToStringBuilder` will append
+static i64 PNSLR_Internal_MaxLengthOfFmtOptions(PNSLR_PrimitiveFmtOptions fmtOpt)
+{
+    switch (fmtOpt.type)
+    {
+        case PNSLR_PrimitiveFmtType_CString: return PNSLR_GetCStringLength(*(cstring*) &fmtOpt.valueBufferA);
+        case PNSLR_PrimitiveFmtType_String:  return *(i64*) &fmtOpt.valueBufferB;
+        case PNSLR_PrimitiveFmtType_Rune:    return 4;
+        case PNSLR_PrimitiveFmtType_B8:      return 5;  // "false"
+        case PNSLR_PrimitiveFmtType_F32:
+        case PNSLR_PrimitiveFmtType_F64:     return 64; // sign, 20 integer digits, point, 30 places; or shortest, which is less
+        case PNSLR_PrimitiveFmtType_U8:
+        case PNSLR_PrimitiveFmtType_U16:
+        case PNSLR_PrimitiveFmtType_U32:
+        case PNSLR_PrimitiveFmtType_U64:
+        case PNSLR_PrimitiveFmtType_I8:
+        case PNSLR_PrimitiveFmtType_I16:
+        case PNSLR_PrimitiveFmtType_I32:
+        case PNSLR_PrimitiveFmtType_I64:     return 67; // "-0b" and 64 binary digits
+        default:                             return 0;
+    }
+}
+
+static b8 PNSLR_Internal_WriteFmtOptionsToStream(PNSLR_Stream stream, PNSLR_PrimitiveFmtOptions fmtOpt)
+{
+    // strings go straight through, no need for a copy
+    if (fmtOpt.type == PNSLR_PrimitiveFmtType_CString)
+    {
+        return PNSLR_WriteToStream(stream, PNSLR_StringFromCString(*(cstring*) &fmtOpt.valueBufferA));
+    }
+
+    if (fmtOpt.type == PNSLR_PrimitiveFmtType_String)
+    {
+        return PNSLR_WriteToStream(stream, (utf8str) {.data = *(u8**) &fmtOpt.valueBufferA, .count = *(i64*) &fmtOpt.valueBufferB});
+    }
+
+    u8 tempBuffer[128] = {0};
+    PNSLR_StringBuilder tempBuilder = {
+        .allocator   = {0},
+        .buffer      = {.data = &(tempBuffer[0]), .count = sizeof(tempBuffer)},
+    };
+
+    if (!PNSLR_Internal_AppendFmtOptionsToStringBuilder(&tempBuilder, fmtOpt)) { return false; }
 
     utf8str result = PNSLR_StringFromStringBuilder(&tempBuilder);
     return PNSLR_WriteToStream(stream, result);
@@ -464,6 +540,111 @@ b8 PNSLR_FormatAndWriteToStream(PNSLR_Stream stream, utf8str fmtStr, PNSLR_Array
     return true;
 }
 
+PNSLR_CompiledFormat PNSLR_CompileFormat(utf8str fmtStr, PNSLR_Allocator allocator)
+{
+    // count the placeholders first, so that it's all just the one allocation
+    i64 numPlaceholders = 0;
+    for (i64 i = 0; i < fmtStr.count; ++i)
+    {
+        if (fmtStr.data[i] != '$') { continue; }
+
+        if (i + 1 < fmtStr.count && fmtStr.data[i + 1] == '$') { ++i;              } // escaped
+        else                                                    { ++numPlaceholders; }
+    }
+
+    i64 literalsSize = (numPlaceholders + 1) * (i64) sizeof(utf8str);
+    u8* memory = (u8*) PNSLR_Allocate(allocator, false, literalsSize + fmtStr.count, (i32) alignof(utf8str), PNSLR_GET_LOC(), nil);
+    if (!memory) { return (PNSLR_CompiledFormat) {0}; }
+
+    PNSLR_CompiledFormat format = {
+        .literals       = {.data = (utf8str*) memory, .count = numPlaceholders + 1},
+        .literalsLength = 0,
+        .allocator      = allocator,
+    };
+
+    // the literal runs get packed together after the slice, with the escapes collapsed
+    u8* text         = memory + literalsSize;
+    i64 literalIndex = 0;
+    i64 literalStart = 0;
+    for (i64 i = 0; i < fmtStr.count; ++i)
+    {
+        u8 c = fmtStr.data[i];
+        if (c == '$' && !(i + 1 < fmtStr.count && fmtStr.data[i + 1] == '$'))
+        {
+            format.literals.data[literalIndex++] = (utf8str) {.data = text + literalStart, .count = format.literalsLength - literalStart};
+            literalStart = format.literalsLength;
+            continue;
+        }
+
+        if (c == '$') { ++i; } // escaped, keep just the one
+        text[format.literalsLength++] = c;
+    }
+
+    format.literals.data[literalIndex] = (utf8str) {.data = text + literalStart, .count = format.literalsLength - literalStart};
+    return format;
+}
+
+void PNSLR_FreeCompiledFormat(PNSLR_CompiledFormat* format)
+{
+    if (!format || !format->literals.data) { return; }
+
+    PNSLR_Free(format->allocator, format->literals.data, PNSLR_GET_LOC(), nil);
+    *format = (PNSLR_CompiledFormat) {0};
+}
+
+b8 PNSLR_FormatCompiledAndWriteToStream(PNSLR_Stream stream, PNSLR_CompiledFormat* format, PNSLR_ArraySlice(PNSLR_PrimitiveFmtOptions) args)
+{
+    if (!stream.procedure || !format || !format->literals.data) { return false; }
+
+    i64 numPlaceholders = format->literals.count - 1;
+
+    // same rules as PNSLR_FormatAndWriteToStream for missing/unused args
+    utf8str missingArg    = PNSLR_StringLiteral("{MISSING_ARG}");
+    utf8str unusedArgs    = PNSLR_StringLiteral("{UNUSED_ARGS: ");
+    utf8str unusedArgsSep = PNSLR_StringLiteral(", ");
+    utf8str unusedArgsEnd = PNSLR_StringLiteral("}");
+
+    i64 maxLength = format->literalsLength;
+    for (i64 i = 0; i < args.count; ++i) { maxLength += PNSLR_Internal_MaxLengthOfFmtOptions(args.data[i]); }
+
+    if (numPlaceholders > args.count) { maxLength += (numPlaceholders - args.count) * missingArg.count; }
+    if (args.count > numPlaceholders) { maxLength += unusedArgs.count + (args.count - numPlaceholders) * unusedArgsSep.count + unusedArgsEnd.count; }
+
+    // a string builder gets formatted into directly, anything else gets a single write from scratch memory
+    PNSLR_INTERNAL_ALLOCATOR_INIT(Stream, internalAllocator);
+    PNSLR_StringBuilder  scratch = {.allocator = internalAllocator};
+    b8                   direct  = (stream.procedure == PNSLR_Internal_StringBuilderStreamProcedure);
+    PNSLR_StringBuilder* builder = direct ? (PNSLR_StringBuilder*) stream.data : &scratch;
+
+    b8 success = PNSLR_ReserveSpaceInStringBuilder(builder, maxLength);
+    for (i64 i = 0; success && i <= numPlaceholders; ++i)
+    {
+        success = PNSLR_AppendStringToStringBuilder(builder, format->literals.data[i]);
+        if (!success || i == numPlaceholders) { continue; }
+
+        if (i < args.count) { success = PNSLR_Internal_AppendFmtOptionsToStringBuilder(builder, args.data[i]); }
+        else                { success = PNSLR_AppendStringToStringBuilder(builder, missingArg);                 }
+    }
+
+    if (success && args.count > numPlaceholders)
+    {
+        success = PNSLR_AppendStringToStringBuilder(builder, unusedArgs);
+        for (i64 j = numPlaceholders; success && j < args.count; ++j)
+        {
+            success = PNSLR_Internal_AppendFmtOptionsToStringBuilder(builder, args.data[j]);
+            if (success && j + 1 < args.count) { success = PNSLR_AppendStringToStringBuilder(builder, unusedArgsSep); }
+        }
+
+        if (success) { success = PNSLR_AppendStringToStringBuilder(builder, unusedArgsEnd); }
+    }
+
+    if (success && !direct) { success = PNSLR_WriteToStream(stream, PNSLR_StringFromStringBuilder(&scratch)); }
+
+    PNSLR_INTERNAL_ALLOCATOR_RESET(Stream, internalAllocator);
+    // no need to 'free' the scratch builder, the internal allocator reset will take care
+    return success;
+}
+
 b8 PNSLR_TruncateStream(PNSLR_Stream stream, i64 newSize)
 {
     if (!stream.procedure) { return false; }
@@ -523,6 +704,14 @@ PNSLR_Stream PNSLR_StreamFromStringBuilder(PNSLR_StringBuilder* builder)
     };
 }
 
+PNSLR_Stream PNSLR_StreamFromFileMapping(PNSLR_FileMappingStream* mappingStream)
+{
+    return (PNSLR_Stream) {
+        .procedure = PNSLR_Internal_FileMappingStreamProcedure,
+        .data      = (rawptr) mappingStream
+    };
+}
+
 PNSLR_Stream PNSLR_StreamFromStdOut(b8 disableBuffering)
 {
     static_assert(sizeof(stdout) == sizeof(rawptr), "stdout must be the same size as rawptr");
@@ -544,3 +733,61 @@ PNSLR_Stream PNSLR_StreamFromStdErr(b8 disableBuffering)
         .data      = (rawptr) stderr,
     };
 }
+
+b8 PNSLR_WriteTrackingAllocatorReportToStream(PNSLR_Stream stream, PNSLR_Allocator trackingAllocator, PNSLR_Allocator tempAllocator, i32 maxCallSites)
+{
+    if (!stream.procedure || trackingAllocator.procedure != PNSLR_AllocatorFn_Tracking) { return false; }
+
+    PNSLR_TrackingAllocatorStats stats = PNSLR_GetTrackingAllocatorStats(trackingAllocator);
+
+    b8 success = PNSLR_FormatAndWriteToStream(
+        stream,
+        PNSLR_StringLiteral("Tracking allocator: $ live bytes in $ allocations (peak $ bytes); $ allocations, $ frees, $ resizes, $ bytes total across $ threads.\n"),
+        PNSLR_FmtArgs(
+            PNSLR_FmtI64(stats.liveBytes, PNSLR_IntegerBase_Decimal),
+            PNSLR_FmtI64(stats.liveAllocations, PNSLR_IntegerBase_Decimal),
+            PNSLR_FmtI64(stats.peakBytes, PNSLR_IntegerBase_Decimal),
+            PNSLR_FmtI64(stats.numAllocations, PNSLR_IntegerBase_Decimal),
+            PNSLR_FmtI64(stats.numFrees, PNSLR_IntegerBase_Decimal),
+            PNSLR_FmtI64(stats.numResizes, PNSLR_IntegerBase_Decimal),
+            PNSLR_FmtI64(stats.totalBytes, PNSLR_IntegerBase_Decimal),
+            PNSLR_FmtI32(stats.numThreads, PNSLR_IntegerBase_Decimal)
+        )
+    );
+
+    PNSLR_ArraySlice(PNSLR_TrackingAllocatorCallSite) sites = PNSLR_GetTrackingAllocatorCallSites(trackingAllocator, tempAllocator, PNSLR_GET_LOC(), nil);
+
+    i64 count = (maxCallSites > 0 && maxCallSites < sites.count) ? maxCallSites : sites.count;
+    for (i64 i = 0; success && i < count; ++i)
+    {
+        PNSLR_TrackingAllocatorCallSite site = sites.data[i];
+
+        success = PNSLR_FormatAndWriteToStream(
+            stream,
+            PNSLR_StringLiteral("    $:$ ($) - $ live bytes in $ allocations, $ bytes total in $ allocations.\n"),
+            PNSLR_FmtArgs(
+                PNSLR_FmtString(site.location.file.count ? site.location.file : PNSLR_StringLiteral("<other call sites>")),
+                PNSLR_FmtI32(site.location.line, PNSLR_IntegerBase_Decimal),
+                PNSLR_FmtString(site.location.function),
+                PNSLR_FmtI64(site.liveBytes, PNSLR_IntegerBase_Decimal),
+                PNSLR_FmtI64(site.numAllocations - site.numFrees, PNSLR_IntegerBase_Decimal),
+                PNSLR_FmtI64(site.totalBytes, PNSLR_IntegerBase_Decimal),
+                PNSLR_FmtI64(site.numAllocations, PNSLR_IntegerBase_Decimal)
+            )
+        );
+    }
+
+    if (sites.count > count && success)
+    {
+        success = PNSLR_FormatAndWriteToStream(
+            stream,
+            PNSLR_StringLiteral("    ... and $ more call sites.\n"),
+            PNSLR_FmtArgs(
+                PNSLR_FmtI64(sites.count - count, PNSLR_IntegerBase_Decimal)
+            )
+        );
+    }
+
+    PNSLR_Free(tempAllocator, sites.data, PNSLR_GET_LOC(), nil);
+    return success;
+}
@@ -108,6 +108,44 @@ b8 PNSLR_FlushStream(PNSLR_Stream stream);
  */
 void PNSLR_CloseStream(PNSLR_Stream stream);
 
+// Compiled formats ================================================================
+
+/**
+ * A format string that has been split up ahead of time, for formats that get used
+ * over and over (log lines, etc.). The same rules as `PNSLR_FormatAndWriteToStream`
+ * apply. Create with `PNSLR_CompileFormat`, free with `PNSLR_FreeCompiledFormat`.
+ */
+typedef struct PNSLR_CompiledFormat
+{
+    PNSLR_ArraySlice(utf8str) literals;       // one more than the placeholders, which go in between them
+    i64                       literalsLength; // total, with every "$$" already turned into "$"
+    PNSLR_Allocator           allocator;
+} PNSLR_CompiledFormat;
+
+/**
+ * Splits a format string into the literal runs between its placeholders.
+ * The compiled format does not refer back to 'fmtStr'.
+ * Returns a zeroed compiled format on failure.
+ */
+PNSLR_CompiledFormat PNSLR_CompileFormat(utf8str fmtStr, PNSLR_Allocator allocator);
+
+/**
+ * Frees a compiled format, and zeroes it.
+ */
+void PNSLR_FreeCompiledFormat(PNSLR_CompiledFormat* format);
+
+/**
+ * Formats with a compiled format and writes the result to the stream, in a single
+ * write. The space needed is worked out up front, so nothing gets resized midway.
+ * A string builder stream is formatted into directly.
+ * Returns true on success, false on failure.
+ */
+b8 PNSLR_FormatCompiledAndWriteToStream(
+    PNSLR_Stream stream,
+    PNSLR_CompiledFormat* format,
+    PNSLR_ArraySlice(PNSLR_PrimitiveFmtOptions) args
+);
+
 // Stream casts ====================================================================
 
 /**
@@ -120,6 +158,23 @@ PNSLR_Stream PNSLR_StreamFromFile(PNSLR_File file);
  */
 PNSLR_Stream PNSLR_StreamFromStringBuilder(PNSLR_StringBuilder* builder);
 
+/**
+ * The state of a stream over a memory-mapped file; 'access' has to match what the
+ * mapping was created with. See `PNSLR_StreamFromFileMapping`.
+ */
+typedef struct PNSLR_FileMappingStream
+{
+    PNSLR_ArraySlice(u8)    mapping;
+    PNSLR_FileMappingAccess access;
+    i64                     cursorPos;
+} PNSLR_FileMappingStream;
+
+/**
+ * Creates a stream over a memory-mapped file. Reads and writes go straight to the
+ * mapped memory, and can't go past its end. Closing the stream unmaps the file.
+ */
+PNSLR_Stream PNSLR_StreamFromFileMapping(PNSLR_FileMappingStream* mappingStream);
+
 /**
  * Creates a stream from the standard output pipe.
  */
@@ -130,5 +185,21 @@ PNSLR_Stream PNSLR_StreamFromStdOut(b8 disableBuffering OPT_ARG);
  */
 PNSLR_Stream PNSLR_StreamFromStdErr(b8 disableBuffering OPT_ARG);
 
+// Allocator reports ===============================================================
+
+/**
+ * Writes a report of a tracking allocator to the stream: the overall stats, then one
+ * line per call site (file:line), largest live bytes first.
+ * At most 'maxCallSites' call sites are written, or all of them if it's zero or less.
+ * 'tempAllocator' is used to merge the call sites across threads.
+ * Returns true on success, false on failure.
+ */
+b8 PNSLR_WriteTrackingAllocatorReportToStream(
+    PNSLR_Stream stream,
+    PNSLR_Allocator trackingAllocator,
+    PNSLR_Allocator tempAllocator,
+    i32 maxCallSites OPT_ARG
+);
+
 EXTERN_C_END
 #endif // PNSLR_STREAM_H ===========================================================
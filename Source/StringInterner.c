@@ -0,0 +1,406 @@
+#define PNSLR_IMPLEMENTATION
+#include "StringInterner.h"
+#include "Sync.h"
+#include "Memory.h"
+
+// the table is split into shards by the top bits of the hash, each with its own lock, so threads
+// interning different strings rarely wait on each other; entries live in fixed-size pages that are
+// never moved, which is what lets `PNSLR_GetInternedString` skip the lock entirely
+#define PNSLR_INTERNAL_INTERNER_SHARD_BITS    (4)
+#define PNSLR_INTERNAL_INTERNER_NUM_SHARDS    (1 << PNSLR_INTERNAL_INTERNER_SHARD_BITS)
+#define PNSLR_INTERNAL_INTERNER_PAGE_BITS     (12)
+#define PNSLR_INTERNAL_INTERNER_PAGE_SIZE     (1 << PNSLR_INTERNAL_INTERNER_PAGE_BITS) // entries per page
+#define PNSLR_INTERNAL_INTERNER_MAX_PAGES     (256)                                    // 2^20 strings per shard, 2^24 in all
+#define PNSLR_INTERNAL_INTERNER_MIN_SLOTS     (64)
+#define PNSLR_INTERNAL_INTERNER_ARENA_SIZE    (16 * 1024)
+#define PNSLR_INTERNAL_INTERNER_HASH_SEED     (0)
+
+#define PNSLR_INTERNAL_INTERNER_FILE_MAGIC    ((u32) 'P' | ((u32) 'N' << 8) | ((u32) 'S' << 16) | ((u32) 'I' << 24)) // "PNSI" on disk
+#define PNSLR_INTERNAL_INTERNER_FILE_VERSION  (1)
+
+typedef struct PNSLR_Internal_InternedEntry
+{
+    u64     hash;
+    utf8str str;
+} PNSLR_Internal_InternedEntry;
+
+// open addressing with linear probing; `index` is one more than the entry's index in the shard,
+// so a zeroed slot is an empty one, and `tag` (upper half of the hash) skips most string compares
+typedef struct PNSLR_Internal_InternerSlot
+{
+    u32 tag;
+    u32 index;
+} PNSLR_Internal_InternerSlot;
+
+typedef struct alignas(64) PNSLR_Internal_InternerShard
+{
+    PNSLR_RWMutex                 lock;
+    PNSLR_Allocator               arena;    // pages and string copies
+    PNSLR_Internal_InternerSlot*  slots;
+    i64                           capacity; // number of slots, power of two
+    i64                           count;    // written under the exclusive lock, read atomically
+    PNSLR_Internal_InternedEntry* pages[PNSLR_INTERNAL_INTERNER_MAX_PAGES];
+} PNSLR_Internal_InternerShard;
+
+typedef struct PNSLR_Internal_StringInterner
+{
+    PNSLR_Allocator              allocator;
+    PNSLR_Internal_InternerShard shards[PNSLR_INTERNAL_INTERNER_NUM_SHARDS];
+} PNSLR_Internal_StringInterner;
+
+static inline u32 PNSLR_Internal_ShardOfHash(u64 hash)
+{
+    return (u32) (hash >> (64 - PNSLR_INTERNAL_INTERNER_SHARD_BITS));
+}
+
+static inline PNSLR_Internal_InternedEntry* PNSLR_Internal_GetInternedEntry(PNSLR_Internal_InternerShard* shard, i64 index)
+{
+    return &shard->pages[index >> PNSLR_INTERNAL_INTERNER_PAGE_BITS][index & (PNSLR_INTERNAL_INTERNER_PAGE_SIZE - 1)];
+}
+
+static inline u32 PNSLR_Internal_MakeInternedHandle(u32 shardIdx, u32 localIdx)
+{
+    return ((localIdx << PNSLR_INTERNAL_INTERNER_SHARD_BITS) | shardIdx) + 1;
+}
+
+// returns one more than the index of the matching entry, or 0 if there's none; caller holds the lock
+static u32 PNSLR_Internal_FindInShard(PNSLR_Internal_InternerShard* shard, utf8str str, u64 hash)
+{
+    if (!shard->capacity) { return 0; }
+
+    u64 mask = (u64) shard->capacity - 1;
+    u32 tag  = (u32) (hash >> 32);
+    for (u64 i = hash & mask; ; i = (i + 1) & mask)
+    {
+        PNSLR_Internal_InternerSlot slot = shard->slots[i];
+        if (!slot.index) { return 0; }
+        if (slot.tag != tag) { continue; }
+
+        PNSLR_Internal_InternedEntry* entry = PNSLR_Internal_GetInternedEntry(shard, (i64) slot.index - 1);
+        if (entry->hash == hash && PNSLR_AreStringsEqual(entry->str, str, PNSLR_StringComparisonType_CaseSensitive)) { return slot.index; }
+    }
+}
+
+static void PNSLR_Internal_PlaceInShardSlots(PNSLR_Internal_InternerSlot* slots, i64 capacity, u64 hash, u32 index)
+{
+    u64 mask = (u64) capacity - 1;
+    u64 i    = hash & mask;
+    while (slots[i].index) { i = (i + 1) & mask; }
+    slots[i] = (PNSLR_Internal_InternerSlot) {.tag = (u32) (hash >> 32), .index = index};
+}
+
+// makes sure `count` entries fit in the slots without going past 3/4 full; caller holds the exclusive lock
+static b8 PNSLR_Internal_ReserveInShard(PNSLR_Allocator allocator, PNSLR_Internal_InternerShard* shard, i64 count)
+{
+    if (count * 4 <= shard->capacity * 3) { return true; }
+
+    i64 newCapacity = shard->capacity ? shard->capacity : PNSLR_INTERNAL_INTERNER_MIN_SLOTS;
+    while (count * 4 > newCapacity * 3) { newCapacity *= 2; }
+
+    PNSLR_Internal_InternerSlot* newSlots = PNSLR_Allocate(
+        allocator,
+        true,
+        newCapacity * (i64) sizeof(PNSLR_Internal_InternerSlot),
+        (i32) alignof(PNSLR_Internal_InternerSlot),
+        PNSLR_GET_LOC(),
+        nil
+    );
+
+    if (!newSlots) { return false; }
+
+    // the hashes are kept with the entries, so nothing has to be rehashed
+    for (i64 i = 0; i < shard->count; i++)
+    {
+        PNSLR_Internal_InternedEntry* entry = PNSLR_Internal_GetInternedEntry(shard, i);
+        PNSLR_Internal_PlaceInShardSlots(newSlots, newCapacity, entry->hash, (u32) (i + 1));
+    }
+
+    if (shard->slots) { PNSLR_Free(allocator, shard->slots, PNSLR_GET_LOC(), nil); }
+    shard->slots    = newSlots;
+    shard->capacity = newCapacity;
+    return true;
+}
+
+// copies the string in and returns one more than its index, or 0 on failure; caller holds the
+// exclusive lock and has already checked that the string isn't there
+static u32 PNSLR_Internal_AddToShard(PNSLR_Allocator allocator, PNSLR_Internal_InternerShard* shard, utf8str str, u64 hash)
+{
+    i64 index = shard->count;
+    if (index >= (i64) PNSLR_INTERNAL_INTERNER_PAGE_SIZE * PNSLR_INTERNAL_INTERNER_MAX_PAGES) { return 0; }
+    if (!PNSLR_Internal_ReserveInShard(allocator, shard, index + 1))                         { return 0; }
+
+    i64 pageIdx = index >> PNSLR_INTERNAL_INTERNER_PAGE_BITS;
+    if (!shard->pages[pageIdx])
+    {
+        shard->pages[pageIdx] = PNSLR_Allocate(
+            shard->arena,
+            false,
+            PNSLR_INTERNAL_INTERNER_PAGE_SIZE * (i64) sizeof(PNSLR_Internal_InternedEntry),
+            (i32) alignof(PNSLR_Internal_InternedEntry),
+            PNSLR_GET_LOC(),
+            nil
+        );
+
+        if (!shard->pages[pageIdx]) { return 0; }
+    }
+
+    u8* copy = PNSLR_Allocate(shard->arena, false, str.count + 1, 1, PNSLR_GET_LOC(), nil);
+    if (!copy) { return 0; }
+
+    if (str.count) { PNSLR_MemCopy(copy, str.data, str.count); }
+    copy[str.count] = 0;
+
+    *PNSLR_Internal_GetInternedEntry(shard, index) = (PNSLR_Internal_InternedEntry) {.hash = hash, .str = {.data = copy, .count = str.count}};
+    PNSLR_Internal_PlaceInShardSlots(shard->slots, shard->capacity, hash, (u32) (index + 1));
+
+    // publishes the entry to lock-free readers of `PNSLR_GetInternedString`
+    PNSLR_AtomicStoreI64(&shard->count, index + 1);
+    return (u32) (index + 1);
+}
+
+PNSLR_StringInterner PNSLR_CreateStringInterner(PNSLR_Allocator allocator)
+{
+    PNSLR_Internal_StringInterner* internal = PNSLR_Allocate(
+        allocator,
+        true,
+        (i64) sizeof(PNSLR_Internal_StringInterner),
+        (i32) alignof(PNSLR_Internal_StringInterner),
+        PNSLR_GET_LOC(),
+        nil
+    );
+
+    if (!internal) { return (PNSLR_StringInterner) {0}; }
+
+    PNSLR_StringInterner output = {.data = internal};
+    internal->allocator = allocator;
+
+    b8 success = true;
+    for (i32 i = 0; i < PNSLR_INTERNAL_INTERNER_NUM_SHARDS; i++)
+    {
+        PNSLR_Internal_InternerShard* shard = &internal->shards[i];
+        shard->lock = PNSLR_CreateRWMutex();
+
+        if (success)
+        {
+            PNSLR_AllocatorError err = PNSLR_AllocatorError_None;
+            shard->arena = PNSLR_NewAllocator_Arena(allocator, PNSLR_INTERNAL_INTERNER_ARENA_SIZE, PNSLR_GET_LOC(), &err);
+            success      = (err == PNSLR_AllocatorError_None) && shard->arena.procedure;
+        }
+    }
+
+    if (!success) { PNSLR_DestroyStringInterner(&output); }
+    return output;
+}
+
+void PNSLR_DestroyStringInterner(PNSLR_StringInterner* interner)
+{
+    if (!interner || !interner->data) { return; }
+
+    PNSLR_Internal_StringInterner* internal = (PNSLR_Internal_StringInterner*) interner->data;
+    for (i32 i = 0; i < PNSLR_INTERNAL_INTERNER_NUM_SHARDS; i++)
+    {
+        PNSLR_Internal_InternerShard* shard = &internal->shards[i];
+        if (shard->slots)           { PNSLR_Free(internal->allocator, shard->slots, PNSLR_GET_LOC(), nil); }
+        if (shard->arena.procedure) { PNSLR_DestroyAllocator_Arena(shard->arena, PNSLR_GET_LOC(), nil); }
+        PNSLR_DestroyRWMutex(&shard->lock);
+    }
+
+    PNSLR_Free(internal->allocator, internal, PNSLR_GET_LOC(), nil);
+    interner->data = nil;
+}
+
+u32 PNSLR_InternString(PNSLR_StringInterner interner, utf8str str)
+{
+    PNSLR_Internal_StringInterner* internal = (PNSLR_Internal_StringInterner*) interner.data;
+    if (!internal || str.count < 0 || str.count >= 0xFFFFFFFF) { return 0; }
+
+    u64                           hash     = PNSLR_HashString(str, PNSLR_INTERNAL_INTERNER_HASH_SEED);
+    u32                           shardIdx = PNSLR_Internal_ShardOfHash(hash);
+    PNSLR_Internal_InternerShard* shard    = &internal->shards[shardIdx];
+
+    // most calls find the string already there, and those only need the shared lock
+    PNSLR_LockRWMutexShared(&shard->lock);
+    u32 localIdx = PNSLR_Internal_FindInShard(shard, str, hash);
+    PNSLR_UnlockRWMutexShared(&shard->lock);
+
+    if (!localIdx)
+    {
+        PNSLR_LockRWMutexExclusive(&shard->lock);
+        localIdx = PNSLR_Internal_FindInShard(shard, str, hash); // someone may have got here first
+        if (!localIdx) { localIdx = PNSLR_Internal_AddToShard(internal->allocator, shard, str, hash); }
+        PNSLR_UnlockRWMutexExclusive(&shard->lock);
+    }
+
+    return localIdx ? PNSLR_Internal_MakeInternedHandle(shardIdx, localIdx - 1) : 0;
+}
+
+u32 PNSLR_FindInternedString(PNSLR_StringInterner interner, utf8str str)
+{
+    PNSLR_Internal_StringInterner* internal = (PNSLR_Internal_StringInterner*) interner.data;
+    if (!internal || str.count < 0) { return 0; }
+
+    u64                           hash     = PNSLR_HashString(str, PNSLR_INTERNAL_INTERNER_HASH_SEED);
+    u32                           shardIdx = PNSLR_Internal_ShardOfHash(hash);
+    PNSLR_Internal_InternerShard* shard    = &internal->shards[shardIdx];
+
+    PNSLR_LockRWMutexShared(&shard->lock);
+    u32 localIdx = PNSLR_Internal_FindInShard(shard, str, hash);
+    PNSLR_UnlockRWMutexShared(&shard->lock);
+
+    return localIdx ? PNSLR_Internal_MakeInternedHandle(shardIdx, localIdx - 1) : 0;
+}
+
+utf8str PNSLR_GetInternedString(PNSLR_StringInterner interner, u32 handle)
+{
+    PNSLR_Internal_StringInterner* internal = (PNSLR_Internal_StringInterner*) interner.data;
+    if (!internal || !handle) { return (utf8str) {0}; }
+
+    u32                           shardIdx = (handle - 1) & (PNSLR_INTERNAL_INTERNER_NUM_SHARDS - 1);
+    i64                           localIdx = (i64) ((handle - 1) >> PNSLR_INTERNAL_INTERNER_SHARD_BITS);
+    PNSLR_Internal_InternerShard* shard    = &internal->shards[shardIdx];
+
+    // entries never move once published, so there's nothing to lock
+    if (localIdx >= PNSLR_AtomicLoadI64(&shard->count)) { return (utf8str) {0}; }
+    return PNSLR_Internal_GetInternedEntry(shard, localIdx)->str;
+}
+
+i64 PNSLR_GetInternedStringsCount(PNSLR_StringInterner interner)
+{
+    PNSLR_Internal_StringInterner* internal = (PNSLR_Internal_StringInterner*) interner.data;
+    if (!internal) { return 0; }
+
+    i64 count = 0;
+    for (i32 i = 0; i < PNSLR_INTERNAL_INTERNER_NUM_SHARDS; i++) { count += PNSLR_AtomicLoadI64(&internal->shards[i].count); }
+    return count;
+}
+
+// snapshot layout, all little-endian:
+//     u32 magic, u32 version, u32 number of shards, u32 reserved
+//     for each shard: u32 number of strings, then for each string in order: u32 length, bytes
+// handles are worked out from the order of the strings in their shard, so loading the strings
+// back in that same order hands out the same handles; the hashes are recomputed on load
+
+static inline void PNSLR_Internal_WriteU32ToSnapshot(u8** cursor, u32 value)
+{
+    for (i32 i = 0; i < (i32) sizeof(u32); i++) { (*cursor)[i] = (u8) (value >> (8 * i)); }
+    *cursor += sizeof(u32);
+}
+
+static inline b8 PNSLR_Internal_ReadU32FromSnapshot(PNSLR_ArraySlice(u8) contents, i64* offset, u32* value)
+{
+    if (contents.count - *offset < (i64) sizeof(u32)) { return false; }
+    *value = 0;
+    for (i32 i = 0; i < (i32) sizeof(u32); i++) { *value |= (u32) contents.data[*offset + i] << (8 * i); }
+    *offset += (i64) sizeof(u32);
+    return true;
+}
+
+b8 PNSLR_SaveStringInternerToFile(PNSLR_StringInterner interner, PNSLR_Path path)
+{
+    PNSLR_Internal_StringInterner* internal = (PNSLR_Internal_StringInterner*) interner.data;
+    if (!internal) { return false; }
+
+    // every shard is held for the whole snapshot, so it's consistent across all of them;
+    // writers only ever take one shard lock at a time, so this can't deadlock with them
+    for (i32 i = 0; i < PNSLR_INTERNAL_INTERNER_NUM_SHARDS; i++) { PNSLR_LockRWMutexShared(&internal->shards[i].lock); }
+
+    i64 size = 4 * (i64) sizeof(u32) + PNSLR_INTERNAL_INTERNER_NUM_SHARDS * (i64) sizeof(u32);
+    for (i32 i = 0; i < PNSLR_INTERNAL_INTERNER_NUM_SHARDS; i++)
+    {
+        PNSLR_Internal_InternerShard* shard = &internal->shards[i];
+        for (i64 j = 0; j < shard->count; j++) { size += (i64) sizeof(u32) + PNSLR_Internal_GetInternedEntry(shard, j)->str.count; }
+    }
+
+    PNSLR_ArraySlice(u8) buffer = PNSLR_MakeSlice(u8, size, false, internal->allocator, PNSLR_GET_LOC(), nil);
+    if (buffer.data)
+    {
+        u8* cursor = buffer.data;
+        PNSLR_Internal_WriteU32ToSnapshot(&cursor, PNSLR_INTERNAL_INTERNER_FILE_MAGIC);
+        PNSLR_Internal_WriteU32ToSnapshot(&cursor, PNSLR_INTERNAL_INTERNER_FILE_VERSION);
+        PNSLR_Internal_WriteU32ToSnapshot(&cursor, PNSLR_INTERNAL_INTERNER_NUM_SHARDS);
+        PNSLR_Internal_WriteU32ToSnapshot(&cursor, 0);
+
+        for (i32 i = 0; i < PNSLR_INTERNAL_INTERNER_NUM_SHARDS; i++)
+        {
+            PNSLR_Internal_InternerShard* shard = &internal->shards[i];
+            PNSLR_Internal_WriteU32ToSnapshot(&cursor, (u32) shard->count);
+
+            for (i64 j = 0; j < shard->count; j++)
+            {
+                utf8str str = PNSLR_Internal_GetInternedEntry(shard, j)->str;
+                PNSLR_Internal_WriteU32ToSnapshot(&cursor, (u32) str.count);
+                if (str.count) { PNSLR_MemCopy(cursor, str.data, str.count); }
+                cursor += str.count;
+            }
+        }
+    }
+
+    for (i32 i = 0; i < PNSLR_INTERNAL_INTERNER_NUM_SHARDS; i++) { PNSLR_UnlockRWMutexShared(&internal->shards[i].lock); }
+
+    if (!buffer.data) { return false; }
+
+    b8 success = PNSLR_WriteAllContentsToFile(path, buffer, false);
+    PNSLR_Free(internal->allocator, buffer.data, PNSLR_GET_LOC(), nil);
+    return success;
+}
+
+PNSLR_StringInterner PNSLR_LoadStringInternerFromFile(PNSLR_Path path, PNSLR_Allocator allocator)
+{
+    PNSLR_ArraySlice(u8) contents = {0};
+    if (!PNSLR_ReadAllContentsFromFile(path, &contents, allocator)) { return (PNSLR_StringInterner) {0}; }
+
+    PNSLR_StringInterner interner = PNSLR_CreateStringInterner(allocator);
+    PNSLR_Internal_StringInterner* internal = (PNSLR_Internal_StringInterner*) interner.data;
+
+    i64 offset = 0;
+    u32 magic = 0, version = 0, numShards = 0, reserved = 0;
+    b8 success = internal &&
+                 PNSLR_Internal_ReadU32FromSnapshot(contents, &offset, &magic)     && magic     == PNSLR_INTERNAL_INTERNER_FILE_MAGIC   &&
+                 PNSLR_Internal_ReadU32FromSnapshot(contents, &offset, &version)   && version   == PNSLR_INTERNAL_INTERNER_FILE_VERSION &&
+                 PNSLR_Internal_ReadU32FromSnapshot(contents, &offset, &numShards) && numShards == PNSLR_INTERNAL_INTERNER_NUM_SHARDS   &&
+                 PNSLR_Internal_ReadU32FromSnapshot(contents, &offset, &reserved);
+
+    // nobody else can see the interner yet, so the shards are filled without locking
+    for (u32 i = 0; success && i < PNSLR_INTERNAL_INTERNER_NUM_SHARDS; i++)
+    {
+        PNSLR_Internal_InternerShard* shard = &internal->shards[i];
+
+        u32 count = 0;
+        success = PNSLR_Internal_ReadU32FromSnapshot(contents, &offset, &count) &&
+                  (i64) count <= (i64) PNSLR_INTERNAL_INTERNER_PAGE_SIZE * PNSLR_INTERNAL_INTERNER_MAX_PAGES &&
+                  PNSLR_Internal_ReserveInShard(allocator, shard, (i64) count);
+
+        for (u32 j = 0; success && j < count; j++)
+        {
+            u32 length = 0;
+            success = PNSLR_Internal_ReadU32FromSnapshot(contents, &offset, &length) && (i64) length <= contents.count - offset;
+            if (!success) { break; }
+
+            utf8str str  = {.data = contents.data + offset, .count = (i64) length};
+            u64     hash = PNSLR_HashString(str, PNSLR_INTERNAL_INTERNER_HASH_SEED);
+            offset += (i64) length;
+
+            // a string in the wrong shard, or twice in one, would get a different handle than it had
+            success = PNSLR_Internal_ShardOfHash(hash) == i &&
+                      !PNSLR_Internal_FindInShard(shard, str, hash) &&
+                      PNSLR_Internal_AddToShard(allocator, shard, str, hash) == j + 1;
+        }
+    }
+
+    success = success && offset == contents.count;
+
+    PNSLR_Free(allocator, contents.data, PNSLR_GET_LOC(), nil);
+    if (!success) { PNSLR_DestroyStringInterner(&interner); }
+    return interner;
+}
+
+#undef PNSLR_INTERNAL_INTERNER_FILE_VERSION
+#undef PNSLR_INTERNAL_INTERNER_FILE_MAGIC
+#undef PNSLR_INTERNAL_INTERNER_HASH_SEED
+#undef PNSLR_INTERNAL_INTERNER_ARENA_SIZE
+#undef PNSLR_INTERNAL_INTERNER_MIN_SLOTS
+#undef PNSLR_INTERNAL_INTERNER_MAX_PAGES
+#undef PNSLR_INTERNAL_INTERNER_PAGE_SIZE
+#undef PNSLR_INTERNAL_INTERNER_PAGE_BITS
+#undef PNSLR_INTERNAL_INTERNER_NUM_SHARDS
+#undef PNSLR_INTERNAL_INTERNER_SHARD_BITS
@@ -0,0 +1,68 @@
+#ifndef PNSLR_STRING_INTERNER_H // =================================================
+#define PNSLR_STRING_INTERNER_H
+#include "__Prelude.h"
+#include "Allocators.h"
+#include "Strings.h"
+#include "IO.h"
+EXTERN_C_BEGIN
+
+// String Interner =================================================================
+
+/**
+ * A table of unique strings, each one given a small handle that never changes.
+ * Two interned strings are equal exactly when their handles are, so comparing or
+ * hashing them afterwards is a single integer operation.
+ * Interning and lookups are safe to do from multiple threads at once.
+ * The handle 0 never refers to a string.
+ */
+typedef struct PNSLR_StringInterner { rawptr data; } PNSLR_StringInterner;
+
+/**
+ * Creates an empty string interner. All of its memory, including the copies of the
+ * interned strings, comes from the provided allocator, which has to be thread-safe
+ * if strings are going to be interned from more than one thread.
+ */
+PNSLR_StringInterner PNSLR_CreateStringInterner(PNSLR_Allocator allocator);
+
+/**
+ * Destroys a string interner. Every string obtained from it is invalid afterwards.
+ */
+void PNSLR_DestroyStringInterner(PNSLR_StringInterner* interner);
+
+/**
+ * Returns the handle for a string, copying it into the interner if it wasn't there already.
+ * Returns 0 if the string could not be added.
+ */
+u32 PNSLR_InternString(PNSLR_StringInterner interner, utf8str str);
+
+/**
+ * Returns the handle for a string if it has already been interned, or 0 if it hasn't.
+ * Never adds anything to the interner.
+ */
+u32 PNSLR_FindInternedString(PNSLR_StringInterner interner, utf8str str);
+
+/**
+ * Returns the string for a handle, or an empty string if the handle is not valid.
+ * The returned string is null-terminated, and lives as long as the interner does.
+ */
+utf8str PNSLR_GetInternedString(PNSLR_StringInterner interner, u32 handle);
+
+/**
+ * Returns the number of strings in the interner.
+ */
+i64 PNSLR_GetInternedStringsCount(PNSLR_StringInterner interner);
+
+/**
+ * Writes all the strings in the interner to a file, such that loading it back
+ * gives every string the same handle it has now.
+ */
+b8 PNSLR_SaveStringInternerToFile(PNSLR_StringInterner interner, PNSLR_Path path);
+
+/**
+ * Creates a string interner from a file written by `PNSLR_SaveStringInternerToFile`.
+ * Returns an interner with no data if the file could not be read or is not valid.
+ */
+PNSLR_StringInterner PNSLR_LoadStringInternerFromFile(PNSLR_Path path, PNSLR_Allocator allocator);
+
+EXTERN_C_END
+#endif // PNSLR_STRING_INTERNER_H ==================================================
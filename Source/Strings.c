@@ -5,6 +5,278 @@
 
 PNSLR_CREATE_INTERNAL_ARENA_ALLOCATOR(Strings, 60);
 
+// 16-byte SIMD helpers; masks from `PNSLR_Internal_SimdEqualMask` have
+// PNSLR_INTERNAL_SIMD_MASK_BITS bits per byte (neon has no movemask, so it's a nibble there)
+
+#if PNSLR_X64
+
+    #define PNSLR_INTERNAL_SIMD_WIDTH     16
+    #define PNSLR_INTERNAL_SIMD_MASK_BITS 1
+    #define PNSLR_INTERNAL_SIMD_BYTE_MASK 0x1ULL
+    #define PNSLR_INTERNAL_SIMD_FULL_MASK 0xFFFFULL
+
+    typedef __m128i PNSLR_Internal_SimdU8;
+
+    static inline PNSLR_Internal_SimdU8 PNSLR_Internal_SimdLoad(const u8* data)                          { return _mm_loadu_si128((const __m128i*) data); }
+    static inline void                  PNSLR_Internal_SimdStore(u8* data, PNSLR_Internal_SimdU8 value) { _mm_storeu_si128((__m128i*) data, value); }
+    static inline PNSLR_Internal_SimdU8 PNSLR_Internal_SimdSplat(u8 value)                               { return _mm_set1_epi8((char) value); }
+
+    static inline u64 PNSLR_Internal_SimdEqualMask(PNSLR_Internal_SimdU8 a, PNSLR_Internal_SimdU8 b)
+    {
+        return (u64) (u32) _mm_movemask_epi8(_mm_cmpeq_epi8(a, b));
+    }
+
+    static inline PNSLR_Internal_SimdU8 PNSLR_Internal_SimdToLowerASCII(PNSLR_Internal_SimdU8 value)
+    {
+        // shift 'A'..'Z' down to the bottom of the signed range, so one signed compare finds them
+        __m128i shifted = _mm_add_epi8(value, _mm_set1_epi8((char) (0x80 - 'A')));
+        __m128i isUpper = _mm_cmplt_epi8(shifted, _mm_set1_epi8((char) (-128 + 26)));
+        return _mm_or_si128(value, _mm_and_si128(isUpper, _mm_set1_epi8(0x20)));
+    }
+
+    static inline PNSLR_Internal_SimdU8 PNSLR_Internal_SimdToUpperASCII(PNSLR_Internal_SimdU8 value)
+    {
+        __m128i shifted = _mm_add_epi8(value, _mm_set1_epi8((char) (0x80 - 'a')));
+        __m128i isLower = _mm_cmplt_epi8(shifted, _mm_set1_epi8((char) (-128 + 26)));
+        return _mm_xor_si128(value, _mm_and_si128(isLower, _mm_set1_epi8(0x20)));
+    }
+
+    static inline PNSLR_Internal_SimdU8 PNSLR_Internal_SimdOr(PNSLR_Internal_SimdU8 a, PNSLR_Internal_SimdU8 b) { return _mm_or_si128(a, b); }
+    static inline b8                    PNSLR_Internal_SimdIsASCII(PNSLR_Internal_SimdU8 value)                { return _mm_movemask_epi8(value) == 0; }
+
+    // number of bytes that start a utf-8 sequence, i.e. aren't continuation bytes (0x80..0xbf)
+    static i64 PNSLR_Internal_SimdCountLeadBytes(const u8* data, i64 numBlocks)
+    {
+        i64     total = 0;
+        __m128i limit = _mm_set1_epi8((char) 0xbf); // as signed, continuation bytes are -128..-65
+        while (numBlocks > 0)
+        {
+            // per-byte counters can take 255 blocks before they wrap
+            i64     batch = (numBlocks < 255) ? numBlocks : 255;
+            __m128i acc   = _mm_setzero_si128();
+            for (i64 i = 0; i < batch; ++i)
+            {
+                __m128i isLead = _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*) (data + i * 16)), limit);
+                acc = _mm_sub_epi8(acc, isLead);
+            }
+
+            __m128i sums = _mm_sad_epu8(acc, _mm_setzero_si128());
+            total += _mm_cvtsi128_si32(sums) + _mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+
+            data      += batch * 16;
+            numBlocks -= batch;
+        }
+
+        return total;
+    }
+
+    // widens 16 ascii bytes to utf-16 code units
+    static inline void PNSLR_Internal_SimdWidenASCII(PNSLR_Internal_SimdU8 value, u16* dst)
+    {
+        _mm_storeu_si128((__m128i*) dst,       _mm_unpacklo_epi8(value, _mm_setzero_si128()));
+        _mm_storeu_si128((__m128i*) (dst + 8), _mm_unpackhi_epi8(value, _mm_setzero_si128()));
+    }
+
+    // narrows 16 utf-16 code units to bytes, only if all of them are ascii
+    static inline b8 PNSLR_Internal_SimdNarrowASCII(const u16* src, u8* dst)
+    {
+        __m128i lo       = _mm_loadu_si128((const __m128i*) src);
+        __m128i hi       = _mm_loadu_si128((const __m128i*) (src + 8));
+        __m128i nonASCII = _mm_and_si128(_mm_or_si128(lo, hi), _mm_set1_epi16((short) 0xff80));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonASCII, _mm_setzero_si128())) != 0xffff) { return false; }
+
+        _mm_storeu_si128((__m128i*) dst, _mm_packus_epi16(lo, hi));
+        return true;
+    }
+
+    // bytes needed to encode 8 utf-16 code units as utf-8, or -1 if any of them is a surrogate
+    static inline i64 PNSLR_Internal_SimdUTF8LengthOfUTF16(const u16* src)
+    {
+        __m128i units = _mm_loadu_si128((const __m128i*) src);
+        __m128i top5  = _mm_and_si128(units, _mm_set1_epi16((short) 0xf800));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(top5, _mm_set1_epi16((short) 0xd800)))) { return -1; }
+
+        // 3 bytes each, one less below 0x800 and another one less below 0x80 (compares give -1)
+        __m128i below80  = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short) 0xff80)), _mm_setzero_si128());
+        __m128i below800 = _mm_cmpeq_epi16(top5, _mm_setzero_si128());
+        __m128i lengths  = _mm_add_epi16(_mm_set1_epi16(3), _mm_add_epi16(below80, below800));
+
+        __m128i sums = _mm_sad_epu8(lengths, _mm_setzero_si128());
+        return _mm_cvtsi128_si32(sums) + _mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+    }
+
+#elif PNSLR_ARM64
+
+    #define PNSLR_INTERNAL_SIMD_WIDTH     16
+    #define PNSLR_INTERNAL_SIMD_MASK_BITS 4
+    #define PNSLR_INTERNAL_SIMD_BYTE_MASK 0xFULL
+    #define PNSLR_INTERNAL_SIMD_FULL_MASK 0xFFFFFFFFFFFFFFFFULL
+
+    typedef uint8x16_t PNSLR_Internal_SimdU8;
+
+    static inline PNSLR_Internal_SimdU8 PNSLR_Internal_SimdLoad(const u8* data)                          { return vld1q_u8(data); }
+    static inline void                  PNSLR_Internal_SimdStore(u8* data, PNSLR_Internal_SimdU8 value) { vst1q_u8(data, value); }
+    static inline PNSLR_Internal_SimdU8 PNSLR_Internal_SimdSplat(u8 value)                               { return vdupq_n_u8(value); }
+
+    static inline u64 PNSLR_Internal_SimdEqualMask(PNSLR_Internal_SimdU8 a, PNSLR_Internal_SimdU8 b)
+    {
+        uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(vceqq_u8(a, b)), 4);
+        return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+    }
+
+    static inline PNSLR_Internal_SimdU8 PNSLR_Internal_SimdToLowerASCII(PNSLR_Internal_SimdU8 value)
+    {
+        uint8x16_t isUpper = vcltq_u8(vsubq_u8(value, vdupq_n_u8('A')), vdupq_n_u8(26));
+        return vorrq_u8(value, vandq_u8(isUpper, vdupq_n_u8(0x20)));
+    }
+
+    static inline PNSLR_Internal_SimdU8 PNSLR_Internal_SimdToUpperASCII(PNSLR_Internal_SimdU8 value)
+    {
+        uint8x16_t isLower = vcltq_u8(vsubq_u8(value, vdupq_n_u8('a')), vdupq_n_u8(26));
+        return veorq_u8(value, vandq_u8(isLower, vdupq_n_u8(0x20)));
+    }
+
+    static inline PNSLR_Internal_SimdU8 PNSLR_Internal_SimdOr(PNSLR_Internal_SimdU8 a, PNSLR_Internal_SimdU8 b) { return vorrq_u8(a, b); }
+    static inline b8                    PNSLR_Internal_SimdIsASCII(PNSLR_Internal_SimdU8 value)                { return vmaxvq_u8(value) < 0x80; }
+
+    // number of bytes that start a utf-8 sequence, i.e. aren't continuation bytes (0x80..0xbf)
+    static i64 PNSLR_Internal_SimdCountLeadBytes(const u8* data, i64 numBlocks)
+    {
+        i64      total = 0;
+        int8x16_t limit = vdupq_n_s8((i8) -65); // as signed, continuation bytes are -128..-65
+        while (numBlocks > 0)
+        {
+            // per-byte counters can take 255 blocks before they wrap
+            i64        batch = (numBlocks < 255) ? numBlocks : 255;
+            uint8x16_t acc   = vdupq_n_u8(0);
+            for (i64 i = 0; i < batch; ++i)
+            {
+                uint8x16_t isLead = vcgtq_s8(vreinterpretq_s8_u8(vld1q_u8(data + i * 16)), limit);
+                acc = vsubq_u8(acc, isLead);
+            }
+
+            total += vaddlvq_u8(acc);
+
+            data      += batch * 16;
+            numBlocks -= batch;
+        }
+
+        return total;
+    }
+
+    // widens 16 ascii bytes to utf-16 code units
+    static inline void PNSLR_Internal_SimdWidenASCII(PNSLR_Internal_SimdU8 value, u16* dst)
+    {
+        vst1q_u16(dst,     vmovl_u8(vget_low_u8(value)));
+        vst1q_u16(dst + 8, vmovl_high_u8(value));
+    }
+
+    // narrows 16 utf-16 code units to bytes, only if all of them are ascii
+    static inline b8 PNSLR_Internal_SimdNarrowASCII(const u16* src, u8* dst)
+    {
+        uint16x8_t lo = vld1q_u16(src);
+        uint16x8_t hi = vld1q_u16(src + 8);
+        if (vmaxvq_u16(vorrq_u16(lo, hi)) >= 0x80) { return false; }
+
+        vst1q_u8(dst, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+        return true;
+    }
+
+    // bytes needed to encode 8 utf-16 code units as utf-8, or -1 if any of them is a surrogate
+    static inline i64 PNSLR_Internal_SimdUTF8LengthOfUTF16(const u16* src)
+    {
+        uint16x8_t units = vld1q_u16(src);
+        uint16x8_t top5  = vandq_u16(units, vdupq_n_u16(0xf800));
+        if (vmaxvq_u16(vceqq_u16(top5, vdupq_n_u16(0xd800)))) { return -1; }
+
+        // 1 byte each, one more from 0x80 and another one more from 0x800 (compares give all-ones)
+        uint16x8_t lengths = vdupq_n_u16(1);
+        lengths = vsubq_u16(lengths, vcgeq_u16(units, vdupq_n_u16(0x80)));
+        lengths = vsubq_u16(lengths, vcgeq_u16(units, vdupq_n_u16(0x800)));
+        return vaddvq_u16(lengths);
+    }
+
+#endif
+
+static inline i32 PNSLR_Internal_CountTrailingZerosU64(u64 value)
+{
+    #if PNSLR_MSVC
+        unsigned long index = 0;
+        _BitScanForward64(&index, value);
+        return (i32) index;
+    #elif PNSLR_CLANG || PNSLR_GCC
+        return __builtin_ctzll(value);
+    #else
+        #error "Unsupported compiler."
+    #endif
+}
+
+static inline i32 PNSLR_Internal_CountLeadingZerosU64(u64 value)
+{
+    #if PNSLR_MSVC
+        unsigned long index = 0;
+        _BitScanReverse64(&index, value);
+        return 63 - (i32) index;
+    #elif PNSLR_CLANG || PNSLR_GCC
+        return __builtin_clzll(value);
+    #else
+        #error "Unsupported compiler."
+    #endif
+}
+
+static inline u8 PNSLR_Internal_ToLowerASCII(u8 c)
+{
+    return (c >= 'A' && c <= 'Z') ? (u8) (c | 0x20) : c;
+}
+
+static inline u8 PNSLR_Internal_ToUpperASCII(u8 c)
+{
+    return (c >= 'a' && c <= 'z') ? (u8) (c & ~0x20) : c;
+}
+
+static inline b8 PNSLR_Internal_AreBytesEqual(const u8* a, const u8* b, i32 length, b8 ignoreCase)
+{
+    if (length <= 0) { return true; }
+    if (!ignoreCase) { return memcmp(a, b, (u64) (u32) length) == 0; }
+
+    i32 i = 0;
+
+    #ifdef PNSLR_INTERNAL_SIMD_WIDTH
+        for (; i + PNSLR_INTERNAL_SIMD_WIDTH <= length; i += PNSLR_INTERNAL_SIMD_WIDTH)
+        {
+            PNSLR_Internal_SimdU8 blockA = PNSLR_Internal_SimdToLowerASCII(PNSLR_Internal_SimdLoad(a + i));
+            PNSLR_Internal_SimdU8 blockB = PNSLR_Internal_SimdToLowerASCII(PNSLR_Internal_SimdLoad(b + i));
+            if (PNSLR_Internal_SimdEqualMask(blockA, blockB) != PNSLR_INTERNAL_SIMD_FULL_MASK) { return false; }
+        }
+    #endif
+
+    for (; i < length; ++i)
+    {
+        if (PNSLR_Internal_ToLowerASCII(a[i]) != PNSLR_Internal_ToLowerASCII(b[i])) { return false; }
+    }
+
+    return true;
+}
+
+static void PNSLR_Internal_ChangeCaseASCII(u8* data, i64 length, b8 toUpper)
+{
+    i64 i = 0;
+
+    #ifdef PNSLR_INTERNAL_SIMD_WIDTH
+        for (; i + PNSLR_INTERNAL_SIMD_WIDTH <= length; i += PNSLR_INTERNAL_SIMD_WIDTH)
+        {
+            PNSLR_Internal_SimdU8 block = PNSLR_Internal_SimdLoad(data + i);
+            block = toUpper ? PNSLR_Internal_SimdToUpperASCII(block) : PNSLR_Internal_SimdToLowerASCII(block);
+            PNSLR_Internal_SimdStore(data + i, block);
+        }
+    #endif
+
+    for (; i < length; ++i)
+    {
+        data[i] = toUpper ? PNSLR_Internal_ToUpperASCII(data[i]) : PNSLR_Internal_ToLowerASCII(data[i]);
+    }
+}
+
 i32 PNSLR_GetCStringLength(cstring str)
 {
     if (str == nil) { return 0; }
@@ -26,7 +298,7 @@ cstring PNSLR_CStringFromString(utf8str str, PNSLR_Allocator allocator)
     cstring result = PNSLR_MakeCString(str.count, false, allocator, PNSLR_GET_LOC(), nil);
     if (result == nil) { return nil; } // allocation failed
 
-    PNSLR_MemCopy(result, str.data, (i32) str.count);
+    PNSLR_MemCopy(result, str.data, str.count);
     result[str.count] = '\0'; // null-terminate the C-style string
 
     return result;
@@ -42,7 +314,7 @@ utf8str PNSLR_CloneString(utf8str str, PNSLR_Allocator allocator)
     utf8str result = PNSLR_MakeString(str.count, false, allocator, PNSLR_GET_LOC(), nil);
     if (result.data == nil) { return (utf8str) {0}; } // allocation failed
 
-    PNSLR_MemCopy(result.data, str.data, (i32) str.count);
+    PNSLR_MemCopy(result.data, str.data, str.count);
     return result;
 }
 
@@ -51,8 +323,8 @@ utf8str PNSLR_ConcatenateStrings(utf8str str1, utf8str str2, PNSLR_Allocator all
     utf8str result = PNSLR_MakeString(str1.count + str2.count, false, allocator, PNSLR_GET_LOC(), nil);
     if (result.data == nil) { return (utf8str) {0}; } // allocation failed
 
-    PNSLR_MemCopy(result.data,              str1.data, (i32) str1.count);
-    PNSLR_MemCopy(result.data + str1.count, str2.data, (i32) str2.count);
+    PNSLR_MemCopy(result.data,              str1.data, str1.count);
+    PNSLR_MemCopy(result.data + str1.count, str2.data, str2.count);
     return result;
 }
 
@@ -61,14 +333,7 @@ utf8str PNSLR_UpperString(utf8str str, PNSLR_Allocator allocator)
     utf8str copy = PNSLR_CloneString(str, allocator);
     if (copy.data == nil) { return (utf8str) {0}; }
 
-    for (i32 i = 0; i < copy.count; ++i)
-    {
-        if (copy.data[i] >= 'a' && copy.data[i] <= 'z')
-        {
-            copy.data[i] -= ('a' - 'A'); // convert to uppercase
-        }
-    }
-
+    PNSLR_Internal_ChangeCaseASCII(copy.data, copy.count, true);
     return copy;
 }
 
@@ -77,14 +342,7 @@ utf8str PNSLR_LowerString(utf8str str, PNSLR_Allocator allocator)
     utf8str copy = PNSLR_CloneString(str, allocator);
     if (copy.data == nil) { return (utf8str) {0}; }
 
-    for (i32 i = 0; i < copy.count; ++i)
-    {
-        if (copy.data[i] >= 'A' && copy.data[i] <= 'Z')
-        {
-            copy.data[i] += ('a' - 'A'); // convert to lowercase
-        }
-    }
-
+    PNSLR_Internal_ChangeCaseASCII(copy.data, copy.count, false);
     return copy;
 }
 
@@ -97,21 +355,7 @@ static b8 PNSLR_Internal_AreStringsEqual(cstring str1, i32 len1, cstring str2, i
     if (len1 == 0)    { return true;  } // both are empty strings
     if (str1 == str2) { return true;  } // same pointer, same string
 
-    for (i32 i = 0; i < len1; ++i)
-    {
-        char c1 = str1[i];
-        char c2 = str2[i];
-
-        if (comparisonType == PNSLR_StringComparisonType_CaseInsensitive)
-        {
-            if (c1 >= 'A' && c1 <= 'Z') { c1 += ('a' - 'A'); }
-            if (c2 >= 'A' && c2 <= 'Z') { c2 += ('a' - 'A'); }
-        }
-
-        if (c1 != c2) { return false; }
-    }
-
-    return true;
+    return PNSLR_Internal_AreBytesEqual((const u8*) str1, (const u8*) str2, len1, comparisonType == PNSLR_StringComparisonType_CaseInsensitive);
 }
 
 static b8 PNSLR_Internal_StringStartsWith(cstring str, i32 strLen, cstring prefix, i32 prefixLen, PNSLR_StringComparisonType comparisonType)
@@ -121,21 +365,7 @@ static b8 PNSLR_Internal_StringStartsWith(cstring str, i32 strLen, cstring prefi
 
     if (strLen < prefixLen) { return false; }
 
-    for (i32 i = 0; i < prefixLen; ++i)
-    {
-        char c1 = str[i];
-        char c2 = prefix[i];
-
-        if (comparisonType == PNSLR_StringComparisonType_CaseInsensitive)
-        {
-            if (c1 >= 'A' && c1 <= 'Z') { c1 += ('a' - 'A'); }
-            if (c2 >= 'A' && c2 <= 'Z') { c2 += ('a' - 'A'); }
-        }
-
-        if (c1 != c2) { return false; }
-    }
-
-    return true;
+    return PNSLR_Internal_AreBytesEqual((const u8*) str, (const u8*) prefix, prefixLen, comparisonType == PNSLR_StringComparisonType_CaseInsensitive);
 }
 
 static b8 PNSLR_Internal_StringEndsWith(cstring str, i32 strLen, cstring suffix, i32 suffixLen, PNSLR_StringComparisonType comparisonType)
@@ -145,21 +375,7 @@ static b8 PNSLR_Internal_StringEndsWith(cstring str, i32 strLen, cstring suffix,
 
     if (strLen < suffixLen) { return false; }
 
-    for (i32 i = 0; i < suffixLen; ++i)
-    {
-        char c1 = str[strLen - suffixLen + i];
-        char c2 = suffix[i];
-
-        if (comparisonType == PNSLR_StringComparisonType_CaseInsensitive)
-        {
-            if (c1 >= 'A' && c1 <= 'Z') { c1 += ('a' - 'A'); }
-            if (c2 >= 'A' && c2 <= 'Z') { c2 += ('a' - 'A'); }
-        }
-
-        if (c1 != c2) { return false; }
-    }
-
-    return true;
+    return PNSLR_Internal_AreBytesEqual((const u8*) str + (strLen - suffixLen), (const u8*) suffix, suffixLen, comparisonType == PNSLR_StringComparisonType_CaseInsensitive);
 }
 
 b8 PNSLR_AreStringsEqual(utf8str str1, utf8str str2, PNSLR_StringComparisonType comparisonType)
@@ -217,46 +433,175 @@ b8 PNSLR_CStringEndsWithCString(utf8str str, cstring suffix, PNSLR_StringCompari
     return PNSLR_Internal_StringEndsWith((cstring) str.data, (i32) str.count, suffix, (i32) PNSLR_GetCStringLength(suffix), comparisonType);
 }
 
-i32 PNSLR_SearchFirstIndexInString(utf8str str, utf8str substring, PNSLR_StringComparisonType comparisonType)
+// needles at least this long skip ahead with boyer-moore-horspool instead of filtering every position
+#define PNSLR_INTERNAL_SEARCH_HORSPOOL_MIN_LENGTH 32
+
+static i32 PNSLR_Internal_SearchFirstIndexHorspool(const u8* str, i32 strLen, const u8* sub, i32 subLen, b8 ignoreCase)
 {
-    if (str.data == nil || str.count == 0 || substring.data == nil || substring.count == 0)
+    i32 skip[256];
+    for (i32 i = 0; i < 256; ++i) { skip[i] = subLen; }
+    for (i32 i = 0; i < subLen - 1; ++i)
     {
-        return -1; // invalid input
+        u8 c = ignoreCase ? PNSLR_Internal_ToLowerASCII(sub[i]) : sub[i];
+        skip[c] = subLen - 1 - i;
+        if (ignoreCase && c >= 'a' && c <= 'z') { skip[c - ('a' - 'A')] = subLen - 1 - i; }
+    }
+
+    u8 last = ignoreCase ? PNSLR_Internal_ToLowerASCII(sub[subLen - 1]) : sub[subLen - 1];
+    for (i32 i = 0; i <= strLen - subLen;)
+    {
+        u8 c = str[i + subLen - 1];
+        if ((ignoreCase ? PNSLR_Internal_ToLowerASCII(c) : c) == last && PNSLR_Internal_AreBytesEqual(str + i, sub, subLen - 1, ignoreCase))
+        {
+            return i;
+        }
+
+        i += skip[c];
     }
 
-    i32 strLen = (i32) str.count;
-    i32 subLen = (i32) substring.count;
+    return -1;
+}
+
+static i32 PNSLR_Internal_SearchLastIndexHorspool(const u8* str, i32 strLen, const u8* sub, i32 subLen, b8 ignoreCase)
+{
+    // mirror image of the forward search, keyed on the byte under the start of the needle
+    i32 skip[256];
+    for (i32 i = 0; i < 256; ++i) { skip[i] = subLen; }
+    for (i32 i = subLen - 1; i > 0; --i)
+    {
+        u8 c = ignoreCase ? PNSLR_Internal_ToLowerASCII(sub[i]) : sub[i];
+        skip[c] = i;
+        if (ignoreCase && c >= 'a' && c <= 'z') { skip[c - ('a' - 'A')] = i; }
+    }
 
-    for (i32 i = 0; i <= strLen - subLen; ++i)
+    u8 first = ignoreCase ? PNSLR_Internal_ToLowerASCII(sub[0]) : sub[0];
+    for (i32 i = strLen - subLen; i >= 0;)
     {
-        if (PNSLR_Internal_AreStringsEqual((cstring) str.data + i, subLen, (cstring) substring.data, subLen, comparisonType))
+        u8 c = str[i];
+        if ((ignoreCase ? PNSLR_Internal_ToLowerASCII(c) : c) == first && PNSLR_Internal_AreBytesEqual(str + i + 1, sub + 1, subLen - 1, ignoreCase))
         {
-            return i; // found at index i
+            return i;
         }
+
+        i -= skip[c];
     }
 
-    return -1; // not found
+    return -1;
 }
 
-i32 PNSLR_SearchLastIndexInString(utf8str str, utf8str substring, PNSLR_StringComparisonType comparisonType)
+static i32 PNSLR_Internal_SearchFirstIndex(const u8* str, i32 strLen, const u8* sub, i32 subLen, b8 ignoreCase)
 {
-    if (str.data == nil || str.count == 0 || substring.data == nil || substring.count == 0)
+    if (subLen > strLen) { return -1; }
+    if (subLen >= PNSLR_INTERNAL_SEARCH_HORSPOOL_MIN_LENGTH) { return PNSLR_Internal_SearchFirstIndexHorspool(str, strLen, sub, subLen, ignoreCase); }
+
+    u8 first = ignoreCase ? PNSLR_Internal_ToLowerASCII(sub[0])          : sub[0];
+    u8 last  = ignoreCase ? PNSLR_Internal_ToLowerASCII(sub[subLen - 1]) : sub[subLen - 1];
+    i32 i    = 0;
+
+    #ifdef PNSLR_INTERNAL_SIMD_WIDTH
     {
-        return -1; // invalid input
+        // only positions where both the first and the last byte of the needle match are worth a closer look
+        PNSLR_Internal_SimdU8 firstVec = PNSLR_Internal_SimdSplat(first);
+        PNSLR_Internal_SimdU8 lastVec  = PNSLR_Internal_SimdSplat(last);
+
+        for (; i + subLen - 1 + PNSLR_INTERNAL_SIMD_WIDTH <= strLen; i += PNSLR_INTERNAL_SIMD_WIDTH)
+        {
+            PNSLR_Internal_SimdU8 firstBlock = PNSLR_Internal_SimdLoad(str + i);
+            PNSLR_Internal_SimdU8 lastBlock  = PNSLR_Internal_SimdLoad(str + i + subLen - 1);
+            if (ignoreCase)
+            {
+                firstBlock = PNSLR_Internal_SimdToLowerASCII(firstBlock);
+                lastBlock  = PNSLR_Internal_SimdToLowerASCII(lastBlock);
+            }
+
+            u64 mask = PNSLR_Internal_SimdEqualMask(firstBlock, firstVec) & PNSLR_Internal_SimdEqualMask(lastBlock, lastVec);
+            while (mask)
+            {
+                i32 offset = PNSLR_Internal_CountTrailingZerosU64(mask) / PNSLR_INTERNAL_SIMD_MASK_BITS;
+                if (PNSLR_Internal_AreBytesEqual(str + i + offset + 1, sub + 1, subLen - 2, ignoreCase)) { return i + offset; }
+                mask &= ~(PNSLR_INTERNAL_SIMD_BYTE_MASK << (offset * PNSLR_INTERNAL_SIMD_MASK_BITS));
+            }
+        }
+    }
+    #endif
+
+    for (; i <= strLen - subLen; ++i)
+    {
+        u8 c1 = ignoreCase ? PNSLR_Internal_ToLowerASCII(str[i])              : str[i];
+        u8 c2 = ignoreCase ? PNSLR_Internal_ToLowerASCII(str[i + subLen - 1]) : str[i + subLen - 1];
+        if (c1 == first && c2 == last && PNSLR_Internal_AreBytesEqual(str + i + 1, sub + 1, subLen - 2, ignoreCase)) { return i; }
     }
 
-    i32 strLen = (i32) str.count;
-    i32 subLen = (i32) substring.count;
+    return -1;
+}
+
+static i32 PNSLR_Internal_SearchLastIndex(const u8* str, i32 strLen, const u8* sub, i32 subLen, b8 ignoreCase)
+{
+    if (subLen > strLen) { return -1; }
+    if (subLen >= PNSLR_INTERNAL_SEARCH_HORSPOOL_MIN_LENGTH) { return PNSLR_Internal_SearchLastIndexHorspool(str, strLen, sub, subLen, ignoreCase); }
 
-    for (i32 i = strLen - subLen; i >= 0; --i)
+    u8 first = ignoreCase ? PNSLR_Internal_ToLowerASCII(sub[0])          : sub[0];
+    u8 last  = ignoreCase ? PNSLR_Internal_ToLowerASCII(sub[subLen - 1]) : sub[subLen - 1];
+    i32 i    = strLen - subLen; // last position still to be checked
+
+    #ifdef PNSLR_INTERNAL_SIMD_WIDTH
     {
-        if (PNSLR_Internal_AreStringsEqual((cstring) str.data + i, subLen, (cstring) substring.data, subLen, comparisonType))
+        PNSLR_Internal_SimdU8 firstVec = PNSLR_Internal_SimdSplat(first);
+        PNSLR_Internal_SimdU8 lastVec  = PNSLR_Internal_SimdSplat(last);
+
+        for (; i + 1 >= PNSLR_INTERNAL_SIMD_WIDTH; i -= PNSLR_INTERNAL_SIMD_WIDTH)
         {
-            return i; // found at index i
+            i32 base = i + 1 - PNSLR_INTERNAL_SIMD_WIDTH;
+
+            PNSLR_Internal_SimdU8 firstBlock = PNSLR_Internal_SimdLoad(str + base);
+            PNSLR_Internal_SimdU8 lastBlock  = PNSLR_Internal_SimdLoad(str + base + subLen - 1);
+            if (ignoreCase)
+            {
+                firstBlock = PNSLR_Internal_SimdToLowerASCII(firstBlock);
+                lastBlock  = PNSLR_Internal_SimdToLowerASCII(lastBlock);
+            }
+
+            u64 mask = PNSLR_Internal_SimdEqualMask(firstBlock, firstVec) & PNSLR_Internal_SimdEqualMask(lastBlock, lastVec);
+            while (mask)
+            {
+                i32 offset = (63 - PNSLR_Internal_CountLeadingZerosU64(mask)) / PNSLR_INTERNAL_SIMD_MASK_BITS;
+                if (PNSLR_Internal_AreBytesEqual(str + base + offset + 1, sub + 1, subLen - 2, ignoreCase)) { return base + offset; }
+                mask &= ~(PNSLR_INTERNAL_SIMD_BYTE_MASK << (offset * PNSLR_INTERNAL_SIMD_MASK_BITS));
+            }
         }
     }
+    #endif
+
+    for (; i >= 0; --i)
+    {
+        u8 c1 = ignoreCase ? PNSLR_Internal_ToLowerASCII(str[i])              : str[i];
+        u8 c2 = ignoreCase ? PNSLR_Internal_ToLowerASCII(str[i + subLen - 1]) : str[i + subLen - 1];
+        if (c1 == first && c2 == last && PNSLR_Internal_AreBytesEqual(str + i + 1, sub + 1, subLen - 2, ignoreCase)) { return i; }
+    }
+
+    return -1;
+}
+
+i32 PNSLR_SearchFirstIndexInString(utf8str str, utf8str substring, PNSLR_StringComparisonType comparisonType)
+{
+    if (str.data == nil || str.count == 0 || substring.data == nil || substring.count == 0)
+    {
+        return -1; // invalid input
+    }
+
+    b8 ignoreCase = (comparisonType == PNSLR_StringComparisonType_CaseInsensitive);
+    return PNSLR_Internal_SearchFirstIndex(str.data, (i32) str.count, substring.data, (i32) substring.count, ignoreCase);
+}
+
+i32 PNSLR_SearchLastIndexInString(utf8str str, utf8str substring, PNSLR_StringComparisonType comparisonType)
+{
+    if (str.data == nil || str.count == 0 || substring.data == nil || substring.count == 0)
+    {
+        return -1; // invalid input
+    }
 
-    return -1; // not found
+    b8 ignoreCase = (comparisonType == PNSLR_StringComparisonType_CaseInsensitive);
+    return PNSLR_Internal_SearchLastIndex(str.data, (i32) str.count, substring.data, (i32) substring.count, ignoreCase);
 }
 
 utf8str PNSLR_ReplaceInString(utf8str str, utf8str oldValue, utf8str newValue, PNSLR_Allocator allocator, PNSLR_StringComparisonType comparisonType)
@@ -319,40 +664,352 @@ utf8str PNSLR_ReplaceInString(utf8str str, utf8str oldValue, utf8str newValue, P
     return output;
 }
 
-#define PNSLR_RUNE_ERROR 0xfffd
-#define PNSLR_MAX_RUNE 0x0010ffff
+// byte scans for splitting; small sets of bytes are matched a block at a time, bigger ones go
+// through a 256-bit table instead
 
-#define PNSLR_SURROGATE_MIN 0xd800
-#define PNSLR_SURROGATE_MAX 0xdfff
+#define PNSLR_INTERNAL_MAX_SIMD_BYTE_SET 8
 
-#define PNSLR_MASKX 0x3f
-#define PNSLR_MASK2 0x1f
-#define PNSLR_MASK3 0x0f
-#define PNSLR_MASK4 0x07
+static inline b8 PNSLR_Internal_IsASCIIWhitespace(u8 c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r'); // \t \n \v \f \r
+}
 
-#define PNSLR_RUNE1_MAX 127
-#define PNSLR_RUNE2_MAX 2047
-#define PNSLR_RUNE3_MAX 65535
+static inline b8 PNSLR_Internal_IsInByteSet(u8 c, const u8* set, i64 setCount)
+{
+    for (i64 k = 0; k < setCount; ++k) { if (c == set[k]) { return true; } }
+    return false;
+}
 
-#define PNSLR_LOCB 0x80
-#define PNSLR_HICB 0xbf
+static i64 PNSLR_Internal_FindFirstOfBytes(const u8* data, i64 count, const u8* set, i64 setCount)
+{
+    if (count <= 0 || setCount <= 0) { return -1; }
 
-typedef struct PNSLR_Internal_AcceptRange { u8 lo, hi; } PNSLR_Internal_AcceptRange;
-static PNSLR_Internal_AcceptRange G_PNSLR_Internal_AcceptRanges[5] = { {0x80, 0xbf}, {0xa0, 0xbf}, {0x80, 0x9f}, {0x90, 0xbf}, {0x80, 0x8f} };
+    if (setCount > PNSLR_INTERNAL_MAX_SIMD_BYTE_SET)
+    {
+        u64 table[4] = {0};
+        for (i64 k = 0; k < setCount; ++k) { table[set[k] >> 6] |= 1ULL << (set[k] & 63); }
+        for (i64 i = 0; i < count; ++i)    { if (table[data[i] >> 6] & (1ULL << (data[i] & 63))) { return i; } }
+        return -1;
+    }
 
-static u8 PNSLR_Internal_GetAcceptSize(u8 byte) {
-    if (byte <= 0x7f) return 0xf0;
-    if (byte <= 0xc1) return 0xf1;
-    if (byte <= 0xdf) return 0x02;
-    if (byte == 0xe0) return 0x13;
-    if (byte <= 0xec) return 0x03;
-    if (byte == 0xed) return 0x23;
-    if (byte <= 0xef) return 0x03;
-    if (byte == 0xf0) return 0x34;
-    if (byte <= 0xf3) return 0x04;
-    if (byte == 0xf4) return 0x44;
-    return 0xf1;
-}
+    i64 i = 0;
+
+    #ifdef PNSLR_INTERNAL_SIMD_WIDTH
+    {
+        PNSLR_Internal_SimdU8 splats[PNSLR_INTERNAL_MAX_SIMD_BYTE_SET];
+        for (i64 k = 0; k < setCount; ++k) { splats[k] = PNSLR_Internal_SimdSplat(set[k]); }
+
+        for (; i + PNSLR_INTERNAL_SIMD_WIDTH <= count; i += PNSLR_INTERNAL_SIMD_WIDTH)
+        {
+            PNSLR_Internal_SimdU8 block = PNSLR_Internal_SimdLoad(data + i);
+
+            u64 mask = 0;
+            for (i64 k = 0; k < setCount; ++k) { mask |= PNSLR_Internal_SimdEqualMask(block, splats[k]); }
+            if (mask) { return i + PNSLR_Internal_CountTrailingZerosU64(mask) / PNSLR_INTERNAL_SIMD_MASK_BITS; }
+        }
+    }
+    #endif
+
+    for (; i < count; ++i) { if (PNSLR_Internal_IsInByteSet(data[i], set, setCount)) { return i; } }
+    return -1;
+}
+
+static i64 PNSLR_Internal_FindLastOfBytes(const u8* data, i64 count, const u8* set, i64 setCount)
+{
+    if (count <= 0 || setCount <= 0) { return -1; }
+
+    if (setCount > PNSLR_INTERNAL_MAX_SIMD_BYTE_SET)
+    {
+        u64 table[4] = {0};
+        for (i64 k = 0; k < setCount; ++k) { table[set[k] >> 6] |= 1ULL << (set[k] & 63); }
+        for (i64 i = count - 1; i >= 0; --i) { if (table[data[i] >> 6] & (1ULL << (data[i] & 63))) { return i; } }
+        return -1;
+    }
+
+    i64 end = count; // everything from here on has been checked
+
+    #ifdef PNSLR_INTERNAL_SIMD_WIDTH
+    {
+        PNSLR_Internal_SimdU8 splats[PNSLR_INTERNAL_MAX_SIMD_BYTE_SET];
+        for (i64 k = 0; k < setCount; ++k) { splats[k] = PNSLR_Internal_SimdSplat(set[k]); }
+
+        for (; end >= PNSLR_INTERNAL_SIMD_WIDTH; end -= PNSLR_INTERNAL_SIMD_WIDTH)
+        {
+            PNSLR_Internal_SimdU8 block = PNSLR_Internal_SimdLoad(data + end - PNSLR_INTERNAL_SIMD_WIDTH);
+
+            u64 mask = 0;
+            for (i64 k = 0; k < setCount; ++k) { mask |= PNSLR_Internal_SimdEqualMask(block, splats[k]); }
+            if (mask) { return end - PNSLR_INTERNAL_SIMD_WIDTH + (63 - PNSLR_Internal_CountLeadingZerosU64(mask)) / PNSLR_INTERNAL_SIMD_MASK_BITS; }
+        }
+    }
+    #endif
+
+    for (i64 i = end - 1; i >= 0; --i) { if (PNSLR_Internal_IsInByteSet(data[i], set, setCount)) { return i; } }
+    return -1;
+}
+
+static const u8 G_PNSLR_Internal_WhitespaceBytes[6] = {' ', '\t', '\n', '\v', '\f', '\r'};
+
+utf8str PNSLR_TrimStringFromStart(utf8str str)
+{
+    while (str.count > 0 && PNSLR_Internal_IsASCIIWhitespace(str.data[0])) { str.data++; str.count--; }
+    return str;
+}
+
+utf8str PNSLR_TrimStringFromEnd(utf8str str)
+{
+    while (str.count > 0 && PNSLR_Internal_IsASCIIWhitespace(str.data[str.count - 1])) { str.count--; }
+    return str;
+}
+
+utf8str PNSLR_TrimString(utf8str str)
+{
+    return PNSLR_TrimStringFromEnd(PNSLR_TrimStringFromStart(str));
+}
+
+PNSLR_StringSplitIterator PNSLR_SplitStringByByte(utf8str str, u8 separator)
+{
+    return (PNSLR_StringSplitIterator) {.remaining = str, .separatorByte = separator, .type = PNSLR_StringSplitType_Byte};
+}
+
+PNSLR_StringSplitIterator PNSLR_SplitStringByString(utf8str str, utf8str separator, PNSLR_StringComparisonType comparisonType)
+{
+    return (PNSLR_StringSplitIterator) {.remaining = str, .separator = separator, .type = PNSLR_StringSplitType_String, .comparisonType = comparisonType};
+}
+
+PNSLR_StringSplitIterator PNSLR_SplitStringByAnyOf(utf8str str, utf8str separators)
+{
+    return (PNSLR_StringSplitIterator) {.remaining = str, .separator = separators, .type = PNSLR_StringSplitType_AnyOf};
+}
+
+PNSLR_StringSplitIterator PNSLR_SplitStringByLines(utf8str str)
+{
+    // a newline at the very end finishes the last line rather than starting an empty one
+    PNSLR_StringSplitIterator iterator = {.remaining = str, .separatorByte = '\n', .type = PNSLR_StringSplitType_Lines, .finished = !str.count};
+    if (str.count > 0 && str.data[str.count - 1] == '\n') { iterator.remaining.count--; }
+    return iterator;
+}
+
+PNSLR_StringSplitIterator PNSLR_SplitStringByWhitespace(utf8str str)
+{
+    return (PNSLR_StringSplitIterator) {.remaining = str, .type = PNSLR_StringSplitType_Whitespace};
+}
+
+// where the next separator is in `str` (searching from the end if `fromEnd`), and how long it is
+static i64 PNSLR_Internal_FindSplitSeparator(const PNSLR_StringSplitIterator* iterator, utf8str str, b8 fromEnd, i64* separatorLength)
+{
+    *separatorLength = 1;
+    switch (iterator->type)
+    {
+        case PNSLR_StringSplitType_Byte:
+        case PNSLR_StringSplitType_Lines:
+            return fromEnd ? PNSLR_Internal_FindLastOfBytes (str.data, str.count, &iterator->separatorByte, 1)
+                           : PNSLR_Internal_FindFirstOfBytes(str.data, str.count, &iterator->separatorByte, 1);
+
+        case PNSLR_StringSplitType_AnyOf:
+            return fromEnd ? PNSLR_Internal_FindLastOfBytes (str.data, str.count, iterator->separator.data, iterator->separator.count)
+                           : PNSLR_Internal_FindFirstOfBytes(str.data, str.count, iterator->separator.data, iterator->separator.count);
+
+        case PNSLR_StringSplitType_Whitespace:
+            return fromEnd ? PNSLR_Internal_FindLastOfBytes (str.data, str.count, G_PNSLR_Internal_WhitespaceBytes, sizeof(G_PNSLR_Internal_WhitespaceBytes))
+                           : PNSLR_Internal_FindFirstOfBytes(str.data, str.count, G_PNSLR_Internal_WhitespaceBytes, sizeof(G_PNSLR_Internal_WhitespaceBytes));
+
+        case PNSLR_StringSplitType_String:
+            *separatorLength = iterator->separator.count;
+            return fromEnd ? PNSLR_SearchLastIndexInString (str, iterator->separator, iterator->comparisonType)
+                           : PNSLR_SearchFirstIndexInString(str, iterator->separator, iterator->comparisonType);
+
+        default:
+            FORCE_DBG_TRAP;
+            return -1;
+    }
+}
+
+static b8 PNSLR_Internal_NextSplit(PNSLR_StringSplitIterator* iterator, utf8str* part, b8 fromEnd)
+{
+    if (!iterator || !part || iterator->finished) { return false; }
+
+    utf8str remaining = iterator->remaining;
+    if (iterator->type == PNSLR_StringSplitType_Whitespace)
+    {
+        // runs of whitespace count as one separator, and there's nothing to yield on either side of them
+        remaining = fromEnd ? PNSLR_TrimStringFromEnd(remaining) : PNSLR_TrimStringFromStart(remaining);
+        if (!remaining.count) { iterator->finished = true; return false; }
+    }
+
+    i64 separatorLength = 0;
+    i64 index           = PNSLR_Internal_FindSplitSeparator(iterator, remaining, fromEnd, &separatorLength);
+    if (index < 0)
+    {
+        *part = remaining;
+        iterator->remaining = (utf8str) {0};
+        iterator->finished  = true;
+    }
+    else if (fromEnd)
+    {
+        *part = (utf8str) {.data = remaining.data + index + separatorLength, .count = remaining.count - index - separatorLength};
+        iterator->remaining = (utf8str) {.data = remaining.data, .count = index};
+    }
+    else
+    {
+        *part = (utf8str) {.data = remaining.data, .count = index};
+        iterator->remaining = (utf8str) {.data = remaining.data + index + separatorLength, .count = remaining.count - index - separatorLength};
+    }
+
+    if (iterator->type == PNSLR_StringSplitType_Lines && part->count > 0 && part->data[part->count - 1] == '\r') { part->count--; }
+    return true;
+}
+
+b8 PNSLR_NextSplitFromStart(PNSLR_StringSplitIterator* iterator, utf8str* part)
+{
+    return PNSLR_Internal_NextSplit(iterator, part, false);
+}
+
+b8 PNSLR_NextSplitFromEnd(PNSLR_StringSplitIterator* iterator, utf8str* part)
+{
+    return PNSLR_Internal_NextSplit(iterator, part, true);
+}
+
+PNSLR_Tokenizer PNSLR_MakeTokenizer(utf8str source, utf8str lineCommentStart)
+{
+    return (PNSLR_Tokenizer) {.source = source, .line = 1, .lineCommentStart = lineCommentStart};
+}
+
+static inline b8 PNSLR_Internal_IsIdentifierByte(u8 c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c >= 0x80; // utf-8 passes through
+}
+
+PNSLR_Token PNSLR_NextToken(PNSLR_Tokenizer* tokenizer)
+{
+    if (!tokenizer) { return (PNSLR_Token) {0}; }
+
+    const u8* data  = tokenizer->source.data;
+    i64       count = tokenizer->source.count;
+    i64       i     = tokenizer->position;
+
+    // whitespace and comments
+    while (i < count)
+    {
+        if (data[i] == '\n')
+        {
+            tokenizer->line++;
+            tokenizer->lineStart = ++i;
+        }
+        else if (PNSLR_Internal_IsASCIIWhitespace(data[i]))
+        {
+            ++i;
+        }
+        else if (tokenizer->lineCommentStart.count > 0 && PNSLR_StringStartsWith((utf8str) {.data = (u8*) data + i, .count = count - i}, tokenizer->lineCommentStart, PNSLR_StringComparisonType_CaseSensitive))
+        {
+            i64 newline = PNSLR_Internal_FindFirstOfBytes(data + i, count - i, (const u8*) "\n", 1);
+            i = (newline < 0) ? count : (i + newline); // the newline itself gets counted above
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    PNSLR_Token token = {.line = tokenizer->line, .column = (i32) (i - tokenizer->lineStart + 1)};
+    i64         start = i;
+
+    if (i >= count)
+    {
+        token.type = PNSLR_TokenType_EndOfInput;
+    }
+    else if ((data[i] >= '0' && data[i] <= '9') || (data[i] == '.' && i + 1 < count && data[i + 1] >= '0' && data[i + 1] <= '9'))
+    {
+        // loose on purpose, the number parsers decide whether it's valid
+        token.type = PNSLR_TokenType_Number;
+        b8 hex = (data[i] == '0' && i + 1 < count && (data[i + 1] == 'x' || data[i + 1] == 'X'));
+        for (++i; i < count; ++i)
+        {
+            u8 c = data[i];
+            if (PNSLR_Internal_IsIdentifierByte(c) || c == '.') { continue; }
+            if ((c == '+' || c == '-') && !hex && (data[i - 1] == 'e' || data[i - 1] == 'E')) { continue; }
+            break;
+        }
+    }
+    else if (PNSLR_Internal_IsIdentifierByte(data[i]))
+    {
+        token.type = PNSLR_TokenType_Identifier;
+        for (++i; i < count && PNSLR_Internal_IsIdentifierByte(data[i]); ++i) { }
+    }
+    else if (data[i] == '"' || data[i] == '\'')
+    {
+        // runs to the matching quote, skipping escaped characters; has to end on the same line
+        u8 stops[3] = {data[i], '\\', '\n'};
+        token.type = PNSLR_TokenType_Invalid;
+        for (++i; i < count;)
+        {
+            i64 stop = PNSLR_Internal_FindFirstOfBytes(data + i, count - i, stops, 3);
+            if (stop < 0)                 { i = count; break; }
+            i += stop;
+            if (data[i] == '\n')          { break; }
+            if (data[i] == '\\' && i + 1 < count && data[i + 1] == '\n') { ++i; break; } // not even an escaped one
+            if (data[i] == '\\')          { i += 2; continue; }
+
+            token.type = PNSLR_TokenType_String;
+            ++i;
+            break;
+        }
+
+        if (i > count) { i = count; } // a backslash at the very end
+    }
+    else
+    {
+        token.type = PNSLR_TokenType_Symbol;
+        ++i;
+    }
+
+    token.text = (utf8str) {.data = (u8*) data + start, .count = i - start};
+    tokenizer->position = i;
+    return token;
+}
+
+PNSLR_Token PNSLR_PeekToken(PNSLR_Tokenizer* tokenizer)
+{
+    if (!tokenizer) { return (PNSLR_Token) {0}; }
+
+    PNSLR_Tokenizer copy = *tokenizer;
+    return PNSLR_NextToken(&copy);
+}
+
+#define PNSLR_RUNE_ERROR 0xfffd
+#define PNSLR_MAX_RUNE 0x0010ffff
+
+#define PNSLR_SURROGATE_MIN 0xd800
+#define PNSLR_SURROGATE_MAX 0xdfff
+
+#define PNSLR_MASKX 0x3f
+#define PNSLR_MASK2 0x1f
+#define PNSLR_MASK3 0x0f
+#define PNSLR_MASK4 0x07
+
+#define PNSLR_RUNE1_MAX 127
+#define PNSLR_RUNE2_MAX 2047
+#define PNSLR_RUNE3_MAX 65535
+
+#define PNSLR_LOCB 0x80
+#define PNSLR_HICB 0xbf
+
+typedef struct PNSLR_Internal_AcceptRange { u8 lo, hi; } PNSLR_Internal_AcceptRange;
+static PNSLR_Internal_AcceptRange G_PNSLR_Internal_AcceptRanges[5] = { {0x80, 0xbf}, {0xa0, 0xbf}, {0x80, 0x9f}, {0x90, 0xbf}, {0x80, 0x8f} };
+
+static u8 PNSLR_Internal_GetAcceptSize(u8 byte) {
+    if (byte <= 0x7f) return 0xf0;
+    if (byte <= 0xc1) return 0xf1;
+    if (byte <= 0xdf) return 0x02;
+    if (byte == 0xe0) return 0x13;
+    if (byte <= 0xec) return 0x03;
+    if (byte == 0xed) return 0x23;
+    if (byte <= 0xef) return 0x03;
+    if (byte == 0xf0) return 0x34;
+    if (byte <= 0xf3) return 0x04;
+    if (byte == 0xf4) return 0x44;
+    return 0xf1;
+}
 
 i32 PNSLR_GetRuneLength(u32 r) {
     if (r <= PNSLR_RUNE1_MAX)                                 { return 1;  }
@@ -473,6 +1130,287 @@ PNSLR_DecodedRune PNSLR_DecodeRune(PNSLR_ArraySlice(u8) s) {
     return result;
 }
 
+b8 PNSLR_ValidateUTF8(utf8str str)
+{
+    if (!str.data || str.count <= 0) { return true; }
+
+    const u8* data = str.data;
+    i64       n    = str.count;
+    i64       i    = 0;
+
+    while (i < n)
+    {
+        if (data[i] < 0x80)
+        {
+            // most text is long runs of ascii, skip over them a block at a time
+            #ifdef PNSLR_INTERNAL_SIMD_WIDTH
+                while (i + 4 * PNSLR_INTERNAL_SIMD_WIDTH <= n)
+                {
+                    PNSLR_Internal_SimdU8 block = PNSLR_Internal_SimdOr(
+                        PNSLR_Internal_SimdOr(PNSLR_Internal_SimdLoad(data + i),                                 PNSLR_Internal_SimdLoad(data + i +     PNSLR_INTERNAL_SIMD_WIDTH)),
+                        PNSLR_Internal_SimdOr(PNSLR_Internal_SimdLoad(data + i + 2 * PNSLR_INTERNAL_SIMD_WIDTH), PNSLR_Internal_SimdLoad(data + i + 3 * PNSLR_INTERNAL_SIMD_WIDTH))
+                    );
+                    if (!PNSLR_Internal_SimdIsASCII(block)) { break; }
+                    i += 4 * PNSLR_INTERNAL_SIMD_WIDTH;
+                }
+
+                while (i + PNSLR_INTERNAL_SIMD_WIDTH <= n && PNSLR_Internal_SimdIsASCII(PNSLR_Internal_SimdLoad(data + i)))
+                {
+                    i += PNSLR_INTERNAL_SIMD_WIDTH;
+                }
+            #endif
+
+            while (i < n && data[i] < 0x80) { ++i; }
+            continue;
+        }
+
+        u8 x = PNSLR_Internal_GetAcceptSize(data[i]);
+        if (x >= 0xf0) { return false; } // can't start a sequence
+
+        i32 size = x & 7;
+        if (i + size > n) { return false; } // truncated
+
+        PNSLR_Internal_AcceptRange accept = G_PNSLR_Internal_AcceptRanges[x >> 4];
+        if (data[i + 1] < accept.lo || accept.hi < data[i + 1])                  { return false; }
+        if (size > 2 && (data[i + 2] < PNSLR_LOCB || PNSLR_HICB < data[i + 2])) { return false; }
+        if (size > 3 && (data[i + 3] < PNSLR_LOCB || PNSLR_HICB < data[i + 3])) { return false; }
+
+        i += size;
+    }
+
+    return true;
+}
+
+i64 PNSLR_CountRunesInString(utf8str str)
+{
+    if (!str.data || str.count <= 0) { return 0; }
+
+    if (PNSLR_ValidateUTF8(str))
+    {
+        // in valid utf-8, every rune has exactly one byte that isn't a continuation byte
+        i64 count = 0;
+        i64 i     = 0;
+
+        #ifdef PNSLR_INTERNAL_SIMD_WIDTH
+            i64 numBlocks = str.count / PNSLR_INTERNAL_SIMD_WIDTH;
+            count += PNSLR_Internal_SimdCountLeadBytes(str.data, numBlocks);
+            i     += numBlocks * PNSLR_INTERNAL_SIMD_WIDTH;
+        #endif
+
+        for (; i < str.count; ++i) { count += ((str.data[i] & 0xc0) != 0x80); }
+        return count;
+    }
+
+    // otherwise, count exactly what decoding would produce
+    i64 count = 0;
+    for (i64 i = 0; i < str.count; ++count)
+    {
+        PNSLR_DecodedRune decoded = PNSLR_DecodeRune((PNSLR_ArraySlice(u8)) {.count = str.count - i, .data = str.data + i});
+        i += (decoded.length > 0) ? decoded.length : 1;
+    }
+
+    return count;
+}
+
+// same rules as `PNSLR_DecodeRune`, but without the slice round-trip; on error returns
+// the error rune with a length of 1, so the caller can resync on the next byte
+static inline PNSLR_DecodedRune PNSLR_Internal_DecodeNonASCIIRune(const u8* data, i64 remaining)
+{
+    PNSLR_DecodedRune result = {.rune = PNSLR_RUNE_ERROR, .length = 1};
+
+    u8 x = PNSLR_Internal_GetAcceptSize(data[0]);
+    if (x >= 0xf0) { return result; }
+
+    i32 size = x & 7;
+    if (remaining < size) { return result; }
+
+    PNSLR_Internal_AcceptRange accept = G_PNSLR_Internal_AcceptRanges[x >> 4];
+    if (data[1] < accept.lo || accept.hi < data[1])                  { return result; }
+    if (size > 2 && (data[2] < PNSLR_LOCB || PNSLR_HICB < data[2])) { return result; }
+    if (size > 3 && (data[3] < PNSLR_LOCB || PNSLR_HICB < data[3])) { return result; }
+
+    if      (size == 2) { result.rune = ((u32) (data[0] & PNSLR_MASK2) << 6)  |  (u32) (data[1] & PNSLR_MASKX); }
+    else if (size == 3) { result.rune = ((u32) (data[0] & PNSLR_MASK3) << 12) | ((u32) (data[1] & PNSLR_MASKX) << 6)  |  (u32) (data[2] & PNSLR_MASKX); }
+    else                { result.rune = ((u32) (data[0] & PNSLR_MASK4) << 18) | ((u32) (data[1] & PNSLR_MASKX) << 12) | ((u32) (data[2] & PNSLR_MASKX) << 6) | (u32) (data[3] & PNSLR_MASKX); }
+
+    result.length = size;
+    return result;
+}
+
+i64 PNSLR_GetUTF16LengthOfUTF8(utf8str str)
+{
+    if (!str.data || str.count <= 0) { return 0; }
+
+    const u8* data   = str.data;
+    i64       n      = str.count;
+    i64       i      = 0;
+    i64       length = 0;
+
+    while (i < n)
+    {
+        if (data[i] < 0x80)
+        {
+            i64 start = i;
+
+            #ifdef PNSLR_INTERNAL_SIMD_WIDTH
+                while (i + PNSLR_INTERNAL_SIMD_WIDTH <= n && PNSLR_Internal_SimdIsASCII(PNSLR_Internal_SimdLoad(data + i)))
+                {
+                    i += PNSLR_INTERNAL_SIMD_WIDTH;
+                }
+            #endif
+
+            while (i < n && data[i] < 0x80) { ++i; }
+            length += i - start; // one code unit per byte
+            continue;
+        }
+
+        PNSLR_DecodedRune decoded = PNSLR_Internal_DecodeNonASCIIRune(data + i, n - i);
+        length += (decoded.rune > PNSLR_RUNE3_MAX) ? 2 : 1; // surrogate pair past the bmp
+        i      += decoded.length;
+    }
+
+    return length;
+}
+
+i64 PNSLR_GetUTF8LengthOfUTF16(PNSLR_ArraySlice(u16) str)
+{
+    if (!str.data || str.count <= 0) { return 0; }
+
+    const u16* data   = str.data;
+    i64        n      = str.count;
+    i64        i      = 0;
+    i64        length = 0;
+
+    while (i < n)
+    {
+        #ifdef PNSLR_INTERNAL_SIMD_WIDTH
+            // whole blocks without surrogates are counted without looking at each unit
+            while (i + 8 <= n)
+            {
+                i64 blockLength = PNSLR_Internal_SimdUTF8LengthOfUTF16(data + i);
+                if (blockLength < 0) { break; }
+                length += blockLength;
+                i      += 8;
+            }
+
+            if (i >= n) { break; }
+        #endif
+
+        u16 c = data[i];
+        if      (c < 0x80)                                                          { length += 1; i += 1; }
+        else if (c < 0x800)                                                         { length += 2; i += 1; }
+        else if (c >= 0xd800 && c <= 0xdbff && i + 1 < n &&
+                 data[i + 1] >= 0xdc00 && data[i + 1] <= 0xdfff)                    { length += 4; i += 2; }
+        else                                                                        { length += 3; i += 1; } // lone surrogates become the error rune
+    }
+
+    return length;
+}
+
+PNSLR_ArraySlice(u16) PNSLR_UTF16FromUTF8(utf8str str, PNSLR_Allocator allocator)
+{
+    i64 length = PNSLR_GetUTF16LengthOfUTF8(str);
+    if (!length) { return (PNSLR_ArraySlice(u16)) {0}; }
+
+    PNSLR_ArraySlice(u16) output = PNSLR_MakeSlice(u16, (length + 1), false, allocator, PNSLR_GET_LOC(), nil);
+    if (!output.data) { return (PNSLR_ArraySlice(u16)) {0}; } // allocation failed
+
+    const u8* src = str.data;
+    u16*      dst = output.data;
+    i64       n   = str.count;
+    i64       i   = 0;
+
+    while (i < n)
+    {
+        if (src[i] < 0x80)
+        {
+            #ifdef PNSLR_INTERNAL_SIMD_WIDTH
+                while (i + PNSLR_INTERNAL_SIMD_WIDTH <= n)
+                {
+                    PNSLR_Internal_SimdU8 block = PNSLR_Internal_SimdLoad(src + i);
+                    if (!PNSLR_Internal_SimdIsASCII(block)) { break; }
+
+                    PNSLR_Internal_SimdWidenASCII(block, dst);
+                    i   += PNSLR_INTERNAL_SIMD_WIDTH;
+                    dst += PNSLR_INTERNAL_SIMD_WIDTH;
+                }
+            #endif
+
+            while (i < n && src[i] < 0x80) { *(dst++) = src[i++]; }
+            continue;
+        }
+
+        PNSLR_DecodedRune decoded = PNSLR_Internal_DecodeNonASCIIRune(src + i, n - i);
+        if (decoded.rune > PNSLR_RUNE3_MAX)
+        {
+            u32 r    = decoded.rune - 0x10000;
+            *(dst++) = (u16) (0xd800 + (r >> 10));
+            *(dst++) = (u16) (0xdc00 + (r & 0x3ff));
+        }
+        else
+        {
+            *(dst++) = (u16) decoded.rune;
+        }
+
+        i += decoded.length;
+    }
+
+    output.data[length] = 0; // null-terminate the UTF-16 string
+    output.count        = length;
+    return output;
+}
+
+utf8str PNSLR_UTF8FromUTF16(PNSLR_ArraySlice(u16) str, PNSLR_Allocator allocator)
+{
+    i64 length = PNSLR_GetUTF8LengthOfUTF16(str);
+    if (!length) { return (utf8str) {0}; }
+
+    utf8str output = PNSLR_MakeString(length, false, allocator, PNSLR_GET_LOC(), nil);
+    if (!output.data) { return (utf8str) {0}; } // allocation failed
+
+    const u16* src = str.data;
+    u8*        dst = output.data;
+    i64        n   = str.count;
+    i64        i   = 0;
+
+    while (i < n)
+    {
+        #ifdef PNSLR_INTERNAL_SIMD_WIDTH
+            while (i + 16 <= n && PNSLR_Internal_SimdNarrowASCII(src + i, dst))
+            {
+                i   += 16;
+                dst += 16;
+            }
+
+            if (i >= n) { break; }
+        #endif
+
+        u32 c = src[i++];
+        if (c < 0x80)
+        {
+            *(dst++) = (u8) c;
+            continue;
+        }
+
+        if (c >= PNSLR_SURROGATE_MIN && c <= PNSLR_SURROGATE_MAX)
+        {
+            if (c <= 0xdbff && i < n && src[i] >= 0xdc00 && src[i] <= 0xdfff)
+            {
+                c = 0x10000 + ((c - 0xd800) << 10) + (u32) (src[i++] - 0xdc00);
+            }
+            else
+            {
+                c = PNSLR_RUNE_ERROR; // lone surrogate
+            }
+        }
+
+        PNSLR_EncodedRune encoded = PNSLR_EncodeRune(c);
+        for (i32 j = 0; j < encoded.length; ++j) { *(dst++) = encoded.data[j]; }
+    }
+
+    return output;
+}
+
 #undef PNSLR_RUNE_ERROR
 #undef PNSLR_MAX_RUNE
 #undef PNSLR_SURROGATE_MIN
@@ -520,7 +1458,14 @@ PNSLR_ArraySlice(u16) PNSLR_UTF16FromUTF8WindowsOnly(utf8str str, PNSLR_Allocato
     }
     #else
     {
-        return (PNSLR_ArraySlice(u16)) {0};
+        PNSLR_ArraySlice(u16) output = PNSLR_UTF16FromUTF8(str, allocator);
+
+        while (output.count >= 1 && output.data[output.count - 1] == 0)
+        {
+            --output.count; // remove trailing null characters
+        }
+
+        return output;
     }
     #endif
 }
@@ -561,7 +1506,16 @@ utf8str PNSLR_UTF8FromUTF16WindowsOnly(PNSLR_ArraySlice(u16) utf16str, PNSLR_All
     }
     #else
     {
-        return (utf8str) {0};
+        for (i64 i = 0; i < utf16str.count; i++)
+        {
+            if (utf16str.data[i] == 0)
+            {
+                utf16str.count = i; // ignore everything from the first null character
+                break;
+            }
+        }
+
+        return PNSLR_UTF8FromUTF16(utf16str, allocator);
     }
     #endif
 }
@@ -597,7 +1551,7 @@ b8 PNSLR_AppendStringToStringBuilder(PNSLR_StringBuilder* builder, utf8str str)
 {
     if (!builder || !PNSLR_Internal_ResizeStringBuilderIfRequired(builder, str.count)) return false;
 
-    PNSLR_MemCopy(builder->buffer.data + builder->cursorPos, str.data, (i32) str.count);
+    PNSLR_MemCopy(builder->buffer.data + builder->cursorPos, str.data, str.count);
     builder->cursorPos += str.count;
     if (builder->cursorPos > builder->writtenSize) { builder->writtenSize = builder->cursorPos; }
     return true;
@@ -621,138 +1575,816 @@ b8 PNSLR_AppendB8ToStringBuilder(PNSLR_StringBuilder* builder, b8 value)
     else       return PNSLR_AppendStringToStringBuilder(builder, PNSLR_StringLiteral("false"));
 }
 
-b8 PNSLR_AppendF32ToStringBuilder(PNSLR_StringBuilder* builder, f32 value, i32 decimalPlaces)
+// integer formatting; digit counts are worked out first so the output can be written in place
+
+static const u8 G_PNSLR_Internal_DecimalDigitPairs[200] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+static const u8 G_PNSLR_Internal_HexDigits[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+
+static const u64 G_PNSLR_Internal_PowersOf10[20] =
 {
-    return PNSLR_AppendF64ToStringBuilder(builder, (f64) value, decimalPlaces);
-}
+    1ULL,                    10ULL,                    100ULL,                    1000ULL,
+    10000ULL,                100000ULL,                1000000ULL,                10000000ULL,
+    100000000ULL,            1000000000ULL,            10000000000ULL,            100000000000ULL,
+    1000000000000ULL,        10000000000000ULL,        100000000000000ULL,        1000000000000000ULL,
+    10000000000000000ULL,    100000000000000000ULL,    1000000000000000000ULL,    10000000000000000000ULL,
+};
 
-b8 PNSLR_AppendF64ToStringBuilder(PNSLR_StringBuilder* builder, f64 value, i32 decimalPlaces)
+static inline i32 PNSLR_Internal_CountDecimalDigits(u64 value)
 {
-    if (!builder) return false;
-    if (value != value) { return PNSLR_AppendCStringToStringBuilder(builder, "NaN"); } // NaN
+    // log10(x) ~= log2(x) * 1233 / 4096, which is exact or one too small; the table settles it
+    // (zero is counted as one, so it still gets a digit)
+    value      |= 1;
+    i32 numBits = 64 - PNSLR_Internal_CountLeadingZerosU64(value);
+    i32 guess   = (numBits * 1233) >> 12;
+    return guess + 1 - (value < G_PNSLR_Internal_PowersOf10[guess]);
+}
 
-    b8 status = true;
-    if (value == 0.0)
+// writes exactly `numDigits` digits ending at `output + numDigits`, two at a time
+static inline void PNSLR_Internal_WriteDecimalDigits(u8* output, i32 numDigits, u64 value)
+{
+    u8* cursor = output + numDigits;
+    while (value >= 100)
     {
-        status = PNSLR_AppendByteToStringBuilder(builder, '0');
-        if (decimalPlaces > 0)
-        {
-            status = status && PNSLR_AppendByteToStringBuilder(builder, '.');
-            for (i32 i = 0; i < decimalPlaces; i++)
-            {
-                status = status && PNSLR_AppendByteToStringBuilder(builder, '0');
-            }
-        }
-        return status;
+        u64 pair = (value % 100) * 2;
+        value /= 100;
+        cursor -= 2;
+        cursor[0] = G_PNSLR_Internal_DecimalDigitPairs[pair];
+        cursor[1] = G_PNSLR_Internal_DecimalDigitPairs[pair + 1];
     }
 
-    // Handle sign
-    f64 absValue = value;
-    if (value < 0.0)
+    if (value >= 10)
     {
-        status = PNSLR_AppendByteToStringBuilder(builder, '-');
-        absValue = -value;
+        cursor -= 2;
+        cursor[0] = G_PNSLR_Internal_DecimalDigitPairs[value * 2];
+        cursor[1] = G_PNSLR_Internal_DecimalDigitPairs[value * 2 + 1];
     }
+    else if (cursor > output)
+    {
+        *(--cursor) = (u8) ('0' + value);
+    }
+}
 
-    // Integer part
-    u64 intPart = (u64) absValue;
-    status = status && PNSLR_AppendU64ToStringBuilder(builder, intPart, PNSLR_IntegerBase_Decimal);
+// pointer to `length` bytes at the cursor, or nil if the builder can't grow
+static inline u8* PNSLR_Internal_ReserveInStringBuilder(PNSLR_StringBuilder* builder, i64 length)
+{
+    if (!builder || !PNSLR_Internal_ResizeStringBuilderIfRequired(builder, length)) return nil;
+    return builder->buffer.data + builder->cursorPos;
+}
 
-    // Fractional part
-    if (decimalPlaces > 0)
-    {
-        status = status && PNSLR_AppendByteToStringBuilder(builder, '.');
+static inline void PNSLR_Internal_CommitToStringBuilder(PNSLR_StringBuilder* builder, i64 length)
+{
+    builder->cursorPos += length;
+    if (builder->cursorPos > builder->writtenSize) { builder->writtenSize = builder->cursorPos; }
+}
 
-        f64 fracPart = absValue - (f64) intPart;
+static b8 PNSLR_Internal_AppendIntegerToStringBuilder(PNSLR_StringBuilder* builder, u64 magnitude, b8 negative, PNSLR_IntegerBase base)
+{
+    u8  prefix       = 0;
+    i32 bitsPerDigit = 0;
+    switch (base)
+    {
+        case PNSLR_IntegerBase_Binary:      prefix = 'b'; bitsPerDigit = 1; break;
+        case PNSLR_IntegerBase_HexaDecimal: prefix = 'x'; bitsPerDigit = 4; break;
+        case PNSLR_IntegerBase_Octal:       prefix = 'o'; bitsPerDigit = 3; break;
+        case PNSLR_IntegerBase_Decimal:                                     break;
+        default: FORCE_DBG_TRAP; return false;
+    }
 
-        // Scale fractional part by 10^decimalPlaces
-        u64 factor = 1;
-        for (i32 i = 0; i < decimalPlaces; i++) factor *= 10;
+    i32 numDigits;
+    if (bitsPerDigit)
+    {
+        i32 numBits = 64 - PNSLR_Internal_CountLeadingZerosU64(magnitude | 1);
+        numDigits   = (numBits + bitsPerDigit - 1) / bitsPerDigit;
+    }
+    else
+    {
+        numDigits = PNSLR_Internal_CountDecimalDigits(magnitude);
+    }
 
-        u64 scaledFrac = (u64)(fracPart * (f64)factor + 0.5); // round
+    i64 length = negative + (prefix ? 2 : 0) + numDigits;
+    u8* output = PNSLR_Internal_ReserveInStringBuilder(builder, length);
+    if (!output) { return false; }
 
-        // Count digits of scaledFrac
-        u64 temp = scaledFrac;
-        i32 digitCount = 0;
-        if (temp == 0) { digitCount = 1; }
-        else while (temp > 0) { digitCount++; temp /= 10; }
+    if (negative) { *(output++) = '-'; }
+    if (prefix)   { *(output++) = '0'; *(output++) = prefix; }
 
-        // trailing zeroes
-        for (i32 i = 0; i < decimalPlaces - digitCount; i++) { status = status && PNSLR_AppendByteToStringBuilder(builder, '0'); }
-        if (scaledFrac > 0) { status = status && PNSLR_AppendU64ToStringBuilder(builder, scaledFrac, PNSLR_IntegerBase_Decimal); }
+    if (bitsPerDigit)
+    {
+        u64 digitMask = (1ULL << bitsPerDigit) - 1;
+        for (i32 i = numDigits - 1; i >= 0; --i)
+        {
+            output[i] = G_PNSLR_Internal_HexDigits[magnitude & digitMask];
+            magnitude >>= bitsPerDigit;
+        }
+    }
+    else
+    {
+        PNSLR_Internal_WriteDecimalDigits(output, numDigits, magnitude);
     }
 
-    return status;
+    PNSLR_Internal_CommitToStringBuilder(builder, length);
+    return true;
 }
 
-b8 PNSLR_AppendU8ToStringBuilder(PNSLR_StringBuilder* builder, u8 value, PNSLR_IntegerBase base)
+// shortest round-trip float formatting, after ryu (ulf adams, 2018): the rounding interval of the
+// float is scaled to a power of ten with 125-bit multipliers, and digits are dropped from its ends
+// for as long as both ends still agree; whatever's left is the shortest number that parses back
+
+typedef struct PNSLR_Internal_DecimalFloat { u64 mantissa; i32 exponent; } PNSLR_Internal_DecimalFloat;
+
+#define PNSLR_INTERNAL_POW5_BITCOUNT     125
+#define PNSLR_INTERNAL_POW5_INV_BITCOUNT 125
+
+// 5^i and 2^k/5^i, normalized to 125 bits, as {low, high}
+static const u64 G_PNSLR_Internal_Pow5InvSplit[342][2] =
+{
+    {                   1ULL,  2305843009213693952ULL}, {11068046444225730970ULL,  1844674407370955161ULL},
+    { 5165088340638674453ULL,  1475739525896764129ULL}, { 7821419487252849886ULL,  1180591620717411303ULL},
+    { 8824922364862649494ULL,  1888946593147858085ULL}, { 7059937891890119595ULL,  1511157274518286468ULL},
+    {13026647942995916322ULL,  1208925819614629174ULL}, { 9774590264567735146ULL,  1934281311383406679ULL},
+    {11509021026396098440ULL,  1547425049106725343ULL}, {16585914450600699399ULL,  1237940039285380274ULL},
+    {15469416676735388068ULL,  1980704062856608439ULL}, {16064882156130220778ULL,  1584563250285286751ULL},
+    { 9162556910162266299ULL,  1267650600228229401ULL}, { 7281393426775805432ULL,  2028240960365167042ULL},
+    {16893161185646375315ULL,  1622592768292133633ULL}, { 2446482504291369283ULL,  1298074214633706907ULL},
+    { 7603720821608101175ULL,  2076918743413931051ULL}, { 2393627842544570617ULL,  1661534994731144841ULL},
+    {16672297533003297786ULL,  1329227995784915872ULL}, {11918280793837635165ULL,  2126764793255865396ULL},
+    { 5845275820328197809ULL,  1701411834604692317ULL}, {15744267100488289217ULL,  1361129467683753853ULL},
+    { 3054734472329800808ULL,  2177807148294006166ULL}, {17201182836831481939ULL,  1742245718635204932ULL},
+    { 6382248639981364905ULL,  1393796574908163946ULL}, { 2832900194486363201ULL,  2230074519853062314ULL},
+    { 5955668970331000884ULL,  1784059615882449851ULL}, { 1075186361522890384ULL,  1427247692705959881ULL},
+    {12788344622662355584ULL,  2283596308329535809ULL}, {13920024512871794791ULL,  1826877046663628647ULL},
+    { 3757321980813615186ULL,  1461501637330902918ULL}, {10384555214134712795ULL,  1169201309864722334ULL},
+    { 5547241898389809503ULL,  1870722095783555735ULL}, { 4437793518711847602ULL,  1496577676626844588ULL},
+    {10928932444453298728ULL,  1197262141301475670ULL}, {17486291911125277965ULL,  1915619426082361072ULL},
+    { 6610335899416401726ULL,  1532495540865888858ULL}, {12666966349016942027ULL,  1225996432692711086ULL},
+    {12888448528943286597ULL,  1961594292308337738ULL}, {17689456452638449924ULL,  1569275433846670190ULL},
+    {14151565162110759939ULL,  1255420347077336152ULL}, { 7885109000409574610ULL,  2008672555323737844ULL},
+    { 9997436015069570011ULL,  1606938044258990275ULL}, { 7997948812055656009ULL,  1285550435407192220ULL},
+    {12796718099289049614ULL,  2056880696651507552ULL}, { 2858676849947419045ULL,  1645504557321206042ULL},
+    {13354987924183666206ULL,  1316403645856964833ULL}, {17678631863951955605ULL,  2106245833371143733ULL},
+    { 3074859046935833515ULL,  1684996666696914987ULL}, {13527933681774397782ULL,  1347997333357531989ULL},
+    {10576647446613305481ULL,  2156795733372051183ULL}, {15840015586774465031ULL,  1725436586697640946ULL},
+    { 8982663654677661702ULL,  1380349269358112757ULL}, {18061610662226169046ULL,  2208558830972980411ULL},
+    {10759939715039024913ULL,  1766847064778384329ULL}, {12297300586773130254ULL,  1413477651822707463ULL},
+    {15986332124095098083ULL,  2261564242916331941ULL}, { 9099716884534168143ULL,  1809251394333065553ULL},
+    {14658471137111155161ULL,  1447401115466452442ULL}, { 4348079280205103483ULL,  1157920892373161954ULL},
+    {14335624477811986218ULL,  1852673427797059126ULL}, { 7779150767507678651ULL,  1482138742237647301ULL},
+    { 2533971799264232598ULL,  1185710993790117841ULL}, {15122401323048503126ULL,  1897137590064188545ULL},
+    {12097921058438802501ULL,  1517710072051350836ULL}, { 5988988032009131678ULL,  1214168057641080669ULL},
+    {16961078480698431330ULL,  1942668892225729070ULL}, {13568862784558745064ULL,  1554135113780583256ULL},
+    { 7165741412905085728ULL,  1243308091024466605ULL}, {11465186260648137165ULL,  1989292945639146568ULL},
+    {16550846638002330379ULL,  1591434356511317254ULL}, {16930026125143774626ULL,  1273147485209053803ULL},
+    { 4951948911778577463ULL,  2037035976334486086ULL}, {  272210314680951647ULL,  1629628781067588869ULL},
+    { 3907117066486671641ULL,  1303703024854071095ULL}, { 6251387306378674625ULL,  2085924839766513752ULL},
+    {16069156289328670670ULL,  1668739871813211001ULL}, { 9165976216721026213ULL,  1334991897450568801ULL},
+    { 7286864317269821294ULL,  2135987035920910082ULL}, {16897537898041588005ULL,  1708789628736728065ULL},
+    {13518030318433270404ULL,  1367031702989382452ULL}, { 6871453250525591353ULL,  2187250724783011924ULL},
+    { 9186511415162383406ULL,  1749800579826409539ULL}, {11038557946871817048ULL,  1399840463861127631ULL},
+    {10282995085511086630ULL,  2239744742177804210ULL}, { 8226396068408869304ULL,  1791795793742243368ULL},
+    {13959814484210916090ULL,  1433436634993794694ULL}, {11267656730511734774ULL,  2293498615990071511ULL},
+    { 5324776569667477496ULL,  1834798892792057209ULL}, { 7949170070475892320ULL,  1467839114233645767ULL},
+    {17427382500606444826ULL,  1174271291386916613ULL}, { 5747719112518849781ULL,  1878834066219066582ULL},
+    {15666221734240810795ULL,  1503067252975253265ULL}, {12532977387392648636ULL,  1202453802380202612ULL},
+    { 5295368560860596524ULL,  1923926083808324180ULL}, { 4236294848688477220ULL,  1539140867046659344ULL},
+    { 7078384693692692099ULL,  1231312693637327475ULL}, {11325415509908307358ULL,  1970100309819723960ULL},
+    { 9060332407926645887ULL,  1576080247855779168ULL}, {14626963555825137356ULL,  1260864198284623334ULL},
+    {12335095245094488799ULL,  2017382717255397335ULL}, { 9868076196075591040ULL,  1613906173804317868ULL},
+    {15273158586344293478ULL,  1291124939043454294ULL}, {13369007293925138595ULL,  2065799902469526871ULL},
+    { 7005857020398200553ULL,  1652639921975621497ULL}, {16672732060544291412ULL,  1322111937580497197ULL},
+    {11918976037903224966ULL,  2115379100128795516ULL}, { 5845832015580669650ULL,  1692303280103036413ULL},
+    {12055363241948356366ULL,  1353842624082429130ULL}, {  841837113407818570ULL,  2166148198531886609ULL},
+    { 4362818505468165179ULL,  1732918558825509287ULL}, {14558301248600263113ULL,  1386334847060407429ULL},
+    {12225235553534690011ULL,  2218135755296651887ULL}, { 2401490813343931363ULL,  1774508604237321510ULL},
+    { 1921192650675145090ULL,  1419606883389857208ULL}, {17831303500047873437ULL,  2271371013423771532ULL},
+    { 6886345170554478103ULL,  1817096810739017226ULL}, { 1819727321701672159ULL,  1453677448591213781ULL},
+    {16213177116328979020ULL,  1162941958872971024ULL}, {14873036941900635463ULL,  1860707134196753639ULL},
+    {15587778368262418694ULL,  1488565707357402911ULL}, { 8780873879868024632ULL,  1190852565885922329ULL},
+    { 2981351763563108441ULL,  1905364105417475727ULL}, {13453127855076217722ULL,  1524291284333980581ULL},
+    { 7073153469319063855ULL,  1219433027467184465ULL}, {11317045550910502167ULL,  1951092843947495144ULL},
+    {12742985255470312057ULL,  1560874275157996115ULL}, {10194388204376249646ULL,  1248699420126396892ULL},
+    { 1553625868034358140ULL,  1997919072202235028ULL}, { 8621598323911307159ULL,  1598335257761788022ULL},
+    {17965325103354776697ULL,  1278668206209430417ULL}, {13987124906400001422ULL,  2045869129935088668ULL},
+    {  121653480894270168ULL,  1636695303948070935ULL}, {   97322784715416134ULL,  1309356243158456748ULL},
+    {14913111714512307107ULL,  2094969989053530796ULL}, { 8241140556867935363ULL,  1675975991242824637ULL},
+    {17660958889720079260ULL,  1340780792994259709ULL}, {17189487779326395846ULL,  2145249268790815535ULL},
+    {13751590223461116677ULL,  1716199415032652428ULL}, {18379969808252713988ULL,  1372959532026121942ULL},
+    {14650556434236701088ULL,  2196735251241795108ULL}, {  652398703163629901ULL,  1757388200993436087ULL},
+    {11589965406756634890ULL,  1405910560794748869ULL}, { 7475898206584884855ULL,  2249456897271598191ULL},
+    { 2291369750525997561ULL,  1799565517817278553ULL}, { 9211793429904618695ULL,  1439652414253822842ULL},
+    {18428218302589300235ULL,  2303443862806116547ULL}, { 7363877012587619542ULL,  1842755090244893238ULL},
+    {13269799239553916280ULL,  1474204072195914590ULL}, {10615839391643133024ULL,  1179363257756731672ULL},
+    { 2227947767661371545ULL,  1886981212410770676ULL}, {16539753473096738529ULL,  1509584969928616540ULL},
+    {13231802778477390823ULL,  1207667975942893232ULL}, { 6413489186596184024ULL,  1932268761508629172ULL},
+    {16198837793502678189ULL,  1545815009206903337ULL}, { 5580372605318321905ULL,  1236652007365522670ULL},
+    { 8928596168509315048ULL,  1978643211784836272ULL}, {18210923379033183008ULL,  1582914569427869017ULL},
+    { 7190041073742725760ULL,  1266331655542295214ULL}, {  436019273762630246ULL,  2026130648867672343ULL},
+    { 7727513048493924843ULL,  1620904519094137874ULL}, { 9871359253537050198ULL,  1296723615275310299ULL},
+    { 4726128361433549347ULL,  2074757784440496479ULL}, { 7470251503888749801ULL,  1659806227552397183ULL},
+    {13354898832594820487ULL,  1327844982041917746ULL}, {13989140502667892133ULL,  2124551971267068394ULL},
+    {14880661216876224029ULL,  1699641577013654715ULL}, {11904528973500979224ULL,  1359713261610923772ULL},
+    { 4289851098633925465ULL,  2175541218577478036ULL}, {18189276137874781665ULL,  1740432974861982428ULL},
+    { 3483374466074094362ULL,  1392346379889585943ULL}, { 1884050330976640656ULL,  2227754207823337509ULL},
+    { 5196589079523222848ULL,  1782203366258670007ULL}, {15225317707844309248ULL,  1425762693006936005ULL},
+    { 5913764258841343181ULL,  2281220308811097609ULL}, { 8420360221814984868ULL,  1824976247048878087ULL},
+    {17804334621677718864ULL,  1459980997639102469ULL}, {17932816512084085415ULL,  1167984798111281975ULL},
+    {10245762345624985047ULL,  1868775676978051161ULL}, { 4507261061758077715ULL,  1495020541582440929ULL},
+    { 7295157664148372495ULL,  1196016433265952743ULL}, { 7982903447895485668ULL,  1913626293225524389ULL},
+    {10075671573058298858ULL,  1530901034580419511ULL}, { 4371188443704728763ULL,  1224720827664335609ULL},
+    {14372599139411386667ULL,  1959553324262936974ULL}, {15187428126271019657ULL,  1567642659410349579ULL},
+    {15839291315758726049ULL,  1254114127528279663ULL}, { 3206773216762499739ULL,  2006582604045247462ULL},
+    {13633465017635730761ULL,  1605266083236197969ULL}, {14596120828850494932ULL,  1284212866588958375ULL},
+    { 4907049252451240275ULL,  2054740586542333401ULL}, {  236290587219081897ULL,  1643792469233866721ULL},
+    {14946427728742906810ULL,  1315033975387093376ULL}, {16535586736504830250ULL,  2104054360619349402ULL},
+    { 5849771759720043554ULL,  1683243488495479522ULL}, {15747863852001765813ULL,  1346594790796383617ULL},
+    {10439186904235184007ULL,  2154551665274213788ULL}, {15730047152871967852ULL,  1723641332219371030ULL},
+    {12584037722297574282ULL,  1378913065775496824ULL}, { 9066413911450387881ULL,  2206260905240794919ULL},
+    {10942479943902220628ULL,  1765008724192635935ULL}, { 8753983955121776503ULL,  1412006979354108748ULL},
+    {10317025513452932081ULL,  2259211166966573997ULL}, {  874922781278525018ULL,  1807368933573259198ULL},
+    { 8078635854506640661ULL,  1445895146858607358ULL}, {13841606313089133175ULL,  1156716117486885886ULL},
+    {14767872471458792434ULL,  1850745787979017418ULL}, {  746251532941302978ULL,  1480596630383213935ULL},
+    {  597001226353042382ULL,  1184477304306571148ULL}, {15712597221132509104ULL,  1895163686890513836ULL},
+    { 8880728962164096960ULL,  1516130949512411069ULL}, {10793931984473187891ULL,  1212904759609928855ULL},
+    {17270291175157100626ULL,  1940647615375886168ULL}, { 2748186495899949531ULL,  1552518092300708935ULL},
+    { 2198549196719959625ULL,  1242014473840567148ULL}, {18275073973719576693ULL,  1987223158144907436ULL},
+    {10930710364233751031ULL,  1589778526515925949ULL}, {12433917106128911148ULL,  1271822821212740759ULL},
+    { 8826220925580526867ULL,  2034916513940385215ULL}, { 7060976740464421494ULL,  1627933211152308172ULL},
+    {16716827836597268165ULL,  1302346568921846537ULL}, {11989529279587987770ULL,  2083754510274954460ULL},
+    { 9591623423670390216ULL,  1667003608219963568ULL}, {15051996368420132820ULL,  1333602886575970854ULL},
+    {13015147745246481542ULL,  2133764618521553367ULL}, { 3033420566713364587ULL,  1707011694817242694ULL},
+    { 6116085268112601993ULL,  1365609355853794155ULL}, { 9785736428980163188ULL,  2184974969366070648ULL},
+    {15207286772667951197ULL,  1747979975492856518ULL}, { 1097782973908629988ULL,  1398383980394285215ULL},
+    { 1756452758253807981ULL,  2237414368630856344ULL}, { 5094511021344956708ULL,  1789931494904685075ULL},
+    { 4075608817075965366ULL,  1431945195923748060ULL}, { 6520974107321544586ULL,  2291112313477996896ULL},
+    { 1527430471115325346ULL,  1832889850782397517ULL}, {12289990821117991246ULL,  1466311880625918013ULL},
+    {17210690286378213644ULL,  1173049504500734410ULL}, { 9090360384495590213ULL,  1876879207201175057ULL},
+    {18340334751822203140ULL,  1501503365760940045ULL}, {14672267801457762512ULL,  1201202692608752036ULL},
+    {16096930852848599373ULL,  1921924308174003258ULL}, { 1809498238053148529ULL,  1537539446539202607ULL},
+    {12515645034668249793ULL,  1230031557231362085ULL}, { 1578287981759648052ULL,  1968050491570179337ULL},
+    {12330676829633449412ULL,  1574440393256143469ULL}, {13553890278448669853ULL,  1259552314604914775ULL},
+    { 3239480371808320148ULL,  2015283703367863641ULL}, {17348979556414297411ULL,  1612226962694290912ULL},
+    { 6500486015647617283ULL,  1289781570155432730ULL}, {10400777625036187652ULL,  2063650512248692368ULL},
+    {15699319729512770768ULL,  1650920409798953894ULL}, {16248804598352126938ULL,  1320736327839163115ULL},
+    { 7551343283653851484ULL,  2113178124542660985ULL}, { 6041074626923081187ULL,  1690542499634128788ULL},
+    {12211557331022285596ULL,  1352433999707303030ULL}, { 1091747655926105338ULL,  2163894399531684849ULL},
+    { 4562746939482794594ULL,  1731115519625347879ULL}, { 7339546366328145998ULL,  1384892415700278303ULL},
+    { 8053925371383123274ULL,  2215827865120445285ULL}, { 6443140297106498619ULL,  1772662292096356228ULL},
+    {12533209867169019542ULL,  1418129833677084982ULL}, { 5295740528502789974ULL,  2269007733883335972ULL},
+    {15304638867027962949ULL,  1815206187106668777ULL}, { 4865013464138549713ULL,  1452164949685335022ULL},
+    {14960057215536570740ULL,  1161731959748268017ULL}, { 9178696285890871890ULL,  1858771135597228828ULL},
+    {14721654658196518159ULL,  1487016908477783062ULL}, { 4398626097073393881ULL,  1189613526782226450ULL},
+    { 7037801755317430209ULL,  1903381642851562320ULL}, { 5630241404253944167ULL,  1522705314281249856ULL},
+    {  814844308661245011ULL,  1218164251424999885ULL}, { 1303750893857992017ULL,  1949062802279999816ULL},
+    {15800395974054034906ULL,  1559250241823999852ULL}, { 5261619149759407279ULL,  1247400193459199882ULL},
+    {12107939454356961969ULL,  1995840309534719811ULL}, { 5997002748743659252ULL,  1596672247627775849ULL},
+    { 8486951013736837725ULL,  1277337798102220679ULL}, { 2511075177753209390ULL,  2043740476963553087ULL},
+    {13076906586428298482ULL,  1634992381570842469ULL}, {14150874083884549109ULL,  1307993905256673975ULL},
+    { 4194654460505726958ULL,  2092790248410678361ULL}, {18113118827372222859ULL,  1674232198728542688ULL},
+    { 3422448617672047318ULL,  1339385758982834151ULL}, {16543964232501006678ULL,  2143017214372534641ULL},
+    { 9545822571258895019ULL,  1714413771498027713ULL}, {15015355686490936662ULL,  1371531017198422170ULL},
+    { 5577825024675947042ULL,  2194449627517475473ULL}, {11840957649224578280ULL,  1755559702013980378ULL},
+    {16851463748863483271ULL,  1404447761611184302ULL}, {12204946739213931940ULL,  2247116418577894884ULL},
+    {13453306206113055875ULL,  1797693134862315907ULL}, { 3383947335406624054ULL,  1438154507889852726ULL},
+    {16482362180876329456ULL,  2301047212623764361ULL}, { 9496540929959153242ULL,  1840837770099011489ULL},
+    {11286581558709232917ULL,  1472670216079209191ULL}, { 5339916432225476010ULL,  1178136172863367353ULL},
+    { 4854517476818851293ULL,  1885017876581387765ULL}, { 3883613981455081034ULL,  1508014301265110212ULL},
+    {14174937629389795797ULL,  1206411441012088169ULL}, {11611853762797942306ULL,  1930258305619341071ULL},
+    { 5600134195496443521ULL,  1544206644495472857ULL}, {15548153800622885787ULL,  1235365315596378285ULL},
+    { 6430302007287065643ULL,  1976584504954205257ULL}, {16212288050055383484ULL,  1581267603963364205ULL},
+    {12969830440044306787ULL,  1265014083170691364ULL}, { 9683682259845159889ULL,  2024022533073106183ULL},
+    {15125643437359948558ULL,  1619218026458484946ULL}, { 8411165935146048523ULL,  1295374421166787957ULL},
+    {17147214310975587960ULL,  2072599073866860731ULL}, {10028422634038560045ULL,  1658079259093488585ULL},
+    { 8022738107230848036ULL,  1326463407274790868ULL}, { 9147032156827446534ULL,  2122341451639665389ULL},
+    {11006974540203867551ULL,  1697873161311732311ULL}, { 5116230817421183718ULL,  1358298529049385849ULL},
+    {15564666937357714594ULL,  2173277646479017358ULL}, { 1383687105660440706ULL,  1738622117183213887ULL},
+    {12174996128754083534ULL,  1390897693746571109ULL}, { 8411947361780802685ULL,  2225436309994513775ULL},
+    { 6729557889424642148ULL,  1780349047995611020ULL}, { 5383646311539713719ULL,  1424279238396488816ULL},
+    { 1235136468979721303ULL,  2278846781434382106ULL}, {15745504434151418335ULL,  1823077425147505684ULL},
+    {16285752362063044992ULL,  1458461940118004547ULL}, { 5649904260166615347ULL,  1166769552094403638ULL},
+    { 5350498001524674232ULL,  1866831283351045821ULL}, {  591049586477829062ULL,  1493465026680836657ULL},
+    {11540886113407994219ULL,  1194772021344669325ULL}, {   18673707743239135ULL,  1911635234151470921ULL},
+    {14772334225162232601ULL,  1529308187321176736ULL}, { 8128518565387875758ULL,  1223446549856941389ULL},
+    { 1937583260394870242ULL,  1957514479771106223ULL}, { 8928764237799716840ULL,  1566011583816884978ULL},
+    {14521709019723594119ULL,  1252809267053507982ULL}, { 8477339172590109297ULL,  2004494827285612772ULL},
+    {17849917782297818407ULL,  1603595861828490217ULL}, { 6901236596354434079ULL,  1282876689462792174ULL},
+    {18420676183650915173ULL,  2052602703140467478ULL}, { 3668494502695001169ULL,  1642082162512373983ULL},
+    {10313493231639821582ULL,  1313665730009899186ULL}, { 9122891541139893884ULL,  2101865168015838698ULL},
+    {14677010862395735754ULL,  1681492134412670958ULL}, {  673562245690857633ULL,  1345193707530136767ULL},
+};
+
+static const u64 G_PNSLR_Internal_Pow5Split[326][2] =
+{
+    {                   0ULL,  1152921504606846976ULL}, {                   0ULL,  1441151880758558720ULL},
+    {                   0ULL,  1801439850948198400ULL}, {                   0ULL,  2251799813685248000ULL},
+    {                   0ULL,  1407374883553280000ULL}, {                   0ULL,  1759218604441600000ULL},
+    {                   0ULL,  2199023255552000000ULL}, {                   0ULL,  1374389534720000000ULL},
+    {                   0ULL,  1717986918400000000ULL}, {                   0ULL,  2147483648000000000ULL},
+    {                   0ULL,  1342177280000000000ULL}, {                   0ULL,  1677721600000000000ULL},
+    {                   0ULL,  2097152000000000000ULL}, {                   0ULL,  1310720000000000000ULL},
+    {                   0ULL,  1638400000000000000ULL}, {                   0ULL,  2048000000000000000ULL},
+    {                   0ULL,  1280000000000000000ULL}, {                   0ULL,  1600000000000000000ULL},
+    {                   0ULL,  2000000000000000000ULL}, {                   0ULL,  1250000000000000000ULL},
+    {                   0ULL,  1562500000000000000ULL}, {                   0ULL,  1953125000000000000ULL},
+    {                   0ULL,  1220703125000000000ULL}, {                   0ULL,  1525878906250000000ULL},
+    {                   0ULL,  1907348632812500000ULL}, {                   0ULL,  1192092895507812500ULL},
+    {                   0ULL,  1490116119384765625ULL}, { 4611686018427387904ULL,  1862645149230957031ULL},
+    { 9799832789158199296ULL,  1164153218269348144ULL}, {12249790986447749120ULL,  1455191522836685180ULL},
+    {15312238733059686400ULL,  1818989403545856475ULL}, {14528612397897220096ULL,  2273736754432320594ULL},
+    {13692068767113150464ULL,  1421085471520200371ULL}, {12503399940464050176ULL,  1776356839400250464ULL},
+    {15629249925580062720ULL,  2220446049250313080ULL}, { 9768281203487539200ULL,  1387778780781445675ULL},
+    { 7598665485932036096ULL,  1734723475976807094ULL}, {  274959820560269312ULL,  2168404344971008868ULL},
+    { 9395221924704944128ULL,  1355252715606880542ULL}, { 2520655369026404352ULL,  1694065894508600678ULL},
+    {12374191248137781248ULL,  2117582368135750847ULL}, {14651398557727195136ULL,  1323488980084844279ULL},
+    {13702562178731606016ULL,  1654361225106055349ULL}, { 3293144668132343808ULL,  2067951531382569187ULL},
+    {18199116482078572544ULL,  1292469707114105741ULL}, { 8913837547316051968ULL,  1615587133892632177ULL},
+    {15753982952572452864ULL,  2019483917365790221ULL}, {12152082354571476992ULL,  1262177448353618888ULL},
+    {15190102943214346240ULL,  1577721810442023610ULL}, { 9764256642163156992ULL,  1972152263052529513ULL},
+    {17631875447420442880ULL,  1232595164407830945ULL}, { 8204786253993389888ULL,  1540743955509788682ULL},
+    { 1032610780636961552ULL,  1925929944387235853ULL}, { 2951224747111794922ULL,  1203706215242022408ULL},
+    { 3689030933889743652ULL,  1504632769052528010ULL}, {13834660704216955373ULL,  1880790961315660012ULL},
+    {17870034976990372916ULL,  1175494350822287507ULL}, {17725857702810578241ULL,  1469367938527859384ULL},
+    { 3710578054803671186ULL,  1836709923159824231ULL}, {   26536550077201078ULL,  2295887403949780289ULL},
+    {11545800389866720434ULL,  1434929627468612680ULL}, {14432250487333400542ULL,  1793662034335765850ULL},
+    { 8816941072311974870ULL,  2242077542919707313ULL}, {17039803216263454053ULL,  1401298464324817070ULL},
+    {12076381983474541759ULL,  1751623080406021338ULL}, { 5872105442488401391ULL,  2189528850507526673ULL},
+    {15199280947623720629ULL,  1368455531567204170ULL}, { 9775729147674874978ULL,  1710569414459005213ULL},
+    {16831347453020981627ULL,  2138211768073756516ULL}, { 1296220121283337709ULL,  1336382355046097823ULL},
+    {15455333206886335848ULL,  1670477943807622278ULL}, {10095794471753144002ULL,  2088097429759527848ULL},
+    { 6309871544845715001ULL,  1305060893599704905ULL}, {12499025449484531656ULL,  1631326116999631131ULL},
+    {11012095793428276666ULL,  2039157646249538914ULL}, {11494245889320060820ULL,  1274473528905961821ULL},
+    {  532749306367912313ULL,  1593091911132452277ULL}, { 5277622651387278295ULL,  1991364888915565346ULL},
+    { 7910200175544436838ULL,  1244603055572228341ULL}, {14499436237857933952ULL,  1555753819465285426ULL},
+    { 8900923260467641632ULL,  1944692274331606783ULL}, {12480606065433357876ULL,  1215432671457254239ULL},
+    {10989071563364309441ULL,  1519290839321567799ULL}, { 9124653435777998898ULL,  1899113549151959749ULL},
+    { 8008751406574943263ULL,  1186945968219974843ULL}, { 5399253239791291175ULL,  1483682460274968554ULL},
+    {15972438586593889776ULL,  1854603075343710692ULL}, {  759402079766405302ULL,  1159126922089819183ULL},
+    {14784310654990170340ULL,  1448908652612273978ULL}, { 9257016281882937117ULL,  1811135815765342473ULL},
+    {16182956370781059300ULL,  2263919769706678091ULL}, { 7808504722524468110ULL,  1414949856066673807ULL},
+    { 5148944884728197234ULL,  1768687320083342259ULL}, { 1824495087482858639ULL,  2210859150104177824ULL},
+    { 1140309429676786649ULL,  1381786968815111140ULL}, { 1425386787095983311ULL,  1727233711018888925ULL},
+    { 6393419502297367043ULL,  2159042138773611156ULL}, {13219259225790630210ULL,  1349401336733506972ULL},
+    {16524074032238287762ULL,  1686751670916883715ULL}, {16043406521870471799ULL,  2108439588646104644ULL},
+    {  803757039314269066ULL,  1317774742903815403ULL}, {14839754354425000045ULL,  1647218428629769253ULL},
+    { 4714634887749086344ULL,  2059023035787211567ULL}, { 9864175832484260821ULL,  1286889397367007229ULL},
+    {16941905809032713930ULL,  1608611746708759036ULL}, { 2730638187581340797ULL,  2010764683385948796ULL},
+    {10930020904093113806ULL,  1256727927116217997ULL}, {18274212148543780162ULL,  1570909908895272496ULL},
+    { 4396021111970173586ULL,  1963637386119090621ULL}, { 5053356204195052443ULL,  1227273366324431638ULL},
+    {15540067292098591362ULL,  1534091707905539547ULL}, {14813398096695851299ULL,  1917614634881924434ULL},
+    {13870059828862294966ULL,  1198509146801202771ULL}, {12725888767650480803ULL,  1498136433501503464ULL},
+    {15907360959563101004ULL,  1872670541876879330ULL}, {14553786618154326031ULL,  1170419088673049581ULL},
+    { 4357175217410743827ULL,  1463023860841311977ULL}, {10058155040190817688ULL,  1828779826051639971ULL},
+    { 7961007781811134206ULL,  2285974782564549964ULL}, {14199001900486734687ULL,  1428734239102843727ULL},
+    {13137066357181030455ULL,  1785917798878554659ULL}, {11809646928048900164ULL,  2232397248598193324ULL},
+    {16604401366885338411ULL,  1395248280373870827ULL}, {16143815690179285109ULL,  1744060350467338534ULL},
+    {10956397575869330579ULL,  2180075438084173168ULL}, { 6847748484918331612ULL,  1362547148802608230ULL},
+    {17783057643002690323ULL,  1703183936003260287ULL}, {17617136035325974999ULL,  2128979920004075359ULL},
+    {17928239049719816230ULL,  1330612450002547099ULL}, {17798612793722382384ULL,  1663265562503183874ULL},
+    {13024893955298202172ULL,  2079081953128979843ULL}, { 5834715712847682405ULL,  1299426220705612402ULL},
+    {16516766677914378815ULL,  1624282775882015502ULL}, {11422586310538197711ULL,  2030353469852519378ULL},
+    {11750802462513761473ULL,  1268970918657824611ULL}, {10076817059714813937ULL,  1586213648322280764ULL},
+    {12596021324643517422ULL,  1982767060402850955ULL}, { 5566670318688504437ULL,  1239229412751781847ULL},
+    { 2346651879933242642ULL,  1549036765939727309ULL}, { 7545000868343941206ULL,  1936295957424659136ULL},
+    { 4715625542714963254ULL,  1210184973390411960ULL}, { 5894531928393704067ULL,  1512731216738014950ULL},
+    {16591536947346905892ULL,  1890914020922518687ULL}, {17287239619732898039ULL,  1181821263076574179ULL},
+    {16997363506238734644ULL,  1477276578845717724ULL}, { 2799960309088866689ULL,  1846595723557147156ULL},
+    {10973347230035317489ULL,  1154122327223216972ULL}, {13716684037544146861ULL,  1442652909029021215ULL},
+    {12534169028502795672ULL,  1803316136286276519ULL}, {11056025267201106687ULL,  2254145170357845649ULL},
+    {18439230838069161439ULL,  1408840731473653530ULL}, {13825666510731675991ULL,  1761050914342066913ULL},
+    { 3447025083132431277ULL,  2201313642927583642ULL}, { 6766076695385157452ULL,  1375821026829739776ULL},
+    { 8457595869231446815ULL,  1719776283537174720ULL}, {10571994836539308519ULL,  2149720354421468400ULL},
+    { 6607496772837067824ULL,  1343575221513417750ULL}, {17482743002901110588ULL,  1679469026891772187ULL},
+    {17241742735199000331ULL,  2099336283614715234ULL}, {15387775227926763111ULL,  1312085177259197021ULL},
+    { 5399660979626290177ULL,  1640106471573996277ULL}, {11361262242960250625ULL,  2050133089467495346ULL},
+    {11712474920277544544ULL,  1281333180917184591ULL}, {10028907631919542777ULL,  1601666476146480739ULL},
+    { 7924448521472040567ULL,  2002083095183100924ULL}, {14176152362774801162ULL,  1251301934489438077ULL},
+    { 3885132398186337741ULL,  1564127418111797597ULL}, { 9468101516160310080ULL,  1955159272639746996ULL},
+    {15140935484454969608ULL,  1221974545399841872ULL}, {  479425281859160394ULL,  1527468181749802341ULL},
+    { 5210967620751338397ULL,  1909335227187252926ULL}, {17091912818251750210ULL,  1193334516992033078ULL},
+    {12141518985959911954ULL,  1491668146240041348ULL}, {15176898732449889943ULL,  1864585182800051685ULL},
+    {11791404716994875166ULL,  1165365739250032303ULL}, {10127569877816206054ULL,  1456707174062540379ULL},
+    { 8047776328842869663ULL,  1820883967578175474ULL}, {  836348374198811271ULL,  2276104959472719343ULL},
+    { 7440246761515338900ULL,  1422565599670449589ULL}, {13911994470321561530ULL,  1778206999588061986ULL},
+    { 8166621051047176104ULL,  2222758749485077483ULL}, { 2798295147690791113ULL,  1389224218428173427ULL},
+    {17332926989895652603ULL,  1736530273035216783ULL}, {17054472718942177850ULL,  2170662841294020979ULL},
+    { 8353202440125167204ULL,  1356664275808763112ULL}, {10441503050156459005ULL,  1695830344760953890ULL},
+    { 3828506775840797949ULL,  2119787930951192363ULL}, {   86973725686804766ULL,  1324867456844495227ULL},
+    {13943775212390669669ULL,  1656084321055619033ULL}, { 3594660960206173375ULL,  2070105401319523792ULL},
+    { 2246663100128858359ULL,  1293815875824702370ULL}, {12031700912015848757ULL,  1617269844780877962ULL},
+    { 5816254103165035138ULL,  2021587305976097453ULL}, { 5941001823691840913ULL,  1263492066235060908ULL},
+    { 7426252279614801142ULL,  1579365082793826135ULL}, { 4671129331091113523ULL,  1974206353492282669ULL},
+    { 5225298841145639904ULL,  1233878970932676668ULL}, { 6531623551432049880ULL,  1542348713665845835ULL},
+    { 3552843420862674446ULL,  1927935892082307294ULL}, {16055585193321335241ULL,  1204959932551442058ULL},
+    {10846109454796893243ULL,  1506199915689302573ULL}, {18169322836923504458ULL,  1882749894611628216ULL},
+    {11355826773077190286ULL,  1176718684132267635ULL}, { 9583097447919099954ULL,  1470898355165334544ULL},
+    {11978871809898874942ULL,  1838622943956668180ULL}, {14973589762373593678ULL,  2298278679945835225ULL},
+    { 2440964573842414192ULL,  1436424174966147016ULL}, { 3051205717303017741ULL,  1795530218707683770ULL},
+    {13037379183483547984ULL,  2244412773384604712ULL}, { 8148361989677217490ULL,  1402757983365377945ULL},
+    {14797138505523909766ULL,  1753447479206722431ULL}, {13884737113477499304ULL,  2191809349008403039ULL},
+    {15595489723564518921ULL,  1369880843130251899ULL}, {14882676136028260747ULL,  1712351053912814874ULL},
+    { 9379973133180550126ULL,  2140438817391018593ULL}, {17391698254306313589ULL,  1337774260869386620ULL},
+    { 3292878744173340370ULL,  1672217826086733276ULL}, { 4116098430216675462ULL,  2090272282608416595ULL},
+    {  266718509671728212ULL,  1306420176630260372ULL}, {  333398137089660265ULL,  1633025220787825465ULL},
+    { 5028433689789463235ULL,  2041281525984781831ULL}, {10060300083759496378ULL,  1275800953740488644ULL},
+    {12575375104699370472ULL,  1594751192175610805ULL}, { 1884160825592049379ULL,  1993438990219513507ULL},
+    {17318501580490888525ULL,  1245899368887195941ULL}, { 7813068920331446945ULL,  1557374211108994927ULL},
+    { 5154650131986920777ULL,  1946717763886243659ULL}, {  915813323278131534ULL,  1216698602428902287ULL},
+    {14979824709379828129ULL,  1520873253036127858ULL}, { 9501408849870009354ULL,  1901091566295159823ULL},
+    {12855909558809837702ULL,  1188182228934474889ULL}, { 2234828893230133415ULL,  1485227786168093612ULL},
+    { 2793536116537666769ULL,  1856534732710117015ULL}, { 8663489100477123587ULL,  1160334207943823134ULL},
+    { 1605989338741628675ULL,  1450417759929778918ULL}, {11230858710281811652ULL,  1813022199912223647ULL},
+    { 9426887369424876662ULL,  2266277749890279559ULL}, {12809333633531629769ULL,  1416423593681424724ULL},
+    {16011667041914537212ULL,  1770529492101780905ULL}, { 6179525747111007803ULL,  2213161865127226132ULL},
+    {13085575628799155685ULL,  1383226165704516332ULL}, {16356969535998944606ULL,  1729032707130645415ULL},
+    {15834525901571292854ULL,  2161290883913306769ULL}, { 2979049660840976177ULL,  1350806802445816731ULL},
+    {17558870131333383934ULL,  1688508503057270913ULL}, { 8113529608884566205ULL,  2110635628821588642ULL},
+    { 9682642023980241782ULL,  1319147268013492901ULL}, {16714988548402690132ULL,  1648934085016866126ULL},
+    {11670363648648586857ULL,  2061167606271082658ULL}, {11905663298832754689ULL,  1288229753919426661ULL},
+    { 1047021068258779650ULL,  1610287192399283327ULL}, {15143834390605638274ULL,  2012858990499104158ULL},
+    { 4853210475701136017ULL,  1258036869061940099ULL}, { 1454827076199032118ULL,  1572546086327425124ULL},
+    { 1818533845248790147ULL,  1965682607909281405ULL}, { 3442426662494187794ULL,  1228551629943300878ULL},
+    {13526405364972510550ULL,  1535689537429126097ULL}, { 3072948650933474476ULL,  1919611921786407622ULL},
+    {15755650962115585259ULL,  1199757451116504763ULL}, {15082877684217093670ULL,  1499696813895630954ULL},
+    { 9630225068416591280ULL,  1874621017369538693ULL}, { 8324733676974063502ULL,  1171638135855961683ULL},
+    { 5794231077790191473ULL,  1464547669819952104ULL}, { 7242788847237739342ULL,  1830684587274940130ULL},
+    {18276858095901949986ULL,  2288355734093675162ULL}, {16034722328366106645ULL,  1430222333808546976ULL},
+    { 1596658836748081690ULL,  1787777917260683721ULL}, { 6607509564362490017ULL,  2234722396575854651ULL},
+    { 1823850468512862308ULL,  1396701497859909157ULL}, { 6891499104068465790ULL,  1745876872324886446ULL},
+    {17837745916940358045ULL,  2182346090406108057ULL}, { 4231062170446641922ULL,  1363966306503817536ULL},
+    { 5288827713058302403ULL,  1704957883129771920ULL}, { 6611034641322878003ULL,  2131197353912214900ULL},
+    {13355268687681574560ULL,  1331998346195134312ULL}, {16694085859601968200ULL,  1664997932743917890ULL},
+    {11644235287647684442ULL,  2081247415929897363ULL}, { 4971804045566108824ULL,  1300779634956185852ULL},
+    { 6214755056957636030ULL,  1625974543695232315ULL}, { 3156757802769657134ULL,  2032468179619040394ULL},
+    { 6584659645158423613ULL,  1270292612261900246ULL}, {17454196593302805324ULL,  1587865765327375307ULL},
+    {17206059723201118751ULL,  1984832206659219134ULL}, { 6142101308573311315ULL,  1240520129162011959ULL},
+    { 3065940617289251240ULL,  1550650161452514949ULL}, { 8444111790038951954ULL,  1938312701815643686ULL},
+    {  665883850346957067ULL,  1211445438634777304ULL}, {  832354812933696334ULL,  1514306798293471630ULL},
+    {10263815553021896226ULL,  1892883497866839537ULL}, {17944099766707154901ULL,  1183052186166774710ULL},
+    {13206752671529167818ULL,  1478815232708468388ULL}, {16508440839411459773ULL,  1848519040885585485ULL},
+    {12623618533845856310ULL,  1155324400553490928ULL}, {15779523167307320387ULL,  1444155500691863660ULL},
+    { 1277659885424598868ULL,  1805194375864829576ULL}, { 1597074856780748586ULL,  2256492969831036970ULL},
+    { 5609857803915355770ULL,  1410308106144398106ULL}, {16235694291748970521ULL,  1762885132680497632ULL},
+    { 1847873790976661535ULL,  2203606415850622041ULL}, {12684136165428883219ULL,  1377254009906638775ULL},
+    {11243484188358716120ULL,  1721567512383298469ULL}, {  219297180166231438ULL,  2151959390479123087ULL},
+    { 7054589765244976505ULL,  1344974619049451929ULL}, {13429923224983608535ULL,  1681218273811814911ULL},
+    {12175718012802122765ULL,  2101522842264768639ULL}, {14527352785642408584ULL,  1313451776415480399ULL},
+    {13547504963625622826ULL,  1641814720519350499ULL}, {12322695186104640628ULL,  2052268400649188124ULL},
+    {16925056528170176201ULL,  1282667750405742577ULL}, { 7321262604930556539ULL,  1603334688007178222ULL},
+    {18374950293017971482ULL,  2004168360008972777ULL}, { 4566814905495150320ULL,  1252605225005607986ULL},
+    {14931890668723713708ULL,  1565756531257009982ULL}, { 9441491299049866327ULL,  1957195664071262478ULL},
+    { 1289246043478778550ULL,  1223247290044539049ULL}, { 6223243572775861092ULL,  1529059112555673811ULL},
+    { 3167368447542438461ULL,  1911323890694592264ULL}, { 1979605279714024038ULL,  1194577431684120165ULL},
+    { 7086192618069917952ULL,  1493221789605150206ULL}, {18081112809442173248ULL,  1866527237006437757ULL},
+    {13606538515115052232ULL,  1166579523129023598ULL}, { 7784801107039039482ULL,  1458224403911279498ULL},
+    {  507629346944023544ULL,  1822780504889099373ULL}, { 5246222702107417334ULL,  2278475631111374216ULL},
+    { 3278889188817135834ULL,  1424047269444608885ULL}, { 8710297504448807696ULL,  1780059086805761106ULL},
+};
+
+static inline u64 PNSLR_Internal_MultiplyU64(u64 a, u64 b, u64* high)
+{
+    #if PNSLR_CLANG || PNSLR_GCC
+        __extension__ unsigned __int128 product = (unsigned __int128) a * b;
+        *high = (u64) (product >> 64);
+        return (u64) product;
+    #else
+        u64 aLo = (u32) a, aHi = a >> 32, bLo = (u32) b, bHi = b >> 32;
+        u64 loLo = aLo * bLo, hiLo = aHi * bLo, loHi = aLo * bHi, hiHi = aHi * bHi;
+        u64 cross = (loLo >> 32) + (u32) hiLo + loHi;
+        *high = hiHi + (hiLo >> 32) + (cross >> 32);
+        return (cross << 32) | (u32) loLo;
+    #endif
+}
+
+// (m * mul) >> j, for 64 < j < 128
+static inline u64 PNSLR_Internal_MulShift64(u64 m, const u64* mul, i32 j)
 {
-    return PNSLR_AppendU64ToStringBuilder(builder, (u64) value, base);
+    u64 high0, high1;
+    PNSLR_Internal_MultiplyU64(m, mul[0], &high0);
+    u64 low1 = PNSLR_Internal_MultiplyU64(m, mul[1], &high1);
+    u64 sum  = high0 + low1;
+    if (sum < high0) { ++high1; } // carry
+
+    i32 shift = j - 64;
+    return (high1 << (64 - shift)) | (sum >> shift);
 }
 
-b8 PNSLR_AppendU16ToStringBuilder(PNSLR_StringBuilder* builder, u16 value, PNSLR_IntegerBase base)
+static inline i32 PNSLR_Internal_Pow5Bits(i32 e)  { return (i32) (((u32) e * 1217359) >> 19) + 1; } // bit length of 5^e
+static inline i32 PNSLR_Internal_Log10Pow2(i32 e) { return (i32) (((u32) e * 78913) >> 18);      } // floor(log10(2^e))
+static inline i32 PNSLR_Internal_Log10Pow5(i32 e) { return (i32) (((u32) e * 732923) >> 20);     } // floor(log10(5^e))
+
+static inline b8 PNSLR_Internal_IsMultipleOfPow5(u64 value, i32 p)
 {
-    return PNSLR_AppendU64ToStringBuilder(builder, (u64) value, base);
+    i32 count = 0;
+    while (value > 0 && value % 5 == 0) { value /= 5; ++count; }
+    return count >= p;
 }
 
-b8 PNSLR_AppendU32ToStringBuilder(PNSLR_StringBuilder* builder, u32 value, PNSLR_IntegerBase base)
+static inline b8 PNSLR_Internal_IsMultipleOfPow2(u64 value, i32 p)
 {
-    return PNSLR_AppendU64ToStringBuilder(builder, (u64) value, base);
+    return (value & ((1ULL << p) - 1)) == 0;
 }
 
-b8 PNSLR_AppendU64ToStringBuilder(PNSLR_StringBuilder* builder, u64 value, PNSLR_IntegerBase base)
+// the float is m2 * 2^e2 (with e2 already lowered by 2 for the interval maths); `lowerGap` is set
+// when the gap to the float below is as wide as the one above, i.e. everywhere but on powers of two
+static PNSLR_Internal_DecimalFloat PNSLR_Internal_ShortestDecimal(u64 m2, i32 e2, b8 lowerGap)
 {
-    u8 prefix = 0;
-    switch (base)
+    b8  acceptBounds = (m2 & 1) == 0; // round-to-even parsing lands ties on even mantissas
+    u64 mv           = 4 * m2;
+    u64 mmShift      = lowerGap ? 1 : 0;
+
+    // scale the interval [mv - 1 - mmShift, mv + 2] / 4 down to a power of ten
+    u64 vr, vp, vm;
+    i32 e10;
+    b8  vmIsTrailingZeros = false;
+    b8  vrIsTrailingZeros = false;
+    if (e2 >= 0)
+    {
+        i32 q = PNSLR_Internal_Log10Pow2(e2) - (e2 > 3);
+        i32 k = PNSLR_INTERNAL_POW5_INV_BITCOUNT + PNSLR_Internal_Pow5Bits(q) - 1;
+        i32 i = -e2 + q + k;
+        e10   = q;
+        vr    = PNSLR_Internal_MulShift64(mv,               G_PNSLR_Internal_Pow5InvSplit[q], i);
+        vp    = PNSLR_Internal_MulShift64(mv + 2,           G_PNSLR_Internal_Pow5InvSplit[q], i);
+        vm    = PNSLR_Internal_MulShift64(mv - 1 - mmShift, G_PNSLR_Internal_Pow5InvSplit[q], i);
+
+        // only small q can divide the scaled values exactly; mv has at most 55 bits < 5^24
+        if (q <= 21)
+        {
+            if      (mv % 5 == 0)  { vrIsTrailingZeros = PNSLR_Internal_IsMultipleOfPow5(mv, q);               }
+            else if (acceptBounds) { vmIsTrailingZeros = PNSLR_Internal_IsMultipleOfPow5(mv - 1 - mmShift, q); }
+            else                   { vp -= PNSLR_Internal_IsMultipleOfPow5(mv + 2, q);                          }
+        }
+    }
+    else
     {
-        case PNSLR_IntegerBase_Binary:      prefix = 'b'; break;
-        case PNSLR_IntegerBase_HexaDecimal: prefix = 'x'; break;
-        case PNSLR_IntegerBase_Octal:       prefix = 'o'; break;
-        case PNSLR_IntegerBase_Decimal:                   break;
-        default: FORCE_DBG_TRAP; break;
+        i32 q = PNSLR_Internal_Log10Pow5(-e2) - (-e2 > 1);
+        i32 i = -e2 - q;
+        i32 k = PNSLR_Internal_Pow5Bits(i) - PNSLR_INTERNAL_POW5_BITCOUNT;
+        i32 j = q - k;
+        e10   = q + e2;
+        vr    = PNSLR_Internal_MulShift64(mv,               G_PNSLR_Internal_Pow5Split[i], j);
+        vp    = PNSLR_Internal_MulShift64(mv + 2,           G_PNSLR_Internal_Pow5Split[i], j);
+        vm    = PNSLR_Internal_MulShift64(mv - 1 - mmShift, G_PNSLR_Internal_Pow5Split[i], j);
+
+        if (q <= 1)
+        {
+            // mv = 4 * m2 always has at least one trailing zero bit
+            vrIsTrailingZeros = true;
+            if (acceptBounds) { vmIsTrailingZeros = (mmShift == 1); }
+            else              { --vp;                               }
+        }
+        else if (q < 63)
+        {
+            vrIsTrailingZeros = PNSLR_Internal_IsMultipleOfPow2(mv, q);
+        }
     }
 
-    if (prefix)
+    // drop digits while the ends of the interval still differ
+    i32 removed          = 0;
+    u64 lastRemovedDigit = 0;
+    u64 output;
+    if (vmIsTrailingZeros || vrIsTrailingZeros)
+    {
+        // exact cases, rare enough that one digit at a time is fine
+        while (vp / 10 > vm / 10)
+        {
+            vmIsTrailingZeros = vmIsTrailingZeros && (vm % 10 == 0);
+            vrIsTrailingZeros = vrIsTrailingZeros && (lastRemovedDigit == 0);
+            lastRemovedDigit  = vr % 10;
+            vr /= 10; vp /= 10; vm /= 10;
+            ++removed;
+        }
+
+        if (vmIsTrailingZeros)
+        {
+            while (vm % 10 == 0)
+            {
+                vrIsTrailingZeros = vrIsTrailingZeros && (lastRemovedDigit == 0);
+                lastRemovedDigit  = vr % 10;
+                vr /= 10; vp /= 10; vm /= 10;
+                ++removed;
+            }
+        }
+
+        // exactly halfway, round to even
+        if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) { lastRemovedDigit = 4; }
+
+        b8 roundUp = (vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5;
+        output = vr + roundUp;
+    }
+    else
     {
-        b8 prefixAdded = PNSLR_AppendByteToStringBuilder(builder, '0') && PNSLR_AppendByteToStringBuilder(builder, (u8) prefix);
-        if (!prefixAdded) { return false; }
+        b8 roundUp = false;
+        if (vp / 100 > vm / 100)
+        {
+            roundUp = (vr % 100) >= 50;
+            vr /= 100; vp /= 100; vm /= 100;
+            removed += 2;
+        }
+
+        while (vp / 10 > vm / 10)
+        {
+            roundUp = (vr % 10) >= 5;
+            vr /= 10; vp /= 10; vm /= 10;
+            ++removed;
+        }
+
+        output = vr + (vr == vm || roundUp);
     }
 
-    if (value == 0)
+    return (PNSLR_Internal_DecimalFloat) {.mantissa = output, .exponent = e10 + removed};
+}
+
+static PNSLR_Internal_DecimalFloat PNSLR_Internal_ShortestDecimalF64(u64 bits)
+{
+    u64 ieeeMantissa = bits & ((1ULL << 52) - 1);
+    i32 ieeeExponent = (i32) ((bits >> 52) & 0x7ff);
+
+    if (!ieeeExponent) { return PNSLR_Internal_ShortestDecimal(ieeeMantissa, 1 - 1023 - 52 - 2, true); } // subnormal
+    return PNSLR_Internal_ShortestDecimal((1ULL << 52) | ieeeMantissa, ieeeExponent - 1023 - 52 - 2, ieeeMantissa != 0 || ieeeExponent <= 1);
+}
+
+static PNSLR_Internal_DecimalFloat PNSLR_Internal_ShortestDecimalF32(u32 bits)
+{
+    u64 ieeeMantissa = bits & ((1U << 23) - 1);
+    i32 ieeeExponent = (i32) ((bits >> 23) & 0xff);
+
+    if (!ieeeExponent) { return PNSLR_Internal_ShortestDecimal(ieeeMantissa, 1 - 127 - 23 - 2, true); } // subnormal
+    return PNSLR_Internal_ShortestDecimal((1ULL << 23) | ieeeMantissa, ieeeExponent - 127 - 23 - 2, ieeeMantissa != 0 || ieeeExponent <= 1);
+}
+
+// plain digits between 1e-6 and 1e21, scientific notation outside of that
+static b8 PNSLR_Internal_AppendDecimalFloatToStringBuilder(PNSLR_StringBuilder* builder, b8 negative, PNSLR_Internal_DecimalFloat decimal)
+{
+    i32 numDigits = PNSLR_Internal_CountDecimalDigits(decimal.mantissa);
+    i32 pointPos  = decimal.exponent + numDigits; // where the decimal point goes, relative to the first digit
+
+    u8  digits[20];
+    PNSLR_Internal_WriteDecimalDigits(digits, numDigits, decimal.mantissa);
+
+    // plenty for any of the layouts below
+    u8* output = PNSLR_Internal_ReserveInStringBuilder(builder, 32);
+    if (!output) { return false; }
+
+    u8* cursor = output;
+    if (negative) { *(cursor++) = '-'; }
+
+    if (numDigits <= pointPos && pointPos <= 21)
     {
-        return PNSLR_AppendByteToStringBuilder(builder, '0');
+        PNSLR_MemCopy(cursor, digits, numDigits);
+        PNSLR_MemSet(cursor + numDigits, '0', pointPos - numDigits);
+        cursor += pointPos;
     }
+    else if (0 < pointPos && pointPos <= 21)
+    {
+        PNSLR_MemCopy(cursor, digits, pointPos);
+        cursor[pointPos] = '.';
+        PNSLR_MemCopy(cursor + pointPos + 1, digits + pointPos, numDigits - pointPos);
+        cursor += numDigits + 1;
+    }
+    else if (-6 < pointPos && pointPos <= 0)
+    {
+        *(cursor++) = '0';
+        *(cursor++) = '.';
+        PNSLR_MemSet(cursor, '0', -pointPos);
+        PNSLR_MemCopy(cursor - pointPos, digits, numDigits);
+        cursor += numDigits - pointPos;
+    }
+    else
+    {
+        *(cursor++) = digits[0];
+        if (numDigits > 1)
+        {
+            *(cursor++) = '.';
+            PNSLR_MemCopy(cursor, digits + 1, numDigits - 1);
+            cursor += numDigits - 1;
+        }
 
-    u8 digits[64] = {0};
-    i64 count = 0;
+        i32 exponent = pointPos - 1;
+        *(cursor++) = 'e';
+        if (exponent < 0) { *(cursor++) = '-'; exponent = -exponent; }
 
-    u64 baseInt;
-    switch (base)
+        i32 exponentDigits = PNSLR_Internal_CountDecimalDigits((u64) exponent);
+        PNSLR_Internal_WriteDecimalDigits(cursor, exponentDigits, (u64) exponent);
+        cursor += exponentDigits;
+    }
+
+    PNSLR_Internal_CommitToStringBuilder(builder, (i64) (cursor - output));
+    return true;
+}
+
+static b8 PNSLR_Internal_AppendShortestF64ToStringBuilder(PNSLR_StringBuilder* builder, f64 value)
+{
+    u64 bits      = *(u64*) &value;
+    b8  negative  = (bits >> 63) != 0;
+    u64 magnitude = bits & ~(1ULL << 63);
+
+    if (magnitude >  0x7ff0000000000000ULL) { return PNSLR_AppendCStringToStringBuilder(builder, "NaN"); }
+    if (magnitude == 0x7ff0000000000000ULL) { return PNSLR_AppendCStringToStringBuilder(builder, negative ? "-inf" : "inf"); }
+    if (magnitude == 0)                     { return PNSLR_AppendCStringToStringBuilder(builder, negative ? "-0"   : "0");   }
+
+    return PNSLR_Internal_AppendDecimalFloatToStringBuilder(builder, negative, PNSLR_Internal_ShortestDecimalF64(magnitude));
+}
+
+static b8 PNSLR_Internal_AppendShortestF32ToStringBuilder(PNSLR_StringBuilder* builder, f32 value)
+{
+    u32 bits      = *(u32*) &value;
+    b8  negative  = (bits >> 31) != 0;
+    u32 magnitude = bits & ~(1U << 31);
+
+    if (magnitude >  0x7f800000U) { return PNSLR_AppendCStringToStringBuilder(builder, "NaN"); }
+    if (magnitude == 0x7f800000U) { return PNSLR_AppendCStringToStringBuilder(builder, negative ? "-inf" : "inf"); }
+    if (magnitude == 0)           { return PNSLR_AppendCStringToStringBuilder(builder, negative ? "-0"   : "0");   }
+
+    return PNSLR_Internal_AppendDecimalFloatToStringBuilder(builder, negative, PNSLR_Internal_ShortestDecimalF32(magnitude));
+}
+
+b8 PNSLR_AppendF32ToStringBuilder(PNSLR_StringBuilder* builder, f32 value, i32 decimalPlaces)
+{
+    if (!builder) return false;
+    if (decimalPlaces < 0) { return PNSLR_Internal_AppendShortestF32ToStringBuilder(builder, value); }
+
+    return PNSLR_AppendF64ToStringBuilder(builder, (f64) value, decimalPlaces);
+}
+
+b8 PNSLR_AppendF64ToStringBuilder(PNSLR_StringBuilder* builder, f64 value, i32 decimalPlaces)
+{
+    if (!builder) return false;
+    if (decimalPlaces < 0) { return PNSLR_Internal_AppendShortestF64ToStringBuilder(builder, value); }
+    if (value != value) { return PNSLR_AppendCStringToStringBuilder(builder, "NaN"); } // NaN
+
+    // infinities, and anything else whose integer part won't fit in a u64
+    if (!(value > -18446744073709551616.0 && value < 18446744073709551616.0))
     {
-        case PNSLR_IntegerBase_Binary:      baseInt = 2;  break;
-        case PNSLR_IntegerBase_HexaDecimal: baseInt = 16; break;
-        case PNSLR_IntegerBase_Octal:       baseInt = 8;  break;
-        case PNSLR_IntegerBase_Decimal:     baseInt = 10; break;
-        default: FORCE_DBG_TRAP; return false;
+        return PNSLR_Internal_AppendShortestF64ToStringBuilder(builder, value);
     }
 
-    u64 tempValue = value;
-    while (tempValue > 0)
+    // Handle sign
+    b8  negative = (value < 0.0);
+    f64 absValue = negative ? -value : value;
+
+    // Integer part
+    u64 intPart    = (u64) absValue;
+    u64 scaledFrac = 0;
+
+    // Fractional part; past 19 places, 10^n won't fit in a u64 (and a double has no digits left anyway)
+    i32 scaledPlaces = (decimalPlaces < 19) ? decimalPlaces : 19;
+    if (scaledPlaces > 0)
     {
-        u64 digit = (tempValue % baseInt);
-        if (digit < 10) { digits[count] = (u8) ('0' + digit);        }
-        else            { digits[count] = (u8) ('a' + (digit - 10)); }
+        f64 fracPart = absValue - (f64) intPart;
+        u64 factor   = G_PNSLR_Internal_PowersOf10[scaledPlaces];
 
-        tempValue /= baseInt;
-        count++;
+        scaledFrac = (u64)(fracPart * (f64)factor + 0.5); // round
+        if (scaledFrac >= factor) { scaledFrac -= factor; intPart++; } // rounded up into the integer part
     }
 
-    for (i64 i = count - 1; i >= 0; --i)
+    // everything's measured up front, so it's one resize and straight writes after that
+    i32 intDigits = PNSLR_Internal_CountDecimalDigits(intPart);
+    i64 length    = negative + intDigits + ((decimalPlaces > 0) ? (1 + decimalPlaces) : 0);
+
+    u8* output = PNSLR_Internal_ReserveInStringBuilder(builder, length);
+    if (!output) { return false; }
+
+    if (negative) { *(output++) = '-'; }
+    PNSLR_Internal_WriteDecimalDigits(output, intDigits, intPart);
+    output += intDigits;
+
+    if (decimalPlaces > 0)
     {
-        if (!PNSLR_AppendByteToStringBuilder(builder, digits[i])) { return false; }
+        *(output++) = '.';
+
+        // leading zeroes of the fraction, i.e. 0.05 has one
+        i32 fracDigits = PNSLR_Internal_CountDecimalDigits(scaledFrac);
+        i32 numZeroes  = (scaledPlaces > fracDigits) ? (scaledPlaces - fracDigits) : 0;
+        PNSLR_MemSet(output, '0', numZeroes);
+        PNSLR_Internal_WriteDecimalDigits(output + numZeroes, scaledPlaces - numZeroes, scaledFrac);
+        PNSLR_MemSet(output + scaledPlaces, '0', decimalPlaces - scaledPlaces);
     }
 
-    return true;
+    PNSLR_Internal_CommitToStringBuilder(builder, length);
+    return true;
+}
+
+b8 PNSLR_AppendU8ToStringBuilder(PNSLR_StringBuilder* builder, u8 value, PNSLR_IntegerBase base)
+{
+    return PNSLR_AppendU64ToStringBuilder(builder, (u64) value, base);
+}
+
+b8 PNSLR_AppendU16ToStringBuilder(PNSLR_StringBuilder* builder, u16 value, PNSLR_IntegerBase base)
+{
+    return PNSLR_AppendU64ToStringBuilder(builder, (u64) value, base);
+}
+
+b8 PNSLR_AppendU32ToStringBuilder(PNSLR_StringBuilder* builder, u32 value, PNSLR_IntegerBase base)
+{
+    return PNSLR_AppendU64ToStringBuilder(builder, (u64) value, base);
+}
+
+b8 PNSLR_AppendU64ToStringBuilder(PNSLR_StringBuilder* builder, u64 value, PNSLR_IntegerBase base)
+{
+    return PNSLR_Internal_AppendIntegerToStringBuilder(builder, value, false, base);
 }
 
 b8 PNSLR_AppendI8ToStringBuilder(PNSLR_StringBuilder* builder, i8 value, PNSLR_IntegerBase base)
@@ -772,14 +2404,9 @@ b8 PNSLR_AppendI32ToStringBuilder(PNSLR_StringBuilder* builder, i32 value, PNSLR
 
 b8 PNSLR_AppendI64ToStringBuilder(PNSLR_StringBuilder* builder, i64 value, PNSLR_IntegerBase base)
 {
-    b8 status = true;
-    if (value < 0)
-    {
-        status = PNSLR_AppendByteToStringBuilder(builder, '-');
-        value = -value;
-    }
-
-    return status && PNSLR_AppendU64ToStringBuilder(builder, (u64) value, base);
+    // negate as unsigned, so the most negative value doesn't overflow
+    u64 magnitude = (value < 0) ? (0 - (u64) value) : (u64) value;
+    return PNSLR_Internal_AppendIntegerToStringBuilder(builder, magnitude, value < 0, base);
 }
 
 utf8str PNSLR_StringFromStringBuilder(PNSLR_StringBuilder* builder)
@@ -1145,88 +2772,887 @@ b8 PNSLR_BooleanFromString(utf8str str, b8* value)
     return false;
 }
 
-b8 PNSLR_F32FromString(utf8str str, f32* value)
+// number parsing; decimal digits are taken 8 at a time where possible (swar on a u64 load)
+
+static inline u64 PNSLR_Internal_LoadU64(const u8* data)
 {
-    if (!str.data || !str.count || !value) return false;
-    *value = (f32) {0}; // zero by default
-    f64 tempVal = 0.0;
-    if (!PNSLR_F64FromString(str, &tempVal)) return false;
-    *value = (f32) tempVal;
+    u64 value = 0;
+    PNSLR_MemCopy(&value, (rawptr) data, sizeof(u64));
+    return value; // little-endian on every supported target
+}
+
+static inline b8 PNSLR_Internal_AreEightDigits(u64 chunk)
+{
+    // every byte has to be 0x30..0x39; adding 6 pushes anything past '9' out of the 0x3_ row
+    return (((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL);
+}
+
+static inline u64 PNSLR_Internal_ParseEightDigits(u64 chunk)
+{
+    // pairs, then quads, then the whole thing, each step one multiply
+    chunk -= 0x3030303030303030ULL;
+    chunk  = (chunk * 10) + (chunk >> 8);
+    chunk  = (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) + (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    return (u32) chunk;
+}
+
+// accumulates the digits at `data` into `*value` (wrapping on overflow), returns how many there were
+static inline i64 PNSLR_Internal_AccumulateDigits(const u8* data, i64 count, u64* value)
+{
+    i64 i      = 0;
+    u64 result = *value;
+    while (i + 8 <= count)
+    {
+        u64 chunk = PNSLR_Internal_LoadU64(data + i);
+        if (!PNSLR_Internal_AreEightDigits(chunk)) { break; }
+        result = result * 100000000ULL + PNSLR_Internal_ParseEightDigits(chunk);
+        i += 8;
+    }
+
+    for (; i < count && data[i] >= '0' && data[i] <= '9'; ++i) { result = result * 10 + (u64) (data[i] - '0'); }
+
+    *value = result;
+    return i;
+}
+
+static b8 PNSLR_Internal_ParseDecimalU64(const u8* data, i64 count, u64* value)
+{
+    i64 i = 0;
+    while (i < count && data[i] == '0') { ++i; } // leading zeroes don't count towards the 20-digit limit
+
+    if (count - i > 20) { return false; } // overflow, or not a number at all
+
+    // 19 digits can't overflow, the 20th gets checked
+    u64 result    = 0;
+    i64 numDigits = PNSLR_Internal_AccumulateDigits(data + i, (count - i < 19) ? (count - i) : 19, &result);
+    i += numDigits;
+
+    if (i < count && numDigits == 19)
+    {
+        u8 c = data[i];
+        if (c < '0' || c > '9')                           { return false; }
+        if (result > (U64_MAX - (u64) (c - '0')) / 10)    { return false; } // overflow
+        result = result * 10 + (u64) (c - '0');
+        ++i;
+    }
+
+    if (i != count) { return false; } // invalid char
+
+    *value = result;
     return true;
 }
 
-b8 PNSLR_F64FromString(utf8str str, f64* value)
+// shared by the float parsers; the mantissa holds at most the first 19 significant digits
+typedef struct PNSLR_Internal_ParsedDecimal
 {
-    if (!str.data || !str.count || !value) return false;
-    *value = (f64) {0}; // zero by default
+    u64       mantissa;
+    i64       exponent;       // power of ten to go with the mantissa
+    b8        negative;
+    b8        truncated;      // nonzero digits didn't fit in the mantissa
+    const u8* integerDigits;
+    i64       integerCount;
+    const u8* fractionDigits;
+    i64       fractionCount;
+    i64       explicitExponent;
+} PNSLR_Internal_ParsedDecimal;
+
+// parses [+-]digits[.digits][(e|E)[+-]digits] from the start of `data`; returns the number of bytes
+// used, or 0 if there's no number there
+static i64 PNSLR_Internal_ParseDecimal(const u8* data, i64 count, PNSLR_Internal_ParsedDecimal* output)
+{
+    *output = (PNSLR_Internal_ParsedDecimal) {0};
 
     i64 i = 0;
-    b8 negative = false;
+    if (i < count && (data[i] == '-' || data[i] == '+')) { output->negative = (data[i] == '-'); ++i; }
 
-    // Handle optional sign
-    if (str.data[0] == '-')
+    u64 mantissa = 0;
+    output->integerDigits = data + i;
+    output->integerCount  = PNSLR_Internal_AccumulateDigits(data + i, count - i, &mantissa);
+    i += output->integerCount;
+
+    if (i < count && data[i] == '.')
     {
-        negative = true;
-        i = 1;
+        ++i;
+        output->fractionDigits = data + i;
+        output->fractionCount  = PNSLR_Internal_AccumulateDigits(data + i, count - i, &mantissa);
+        i += output->fractionCount;
     }
-    else if (str.data[0] == '+')
+
+    if (!output->integerCount && !output->fractionCount) { return 0; }
+
+    // only an exponent if there are digits after the 'e'
+    if (i < count && (data[i] == 'e' || data[i] == 'E'))
     {
-        i = 1;
+        i64 j = i + 1;
+        b8  negativeExponent = false;
+        if (j < count && (data[j] == '-' || data[j] == '+')) { negativeExponent = (data[j] == '-'); ++j; }
+
+        if (j < count && data[j] >= '0' && data[j] <= '9')
+        {
+            i64 exponent = 0;
+            for (; j < count && data[j] >= '0' && data[j] <= '9'; ++j)
+            {
+                if (exponent < 0x10000000) { exponent = exponent * 10 + (data[j] - '0'); } // saturate, it's inf/zero by then anyway
+            }
+
+            output->explicitExponent = negativeExponent ? -exponent : exponent;
+            i = j;
+        }
     }
 
-    // Find decimal point (if any)
-    i64 dotIndex = -1;
-    for (i64 j = i; j < str.count; j++)
+    output->mantissa = mantissa;
+    output->exponent = output->explicitExponent - output->fractionCount;
+
+    // more than 19 digits might've wrapped; redo with just the first 19 significant ones
+    if (output->integerCount + output->fractionCount > 19)
     {
-        if (str.data[j] == '.')
+        i64 totalDigits = output->integerCount + output->fractionCount;
+        i64 skipped     = 0;
+        while (skipped < totalDigits)
+        {
+            u8 c = (skipped < output->integerCount) ? output->integerDigits[skipped] : output->fractionDigits[skipped - output->integerCount];
+            if (c != '0') { break; }
+            ++skipped;
+        }
+
+        if (totalDigits - skipped > 19)
         {
-            if (dotIndex != -1) return false; // multiple dots
-            dotIndex = j;
+            mantissa = 0;
+            for (i64 k = skipped; k < skipped + 19; ++k)
+            {
+                u8 c = (k < output->integerCount) ? output->integerDigits[k] : output->fractionDigits[k - output->integerCount];
+                mantissa = mantissa * 10 + (u64) (c - '0');
+            }
+
+            for (i64 k = skipped + 19; k < totalDigits && !output->truncated; ++k)
+            {
+                u8 c = (k < output->integerCount) ? output->integerDigits[k] : output->fractionDigits[k - output->integerCount];
+                output->truncated = (c != '0');
+            }
+
+            output->mantissa = mantissa;
+            output->exponent = output->explicitExponent - output->fractionCount + (totalDigits - skipped - 19);
         }
     }
 
-    // Integer part slice
-    utf8str intStr;
-    intStr.data  = str.data + i;
-    intStr.count = (dotIndex == -1) ? (str.count - i) : (dotIndex - i);
+    return i;
+}
+
+typedef struct PNSLR_Internal_FloatFormat
+{
+    i32 mantissaBits;                         // explicit ones
+    i32 exponentBias;
+    i32 infinitePower;                        // biased exponent of infinity
+    i32 minPowerOfTen,  maxPowerOfTen;        // 19 digits past these are zero/infinity for sure
+    i32 minRoundToEven, maxRoundToEven;       // where an exact halfway product is possible
+} PNSLR_Internal_FloatFormat;
+
+static const PNSLR_Internal_FloatFormat G_PNSLR_Internal_F64Format = {52, 1023, 0x7ff, -342, 308, -4,  23};
+static const PNSLR_Internal_FloatFormat G_PNSLR_Internal_F32Format = {23, 127,  0xff,  -65,  38,  -17, 10};
+
+// 5^q for q in [-342, 308], normalized to 128 bits (truncated), as {high, low}
+static const u64 G_PNSLR_Internal_Pow5Truncated128[651][2] =
+{
+    {0xeef453d6923bd65aULL, 0x113faa2906a13b3fULL}, {0x9558b4661b6565f8ULL, 0x4ac7ca59a424c507ULL},
+    {0xbaaee17fa23ebf76ULL, 0x5d79bcf00d2df649ULL}, {0xe95a99df8ace6f53ULL, 0xf4d82c2c107973dcULL},
+    {0x91d8a02bb6c10594ULL, 0x79071b9b8a4be869ULL}, {0xb64ec836a47146f9ULL, 0x9748e2826cdee284ULL},
+    {0xe3e27a444d8d98b7ULL, 0xfd1b1b2308169b25ULL}, {0x8e6d8c6ab0787f72ULL, 0xfe30f0f5e50e20f7ULL},
+    {0xb208ef855c969f4fULL, 0xbdbd2d335e51a935ULL}, {0xde8b2b66b3bc4723ULL, 0xad2c788035e61382ULL},
+    {0x8b16fb203055ac76ULL, 0x4c3bcb5021afcc31ULL}, {0xaddcb9e83c6b1793ULL, 0xdf4abe242a1bbf3dULL},
+    {0xd953e8624b85dd78ULL, 0xd71d6dad34a2af0dULL}, {0x87d4713d6f33aa6bULL, 0x8672648c40e5ad68ULL},
+    {0xa9c98d8ccb009506ULL, 0x680efdaf511f18c2ULL}, {0xd43bf0effdc0ba48ULL, 0x0212bd1b2566def2ULL},
+    {0x84a57695fe98746dULL, 0x014bb630f7604b57ULL}, {0xa5ced43b7e3e9188ULL, 0x419ea3bd35385e2dULL},
+    {0xcf42894a5dce35eaULL, 0x52064cac828675b9ULL}, {0x818995ce7aa0e1b2ULL, 0x7343efebd1940993ULL},
+    {0xa1ebfb4219491a1fULL, 0x1014ebe6c5f90bf8ULL}, {0xca66fa129f9b60a6ULL, 0xd41a26e077774ef6ULL},
+    {0xfd00b897478238d0ULL, 0x8920b098955522b4ULL}, {0x9e20735e8cb16382ULL, 0x55b46e5f5d5535b0ULL},
+    {0xc5a890362fddbc62ULL, 0xeb2189f734aa831dULL}, {0xf712b443bbd52b7bULL, 0xa5e9ec7501d523e4ULL},
+    {0x9a6bb0aa55653b2dULL, 0x47b233c92125366eULL}, {0xc1069cd4eabe89f8ULL, 0x999ec0bb696e840aULL},
+    {0xf148440a256e2c76ULL, 0xc00670ea43ca250dULL}, {0x96cd2a865764dbcaULL, 0x380406926a5e5728ULL},
+    {0xbc807527ed3e12bcULL, 0xc605083704f5ecf2ULL}, {0xeba09271e88d976bULL, 0xf7864a44c633682eULL},
+    {0x93445b8731587ea3ULL, 0x7ab3ee6afbe0211dULL}, {0xb8157268fdae9e4cULL, 0x5960ea05bad82964ULL},
+    {0xe61acf033d1a45dfULL, 0x6fb92487298e33bdULL}, {0x8fd0c16206306babULL, 0xa5d3b6d479f8e056ULL},
+    {0xb3c4f1ba87bc8696ULL, 0x8f48a4899877186cULL}, {0xe0b62e2929aba83cULL, 0x331acdabfe94de87ULL},
+    {0x8c71dcd9ba0b4925ULL, 0x9ff0c08b7f1d0b14ULL}, {0xaf8e5410288e1b6fULL, 0x07ecf0ae5ee44dd9ULL},
+    {0xdb71e91432b1a24aULL, 0xc9e82cd9f69d6150ULL}, {0x892731ac9faf056eULL, 0xbe311c083a225cd2ULL},
+    {0xab70fe17c79ac6caULL, 0x6dbd630a48aaf406ULL}, {0xd64d3d9db981787dULL, 0x092cbbccdad5b108ULL},
+    {0x85f0468293f0eb4eULL, 0x25bbf56008c58ea5ULL}, {0xa76c582338ed2621ULL, 0xaf2af2b80af6f24eULL},
+    {0xd1476e2c07286faaULL, 0x1af5af660db4aee1ULL}, {0x82cca4db847945caULL, 0x50d98d9fc890ed4dULL},
+    {0xa37fce126597973cULL, 0xe50ff107bab528a0ULL}, {0xcc5fc196fefd7d0cULL, 0x1e53ed49a96272c8ULL},
+    {0xff77b1fcbebcdc4fULL, 0x25e8e89c13bb0f7aULL}, {0x9faacf3df73609b1ULL, 0x77b191618c54e9acULL},
+    {0xc795830d75038c1dULL, 0xd59df5b9ef6a2417ULL}, {0xf97ae3d0d2446f25ULL, 0x4b0573286b44ad1dULL},
+    {0x9becce62836ac577ULL, 0x4ee367f9430aec32ULL}, {0xc2e801fb244576d5ULL, 0x229c41f793cda73fULL},
+    {0xf3a20279ed56d48aULL, 0x6b43527578c1110fULL}, {0x9845418c345644d6ULL, 0x830a13896b78aaa9ULL},
+    {0xbe5691ef416bd60cULL, 0x23cc986bc656d553ULL}, {0xedec366b11c6cb8fULL, 0x2cbfbe86b7ec8aa8ULL},
+    {0x94b3a202eb1c3f39ULL, 0x7bf7d71432f3d6a9ULL}, {0xb9e08a83a5e34f07ULL, 0xdaf5ccd93fb0cc53ULL},
+    {0xe858ad248f5c22c9ULL, 0xd1b3400f8f9cff68ULL}, {0x91376c36d99995beULL, 0x23100809b9c21fa1ULL},
+    {0xb58547448ffffb2dULL, 0xabd40a0c2832a78aULL}, {0xe2e69915b3fff9f9ULL, 0x16c90c8f323f516cULL},
+    {0x8dd01fad907ffc3bULL, 0xae3da7d97f6792e3ULL}, {0xb1442798f49ffb4aULL, 0x99cd11cfdf41779cULL},
+    {0xdd95317f31c7fa1dULL, 0x40405643d711d583ULL}, {0x8a7d3eef7f1cfc52ULL, 0x482835ea666b2572ULL},
+    {0xad1c8eab5ee43b66ULL, 0xda3243650005eecfULL}, {0xd863b256369d4a40ULL, 0x90bed43e40076a82ULL},
+    {0x873e4f75e2224e68ULL, 0x5a7744a6e804a291ULL}, {0xa90de3535aaae202ULL, 0x711515d0a205cb36ULL},
+    {0xd3515c2831559a83ULL, 0x0d5a5b44ca873e03ULL}, {0x8412d9991ed58091ULL, 0xe858790afe9486c2ULL},
+    {0xa5178fff668ae0b6ULL, 0x626e974dbe39a872ULL}, {0xce5d73ff402d98e3ULL, 0xfb0a3d212dc8128fULL},
+    {0x80fa687f881c7f8eULL, 0x7ce66634bc9d0b99ULL}, {0xa139029f6a239f72ULL, 0x1c1fffc1ebc44e80ULL},
+    {0xc987434744ac874eULL, 0xa327ffb266b56220ULL}, {0xfbe9141915d7a922ULL, 0x4bf1ff9f0062baa8ULL},
+    {0x9d71ac8fada6c9b5ULL, 0x6f773fc3603db4a9ULL}, {0xc4ce17b399107c22ULL, 0xcb550fb4384d21d3ULL},
+    {0xf6019da07f549b2bULL, 0x7e2a53a146606a48ULL}, {0x99c102844f94e0fbULL, 0x2eda7444cbfc426dULL},
+    {0xc0314325637a1939ULL, 0xfa911155fefb5308ULL}, {0xf03d93eebc589f88ULL, 0x793555ab7eba27caULL},
+    {0x96267c7535b763b5ULL, 0x4bc1558b2f3458deULL}, {0xbbb01b9283253ca2ULL, 0x9eb1aaedfb016f16ULL},
+    {0xea9c227723ee8bcbULL, 0x465e15a979c1cadcULL}, {0x92a1958a7675175fULL, 0x0bfacd89ec191ec9ULL},
+    {0xb749faed14125d36ULL, 0xcef980ec671f667bULL}, {0xe51c79a85916f484ULL, 0x82b7e12780e7401aULL},
+    {0x8f31cc0937ae58d2ULL, 0xd1b2ecb8b0908810ULL}, {0xb2fe3f0b8599ef07ULL, 0x861fa7e6dcb4aa15ULL},
+    {0xdfbdcece67006ac9ULL, 0x67a791e093e1d49aULL}, {0x8bd6a141006042bdULL, 0xe0c8bb2c5c6d24e0ULL},
+    {0xaecc49914078536dULL, 0x58fae9f773886e18ULL}, {0xda7f5bf590966848ULL, 0xaf39a475506a899eULL},
+    {0x888f99797a5e012dULL, 0x6d8406c952429603ULL}, {0xaab37fd7d8f58178ULL, 0xc8e5087ba6d33b83ULL},
+    {0xd5605fcdcf32e1d6ULL, 0xfb1e4a9a90880a64ULL}, {0x855c3be0a17fcd26ULL, 0x5cf2eea09a55067fULL},
+    {0xa6b34ad8c9dfc06fULL, 0xf42faa48c0ea481eULL}, {0xd0601d8efc57b08bULL, 0xf13b94daf124da26ULL},
+    {0x823c12795db6ce57ULL, 0x76c53d08d6b70858ULL}, {0xa2cb1717b52481edULL, 0x54768c4b0c64ca6eULL},
+    {0xcb7ddcdda26da268ULL, 0xa9942f5dcf7dfd09ULL}, {0xfe5d54150b090b02ULL, 0xd3f93b35435d7c4cULL},
+    {0x9efa548d26e5a6e1ULL, 0xc47bc5014a1a6dafULL}, {0xc6b8e9b0709f109aULL, 0x359ab6419ca1091bULL},
+    {0xf867241c8cc6d4c0ULL, 0xc30163d203c94b62ULL}, {0x9b407691d7fc44f8ULL, 0x79e0de63425dcf1dULL},
+    {0xc21094364dfb5636ULL, 0x985915fc12f542e4ULL}, {0xf294b943e17a2bc4ULL, 0x3e6f5b7b17b2939dULL},
+    {0x979cf3ca6cec5b5aULL, 0xa705992ceecf9c42ULL}, {0xbd8430bd08277231ULL, 0x50c6ff782a838353ULL},
+    {0xece53cec4a314ebdULL, 0xa4f8bf5635246428ULL}, {0x940f4613ae5ed136ULL, 0x871b7795e136be99ULL},
+    {0xb913179899f68584ULL, 0x28e2557b59846e3fULL}, {0xe757dd7ec07426e5ULL, 0x331aeada2fe589cfULL},
+    {0x9096ea6f3848984fULL, 0x3ff0d2c85def7621ULL}, {0xb4bca50b065abe63ULL, 0x0fed077a756b53a9ULL},
+    {0xe1ebce4dc7f16dfbULL, 0xd3e8495912c62894ULL}, {0x8d3360f09cf6e4bdULL, 0x64712dd7abbbd95cULL},
+    {0xb080392cc4349decULL, 0xbd8d794d96aacfb3ULL}, {0xdca04777f541c567ULL, 0xecf0d7a0fc5583a0ULL},
+    {0x89e42caaf9491b60ULL, 0xf41686c49db57244ULL}, {0xac5d37d5b79b6239ULL, 0x311c2875c522ced5ULL},
+    {0xd77485cb25823ac7ULL, 0x7d633293366b828bULL}, {0x86a8d39ef77164bcULL, 0xae5dff9c02033197ULL},
+    {0xa8530886b54dbdebULL, 0xd9f57f830283fdfcULL}, {0xd267caa862a12d66ULL, 0xd072df63c324fd7bULL},
+    {0x8380dea93da4bc60ULL, 0x4247cb9e59f71e6dULL}, {0xa46116538d0deb78ULL, 0x52d9be85f074e608ULL},
+    {0xcd795be870516656ULL, 0x67902e276c921f8bULL}, {0x806bd9714632dff6ULL, 0x00ba1cd8a3db53b6ULL},
+    {0xa086cfcd97bf97f3ULL, 0x80e8a40eccd228a4ULL}, {0xc8a883c0fdaf7df0ULL, 0x6122cd128006b2cdULL},
+    {0xfad2a4b13d1b5d6cULL, 0x796b805720085f81ULL}, {0x9cc3a6eec6311a63ULL, 0xcbe3303674053bb0ULL},
+    {0xc3f490aa77bd60fcULL, 0xbedbfc4411068a9cULL}, {0xf4f1b4d515acb93bULL, 0xee92fb5515482d44ULL},
+    {0x991711052d8bf3c5ULL, 0x751bdd152d4d1c4aULL}, {0xbf5cd54678eef0b6ULL, 0xd262d45a78a0635dULL},
+    {0xef340a98172aace4ULL, 0x86fb897116c87c34ULL}, {0x9580869f0e7aac0eULL, 0xd45d35e6ae3d4da0ULL},
+    {0xbae0a846d2195712ULL, 0x8974836059cca109ULL}, {0xe998d258869facd7ULL, 0x2bd1a438703fc94bULL},
+    {0x91ff83775423cc06ULL, 0x7b6306a34627ddcfULL}, {0xb67f6455292cbf08ULL, 0x1a3bc84c17b1d542ULL},
+    {0xe41f3d6a7377eecaULL, 0x20caba5f1d9e4a93ULL}, {0x8e938662882af53eULL, 0x547eb47b7282ee9cULL},
+    {0xb23867fb2a35b28dULL, 0xe99e619a4f23aa43ULL}, {0xdec681f9f4c31f31ULL, 0x6405fa00e2ec94d4ULL},
+    {0x8b3c113c38f9f37eULL, 0xde83bc408dd3dd04ULL}, {0xae0b158b4738705eULL, 0x9624ab50b148d445ULL},
+    {0xd98ddaee19068c76ULL, 0x3badd624dd9b0957ULL}, {0x87f8a8d4cfa417c9ULL, 0xe54ca5d70a80e5d6ULL},
+    {0xa9f6d30a038d1dbcULL, 0x5e9fcf4ccd211f4cULL}, {0xd47487cc8470652bULL, 0x7647c3200069671fULL},
+    {0x84c8d4dfd2c63f3bULL, 0x29ecd9f40041e073ULL}, {0xa5fb0a17c777cf09ULL, 0xf468107100525890ULL},
+    {0xcf79cc9db955c2ccULL, 0x7182148d4066eeb4ULL}, {0x81ac1fe293d599bfULL, 0xc6f14cd848405530ULL},
+    {0xa21727db38cb002fULL, 0xb8ada00e5a506a7cULL}, {0xca9cf1d206fdc03bULL, 0xa6d90811f0e4851cULL},
+    {0xfd442e4688bd304aULL, 0x908f4a166d1da663ULL}, {0x9e4a9cec15763e2eULL, 0x9a598e4e043287feULL},
+    {0xc5dd44271ad3cdbaULL, 0x40eff1e1853f29fdULL}, {0xf7549530e188c128ULL, 0xd12bee59e68ef47cULL},
+    {0x9a94dd3e8cf578b9ULL, 0x82bb74f8301958ceULL}, {0xc13a148e3032d6e7ULL, 0xe36a52363c1faf01ULL},
+    {0xf18899b1bc3f8ca1ULL, 0xdc44e6c3cb279ac1ULL}, {0x96f5600f15a7b7e5ULL, 0x29ab103a5ef8c0b9ULL},
+    {0xbcb2b812db11a5deULL, 0x7415d448f6b6f0e7ULL}, {0xebdf661791d60f56ULL, 0x111b495b3464ad21ULL},
+    {0x936b9fcebb25c995ULL, 0xcab10dd900beec34ULL}, {0xb84687c269ef3bfbULL, 0x3d5d514f40eea742ULL},
+    {0xe65829b3046b0afaULL, 0x0cb4a5a3112a5112ULL}, {0x8ff71a0fe2c2e6dcULL, 0x47f0e785eaba72abULL},
+    {0xb3f4e093db73a093ULL, 0x59ed216765690f56ULL}, {0xe0f218b8d25088b8ULL, 0x306869c13ec3532cULL},
+    {0x8c974f7383725573ULL, 0x1e414218c73a13fbULL}, {0xafbd2350644eeacfULL, 0xe5d1929ef90898faULL},
+    {0xdbac6c247d62a583ULL, 0xdf45f746b74abf39ULL}, {0x894bc396ce5da772ULL, 0x6b8bba8c328eb783ULL},
+    {0xab9eb47c81f5114fULL, 0x066ea92f3f326564ULL}, {0xd686619ba27255a2ULL, 0xc80a537b0efefebdULL},
+    {0x8613fd0145877585ULL, 0xbd06742ce95f5f36ULL}, {0xa798fc4196e952e7ULL, 0x2c48113823b73704ULL},
+    {0xd17f3b51fca3a7a0ULL, 0xf75a15862ca504c5ULL}, {0x82ef85133de648c4ULL, 0x9a984d73dbe722fbULL},
+    {0xa3ab66580d5fdaf5ULL, 0xc13e60d0d2e0ebbaULL}, {0xcc963fee10b7d1b3ULL, 0x318df905079926a8ULL},
+    {0xffbbcfe994e5c61fULL, 0xfdf17746497f7052ULL}, {0x9fd561f1fd0f9bd3ULL, 0xfeb6ea8bedefa633ULL},
+    {0xc7caba6e7c5382c8ULL, 0xfe64a52ee96b8fc0ULL}, {0xf9bd690a1b68637bULL, 0x3dfdce7aa3c673b0ULL},
+    {0x9c1661a651213e2dULL, 0x06bea10ca65c084eULL}, {0xc31bfa0fe5698db8ULL, 0x486e494fcff30a62ULL},
+    {0xf3e2f893dec3f126ULL, 0x5a89dba3c3efccfaULL}, {0x986ddb5c6b3a76b7ULL, 0xf89629465a75e01cULL},
+    {0xbe89523386091465ULL, 0xf6bbb397f1135823ULL}, {0xee2ba6c0678b597fULL, 0x746aa07ded582e2cULL},
+    {0x94db483840b717efULL, 0xa8c2a44eb4571cdcULL}, {0xba121a4650e4ddebULL, 0x92f34d62616ce413ULL},
+    {0xe896a0d7e51e1566ULL, 0x77b020baf9c81d17ULL}, {0x915e2486ef32cd60ULL, 0x0ace1474dc1d122eULL},
+    {0xb5b5ada8aaff80b8ULL, 0x0d819992132456baULL}, {0xe3231912d5bf60e6ULL, 0x10e1fff697ed6c69ULL},
+    {0x8df5efabc5979c8fULL, 0xca8d3ffa1ef463c1ULL}, {0xb1736b96b6fd83b3ULL, 0xbd308ff8a6b17cb2ULL},
+    {0xddd0467c64bce4a0ULL, 0xac7cb3f6d05ddbdeULL}, {0x8aa22c0dbef60ee4ULL, 0x6bcdf07a423aa96bULL},
+    {0xad4ab7112eb3929dULL, 0x86c16c98d2c953c6ULL}, {0xd89d64d57a607744ULL, 0xe871c7bf077ba8b7ULL},
+    {0x87625f056c7c4a8bULL, 0x11471cd764ad4972ULL}, {0xa93af6c6c79b5d2dULL, 0xd598e40d3dd89bcfULL},
+    {0xd389b47879823479ULL, 0x4aff1d108d4ec2c3ULL}, {0x843610cb4bf160cbULL, 0xcedf722a585139baULL},
+    {0xa54394fe1eedb8feULL, 0xc2974eb4ee658828ULL}, {0xce947a3da6a9273eULL, 0x733d226229feea32ULL},
+    {0x811ccc668829b887ULL, 0x0806357d5a3f525fULL}, {0xa163ff802a3426a8ULL, 0xca07c2dcb0cf26f7ULL},
+    {0xc9bcff6034c13052ULL, 0xfc89b393dd02f0b5ULL}, {0xfc2c3f3841f17c67ULL, 0xbbac2078d443ace2ULL},
+    {0x9d9ba7832936edc0ULL, 0xd54b944b84aa4c0dULL}, {0xc5029163f384a931ULL, 0x0a9e795e65d4df11ULL},
+    {0xf64335bcf065d37dULL, 0x4d4617b5ff4a16d5ULL}, {0x99ea0196163fa42eULL, 0x504bced1bf8e4e45ULL},
+    {0xc06481fb9bcf8d39ULL, 0xe45ec2862f71e1d6ULL}, {0xf07da27a82c37088ULL, 0x5d767327bb4e5a4cULL},
+    {0x964e858c91ba2655ULL, 0x3a6a07f8d510f86fULL}, {0xbbe226efb628afeaULL, 0x890489f70a55368bULL},
+    {0xeadab0aba3b2dbe5ULL, 0x2b45ac74ccea842eULL}, {0x92c8ae6b464fc96fULL, 0x3b0b8bc90012929dULL},
+    {0xb77ada0617e3bbcbULL, 0x09ce6ebb40173744ULL}, {0xe55990879ddcaabdULL, 0xcc420a6a101d0515ULL},
+    {0x8f57fa54c2a9eab6ULL, 0x9fa946824a12232dULL}, {0xb32df8e9f3546564ULL, 0x47939822dc96abf9ULL},
+    {0xdff9772470297ebdULL, 0x59787e2b93bc56f7ULL}, {0x8bfbea76c619ef36ULL, 0x57eb4edb3c55b65aULL},
+    {0xaefae51477a06b03ULL, 0xede622920b6b23f1ULL}, {0xdab99e59958885c4ULL, 0xe95fab368e45ecedULL},
+    {0x88b402f7fd75539bULL, 0x11dbcb0218ebb414ULL}, {0xaae103b5fcd2a881ULL, 0xd652bdc29f26a119ULL},
+    {0xd59944a37c0752a2ULL, 0x4be76d3346f0495fULL}, {0x857fcae62d8493a5ULL, 0x6f70a4400c562ddbULL},
+    {0xa6dfbd9fb8e5b88eULL, 0xcb4ccd500f6bb952ULL}, {0xd097ad07a71f26b2ULL, 0x7e2000a41346a7a7ULL},
+    {0x825ecc24c873782fULL, 0x8ed400668c0c28c8ULL}, {0xa2f67f2dfa90563bULL, 0x728900802f0f32faULL},
+    {0xcbb41ef979346bcaULL, 0x4f2b40a03ad2ffb9ULL}, {0xfea126b7d78186bcULL, 0xe2f610c84987bfa8ULL},
+    {0x9f24b832e6b0f436ULL, 0x0dd9ca7d2df4d7c9ULL}, {0xc6ede63fa05d3143ULL, 0x91503d1c79720dbbULL},
+    {0xf8a95fcf88747d94ULL, 0x75a44c6397ce912aULL}, {0x9b69dbe1b548ce7cULL, 0xc986afbe3ee11abaULL},
+    {0xc24452da229b021bULL, 0xfbe85badce996168ULL}, {0xf2d56790ab41c2a2ULL, 0xfae27299423fb9c3ULL},
+    {0x97c560ba6b0919a5ULL, 0xdccd879fc967d41aULL}, {0xbdb6b8e905cb600fULL, 0x5400e987bbc1c920ULL},
+    {0xed246723473e3813ULL, 0x290123e9aab23b68ULL}, {0x9436c0760c86e30bULL, 0xf9a0b6720aaf6521ULL},
+    {0xb94470938fa89bceULL, 0xf808e40e8d5b3e69ULL}, {0xe7958cb87392c2c2ULL, 0xb60b1d1230b20e04ULL},
+    {0x90bd77f3483bb9b9ULL, 0xb1c6f22b5e6f48c2ULL}, {0xb4ecd5f01a4aa828ULL, 0x1e38aeb6360b1af3ULL},
+    {0xe2280b6c20dd5232ULL, 0x25c6da63c38de1b0ULL}, {0x8d590723948a535fULL, 0x579c487e5a38ad0eULL},
+    {0xb0af48ec79ace837ULL, 0x2d835a9df0c6d851ULL}, {0xdcdb1b2798182244ULL, 0xf8e431456cf88e65ULL},
+    {0x8a08f0f8bf0f156bULL, 0x1b8e9ecb641b58ffULL}, {0xac8b2d36eed2dac5ULL, 0xe272467e3d222f3fULL},
+    {0xd7adf884aa879177ULL, 0x5b0ed81dcc6abb0fULL}, {0x86ccbb52ea94baeaULL, 0x98e947129fc2b4e9ULL},
+    {0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL}, {0xd29fe4b18e88640eULL, 0x8eec7f0d19a03aadULL},
+    {0x83a3eeeef9153e89ULL, 0x1953cf68300424acULL}, {0xa48ceaaab75a8e2bULL, 0x5fa8c3423c052dd7ULL},
+    {0xcdb02555653131b6ULL, 0x3792f412cb06794dULL}, {0x808e17555f3ebf11ULL, 0xe2bbd88bbee40bd0ULL},
+    {0xa0b19d2ab70e6ed6ULL, 0x5b6aceaeae9d0ec4ULL}, {0xc8de047564d20a8bULL, 0xf245825a5a445275ULL},
+    {0xfb158592be068d2eULL, 0xeed6e2f0f0d56712ULL}, {0x9ced737bb6c4183dULL, 0x55464dd69685606bULL},
+    {0xc428d05aa4751e4cULL, 0xaa97e14c3c26b886ULL}, {0xf53304714d9265dfULL, 0xd53dd99f4b3066a8ULL},
+    {0x993fe2c6d07b7fabULL, 0xe546a8038efe4029ULL}, {0xbf8fdb78849a5f96ULL, 0xde98520472bdd033ULL},
+    {0xef73d256a5c0f77cULL, 0x963e66858f6d4440ULL}, {0x95a8637627989aadULL, 0xdde7001379a44aa8ULL},
+    {0xbb127c53b17ec159ULL, 0x5560c018580d5d52ULL}, {0xe9d71b689dde71afULL, 0xaab8f01e6e10b4a6ULL},
+    {0x9226712162ab070dULL, 0xcab3961304ca70e8ULL}, {0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL},
+    {0xe45c10c42a2b3b05ULL, 0x8cb89a7db77c506aULL}, {0x8eb98a7a9a5b04e3ULL, 0x77f3608e92adb242ULL},
+    {0xb267ed1940f1c61cULL, 0x55f038b237591ed3ULL}, {0xdf01e85f912e37a3ULL, 0x6b6c46dec52f6688ULL},
+    {0x8b61313bbabce2c6ULL, 0x2323ac4b3b3da015ULL}, {0xae397d8aa96c1b77ULL, 0xabec975e0a0d081aULL},
+    {0xd9c7dced53c72255ULL, 0x96e7bd358c904a21ULL}, {0x881cea14545c7575ULL, 0x7e50d64177da2e54ULL},
+    {0xaa242499697392d2ULL, 0xdde50bd1d5d0b9e9ULL}, {0xd4ad2dbfc3d07787ULL, 0x955e4ec64b44e864ULL},
+    {0x84ec3c97da624ab4ULL, 0xbd5af13bef0b113eULL}, {0xa6274bbdd0fadd61ULL, 0xecb1ad8aeacdd58eULL},
+    {0xcfb11ead453994baULL, 0x67de18eda5814af2ULL}, {0x81ceb32c4b43fcf4ULL, 0x80eacf948770ced7ULL},
+    {0xa2425ff75e14fc31ULL, 0xa1258379a94d028dULL}, {0xcad2f7f5359a3b3eULL, 0x096ee45813a04330ULL},
+    {0xfd87b5f28300ca0dULL, 0x8bca9d6e188853fcULL}, {0x9e74d1b791e07e48ULL, 0x775ea264cf55347eULL},
+    {0xc612062576589ddaULL, 0x95364afe032a819eULL}, {0xf79687aed3eec551ULL, 0x3a83ddbd83f52205ULL},
+    {0x9abe14cd44753b52ULL, 0xc4926a9672793543ULL}, {0xc16d9a0095928a27ULL, 0x75b7053c0f178294ULL},
+    {0xf1c90080baf72cb1ULL, 0x5324c68b12dd6339ULL}, {0x971da05074da7beeULL, 0xd3f6fc16ebca5e04ULL},
+    {0xbce5086492111aeaULL, 0x88f4bb1ca6bcf585ULL}, {0xec1e4a7db69561a5ULL, 0x2b31e9e3d06c32e6ULL},
+    {0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL}, {0xb877aa3236a4b449ULL, 0x09befeb9fad487c3ULL},
+    {0xe69594bec44de15bULL, 0x4c2ebe687989a9b4ULL}, {0x901d7cf73ab0acd9ULL, 0x0f9d37014bf60a11ULL},
+    {0xb424dc35095cd80fULL, 0x538484c19ef38c95ULL}, {0xe12e13424bb40e13ULL, 0x2865a5f206b06fbaULL},
+    {0x8cbccc096f5088cbULL, 0xf93f87b7442e45d4ULL}, {0xafebff0bcb24aafeULL, 0xf78f69a51539d749ULL},
+    {0xdbe6fecebdedd5beULL, 0xb573440e5a884d1cULL}, {0x89705f4136b4a597ULL, 0x31680a88f8953031ULL},
+    {0xabcc77118461cefcULL, 0xfdc20d2b36ba7c3eULL}, {0xd6bf94d5e57a42bcULL, 0x3d32907604691b4dULL},
+    {0x8637bd05af6c69b5ULL, 0xa63f9a49c2c1b110ULL}, {0xa7c5ac471b478423ULL, 0x0fcf80dc33721d54ULL},
+    {0xd1b71758e219652bULL, 0xd3c36113404ea4a9ULL}, {0x83126e978d4fdf3bULL, 0x645a1cac083126eaULL},
+    {0xa3d70a3d70a3d70aULL, 0x3d70a3d70a3d70a4ULL}, {0xccccccccccccccccULL, 0xcccccccccccccccdULL},
+    {0x8000000000000000ULL, 0x0000000000000000ULL}, {0xa000000000000000ULL, 0x0000000000000000ULL},
+    {0xc800000000000000ULL, 0x0000000000000000ULL}, {0xfa00000000000000ULL, 0x0000000000000000ULL},
+    {0x9c40000000000000ULL, 0x0000000000000000ULL}, {0xc350000000000000ULL, 0x0000000000000000ULL},
+    {0xf424000000000000ULL, 0x0000000000000000ULL}, {0x9896800000000000ULL, 0x0000000000000000ULL},
+    {0xbebc200000000000ULL, 0x0000000000000000ULL}, {0xee6b280000000000ULL, 0x0000000000000000ULL},
+    {0x9502f90000000000ULL, 0x0000000000000000ULL}, {0xba43b74000000000ULL, 0x0000000000000000ULL},
+    {0xe8d4a51000000000ULL, 0x0000000000000000ULL}, {0x9184e72a00000000ULL, 0x0000000000000000ULL},
+    {0xb5e620f480000000ULL, 0x0000000000000000ULL}, {0xe35fa931a0000000ULL, 0x0000000000000000ULL},
+    {0x8e1bc9bf04000000ULL, 0x0000000000000000ULL}, {0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL},
+    {0xde0b6b3a76400000ULL, 0x0000000000000000ULL}, {0x8ac7230489e80000ULL, 0x0000000000000000ULL},
+    {0xad78ebc5ac620000ULL, 0x0000000000000000ULL}, {0xd8d726b7177a8000ULL, 0x0000000000000000ULL},
+    {0x878678326eac9000ULL, 0x0000000000000000ULL}, {0xa968163f0a57b400ULL, 0x0000000000000000ULL},
+    {0xd3c21bcecceda100ULL, 0x0000000000000000ULL}, {0x84595161401484a0ULL, 0x0000000000000000ULL},
+    {0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL}, {0xcecb8f27f4200f3aULL, 0x0000000000000000ULL},
+    {0x813f3978f8940984ULL, 0x4000000000000000ULL}, {0xa18f07d736b90be5ULL, 0x5000000000000000ULL},
+    {0xc9f2c9cd04674edeULL, 0xa400000000000000ULL}, {0xfc6f7c4045812296ULL, 0x4d00000000000000ULL},
+    {0x9dc5ada82b70b59dULL, 0xf020000000000000ULL}, {0xc5371912364ce305ULL, 0x6c28000000000000ULL},
+    {0xf684df56c3e01bc6ULL, 0xc732000000000000ULL}, {0x9a130b963a6c115cULL, 0x3c7f400000000000ULL},
+    {0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL}, {0xf0bdc21abb48db20ULL, 0x1e86d40000000000ULL},
+    {0x96769950b50d88f4ULL, 0x1314448000000000ULL}, {0xbc143fa4e250eb31ULL, 0x17d955a000000000ULL},
+    {0xeb194f8e1ae525fdULL, 0x5dcfab0800000000ULL}, {0x92efd1b8d0cf37beULL, 0x5aa1cae500000000ULL},
+    {0xb7abc627050305adULL, 0xf14a3d9e40000000ULL}, {0xe596b7b0c643c719ULL, 0x6d9ccd05d0000000ULL},
+    {0x8f7e32ce7bea5c6fULL, 0xe4820023a2000000ULL}, {0xb35dbf821ae4f38bULL, 0xdda2802c8a800000ULL},
+    {0xe0352f62a19e306eULL, 0xd50b2037ad200000ULL}, {0x8c213d9da502de45ULL, 0x4526f422cc340000ULL},
+    {0xaf298d050e4395d6ULL, 0x9670b12b7f410000ULL}, {0xdaf3f04651d47b4cULL, 0x3c0cdd765f114000ULL},
+    {0x88d8762bf324cd0fULL, 0xa5880a69fb6ac800ULL}, {0xab0e93b6efee0053ULL, 0x8eea0d047a457a00ULL},
+    {0xd5d238a4abe98068ULL, 0x72a4904598d6d880ULL}, {0x85a36366eb71f041ULL, 0x47a6da2b7f864750ULL},
+    {0xa70c3c40a64e6c51ULL, 0x999090b65f67d924ULL}, {0xd0cf4b50cfe20765ULL, 0xfff4b4e3f741cf6dULL},
+    {0x82818f1281ed449fULL, 0xbff8f10e7a8921a4ULL}, {0xa321f2d7226895c7ULL, 0xaff72d52192b6a0dULL},
+    {0xcbea6f8ceb02bb39ULL, 0x9bf4f8a69f764490ULL}, {0xfee50b7025c36a08ULL, 0x02f236d04753d5b4ULL},
+    {0x9f4f2726179a2245ULL, 0x01d762422c946590ULL}, {0xc722f0ef9d80aad6ULL, 0x424d3ad2b7b97ef5ULL},
+    {0xf8ebad2b84e0d58bULL, 0xd2e0898765a7deb2ULL}, {0x9b934c3b330c8577ULL, 0x63cc55f49f88eb2fULL},
+    {0xc2781f49ffcfa6d5ULL, 0x3cbf6b71c76b25fbULL}, {0xf316271c7fc3908aULL, 0x8bef464e3945ef7aULL},
+    {0x97edd871cfda3a56ULL, 0x97758bf0e3cbb5acULL}, {0xbde94e8e43d0c8ecULL, 0x3d52eeed1cbea317ULL},
+    {0xed63a231d4c4fb27ULL, 0x4ca7aaa863ee4bddULL}, {0x945e455f24fb1cf8ULL, 0x8fe8caa93e74ef6aULL},
+    {0xb975d6b6ee39e436ULL, 0xb3e2fd538e122b44ULL}, {0xe7d34c64a9c85d44ULL, 0x60dbbca87196b616ULL},
+    {0x90e40fbeea1d3a4aULL, 0xbc8955e946fe31cdULL}, {0xb51d13aea4a488ddULL, 0x6babab6398bdbe41ULL},
+    {0xe264589a4dcdab14ULL, 0xc696963c7eed2dd1ULL}, {0x8d7eb76070a08aecULL, 0xfc1e1de5cf543ca2ULL},
+    {0xb0de65388cc8ada8ULL, 0x3b25a55f43294bcbULL}, {0xdd15fe86affad912ULL, 0x49ef0eb713f39ebeULL},
+    {0x8a2dbf142dfcc7abULL, 0x6e3569326c784337ULL}, {0xacb92ed9397bf996ULL, 0x49c2c37f07965404ULL},
+    {0xd7e77a8f87daf7fbULL, 0xdc33745ec97be906ULL}, {0x86f0ac99b4e8dafdULL, 0x69a028bb3ded71a3ULL},
+    {0xa8acd7c0222311bcULL, 0xc40832ea0d68ce0cULL}, {0xd2d80db02aabd62bULL, 0xf50a3fa490c30190ULL},
+    {0x83c7088e1aab65dbULL, 0x792667c6da79e0faULL}, {0xa4b8cab1a1563f52ULL, 0x577001b891185938ULL},
+    {0xcde6fd5e09abcf26ULL, 0xed4c0226b55e6f86ULL}, {0x80b05e5ac60b6178ULL, 0x544f8158315b05b4ULL},
+    {0xa0dc75f1778e39d6ULL, 0x696361ae3db1c721ULL}, {0xc913936dd571c84cULL, 0x03bc3a19cd1e38e9ULL},
+    {0xfb5878494ace3a5fULL, 0x04ab48a04065c723ULL}, {0x9d174b2dcec0e47bULL, 0x62eb0d64283f9c76ULL},
+    {0xc45d1df942711d9aULL, 0x3ba5d0bd324f8394ULL}, {0xf5746577930d6500ULL, 0xca8f44ec7ee36479ULL},
+    {0x9968bf6abbe85f20ULL, 0x7e998b13cf4e1ecbULL}, {0xbfc2ef456ae276e8ULL, 0x9e3fedd8c321a67eULL},
+    {0xefb3ab16c59b14a2ULL, 0xc5cfe94ef3ea101eULL}, {0x95d04aee3b80ece5ULL, 0xbba1f1d158724a12ULL},
+    {0xbb445da9ca61281fULL, 0x2a8a6e45ae8edc97ULL}, {0xea1575143cf97226ULL, 0xf52d09d71a3293bdULL},
+    {0x924d692ca61be758ULL, 0x593c2626705f9c56ULL}, {0xb6e0c377cfa2e12eULL, 0x6f8b2fb00c77836cULL},
+    {0xe498f455c38b997aULL, 0x0b6dfb9c0f956447ULL}, {0x8edf98b59a373fecULL, 0x4724bd4189bd5eacULL},
+    {0xb2977ee300c50fe7ULL, 0x58edec91ec2cb657ULL}, {0xdf3d5e9bc0f653e1ULL, 0x2f2967b66737e3edULL},
+    {0x8b865b215899f46cULL, 0xbd79e0d20082ee74ULL}, {0xae67f1e9aec07187ULL, 0xecd8590680a3aa11ULL},
+    {0xda01ee641a708de9ULL, 0xe80e6f4820cc9495ULL}, {0x884134fe908658b2ULL, 0x3109058d147fdcddULL},
+    {0xaa51823e34a7eedeULL, 0xbd4b46f0599fd415ULL}, {0xd4e5e2cdc1d1ea96ULL, 0x6c9e18ac7007c91aULL},
+    {0x850fadc09923329eULL, 0x03e2cf6bc604ddb0ULL}, {0xa6539930bf6bff45ULL, 0x84db8346b786151cULL},
+    {0xcfe87f7cef46ff16ULL, 0xe612641865679a63ULL}, {0x81f14fae158c5f6eULL, 0x4fcb7e8f3f60c07eULL},
+    {0xa26da3999aef7749ULL, 0xe3be5e330f38f09dULL}, {0xcb090c8001ab551cULL, 0x5cadf5bfd3072cc5ULL},
+    {0xfdcb4fa002162a63ULL, 0x73d9732fc7c8f7f6ULL}, {0x9e9f11c4014dda7eULL, 0x2867e7fddcdd9afaULL},
+    {0xc646d63501a1511dULL, 0xb281e1fd541501b8ULL}, {0xf7d88bc24209a565ULL, 0x1f225a7ca91a4226ULL},
+    {0x9ae757596946075fULL, 0x3375788de9b06958ULL}, {0xc1a12d2fc3978937ULL, 0x0052d6b1641c83aeULL},
+    {0xf209787bb47d6b84ULL, 0xc0678c5dbd23a49aULL}, {0x9745eb4d50ce6332ULL, 0xf840b7ba963646e0ULL},
+    {0xbd176620a501fbffULL, 0xb650e5a93bc3d898ULL}, {0xec5d3fa8ce427affULL, 0xa3e51f138ab4cebeULL},
+    {0x93ba47c980e98cdfULL, 0xc66f336c36b10137ULL}, {0xb8a8d9bbe123f017ULL, 0xb80b0047445d4184ULL},
+    {0xe6d3102ad96cec1dULL, 0xa60dc059157491e5ULL}, {0x9043ea1ac7e41392ULL, 0x87c89837ad68db2fULL},
+    {0xb454e4a179dd1877ULL, 0x29babe4598c311fbULL}, {0xe16a1dc9d8545e94ULL, 0xf4296dd6fef3d67aULL},
+    {0x8ce2529e2734bb1dULL, 0x1899e4a65f58660cULL}, {0xb01ae745b101e9e4ULL, 0x5ec05dcff72e7f8fULL},
+    {0xdc21a1171d42645dULL, 0x76707543f4fa1f73ULL}, {0x899504ae72497ebaULL, 0x6a06494a791c53a8ULL},
+    {0xabfa45da0edbde69ULL, 0x0487db9d17636892ULL}, {0xd6f8d7509292d603ULL, 0x45a9d2845d3c42b6ULL},
+    {0x865b86925b9bc5c2ULL, 0x0b8a2392ba45a9b2ULL}, {0xa7f26836f282b732ULL, 0x8e6cac7768d7141eULL},
+    {0xd1ef0244af2364ffULL, 0x3207d795430cd926ULL}, {0x8335616aed761f1fULL, 0x7f44e6bd49e807b8ULL},
+    {0xa402b9c5a8d3a6e7ULL, 0x5f16206c9c6209a6ULL}, {0xcd036837130890a1ULL, 0x36dba887c37a8c0fULL},
+    {0x802221226be55a64ULL, 0xc2494954da2c9789ULL}, {0xa02aa96b06deb0fdULL, 0xf2db9baa10b7bd6cULL},
+    {0xc83553c5c8965d3dULL, 0x6f92829494e5acc7ULL}, {0xfa42a8b73abbf48cULL, 0xcb772339ba1f17f9ULL},
+    {0x9c69a97284b578d7ULL, 0xff2a760414536efbULL}, {0xc38413cf25e2d70dULL, 0xfef5138519684abaULL},
+    {0xf46518c2ef5b8cd1ULL, 0x7eb258665fc25d69ULL}, {0x98bf2f79d5993802ULL, 0xef2f773ffbd97a61ULL},
+    {0xbeeefb584aff8603ULL, 0xaafb550ffacfd8faULL}, {0xeeaaba2e5dbf6784ULL, 0x95ba2a53f983cf38ULL},
+    {0x952ab45cfa97a0b2ULL, 0xdd945a747bf26183ULL}, {0xba756174393d88dfULL, 0x94f971119aeef9e4ULL},
+    {0xe912b9d1478ceb17ULL, 0x7a37cd5601aab85dULL}, {0x91abb422ccb812eeULL, 0xac62e055c10ab33aULL},
+    {0xb616a12b7fe617aaULL, 0x577b986b314d6009ULL}, {0xe39c49765fdf9d94ULL, 0xed5a7e85fda0b80bULL},
+    {0x8e41ade9fbebc27dULL, 0x14588f13be847307ULL}, {0xb1d219647ae6b31cULL, 0x596eb2d8ae258fc8ULL},
+    {0xde469fbd99a05fe3ULL, 0x6fca5f8ed9aef3bbULL}, {0x8aec23d680043beeULL, 0x25de7bb9480d5854ULL},
+    {0xada72ccc20054ae9ULL, 0xaf561aa79a10ae6aULL}, {0xd910f7ff28069da4ULL, 0x1b2ba1518094da04ULL},
+    {0x87aa9aff79042286ULL, 0x90fb44d2f05d0842ULL}, {0xa99541bf57452b28ULL, 0x353a1607ac744a53ULL},
+    {0xd3fa922f2d1675f2ULL, 0x42889b8997915ce8ULL}, {0x847c9b5d7c2e09b7ULL, 0x69956135febada11ULL},
+    {0xa59bc234db398c25ULL, 0x43fab9837e699095ULL}, {0xcf02b2c21207ef2eULL, 0x94f967e45e03f4bbULL},
+    {0x8161afb94b44f57dULL, 0x1d1be0eebac278f5ULL}, {0xa1ba1ba79e1632dcULL, 0x6462d92a69731732ULL},
+    {0xca28a291859bbf93ULL, 0x7d7b8f7503cfdcfeULL}, {0xfcb2cb35e702af78ULL, 0x5cda735244c3d43eULL},
+    {0x9defbf01b061adabULL, 0x3a0888136afa64a7ULL}, {0xc56baec21c7a1916ULL, 0x088aaa1845b8fdd0ULL},
+    {0xf6c69a72a3989f5bULL, 0x8aad549e57273d45ULL}, {0x9a3c2087a63f6399ULL, 0x36ac54e2f678864bULL},
+    {0xc0cb28a98fcf3c7fULL, 0x84576a1bb416a7ddULL}, {0xf0fdf2d3f3c30b9fULL, 0x656d44a2a11c51d5ULL},
+    {0x969eb7c47859e743ULL, 0x9f644ae5a4b1b325ULL}, {0xbc4665b596706114ULL, 0x873d5d9f0dde1feeULL},
+    {0xeb57ff22fc0c7959ULL, 0xa90cb506d155a7eaULL}, {0x9316ff75dd87cbd8ULL, 0x09a7f12442d588f2ULL},
+    {0xb7dcbf5354e9beceULL, 0x0c11ed6d538aeb2fULL}, {0xe5d3ef282a242e81ULL, 0x8f1668c8a86da5faULL},
+    {0x8fa475791a569d10ULL, 0xf96e017d694487bcULL}, {0xb38d92d760ec4455ULL, 0x37c981dcc395a9acULL},
+    {0xe070f78d3927556aULL, 0x85bbe253f47b1417ULL}, {0x8c469ab843b89562ULL, 0x93956d7478ccec8eULL},
+    {0xaf58416654a6babbULL, 0x387ac8d1970027b2ULL}, {0xdb2e51bfe9d0696aULL, 0x06997b05fcc0319eULL},
+    {0x88fcf317f22241e2ULL, 0x441fece3bdf81f03ULL}, {0xab3c2fddeeaad25aULL, 0xd527e81cad7626c3ULL},
+    {0xd60b3bd56a5586f1ULL, 0x8a71e223d8d3b074ULL}, {0x85c7056562757456ULL, 0xf6872d5667844e49ULL},
+    {0xa738c6bebb12d16cULL, 0xb428f8ac016561dbULL}, {0xd106f86e69d785c7ULL, 0xe13336d701beba52ULL},
+    {0x82a45b450226b39cULL, 0xecc0024661173473ULL}, {0xa34d721642b06084ULL, 0x27f002d7f95d0190ULL},
+    {0xcc20ce9bd35c78a5ULL, 0x31ec038df7b441f4ULL}, {0xff290242c83396ceULL, 0x7e67047175a15271ULL},
+    {0x9f79a169bd203e41ULL, 0x0f0062c6e984d386ULL}, {0xc75809c42c684dd1ULL, 0x52c07b78a3e60868ULL},
+    {0xf92e0c3537826145ULL, 0xa7709a56ccdf8a82ULL}, {0x9bbcc7a142b17ccbULL, 0x88a66076400bb691ULL},
+    {0xc2abf989935ddbfeULL, 0x6acff893d00ea435ULL}, {0xf356f7ebf83552feULL, 0x0583f6b8c4124d43ULL},
+    {0x98165af37b2153deULL, 0xc3727a337a8b704aULL}, {0xbe1bf1b059e9a8d6ULL, 0x744f18c0592e4c5cULL},
+    {0xeda2ee1c7064130cULL, 0x1162def06f79df73ULL}, {0x9485d4d1c63e8be7ULL, 0x8addcb5645ac2ba8ULL},
+    {0xb9a74a0637ce2ee1ULL, 0x6d953e2bd7173692ULL}, {0xe8111c87c5c1ba99ULL, 0xc8fa8db6ccdd0437ULL},
+    {0x910ab1d4db9914a0ULL, 0x1d9c9892400a22a2ULL}, {0xb54d5e4a127f59c8ULL, 0x2503beb6d00cab4bULL},
+    {0xe2a0b5dc971f303aULL, 0x2e44ae64840fd61dULL}, {0x8da471a9de737e24ULL, 0x5ceaecfed289e5d2ULL},
+    {0xb10d8e1456105dadULL, 0x7425a83e872c5f47ULL}, {0xdd50f1996b947518ULL, 0xd12f124e28f77719ULL},
+    {0x8a5296ffe33cc92fULL, 0x82bd6b70d99aaa6fULL}, {0xace73cbfdc0bfb7bULL, 0x636cc64d1001550bULL},
+    {0xd8210befd30efa5aULL, 0x3c47f7e05401aa4eULL}, {0x8714a775e3e95c78ULL, 0x65acfaec34810a71ULL},
+    {0xa8d9d1535ce3b396ULL, 0x7f1839a741a14d0dULL}, {0xd31045a8341ca07cULL, 0x1ede48111209a050ULL},
+    {0x83ea2b892091e44dULL, 0x934aed0aab460432ULL}, {0xa4e4b66b68b65d60ULL, 0xf81da84d5617853fULL},
+    {0xce1de40642e3f4b9ULL, 0x36251260ab9d668eULL}, {0x80d2ae83e9ce78f3ULL, 0xc1d72b7c6b426019ULL},
+    {0xa1075a24e4421730ULL, 0xb24cf65b8612f81fULL}, {0xc94930ae1d529cfcULL, 0xdee033f26797b627ULL},
+    {0xfb9b7cd9a4a7443cULL, 0x169840ef017da3b1ULL}, {0x9d412e0806e88aa5ULL, 0x8e1f289560ee864eULL},
+    {0xc491798a08a2ad4eULL, 0xf1a6f2bab92a27e2ULL}, {0xf5b5d7ec8acb58a2ULL, 0xae10af696774b1dbULL},
+    {0x9991a6f3d6bf1765ULL, 0xacca6da1e0a8ef29ULL}, {0xbff610b0cc6edd3fULL, 0x17fd090a58d32af3ULL},
+    {0xeff394dcff8a948eULL, 0xddfc4b4cef07f5b0ULL}, {0x95f83d0a1fb69cd9ULL, 0x4abdaf101564f98eULL},
+    {0xbb764c4ca7a4440fULL, 0x9d6d1ad41abe37f1ULL}, {0xea53df5fd18d5513ULL, 0x84c86189216dc5edULL},
+    {0x92746b9be2f8552cULL, 0x32fd3cf5b4e49bb4ULL}, {0xb7118682dbb66a77ULL, 0x3fbc8c33221dc2a1ULL},
+    {0xe4d5e82392a40515ULL, 0x0fabaf3feaa5334aULL}, {0x8f05b1163ba6832dULL, 0x29cb4d87f2a7400eULL},
+    {0xb2c71d5bca9023f8ULL, 0x743e20e9ef511012ULL}, {0xdf78e4b2bd342cf6ULL, 0x914da9246b255416ULL},
+    {0x8bab8eefb6409c1aULL, 0x1ad089b6c2f7548eULL}, {0xae9672aba3d0c320ULL, 0xa184ac2473b529b1ULL},
+    {0xda3c0f568cc4f3e8ULL, 0xc9e5d72d90a2741eULL}, {0x8865899617fb1871ULL, 0x7e2fa67c7a658892ULL},
+    {0xaa7eebfb9df9de8dULL, 0xddbb901b98feeab7ULL}, {0xd51ea6fa85785631ULL, 0x552a74227f3ea565ULL},
+    {0x8533285c936b35deULL, 0xd53a88958f87275fULL}, {0xa67ff273b8460356ULL, 0x8a892abaf368f137ULL},
+    {0xd01fef10a657842cULL, 0x2d2b7569b0432d85ULL}, {0x8213f56a67f6b29bULL, 0x9c3b29620e29fc73ULL},
+    {0xa298f2c501f45f42ULL, 0x8349f3ba91b47b8fULL}, {0xcb3f2f7642717713ULL, 0x241c70a936219a73ULL},
+    {0xfe0efb53d30dd4d7ULL, 0xed238cd383aa0110ULL}, {0x9ec95d1463e8a506ULL, 0xf4363804324a40aaULL},
+    {0xc67bb4597ce2ce48ULL, 0xb143c6053edcd0d5ULL}, {0xf81aa16fdc1b81daULL, 0xdd94b7868e94050aULL},
+    {0x9b10a4e5e9913128ULL, 0xca7cf2b4191c8326ULL}, {0xc1d4ce1f63f57d72ULL, 0xfd1c2f611f63a3f0ULL},
+    {0xf24a01a73cf2dccfULL, 0xbc633b39673c8cecULL}, {0x976e41088617ca01ULL, 0xd5be0503e085d813ULL},
+    {0xbd49d14aa79dbc82ULL, 0x4b2d8644d8a74e18ULL}, {0xec9c459d51852ba2ULL, 0xddf8e7d60ed1219eULL},
+    {0x93e1ab8252f33b45ULL, 0xcabb90e5c942b503ULL}, {0xb8da1662e7b00a17ULL, 0x3d6a751f3b936243ULL},
+    {0xe7109bfba19c0c9dULL, 0x0cc512670a783ad4ULL}, {0x906a617d450187e2ULL, 0x27fb2b80668b24c5ULL},
+    {0xb484f9dc9641e9daULL, 0xb1f9f660802dedf6ULL}, {0xe1a63853bbd26451ULL, 0x5e7873f8a0396973ULL},
+    {0x8d07e33455637eb2ULL, 0xdb0b487b6423e1e8ULL}, {0xb049dc016abc5e5fULL, 0x91ce1a9a3d2cda62ULL},
+    {0xdc5c5301c56b75f7ULL, 0x7641a140cc7810fbULL}, {0x89b9b3e11b6329baULL, 0xa9e904c87fcb0a9dULL},
+    {0xac2820d9623bf429ULL, 0x546345fa9fbdcd44ULL}, {0xd732290fbacaf133ULL, 0xa97c177947ad4095ULL},
+    {0x867f59a9d4bed6c0ULL, 0x49ed8eabcccc485dULL}, {0xa81f301449ee8c70ULL, 0x5c68f256bfff5a74ULL},
+    {0xd226fc195c6a2f8cULL, 0x73832eec6fff3111ULL}, {0x83585d8fd9c25db7ULL, 0xc831fd53c5ff7eabULL},
+    {0xa42e74f3d032f525ULL, 0xba3e7ca8b77f5e55ULL}, {0xcd3a1230c43fb26fULL, 0x28ce1bd2e55f35ebULL},
+    {0x80444b5e7aa7cf85ULL, 0x7980d163cf5b81b3ULL}, {0xa0555e361951c366ULL, 0xd7e105bcc332621fULL},
+    {0xc86ab5c39fa63440ULL, 0x8dd9472bf3fefaa7ULL}, {0xfa856334878fc150ULL, 0xb14f98f6f0feb951ULL},
+    {0x9c935e00d4b9d8d2ULL, 0x6ed1bf9a569f33d3ULL}, {0xc3b8358109e84f07ULL, 0x0a862f80ec4700c8ULL},
+    {0xf4a642e14c6262c8ULL, 0xcd27bb612758c0faULL}, {0x98e7e9cccfbd7dbdULL, 0x8038d51cb897789cULL},
+    {0xbf21e44003acdd2cULL, 0xe0470a63e6bd56c3ULL}, {0xeeea5d5004981478ULL, 0x1858ccfce06cac74ULL},
+    {0x95527a5202df0ccbULL, 0x0f37801e0c43ebc8ULL}, {0xbaa718e68396cffdULL, 0xd30560258f54e6baULL},
+    {0xe950df20247c83fdULL, 0x47c6b82ef32a2069ULL}, {0x91d28b7416cdd27eULL, 0x4cdc331d57fa5441ULL},
+    {0xb6472e511c81471dULL, 0xe0133fe4adf8e952ULL}, {0xe3d8f9e563a198e5ULL, 0x58180fddd97723a6ULL},
+    {0x8e679c2f5e44ff8fULL, 0x570f09eaa7ea7648ULL},
+};
+
+// eisel-lemire (daniel lemire, 2021): w * 10^q to the nearest float in one or two 64x64 multiplies,
+// exact for any w of up to 19 digits; returns the biased exponent and mantissa
+static u64 PNSLR_Internal_ComputeFloatBits(i64 q, u64 w, const PNSLR_Internal_FloatFormat* format)
+{
+    if (w == 0 || q < format->minPowerOfTen) { return 0; }
+    if (q > format->maxPowerOfTen)           { return (u64) format->infinitePower << format->mantissaBits; }
+
+    i32 lz = PNSLR_Internal_CountLeadingZerosU64(w);
+    w <<= lz;
+
+    // mantissa + 3 bits is all that's needed (implicit bit, rounding bit, maybe one lost to normalization)
+    const u64* pow5 = G_PNSLR_Internal_Pow5Truncated128[q + 342];
+    u64 high, secondHigh;
+    u64 low = PNSLR_Internal_MultiplyU64(w, pow5[0], &high);
+    u64 precisionMask = U64_MAX >> (format->mantissaBits + 3);
+    if ((high & precisionMask) == precisionMask)
+    {
+        PNSLR_Internal_MultiplyU64(w, pow5[1], &secondHigh);
+        low += secondHigh;
+        if (secondHigh > low) { high++; }
+    }
+
+    i32 upperBit = (i32) (high >> 63);
+    i32 shift    = upperBit + 64 - format->mantissaBits - 3;
+    u64 mantissa = high >> shift;
+    i32 power2   = (i32) ((((152170 + 65536) * q) >> 16) + 63) + upperBit - lz + format->exponentBias;
 
-    // Fractional part slice
-    utf8str fracStr;
-    if (dotIndex != -1)
+    if (power2 <= 0)
     {
-        fracStr.data  = str.data + dotIndex + 1;
-        fracStr.count = str.count - (dotIndex + 1);
+        // subnormal, or nothing at all
+        if (-power2 + 1 >= 64) { return 0; }
+        mantissa >>= -power2 + 1;
+        mantissa  += mantissa & 1;
+        mantissa >>= 1;
+
+        // rounding can carry it back up into the normal range
+        power2 = (mantissa < (1ULL << format->mantissaBits)) ? 0 : 1;
+        return mantissa | ((u64) power2 << format->mantissaBits);
     }
-    else
+
+    // exactly halfway between two floats: round down to even instead of up
+    if (low <= 1 && q >= format->minRoundToEven && q <= format->maxRoundToEven && (mantissa & 3) == 1 && (mantissa << shift) == high)
     {
-        fracStr.data  = 0;
-        fracStr.count = 0;
+        mantissa &= ~1ULL;
     }
 
-    // Parse integer part
-    i64 intVal = 0;
-    if (intStr.count > 0)
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (2ULL << format->mantissaBits))
     {
-        if (!PNSLR_I64FromString(intStr, &intVal)) return false;
+        mantissa = 1ULL << format->mantissaBits;
+        power2++;
     }
 
-    // Parse fractional part
-    f64 fracVal = 0.0;
-    if (fracStr.count > 0)
+    mantissa &= ~(1ULL << format->mantissaBits);
+    if (power2 >= format->infinitePower) { return (u64) format->infinitePower << format->mantissaBits; }
+    return mantissa | ((u64) power2 << format->mantissaBits);
+}
+
+// the slow path, when truncated digits leave eisel-lemire undecided: the whole decimal is kept and
+// shifted by powers of two until it's in [0.5, 1), which gives the binary exponent, and then the
+// mantissa bits are shifted out of it (after go's strconv)
+
+#define PNSLR_INTERNAL_BIG_DECIMAL_DIGITS    800
+#define PNSLR_INTERNAL_BIG_DECIMAL_MAX_SHIFT 60
+
+typedef struct PNSLR_Internal_BigDecimal
+{
+    u8  digits[PNSLR_INTERNAL_BIG_DECIMAL_DIGITS]; // 0..9, most significant first
+    i32 numDigits;
+    i32 decimalPoint;                              // digits before the point
+    b8  truncated;                                 // nonzero digits were dropped off the end
+} PNSLR_Internal_BigDecimal;
+
+static void PNSLR_Internal_TrimBigDecimal(PNSLR_Internal_BigDecimal* decimal)
+{
+    while (decimal->numDigits > 0 && decimal->digits[decimal->numDigits - 1] == 0) { decimal->numDigits--; }
+    if (!decimal->numDigits) { decimal->decimalPoint = 0; }
+}
+
+static void PNSLR_Internal_RightShiftBigDecimal(PNSLR_Internal_BigDecimal* decimal, i32 k)
+{
+    i32 read  = 0;
+    i32 write = 0;
+    u64 n     = 0;
+
+    // pick up enough leading digits to cover the first shift
+    for (; (n >> k) == 0; read++)
     {
-        u64 fracDigits = 0;
-        if (!PNSLR_U64FromString(fracStr, &fracDigits)) return false;
+        if (read >= decimal->numDigits)
+        {
+            if (!n) { decimal->numDigits = 0; return; }
+            while ((n >> k) == 0) { n *= 10; read++; }
+            break;
+        }
+
+        n = n * 10 + decimal->digits[read];
+    }
 
-        f64 divisor = 1.0;
-        for (i64 k = 0; k < fracStr.count; k++) divisor *= 10.0;
+    decimal->decimalPoint -= read - 1;
 
-        fracVal = (f64)fracDigits / divisor;
+    // pick up a digit, put down a digit
+    u64 mask = (1ULL << k) - 1;
+    for (; read < decimal->numDigits; read++)
+    {
+        u64 digit = n >> k;
+        n &= mask;
+        decimal->digits[write++] = (u8) digit;
+        n = n * 10 + decimal->digits[read];
     }
 
-    f64 result = (f64)intVal + fracVal;
-    if (negative) result = -result;
+    // and whatever's left over
+    while (n > 0)
+    {
+        u64 digit = n >> k;
+        n &= mask;
+        if (write < PNSLR_INTERNAL_BIG_DECIMAL_DIGITS) { decimal->digits[write++] = (u8) digit; }
+        else if (digit > 0)                           { decimal->truncated = true;              }
+        n *= 10;
+    }
 
-    *value = result;
+    decimal->numDigits = write;
+    PNSLR_Internal_TrimBigDecimal(decimal);
+}
+
+static void PNSLR_Internal_LeftShiftBigDecimal(PNSLR_Internal_BigDecimal* decimal, i32 k)
+{
+    // a 60-bit shift adds at most 19 digits in front, so there's room to write right-to-left
+    u8  shifted[PNSLR_INTERNAL_BIG_DECIMAL_DIGITS + 20];
+    i32 end   = decimal->numDigits + 20;
+    i32 write = end;
+    u64 n     = 0;
+
+    for (i32 read = decimal->numDigits - 1; read >= 0; read--)
+    {
+        n += (u64) decimal->digits[read] << k;
+        shifted[--write] = (u8) (n % 10);
+        n /= 10;
+    }
+
+    while (n > 0)
+    {
+        shifted[--write] = (u8) (n % 10);
+        n /= 10;
+    }
+
+    i32 count = end - write;
+    decimal->decimalPoint += count - decimal->numDigits;
+    if (count > PNSLR_INTERNAL_BIG_DECIMAL_DIGITS)
+    {
+        for (i32 i = PNSLR_INTERNAL_BIG_DECIMAL_DIGITS; i < count; i++) { decimal->truncated = decimal->truncated || shifted[write + i]; }
+        count = PNSLR_INTERNAL_BIG_DECIMAL_DIGITS;
+    }
+
+    PNSLR_MemCopy(decimal->digits, shifted + write, count);
+    decimal->numDigits = count;
+    PNSLR_Internal_TrimBigDecimal(decimal);
+}
+
+static void PNSLR_Internal_ShiftBigDecimal(PNSLR_Internal_BigDecimal* decimal, i32 k)
+{
+    if (!decimal->numDigits) { return; }
+
+    for (; k > PNSLR_INTERNAL_BIG_DECIMAL_MAX_SHIFT; k -= PNSLR_INTERNAL_BIG_DECIMAL_MAX_SHIFT)   { PNSLR_Internal_LeftShiftBigDecimal(decimal, PNSLR_INTERNAL_BIG_DECIMAL_MAX_SHIFT);  }
+    for (; k < -PNSLR_INTERNAL_BIG_DECIMAL_MAX_SHIFT; k += PNSLR_INTERNAL_BIG_DECIMAL_MAX_SHIFT)  { PNSLR_Internal_RightShiftBigDecimal(decimal, PNSLR_INTERNAL_BIG_DECIMAL_MAX_SHIFT); }
+
+    if      (k > 0) { PNSLR_Internal_LeftShiftBigDecimal(decimal, k);   }
+    else if (k < 0) { PNSLR_Internal_RightShiftBigDecimal(decimal, -k); }
+}
+
+// the integer part, rounded half to even
+static u64 PNSLR_Internal_RoundBigDecimal(const PNSLR_Internal_BigDecimal* decimal)
+{
+    if (decimal->decimalPoint > 20) { return U64_MAX; }
+
+    i32 i      = 0;
+    u64 result = 0;
+    for (; i < decimal->decimalPoint && i < decimal->numDigits; i++) { result = result * 10 + decimal->digits[i]; }
+    for (; i < decimal->decimalPoint; i++)                           { result *= 10; }
+
+    i32 next = decimal->decimalPoint;
+    if (next >= 0 && next < decimal->numDigits)
+    {
+        b8 roundUp;
+        if (decimal->digits[next] == 5 && next + 1 == decimal->numDigits)
+        {
+            // exactly halfway, unless something got dropped off the end
+            roundUp = decimal->truncated || (next > 0 && (decimal->digits[next - 1] % 2) == 1);
+        }
+        else
+        {
+            roundUp = decimal->digits[next] >= 5;
+        }
+
+        result += roundUp;
+    }
+
+    return result;
+}
+
+static u64 PNSLR_Internal_ComputeFloatBitsExactly(const PNSLR_Internal_ParsedDecimal* parsed, const PNSLR_Internal_FloatFormat* format)
+{
+    PNSLR_Internal_BigDecimal decimal;
+    decimal.numDigits    = 0;
+    decimal.decimalPoint = 0;
+    decimal.truncated    = false;
+
+    for (i64 k = 0; k < parsed->integerCount + parsed->fractionCount; ++k)
+    {
+        u8 c = (k < parsed->integerCount) ? parsed->integerDigits[k] : parsed->fractionDigits[k - parsed->integerCount];
+        if (c == '0' && !decimal.numDigits) { if (k >= parsed->integerCount) { decimal.decimalPoint--; } continue; } // leading zeroes
+
+        if (k < parsed->integerCount) { decimal.decimalPoint++; }
+
+        if (decimal.numDigits < PNSLR_INTERNAL_BIG_DECIMAL_DIGITS) { decimal.digits[decimal.numDigits++] = (u8) (c - '0'); }
+        else if (c != '0')                                         { decimal.truncated = true;                             }
+    }
+
+    PNSLR_Internal_TrimBigDecimal(&decimal);
+    if (!decimal.numDigits) { return 0; }
+
+    // clamp the exponent well past where the result is 0 or infinity
+    i64 decimalPoint = decimal.decimalPoint + parsed->explicitExponent;
+    if (decimalPoint >  400) { return (u64) format->infinitePower << format->mantissaBits; }
+    if (decimalPoint < -400) { return 0; }
+    decimal.decimalPoint = (i32) decimalPoint;
+
+    // scale to [0.5, 1), i.e. 0.5 <= decimal * 2^-exponent < 1
+    static const i32 powersOf2Steps[9] = {1, 3, 6, 9, 13, 16, 19, 23, 26}; // 2^n just under 10^i
+    i32 exponent = 0;
+    while (decimal.decimalPoint > 0)
+    {
+        i32 n = (decimal.decimalPoint >= 9) ? 27 : powersOf2Steps[decimal.decimalPoint];
+        PNSLR_Internal_ShiftBigDecimal(&decimal, -n);
+        exponent += n;
+    }
+
+    while (decimal.decimalPoint < 0 || (decimal.decimalPoint == 0 && decimal.digits[0] < 5))
+    {
+        i32 n = (-decimal.decimalPoint >= 9) ? 27 : powersOf2Steps[-decimal.decimalPoint];
+        PNSLR_Internal_ShiftBigDecimal(&decimal, n);
+        exponent -= n;
+    }
+
+    // [0.5, 1) to [1, 2), and subnormals get their exponent pinned at the minimum
+    exponent--;
+    i32 minExponent = 1 - format->exponentBias;
+    if (exponent < minExponent)
+    {
+        PNSLR_Internal_ShiftBigDecimal(&decimal, -(minExponent - exponent));
+        exponent = minExponent;
+    }
+
+    if (exponent + format->exponentBias >= format->infinitePower) { return (u64) format->infinitePower << format->mantissaBits; }
+
+    PNSLR_Internal_ShiftBigDecimal(&decimal, 1 + format->mantissaBits);
+    u64 mantissa = PNSLR_Internal_RoundBigDecimal(&decimal);
+
+    // rounding might've added a bit
+    if (mantissa == (2ULL << format->mantissaBits))
+    {
+        mantissa >>= 1;
+        exponent++;
+        if (exponent + format->exponentBias >= format->infinitePower) { return (u64) format->infinitePower << format->mantissaBits; }
+    }
+
+    i32 biasedExponent = (mantissa & (1ULL << format->mantissaBits)) ? (exponent + format->exponentBias) : 0;
+    return (mantissa & ((1ULL << format->mantissaBits) - 1)) | ((u64) biasedExponent << format->mantissaBits);
+}
+
+static u64 PNSLR_Internal_ParsedDecimalToFloatBits(const PNSLR_Internal_ParsedDecimal* parsed, const PNSLR_Internal_FloatFormat* format)
+{
+    u64 bits = PNSLR_Internal_ComputeFloatBits(parsed->exponent, parsed->mantissa, format);
+
+    // with digits cut off, the real value is somewhere between w and w + 1; fine if both agree
+    if (parsed->truncated && bits != PNSLR_Internal_ComputeFloatBits(parsed->exponent, parsed->mantissa + 1, format))
+    {
+        bits = PNSLR_Internal_ComputeFloatBitsExactly(parsed, format);
+    }
+
+    return bits;
+}
+
+// "inf", "infinity" or "nan", any case, with an optional sign; the same ones that formatting writes
+static b8 PNSLR_Internal_ParseSpecialFloat(utf8str str, b8* negative, b8* isNaN)
+{
+    i64 i = 0;
+    *negative = false;
+    if (str.count > 0 && (str.data[0] == '-' || str.data[0] == '+')) { *negative = (str.data[0] == '-'); i = 1; }
+
+    utf8str rest = {.data = str.data + i, .count = str.count - i};
+    *isNaN = PNSLR_AreStringsEqual(rest, PNSLR_StringLiteral("nan"), PNSLR_StringComparisonType_CaseInsensitive);
+
+    return *isNaN ||
+        PNSLR_AreStringsEqual(rest, PNSLR_StringLiteral("inf"),      PNSLR_StringComparisonType_CaseInsensitive) ||
+        PNSLR_AreStringsEqual(rest, PNSLR_StringLiteral("infinity"), PNSLR_StringComparisonType_CaseInsensitive);
+}
+
+static const f64 G_PNSLR_Internal_ExactPowersOf10F64[23] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+static const f32 G_PNSLR_Internal_ExactPowersOf10F32[11] =
+{
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f,
+};
+
+b8 PNSLR_F32FromString(utf8str str, f32* value)
+{
+    if (!str.data || !str.count || !value) return false;
+    *value = (f32) {0}; // zero by default
+
+    PNSLR_Internal_ParsedDecimal parsed;
+    u32 bits = 0;
+    if (PNSLR_Internal_ParseDecimal(str.data, str.count, &parsed) != str.count)
+    {
+        b8 negative, isNaN;
+        if (!PNSLR_Internal_ParseSpecialFloat(str, &negative, &isNaN)) return false;
+
+        bits = (isNaN ? 0x7FC00000U : 0x7F800000U) | (negative ? 0x80000000U : 0U);
+        PNSLR_MemCopy(value, &bits, sizeof(bits));
+        return true;
+    }
+
+    // mantissa and power of ten both exact, so a single (correctly rounded) operation is the answer
+    if (!parsed.truncated && parsed.exponent >= -10 && parsed.exponent <= 10 && parsed.mantissa <= (1ULL << 24))
+    {
+        f32 result = (f32) parsed.mantissa;
+        if (parsed.exponent < 0) { result /= G_PNSLR_Internal_ExactPowersOf10F32[-parsed.exponent]; }
+        else                     { result *= G_PNSLR_Internal_ExactPowersOf10F32[ parsed.exponent]; }
+
+        *value = parsed.negative ? -result : result;
+        return true;
+    }
+
+    bits = (u32) PNSLR_Internal_ParsedDecimalToFloatBits(&parsed, &G_PNSLR_Internal_F32Format) | (parsed.negative ? 0x80000000U : 0U);
+    PNSLR_MemCopy(value, &bits, sizeof(bits));
+    return true;
+}
+
+b8 PNSLR_F64FromString(utf8str str, f64* value)
+{
+    if (!str.data || !str.count || !value) return false;
+    *value = (f64) {0}; // zero by default
+
+    PNSLR_Internal_ParsedDecimal parsed;
+    u64 bits = 0;
+    if (PNSLR_Internal_ParseDecimal(str.data, str.count, &parsed) != str.count)
+    {
+        b8 negative, isNaN;
+        if (!PNSLR_Internal_ParseSpecialFloat(str, &negative, &isNaN)) return false;
+
+        bits = (isNaN ? 0x7FF8000000000000ULL : 0x7FF0000000000000ULL) | (negative ? (1ULL << 63) : 0ULL);
+        PNSLR_MemCopy(value, &bits, sizeof(bits));
+        return true;
+    }
+
+    // mantissa and power of ten both exact, so a single (correctly rounded) operation is the answer
+    if (!parsed.truncated && parsed.exponent >= -22 && parsed.exponent <= 22 && parsed.mantissa <= (1ULL << 53))
+    {
+        f64 result = (f64) parsed.mantissa;
+        if (parsed.exponent < 0) { result /= G_PNSLR_Internal_ExactPowersOf10F64[-parsed.exponent]; }
+        else                     { result *= G_PNSLR_Internal_ExactPowersOf10F64[ parsed.exponent]; }
+
+        *value = parsed.negative ? -result : result;
+        return true;
+    }
+
+    bits = PNSLR_Internal_ParsedDecimalToFloatBits(&parsed, &G_PNSLR_Internal_F64Format) | (parsed.negative ? (1ULL << 63) : 0ULL);
+    PNSLR_MemCopy(value, &bits, sizeof(bits));
     return true;
 }
 
@@ -1280,9 +3706,11 @@ b8 PNSLR_U64FromString(utf8str str, u64* value)
         else if (p == 'x' || p == 'X') { base = 16; i = 2; }
     }
 
-    // If no prefix: check if hex letters appear
     if (base == 10)
     {
+        if (PNSLR_Internal_ParseDecimalU64(str.data, str.count, value)) return true;
+
+        // If no prefix: check if hex letters appear
         for (i64 j = 0; j < str.count; j++)
         {
             u8 c = (u8)str.data[j];
@@ -1292,6 +3720,8 @@ b8 PNSLR_U64FromString(utf8str str, u64* value)
                 break;
             }
         }
+
+        if (base == 10) return false;
     }
 
     u64 result = 0;
@@ -1307,6 +3737,7 @@ b8 PNSLR_U64FromString(utf8str str, u64* value)
         else                            return false; // invalid char
 
         if (digit >= base) return false; // invalid digit for base
+        if (result > (U64_MAX - digit) / base) return false; // overflow
 
         result = result * base + digit;
     }
@@ -1381,7 +3812,7 @@ b8 PNSLR_I64FromString(utf8str str, i64* value)
     if (negative)
     {
         if (uval > (u64) I64_MAX + 1ULL) return false; // overflow
-        *value = -(i64)uval;
+        *value = (i64) (0 - uval); // negating as unsigned, so I64_MIN makes it through
     }
     else
     {
@@ -1392,3 +3823,121 @@ b8 PNSLR_I64FromString(utf8str str, i64* value)
     return true;
 }
 
+#define PNSLR_INTERNAL_ARRAY_FROM_STRING(parseFn)                                               \
+    if (!count) return false;                                                                   \
+    *count = 0;                                                                                 \
+    if (!PNSLR_TrimString(str).count) return true; /* blank, i.e. an empty list */              \
+                                                                                                \
+    PNSLR_StringSplitIterator fields = PNSLR_SplitStringByByte(str, delimiter);                 \
+    utf8str field;                                                                              \
+    while (PNSLR_NextSplitFromStart(&fields, &field))                                           \
+    {                                                                                           \
+        if (*count >= output.count)                                  return false; /* full */   \
+        if (!parseFn(PNSLR_TrimString(field), &output.data[*count])) return false;              \
+        (*count)++;                                                                             \
+    }                                                                                           \
+                                                                                                \
+    return true;
+
+b8 PNSLR_F32ArrayFromString(utf8str str, u8 delimiter, PNSLR_ArraySlice(f32) output, i64* count)
+{
+    PNSLR_INTERNAL_ARRAY_FROM_STRING(PNSLR_F32FromString)
+}
+
+b8 PNSLR_F64ArrayFromString(utf8str str, u8 delimiter, PNSLR_ArraySlice(f64) output, i64* count)
+{
+    PNSLR_INTERNAL_ARRAY_FROM_STRING(PNSLR_F64FromString)
+}
+
+b8 PNSLR_U64ArrayFromString(utf8str str, u8 delimiter, PNSLR_ArraySlice(u64) output, i64* count)
+{
+    PNSLR_INTERNAL_ARRAY_FROM_STRING(PNSLR_U64FromString)
+}
+
+b8 PNSLR_I64ArrayFromString(utf8str str, u8 delimiter, PNSLR_ArraySlice(i64) output, i64* count)
+{
+    PNSLR_INTERNAL_ARRAY_FROM_STRING(PNSLR_I64FromString)
+}
+
+#undef PNSLR_INTERNAL_ARRAY_FROM_STRING
+
+
+// wyhash (wang yi, final version 4); short strings are read as two overlapping halves, long ones
+// 48 bytes at a time through three independent lanes
+
+static const u64 G_PNSLR_Internal_WyHashSecret[4] = {0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL};
+
+static inline u64 PNSLR_Internal_WyMix(u64 a, u64 b)
+{
+    u64 high = 0;
+    u64 low  = PNSLR_Internal_MultiplyU64(a, b, &high);
+    return low ^ high;
+}
+
+static inline u64 PNSLR_Internal_LoadU32AsU64(const u8* data)
+{
+    u32 value = 0;
+    PNSLR_MemCopy(&value, (rawptr) data, sizeof(u32));
+    return value;
+}
+
+u64 PNSLR_HashString(utf8str str, u64 seed)
+{
+    const u64* secret = G_PNSLR_Internal_WyHashSecret;
+    const u8*  p      = str.data;
+    u64        len    = (str.data && str.count > 0) ? (u64) str.count : 0;
+    u64        a, b;
+
+    seed ^= PNSLR_Internal_WyMix(seed ^ secret[0], secret[1]);
+
+    if (len <= 16)
+    {
+        if (len >= 4)
+        {
+            u64 quarter = (len >> 3) << 2;
+            a = (PNSLR_Internal_LoadU32AsU64(p) << 32)           | PNSLR_Internal_LoadU32AsU64(p + quarter);
+            b = (PNSLR_Internal_LoadU32AsU64(p + len - 4) << 32) | PNSLR_Internal_LoadU32AsU64(p + len - 4 - quarter);
+        }
+        else if (len > 0)
+        {
+            a = ((u64) p[0] << 16) | ((u64) p[len >> 1] << 8) | p[len - 1];
+            b = 0;
+        }
+        else
+        {
+            a = b = 0;
+        }
+    }
+    else
+    {
+        u64 i = len;
+        if (i >= 48)
+        {
+            u64 seed1 = seed, seed2 = seed;
+            do
+            {
+                seed  = PNSLR_Internal_WyMix(PNSLR_Internal_LoadU64(p)      ^ secret[1], PNSLR_Internal_LoadU64(p + 8)  ^ seed);
+                seed1 = PNSLR_Internal_WyMix(PNSLR_Internal_LoadU64(p + 16) ^ secret[2], PNSLR_Internal_LoadU64(p + 24) ^ seed1);
+                seed2 = PNSLR_Internal_WyMix(PNSLR_Internal_LoadU64(p + 32) ^ secret[3], PNSLR_Internal_LoadU64(p + 40) ^ seed2);
+                p += 48; i -= 48;
+            }
+            while (i >= 48);
+
+            seed ^= seed1 ^ seed2;
+        }
+
+        while (i > 16)
+        {
+            seed = PNSLR_Internal_WyMix(PNSLR_Internal_LoadU64(p) ^ secret[1], PNSLR_Internal_LoadU64(p + 8) ^ seed);
+            p += 16; i -= 16;
+        }
+
+        a = PNSLR_Internal_LoadU64(p + i - 16);
+        b = PNSLR_Internal_LoadU64(p + i - 8);
+    }
+
+    a ^= secret[1];
+    b ^= seed;
+    a  = PNSLR_Internal_MultiplyU64(a, b, &b);
+    return PNSLR_Internal_WyMix(a ^ secret[0] ^ len, b ^ secret[1]);
+}
@@ -140,6 +140,162 @@ i32 PNSLR_SearchLastIndexInString(utf8str str, utf8str substring, PNSLR_StringCo
  */
 utf8str PNSLR_ReplaceInString(utf8str str, utf8str oldValue, utf8str newValue, PNSLR_Allocator allocator, PNSLR_StringComparisonType comparisonType OPT_ARG);
 
+// Hashing =========================================================================
+
+/**
+ * Hashes the bytes of a string to 64 bits (wyhash, final version 4).
+ * Not suitable for anything cryptographic. The result is the same on every platform,
+ * so it's fine to store it.
+ */
+u64 PNSLR_HashString(utf8str str, u64 seed OPT_ARG);
+
+// Trimming and splitting =========================================================
+
+/**
+ * Returns a view of the string without any leading ASCII whitespace.
+ */
+utf8str PNSLR_TrimStringFromStart(utf8str str);
+
+/**
+ * Returns a view of the string without any trailing ASCII whitespace.
+ */
+utf8str PNSLR_TrimStringFromEnd(utf8str str);
+
+/**
+ * Returns a view of the string without any leading or trailing ASCII whitespace.
+ */
+utf8str PNSLR_TrimString(utf8str str);
+
+/**
+ * What a split iterator splits on.
+ */
+ENUM_START(PNSLR_StringSplitType, u8)
+    #define PNSLR_StringSplitType_Byte       ((PNSLR_StringSplitType) 0)
+    #define PNSLR_StringSplitType_String     ((PNSLR_StringSplitType) 1)
+    #define PNSLR_StringSplitType_AnyOf      ((PNSLR_StringSplitType) 2)
+    #define PNSLR_StringSplitType_Lines      ((PNSLR_StringSplitType) 3)
+    #define PNSLR_StringSplitType_Whitespace ((PNSLR_StringSplitType) 4)
+ENUM_END
+
+/**
+ * Splits a string into parts without allocating; every part is a view into the
+ * original string. Create with one of the `PNSLR_SplitStringBy*` functions, then
+ * take parts from either end with `PNSLR_NextSplitFromStart`/`PNSLR_NextSplitFromEnd`.
+ */
+typedef struct PNSLR_StringSplitIterator
+{
+    utf8str                    remaining;      // not split off yet, from either end
+    utf8str                    separator;      // the separator string, or the set of separator bytes
+    u8                         separatorByte;
+    PNSLR_StringSplitType      type;
+    PNSLR_StringComparisonType comparisonType; // only for splitting by string
+    b8                         finished;
+} PNSLR_StringSplitIterator;
+
+/**
+ * Split on every occurrence of a byte. Empty parts are kept, so "a,,b" gives
+ * "a", "" and "b".
+ */
+PNSLR_StringSplitIterator PNSLR_SplitStringByByte(utf8str str, u8 separator);
+
+/**
+ * Split on every occurrence of a string. Empty parts are kept. An empty
+ * separator never matches.
+ */
+PNSLR_StringSplitIterator PNSLR_SplitStringByString(utf8str str, utf8str separator, PNSLR_StringComparisonType comparisonType OPT_ARG);
+
+/**
+ * Split on every occurrence of any of the bytes in 'separators'. Empty parts are kept.
+ */
+PNSLR_StringSplitIterator PNSLR_SplitStringByAnyOf(utf8str str, utf8str separators);
+
+/**
+ * Split into lines, on "\n" or "\r\n". A newline at the very end does not start
+ * another (empty) line.
+ */
+PNSLR_StringSplitIterator PNSLR_SplitStringByLines(utf8str str);
+
+/**
+ * Split on runs of ASCII whitespace. Empty parts are skipped, so only the words
+ * come out.
+ */
+PNSLR_StringSplitIterator PNSLR_SplitStringByWhitespace(utf8str str);
+
+/**
+ * Takes the next part from the start of what's left.
+ * Returns false once there are no more parts.
+ */
+b8 PNSLR_NextSplitFromStart(PNSLR_StringSplitIterator* iterator, utf8str* part);
+
+/**
+ * Takes the next part from the end of what's left.
+ * Returns false once there are no more parts.
+ */
+b8 PNSLR_NextSplitFromEnd(PNSLR_StringSplitIterator* iterator, utf8str* part);
+
+// Tokenizer =======================================================================
+
+/**
+ * The kinds of tokens the tokenizer produces.
+ */
+ENUM_START(PNSLR_TokenType, u8)
+    #define PNSLR_TokenType_EndOfInput ((PNSLR_TokenType) 0)
+    #define PNSLR_TokenType_Identifier ((PNSLR_TokenType) 1)
+    #define PNSLR_TokenType_Number     ((PNSLR_TokenType) 2)
+    #define PNSLR_TokenType_String     ((PNSLR_TokenType) 3)
+    #define PNSLR_TokenType_Symbol     ((PNSLR_TokenType) 4)
+    #define PNSLR_TokenType_Invalid    ((PNSLR_TokenType) 5)
+ENUM_END
+
+/**
+ * A single token.
+ * Identifiers are letters, digits, underscores and non-ASCII bytes, not starting
+ * with a digit.
+ * Numbers start with a digit (or a '.' followed by one) and are left for the
+ * number parsers to validate; a leading sign is a separate symbol.
+ * Strings are quoted with '"' or '\'', can contain backslash escapes, and have
+ * to end on the line they start on (otherwise they're invalid). Their text keeps
+ * the quotes.
+ * Symbols are any other single byte.
+ */
+typedef struct PNSLR_Token
+{
+    PNSLR_TokenType type;
+    utf8str         text;   // a view into the source
+    i32             line;   // 1-based
+    i32             column; // 1-based, in bytes
+} PNSLR_Token;
+
+/**
+ * Splits source text into tokens, without allocating.
+ * Create with `PNSLR_MakeTokenizer`; can be copied to save/restore its position.
+ */
+typedef struct PNSLR_Tokenizer
+{
+    utf8str source;
+    i64     position;
+    i32     line;
+    i64     lineStart;
+    utf8str lineCommentStart; // e.g. "//" or "#", empty for no comments
+} PNSLR_Tokenizer;
+
+/**
+ * Creates a tokenizer over the source text. Anything from 'lineCommentStart' to
+ * the end of its line is skipped, like whitespace.
+ */
+PNSLR_Tokenizer PNSLR_MakeTokenizer(utf8str source, utf8str lineCommentStart OPT_ARG);
+
+/**
+ * Returns the next token and moves past it. At the end of the source, returns
+ * `PNSLR_TokenType_EndOfInput` tokens.
+ */
+PNSLR_Token PNSLR_NextToken(PNSLR_Tokenizer* tokenizer);
+
+/**
+ * Returns the next token without moving past it.
+ */
+PNSLR_Token PNSLR_PeekToken(PNSLR_Tokenizer* tokenizer);
+
 // UTF-8 functionalities ===========================================================
 
 /**
@@ -171,12 +327,56 @@ PNSLR_EncodedRune PNSLR_EncodeRune(u32 c);
  */
 PNSLR_DecodedRune PNSLR_DecodeRune(PNSLR_ArraySlice(u8) s);
 
+/**
+ * Checks whether a string is entirely well-formed UTF-8, i.e. without overlong encodings,
+ * surrogates, runes past U+10FFFF or truncated sequences. Runs of ASCII are skipped in bulk.
+ */
+b8 PNSLR_ValidateUTF8(utf8str str);
+
+/**
+ * Counts the runes in a UTF-8 string; as many as decoding it rune by rune would produce,
+ * with every byte of an invalid sequence counting as one error rune (U+FFFD).
+ */
+i64 PNSLR_CountRunesInString(utf8str str);
+
+// UTF-16 conversions ==============================================================
+
+/**
+ * Returns the number of UTF-16 code units needed to hold a UTF-8 string. Invalid
+ * sequences count as one error rune (U+FFFD) per byte, as with `PNSLR_DecodeRune`.
+ */
+i64 PNSLR_GetUTF16LengthOfUTF8(utf8str str);
+
+/**
+ * Returns the number of bytes needed to hold a UTF-16 string as UTF-8.
+ * Unpaired surrogates count as the error rune (U+FFFD).
+ */
+i64 PNSLR_GetUTF8LengthOfUTF16(PNSLR_ArraySlice(u16) str);
+
+/**
+ * Converts a UTF-8 string to a UTF-16 string, on every platform.
+ * The output is measured first, then written in one go into a slice allocated
+ * using the specified allocator. Invalid sequences are replaced with U+FFFD.
+ *
+ * Warning! - The output string will contain a null terminator and the slice count
+ * will not include that null terminator.
+ */
+PNSLR_ArraySlice(u16) PNSLR_UTF16FromUTF8(utf8str str, PNSLR_Allocator allocator);
+
+/**
+ * Converts a UTF-16 string to a UTF-8 string, on every platform.
+ * The output is measured first, then written in one go into a string allocated
+ * using the specified allocator. Unpaired surrogates are replaced with U+FFFD.
+ */
+utf8str PNSLR_UTF8FromUTF16(PNSLR_ArraySlice(u16) str, PNSLR_Allocator allocator);
+
 // Windows-specific bs for UTF-16 conversions ======================================
 
 /**
  * Converts a UTF-8 string to a UTF-16 string.
  * The returned string is allocated using the specified allocator.
- * Only available on Windows. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+ * Meant for Windows APIs. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+ * Elsewhere, this falls back to `PNSLR_UTF16FromUTF8`.
  *
  * Warning! - The output string will contain a null terminator and the slice count
  * will not include that null terminator.
@@ -186,7 +386,8 @@ PNSLR_ArraySlice(u16) PNSLR_UTF16FromUTF8WindowsOnly(utf8str str, PNSLR_Allocato
 /**
  * Converts a UTF-16 string to a UTF-8 string.
  * The returned string is allocated using the specified allocator.
- * Only available on Windows. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+ * Meant for Windows APIs. Bad decision to use UTF-16 on Windows, but it's a legacy thing.
+ * Elsewhere, this falls back to `PNSLR_UTF8FromUTF16`.
  *
  * Warning! - All the trailing null terminator characters will be ignored.
  */
@@ -241,11 +442,16 @@ b8 PNSLR_AppendB8ToStringBuilder(PNSLR_StringBuilder* builder, b8 value);
 
 /**
  * Append a 32-bit floating-point number to the string builder.
+ * A negative `decimalPlaces` writes the shortest form that parses back to the same f32
+ * (scientific notation below 1e-6 and from 1e21 up).
  */
 b8 PNSLR_AppendF32ToStringBuilder(PNSLR_StringBuilder* builder, f32 value, i32 decimalPlaces);
 
 /**
  * Append a 64-bit floating point number to the string builder.
+ * A negative `decimalPlaces` writes the shortest form that parses back to the same f64
+ * (scientific notation below 1e-6 and from 1e21 up). Infinities, and magnitudes from
+ * 2^64 up, are always written that way.
  */
 b8 PNSLR_AppendF64ToStringBuilder(PNSLR_StringBuilder* builder, f64 value, i32 decimalPlaces);
 
@@ -340,7 +546,7 @@ ENUM_END
  * The internal encoding of a type-unspecific format specifier.
  * For booleans, valueBufferA is 0 or 1.
  * For floats, valueBufferA is the float value (reinterpret as relevant),
- *     and valueBufferB is the number of decimal places (cast to i32).
+ *     and valueBufferB is the number of decimal places (cast to i32, negative for shortest).
  * For integers, valueBufferA is the integer value (reinterpret as relevant),
  *     and the first half of valueBufferB is the base (cast to PNSLR_IntegerBase).
  * For runes, valueBufferA is the rune value (reinterpret as u32).
@@ -364,11 +570,13 @@ PNSLR_PrimitiveFmtOptions PNSLR_FmtB8(b8 value);
 
 /**
  * Use when formatting a string. Pass as one of the varargs.
+ * Pass a negative `decimalPlaces` for the shortest round-trip form.
  */
 PNSLR_PrimitiveFmtOptions PNSLR_FmtF32(f32 value, i32 decimalPlaces);
 
 /**
  * Use when formatting a string. Pass as one of the varargs.
+ * Pass a negative `decimalPlaces` for the shortest round-trip form.
  */
 PNSLR_PrimitiveFmtOptions PNSLR_FmtF64(f64 value, i32 decimalPlaces);
 
@@ -530,11 +738,13 @@ utf8str PNSLR_StringFromBoolean(b8 value, PNSLR_Allocator allocator);
 
 /**
  * Convert a 32-bit floating-point number to a string with specified decimal places.
+ * Negative decimal places give the shortest string that round-trips.
  */
 utf8str PNSLR_StringFromF32(f32 value, PNSLR_Allocator allocator, i32 decimalPlaces OPT_ARG);
 
 /**
  * Convert a 64-bit floating-point number to a string with specified decimal places.
+ * Negative decimal places give the shortest string that round-trips.
  */
 utf8str PNSLR_StringFromF64(f64 value, PNSLR_Allocator allocator, i32 decimalPlaces OPT_ARG);
 
@@ -587,13 +797,17 @@ b8 PNSLR_BooleanFromString(utf8str str, b8* value);
 
 /**
  * Convert a valid string (numbers-only, with zero or one decimal points,
- * optional -/+ sign at the start) to a 32-bit floating-point number.
+ * optional -/+ sign at the start, optional e/E exponent at the end) to a
+ * 32-bit floating-point number, rounded to the nearest one. Also accepts
+ * "inf", "infinity" and "nan" (case-insensitive, optionally signed).
  */
 b8 PNSLR_F32FromString(utf8str str, f32* value);
 
 /**
  * Convert a valid string (numbers-only, with zero or one decimal points,
- * optional -/+ sign at the start) to a 64-bit floating-point number.
+ * optional -/+ sign at the start, optional e/E exponent at the end) to a
+ * 64-bit floating-point number, rounded to the nearest one. Also accepts
+ * "inf", "infinity" and "nan" (case-insensitive, optionally signed).
  */
 b8 PNSLR_F64FromString(utf8str str, f64* value);
 
@@ -661,5 +875,31 @@ b8 PNSLR_I32FromString(utf8str str, i32* value);
  */
 b8 PNSLR_I64FromString(utf8str str, i64* value);
 
+/**
+ * Parse a list of numbers separated by `delimiter` (e.g. a CSV row) into `output`,
+ * each one as per PNSLR_F32FromString, ignoring whitespace around them. `count` is
+ * set to the number of values written. Fails on an invalid number, or when there
+ * are more numbers than `output` can hold.
+ */
+b8 PNSLR_F32ArrayFromString(utf8str str, u8 delimiter, PNSLR_ArraySlice(f32) output, i64* count);
+
+/**
+ * Parse a list of numbers separated by `delimiter` into `output`, each one as per
+ * PNSLR_F64FromString. See PNSLR_F32ArrayFromString for details.
+ */
+b8 PNSLR_F64ArrayFromString(utf8str str, u8 delimiter, PNSLR_ArraySlice(f64) output, i64* count);
+
+/**
+ * Parse a list of numbers separated by `delimiter` into `output`, each one as per
+ * PNSLR_U64FromString. See PNSLR_F32ArrayFromString for details.
+ */
+b8 PNSLR_U64ArrayFromString(utf8str str, u8 delimiter, PNSLR_ArraySlice(u64) output, i64* count);
+
+/**
+ * Parse a list of numbers separated by `delimiter` into `output`, each one as per
+ * PNSLR_I64FromString. See PNSLR_F32ArrayFromString for details.
+ */
+b8 PNSLR_I64ArrayFromString(utf8str str, u8 delimiter, PNSLR_ArraySlice(i64) output, i64* count);
+
 EXTERN_C_END
 #endif // PNSLR_STRINGS_H ==========================================================
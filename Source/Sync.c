@@ -549,3 +549,72 @@ void PNSLR_ResetEvent(PNSLR_Event* event)
     pthread_mutex_unlock(&e->mutex);
 #endif
 }
+
+i64 PNSLR_AtomicLoadI64(i64* target)
+{
+#if PNSLR_MSVC
+    return (i64) InterlockedCompareExchange64((volatile LONG64*) target, 0, 0);
+#elif PNSLR_CLANG || PNSLR_GCC
+    return __atomic_load_n(target, __ATOMIC_SEQ_CST);
+#else
+    #error "Unsupported compiler for atomics."
+#endif
+}
+
+void PNSLR_AtomicStoreI64(i64* target, i64 value)
+{
+#if PNSLR_MSVC
+    InterlockedExchange64((volatile LONG64*) target, (LONG64) value);
+#elif PNSLR_CLANG || PNSLR_GCC
+    __atomic_store_n(target, value, __ATOMIC_SEQ_CST);
+#else
+    #error "Unsupported compiler for atomics."
+#endif
+}
+
+i64 PNSLR_AtomicFetchAddI64(i64* target, i64 value)
+{
+#if PNSLR_MSVC
+    return (i64) InterlockedExchangeAdd64((volatile LONG64*) target, (LONG64) value);
+#elif PNSLR_CLANG || PNSLR_GCC
+    return __atomic_fetch_add(target, value, __ATOMIC_SEQ_CST);
+#else
+    #error "Unsupported compiler for atomics."
+#endif
+}
+
+b8 PNSLR_AtomicCompareExchangeI64(i64* target, i64* expected, i64 desired)
+{
+#if PNSLR_MSVC
+    i64 previous = (i64) InterlockedCompareExchange64((volatile LONG64*) target, (LONG64) desired, (LONG64) *expected);
+    if (previous == *expected) { return true; }
+    *expected = previous;
+    return false;
+#elif PNSLR_CLANG || PNSLR_GCC
+    return __atomic_compare_exchange_n(target, expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#else
+    #error "Unsupported compiler for atomics."
+#endif
+}
+
+rawptr PNSLR_AtomicLoadPtr(rawptr* target)
+{
+#if PNSLR_MSVC
+    return InterlockedCompareExchangePointer((PVOID volatile*) target, nil, nil);
+#elif PNSLR_CLANG || PNSLR_GCC
+    return __atomic_load_n(target, __ATOMIC_SEQ_CST);
+#else
+    #error "Unsupported compiler for atomics."
+#endif
+}
+
+void PNSLR_AtomicStorePtr(rawptr* target, rawptr value)
+{
+#if PNSLR_MSVC
+    InterlockedExchangePointer((PVOID volatile*) target, value);
+#elif PNSLR_CLANG || PNSLR_GCC
+    __atomic_store_n(target, value, __ATOMIC_SEQ_CST);
+#else
+    #error "Unsupported compiler for atomics."
+#endif
+}
@@ -259,5 +259,39 @@ void PNSLR_SignalEvent(PNSLR_Event* event);
  */
 void PNSLR_ResetEvent(PNSLR_Event* event);
 
+// Atomics =========================================================================
+
+/**
+ * Atomically loads a 64-bit integer, with sequentially-consistent ordering.
+ */
+i64 PNSLR_AtomicLoadI64(i64* target);
+
+/**
+ * Atomically stores a 64-bit integer, with sequentially-consistent ordering.
+ */
+void PNSLR_AtomicStoreI64(i64* target, i64 value);
+
+/**
+ * Atomically adds 'value' to a 64-bit integer.
+ * Returns the value it held before the addition.
+ */
+i64 PNSLR_AtomicFetchAddI64(i64* target, i64 value);
+
+/**
+ * Atomically replaces a 64-bit integer with 'desired' if it still holds '*expected'.
+ * Returns true on success; on failure, '*expected' is updated to the current value.
+ */
+b8 PNSLR_AtomicCompareExchangeI64(i64* target, i64* expected, i64 desired);
+
+/**
+ * Atomically loads a pointer, with sequentially-consistent ordering.
+ */
+rawptr PNSLR_AtomicLoadPtr(rawptr* target);
+
+/**
+ * Atomically stores a pointer, with sequentially-consistent ordering.
+ */
+void PNSLR_AtomicStorePtr(rawptr* target, rawptr value);
+
 EXTERN_C_END
 #endif // PNSLR_SYNC_PRIMITIVES_H ==================================================
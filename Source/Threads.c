@@ -80,8 +80,8 @@ utf8str PNSLR_GetThreadName(PNSLR_ThreadHandle handle, PNSLR_Allocator allocator
         utf8str str = PNSLR_MakeString(prefix.count + sbStr.count, false, allocator, PNSLR_GET_LOC(), nil);
         if (!str.data || !str.count) { FORCE_DBG_TRAP; return (utf8str) {0}; }
 
-        PNSLR_MemCopy(str.data, prefix.data, (i32) prefix.count);
-        PNSLR_MemCopy(str.data + prefix.count, sbStr.data, (i32) sbStr.count);
+        PNSLR_MemCopy(str.data, prefix.data, prefix.count);
+        PNSLR_MemCopy(str.data + prefix.count, sbStr.data, sbStr.count);
         return str;
     }
 }
@@ -102,7 +102,7 @@ void PNSLR_SetThreadName(PNSLR_ThreadHandle handle, utf8str name)
         #elif (PNSLR_LINUX && defined(_GNU_SOURCE)) || (PNSLR_ANDROID && defined(_GNU_SOURCE))
         {
             char nameBuffer[PNSLR_MAX_THREAD_NAME_LEN] = {0};
-            PNSLR_MemCopy(nameBuffer, name.data, (i32) name.count);
+            PNSLR_MemCopy(nameBuffer, name.data, name.count);
             nameBuffer[name.count] = '\0';
 
             pthread_setname_np((pthread_t) handle.handle, nameBuffer);
@@ -125,7 +125,7 @@ void PNSLR_SetCurrentThreadName(utf8str name)
             name.count = PNSLR_MAX_THREAD_NAME_LEN - 1;
 
         char nameBuffer[PNSLR_MAX_THREAD_NAME_LEN] = {0};
-        PNSLR_MemCopy(nameBuffer, name.data, (i32) name.count);
+        PNSLR_MemCopy(nameBuffer, name.data, name.count);
         nameBuffer[name.count] = '\0';
         pthread_setname_np(nameBuffer);
         return;
@@ -151,6 +151,7 @@ typedef struct PNSLR_Internal_ThreadProcPayload
         PNSLR_SetCurrentThreadName(payload.threadName);
         PNSLR_FreeString(payload.threadName, PNSLR_GetAllocator_DefaultHeap(), PNSLR_GET_LOC(), nil);
         payload.procedure(payload.data);
+        PNSLR_FlushThreadCachingHeapCache();
         return 0;
     }
 #elif PNSLR_UNIX
@@ -163,6 +164,7 @@ typedef struct PNSLR_Internal_ThreadProcPayload
         PNSLR_SetCurrentThreadName(payload.threadName);
         PNSLR_FreeString(payload.threadName, PNSLR_GetAllocator_DefaultHeap(), PNSLR_GET_LOC(), nil);
         payload.procedure(payload.data);
+        PNSLR_FlushThreadCachingHeapCache();
         return nil;
     }
 #else
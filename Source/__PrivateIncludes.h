@@ -62,6 +62,7 @@ PNSLR_SUPPRESS_WARN
     #include <sys/stat.h>
     #include <sys/wait.h>
     #include <sys/mman.h>
+    #include <sys/uio.h>
     #include <sys/ioctl.h>
     #include <netinet/in.h>
     #include <errno.h>
@@ -82,6 +83,20 @@ PNSLR_SUPPRESS_WARN
     #include <os/log.h>
 #endif
 
+#if PNSLR_LINUX || PNSLR_ANDROID
+    #include <sys/syscall.h>
+    #include <sys/sendfile.h>
+    #include <linux/fs.h>
+#endif
+
+#if PNSLR_LINUX
+    #if defined(__has_include)
+        #if __has_include(<linux/io_uring.h>)
+            #include <linux/io_uring.h>
+        #endif
+    #endif
+#endif
+
 #if PNSLR_ANDROID
     #include <jni.h>
     #include <android/log.h>
@@ -89,6 +104,12 @@ PNSLR_SUPPRESS_WARN
     #include <android/native_activity.h>
 #endif
 
+#if PNSLR_X64
+    #include <emmintrin.h> // SSE2, baseline on every x64 cpu
+#elif PNSLR_ARM64
+    #include <arm_neon.h>  // NEON, baseline on every arm64 cpu
+#endif
+
 PNSLR_UNSUPPRESS_WARN
 
 #endif//PNSLR_PRIVATE_INCLUDES_H
@@ -19,6 +19,8 @@
 #include "Logger.c"
 #include "Threads.c"
 #include "SharedMemoryChannel.c"
+#include "StringInterner.c"
+#include "AsyncIO.c"
 
 #include "RadDbgMarkup.c"
 
@@ -0,0 +1,646 @@
+#include "zzzz_TestRunner.h"
+
+typedef struct AllocatorsTestRecord
+{
+    u64 id;
+    f32 values[5];
+} AllocatorsTestRecord;
+
+static void AllocatorsTestThreadCachingHeapWorker(rawptr data)
+{
+    PNSLR_Allocator heap   = PNSLR_GetAllocator_ThreadCachingHeap();
+    b8*             failed = (b8*) data;
+
+    u8* blocks[256] = {0};
+    for (i32 round = 0; round < 16; ++round)
+    {
+        for (i32 i = 0; i < 256; ++i)
+        {
+            i32 size  = 1 + ((i * 37 + round * 11) % 2048);
+            blocks[i] = PNSLR_Allocate(heap, true, size, 8, PNSLR_GET_LOC(), nil);
+            if (!blocks[i] || blocks[i][size - 1] != 0) { *failed = true; return; }
+            PNSLR_MemSet(blocks[i], (i32) (u8) i, size);
+        }
+
+        for (i32 i = 0; i < 256; ++i)
+        {
+            if (blocks[i][0] != (u8) i) { *failed = true; }
+            PNSLR_Free(heap, blocks[i], PNSLR_GET_LOC(), nil);
+        }
+    }
+}
+
+static void AllocatorsTestTrackingWorker(rawptr data)
+{
+    PNSLR_Allocator tracking = *(PNSLR_Allocator*) data;
+
+    u8* blocks[10] = {0};
+    for (i32 i = 0; i < 10; ++i) { blocks[i] = PNSLR_Allocate(tracking, true, 32, 8, PNSLR_GET_LOC(), nil); }
+    for (i32 i = 0; i < 5;  ++i) { PNSLR_Free(tracking, blocks[i], PNSLR_GET_LOC(), nil); }
+}
+
+typedef struct AllocatorsTestTrackingHandOff
+{
+    PNSLR_Allocator tracking;
+    u8*             toFree;
+    u8*             toResize;
+} AllocatorsTestTrackingHandOff;
+
+static void AllocatorsTestTrackingHandOffWorker(rawptr data)
+{
+    AllocatorsTestTrackingHandOff* handOff = (AllocatorsTestTrackingHandOff*) data;
+
+    PNSLR_Free(handOff->tracking, handOff->toFree, PNSLR_GET_LOC(), nil);
+    handOff->toResize = PNSLR_Resize(handOff->tracking, false, handOff->toResize, 64, 256, 8, PNSLR_GET_LOC(), nil);
+}
+
+typedef struct AllocatorsTestConcurrentArenaJob
+{
+    PNSLR_Allocator arena;
+    u8              tag;
+    b8              failed;
+} AllocatorsTestConcurrentArenaJob;
+
+static void AllocatorsTestConcurrentArenaWorker(rawptr data)
+{
+    AllocatorsTestConcurrentArenaJob* job = (AllocatorsTestConcurrentArenaJob*) data;
+
+    u8* blocks[512] = {0};
+    for (i32 i = 0; i < 512; ++i)
+    {
+        i32 size  = 1 + ((i * 53) % 700) + ((i % 64 == 0) ? 20000 : 0); // every now and then, bigger than a lease
+        blocks[i] = PNSLR_Allocate(job->arena, true, size, (i % 3 == 0) ? 128 : 8, PNSLR_GET_LOC(), nil);
+        if (!blocks[i] || blocks[i][size - 1] != 0 || ((u64) blocks[i] % ((i % 3 == 0) ? 128 : 8)) != 0) { job->failed = true; return; }
+        PNSLR_MemSet(blocks[i], (i32) job->tag, size);
+    }
+
+    // nobody else scribbled over any of it
+    for (i32 i = 0; i < 512; ++i)
+    {
+        i32 size = 1 + ((i * 53) % 700) + ((i % 64 == 0) ? 20000 : 0);
+        for (i32 j = 0; j < size; ++j) { if (blocks[i][j] != job->tag) { job->failed = true; return; } }
+    }
+}
+
+typedef struct AllocatorsTestSlabJob
+{
+    PNSLR_Allocator slab;
+    u8              tag;
+    b8              failed;
+} AllocatorsTestSlabJob;
+
+static void AllocatorsTestSlabWorker(rawptr data)
+{
+    AllocatorsTestSlabJob* job = (AllocatorsTestSlabJob*) data;
+
+    u8* objects[300] = {0};
+    for (i32 round = 0; round < 8; ++round)
+    {
+        for (i32 i = 0; i < 300; ++i)
+        {
+            i32 size   = 8 + ((i * 29 + round) % 400);
+            objects[i] = PNSLR_Allocate(job->slab, true, size, 8, PNSLR_GET_LOC(), nil);
+            if (!objects[i] || objects[i][size - 1] != 0 || ((u64) objects[i] % 64) != 0) { job->failed = true; return; }
+            PNSLR_MemSet(objects[i], (i32) job->tag, size);
+        }
+
+        for (i32 i = 0; i < 300; ++i)
+        {
+            if (objects[i][0] != job->tag) { job->failed = true; }
+            PNSLR_Free(job->slab, objects[i], PNSLR_GET_LOC(), nil);
+        }
+    }
+}
+
+static i64 AllocatorsTestBenchmarkSmallObjects(PNSLR_Allocator allocator)
+{
+    static const i32 sizes[4] = {24, 48, 96, 200}; // about the size of messages, pipes, string builders
+
+    rawptr objects[256] = {0};
+    i64    start        = PNSLR_NanosecondsSinceUnixEpoch();
+    for (i32 round = 0; round < 200; ++round)
+    {
+        for (i32 i = 0; i < 256; ++i) { objects[i] = PNSLR_Allocate(allocator, true, sizes[(i + round) % 4], 8, PNSLR_GET_LOC(), nil); }
+        for (i32 i = 0; i < 256; ++i) { PNSLR_Free(allocator, objects[(i * 7) % 256], PNSLR_GET_LOC(), nil); } // out of order
+    }
+
+    return PNSLR_NanosecondsSinceUnixEpoch() - start;
+}
+
+MAIN_TEST_FN(ctx)
+{
+    PNSLR_AllocatorError err = PNSLR_AllocatorError_None;
+
+    // --- Pool ---
+    {
+        PNSLR_Allocator pool = PNSLR_NewAllocator_Pool(PNSLR_GetAllocator_DefaultHeap(), sizeof(AllocatorsTestRecord), alignof(AllocatorsTestRecord), 4, PNSLR_GET_LOC(), &err);
+        if (!Assert(err == PNSLR_AllocatorError_None)) return;
+        if (!Assert(pool.procedure == PNSLR_AllocatorFn_Pool)) return;
+
+        u64 caps = PNSLR_QueryAllocatorCapabilities(pool, PNSLR_GET_LOC(), nil);
+        Assert(caps & PNSLR_AllocatorCapability_Free);
+        Assert(caps & PNSLR_AllocatorCapability_FreeAll);
+
+        // allocate past a single chunk to force growth
+        AllocatorsTestRecord* records[10] = {0};
+        for (i32 i = 0; i < 10; ++i)
+        {
+            records[i] = PNSLR_New(AllocatorsTestRecord, pool, PNSLR_GET_LOC(), &err);
+            if (!Assert(err == PNSLR_AllocatorError_None && records[i])) return;
+            Assert(((u64) records[i] % alignof(AllocatorsTestRecord)) == 0);
+            Assert(records[i]->id == 0);
+            records[i]->id = (u64) i;
+        }
+
+        for (i32 i = 0; i < 10; ++i) { Assert(records[i]->id == (u64) i); }
+
+        PNSLR_PoolAllocatorPayload* payload = (PNSLR_PoolAllocatorPayload*) pool.data;
+        Assert(payload->numSlotsUsed == 10);
+        Assert(payload->numSlotsTotal == 12);
+
+        // freed slots get recycled, most recently freed first
+        PNSLR_Delete(records[3], pool, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+        AllocatorsTestRecord* recycled = PNSLR_New(AllocatorsTestRecord, pool, PNSLR_GET_LOC(), &err);
+        Assert(recycled == records[3]);
+        Assert(recycled->id == 0);
+
+        // oversized requests can't be served
+        rawptr tooBig = PNSLR_Allocate(pool, false, (i32) sizeof(AllocatorsTestRecord) + 1, 1, PNSLR_GET_LOC(), &err);
+        Assert(!tooBig && err == PNSLR_AllocatorError_InvalidSize);
+
+        PNSLR_FreeAll(pool, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+        Assert(payload->numSlotsUsed == 0);
+        Assert(payload->numSlotsTotal == 4);
+
+        PNSLR_DestroyAllocator_Pool(pool, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+    }
+
+    // --- Buddy ---
+    {
+        PNSLR_Allocator buddy = PNSLR_NewAllocator_Buddy(PNSLR_GetAllocator_DefaultHeap(), 1024 * 1024, 4096, PNSLR_GET_LOC(), &err);
+        if (!Assert(err == PNSLR_AllocatorError_None)) return;
+        if (!Assert(buddy.procedure == PNSLR_AllocatorFn_Buddy)) return;
+
+        PNSLR_BuddyAllocatorStats stats = PNSLR_GetBuddyAllocatorStats(buddy);
+        Assert(stats.totalBytes == 1024 * 1024);
+        Assert(stats.largestFreeBlock == 1024 * 1024);
+
+        // rounded up to the next power of two
+        u8* a = PNSLR_Allocate(buddy, true, 5000, 16, PNSLR_GET_LOC(), &err);
+        u8* b = PNSLR_Allocate(buddy, true, 4096, 16, PNSLR_GET_LOC(), &err);
+        if (!Assert(a && b && err == PNSLR_AllocatorError_None)) return;
+        Assert(((u64) a % 4096) == 0 && ((u64) b % 4096) == 0);
+
+        stats = PNSLR_GetBuddyAllocatorStats(buddy);
+        Assert(stats.numAllocations == 2);
+        Assert(stats.usedBytes == 8192 + 4096);
+        Assert(stats.requestedBytes == 5000 + 4096);
+
+        // 'b' is the lower half of a free 4K buddy, so growing it should stay in place
+        u8* bGrown = PNSLR_Resize(buddy, true, b, 4096, 8192, 16, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+        Assert(bGrown == b);
+
+        PNSLR_Free(buddy, b, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+        PNSLR_Free(buddy, b, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_DoubleFree);
+
+        // everything coalesces back into a single block
+        PNSLR_Free(buddy, a, PNSLR_GET_LOC(), &err);
+        stats = PNSLR_GetBuddyAllocatorStats(buddy);
+        Assert(stats.numAllocations == 0);
+        Assert(stats.numFreeBlocks == 1);
+        Assert(stats.largestFreeBlock == 1024 * 1024);
+
+        // 'b' no longer starts a block of its own after merging, but it's still a double free
+        PNSLR_Free(buddy, b, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_DoubleFree);
+        PNSLR_Free(buddy, b + 16, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_Internal);
+
+        rawptr tooBig = PNSLR_Allocate(buddy, false, 2 * 1024 * 1024, 16, PNSLR_GET_LOC(), &err);
+        Assert(!tooBig && err == PNSLR_AllocatorError_OutOfMemory);
+        tooBig = PNSLR_Allocate(buddy, false, I64_MAX, 16, PNSLR_GET_LOC(), &err);
+        Assert(!tooBig && err == PNSLR_AllocatorError_OutOfMemory);
+
+        PNSLR_DestroyAllocator_Buddy(buddy, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+    }
+
+    // --- Virtual Arena ---
+    {
+        PNSLR_Allocator arena = PNSLR_NewAllocator_VirtualArena(256LL * 1024 * 1024, PNSLR_GET_LOC(), &err);
+        if (!Assert(err == PNSLR_AllocatorError_None)) return;
+        if (!Assert(arena.procedure == PNSLR_AllocatorFn_VirtualArena)) return;
+
+        PNSLR_VirtualArenaAllocatorPayload* payload = (PNSLR_VirtualArenaAllocatorPayload*) arena.data;
+
+        u8* first = PNSLR_Allocate(arena, true, 100, 16, PNSLR_GET_LOC(), &err);
+        if (!Assert(first && err == PNSLR_AllocatorError_None)) return;
+        for (i32 i = 0; i < 100; ++i) { first[i] = 0xAB; }
+
+        PNSLR_VirtualArenaAllocatorSnapshot snapshot = PNSLR_CaptureVirtualArenaAllocatorSnapshot(arena);
+
+        // the last allocation grows in place, even across many pages
+        u8* buffer = PNSLR_Allocate(arena, false, 1024, 64, PNSLR_GET_LOC(), &err);
+        if (!Assert(buffer && err == PNSLR_AllocatorError_None)) return;
+        u8* grown = PNSLR_Resize(arena, true, buffer, 1024, 16 * 1024 * 1024, 64, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+        Assert(grown == buffer);
+        Assert(grown[16 * 1024 * 1024 - 1] == 0);
+        grown[16 * 1024 * 1024 - 1] = 1;
+        Assert(payload->committed >= 16 * 1024 * 1024);
+
+        // restoring gives the tail back, and memory comes back zeroed
+        Assert(PNSLR_RestoreVirtualArenaAllocatorSnapshot(&snapshot, PNSLR_GET_LOC()) == PNSLR_ArenaSnapshotError_None);
+        Assert(payload->committed < 1024 * 1024);
+        Assert(PNSLR_ValidateVirtualArenaAllocatorSnapshotState(arena));
+        Assert(first[99] == 0xAB);
+
+        u8* again = PNSLR_Allocate(arena, false, 16 * 1024 * 1024, 64, PNSLR_GET_LOC(), &err);
+        if (!Assert(again && err == PNSLR_AllocatorError_None)) return;
+        Assert(again[16 * 1024 * 1024 - 1] == 0);
+
+        rawptr tooBig = PNSLR_Allocate(arena, false, 512 * 1024 * 1024, 16, PNSLR_GET_LOC(), &err);
+        Assert(!tooBig && err == PNSLR_AllocatorError_OutOfMemory);
+        tooBig = PNSLR_Allocate(arena, false, I64_MAX, 16, PNSLR_GET_LOC(), &err);
+        Assert(!tooBig && err == PNSLR_AllocatorError_OutOfMemory);
+        Assert(!PNSLR_Resize(arena, false, again, 16 * 1024 * 1024, I64_MAX, 64, PNSLR_GET_LOC(), &err) && err == PNSLR_AllocatorError_OutOfMemory);
+        Assert(payload->used > 0 && payload->used <= payload->reserved);
+
+        PNSLR_FreeAll(arena, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+        Assert(first[0] == 0);
+
+        PNSLR_DestroyAllocator_VirtualArena(arena, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+
+        // sizes past I32_MAX go through untruncated, only the touched pages are ever backed
+        PNSLR_Allocator hugeArena = PNSLR_NewAllocator_VirtualArena(8LL * 1024 * 1024 * 1024, PNSLR_GET_LOC(), &err);
+        if (!Assert(err == PNSLR_AllocatorError_None)) return;
+        PNSLR_VirtualArenaAllocatorPayload* hugePayload = (PNSLR_VirtualArenaAllocatorPayload*) hugeArena.data;
+
+        i64 hugeSize = 3LL * 1024 * 1024 * 1024;
+        Assert(hugeSize > I32_MAX);
+        u8* huge = PNSLR_Allocate(hugeArena, false, hugeSize, 16, PNSLR_GET_LOC(), &err);
+        if (!Assert(huge && err == PNSLR_AllocatorError_None)) return;
+        Assert(hugePayload->used >= hugeSize && hugePayload->committed >= hugeSize);
+        huge[(i64) I32_MAX + 1] = 0x42;
+        huge[hugeSize - 1]      = 0x43;
+        Assert(huge[(i64) I32_MAX + 1] == 0x42 && huge[hugeSize - 1] == 0x43);
+
+        PNSLR_DestroyAllocator_VirtualArena(hugeArena, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+    }
+
+    // --- Thread-Caching Heap ---
+    {
+        PNSLR_Allocator heap = PNSLR_GetAllocator_ThreadCachingHeap();
+        Assert(PNSLR_QueryAllocatorCapabilities(heap, PNSLR_GET_LOC(), nil) & PNSLR_AllocatorCapability_ThreadSafe);
+
+        AllocatorsTestRecord* record = PNSLR_New(AllocatorsTestRecord, heap, PNSLR_GET_LOC(), &err);
+        if (!Assert(record && err == PNSLR_AllocatorError_None)) return;
+        record->id = 42;
+
+        // recycled blocks still come back zeroed
+        PNSLR_Delete(record, heap, PNSLR_GET_LOC(), &err);
+        record = PNSLR_New(AllocatorsTestRecord, heap, PNSLR_GET_LOC(), &err);
+        if (!Assert(record && err == PNSLR_AllocatorError_None)) return;
+        Assert(record->id == 0);
+        PNSLR_Delete(record, heap, PNSLR_GET_LOC(), &err);
+
+        u8* aligned = PNSLR_Allocate(heap, false, 100, 64, PNSLR_GET_LOC(), &err);
+        Assert(aligned && ((u64) aligned % 64) == 0);
+        PNSLR_Free(heap, aligned, PNSLR_GET_LOC(), &err);
+
+        // grow from a small block into a large one, contents preserved and the tail zeroed
+        u8* data = PNSLR_Allocate(heap, false, 100, 16, PNSLR_GET_LOC(), &err);
+        if (!Assert(data)) return;
+        for (i32 i = 0; i < 100; ++i) { data[i] = (u8) i; }
+        data = PNSLR_Resize(heap, true, data, 100, 4 * 1024 * 1024, 16, PNSLR_GET_LOC(), &err);
+        if (!Assert(data && err == PNSLR_AllocatorError_None)) return;
+        Assert(data[99] == 99 && data[100] == 0 && data[4 * 1024 * 1024 - 1] == 0);
+        data = PNSLR_Resize(heap, true, data, 4 * 1024 * 1024, 16 * 1024 * 1024, 16, PNSLR_GET_LOC(), &err);
+        if (!Assert(data && err == PNSLR_AllocatorError_None)) return;
+        Assert(data[99] == 99 && data[16 * 1024 * 1024 - 1] == 0);
+        PNSLR_Free(heap, data, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+
+        // growing a large block with stricter-than-page alignment keeps that alignment
+        i32 bigAlign = 256 * 1024;
+        u8* wide = PNSLR_Allocate(heap, false, 4 * 1024 * 1024, bigAlign, PNSLR_GET_LOC(), &err);
+        if (!Assert(wide && ((u64) wide % (u64) bigAlign) == 0)) return;
+        wide[0] = 7;
+        wide = PNSLR_Resize(heap, false, wide, 4 * 1024 * 1024, 64 * 1024 * 1024, bigAlign, PNSLR_GET_LOC(), &err);
+        if (!Assert(wide && err == PNSLR_AllocatorError_None)) return;
+        Assert(((u64) wide % (u64) bigAlign) == 0 && wide[0] == 7);
+        PNSLR_Free(heap, wide, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+
+        b8 failed[4] = {0};
+        PNSLR_ThreadHandle threads[4] = {0};
+        for (i32 i = 0; i < 4; ++i) { threads[i] = PNSLR_StartThread(AllocatorsTestThreadCachingHeapWorker, &failed[i], PNSLR_StringLiteral("TCHeapTest")); }
+        for (i32 i = 0; i < 4; ++i) { PNSLR_JoinThread(threads[i]); AssertMsg(!failed[i], "thread-caching heap worker failed"); }
+
+        PNSLR_FlushThreadCachingHeapCache();
+    }
+
+    // --- Tracking ---
+    {
+        PNSLR_Allocator tracking = PNSLR_NewAllocator_Tracking(PNSLR_GetAllocator_DefaultHeap(), PNSLR_GET_LOC(), &err);
+        if (!Assert(err == PNSLR_AllocatorError_None && tracking.data)) return;
+        Assert(PNSLR_QueryAllocatorCapabilities(tracking, PNSLR_GET_LOC(), nil) & PNSLR_AllocatorCapability_HintDebug);
+
+        AllocatorsTestRecord* records[3] = {0};
+        for (i32 i = 0; i < 3; ++i)
+        {
+            records[i] = PNSLR_New(AllocatorsTestRecord, tracking, PNSLR_GET_LOC(), &err);
+            if (!Assert(records[i] && err == PNSLR_AllocatorError_None)) return;
+            Assert(records[i]->id == 0);
+        }
+
+        u8* buffer = PNSLR_Allocate(tracking, false, 100, 64, PNSLR_GET_LOC(), &err);
+        if (!Assert(buffer && err == PNSLR_AllocatorError_None)) return;
+        Assert(((u64) buffer % 64) == 0);
+        for (i32 i = 0; i < 100; ++i) { buffer[i] = (u8) i; }
+
+        PNSLR_TrackingAllocatorStats stats = PNSLR_GetTrackingAllocatorStats(tracking);
+        Assert(stats.numAllocations == 4 && stats.liveAllocations == 4);
+        Assert(stats.liveBytes == 3 * (i64) sizeof(AllocatorsTestRecord) + 100);
+
+        PNSLR_Delete(records[0], tracking, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+
+        buffer = PNSLR_Resize(tracking, true, buffer, 100, 1000, 64, PNSLR_GET_LOC(), &err);
+        if (!Assert(buffer && err == PNSLR_AllocatorError_None)) return;
+        Assert(buffer[99] == 99 && buffer[100] == 0 && buffer[999] == 0);
+
+        stats = PNSLR_GetTrackingAllocatorStats(tracking);
+        Assert(stats.numFrees == 1 && stats.numResizes == 1 && stats.liveAllocations == 3);
+        Assert(stats.liveBytes == 2 * (i64) sizeof(AllocatorsTestRecord) + 1000);
+        Assert(stats.peakBytes == stats.liveBytes);
+
+        // allocations and frees from several threads still add up
+        PNSLR_ThreadHandle threads[2] = {0};
+        for (i32 i = 0; i < 2; ++i) { threads[i] = PNSLR_StartThread(AllocatorsTestTrackingWorker, &tracking, PNSLR_StringLiteral("TrackingTest")); }
+        for (i32 i = 0; i < 2; ++i) { PNSLR_JoinThread(threads[i]); }
+
+        stats = PNSLR_GetTrackingAllocatorStats(tracking);
+        Assert(stats.numThreads >= 2); // a worker may inherit the record of one that already exited
+        Assert(stats.numAllocations == 24 && stats.liveAllocations == 13);
+        Assert(stats.liveBytes == 2 * (i64) sizeof(AllocatorsTestRecord) + 1000 + 10 * 32);
+
+        // frees count against the call site that allocated, the resized buffer is the biggest one
+        PNSLR_ArraySlice(PNSLR_TrackingAllocatorCallSite) sites = PNSLR_GetTrackingAllocatorCallSites(tracking, ctx->testAllocator, PNSLR_GET_LOC(), &err);
+        if (!Assert(sites.count == 3 && err == PNSLR_AllocatorError_None)) return;
+        Assert(sites.data[0].liveBytes == 1000 && sites.data[0].numAllocations == 1);
+        Assert(sites.data[1].liveBytes == 10 * 32 && sites.data[1].numAllocations == 20 && sites.data[1].numFrees == 10);
+        Assert(sites.data[2].liveBytes == 2 * (i64) sizeof(AllocatorsTestRecord) && sites.data[2].numAllocations == 3 && sites.data[2].numFrees == 1);
+
+        PNSLR_StringBuilder sb = {.allocator = ctx->testAllocator};
+        Assert(PNSLR_WriteTrackingAllocatorReportToStream(PNSLR_StreamFromStringBuilder(&sb), tracking, ctx->testAllocator, 2));
+        utf8str report = PNSLR_StringFromStringBuilder(&sb);
+        Assert(PNSLR_StringStartsWith(report, PNSLR_StringLiteral("Tracking allocator: 1384 live bytes"), PNSLR_StringComparisonType_CaseSensitive));
+        Assert(PNSLR_StringEndsWith(report, PNSLR_StringLiteral("... and 1 more call sites.\n"), PNSLR_StringComparisonType_CaseSensitive));
+
+        PNSLR_Delete(records[1], tracking, PNSLR_GET_LOC(), nil);
+        PNSLR_Delete(records[2], tracking, PNSLR_GET_LOC(), nil);
+        PNSLR_Free(tracking, buffer, PNSLR_GET_LOC(), nil);
+
+        PNSLR_ResetTrackingAllocatorPeak(tracking);
+        stats = PNSLR_GetTrackingAllocatorStats(tracking);
+        Assert(stats.liveBytes == 10 * 32 && stats.peakBytes == stats.liveBytes);
+
+        // memory freed or resized on another thread still counts against the call site that allocated it
+        {
+            AllocatorsTestTrackingHandOff handOff = {.tracking = tracking};
+            handOff.toFree   = PNSLR_Allocate(tracking, false, 64, 8, PNSLR_GET_LOC(), nil);
+            handOff.toResize = PNSLR_Allocate(tracking, false, 64, 8, PNSLR_GET_LOC(), nil);
+            if (!Assert(handOff.toFree && handOff.toResize)) return;
+
+            PNSLR_JoinThread(PNSLR_StartThread(AllocatorsTestTrackingHandOffWorker, &handOff, PNSLR_StringLiteral("TrackingTest")));
+            if (!Assert(handOff.toResize)) return;
+
+            stats = PNSLR_GetTrackingAllocatorStats(tracking);
+            Assert(stats.numResizes == 2 && stats.liveBytes == 10 * 32 + 256);
+
+            sites = PNSLR_GetTrackingAllocatorCallSites(tracking, ctx->testAllocator, PNSLR_GET_LOC(), &err);
+            i32 numFreedSites = 0, numResizedSites = 0;
+            for (i64 i = 0; i < sites.count; ++i)
+            {
+                PNSLR_TrackingAllocatorCallSite site = sites.data[i];
+                if (site.numAllocations == 1 && site.numFrees == 1 && !site.numResizes)      { numFreedSites++;   }
+                if (site.numAllocations == 1 && site.numResizes == 1 && site.liveBytes == 256) { numResizedSites++; }
+            }
+            Assert(numFreedSites == 1 && numResizedSites == 1);
+
+            PNSLR_Free(tracking, handOff.toResize, PNSLR_GET_LOC(), nil);
+        }
+
+        PNSLR_DestroyAllocator_Tracking(tracking, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+    }
+
+    // --- Concurrent Arena ---
+    {
+        PNSLR_Allocator arena = PNSLR_NewAllocator_ConcurrentArena(PNSLR_GetAllocator_DefaultHeap(), 256 * 1024, 4 * 1024, PNSLR_GET_LOC(), &err);
+        if (!Assert(err == PNSLR_AllocatorError_None && arena.data)) return;
+        Assert(PNSLR_QueryAllocatorCapabilities(arena, PNSLR_GET_LOC(), nil) & PNSLR_AllocatorCapability_ThreadSafe);
+
+        AllocatorsTestConcurrentArenaJob jobs[4] = {0};
+        PNSLR_ThreadHandle threads[4] = {0};
+        for (i32 i = 0; i < 4; ++i)
+        {
+            jobs[i] = (AllocatorsTestConcurrentArenaJob) {.arena = arena, .tag = (u8) (i + 1)};
+            threads[i] = PNSLR_StartThread(AllocatorsTestConcurrentArenaWorker, &jobs[i], PNSLR_StringLiteral("ArenaTest"));
+        }
+        for (i32 i = 0; i < 4; ++i) { PNSLR_JoinThread(threads[i]); AssertMsg(!jobs[i].failed, "concurrent arena worker failed"); }
+
+        PNSLR_ConcurrentArenaAllocatorPayload* payload = (PNSLR_ConcurrentArenaAllocatorPayload*) arena.data;
+        Assert(payload->currentBlock && payload->currentBlock->previous); // had to grow
+
+        // the last allocation grows in place, others get copied
+        u8* first = PNSLR_Allocate(arena, false, 100, 16, PNSLR_GET_LOC(), &err);
+        if (!Assert(first && err == PNSLR_AllocatorError_None)) return;
+        first[0] = 42;
+        u8* grown = PNSLR_Resize(arena, true, first, 100, 200, 16, PNSLR_GET_LOC(), &err);
+        Assert(grown == first && grown[199] == 0);
+
+        // sizes near the limit fail cleanly instead of wrapping into a lease
+        Assert(!PNSLR_Allocate(arena, false, I64_MAX, 64, PNSLR_GET_LOC(), &err) && err == PNSLR_AllocatorError_OutOfMemory);
+        Assert(!PNSLR_Allocate(arena, false, -1, 16, PNSLR_GET_LOC(), &err) && err == PNSLR_AllocatorError_InvalidSize);
+
+        PNSLR_Free(arena, first, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_InvalidMode);
+
+        // a reset keeps one block, and memory comes back zeroed, even on this thread's old lease
+        PNSLR_FreeAll(arena, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+        Assert(payload->currentBlock && !payload->currentBlock->previous);
+
+        u8* again = PNSLR_Allocate(arena, false, 100, 16, PNSLR_GET_LOC(), &err);
+        if (!Assert(again && err == PNSLR_AllocatorError_None)) return;
+        b8 allZero = true;
+        for (i32 i = 0; i < 100; ++i) { allZero = allZero && again[i] == 0; }
+        Assert(allZero);
+
+        PNSLR_DestroyAllocator_ConcurrentArena(arena, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+    }
+
+    // --- Frame ---
+    {
+        PNSLR_Allocator frames = PNSLR_NewAllocator_Frame(PNSLR_GetAllocator_DefaultHeap(), 3, 4096, PNSLR_GET_LOC(), &err);
+        if (!Assert(err == PNSLR_AllocatorError_None && frames.data)) return;
+
+        PNSLR_Allocator invalid = PNSLR_NewAllocator_Frame(PNSLR_GetAllocator_DefaultHeap(), 9, 4096, PNSLR_GET_LOC(), &err);
+        Assert(!invalid.data && err == PNSLR_AllocatorError_InvalidSize);
+
+        // frame 0: allocations stay valid for two more frames
+        u8* frame0 = PNSLR_Allocate(frames, false, 1000, 16, PNSLR_GET_LOC(), &err);
+        if (!Assert(frame0 && err == PNSLR_AllocatorError_None)) return;
+        PNSLR_MemSet(frame0, 0xAB, 1000);
+        u8* big = PNSLR_Allocate(frames, false, 10000, 64, PNSLR_GET_LOC(), &err); // bigger than a block
+        if (!Assert(big && ((u64) big % 64) == 0)) return;
+
+        i64 highWaterMark = PNSLR_AdvanceFrameAllocator(frames);
+        Assert(highWaterMark >= 11000);
+
+        u8* frame1 = PNSLR_Allocate(frames, false, 100, 16, PNSLR_GET_LOC(), &err);
+        if (!Assert(frame1)) return;
+        PNSLR_AdvanceFrameAllocator(frames);
+        u8* frame2 = PNSLR_Allocate(frames, false, 100, 16, PNSLR_GET_LOC(), &err);
+        if (!Assert(frame2)) return;
+        Assert(frame0[999] == 0xAB); // still alive
+
+        PNSLR_FrameAllocatorStats stats = PNSLR_GetFrameAllocatorStats(frames);
+        Assert(stats.frameIndex == 2 && stats.numFrames == 3);
+        Assert(stats.peakHighWaterMark == highWaterMark);
+        i64 capacity = stats.totalCapacity;
+
+        // the third advance reclaims frame 0, so frame 3 reuses its blocks, zeroed, without going back to the backing allocator
+        PNSLR_AdvanceFrameAllocator(frames);
+        u8* frame3 = PNSLR_Allocate(frames, false, 1000, 16, PNSLR_GET_LOC(), &err);
+        Assert(frame3 == frame0 && frame3[999] == 0);
+        u8* big3 = PNSLR_Allocate(frames, true, 10000, 64, PNSLR_GET_LOC(), &err);
+        Assert(big3 == big && big3[0] == 0);
+
+        // the last allocation of a frame grows in place
+        u8* grown = PNSLR_Resize(frames, true, big3, 10000, 10000 + 16, 64, PNSLR_GET_LOC(), &err);
+        Assert(grown == big3);
+
+        stats = PNSLR_GetFrameAllocatorStats(frames);
+        Assert(stats.totalCapacity == capacity);
+        Assert(stats.lastHighWaterMark > 0 && stats.lastHighWaterMark < highWaterMark);
+        Assert(stats.usedBytes >= 11016);
+
+        PNSLR_Free(frames, frame3, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_InvalidMode);
+
+        PNSLR_DestroyAllocator_Frame(frames, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+
+        // with a single frame, the very next advance reclaims everything
+        PNSLR_Allocator single = PNSLR_NewAllocator_Frame(PNSLR_GetAllocator_DefaultHeap(), 1, 4096, PNSLR_GET_LOC(), &err);
+        if (!Assert(err == PNSLR_AllocatorError_None && single.data)) return;
+        u8* first = PNSLR_Allocate(single, false, 100, 16, PNSLR_GET_LOC(), &err);
+        if (!Assert(first)) return;
+        PNSLR_MemSet(first, 0xAB, 100);
+        Assert(PNSLR_AdvanceFrameAllocator(single) >= 100);
+        Assert(PNSLR_GetFrameAllocatorStats(single).usedBytes == 0);
+        u8* second = PNSLR_Allocate(single, false, 100, 16, PNSLR_GET_LOC(), &err);
+        Assert(second == first && second[99] == 0);
+        PNSLR_DestroyAllocator_Frame(single, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+    }
+
+    // --- Slab ---
+    {
+        PNSLR_Allocator slab = PNSLR_NewAllocator_Slab(PNSLR_GetAllocator_DefaultHeap(), 1, PNSLR_GET_LOC(), &err);
+        if (!Assert(err == PNSLR_AllocatorError_None && slab.data)) return;
+
+        PNSLR_Allocator invalid = PNSLR_NewAllocator_Slab(PNSLR_GetAllocator_DefaultHeap(), -1, PNSLR_GET_LOC(), &err);
+        Assert(!invalid.data && err == PNSLR_AllocatorError_InvalidSize);
+
+        // objects never share a cache line
+        u8* a = PNSLR_Allocate(slab, true, 40, 8, PNSLR_GET_LOC(), &err);
+        u8* b = PNSLR_Allocate(slab, true, 40, 8, PNSLR_GET_LOC(), &err);
+        if (!Assert(a && b && err == PNSLR_AllocatorError_None)) return;
+        Assert(((u64) a % 64) == 0 && ((u64) b % 64) == 0 && a != b);
+        Assert((a > b ? a - b : b - a) >= 64);
+        PNSLR_MemSet(a, 0xCD, 40);
+
+        // freed objects are reused, and zeroed again when asked to
+        PNSLR_Free(slab, a, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+        u8* c = PNSLR_Allocate(slab, true, 33, 8, PNSLR_GET_LOC(), &err);
+        Assert(c == a && c[32] == 0);
+
+        // growing within the object's stride stays in place, past it moves
+        u8* grown = PNSLR_Resize(slab, true, c, 33, 64, 8, PNSLR_GET_LOC(), &err);
+        Assert(grown == c && grown[63] == 0);
+        grown[0] = 0x42;
+        u8* moved = PNSLR_Resize(slab, true, grown, 64, 300, 8, PNSLR_GET_LOC(), &err);
+        Assert(moved && moved != grown && moved[0] == 0x42 && moved[299] == 0);
+
+        // big or over-aligned allocations get a slab of their own
+        u8* large = PNSLR_Allocate(slab, true, 10000, 8, PNSLR_GET_LOC(), &err);
+        u8* aligned = PNSLR_Allocate(slab, true, 100, 256, PNSLR_GET_LOC(), &err);
+        if (!Assert(large && aligned && ((u64) aligned % 256) == 0)) return;
+        Assert(large[9999] == 0);
+
+        PNSLR_SlabAllocatorStats stats = PNSLR_GetSlabAllocatorStats(slab);
+        Assert(stats.numObjectsUsed == 2 && stats.numLargeSlabs == 2);
+        Assert(stats.numSlabs == 2 && stats.reservedBytes >= 2 * 64 * 1024 + 10000);
+
+        PNSLR_Free(slab, large, PNSLR_GET_LOC(), &err);
+        PNSLR_Free(slab, aligned, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+        PNSLR_Free(slab, b, PNSLR_GET_LOC(), &err);
+        PNSLR_Free(slab, b, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_DoubleFree);
+
+        // the emptied slab is kept around for reuse, until trimmed
+        stats = PNSLR_GetSlabAllocatorStats(slab);
+        Assert(stats.numObjectsUsed == 1 && stats.numLargeSlabs == 0 && stats.numEmptySlabs == 1);
+        PNSLR_TrimSlabAllocator(slab, PNSLR_GET_LOC());
+        stats = PNSLR_GetSlabAllocatorStats(slab);
+        Assert(stats.numSlabs == 1 && stats.numEmptySlabs == 0);
+
+        // several threads sharing the allocator
+        {
+            AllocatorsTestSlabJob jobs[4] = {0};
+            PNSLR_ThreadHandle threads[4] = {0};
+            for (i32 i = 0; i < 4; ++i)
+            {
+                jobs[i] = (AllocatorsTestSlabJob) {.slab = slab, .tag = (u8) (0x10 + i), .failed = false};
+                threads[i] = PNSLR_StartThread(AllocatorsTestSlabWorker, &jobs[i], PNSLR_StringLiteral("SlabTest"));
+            }
+            for (i32 i = 0; i < 4; ++i) { PNSLR_JoinThread(threads[i]); AssertMsg(!jobs[i].failed, "slab worker failed"); }
+        }
+
+        stats = PNSLR_GetSlabAllocatorStats(slab);
+        Assert(stats.numObjectsUsed == 1);
+        Assert(stats.numEmptySlabs <= 7); // at most one per cache the workers touched
+
+        PNSLR_FreeAll(slab, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+        stats = PNSLR_GetSlabAllocatorStats(slab);
+        Assert(stats.numObjectsUsed == 0 && stats.numSlabs == stats.numEmptySlabs);
+
+        i64 slabNs = AllocatorsTestBenchmarkSmallObjects(slab);
+        i64 heapNs = AllocatorsTestBenchmarkSmallObjects(PNSLR_GetAllocator_DefaultHeap());
+        LogBenchmark(
+            ctx->testAllocator, "Small object alloc/free x51200: slab $ us, default heap $ us",
+            FmtMicroseconds(slabNs),
+            FmtMicroseconds(heapNs)
+        );
+
+        PNSLR_DestroyAllocator_Slab(slab, PNSLR_GET_LOC(), &err);
+        Assert(err == PNSLR_AllocatorError_None);
+    }
+}
@@ -0,0 +1,799 @@
+#include "zzzz_TestRunner.h"
+
+// a byte pattern that's different at every offset within a few pages, so misplaced reads show up
+static u8 IOTestPatternByte(i64 offset)
+{
+    return (u8) ((offset * 131) ^ (offset >> 9));
+}
+
+static PNSLR_ArraySlice(u8) IOTestMakePattern(i64 size, PNSLR_Allocator allocator)
+{
+    PNSLR_ArraySlice(u8) output = PNSLR_MakeSlice(u8, size, false, allocator, PNSLR_GET_LOC(), nil);
+    for (i64 i = 0; i < output.count; ++i) { output.data[i] = IOTestPatternByte(i); }
+    return output;
+}
+
+static b8 IOTestMatchesPattern(PNSLR_ArraySlice(u8) data, i64 offset)
+{
+    for (i64 i = 0; i < data.count; ++i) { if (data.data[i] != IOTestPatternByte(offset + i)) { return false; } }
+    return true;
+}
+
+typedef struct IOTestSharedReader
+{
+    PNSLR_File file;
+    i64        fileSize;
+    i32        seed;
+    b8         allMatched;
+} IOTestSharedReader;
+
+// reads all over a file through a handle other threads are reading through as well
+static void IOTestSharedReaderWorker(rawptr data)
+{
+    IOTestSharedReader* reader = (IOTestSharedReader*) data;
+
+    u8 buffer[777];
+    reader->allMatched = true;
+    for (i32 i = 0; i < 500; ++i)
+    {
+        i64 offset = ((i64) (i + 1) * 7919 * reader->seed) % (reader->fileSize - (i64) sizeof(buffer));
+        i64 readSize = 0;
+        if (!PNSLR_ReadFromFileAt(reader->file, offset, (PNSLR_ArraySlice(u8)) {.data = buffer, .count = (i64) sizeof(buffer)}, &readSize) ||
+            readSize != (i64) sizeof(buffer) ||
+            !IOTestMatchesPattern((PNSLR_ArraySlice(u8)) {.data = buffer, .count = (i64) sizeof(buffer)}, offset))
+        {
+            reader->allMatched = false;
+        }
+    }
+}
+
+typedef struct IOTestTreeComparison
+{
+    PNSLR_Path      srcRoot;
+    PNSLR_Path      dstRoot;
+    PNSLR_Allocator allocator;
+    i32             numFiles;
+    b8              allMatched;
+} IOTestTreeComparison;
+
+// checks that everything in the source tree made it to the same place in the destination one
+static b8 IOTestCompareTreeEntry(rawptr payload, PNSLR_Path path, b8 isDirectory, b8* exploreCurrentDirectory)
+{
+    IOTestTreeComparison* comparison = (IOTestTreeComparison*) payload;
+    utf8str               relative   = {.data = path.path.data + comparison->srcRoot.path.count, .count = path.path.count - comparison->srcRoot.path.count};
+    PNSLR_Path            dstPath    = {.path = PNSLR_ConcatenateStrings(comparison->dstRoot.path, relative, comparison->allocator)};
+
+    if (isDirectory)
+    {
+        if (!PNSLR_PathExists(dstPath, PNSLR_PathExistsCheckType_Directory)) { comparison->allMatched = false; }
+        return true;
+    }
+
+    comparison->numFiles++;
+
+    PNSLR_ArraySlice(u8) srcContents = {0}, dstContents = {0};
+    if (!PNSLR_ReadAllContentsFromFile(path, &srcContents, comparison->allocator) ||
+        !PNSLR_ReadAllContentsFromFile(dstPath, &dstContents, comparison->allocator) ||
+        !PNSLR_AreStringsEqual(srcContents, dstContents, PNSLR_StringComparisonType_CaseSensitive))
+    {
+        comparison->allMatched = false;
+    }
+
+    return true;
+}
+
+// 30 files of 1000 * i + 1 bytes, in 6 directories with a subdirectory each, and an empty one
+static i32 IOTestMakeTree(PNSLR_Path root, PNSLR_ArraySlice(u8) pattern, PNSLR_Allocator allocator)
+{
+    i32 numFiles = 0;
+    for (i32 i = 0; i < 6; ++i)
+    {
+        utf8str    dirName = PNSLR_FormatString(PNSLR_StringLiteral("Dir$/Sub$"), PNSLR_FmtArgs(PNSLR_FmtI32(i, PNSLR_IntegerBase_Decimal), PNSLR_FmtI32(i % 2, PNSLR_IntegerBase_Decimal)), allocator);
+        PNSLR_Path dir     = PNSLR_GetPathForSubdirectory(root, dirName, allocator);
+        if (!PNSLR_CreateDirectoryTree(dir)) { return -1; }
+
+        for (i32 j = 0; j < 5; ++j, ++numFiles)
+        {
+            utf8str    fileName = PNSLR_FormatString(PNSLR_StringLiteral("file$_$.bin"), PNSLR_FmtArgs(PNSLR_FmtI32(i, PNSLR_IntegerBase_Decimal), PNSLR_FmtI32(j, PNSLR_IntegerBase_Decimal)), allocator);
+            PNSLR_Path filePath = PNSLR_GetPathForChildFile((j % 2) ? dir : root, fileName, allocator);
+            if (!PNSLR_WriteAllContentsToFile(filePath, (PNSLR_ArraySlice(u8)) {.data = pattern.data, .count = 1000 * numFiles + 1}, false)) { return -1; }
+        }
+    }
+
+    if (!PNSLR_CreateDirectoryTree(PNSLR_GetPathForSubdirectory(root, PNSLR_StringLiteral("Empty"), allocator))) { return -1; }
+    return numFiles;
+}
+
+typedef struct IOTestAsyncDestroyer
+{
+    PNSLR_AsyncIOQueue queue;
+    i64                finishedAt;
+} IOTestAsyncDestroyer;
+
+static void IOTestAsyncDestroyerWorker(rawptr data)
+{
+    IOTestAsyncDestroyer* destroyer = (IOTestAsyncDestroyer*) data;
+    PNSLR_DestroyAsyncIOQueue(&destroyer->queue);
+    destroyer->finishedAt = PNSLR_NanosecondsSinceUnixEpoch();
+}
+
+typedef struct IOTestWalkCounts
+{
+    i64 rootLength;
+    i64 numFiles;        // atomic, as are all the rest
+    i64 numDirectories;
+    i64 totalSize;
+    i64 numBadEntries;
+    i64 numVisitsLeft;   // stops the walk once it runs out, if positive
+    b8  skipDirectories;
+} IOTestWalkCounts;
+
+// counts up what's found, and checks every entry is consistent with its own path
+static b8 IOTestWalkVisitor(rawptr payload, PNSLR_DirectoryWalkEntry entry, b8* exploreCurrentDirectory)
+{
+    IOTestWalkCounts* counts = (IOTestWalkCounts*) payload;
+
+    utf8str relative    = {.data = entry.path.path.data + counts->rootLength, .count = entry.path.path.count - counts->rootLength};
+    b8      endsInSlash = relative.count && relative.data[relative.count - 1] == '/';
+    i32     numSlashes  = 0;
+    for (i64 i = 0; i < relative.count - (endsInSlash ? 1 : 0); ++i) { if (relative.data[i] == '/') { numSlashes++; } }
+
+    utf8str expectedName = {.data = relative.data + relative.count - entry.name.count - (endsInSlash ? 1 : 0), .count = entry.name.count};
+    if (endsInSlash != entry.isDirectory || numSlashes != entry.depth || expectedName.data != entry.name.data)
+    {
+        PNSLR_AtomicFetchAddI64(&counts->numBadEntries, 1);
+    }
+
+    if (entry.isDirectory) { PNSLR_AtomicFetchAddI64(&counts->numDirectories, 1); }
+    else                   { PNSLR_AtomicFetchAddI64(&counts->numFiles, 1); PNSLR_AtomicFetchAddI64(&counts->totalSize, entry.size); }
+
+    if (counts->skipDirectories) { *exploreCurrentDirectory = false; }
+    return !counts->numVisitsLeft || PNSLR_AtomicFetchAddI64(&counts->numVisitsLeft, -1) > 1;
+}
+
+static b8 IOTestCountingIterationVisitor(rawptr payload, PNSLR_Path path, b8 isDirectory, b8* exploreCurrentDirectory)
+{
+    (*(i64*) payload)++;
+    return true;
+}
+
+MAIN_TEST_FN(ctx)
+{
+    PNSLR_Path scratchDir = PNSLR_GetPathForSubdirectory(ctx->tgtDir, PNSLR_StringLiteral("IOTestScratch"), ctx->testAllocator);
+    PNSLR_DeletePath(scratchDir);
+    if (!AssertMsg(PNSLR_CreateDirectoryTree(scratchDir), "Could not create the scratch directory."))
+        return;
+
+    // odd-sized, spans a few 64 KiB (windows mapping granularity) boundaries
+    i64                  patternSize = 3 * 65536 + 123;
+    PNSLR_ArraySlice(u8) pattern     = IOTestMakePattern(patternSize, ctx->testAllocator);
+    PNSLR_Path           patternPath = PNSLR_GetPathForChildFile(scratchDir, PNSLR_StringLiteral("pattern.bin"), ctx->testAllocator);
+    Assert(PNSLR_WriteAllContentsToFile(patternPath, pattern, false));
+
+    // --- Memory-mapped files ---
+    {
+        PNSLR_File file = PNSLR_OpenFileToRead(patternPath, false);
+        Assert(file.handle != nil);
+
+        PNSLR_ArraySlice(u8) whole = PNSLR_MapFile(file, PNSLR_FileMappingAccess_ReadOnly, 0, 0);
+        Assert(whole.data != nil && whole.count == patternSize && IOTestMatchesPattern(whole, 0));
+        Assert(PNSLR_AdviseFileMapping(whole, PNSLR_FileMappingHint_Sequential));
+        Assert(PNSLR_AdviseFileMapping(whole, PNSLR_FileMappingHint_WillNeed));
+
+        // offsets don't have to be aligned, and advice can be given for any part of a mapping
+        PNSLR_ArraySlice(u8) part = PNSLR_MapFile(file, PNSLR_FileMappingAccess_ReadOnly, 70001, 1000);
+        Assert(part.data != nil && part.count == 1000 && IOTestMatchesPattern(part, 70001));
+        Assert(PNSLR_AdviseFileMapping((PNSLR_ArraySlice(u8)) {.data = part.data + 17, .count = 100}, PNSLR_FileMappingHint_Random));
+
+        PNSLR_ArraySlice(u8) tail = PNSLR_MapFile(file, PNSLR_FileMappingAccess_ReadOnly, patternSize - 10, 0);
+        Assert(tail.count == 10 && IOTestMatchesPattern(tail, patternSize - 10));
+
+        // nothing outside of the file
+        Assert(PNSLR_MapFile(file, PNSLR_FileMappingAccess_ReadOnly, patternSize, 0).data == nil);
+        Assert(PNSLR_MapFile(file, PNSLR_FileMappingAccess_ReadOnly, 10, patternSize).data == nil);
+        Assert(PNSLR_MapFile(file, PNSLR_FileMappingAccess_ReadOnly, -1, 0).data == nil);
+
+        // the handle isn't needed once mapped
+        PNSLR_CloseFileHandle(file);
+        Assert(IOTestMatchesPattern(part, 70001));
+
+        PNSLR_UnmapFile(tail);
+        PNSLR_UnmapFile(part);
+        PNSLR_UnmapFile(whole);
+    }
+
+    // --- Writable memory-mapped files ---
+    {
+        // copy-on-write changes stay in memory
+        PNSLR_File           file = PNSLR_OpenFileToRead(patternPath, false);
+        PNSLR_ArraySlice(u8) copy = PNSLR_MapFile(file, PNSLR_FileMappingAccess_CopyOnWrite, 100, 50);
+        Assert(copy.data != nil);
+        PNSLR_MemSet(copy.data, 0xAB, copy.count);
+        Assert(copy.data[49] == 0xAB);
+        PNSLR_UnmapFile(copy);
+        PNSLR_CloseFileHandle(file);
+
+        PNSLR_ArraySlice(u8) contents = {0};
+        Assert(PNSLR_ReadAllContentsFromFile(patternPath, &contents, ctx->testAllocator) && IOTestMatchesPattern(contents, 0));
+
+        // read-write ones go back to the file
+        file = PNSLR_OpenFileToRead(patternPath, true);
+        PNSLR_ArraySlice(u8) shared = PNSLR_MapFile(file, PNSLR_FileMappingAccess_ReadWrite, 65530, 20);
+        Assert(shared.data != nil && IOTestMatchesPattern(shared, 65530));
+        PNSLR_MemSet(shared.data, 0xCD, shared.count);
+        Assert(PNSLR_FlushFileMapping(shared));
+        PNSLR_UnmapFile(shared);
+        PNSLR_CloseFileHandle(file);
+
+        Assert(PNSLR_ReadAllContentsFromFile(patternPath, &contents, ctx->testAllocator) && contents.count == patternSize);
+        b8 writtenBack = true;
+        for (i64 i = 0; i < contents.count; ++i)
+        {
+            u8 expected = (i >= 65530 && i < 65550) ? 0xCD : IOTestPatternByte(i);
+            if (contents.data[i] != expected) { writtenBack = false; }
+        }
+        Assert(writtenBack);
+
+        Assert(PNSLR_WriteAllContentsToFile(patternPath, pattern, false)); // back to how it was
+    }
+
+    // --- File mapping streams ---
+    {
+        PNSLR_File              file = PNSLR_OpenFileToRead(patternPath, true);
+        PNSLR_FileMappingStream ms   = {.mapping = PNSLR_MapFile(file, PNSLR_FileMappingAccess_ReadWrite, 1000, 64), .access = PNSLR_FileMappingAccess_ReadWrite};
+        PNSLR_CloseFileHandle(file);
+
+        PNSLR_Stream stream = PNSLR_StreamFromFileMapping(&ms);
+        Assert(PNSLR_GetSizeOfStream(stream) == 64);
+
+        u8  buffer[100] = {0};
+        i64 readSize    = 0;
+        Assert(PNSLR_ReadFromStream(stream, (PNSLR_ArraySlice(u8)) {.data = buffer, .count = 16}, &readSize) && readSize == 16);
+        Assert(IOTestMatchesPattern((PNSLR_ArraySlice(u8)) {.data = buffer, .count = 16}, 1000));
+        Assert(PNSLR_GetCurrentPositionInStream(stream) == 16);
+
+        Assert(PNSLR_SeekPositionInStream(stream, 60, false));
+        Assert(!PNSLR_WriteToStream(stream, PNSLR_StringLiteral("too long"))); // doesn't fit, so nothing's written
+        Assert(PNSLR_WriteToStream(stream, PNSLR_StringLiteral("tail")));
+        Assert(PNSLR_GetCurrentPositionInStream(stream) == 64);
+        Assert(!PNSLR_ReadFromStream(stream, (PNSLR_ArraySlice(u8)) {.data = buffer, .count = 1}, nil));
+        Assert(!PNSLR_SeekPositionInStream(stream, 65, false));
+        Assert(!PNSLR_TruncateStream(stream, 10));
+
+        // reads clamp at the end
+        Assert(PNSLR_SeekPositionInStream(stream, 56, false));
+        Assert(PNSLR_ReadFromStream(stream, (PNSLR_ArraySlice(u8)) {.data = buffer, .count = 100}, &readSize) && readSize == 8);
+        Assert(buffer[4] == 't' && buffer[7] == 'l');
+
+        Assert(PNSLR_FlushStream(stream));
+        PNSLR_CloseStream(stream);
+        Assert(ms.mapping.data == nil);
+
+        PNSLR_ArraySlice(u8) contents = {0};
+        Assert(PNSLR_ReadAllContentsFromFile(patternPath, &contents, ctx->testAllocator));
+        Assert(PNSLR_AreStringsEqual((utf8str) {.data = contents.data + 1060, .count = 4}, PNSLR_StringLiteral("tail"), PNSLR_StringComparisonType_CaseSensitive));
+
+        // read-only ones can't be written to
+        file = PNSLR_OpenFileToRead(patternPath, false);
+        PNSLR_FileMappingStream readOnly = {.mapping = PNSLR_MapFile(file, PNSLR_FileMappingAccess_ReadOnly, 0, 0), .access = PNSLR_FileMappingAccess_ReadOnly};
+        PNSLR_CloseFileHandle(file);
+
+        stream = PNSLR_StreamFromFileMapping(&readOnly);
+        Assert(!PNSLR_WriteToStream(stream, PNSLR_StringLiteral("nope")));
+        Assert(readOnly.mapping.data[0] == IOTestPatternByte(0));
+        PNSLR_CloseStream(stream);
+
+        Assert(PNSLR_WriteAllContentsToFile(patternPath, pattern, false));
+    }
+
+    // --- Positional and vectored file I/O ---
+    {
+        PNSLR_File file = PNSLR_OpenFileToRead(patternPath, true);
+        Assert(file.handle != nil);
+
+        u8  buffer[300] = {0};
+        i64 readSize    = 0;
+        Assert(PNSLR_SeekPositionInFile(file, 5, false));
+        Assert(PNSLR_ReadFromFileAt(file, 70000, (PNSLR_ArraySlice(u8)) {.data = buffer, .count = 300}, &readSize) && readSize == 300);
+        Assert(IOTestMatchesPattern((PNSLR_ArraySlice(u8)) {.data = buffer, .count = 300}, 70000));
+
+        // only short at the end, with what was there
+        Assert(!PNSLR_ReadFromFileAt(file, patternSize - 20, (PNSLR_ArraySlice(u8)) {.data = buffer, .count = 300}, &readSize) && readSize == 20);
+        Assert(IOTestMatchesPattern((PNSLR_ArraySlice(u8)) {.data = buffer, .count = 20}, patternSize - 20));
+        Assert(!PNSLR_ReadFromFileAt(file, patternSize + 10, (PNSLR_ArraySlice(u8)) {.data = buffer, .count = 1}, &readSize) && readSize == 0);
+        Assert(!PNSLR_ReadFromFileAt(file, -1, (PNSLR_ArraySlice(u8)) {.data = buffer, .count = 1}, nil));
+
+        // scattered into buffers of different sizes, empty ones included
+        u8      first[3], second[1000], third[70000];
+        utf8str dsts[4] =
+        {
+            {.data = first,  .count = 3},
+            {.data = nil,    .count = 0},
+            {.data = second, .count = 1000},
+            {.data = third,  .count = 70000},
+        };
+        Assert(PNSLR_ScatterReadFromFileAt(file, 101, (PNSLR_ArraySlice(utf8str)) {.data = dsts, .count = 4}, &readSize) && readSize == 71003);
+        Assert(IOTestMatchesPattern(dsts[0], 101) && IOTestMatchesPattern(dsts[2], 104) && IOTestMatchesPattern(dsts[3], 1104));
+
+        // gathered writes land back to back, and none of it goes through the cursor
+        utf8str srcs[3] = {PNSLR_StringLiteral("abc"), PNSLR_StringLiteral(""), PNSLR_StringLiteral("defgh")};
+        Assert(PNSLR_GatherWriteToFileAt(file, 200, (PNSLR_ArraySlice(utf8str)) {.data = srcs, .count = 3}));
+        Assert(PNSLR_WriteToFileAt(file, 205, PNSLR_StringLiteral("ij")));
+        Assert(PNSLR_ReadFromFileAt(file, 199, (PNSLR_ArraySlice(u8)) {.data = buffer, .count = 12}, nil));
+        Assert(buffer[0] == IOTestPatternByte(199) && buffer[11] == IOTestPatternByte(210));
+        Assert(PNSLR_AreStringsEqual((utf8str) {.data = buffer + 1, .count = 8}, PNSLR_StringLiteral("abcdeijh"), PNSLR_StringComparisonType_CaseSensitive));
+
+        #if !PNSLR_WINDOWS // windows moves the cursor along even with an explicit offset
+            Assert(PNSLR_GetCurrentPositionInFile(file) == 5);
+        #endif
+
+        // writing past the end grows the file
+        Assert(PNSLR_WriteToFileAt(file, patternSize + 4, PNSLR_StringLiteral("end")));
+        Assert(PNSLR_GetSizeOfFile(file) == patternSize + 7);
+        PNSLR_CloseFileHandle(file);
+
+        Assert(PNSLR_WriteAllContentsToFile(patternPath, pattern, false));
+    }
+
+    // --- Concurrent positional reads ---
+    {
+        PNSLR_File file = PNSLR_OpenFileToRead(patternPath, false);
+
+        IOTestSharedReader readers[4];
+        PNSLR_ThreadHandle threads[4];
+        for (i32 i = 0; i < 4; ++i)
+        {
+            readers[i] = (IOTestSharedReader) {.file = file, .fileSize = patternSize, .seed = 13 + i * 2};
+            threads[i] = PNSLR_StartThread(IOTestSharedReaderWorker, &readers[i], PNSLR_StringLiteral("IOTestReader"));
+        }
+
+        b8 allMatched = true;
+        for (i32 i = 0; i < 4; ++i)
+        {
+            PNSLR_JoinThread(threads[i]);
+            if (!readers[i].allMatched) { allMatched = false; }
+        }
+        Assert(allMatched);
+
+        PNSLR_CloseFileHandle(file);
+    }
+
+    // --- File copies ---
+    {
+        PNSLR_Path copyPath = PNSLR_GetPathForChildFile(scratchDir, PNSLR_StringLiteral("copy.bin"), ctx->testAllocator);
+
+        // overwriting something bigger leaves nothing of it behind
+        PNSLR_ArraySlice(u8) junk = PNSLR_MakeSlice(u8, patternSize * 2, true, ctx->testAllocator, PNSLR_GET_LOC(), nil);
+        Assert(PNSLR_WriteAllContentsToFile(copyPath, junk, false));
+        Assert(PNSLR_CopyFile(patternPath, copyPath));
+
+        PNSLR_ArraySlice(u8) contents = {0};
+        Assert(PNSLR_ReadAllContentsFromFile(copyPath, &contents, ctx->testAllocator));
+        Assert(contents.count == patternSize && IOTestMatchesPattern(contents, 0));
+
+        // the copy is its own file, whatever way it was made
+        PNSLR_File file = PNSLR_OpenFileToRead(copyPath, true);
+        Assert(PNSLR_WriteToFileAt(file, 0, PNSLR_StringLiteral("changed")));
+        PNSLR_CloseFileHandle(file);
+        Assert(PNSLR_ReadAllContentsFromFile(patternPath, &contents, ctx->testAllocator) && IOTestMatchesPattern(contents, 0));
+
+        PNSLR_Path emptyPath     = PNSLR_GetPathForChildFile(scratchDir, PNSLR_StringLiteral("empty.bin"), ctx->testAllocator);
+        PNSLR_Path emptyCopyPath = PNSLR_GetPathForChildFile(scratchDir, PNSLR_StringLiteral("emptycopy.bin"), ctx->testAllocator);
+        PNSLR_CloseFileHandle(PNSLR_OpenFileToWrite(emptyPath, false, false));
+        Assert(PNSLR_CopyFile(emptyPath, emptyCopyPath) && PNSLR_PathExists(emptyCopyPath, PNSLR_PathExistsCheckType_File));
+        Assert(PNSLR_GetFileSize(emptyCopyPath) == 0);
+
+        PNSLR_Path missingPath = PNSLR_GetPathForChildFile(scratchDir, PNSLR_StringLiteral("missing.bin"), ctx->testAllocator);
+        Assert(!PNSLR_CopyFile(missingPath, emptyCopyPath));
+    }
+
+    // --- Directory tree copies ---
+    {
+        PNSLR_Path treeSrc = PNSLR_GetPathForSubdirectory(scratchDir, PNSLR_StringLiteral("TreeSrc"), ctx->testAllocator);
+        PNSLR_Path treeDst = PNSLR_GetPathForSubdirectory(scratchDir, PNSLR_StringLiteral("TreeDst"), ctx->testAllocator);
+
+        // a few levels deep, with an empty directory in there too
+        i32 numFiles = IOTestMakeTree(treeSrc, pattern, ctx->testAllocator);
+        if (!Assert(numFiles == 30)) return;
+
+        Assert(PNSLR_CopyDirectoryTree(treeSrc, treeDst, 4));
+
+        IOTestTreeComparison comparison = {.srcRoot = treeSrc, .dstRoot = treeDst, .allocator = ctx->testAllocator, .allMatched = true};
+        PNSLR_IterateDirectory(treeSrc, true, &comparison, IOTestCompareTreeEntry);
+        Assert(comparison.allMatched && comparison.numFiles == numFiles);
+        Assert(PNSLR_PathExists(PNSLR_GetPathForSubdirectory(treeDst, PNSLR_StringLiteral("Empty"), ctx->testAllocator), PNSLR_PathExistsCheckType_Directory));
+
+        // again on one thread, over the top of what's there
+        Assert(PNSLR_CopyDirectoryTree(treeSrc, treeDst, 1));
+
+        // not into itself, and not from something that isn't there
+        Assert(!PNSLR_CopyDirectoryTree(treeSrc, PNSLR_GetPathForSubdirectory(treeSrc, PNSLR_StringLiteral("Inner"), ctx->testAllocator), 0));
+        Assert(!PNSLR_CopyDirectoryTree(PNSLR_GetPathForSubdirectory(scratchDir, PNSLR_StringLiteral("Missing"), ctx->testAllocator), treeDst, 0));
+    }
+
+    // --- Directory tree walks ---
+    {
+        PNSLR_Path treeSrc = PNSLR_GetPathForSubdirectory(scratchDir, PNSLR_StringLiteral("WalkSrc"), ctx->testAllocator);
+        if (!Assert(IOTestMakeTree(treeSrc, pattern, ctx->testAllocator) == 30)) return;
+        i64 expectedSize = 30 + 1000 * (29 * 30 / 2);
+
+        for (i32 numThreads = 1; numThreads <= 4; numThreads += 3)
+        {
+            IOTestWalkCounts counts = {.rootLength = treeSrc.path.count};
+            Assert(PNSLR_WalkDirectoryTree(treeSrc, &counts, IOTestWalkVisitor, true, numThreads));
+            Assert(counts.numFiles == 30 && counts.numDirectories == 13 && counts.numBadEntries == 0);
+            Assert(counts.totalSize == expectedSize);
+
+            // sizes only when asked for
+            counts = (IOTestWalkCounts) {.rootLength = treeSrc.path.count};
+            Assert(PNSLR_WalkDirectoryTree(treeSrc, &counts, IOTestWalkVisitor, false, numThreads));
+            Assert(counts.numFiles == 30 && counts.numDirectories == 13 && counts.totalSize == 0);
+
+            // not going into any of the directories
+            counts = (IOTestWalkCounts) {.rootLength = treeSrc.path.count, .skipDirectories = true};
+            Assert(PNSLR_WalkDirectoryTree(treeSrc, &counts, IOTestWalkVisitor, false, numThreads));
+            Assert(counts.numFiles == 18 && counts.numDirectories == 7);
+
+            // stopping part of the way through
+            counts = (IOTestWalkCounts) {.rootLength = treeSrc.path.count, .numVisitsLeft = 5};
+            Assert(!PNSLR_WalkDirectoryTree(treeSrc, &counts, IOTestWalkVisitor, false, numThreads));
+            Assert(counts.numFiles + counts.numDirectories >= 5 && counts.numFiles + counts.numDirectories < 43);
+        }
+
+        // the same as iterating, with or without the trailing slash
+        i64 numIterated = 0;
+        PNSLR_IterateDirectory(treeSrc, true, &numIterated, IOTestCountingIterationVisitor);
+
+        IOTestWalkCounts counts = {.rootLength = treeSrc.path.count};
+        Assert(PNSLR_WalkDirectoryTree((PNSLR_Path) {.path = {.data = treeSrc.path.data, .count = treeSrc.path.count - 1}}, &counts, IOTestWalkVisitor, false, 2));
+        Assert(counts.numFiles + counts.numDirectories == numIterated && counts.numBadEntries == 0);
+
+        Assert(!PNSLR_WalkDirectoryTree(PNSLR_GetPathForSubdirectory(scratchDir, PNSLR_StringLiteral("Missing"), ctx->testAllocator), &counts, IOTestWalkVisitor, false, 0));
+    }
+
+    // --- Directory tree walk benchmark ---
+    {
+        PNSLR_Path benchRoot = PNSLR_GetPathForSubdirectory(scratchDir, PNSLR_StringLiteral("WalkBench"), ctx->testAllocator);
+        for (i32 i = 0; i < 40; ++i)
+        {
+            utf8str    dirName = PNSLR_FormatString(PNSLR_StringLiteral("Dir$/Inner"), PNSLR_FmtArgs(PNSLR_FmtI32(i, PNSLR_IntegerBase_Decimal)), ctx->testAllocator);
+            PNSLR_Path dir     = PNSLR_GetPathForSubdirectory(benchRoot, dirName, ctx->testAllocator);
+            Assert(PNSLR_CreateDirectoryTree(dir));
+
+            for (i32 j = 0; j < 100; ++j)
+            {
+                utf8str fileName = PNSLR_FormatString(PNSLR_StringLiteral("file$.txt"), PNSLR_FmtArgs(PNSLR_FmtI32(j, PNSLR_IntegerBase_Decimal)), ctx->testAllocator);
+                PNSLR_CloseFileHandle(PNSLR_OpenFileToWrite(PNSLR_GetPathForChildFile(dir, fileName, ctx->testAllocator), false, false));
+            }
+        }
+
+        i64 t0 = PNSLR_NanosecondsSinceUnixEpoch();
+        i64 numIterated = 0;
+        PNSLR_IterateDirectory(benchRoot, true, &numIterated, IOTestCountingIterationVisitor);
+        i64 t1 = PNSLR_NanosecondsSinceUnixEpoch();
+        IOTestWalkCounts singleCounts = {.rootLength = benchRoot.path.count};
+        Assert(PNSLR_WalkDirectoryTree(benchRoot, &singleCounts, IOTestWalkVisitor, false, 1));
+        i64 t2 = PNSLR_NanosecondsSinceUnixEpoch();
+        IOTestWalkCounts parallelCounts = {.rootLength = benchRoot.path.count};
+        Assert(PNSLR_WalkDirectoryTree(benchRoot, &parallelCounts, IOTestWalkVisitor, false, 4));
+        i64 t3 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        Assert(numIterated == 4080 && singleCounts.numFiles + singleCounts.numDirectories == 4080);
+        Assert(parallelCounts.numFiles == 4000 && parallelCounts.numBadEntries == 0);
+
+        LogBenchmark(
+            ctx->testAllocator, "Going through 4080 entries: $ us walking, $ us walking on 4 threads, $ us iterating",
+            FmtMicroseconds(t2 - t1),
+            FmtMicroseconds(t3 - t2),
+            FmtMicroseconds(t1 - t0)
+        );
+    }
+
+    // --- Memory-mapped file benchmark ---
+    {
+        PNSLR_ArraySlice(u8) big     = IOTestMakePattern(64 * 1024 * 1024, ctx->testAllocator);
+        PNSLR_Path           bigPath = PNSLR_GetPathForChildFile(scratchDir, PNSLR_StringLiteral("big.bin"), ctx->testAllocator);
+        Assert(PNSLR_WriteAllContentsToFile(bigPath, big, false));
+
+        i64 t0 = PNSLR_NanosecondsSinceUnixEpoch();
+        PNSLR_ArraySlice(u8) readBack = {0};
+        Assert(PNSLR_ReadAllContentsFromFile(bigPath, &readBack, ctx->testAllocator));
+        u64 readSum = 0;
+        for (i64 i = 0; i < readBack.count; i += 4096) { readSum += readBack.data[i]; }
+        i64 t1 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        PNSLR_File           file   = PNSLR_OpenFileToRead(bigPath, false);
+        PNSLR_ArraySlice(u8) mapped = PNSLR_MapFile(file, PNSLR_FileMappingAccess_ReadOnly, 0, 0);
+        PNSLR_CloseFileHandle(file);
+        PNSLR_AdviseFileMapping(mapped, PNSLR_FileMappingHint_Sequential);
+        u64 mappedSum = 0;
+        for (i64 i = 0; i < mapped.count; i += 4096) { mappedSum += mapped.data[i]; }
+        i64 t2 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        Assert(mapped.count == big.count && readSum == mappedSum);
+        PNSLR_UnmapFile(mapped);
+
+        LogBenchmark(
+            ctx->testAllocator, "Touching every page of 64 MiB: $ us mapped, $ us read into memory",
+            FmtMicroseconds(t2 - t1),
+            FmtMicroseconds(t1 - t0)
+        );
+    }
+
+    // --- File copy benchmark ---
+    {
+        PNSLR_Path bigPath  = PNSLR_GetPathForChildFile(scratchDir, PNSLR_StringLiteral("big.bin"), ctx->testAllocator); // from the benchmark above
+        PNSLR_Path copyPath = PNSLR_GetPathForChildFile(scratchDir, PNSLR_StringLiteral("bigcopy.bin"), ctx->testAllocator);
+
+        i64 t0 = PNSLR_NanosecondsSinceUnixEpoch();
+        PNSLR_ArraySlice(u8) contents = {0};
+        Assert(PNSLR_ReadAllContentsFromFile(bigPath, &contents, ctx->testAllocator));
+        Assert(PNSLR_WriteAllContentsToFile(copyPath, contents, false));
+        i64 t1 = PNSLR_NanosecondsSinceUnixEpoch();
+        Assert(PNSLR_CopyFile(bigPath, copyPath));
+        i64 t2 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        Assert(PNSLR_GetFileSize(copyPath) == contents.count);
+        PNSLR_DeletePath(copyPath);
+
+        LogBenchmark(
+            ctx->testAllocator, "Copying 64 MiB: $ us with PNSLR_CopyFile, $ us reading it in and writing it out",
+            FmtMicroseconds(t2 - t1),
+            FmtMicroseconds(t1 - t0)
+        );
+    }
+
+    // --- Asynchronous I/O ---
+    for (i32 backendIdx = 0; backendIdx < 2; ++backendIdx)
+    {
+        PNSLR_AsyncIOBackend backend = (backendIdx == 0) ? PNSLR_AsyncIOBackend_ThreadPool : PNSLR_AsyncIOBackend_Default;
+        PNSLR_AsyncIOQueue   queue   = PNSLR_CreateAsyncIOQueue(ctx->testAllocator, 8, backend, 2);
+        if (!Assert(queue.data != nil)) { continue; }
+        if (backend == PNSLR_AsyncIOBackend_ThreadPool) { Assert(PNSLR_GetAsyncIOQueueBackend(queue) == PNSLR_AsyncIOBackend_ThreadPool); }
+
+        // scattered writes, out of order
+        PNSLR_Path asyncPath = PNSLR_GetPathForChildFile(scratchDir, PNSLR_StringLiteral("async.bin"), ctx->testAllocator);
+        PNSLR_File file      = PNSLR_OpenFileToWrite(asyncPath, false, false);
+        Assert(file.handle != nil);
+
+        i64                  chunkSize = 10000;
+        PNSLR_AsyncIORequest requests[8];
+        for (i32 i = 0; i < 8; ++i)
+        {
+            i64 offset  = (7 - i) * chunkSize;
+            requests[i] = (PNSLR_AsyncIORequest)
+            {
+                .file      = file,
+                .operation = PNSLR_AsyncIOOperation_Write,
+                .offset    = offset,
+                .buffer    = {.data = pattern.data + offset, .count = chunkSize},
+                .userData  = (u64) (100 + i),
+            };
+        }
+
+        Assert(PNSLR_SubmitAsyncIORequests(queue, (PNSLR_ArraySlice(PNSLR_AsyncIORequest)) {.data = requests, .count = 8}) == 8);
+        Assert(PNSLR_GetNumAsyncIORequestsInFlight(queue) == 8);
+
+        // full, so nothing more gets in
+        Assert(PNSLR_SubmitAsyncIORequests(queue, (PNSLR_ArraySlice(PNSLR_AsyncIORequest)) {.data = requests, .count = 1}) == 0);
+
+        PNSLR_AsyncIOCompletion completions[8];
+        PNSLR_ArraySlice(PNSLR_AsyncIOCompletion) completionsSlice = {.data = completions, .count = 8};
+
+        i32 numCompleted = 0;
+        u64 seenMask     = 0;
+        b8  allWritten   = true;
+        while (numCompleted < 8)
+        {
+            i32 num = PNSLR_WaitForAsyncIOCompletions(queue, completionsSlice, 1);
+            for (i32 i = 0; i < num; ++i)
+            {
+                seenMask |= 1ULL << (completions[i].userData - 100);
+                if (completions[i].status != PNSLR_AsyncIOStatus_Succeeded || completions[i].bytesTransferred != chunkSize) { allWritten = false; }
+            }
+            numCompleted += num;
+            if (!num) { break; }
+        }
+        Assert(numCompleted == 8 && seenMask == 0xFF && allWritten);
+        Assert(PNSLR_GetNumAsyncIORequestsInFlight(queue) == 0);
+
+        PNSLR_AsyncIORequest flush = {.file = file, .operation = PNSLR_AsyncIOOperation_Flush, .userData = 7};
+        Assert(PNSLR_SubmitAsyncIORequests(queue, (PNSLR_ArraySlice(PNSLR_AsyncIORequest)) {.data = &flush, .count = 1}) == 1);
+        Assert(PNSLR_WaitForAsyncIOCompletions(queue, completionsSlice, 1) == 1);
+        Assert(completions[0].userData == 7 && completions[0].status == PNSLR_AsyncIOStatus_Succeeded);
+
+        // nothing to transfer is never an error, whichever the backend
+        PNSLR_AsyncIORequest empties[2] =
+        {
+            {.file = file, .operation = PNSLR_AsyncIOOperation_Write, .offset = 5, .userData = 8},
+            {.file = file, .operation = PNSLR_AsyncIOOperation_Read,  .offset = 5, .userData = 9},
+        };
+        Assert(PNSLR_SubmitAsyncIORequests(queue, (PNSLR_ArraySlice(PNSLR_AsyncIORequest)) {.data = empties, .count = 2}) == 2);
+        Assert(PNSLR_WaitForAsyncIOCompletions(queue, completionsSlice, 2) == 2);
+        Assert(completions[0].status == PNSLR_AsyncIOStatus_Succeeded && completions[0].bytesTransferred == 0);
+        Assert(completions[1].status == PNSLR_AsyncIOStatus_Succeeded && completions[1].bytesTransferred == 0);
+        PNSLR_CloseFileHandle(file);
+
+        PNSLR_ArraySlice(u8) contents = {0};
+        Assert(PNSLR_ReadAllContentsFromFile(asyncPath, &contents, ctx->testAllocator));
+        Assert(contents.count == 8 * chunkSize && IOTestMatchesPattern(contents, 0));
+
+        // reads, including one that runs past the end of the file
+        file = PNSLR_OpenFileToRead(patternPath, false);
+        PNSLR_ArraySlice(u8) readBuffer = PNSLR_MakeSlice(u8, 3 * chunkSize, true, ctx->testAllocator, PNSLR_GET_LOC(), nil);
+        PNSLR_AsyncIORequest reads[3] =
+        {
+            {.file = file, .operation = PNSLR_AsyncIOOperation_Read, .offset = 12345,              .buffer = {.data = readBuffer.data,                 .count = chunkSize}, .userData = 0},
+            {.file = file, .operation = PNSLR_AsyncIOOperation_Read, .offset = 0,                  .buffer = {.data = readBuffer.data + chunkSize,     .count = chunkSize}, .userData = 1},
+            {.file = file, .operation = PNSLR_AsyncIOOperation_Read, .offset = patternSize - 100,  .buffer = {.data = readBuffer.data + 2 * chunkSize, .count = chunkSize}, .userData = 2},
+        };
+        Assert(PNSLR_SubmitAsyncIORequests(queue, (PNSLR_ArraySlice(PNSLR_AsyncIORequest)) {.data = reads, .count = 3}) == 3);
+        Assert(PNSLR_WaitForAsyncIOCompletions(queue, completionsSlice, 3) == 3);
+
+        b8 readsOk = true;
+        for (i32 i = 0; i < 3; ++i)
+        {
+            i64 expected = (completions[i].userData == 2) ? 100 : chunkSize;
+            if (completions[i].status != PNSLR_AsyncIOStatus_Succeeded || completions[i].bytesTransferred != expected) { readsOk = false; }
+        }
+        Assert(readsOk);
+        Assert(IOTestMatchesPattern((PNSLR_ArraySlice(u8)) {.data = readBuffer.data,                 .count = chunkSize}, 12345));
+        Assert(IOTestMatchesPattern((PNSLR_ArraySlice(u8)) {.data = readBuffer.data + chunkSize,     .count = chunkSize}, 0));
+        Assert(IOTestMatchesPattern((PNSLR_ArraySlice(u8)) {.data = readBuffer.data + 2 * chunkSize, .count = 100}, patternSize - 100));
+
+        // nothing in flight, so neither polling nor waiting has anything to give
+        Assert(PNSLR_PollAsyncIOCompletions(queue, completionsSlice) == 0);
+        Assert(PNSLR_WaitForAsyncIOCompletions(queue, completionsSlice, 4) == 0);
+        Assert(!PNSLR_CancelAsyncIORequests(queue, 1));
+
+        // cancelled ones still complete, one way or another
+        Assert(PNSLR_SubmitAsyncIORequests(queue, (PNSLR_ArraySlice(PNSLR_AsyncIORequest)) {.data = reads, .count = 3}) == 3);
+        PNSLR_CancelAsyncIORequests(queue, 1); // may well have finished already, so no point checking
+        Assert(PNSLR_WaitForAsyncIOCompletions(queue, completionsSlice, 3) == 3);
+
+        b8 cancelOk = true;
+        for (i32 i = 0; i < 3; ++i)
+        {
+            if (completions[i].userData == 1) { if (completions[i].status == PNSLR_AsyncIOStatus_Failed) { cancelOk = false; } }
+            else if (completions[i].status != PNSLR_AsyncIOStatus_Succeeded) { cancelOk = false; }
+        }
+        Assert(cancelOk);
+
+        // destroying with requests still in flight waits for them
+        Assert(PNSLR_SubmitAsyncIORequests(queue, (PNSLR_ArraySlice(PNSLR_AsyncIORequest)) {.data = reads, .count = 3}) == 3);
+        PNSLR_DestroyAsyncIOQueue(&queue);
+        Assert(queue.data == nil);
+        PNSLR_CloseFileHandle(file);
+
+        // ...all of them, even when they only finish one at a time (pipes can't be read positionally without io_uring)
+        IOTestAsyncDestroyer destroyer = {0};
+        PNSLR_PipeHandle     readEnds[2] = {0}, writeEnds[2] = {0};
+        if (backend == PNSLR_AsyncIOBackend_Default) { destroyer.queue = PNSLR_CreateAsyncIOQueue(ctx->testAllocator, 4, PNSLR_AsyncIOBackend_IoUring, 0); }
+        if (destroyer.queue.data && PNSLR_CreatePipe(&readEnds[0], &writeEnds[0]) && PNSLR_CreatePipe(&readEnds[1], &writeEnds[1]))
+        {
+            u8 pipeBuffers[2][4] = {0};
+            PNSLR_AsyncIORequest pipeReads[2] =
+            {
+                {.file = {.handle = (rawptr) readEnds[0].platformHandle}, .operation = PNSLR_AsyncIOOperation_Read, .buffer = {.data = pipeBuffers[0], .count = 4}},
+                {.file = {.handle = (rawptr) readEnds[1].platformHandle}, .operation = PNSLR_AsyncIOOperation_Read, .buffer = {.data = pipeBuffers[1], .count = 4}},
+            };
+            Assert(PNSLR_SubmitAsyncIORequests(destroyer.queue, (PNSLR_ArraySlice(PNSLR_AsyncIORequest)) {.data = pipeReads, .count = 2}) == 2);
+
+            PNSLR_ThreadHandle destroyThread = PNSLR_StartThread(IOTestAsyncDestroyerWorker, &destroyer, PNSLR_StringLiteral("AsyncIOTest"));
+            PNSLR_SleepCurrentThread(50);
+            Assert(PNSLR_WriteToPipe(writeEnds[0], PNSLR_StringLiteral("abcd")));
+            PNSLR_SleepCurrentThread(50);
+            i64 lastWriteAt = PNSLR_NanosecondsSinceUnixEpoch();
+            Assert(PNSLR_WriteToPipe(writeEnds[1], PNSLR_StringLiteral("efgh")));
+            PNSLR_JoinThread(destroyThread);
+
+            Assert(destroyer.queue.data == nil && destroyer.finishedAt >= lastWriteAt);
+            Assert(pipeBuffers[0][3] == 'd' && pipeBuffers[1][3] == 'h');
+        }
+        for (i32 i = 0; i < 2; ++i) { if (readEnds[i].platformHandle) { PNSLR_ClosePipe(readEnds[i]); PNSLR_ClosePipe(writeEnds[i]); } }
+        PNSLR_DestroyAsyncIOQueue(&destroyer.queue); // only if the pipes couldn't be made
+
+        // cancelling far more often than there are requests doesn't crowd them out of the ring
+        PNSLR_AsyncIOQueue canceller = {0};
+        PNSLR_PipeHandle   cancelRead = {0}, cancelWrite = {0};
+        if (backend == PNSLR_AsyncIOBackend_Default) { canceller = PNSLR_CreateAsyncIOQueue(ctx->testAllocator, 2, PNSLR_AsyncIOBackend_IoUring, 0); }
+        if (canceller.data && PNSLR_CreatePipe(&cancelRead, &cancelWrite))
+        {
+            u8 pipeBuffer[4] = {0};
+            PNSLR_AsyncIORequest pipeRead = {.file = {.handle = (rawptr) cancelRead.platformHandle}, .operation = PNSLR_AsyncIOOperation_Read, .buffer = {.data = pipeBuffer, .count = 4}, .userData = 3};
+            Assert(PNSLR_SubmitAsyncIORequests(canceller, (PNSLR_ArraySlice(PNSLR_AsyncIORequest)) {.data = &pipeRead, .count = 1}) == 1);
+
+            b8 allFound = true;
+            for (i32 i = 0; i < 16; ++i) { if (!PNSLR_CancelAsyncIORequests(canceller, 3)) { allFound = false; } }
+            Assert(allFound);
+
+            Assert(PNSLR_WaitForAsyncIOCompletions(canceller, completionsSlice, 1) == 1);
+            Assert(completions[0].userData == 3 && completions[0].status == PNSLR_AsyncIOStatus_Cancelled);
+
+            // and the queue still takes new work afterwards
+            Assert(PNSLR_SubmitAsyncIORequests(canceller, (PNSLR_ArraySlice(PNSLR_AsyncIORequest)) {.data = &pipeRead, .count = 1}) == 1);
+            Assert(PNSLR_WriteToPipe(cancelWrite, PNSLR_StringLiteral("ijkl")));
+            Assert(PNSLR_WaitForAsyncIOCompletions(canceller, completionsSlice, 1) == 1);
+            Assert(completions[0].status == PNSLR_AsyncIOStatus_Succeeded && pipeBuffer[3] == 'l');
+        }
+        if (cancelRead.platformHandle) { PNSLR_ClosePipe(cancelRead); PNSLR_ClosePipe(cancelWrite); }
+        PNSLR_DestroyAsyncIOQueue(&canceller);
+    }
+
+    // --- Asynchronous I/O benchmark ---
+    {
+        i64                  blockSize = 4096;
+        i64                  numBlocks = 4096; // 16 MiB of random 4 KiB reads
+        PNSLR_ArraySlice(u8) big       = IOTestMakePattern(numBlocks * blockSize, ctx->testAllocator);
+        PNSLR_Path           bigPath   = PNSLR_GetPathForChildFile(scratchDir, PNSLR_StringLiteral("asyncbig.bin"), ctx->testAllocator);
+        Assert(PNSLR_WriteAllContentsToFile(bigPath, big, false));
+
+        PNSLR_ArraySlice(u8) buffer = PNSLR_MakeSlice(u8, 64 * blockSize, false, ctx->testAllocator, PNSLR_GET_LOC(), nil);
+        PNSLR_File           file   = PNSLR_OpenFileToRead(bigPath, false);
+
+        i64 t0 = PNSLR_NanosecondsSinceUnixEpoch();
+        u64 blockingSum = 0;
+        for (i64 i = 0; i < numBlocks; ++i)
+        {
+            i64 block = (i * 2654435761LL) % numBlocks;
+            PNSLR_SeekPositionInFile(file, block * blockSize, false);
+            PNSLR_ReadFromFile(file, (PNSLR_ArraySlice(u8)) {.data = buffer.data, .count = blockSize}, nil);
+            blockingSum += buffer.data[0];
+        }
+        i64 t1 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        PNSLR_AsyncIOQueue      queue = PNSLR_CreateAsyncIOQueue(ctx->testAllocator, 64, PNSLR_AsyncIOBackend_Default, 0);
+        PNSLR_AsyncIORequest    requests[64];
+        PNSLR_AsyncIOCompletion completions[64];
+
+        // each request reads into its own block of the buffer, handed back once it completes
+        i32 freeBlocks[64];
+        i32 numFreeBlocks = 64;
+        for (i32 i = 0; i < 64; ++i) { freeBlocks[i] = i; }
+
+        u64 asyncSum  = 0;
+        i64 submitted = 0, completed = 0;
+        while (completed < numBlocks)
+        {
+            i32 numRequests = 0;
+            while (numFreeBlocks && submitted + numRequests < numBlocks)
+            {
+                i32 bufferBlock = freeBlocks[--numFreeBlocks];
+                i64 block       = ((submitted + numRequests) * 2654435761LL) % numBlocks;
+                requests[numRequests++] = (PNSLR_AsyncIORequest)
+                {
+                    .file      = file,
+                    .operation = PNSLR_AsyncIOOperation_Read,
+                    .offset    = block * blockSize,
+                    .buffer    = {.data = buffer.data + bufferBlock * blockSize, .count = blockSize},
+                    .userData  = (u64) bufferBlock,
+                };
+            }
+            submitted += PNSLR_SubmitAsyncIORequests(queue, (PNSLR_ArraySlice(PNSLR_AsyncIORequest)) {.data = requests, .count = numRequests});
+
+            i32 num = PNSLR_WaitForAsyncIOCompletions(queue, (PNSLR_ArraySlice(PNSLR_AsyncIOCompletion)) {.data = completions, .count = 64}, 1);
+            for (i32 i = 0; i < num; ++i)
+            {
+                asyncSum += buffer.data[(i64) completions[i].userData * blockSize];
+                freeBlocks[numFreeBlocks++] = (i32) completions[i].userData;
+            }
+            completed += num;
+            if (!num) { break; }
+        }
+        i64 t2 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        Assert(completed == numBlocks && asyncSum == blockingSum);
+        PNSLR_AsyncIOBackend usedBackend = PNSLR_GetAsyncIOQueueBackend(queue);
+        PNSLR_DestroyAsyncIOQueue(&queue);
+        PNSLR_CloseFileHandle(file);
+
+        LogBenchmark(
+            ctx->testAllocator, "Reading 4096 scattered 4 KiB blocks: $ us through a queue ($), $ us blocking",
+            FmtMicroseconds(t2 - t1),
+            PNSLR_FmtString((usedBackend == PNSLR_AsyncIOBackend_IoUring) ? PNSLR_StringLiteral("io_uring") : PNSLR_StringLiteral("thread pool")),
+            FmtMicroseconds(t1 - t0)
+        );
+    }
+
+    PNSLR_DeletePath(scratchDir);
+}
@@ -1,5 +1,71 @@
 #include "zzzz_TestRunner.h"
 
+// straightforward reference, to check the fast search paths against
+static i32 StringsTestNaiveSearch(utf8str str, utf8str sub, b8 ignoreCase, b8 last)
+{
+    if (sub.count == 0 || sub.count > str.count) { return -1; }
+
+    i32 result = -1;
+    for (i64 i = 0; i <= str.count - sub.count; ++i)
+    {
+        b8 match = true;
+        for (i64 j = 0; j < sub.count && match; ++j)
+        {
+            u8 a = str.data[i + j], b = sub.data[j];
+            if (ignoreCase && a >= 'A' && a <= 'Z') { a = (u8) (a + 32); }
+            if (ignoreCase && b >= 'A' && b <= 'Z') { b = (u8) (b + 32); }
+            match = (a == b);
+        }
+
+        if (match) { result = (i32) i; if (!last) { break; } }
+    }
+
+    return result;
+}
+
+// digit-at-a-time reference, to check the integer formatting against
+static void StringsTestNaiveAppendU64(PNSLR_StringBuilder* builder, u64 value, u64 base)
+{
+    u8  digits[64];
+    i32 count = 0;
+    do { digits[count++] = (u8) "0123456789abcdef"[value % base]; value /= base; } while (value > 0);
+    while (count > 0) { PNSLR_AppendByteToStringBuilder(builder, digits[--count]); }
+}
+
+// a stream that only appends to a builder, and counts how often it's written to (i.e. not a
+// string builder stream as far as the formatting code can tell)
+typedef struct StringsTestCountingStream { PNSLR_StringBuilder builder; i64 numWrites; } StringsTestCountingStream;
+
+static b8 StringsTestCountingStreamProcedure(rawptr streamData, PNSLR_StreamMode mode, PNSLR_ArraySlice(u8) data, i64 offset, i64* extraRet)
+{
+    (void) offset; (void) extraRet;
+    StringsTestCountingStream* stream = (StringsTestCountingStream*) streamData;
+    if (mode != PNSLR_StreamMode_Write) { return false; }
+
+    stream->numWrites++;
+    return PNSLR_AppendStringToStringBuilder(&stream->builder, data);
+}
+
+// interns the same keys as every other worker, in its own order, and keeps the handles it got back
+typedef struct StringsTestInternerWorkerData
+{
+    PNSLR_StringInterner interner;
+    utf8str*             keys;
+    i32                  numKeys;
+    i32                  offset;
+    u32*                 handles;
+} StringsTestInternerWorkerData;
+
+static void StringsTestInternerWorker(rawptr data)
+{
+    StringsTestInternerWorkerData* worker = (StringsTestInternerWorkerData*) data;
+    for (i32 i = 0; i < worker->numKeys; ++i)
+    {
+        i32 k = (i + worker->offset) % worker->numKeys;
+        worker->handles[k] = PNSLR_InternString(worker->interner, worker->keys[k]);
+    }
+}
+
 MAIN_TEST_FN(ctx)
 {
     // --- CString Length ---
@@ -38,6 +104,860 @@ MAIN_TEST_FN(ctx)
     Assert(PNSLR_StringStartsWith(helloStr, PNSLR_StringFromCString("he"), PNSLR_StringComparisonType_CaseSensitive));
     Assert(PNSLR_StringEndsWith(worldStr, PNSLR_StringFromCString("ld"), PNSLR_StringComparisonType_CaseSensitive));
 
+    // --- Long casing and comparisons ---
+    {
+        // every byte value, a few times over, so both the vector body and the tail see each one
+        utf8str allBytes = PNSLR_MakeString(256 * 3 + 7, false, ctx->testAllocator, PNSLR_GET_LOC(), nil);
+        for (i64 i = 0; i < allBytes.count; ++i) { allBytes.data[i] = (u8) (i % 256); }
+
+        utf8str upperAll = PNSLR_UpperString(allBytes, ctx->testAllocator);
+        utf8str lowerAll = PNSLR_LowerString(allBytes, ctx->testAllocator);
+        if (!Assert(upperAll.count == allBytes.count && lowerAll.count == allBytes.count)) return;
+
+        i32 numWrong = 0;
+        for (i64 i = 0; i < allBytes.count; ++i)
+        {
+            u8 c = allBytes.data[i];
+            u8 expectedUpper = (c >= 'a' && c <= 'z') ? (u8) (c - 32) : c;
+            u8 expectedLower = (c >= 'A' && c <= 'Z') ? (u8) (c + 32) : c;
+            if (upperAll.data[i] != expectedUpper || lowerAll.data[i] != expectedLower) { numWrong++; }
+        }
+        Assert(numWrong == 0);
+
+        Assert(PNSLR_AreStringsEqual(upperAll, lowerAll, PNSLR_StringComparisonType_CaseInsensitive));
+        Assert(!PNSLR_AreStringsEqual(upperAll, lowerAll, PNSLR_StringComparisonType_CaseSensitive));
+        Assert(PNSLR_AreStringsEqual(allBytes, PNSLR_CloneString(allBytes, ctx->testAllocator), PNSLR_StringComparisonType_CaseSensitive));
+
+        // '@' and '`' (and '[' and '{') sit right next to the letters, and must not fold onto each other
+        utf8str almost = PNSLR_CloneString(lowerAll, ctx->testAllocator);
+        almost.data[256 + '`'] = '@';
+        Assert(!PNSLR_AreStringsEqual(almost, upperAll, PNSLR_StringComparisonType_CaseInsensitive));
+        almost = PNSLR_CloneString(lowerAll, ctx->testAllocator);
+        almost.data[almost.count - 1] ^= 1; // in the tail
+        Assert(!PNSLR_AreStringsEqual(almost, upperAll, PNSLR_StringComparisonType_CaseInsensitive));
+
+        utf8str prefix = {.count = 300, .data = upperAll.data};
+        utf8str suffix = {.count = 300, .data = upperAll.data + upperAll.count - 300};
+        Assert(PNSLR_StringStartsWith(lowerAll, prefix, PNSLR_StringComparisonType_CaseInsensitive));
+        Assert(!PNSLR_StringStartsWith(lowerAll, prefix, PNSLR_StringComparisonType_CaseSensitive));
+        Assert(PNSLR_StringEndsWith(lowerAll, suffix, PNSLR_StringComparisonType_CaseInsensitive));
+        Assert(!PNSLR_StringEndsWith(lowerAll, suffix, PNSLR_StringComparisonType_CaseSensitive));
+        Assert(!PNSLR_StringEndsWith(prefix, lowerAll, PNSLR_StringComparisonType_CaseInsensitive));
+    }
+
+    // --- UTF-8 validation and rune counting ---
+    {
+        Assert(PNSLR_ValidateUTF8(PNSLR_StringFromCString("plain ascii")));
+        Assert(PNSLR_ValidateUTF8(PNSLR_StringFromCString("h\xC3\xA9llo w\xC3\xB6rld \xE2\x82\xAC \xF0\x9F\x98\x80"))); // é ö € 😀
+        Assert(PNSLR_CountRunesInString(PNSLR_StringFromCString("h\xC3\xA9llo w\xC3\xB6rld \xE2\x82\xAC \xF0\x9F\x98\x80")) == 15);
+        Assert(PNSLR_ValidateUTF8((utf8str) {0}) && PNSLR_CountRunesInString((utf8str) {0}) == 0);
+
+        Assert(!PNSLR_ValidateUTF8(PNSLR_StringFromCString("\xC0\x80")));         // overlong
+        Assert(!PNSLR_ValidateUTF8(PNSLR_StringFromCString("\xED\xA0\x80")));     // surrogate
+        Assert(!PNSLR_ValidateUTF8(PNSLR_StringFromCString("abc\xE2\x82")));       // truncated
+        Assert(!PNSLR_ValidateUTF8(PNSLR_StringFromCString("\xF4\x90\x80\x80"))); // past U+10FFFF
+        Assert(!PNSLR_ValidateUTF8(PNSLR_StringFromCString("\x80")));              // stray continuation byte
+        Assert(PNSLR_CountRunesInString(PNSLR_StringFromCString("a\xE2\x82z")) == 4); // 'a', error, error, 'z'
+
+        // long runs of ascii with the odd multi-byte rune or broken byte somewhere in between
+        utf8str mixed = PNSLR_MakeString(5000, false, ctx->testAllocator, PNSLR_GET_LOC(), nil);
+        for (i64 i = 0; i < mixed.count; ++i) { mixed.data[i] = (u8) ('a' + (i % 26)); }
+        i64 expectedRunes = mixed.count;
+        for (i64 i = 100; i + 3 < mixed.count; i += 700)
+        {
+            mixed.data[i] = 0xE2; mixed.data[i + 1] = 0x82; mixed.data[i + 2] = 0xAC; // €
+            expectedRunes -= 2;
+        }
+
+        Assert(PNSLR_ValidateUTF8(mixed));
+        Assert(PNSLR_CountRunesInString(mixed) == expectedRunes);
+
+        i32 numWrong = 0;
+        for (i64 at = 3000; at < 3040; ++at)
+        {
+            u8 saved = mixed.data[at];
+            mixed.data[at] = 0xFF;
+            if (PNSLR_ValidateUTF8(mixed)) { numWrong++; }
+
+            i64 decodedCount = 0;
+            for (i64 i = 0; i < mixed.count; ++decodedCount)
+            {
+                PNSLR_DecodedRune decoded = PNSLR_DecodeRune((PNSLR_ArraySlice(u8)) {.count = mixed.count - i, .data = mixed.data + i});
+                i += decoded.length;
+            }
+            if (PNSLR_CountRunesInString(mixed) != decodedCount) { numWrong++; }
+
+            mixed.data[at] = saved;
+        }
+        Assert(numWrong == 0);
+    }
+
+    // --- UTF-16 conversions ---
+    {
+        utf8str sample = PNSLR_StringFromCString("h\xC3\xA9llo \xE2\x82\xAC \xF0\x9F\x98\x80"); // é € 😀
+        u16 expected[] = {'h', 0xE9, 'l', 'l', 'o', ' ', 0x20AC, ' ', 0xD83D, 0xDE00};
+
+        PNSLR_ArraySlice(u16) wide = PNSLR_UTF16FromUTF8(sample, ctx->testAllocator);
+        Assert(PNSLR_GetUTF16LengthOfUTF8(sample) == 10 && wide.count == 10 && wide.data[wide.count] == 0);
+        b8 wideMatches = true;
+        for (i64 i = 0; i < wide.count; ++i) { wideMatches = wideMatches && (wide.data[i] == expected[i]); }
+        Assert(wideMatches);
+
+        utf8str narrow = PNSLR_UTF8FromUTF16(wide, ctx->testAllocator);
+        Assert(PNSLR_GetUTF8LengthOfUTF16(wide) == sample.count && PNSLR_AreStringsEqual(narrow, sample, PNSLR_StringComparisonType_CaseSensitive));
+
+        // bad input in either direction comes out as U+FFFD
+        PNSLR_ArraySlice(u16) brokenWide = PNSLR_UTF16FromUTF8(PNSLR_StringFromCString("a\xE2\x82z\xFF"), ctx->testAllocator);
+        Assert(brokenWide.count == 5 && brokenWide.data[0] == 'a' && brokenWide.data[1] == 0xFFFD && brokenWide.data[2] == 0xFFFD && brokenWide.data[3] == 'z' && brokenWide.data[4] == 0xFFFD);
+
+        u16 loneSurrogates[] = {0xD800, 'x', 0xDC00, 0xDBFF};
+        utf8str brokenNarrow = PNSLR_UTF8FromUTF16((PNSLR_ArraySlice(u16)) {.data = loneSurrogates, .count = 4}, ctx->testAllocator);
+        Assert(PNSLR_AreStringsEqual(brokenNarrow, PNSLR_StringFromCString("\xEF\xBF\xBDx\xEF\xBF\xBD\xEF\xBF\xBD"), PNSLR_StringComparisonType_CaseSensitive));
+
+        Assert(PNSLR_UTF16FromUTF8((utf8str) {0}, ctx->testAllocator).count == 0);
+        Assert(PNSLR_UTF8FromUTF16((PNSLR_ArraySlice(u16)) {0}, ctx->testAllocator).count == 0);
+
+        // long runs of ascii around every width of rune, so the vector paths get cut off at odd places
+        utf8str runes[] = { PNSLR_StringLiteral("\xC3\xA9"), PNSLR_StringLiteral("\xE2\x82\xAC"), PNSLR_StringLiteral("\xF0\x9F\x98\x80"), PNSLR_StringLiteral("\xE2") };
+        PNSLR_StringBuilder builder = {.allocator = ctx->testAllocator};
+        for (i32 i = 0; i < 400; ++i)
+        {
+            for (i32 j = 0; j < (i % 37); ++j) { PNSLR_AppendByteToStringBuilder(&builder, (u8) ('a' + (j % 26))); }
+            PNSLR_AppendStringToStringBuilder(&builder, runes[i % 4]);
+        }
+        utf8str mixed = PNSLR_StringFromStringBuilder(&builder);
+
+        // reference: rune by rune
+        PNSLR_StringBuilder referenceBuilder = {.allocator = ctx->testAllocator};
+        i64 referenceCount = 0;
+        for (i64 i = 0; i < mixed.count;)
+        {
+            PNSLR_DecodedRune decoded = PNSLR_DecodeRune((PNSLR_ArraySlice(u8)) {.count = mixed.count - i, .data = mixed.data + i});
+            PNSLR_AppendRuneToStringBuilder(&referenceBuilder, decoded.rune);
+            referenceCount += (decoded.rune > 0xFFFF) ? 2 : 1;
+            i += decoded.length;
+        }
+
+        PNSLR_ArraySlice(u16) mixedWide = PNSLR_UTF16FromUTF8(mixed, ctx->testAllocator);
+        Assert(mixedWide.count == referenceCount);
+
+        i32 numWrong = 0;
+        i64 at       = 0;
+        for (i64 i = 0; i < mixed.count && at < mixedWide.count;)
+        {
+            PNSLR_DecodedRune decoded = PNSLR_DecodeRune((PNSLR_ArraySlice(u8)) {.count = mixed.count - i, .data = mixed.data + i});
+            u32 rune = mixedWide.data[at++];
+            if (rune >= 0xD800 && rune <= 0xDBFF) { rune = 0x10000 + ((rune - 0xD800) << 10) + (u32) (mixedWide.data[at++] - 0xDC00); }
+            if (rune != decoded.rune) { numWrong++; }
+            i += decoded.length;
+        }
+        Assert(numWrong == 0);
+
+        // back to utf-8, where the broken bytes have turned into U+FFFD
+        utf8str mixedNarrow = PNSLR_UTF8FromUTF16(mixedWide, ctx->testAllocator);
+        Assert(PNSLR_AreStringsEqual(mixedNarrow, PNSLR_StringFromStringBuilder(&referenceBuilder), PNSLR_StringComparisonType_CaseSensitive));
+    }
+
+    // --- UTF-16 benchmark ---
+    {
+        // 8 MiB of mostly-ascii text, like save files and protocol messages tend to be
+        utf8str text    = PNSLR_MakeString(8 * 1024 * 1024, false, ctx->testAllocator, PNSLR_GET_LOC(), nil);
+        cstring line    = "player=\xC3\xA9lodie score=1200 zone=north; ";
+        i32     lineLen = PNSLR_GetCStringLength(line);
+        for (i64 i = 0; i < text.count; ++i) { text.data[i] = (u8) line[i % lineLen]; }
+
+        i64 t0 = PNSLR_NanosecondsSinceUnixEpoch();
+        PNSLR_ArraySlice(u16) wide = PNSLR_UTF16FromUTF8(text, ctx->testAllocator);
+        i64 t1 = PNSLR_NanosecondsSinceUnixEpoch();
+        utf8str narrow = PNSLR_UTF8FromUTF16(wide, ctx->testAllocator);
+        i64 t2 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        Assert(wide.count == PNSLR_CountRunesInString(text));
+        Assert(PNSLR_AreStringsEqual(narrow, text, PNSLR_StringComparisonType_CaseSensitive));
+
+        LogBenchmark(
+            ctx->testAllocator, "UTF-16 8 MiB: to utf-16 $ us, back to utf-8 $ us",
+            FmtMicroseconds(t1 - t0),
+            FmtMicroseconds(t2 - t1)
+        );
+    }
+
+    // --- Integer formatting ---
+    {
+        PNSLR_StringBuilder builder = {.allocator = ctx->testAllocator};
+        #define STRINGS_TEST_FORMATS_AS(appendCall, expected) \
+            PNSLR_ResetStringBuilder(&builder); appendCall; \
+            Assert(PNSLR_AreStringsEqual(PNSLR_StringFromStringBuilder(&builder), PNSLR_StringLiteral(expected), PNSLR_StringComparisonType_CaseSensitive));
+
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendU64ToStringBuilder(&builder, 0,       PNSLR_IntegerBase_Decimal),     "0");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendU64ToStringBuilder(&builder, U64_MAX, PNSLR_IntegerBase_Decimal),     "18446744073709551615");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendI64ToStringBuilder(&builder, I64_MIN, PNSLR_IntegerBase_Decimal),     "-9223372036854775808");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendI32ToStringBuilder(&builder, -255,    PNSLR_IntegerBase_HexaDecimal), "-0xff");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendU8ToStringBuilder (&builder, 0,       PNSLR_IntegerBase_Binary),      "0b0");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendU16ToStringBuilder(&builder, 511,     PNSLR_IntegerBase_Octal),       "0o777");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, 0.0,     3),                             "0.000");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, -2.05,   2),                             "-2.05");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, 9.9999,  2),                             "10.00");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, 1234.5,  0),                             "1234");
+        #undef STRINGS_TEST_FORMATS_AS
+
+        // every digit count and every power-of-ten boundary, in each base
+        PNSLR_StringBuilder reference = {.allocator = ctx->testAllocator};
+        PNSLR_IntegerBase   bases[]   = {PNSLR_IntegerBase_Decimal, PNSLR_IntegerBase_HexaDecimal, PNSLR_IntegerBase_Octal, PNSLR_IntegerBase_Binary};
+        u64                 baseInts[] = {10, 16, 8, 2};
+        cstring             prefixes[] = {"", "0x", "0o", "0b"};
+
+        i32 numWrong = 0;
+        u64 value    = 1;
+        for (i32 step = 0; step < 20; ++step, value *= 10)
+        {
+            u64 candidates[] = {value - 1, value, value + 1, value * 7 + 3};
+            for (i32 c = 0; c < 4; ++c)
+            {
+                for (i32 b = 0; b < 4; ++b)
+                {
+                    PNSLR_ResetStringBuilder(&builder);
+                    PNSLR_ResetStringBuilder(&reference);
+                    PNSLR_AppendU64ToStringBuilder(&builder, candidates[c], bases[b]);
+                    PNSLR_AppendCStringToStringBuilder(&reference, prefixes[b]);
+                    StringsTestNaiveAppendU64(&reference, candidates[c], baseInts[b]);
+                    if (!PNSLR_AreStringsEqual(PNSLR_StringFromStringBuilder(&builder), PNSLR_StringFromStringBuilder(&reference), PNSLR_StringComparisonType_CaseSensitive)) { numWrong++; }
+                }
+            }
+        }
+        Assert(numWrong == 0);
+    }
+
+    // --- Float formatting ---
+    {
+        PNSLR_StringBuilder builder = {.allocator = ctx->testAllocator};
+        #define STRINGS_TEST_FORMATS_AS(appendCall, expected) \
+            PNSLR_ResetStringBuilder(&builder); appendCall; \
+            Assert(PNSLR_AreStringsEqual(PNSLR_StringFromStringBuilder(&builder), PNSLR_StringLiteral(expected), PNSLR_StringComparisonType_CaseSensitive));
+
+        // shortest round-trip
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, 1.0,                     -1), "1");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, 0.3,                     -1), "0.3");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, -1234.5678,              -1), "-1234.5678");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, 1e20,                    -1), "100000000000000000000");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, 1e21,                    -1), "1e21");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, 0.000001,                -1), "0.000001");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, 1.5e-7,                  -1), "1.5e-7");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, 5e-324,                  -1), "5e-324");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, 1.7976931348623157e308,  -1), "1.7976931348623157e308");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, 9007199254740993.0,      -1), "9007199254740992");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, -0.0,                    -1), "-0");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF32ToStringBuilder(&builder, 1.1f,                    -1), "1.1");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF32ToStringBuilder(&builder, 3.4028235e38f,           -1), "3.4028235e38");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF32ToStringBuilder(&builder, 1e-45f,                  -1), "1e-45");
+
+        // fixed places, including the cases it used to get wrong
+        u64 negativeInfinityBits = 0xFFF0000000000000ULL;
+        f64 negativeInfinity     = 0.0;
+        PNSLR_MemCopy(&negativeInfinity, &negativeInfinityBits, sizeof(f64));
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, 0.5,                     25), "0.5000000000000000000000000");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, 1e300,                    2), "1e300");
+        STRINGS_TEST_FORMATS_AS(PNSLR_AppendF64ToStringBuilder(&builder, negativeInfinity,         2), "-inf");
+        #undef STRINGS_TEST_FORMATS_AS
+
+        // through the formatter as well
+        utf8str formatted = PNSLR_FormatString(PNSLR_StringLiteral("$ $"), PNSLR_FmtArgs(PNSLR_FmtF64(0.1, -1), PNSLR_FmtF32(0.1f, -1)), ctx->testAllocator);
+        Assert(PNSLR_AreStringsEqual(formatted, PNSLR_StringLiteral("0.1 0.1"), PNSLR_StringComparisonType_CaseSensitive));
+    }
+
+    // --- Float formatting benchmark ---
+    {
+        PNSLR_StringBuilder shortest = {.allocator = ctx->testAllocator};
+        PNSLR_StringBuilder fixed    = {.allocator = ctx->testAllocator};
+        PNSLR_ReserveSpaceInStringBuilder(&shortest, 32 * 1024 * 1024);
+        PNSLR_ReserveSpaceInStringBuilder(&fixed,    32 * 1024 * 1024);
+
+        u64 seed = 7;
+        i64 t0 = PNSLR_NanosecondsSinceUnixEpoch();
+        for (i32 i = 0; i < 1000000; ++i)
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            PNSLR_AppendF64ToStringBuilder(&shortest, (f64) (seed >> 11) / 1099511627776.0, -1);
+        }
+        i64 t1 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        seed = 7;
+        for (i32 i = 0; i < 1000000; ++i)
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            PNSLR_AppendF64ToStringBuilder(&fixed, (f64) (seed >> 11) / 1099511627776.0, 6);
+        }
+        i64 t2 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        LogBenchmark(
+            ctx->testAllocator, "Float formatting 1M values: shortest $ us (6 fixed places $ us)",
+            FmtMicroseconds(t1 - t0),
+            FmtMicroseconds(t2 - t1)
+        );
+    }
+
+    // --- Integer formatting benchmark ---
+    {
+        PNSLR_StringBuilder fast  = {.allocator = ctx->testAllocator};
+        PNSLR_StringBuilder naive = {.allocator = ctx->testAllocator};
+        PNSLR_ReserveSpaceInStringBuilder(&fast,  32 * 1024 * 1024);
+        PNSLR_ReserveSpaceInStringBuilder(&naive, 32 * 1024 * 1024);
+
+        u64 seed = 99;
+        i64 t0 = PNSLR_NanosecondsSinceUnixEpoch();
+        for (i32 i = 0; i < 1000000; ++i)
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            PNSLR_AppendU64ToStringBuilder(&fast, seed >> (seed & 63), PNSLR_IntegerBase_Decimal);
+        }
+        i64 t1 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        seed = 99;
+        for (i32 i = 0; i < 1000000; ++i)
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            StringsTestNaiveAppendU64(&naive, seed >> (seed & 63), 10);
+        }
+        i64 t2 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        Assert(PNSLR_AreStringsEqual(PNSLR_StringFromStringBuilder(&fast), PNSLR_StringFromStringBuilder(&naive), PNSLR_StringComparisonType_CaseSensitive));
+
+        LogBenchmark(
+            ctx->testAllocator, "Integer formatting 1M values: $ us (digit at a time $ us)",
+            FmtMicroseconds(t1 - t0),
+            FmtMicroseconds(t2 - t1)
+        );
+    }
+
+    // --- Number parsing ---
+    {
+        #define STRINGS_TEST_PARSES_F64_AS(str, expected) \
+            { \
+                f64 parsed = 0.0, wanted = (expected); u64 parsedBits = 0, wantedBits = 0; \
+                Assert(PNSLR_F64FromString(PNSLR_StringLiteral(str), &parsed)); \
+                PNSLR_MemCopy(&parsedBits, &parsed, sizeof(u64)); PNSLR_MemCopy(&wantedBits, &wanted, sizeof(u64)); \
+                Assert(parsedBits == wantedBits); \
+            }
+
+        STRINGS_TEST_PARSES_F64_AS("0",                        0.0);
+        STRINGS_TEST_PARSES_F64_AS("-0",                       -0.0);
+        STRINGS_TEST_PARSES_F64_AS("1.5",                      1.5);
+        STRINGS_TEST_PARSES_F64_AS("+.5",                      0.5);
+        STRINGS_TEST_PARSES_F64_AS("5.",                       5.0);
+        STRINGS_TEST_PARSES_F64_AS("0.1",                      0.1);
+        STRINGS_TEST_PARSES_F64_AS("-1234.5678",               -1234.5678);
+        STRINGS_TEST_PARSES_F64_AS("1e23",                     1e23);
+        STRINGS_TEST_PARSES_F64_AS("6.02214076E+23",           6.02214076e23);
+        STRINGS_TEST_PARSES_F64_AS("9007199254740993",         9007199254740992.0); // halfway, to even
+        STRINGS_TEST_PARSES_F64_AS("1.7976931348623157e308",   1.7976931348623157e308);
+        STRINGS_TEST_PARSES_F64_AS("2.2250738585072011e-308",  2.2250738585072011e-308);
+        STRINGS_TEST_PARSES_F64_AS("4.9406564584124654e-324",  4.9406564584124654e-324);
+        STRINGS_TEST_PARSES_F64_AS("1e-400",                   0.0);
+        STRINGS_TEST_PARSES_F64_AS("0.000000000000000000000000000001", 1e-30);
+        STRINGS_TEST_PARSES_F64_AS("123456789012345678901234567890",   1.2345678901234568e29);
+
+        // one past the halfway point between 1 and the next double, but only on the 40th digit (the exact fallback)
+        STRINGS_TEST_PARSES_F64_AS("1.000000000000000111022302462515654042364", 1.0000000000000002);
+        STRINGS_TEST_PARSES_F64_AS("1.000000000000000111022302462515654042363", 1.0);
+        #undef STRINGS_TEST_PARSES_F64_AS
+
+        f32 parsed32 = 0.0f;
+        Assert(PNSLR_F32FromString(PNSLR_StringLiteral("3.4028235e38"), &parsed32) && parsed32 >= 3.4028235e38f && parsed32 <= 3.4028235e38f);
+        Assert(PNSLR_F32FromString(PNSLR_StringLiteral("1.00000005960464477550"), &parsed32) && parsed32 >= 1.0000001f && parsed32 <= 1.0000001f); // no double rounding through f64
+
+        u64 infinityBits = 0, nanBits = 0;
+        f64 special      = 0.0;
+        Assert(PNSLR_F64FromString(PNSLR_StringLiteral("-Infinity"), &special)); PNSLR_MemCopy(&infinityBits, &special, sizeof(u64));
+        Assert(infinityBits == 0xFFF0000000000000ULL);
+        Assert(PNSLR_F64FromString(PNSLR_StringLiteral("1e400"), &special));     PNSLR_MemCopy(&infinityBits, &special, sizeof(u64));
+        Assert(infinityBits == 0x7FF0000000000000ULL);
+        Assert(PNSLR_F64FromString(PNSLR_StringLiteral("nan"), &special));       PNSLR_MemCopy(&nanBits, &special, sizeof(u64));
+        Assert((nanBits & 0x7FF0000000000000ULL) == 0x7FF0000000000000ULL && (nanBits & 0x000FFFFFFFFFFFFFULL));
+
+        Assert(!PNSLR_F64FromString(PNSLR_StringLiteral("-"),     &special));
+        Assert(!PNSLR_F64FromString(PNSLR_StringLiteral("."),     &special));
+        Assert(!PNSLR_F64FromString(PNSLR_StringLiteral("1e"),    &special));
+        Assert(!PNSLR_F64FromString(PNSLR_StringLiteral("1.2.3"), &special));
+        Assert(!PNSLR_F64FromString(PNSLR_StringLiteral("12a"),   &special));
+
+        u64 unsignedValue = 0;
+        i64 signedValue   = 0;
+        Assert(PNSLR_U64FromString(PNSLR_StringLiteral("18446744073709551615"), &unsignedValue) && unsignedValue == U64_MAX);
+        Assert(PNSLR_U64FromString(PNSLR_StringLiteral("000000000000000000000000042"), &unsignedValue) && unsignedValue == 42);
+        Assert(PNSLR_U64FromString(PNSLR_StringLiteral("1234567890123456"), &unsignedValue) && unsignedValue == 1234567890123456ULL);
+        Assert(PNSLR_U64FromString(PNSLR_StringLiteral("ff"), &unsignedValue) && unsignedValue == 255);
+        Assert(PNSLR_U64FromString(PNSLR_StringLiteral("0xFFFFFFFFFFFFFFFF"), &unsignedValue) && unsignedValue == U64_MAX);
+        Assert(!PNSLR_U64FromString(PNSLR_StringLiteral("18446744073709551616"), &unsignedValue));
+        Assert(!PNSLR_U64FromString(PNSLR_StringLiteral("99999999999999999999"), &unsignedValue));
+        Assert(!PNSLR_U64FromString(PNSLR_StringLiteral("0x10000000000000000"), &unsignedValue));
+        Assert(!PNSLR_U64FromString(PNSLR_StringLiteral("12345678x"), &unsignedValue));
+        Assert(PNSLR_I64FromString(PNSLR_StringLiteral("-9223372036854775808"), &signedValue) && signedValue == I64_MIN);
+        Assert(PNSLR_I64FromString(PNSLR_StringLiteral("+9223372036854775807"), &signedValue) && signedValue == I64_MAX);
+        Assert(!PNSLR_I64FromString(PNSLR_StringLiteral("9223372036854775808"), &signedValue));
+    }
+
+    // --- Number parsing round-trip and benchmark ---
+    {
+        PNSLR_StringBuilder text = {.allocator = ctx->testAllocator};
+        PNSLR_ReserveSpaceInStringBuilder(&text, 32 * 1024 * 1024);
+
+        // every shortest representation has to parse back to the exact same bits
+        u64 seed = 13;
+        for (i32 i = 0; i < 1000000; ++i)
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            u64 bits = seed;
+            if ((bits & 0x7FF0000000000000ULL) == 0x7FF0000000000000ULL) { bits ^= 0x4000000000000000ULL; } // no inf/nan
+
+            f64 value = 0.0;
+            PNSLR_MemCopy(&value, &bits, sizeof(f64));
+            if (i) { PNSLR_AppendByteToStringBuilder(&text, ','); }
+            PNSLR_AppendF64ToStringBuilder(&text, value, -1);
+        }
+
+        utf8str csv    = PNSLR_StringFromStringBuilder(&text);
+        i64     count  = 0;
+        PNSLR_ArraySlice(f64) values = PNSLR_MakeSlice(f64, 1000000, false, ctx->testAllocator, PNSLR_GET_LOC(), nil);
+
+        i64 t0 = PNSLR_NanosecondsSinceUnixEpoch();
+        Assert(PNSLR_F64ArrayFromString(csv, ',', values, &count) && count == 1000000);
+        i64 t1 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        seed = 13;
+        b8 allRoundTripped = true;
+        for (i32 i = 0; i < 1000000; ++i)
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            u64 bits = seed, parsedBits = 0;
+            if ((bits & 0x7FF0000000000000ULL) == 0x7FF0000000000000ULL) { bits ^= 0x4000000000000000ULL; }
+
+            PNSLR_MemCopy(&parsedBits, &values.data[i], sizeof(u64));
+            allRoundTripped = allRoundTripped && (parsedBits == bits);
+        }
+        Assert(allRoundTripped);
+
+        // integers, straight off the formatter
+        PNSLR_ResetStringBuilder(&text);
+        for (i32 i = 0; i < 1000000; ++i)
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            if (i) { PNSLR_AppendByteToStringBuilder(&text, '\n'); }
+            PNSLR_AppendU64ToStringBuilder(&text, seed >> (seed & 63), PNSLR_IntegerBase_Decimal);
+        }
+
+        PNSLR_ArraySlice(u64) integers = PNSLR_MakeSlice(u64, 1000000, false, ctx->testAllocator, PNSLR_GET_LOC(), nil);
+        i64 t2 = PNSLR_NanosecondsSinceUnixEpoch();
+        Assert(PNSLR_U64ArrayFromString(PNSLR_StringFromStringBuilder(&text), '\n', integers, &count) && count == 1000000);
+        i64 t3 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        LogBenchmark(
+            ctx->testAllocator, "Number parsing 1M values: f64 $ us, u64 $ us",
+            FmtMicroseconds(t1 - t0),
+            FmtMicroseconds(t3 - t2)
+        );
+    }
+
+    // --- Bulk number parsing ---
+    {
+        i64 count = 0;
+        PNSLR_ArraySlice(i64) integers = PNSLR_MakeSlice(i64, 4, false, ctx->testAllocator, PNSLR_GET_LOC(), nil);
+        Assert(PNSLR_I64ArrayFromString(PNSLR_StringLiteral(" 1, -2 ,\t0x10 , 4\r\n"), ',', integers, &count) && count == 4);
+        Assert(integers.data[0] == 1 && integers.data[1] == -2 && integers.data[2] == 16 && integers.data[3] == 4);
+        Assert(PNSLR_I64ArrayFromString(PNSLR_StringLiteral("  "), ',', integers, &count) && count == 0);
+        Assert(!PNSLR_I64ArrayFromString(PNSLR_StringLiteral("1,2,3,4,5"), ',', integers, &count) && count == 4); // out of space
+        Assert(!PNSLR_I64ArrayFromString(PNSLR_StringLiteral("1,,3"), ',', integers, &count) && count == 1);
+        Assert(!PNSLR_I64ArrayFromString(PNSLR_StringLiteral("1,2,"), ',', integers, &count) && count == 2);
+
+        PNSLR_ArraySlice(f32) floats = PNSLR_MakeSlice(f32, 3, false, ctx->testAllocator, PNSLR_GET_LOC(), nil);
+        Assert(PNSLR_F32ArrayFromString(PNSLR_StringLiteral("0.5;-inf;1e2"), ';', floats, &count) && count == 3);
+        Assert(floats.data[0] >= 0.5f && floats.data[0] <= 0.5f && floats.data[1] < -F32_MAX && floats.data[2] >= 100.0f && floats.data[2] <= 100.0f);
+    }
+
+    // --- Compiled formats ---
+    {
+        #define STRINGS_TEST_COMPILED_FORMAT_MATCHES(fmt, ...) \
+            { \
+                PNSLR_CompiledFormat compiled = PNSLR_CompileFormat(PNSLR_StringLiteral(fmt), ctx->testAllocator); \
+                StringsTestCountingStream counting = {.builder = {.allocator = ctx->testAllocator}}; \
+                PNSLR_StringBuilder direct = {.allocator = ctx->testAllocator}; \
+                Assert(PNSLR_FormatCompiledAndWriteToStream((PNSLR_Stream) {.procedure = StringsTestCountingStreamProcedure, .data = &counting}, &compiled, PNSLR_FmtArgs(__VA_ARGS__))); \
+                Assert(PNSLR_FormatCompiledAndWriteToStream(PNSLR_StreamFromStringBuilder(&direct), &compiled, PNSLR_FmtArgs(__VA_ARGS__))); \
+                utf8str expected = PNSLR_FormatString(PNSLR_StringLiteral(fmt), PNSLR_FmtArgs(__VA_ARGS__), ctx->testAllocator); \
+                Assert(counting.numWrites == 1); \
+                Assert(PNSLR_AreStringsEqual(PNSLR_StringFromStringBuilder(&counting.builder), expected, PNSLR_StringComparisonType_CaseSensitive)); \
+                Assert(PNSLR_AreStringsEqual(PNSLR_StringFromStringBuilder(&direct),           expected, PNSLR_StringComparisonType_CaseSensitive)); \
+                PNSLR_FreeCompiledFormat(&compiled); \
+                Assert(!compiled.literals.data); \
+            }
+
+        STRINGS_TEST_COMPILED_FORMAT_MATCHES("[$] $: $ ($$$)", PNSLR_FmtString(PNSLR_StringLiteral("INFO")), PNSLR_FmtI32(-42, PNSLR_IntegerBase_Decimal), PNSLR_FmtF64(3.25, 2), PNSLR_FmtU64(U64_MAX, PNSLR_IntegerBase_Binary));
+        STRINGS_TEST_COMPILED_FORMAT_MATCHES("$$$$ $", PNSLR_FmtB8(false), PNSLR_FmtRune(0x1F600), PNSLR_FmtCString("extra"));
+        STRINGS_TEST_COMPILED_FORMAT_MATCHES("$ and $ and $", PNSLR_FmtF32(0.1f, -1));
+        STRINGS_TEST_COMPILED_FORMAT_MATCHES("$$", PNSLR_FmtI64(I64_MIN, PNSLR_IntegerBase_HexaDecimal));
+        #undef STRINGS_TEST_COMPILED_FORMAT_MATCHES
+
+        PNSLR_CompiledFormat escaped = PNSLR_CompileFormat(PNSLR_StringLiteral("a$$b$c"), ctx->testAllocator);
+        Assert(escaped.literals.count == 2 && escaped.literalsLength == 4);
+        Assert(PNSLR_AreStringsEqual(escaped.literals.data[0], PNSLR_StringLiteral("a$b"), PNSLR_StringComparisonType_CaseSensitive));
+        Assert(PNSLR_AreStringsEqual(escaped.literals.data[1], PNSLR_StringLiteral("c"),   PNSLR_StringComparisonType_CaseSensitive));
+        PNSLR_FreeCompiledFormat(&escaped);
+    }
+
+    // --- Compiled format benchmark ---
+    {
+        utf8str                   fmt      = PNSLR_StringLiteral("[$] frame $ took $ms ($ draw calls, $ triangles) on thread $\n");
+        PNSLR_CompiledFormat      compiled = PNSLR_CompileFormat(fmt, ctx->testAllocator);
+        StringsTestCountingStream adhoc    = {.builder = {.allocator = ctx->testAllocator}};
+        StringsTestCountingStream once     = {.builder = {.allocator = ctx->testAllocator}};
+        PNSLR_ReserveSpaceInStringBuilder(&adhoc.builder, 128 * 1024 * 1024);
+        PNSLR_ReserveSpaceInStringBuilder(&once.builder,  128 * 1024 * 1024);
+        PNSLR_Stream adhocStream = {.procedure = StringsTestCountingStreamProcedure, .data = &adhoc};
+        PNSLR_Stream onceStream  = {.procedure = StringsTestCountingStreamProcedure, .data = &once};
+
+        #define STRINGS_TEST_LOG_LINE_ARGS(i) PNSLR_FmtArgs( \
+            PNSLR_FmtString(PNSLR_StringLiteral("RENDER")), PNSLR_FmtI32(i, PNSLR_IntegerBase_Decimal), PNSLR_FmtF32((f32) (i % 100) * 0.25f, 2), \
+            PNSLR_FmtU32((u32) i % 4096, PNSLR_IntegerBase_Decimal), PNSLR_FmtU64((u64) i * 977, PNSLR_IntegerBase_Decimal), PNSLR_FmtI32(i % 8, PNSLR_IntegerBase_Decimal))
+
+        i64 t0 = PNSLR_NanosecondsSinceUnixEpoch();
+        for (i32 i = 0; i < 1000000; ++i) { PNSLR_FormatAndWriteToStream(adhocStream, fmt, STRINGS_TEST_LOG_LINE_ARGS(i)); }
+        i64 t1 = PNSLR_NanosecondsSinceUnixEpoch();
+        for (i32 i = 0; i < 1000000; ++i) { PNSLR_FormatCompiledAndWriteToStream(onceStream, &compiled, STRINGS_TEST_LOG_LINE_ARGS(i)); }
+        i64 t2 = PNSLR_NanosecondsSinceUnixEpoch();
+        #undef STRINGS_TEST_LOG_LINE_ARGS
+
+        Assert(once.numWrites == 1000000);
+        Assert(PNSLR_AreStringsEqual(PNSLR_StringFromStringBuilder(&adhoc.builder), PNSLR_StringFromStringBuilder(&once.builder), PNSLR_StringComparisonType_CaseSensitive));
+        PNSLR_FreeCompiledFormat(&compiled);
+
+        LogBenchmark(
+            ctx->testAllocator, "Formatting 1M log lines: compiled $ us, 1 write each ($ us, $ writes uncompiled)",
+            FmtMicroseconds(t2 - t1),
+            FmtMicroseconds(t1 - t0),
+            PNSLR_FmtI64(adhoc.numWrites, PNSLR_IntegerBase_Decimal)
+        );
+    }
+
+    // --- Trimming and splitting ---
+    {
+        Assert(PNSLR_AreStringsEqual(PNSLR_TrimString(PNSLR_StringLiteral(" \t hi there \r\n")), PNSLR_StringLiteral("hi there"), PNSLR_StringComparisonType_CaseSensitive));
+        Assert(PNSLR_AreStringsEqual(PNSLR_TrimStringFromStart(PNSLR_StringLiteral("  x  ")), PNSLR_StringLiteral("x  "), PNSLR_StringComparisonType_CaseSensitive));
+        Assert(PNSLR_AreStringsEqual(PNSLR_TrimStringFromEnd(PNSLR_StringLiteral("  x  ")),   PNSLR_StringLiteral("  x"), PNSLR_StringComparisonType_CaseSensitive));
+        Assert(PNSLR_TrimString(PNSLR_StringLiteral(" \n ")).count == 0);
+
+        // every part from the start, joined with '|', and then the same from the end
+        #define STRINGS_TEST_SPLITS_AS(makeIterator, expectedFromStart, expectedFromEnd) \
+            { \
+                PNSLR_StringBuilder joined = {.allocator = ctx->testAllocator}; \
+                PNSLR_StringSplitIterator iterator = makeIterator; \
+                utf8str part; \
+                for (i32 n = 0; PNSLR_NextSplitFromStart(&iterator, &part); ++n) { if (n) { PNSLR_AppendByteToStringBuilder(&joined, '|'); } PNSLR_AppendStringToStringBuilder(&joined, part); } \
+                Assert(PNSLR_AreStringsEqual(PNSLR_StringFromStringBuilder(&joined), PNSLR_StringLiteral(expectedFromStart), PNSLR_StringComparisonType_CaseSensitive)); \
+                PNSLR_ResetStringBuilder(&joined); \
+                iterator = makeIterator; \
+                for (i32 n = 0; PNSLR_NextSplitFromEnd(&iterator, &part); ++n) { if (n) { PNSLR_AppendByteToStringBuilder(&joined, '|'); } PNSLR_AppendStringToStringBuilder(&joined, part); } \
+                Assert(PNSLR_AreStringsEqual(PNSLR_StringFromStringBuilder(&joined), PNSLR_StringLiteral(expectedFromEnd), PNSLR_StringComparisonType_CaseSensitive)); \
+            }
+
+        STRINGS_TEST_SPLITS_AS(PNSLR_SplitStringByByte(PNSLR_StringLiteral("a,b,,c"), ','),                                              "a|b||c",        "c||b|a");
+        STRINGS_TEST_SPLITS_AS(PNSLR_SplitStringByByte(PNSLR_StringLiteral(""), ','),                                                    "",              "");
+        STRINGS_TEST_SPLITS_AS(PNSLR_SplitStringByByte(PNSLR_StringLiteral("this is a rather long line,with just two parts"), ','),       "this is a rather long line|with just two parts", "with just two parts|this is a rather long line");
+        STRINGS_TEST_SPLITS_AS(PNSLR_SplitStringByString(PNSLR_StringLiteral("oneANDtwoandthree"), PNSLR_StringLiteral("and"), PNSLR_StringComparisonType_CaseInsensitive), "one|two|three", "three|two|one");
+        STRINGS_TEST_SPLITS_AS(PNSLR_SplitStringByString(PNSLR_StringLiteral("a::b::"), PNSLR_StringLiteral("::"), PNSLR_StringComparisonType_CaseSensitive), "a|b|", "|b|a");
+        STRINGS_TEST_SPLITS_AS(PNSLR_SplitStringByAnyOf(PNSLR_StringLiteral("k=v;x=y"), PNSLR_StringLiteral("=;")),                       "k|v|x|y",       "y|x|v|k");
+        STRINGS_TEST_SPLITS_AS(PNSLR_SplitStringByAnyOf(PNSLR_StringLiteral("a1b2c3d"), PNSLR_StringLiteral("0123456789")),              "a|b|c|d",       "d|c|b|a");
+        STRINGS_TEST_SPLITS_AS(PNSLR_SplitStringByLines(PNSLR_StringLiteral("one\r\ntwo\n\nfour\n")),                                    "one|two||four", "four||two|one");
+        STRINGS_TEST_SPLITS_AS(PNSLR_SplitStringByLines(PNSLR_StringLiteral("\n")),                                                      "",              "");
+        STRINGS_TEST_SPLITS_AS(PNSLR_SplitStringByWhitespace(PNSLR_StringLiteral("  the quick\t\tbrown \n fox ")),                     "the|quick|brown|fox", "fox|brown|quick|the");
+        #undef STRINGS_TEST_SPLITS_AS
+
+        // nothing at all to yield
+        PNSLR_StringSplitIterator nothing = PNSLR_SplitStringByLines(PNSLR_StringLiteral(""));
+        utf8str                   part    = {0};
+        Assert(!PNSLR_NextSplitFromStart(&nothing, &part));
+        nothing = PNSLR_SplitStringByWhitespace(PNSLR_StringLiteral(" \t "));
+        Assert(!PNSLR_NextSplitFromEnd(&nothing, &part));
+
+        // both ends of the same iterator, and the parts are views into the original
+        utf8str                   path  = PNSLR_StringLiteral("usr/local/lib/libfoo.so");
+        PNSLR_StringSplitIterator parts = PNSLR_SplitStringByByte(path, '/');
+        Assert(PNSLR_NextSplitFromEnd(&parts, &part)   && PNSLR_AreStringsEqual(part, PNSLR_StringLiteral("libfoo.so"), PNSLR_StringComparisonType_CaseSensitive) && part.data == path.data + 14);
+        Assert(PNSLR_NextSplitFromStart(&parts, &part) && PNSLR_AreStringsEqual(part, PNSLR_StringLiteral("usr"),       PNSLR_StringComparisonType_CaseSensitive) && part.data == path.data);
+        Assert(PNSLR_AreStringsEqual(parts.remaining, PNSLR_StringLiteral("local/lib"), PNSLR_StringComparisonType_CaseSensitive));
+    }
+
+    // --- Tokenizer ---
+    {
+        utf8str source = PNSLR_StringLiteral(
+            "window.width = 1280 // pixels\n"
+            "  title=\"Hello, \\\"world\\\"\"\n"
+            "scale = -1.5e-3;\n"
+            "bad = 'unterminated\n"
+            "# not a comment here");
+
+        PNSLR_Tokenizer tokenizer = PNSLR_MakeTokenizer(source, PNSLR_StringLiteral("//"));
+
+        #define STRINGS_TEST_NEXT_TOKEN_IS(tokenType, tokenText, tokenLine, tokenColumn) \
+            { \
+                PNSLR_Token token = PNSLR_NextToken(&tokenizer); \
+                Assert(token.type == tokenType && token.line == tokenLine && token.column == tokenColumn); \
+                Assert(PNSLR_AreStringsEqual(token.text, PNSLR_StringLiteral(tokenText), PNSLR_StringComparisonType_CaseSensitive)); \
+            }
+
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Identifier, "window",                  1, 1);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Symbol,     ".",                       1, 7);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Identifier, "width",                   1, 8);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Symbol,     "=",                       1, 14);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Number,     "1280",                    1, 16);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Identifier, "title",                   2, 3);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Symbol,     "=",                       2, 8);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_String,     "\"Hello, \\\"world\\\"\"", 2, 9);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Identifier, "scale",                   3, 1);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Symbol,     "=",                       3, 7);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Symbol,     "-",                       3, 9);
+
+        PNSLR_Token peeked = PNSLR_PeekToken(&tokenizer);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Number,     "1.5e-3",                  3, 10);
+        Assert(peeked.type == PNSLR_TokenType_Number && peeked.line == 3 && peeked.column == 10);
+
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Symbol,     ";",                       3, 16);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Identifier, "bad",                     4, 1);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Symbol,     "=",                       4, 5);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Invalid,    "'unterminated",           4, 7);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Symbol,     "#",                       5, 1);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Identifier, "not",                     5, 3);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Identifier, "a",                       5, 7);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Identifier, "comment",                 5, 9);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Identifier, "here",                    5, 17);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_EndOfInput, "",                        5, 21);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_EndOfInput, "",                        5, 21);
+
+        // an escaped line end still ends the string, and still counts as a new line
+        tokenizer = PNSLR_MakeTokenizer(PNSLR_StringLiteral("x = \"ab\\\ncd\"\ny"), PNSLR_StringLiteral("//"));
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Identifier, "x",                       1, 1);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Symbol,     "=",                       1, 3);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Invalid,    "\"ab\\",                  1, 5);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Identifier, "cd",                      2, 1);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Invalid,    "\"",                      2, 3);
+        STRINGS_TEST_NEXT_TOKEN_IS(PNSLR_TokenType_Identifier, "y",                       3, 1);
+        #undef STRINGS_TEST_NEXT_TOKEN_IS
+
+        f64 scale = 0.0;
+        PNSLR_Tokenizer number = PNSLR_MakeTokenizer(PNSLR_StringLiteral("  2.5e+2 "), (utf8str) {0});
+        Assert(PNSLR_F64FromString(PNSLR_NextToken(&number).text, &scale) && scale >= 250.0 && scale <= 250.0);
+    }
+
+    // --- Splitting benchmark ---
+    {
+        // ~16 MiB of csv-ish lines
+        PNSLR_StringBuilder text = {.allocator = ctx->testAllocator};
+        PNSLR_ReserveSpaceInStringBuilder(&text, 17 * 1024 * 1024);
+        u64 seed = 5;
+        while (text.writtenSize < 16 * 1024 * 1024)
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            PNSLR_AppendStringToStringBuilder(&text, PNSLR_StringLiteral("some_record_name,"));
+            PNSLR_AppendU64ToStringBuilder(&text, seed >> 40, PNSLR_IntegerBase_Decimal);
+            PNSLR_AppendStringToStringBuilder(&text, PNSLR_StringLiteral(",a longer free-text field that goes on for a while\n"));
+        }
+
+        utf8str all = PNSLR_StringFromStringBuilder(&text);
+
+        i64 t0 = PNSLR_NanosecondsSinceUnixEpoch();
+        i64 numLines = 0, numFields = 0, fieldBytes = 0;
+        PNSLR_StringSplitIterator lines = PNSLR_SplitStringByLines(all);
+        utf8str line;
+        while (PNSLR_NextSplitFromStart(&lines, &line))
+        {
+            numLines++;
+            PNSLR_StringSplitIterator fields = PNSLR_SplitStringByByte(line, ',');
+            utf8str field;
+            while (PNSLR_NextSplitFromStart(&fields, &field)) { numFields++; fieldBytes += field.count; }
+        }
+        i64 t1 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        // byte at a time, for comparison
+        i64 naiveLines = 0, naiveFields = 0;
+        for (i64 i = 0; i < all.count; ++i)
+        {
+            if (all.data[i] == ',')  { naiveFields++; }
+            if (all.data[i] == '\n') { naiveLines++; naiveFields++; }
+        }
+        i64 t2 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        Assert(numLines == naiveLines && numFields == naiveFields && fieldBytes + numFields == all.count); // every field, plus its separator
+
+        LogBenchmark(
+            ctx->testAllocator, "Splitting 16 MiB into $ lines and $ fields: $ us (byte at a time $ us)",
+            PNSLR_FmtI64(numLines, PNSLR_IntegerBase_Decimal),
+            PNSLR_FmtI64(numFields, PNSLR_IntegerBase_Decimal),
+            FmtMicroseconds(t1 - t0),
+            FmtMicroseconds(t2 - t1)
+        );
+    }
+
+    // --- Hashing ---
+    {
+        utf8str text = PNSLR_StringLiteral("the quick brown fox jumps over the lazy dog, then does it again, and again, and again");
+        Assert(PNSLR_HashString(text, 0) == PNSLR_HashString(PNSLR_CloneString(text, ctx->testAllocator), 0));
+        Assert(PNSLR_HashString(text, 0) != PNSLR_HashString(text, 1));
+        Assert(PNSLR_HashString((utf8str) {0}, 0) == PNSLR_HashString((utf8str) {.data = text.data, .count = 0}, 0));
+
+        // every prefix (covering each of the length-dependent paths) hashes differently
+        u64 hashes[90];
+        for (i64 i = 0; i < 90; ++i) { hashes[i] = PNSLR_HashString((utf8str) {.data = text.data, .count = i < text.count ? i : text.count}, 0); }
+        b8 allDifferent = true;
+        for (i64 i = 0; i < 90 && i < text.count; ++i) { for (i64 j = 0; j < i; ++j) { if (hashes[i] == hashes[j]) { allDifferent = false; } } }
+        Assert(allDifferent);
+    }
+
+    // --- String interning ---
+    {
+        PNSLR_StringInterner interner = PNSLR_CreateStringInterner(ctx->testAllocator);
+        Assert(interner.data != nil);
+
+        u32 foo  = PNSLR_InternString(interner, PNSLR_StringLiteral("foo"));
+        u32 bar  = PNSLR_InternString(interner, PNSLR_StringLiteral("bar"));
+        u32 none = PNSLR_InternString(interner, PNSLR_StringLiteral(""));
+        Assert(foo && bar && none && foo != bar && bar != none && foo != none);
+        Assert(PNSLR_InternString(interner, PNSLR_CloneString(PNSLR_StringLiteral("foo"), ctx->testAllocator)) == foo);
+        Assert(PNSLR_InternString(interner, PNSLR_StringLiteral("FOO")) != foo); // case matters
+        Assert(PNSLR_GetInternedStringsCount(interner) == 4);
+
+        Assert(PNSLR_FindInternedString(interner, PNSLR_StringLiteral("bar")) == bar);
+        Assert(PNSLR_FindInternedString(interner, PNSLR_StringLiteral("baz")) == 0);
+        Assert(PNSLR_GetInternedStringsCount(interner) == 4); // finding doesn't add
+
+        utf8str fooStr = PNSLR_GetInternedString(interner, foo);
+        Assert(PNSLR_AreStringsEqual(fooStr, PNSLR_StringLiteral("foo"), PNSLR_StringComparisonType_CaseSensitive) && fooStr.data[3] == 0);
+        Assert(PNSLR_GetInternedString(interner, none).count == 0);
+        Assert(PNSLR_GetInternedString(interner, 0).data == nil);
+        Assert(PNSLR_GetInternedString(interner, 0xFFFFFF).data == nil);
+
+        // enough to make every shard grow its slots a few times
+        b8 allStable = true;
+        u32 handles[5000];
+        for (i32 i = 0; i < 5000; ++i)
+        {
+            utf8str key = PNSLR_FormatString(PNSLR_StringLiteral("key_$"), PNSLR_FmtArgs(PNSLR_FmtI32(i, PNSLR_IntegerBase_Decimal)), ctx->testAllocator);
+            handles[i] = PNSLR_InternString(interner, key);
+        }
+        for (i32 i = 0; i < 5000; ++i)
+        {
+            utf8str key = PNSLR_FormatString(PNSLR_StringLiteral("key_$"), PNSLR_FmtArgs(PNSLR_FmtI32(i, PNSLR_IntegerBase_Decimal)), ctx->testAllocator);
+            if (PNSLR_FindInternedString(interner, key) != handles[i])                                                    { allStable = false; }
+            if (!PNSLR_AreStringsEqual(PNSLR_GetInternedString(interner, handles[i]), key, PNSLR_StringComparisonType_CaseSensitive)) { allStable = false; }
+        }
+        Assert(allStable && PNSLR_GetInternedStringsCount(interner) == 5004);
+        Assert(PNSLR_GetInternedString(interner, foo).data == fooStr.data); // never moved
+
+        // a snapshot gives back the same handles
+        PNSLR_Path snapshotPath = PNSLR_GetPathForChildFile(ctx->tgtDir, PNSLR_StringLiteral("StringsTestInterner.bin"), ctx->testAllocator);
+        Assert(PNSLR_SaveStringInternerToFile(interner, snapshotPath));
+
+        PNSLR_StringInterner loaded = PNSLR_LoadStringInternerFromFile(snapshotPath, ctx->testAllocator);
+        Assert(loaded.data != nil && PNSLR_GetInternedStringsCount(loaded) == 5004);
+
+        b8 allRestored = PNSLR_FindInternedString(loaded, PNSLR_StringLiteral("foo")) == foo &&
+                         PNSLR_FindInternedString(loaded, PNSLR_StringLiteral(""))    == none;
+        for (i32 i = 0; i < 5000; ++i)
+        {
+            utf8str original = PNSLR_GetInternedString(interner, handles[i]);
+            if (!PNSLR_AreStringsEqual(PNSLR_GetInternedString(loaded, handles[i]), original, PNSLR_StringComparisonType_CaseSensitive)) { allRestored = false; }
+            if (PNSLR_InternString(loaded, original) != handles[i])                                                                   { allRestored = false; }
+        }
+        Assert(allRestored && PNSLR_GetInternedStringsCount(loaded) == 5004);
+        PNSLR_DestroyStringInterner(&loaded);
+        Assert(loaded.data == nil);
+
+        // the header reads the same on any machine
+        PNSLR_ArraySlice(u8) snapshot = {0};
+        Assert(PNSLR_ReadAllContentsFromFile(snapshotPath, &snapshot, ctx->testAllocator));
+        Assert(snapshot.count > 8 && PNSLR_AreStringsEqual((utf8str) {.data = snapshot.data, .count = 4}, PNSLR_StringLiteral("PNSI"), PNSLR_StringComparisonType_CaseSensitive));
+        Assert(snapshot.data[4] == 1 && snapshot.data[5] == 0 && snapshot.data[6] == 0 && snapshot.data[7] == 0); // version, little-endian
+
+        // anything cut short is rejected
+        snapshot.count -= 1;
+        Assert(PNSLR_WriteAllContentsToFile(snapshotPath, snapshot, false));
+        Assert(PNSLR_LoadStringInternerFromFile(snapshotPath, ctx->testAllocator).data == nil);
+        PNSLR_DeletePath(snapshotPath);
+
+        PNSLR_DestroyStringInterner(&interner);
+    }
+
+    // --- Concurrent string interning ---
+    {
+        #define STRINGS_TEST_NUM_INTERNER_WORKERS 4
+        #define STRINGS_TEST_NUM_INTERNER_KEYS    4000
+
+        PNSLR_Allocator      heap     = PNSLR_GetAllocator_DefaultHeap();
+        PNSLR_StringInterner interner = PNSLR_CreateStringInterner(heap);
+
+        utf8str* keys = PNSLR_Allocate(ctx->testAllocator, false, STRINGS_TEST_NUM_INTERNER_KEYS * (i64) sizeof(utf8str), (i32) alignof(utf8str), PNSLR_GET_LOC(), nil);
+        for (i32 i = 0; i < STRINGS_TEST_NUM_INTERNER_KEYS; ++i)
+        {
+            keys[i] = PNSLR_FormatString(PNSLR_StringLiteral("shared/key/$"), PNSLR_FmtArgs(PNSLR_FmtI32(i * 7919, PNSLR_IntegerBase_Decimal)), ctx->testAllocator);
+        }
+
+        StringsTestInternerWorkerData workers[STRINGS_TEST_NUM_INTERNER_WORKERS];
+        PNSLR_ThreadHandle            threads[STRINGS_TEST_NUM_INTERNER_WORKERS];
+        for (i32 i = 0; i < STRINGS_TEST_NUM_INTERNER_WORKERS; ++i)
+        {
+            workers[i] = (StringsTestInternerWorkerData)
+            {
+                .interner = interner,
+                .keys     = keys,
+                .numKeys  = STRINGS_TEST_NUM_INTERNER_KEYS,
+                .offset   = i * (STRINGS_TEST_NUM_INTERNER_KEYS / STRINGS_TEST_NUM_INTERNER_WORKERS),
+                .handles  = PNSLR_Allocate(ctx->testAllocator, true, STRINGS_TEST_NUM_INTERNER_KEYS * (i64) sizeof(u32), (i32) alignof(u32), PNSLR_GET_LOC(), nil),
+            };
+            threads[i] = PNSLR_StartThread(StringsTestInternerWorker, &workers[i], PNSLR_StringLiteral("InternerWorker"));
+        }
+        for (i32 i = 0; i < STRINGS_TEST_NUM_INTERNER_WORKERS; ++i) { PNSLR_JoinThread(threads[i]); }
+
+        // every thread got the same handle for the same key, and nothing was added twice
+        b8 allAgree = true;
+        for (i32 k = 0; k < STRINGS_TEST_NUM_INTERNER_KEYS; ++k)
+        {
+            for (i32 i = 0; i < STRINGS_TEST_NUM_INTERNER_WORKERS; ++i) { if (!workers[i].handles[k] || workers[i].handles[k] != workers[0].handles[k]) { allAgree = false; } }
+            if (!PNSLR_AreStringsEqual(PNSLR_GetInternedString(interner, workers[0].handles[k]), keys[k], PNSLR_StringComparisonType_CaseSensitive)) { allAgree = false; }
+        }
+        Assert(allAgree && PNSLR_GetInternedStringsCount(interner) == STRINGS_TEST_NUM_INTERNER_KEYS);
+
+        PNSLR_DestroyStringInterner(&interner);
+
+        #undef STRINGS_TEST_NUM_INTERNER_KEYS
+        #undef STRINGS_TEST_NUM_INTERNER_WORKERS
+    }
+
+    // --- String interning benchmark ---
+    {
+        PNSLR_StringInterner interner = PNSLR_CreateStringInterner(ctx->testAllocator);
+
+        utf8str* keys = PNSLR_Allocate(ctx->testAllocator, false, 100000 * (i64) sizeof(utf8str), (i32) alignof(utf8str), PNSLR_GET_LOC(), nil);
+        for (i32 i = 0; i < 100000; ++i)
+        {
+            keys[i] = PNSLR_FormatString(PNSLR_StringLiteral("Entities/Props/prop_$.asset"), PNSLR_FmtArgs(PNSLR_FmtI32(i, PNSLR_IntegerBase_Decimal)), ctx->testAllocator);
+        }
+
+        i64 t0 = PNSLR_NanosecondsSinceUnixEpoch();
+        u64 handleSum = 0;
+        for (i32 i = 0; i < 100000; ++i) { handleSum += PNSLR_InternString(interner, keys[i]); }
+        i64 t1 = PNSLR_NanosecondsSinceUnixEpoch();
+        u64 foundSum = 0;
+        for (i32 i = 0; i < 100000; ++i) { foundSum += PNSLR_InternString(interner, keys[i]); }
+        i64 t2 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        Assert(handleSum == foundSum && PNSLR_GetInternedStringsCount(interner) == 100000);
+
+        LogBenchmark(
+            ctx->testAllocator, "Interning 100000 strings: $ ns each when new, $ ns each when already there",
+            PNSLR_FmtI64((t1 - t0) / 100000, PNSLR_IntegerBase_Decimal),
+            PNSLR_FmtI64((t2 - t1) / 100000, PNSLR_IntegerBase_Decimal)
+        );
+
+        PNSLR_DestroyStringInterner(&interner);
+    }
+
     // --- Search ---
     utf8str foobarStr = PNSLR_StringFromCString("foobarfoo");
     utf8str fooStr = PNSLR_StringFromCString("foo");
@@ -49,4 +969,106 @@ MAIN_TEST_FN(ctx)
     utf8str replaced = PNSLR_ReplaceInString(foobarStr, fooStr, barStr, ctx->testAllocator, PNSLR_StringComparisonType_CaseSensitive);
     Log("Replaced string created");
     Assert(replaced.count == 9); // "barbarbar"
+
+    // --- Search against reference ---
+    {
+        // a small alphabet, so there's plenty of partial matches to trip over
+        utf8str haystack = PNSLR_MakeString(3000, false, ctx->testAllocator, PNSLR_GET_LOC(), nil);
+        u32 seed = 12345;
+        for (i64 i = 0; i < haystack.count; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            haystack.data[i] = (u8) ("abAB"[(seed >> 16) % 4]);
+        }
+
+        i32 numMismatches = 0;
+        i32 needleLengths[] = {1, 2, 3, 5, 8, 15, 16, 17, 31, 32, 40};
+        for (i32 l = 0; l < (i32) (sizeof(needleLengths) / sizeof(needleLengths[0])); ++l)
+        {
+            for (i32 start = 0; start < 2900; start += 97)
+            {
+                utf8str needle  = {.count = needleLengths[l], .data = haystack.data + start};
+                utf8str window  = {.count = haystack.count - (start % 7), .data = haystack.data + (start % 7)}; // misaligned too
+
+                for (i32 c = 0; c < 2; ++c)
+                {
+                    PNSLR_StringComparisonType type = c ? PNSLR_StringComparisonType_CaseInsensitive : PNSLR_StringComparisonType_CaseSensitive;
+                    if (PNSLR_SearchFirstIndexInString(window, needle, type) != StringsTestNaiveSearch(window, needle, (b8) c, false)) { numMismatches++; }
+                    if (PNSLR_SearchLastIndexInString(window, needle, type)  != StringsTestNaiveSearch(window, needle, (b8) c, true))  { numMismatches++; }
+                }
+            }
+        }
+
+        Assert(numMismatches == 0);
+
+        utf8str text = PNSLR_StringFromCString("The quick brown fox jumps over the lazy dog, THE END");
+        Assert(PNSLR_SearchFirstIndexInString(text, PNSLR_StringFromCString("the"), PNSLR_StringComparisonType_CaseInsensitive) == 0);
+        Assert(PNSLR_SearchLastIndexInString(text, PNSLR_StringFromCString("the"), PNSLR_StringComparisonType_CaseInsensitive) == 45);
+        Assert(PNSLR_SearchLastIndexInString(text, PNSLR_StringFromCString("the"), PNSLR_StringComparisonType_CaseSensitive) == 31);
+        Assert(PNSLR_SearchFirstIndexInString(text, PNSLR_StringFromCString("LAZY DOG"), PNSLR_StringComparisonType_CaseSensitive) == -1);
+        Assert(PNSLR_SearchFirstIndexInString(text, PNSLR_StringFromCString("fox jumps over the lazy dog, the end"), PNSLR_StringComparisonType_CaseInsensitive) == 16);
+    }
+
+    // --- Search benchmark ---
+    {
+        // 8 MiB of log-ish text with the needles right at the end
+        utf8str logText = PNSLR_MakeString(8 * 1024 * 1024, false, ctx->testAllocator, PNSLR_GET_LOC(), nil);
+        cstring line    = "[INF] 12:00:00 worker thread finished processing request, status=ok\n";
+        i32     lineLen = PNSLR_GetCStringLength(line);
+        for (i64 i = 0; i < logText.count; ++i) { logText.data[i] = (u8) line[i % lineLen]; }
+
+        utf8str shortNeedle = PNSLR_StringFromCString("status=FAILED");
+        utf8str longNeedle  = PNSLR_StringFromCString("worker thread finished processing request, status=failed");
+        PNSLR_MemCopy(logText.data + logText.count - 100, shortNeedle.data, shortNeedle.count);
+        PNSLR_MemCopy(logText.data + logText.count - 60,  longNeedle.data,  longNeedle.count);
+
+        i64 t0 = PNSLR_NanosecondsSinceUnixEpoch();
+        i32 fastShort = PNSLR_SearchFirstIndexInString(logText, shortNeedle, PNSLR_StringComparisonType_CaseSensitive);
+        i64 t1 = PNSLR_NanosecondsSinceUnixEpoch();
+        i32 fastLong = PNSLR_SearchFirstIndexInString(logText, longNeedle, PNSLR_StringComparisonType_CaseInsensitive);
+        i64 t2 = PNSLR_NanosecondsSinceUnixEpoch();
+        i32 naiveShort = StringsTestNaiveSearch(logText, shortNeedle, false, false);
+        i64 t3 = PNSLR_NanosecondsSinceUnixEpoch();
+        i32 naiveLong = StringsTestNaiveSearch(logText, longNeedle, true, false);
+        i64 t4 = PNSLR_NanosecondsSinceUnixEpoch();
+
+        Assert(fastShort == naiveShort && fastShort == (i32) logText.count - 100);
+        Assert(fastLong == naiveLong && fastLong == (i32) logText.count - 60);
+
+        LogBenchmark(
+            ctx->testAllocator, "Search 8 MiB: short needle $ us (naive $ us), long case-insensitive needle $ us (naive $ us)",
+            FmtMicroseconds(t1 - t0),
+            FmtMicroseconds(t3 - t2),
+            FmtMicroseconds(t2 - t1),
+            FmtMicroseconds(t4 - t3)
+        );
+    }
+
+    // --- Replace beyond the internal scratch buffer ---
+    utf8str manyAs = PNSLR_MakeString(20000, false, ctx->testAllocator, PNSLR_GET_LOC(), nil);
+    for (i64 i = 0; i < manyAs.count; i++) { manyAs.data[i] = 'a'; }
+
+    PNSLR_InternalAllocatorStats stringsStatsBefore = {0};
+    PNSLR_InternalAllocatorStats internalStats[16] = {0};
+    i32 numInternalStats = PNSLR_GetInternalAllocatorStats((PNSLR_ArraySlice(PNSLR_InternalAllocatorStats)) {.count = 16, .data = internalStats});
+    for (i32 i = 0; i < numInternalStats && i < 16; i++)
+    {
+        if (PNSLR_AreStringAndCStringEqual(internalStats[i].name, "Strings", PNSLR_StringComparisonType_CaseSensitive)) { stringsStatsBefore = internalStats[i]; }
+    }
+
+    utf8str replacedMany = PNSLR_ReplaceInString(manyAs, PNSLR_StringFromCString("a"), PNSLR_StringFromCString("bc"), ctx->testAllocator, PNSLR_StringComparisonType_CaseSensitive);
+    Assert(replacedMany.count == 40000);
+    Assert(replacedMany.data && replacedMany.data[0] == 'b' && replacedMany.data[39999] == 'c');
+
+    PNSLR_InternalAllocatorStats stringsStatsAfter = {0};
+    numInternalStats = PNSLR_GetInternalAllocatorStats((PNSLR_ArraySlice(PNSLR_InternalAllocatorStats)) {.count = 16, .data = internalStats});
+    for (i32 i = 0; i < numInternalStats && i < 16; i++)
+    {
+        if (PNSLR_AreStringAndCStringEqual(internalStats[i].name, "Strings", PNSLR_StringComparisonType_CaseSensitive)) { stringsStatsAfter = internalStats[i]; }
+    }
+
+    Assert(stringsStatsAfter.staticCapacity == 60 * 1024);
+    Assert(stringsStatsAfter.numOverflows > stringsStatsBefore.numOverflows);
+    Assert(stringsStatsAfter.peakOverflowBytes > 0);
+    Assert(stringsStatsAfter.overflowBytes == stringsStatsBefore.overflowBytes); // released on reset
 }
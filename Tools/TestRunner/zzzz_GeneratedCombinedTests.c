@@ -10,17 +10,27 @@
 #include "0020_FilePresentTest.c"
 #undef MAIN_TEST_FN
 
+#undef MAIN_TEST_FN
+#define MAIN_TEST_FN(ctxArgName) void ZZZZ_Test_AllocatorsTest(const TestContext* ctxArgName)
+#include "AllocatorsTest.c"
+#undef MAIN_TEST_FN
+
 #undef MAIN_TEST_FN
 #define MAIN_TEST_FN(ctxArgName) void ZZZZ_Test_EnvVarsTest(const TestContext* ctxArgName)
 #include "EnvVarsTest.c"
 #undef MAIN_TEST_FN
 
+#undef MAIN_TEST_FN
+#define MAIN_TEST_FN(ctxArgName) void ZZZZ_Test_IOTest(const TestContext* ctxArgName)
+#include "IOTest.c"
+#undef MAIN_TEST_FN
+
 #undef MAIN_TEST_FN
 #define MAIN_TEST_FN(ctxArgName) void ZZZZ_Test_StringsTest(const TestContext* ctxArgName)
 #include "StringsTest.c"
 #undef MAIN_TEST_FN
 
-u64 ZZZZ_GetTestsCount(void) { return 4ULL; }
+u64 ZZZZ_GetTestsCount(void) { return 6ULL; }
 
 void ZZZZ_GetAllTests(PNSLR_ArraySlice(TestFunctionInfo) fns)
 {
@@ -30,11 +40,17 @@ void ZZZZ_GetAllTests(PNSLR_ArraySlice(TestFunctionInfo) fns)
     fns.data[1].name = PNSLR_StringLiteral("0020_FilePresentTest");
     fns.data[1].fn   = ZZZZ_Test_0020_FilePresentTest;
 
-    fns.data[2].name = PNSLR_StringLiteral("EnvVarsTest");
-    fns.data[2].fn   = ZZZZ_Test_EnvVarsTest;
+    fns.data[2].name = PNSLR_StringLiteral("AllocatorsTest");
+    fns.data[2].fn   = ZZZZ_Test_AllocatorsTest;
+
+    fns.data[3].name = PNSLR_StringLiteral("EnvVarsTest");
+    fns.data[3].fn   = ZZZZ_Test_EnvVarsTest;
+
+    fns.data[4].name = PNSLR_StringLiteral("IOTest");
+    fns.data[4].fn   = ZZZZ_Test_IOTest;
 
-    fns.data[3].name = PNSLR_StringLiteral("StringsTest");
-    fns.data[3].fn   = ZZZZ_Test_StringsTest;
+    fns.data[5].name = PNSLR_StringLiteral("StringsTest");
+    fns.data[5].fn   = ZZZZ_Test_StringsTest;
 
     // done
 }
@@ -63,6 +63,11 @@ void LogInternal(utf8str message, PNSLR_SourceCodeLocation location)
     BufferMessage(&msg);
 }
 
+void LogBenchmarkInternal(PNSLR_Allocator allocator, utf8str fmt, PNSLR_ArraySlice(PNSLR_PrimitiveFmtOptions) args, PNSLR_SourceCodeLocation location)
+{
+    LogInternal(PNSLR_FormatString(fmt, args, allocator), location);
+}
+
 b8 AssertInternal(b8 condition, utf8str message, PNSLR_SourceCodeLocation location)
 {
     BufferedMessage msg =
@@ -30,6 +30,15 @@ void LogInternal(utf8str message, PNSLR_SourceCodeLocation location);
 #define Log(msg) \
     LogInternal(PNSLR_StringLiteral(msg), PNSLR_GET_LOC())
 
+void LogBenchmarkInternal(PNSLR_Allocator allocator, utf8str fmt, PNSLR_ArraySlice(PNSLR_PrimitiveFmtOptions) args, PNSLR_SourceCodeLocation location);
+
+// benchmark results are only ever logged, never asserted on, timings are too noisy for that
+#define LogBenchmark(allocator, fmt, ...) \
+    LogBenchmarkInternal(allocator, PNSLR_StringLiteral(fmt), PNSLR_FmtArgs(__VA_ARGS__), PNSLR_GET_LOC())
+
+#define FmtMicroseconds(nanoseconds) \
+    PNSLR_FmtI64((nanoseconds) / 1000, PNSLR_IntegerBase_Decimal)
+
 typedef void (*TestFunction)(const TestContext* ctx);
 
 typedef struct